@@ -0,0 +1,1079 @@
+
+_bcbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <pct>:
+static char buf[BSIZE];
+
+static int
+pct(uint hits, uint misses)
+{
+  return hits + misses ? hits * 100 / (hits + misses) : 0;
+   0:	89 d1                	mov    %edx,%ecx
+   2:	01 c1                	add    %eax,%ecx
+   4:	74 0b                	je     11 <pct+0x11>
+   6:	6b c0 64             	imul   $0x64,%eax,%eax
+   9:	ba 00 00 00 00       	mov    $0x0,%edx
+   e:	f7 f1                	div    %ecx
+  10:	c3                   	ret
+  11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  16:	c3                   	ret
+
+00000017 <statroot>:
+
+static void
+statroot(void)
+{
+  17:	55                   	push   %ebp
+  18:	89 e5                	mov    %esp,%ebp
+  1a:	56                   	push   %esi
+  1b:	53                   	push   %ebx
+  1c:	83 ec 48             	sub    $0x48,%esp
+  struct dirent de;
+  struct stat st;
+  char name[DIRSIZ+2];
+  int fd;
+
+  if((fd = open("/", O_RDONLY)) < 0)
+  1f:	6a 00                	push   $0x0
+  21:	68 3c 07 00 00       	push   $0x73c
+  26:	e8 41 04 00 00       	call   46c <open>
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	85 c0                	test   %eax,%eax
+  30:	78 5b                	js     8d <statroot+0x76>
+  32:	89 c3                	mov    %eax,%ebx
+    return;
+  name[0] = '/';
+  34:	c6 45 c4 2f          	movb   $0x2f,-0x3c(%ebp)
+  while(read(fd, &de, sizeof(de)) == sizeof(de)){
+  38:	83 ec 04             	sub    $0x4,%esp
+  3b:	6a 10                	push   $0x10
+  3d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  40:	50                   	push   %eax
+  41:	53                   	push   %ebx
+  42:	e8 fd 03 00 00       	call   444 <read>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	83 f8 10             	cmp    $0x10,%eax
+  4d:	75 32                	jne    81 <statroot+0x6a>
+    if(de.inum == 0)
+  4f:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+  54:	74 e2                	je     38 <statroot+0x21>
+      continue;
+    memmove(name+1, de.name, DIRSIZ);
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	6a 0e                	push   $0xe
+  5b:	8d 45 ea             	lea    -0x16(%ebp),%eax
+  5e:	50                   	push   %eax
+  5f:	8d 75 c4             	lea    -0x3c(%ebp),%esi
+  62:	8d 45 c5             	lea    -0x3b(%ebp),%eax
+  65:	50                   	push   %eax
+  66:	e8 8d 03 00 00       	call   3f8 <memmove>
+    name[DIRSIZ+1] = 0;
+  6b:	c6 45 d3 00          	movb   $0x0,-0x2d(%ebp)
+    stat(name, &st);
+  6f:	83 c4 08             	add    $0x8,%esp
+  72:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  75:	50                   	push   %eax
+  76:	56                   	push   %esi
+  77:	e8 08 03 00 00       	call   384 <stat>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	eb b7                	jmp    38 <statroot+0x21>
+  }
+  close(fd);
+  81:	83 ec 0c             	sub    $0xc,%esp
+  84:	53                   	push   %ebx
+  85:	e8 ca 03 00 00       	call   454 <close>
+  8a:	83 c4 10             	add    $0x10,%esp
+}
+  8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  90:	5b                   	pop    %ebx
+  91:	5e                   	pop    %esi
+  92:	5d                   	pop    %ebp
+  93:	c3                   	ret
+
+00000094 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  94:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  98:	83 e4 f0             	and    $0xfffffff0,%esp
+  9b:	ff 71 fc             	push   -0x4(%ecx)
+  9e:	55                   	push   %ebp
+  9f:	89 e5                	mov    %esp,%ebp
+  a1:	57                   	push   %edi
+  a2:	56                   	push   %esi
+  a3:	53                   	push   %ebx
+  a4:	51                   	push   %ecx
+  a5:	83 ec 48             	sub    $0x48,%esp
+  a8:	8b 19                	mov    (%ecx),%ebx
+  aa:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct bstat st;
+  int kb, rounds, i, fd, start;
+
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+  ad:	83 fb 01             	cmp    $0x1,%ebx
+  b0:	7f 7a                	jg     12c <main+0x98>
+  b2:	c7 45 b4 00 01 00 00 	movl   $0x100,-0x4c(%ebp)
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+  b9:	be 04 00 00 00       	mov    $0x4,%esi
+
+  if((fd = open("bcbig", O_CREATE | O_RDWR)) < 0){
+  be:	83 ec 08             	sub    $0x8,%esp
+  c1:	68 02 02 00 00       	push   $0x202
+  c6:	68 3e 07 00 00       	push   $0x73e
+  cb:	e8 9c 03 00 00       	call   46c <open>
+  d0:	89 c7                	mov    %eax,%edi
+  d2:	83 c4 10             	add    $0x10,%esp
+  d5:	85 c0                	test   %eax,%eax
+  d7:	0f 88 84 00 00 00    	js     161 <main+0xcd>
+    printf(1, "bcbench: cannot create bcbig\n");
+    exit();
+  }
+  memset(buf, 'b', sizeof(buf));
+  dd:	83 ec 04             	sub    $0x4,%esp
+  e0:	68 00 02 00 00       	push   $0x200
+  e5:	6a 62                	push   $0x62
+  e7:	68 c0 08 00 00       	push   $0x8c0
+  ec:	e8 00 02 00 00       	call   2f1 <memset>
+  for(i = 0; i < kb * 1024 / BSIZE; i++)
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  f9:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  fc:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  ff:	8d 04 36             	lea    (%esi,%esi,1),%eax
+ 102:	39 d8                	cmp    %ebx,%eax
+ 104:	0f 8e 83 00 00 00    	jle    18d <main+0xf9>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+ 10a:	83 ec 04             	sub    $0x4,%esp
+ 10d:	68 00 02 00 00       	push   $0x200
+ 112:	68 c0 08 00 00       	push   $0x8c0
+ 117:	57                   	push   %edi
+ 118:	e8 2f 03 00 00       	call   44c <write>
+ 11d:	83 c4 10             	add    $0x10,%esp
+ 120:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 125:	75 4e                	jne    175 <main+0xe1>
+  for(i = 0; i < kb * 1024 / BSIZE; i++)
+ 127:	83 c3 01             	add    $0x1,%ebx
+ 12a:	eb d3                	jmp    ff <main+0x6b>
+  kb = argc > 1 ? atoi(argv[1]) : 256;
+ 12c:	83 ec 0c             	sub    $0xc,%esp
+ 12f:	ff 76 04             	push   0x4(%esi)
+ 132:	e8 91 02 00 00       	call   3c8 <atoi>
+ 137:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+ 13a:	83 c4 10             	add    $0x10,%esp
+ 13d:	83 fb 02             	cmp    $0x2,%ebx
+ 140:	7f 0a                	jg     14c <main+0xb8>
+ 142:	be 04 00 00 00       	mov    $0x4,%esi
+ 147:	e9 72 ff ff ff       	jmp    be <main+0x2a>
+ 14c:	83 ec 0c             	sub    $0xc,%esp
+ 14f:	ff 76 08             	push   0x8(%esi)
+ 152:	e8 71 02 00 00       	call   3c8 <atoi>
+ 157:	89 c6                	mov    %eax,%esi
+ 159:	83 c4 10             	add    $0x10,%esp
+ 15c:	e9 5d ff ff ff       	jmp    be <main+0x2a>
+    printf(1, "bcbench: cannot create bcbig\n");
+ 161:	83 ec 08             	sub    $0x8,%esp
+ 164:	68 44 07 00 00       	push   $0x744
+ 169:	6a 01                	push   $0x1
+ 16b:	e8 39 04 00 00       	call   5a9 <printf>
+    exit();
+ 170:	e8 b7 02 00 00       	call   42c <exit>
+      printf(1, "bcbench: file system full after %d blocks\n", i);
+ 175:	8b 75 b0             	mov    -0x50(%ebp),%esi
+ 178:	83 ec 04             	sub    $0x4,%esp
+ 17b:	53                   	push   %ebx
+ 17c:	68 64 07 00 00       	push   $0x764
+ 181:	6a 01                	push   $0x1
+ 183:	e8 21 04 00 00       	call   5a9 <printf>
+      break;
+ 188:	83 c4 10             	add    $0x10,%esp
+ 18b:	eb 03                	jmp    190 <main+0xfc>
+ 18d:	8b 75 b0             	mov    -0x50(%ebp),%esi
+    }
+  close(fd);
+ 190:	83 ec 0c             	sub    $0xc,%esp
+ 193:	57                   	push   %edi
+ 194:	e8 bb 02 00 00       	call   454 <close>
+
+  bstat(&st, 1);
+ 199:	83 c4 08             	add    $0x8,%esp
+ 19c:	6a 01                	push   $0x1
+ 19e:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 1a1:	50                   	push   %eax
+ 1a2:	e8 55 03 00 00       	call   4fc <bstat>
+  start = uptime();
+ 1a7:	e8 18 03 00 00       	call   4c4 <uptime>
+ 1ac:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  for(i = 0; i < rounds; i++){
+ 1af:	83 c4 10             	add    $0x10,%esp
+ 1b2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 1b7:	39 f7                	cmp    %esi,%edi
+ 1b9:	7d 48                	jge    203 <main+0x16f>
+    if((fd = open("bcbig", O_RDONLY)) < 0)
+ 1bb:	83 ec 08             	sub    $0x8,%esp
+ 1be:	6a 00                	push   $0x0
+ 1c0:	68 3e 07 00 00       	push   $0x73e
+ 1c5:	e8 a2 02 00 00       	call   46c <open>
+ 1ca:	89 c3                	mov    %eax,%ebx
+ 1cc:	83 c4 10             	add    $0x10,%esp
+ 1cf:	85 c0                	test   %eax,%eax
+ 1d1:	78 30                	js     203 <main+0x16f>
+      break;
+    while(read(fd, buf, sizeof(buf)) > 0)
+ 1d3:	83 ec 04             	sub    $0x4,%esp
+ 1d6:	68 00 02 00 00       	push   $0x200
+ 1db:	68 c0 08 00 00       	push   $0x8c0
+ 1e0:	53                   	push   %ebx
+ 1e1:	e8 5e 02 00 00       	call   444 <read>
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	85 c0                	test   %eax,%eax
+ 1eb:	7f e6                	jg     1d3 <main+0x13f>
+      ;
+    close(fd);
+ 1ed:	83 ec 0c             	sub    $0xc,%esp
+ 1f0:	53                   	push   %ebx
+ 1f1:	e8 5e 02 00 00       	call   454 <close>
+    statroot();
+ 1f6:	e8 1c fe ff ff       	call   17 <statroot>
+  for(i = 0; i < rounds; i++){
+ 1fb:	83 c7 01             	add    $0x1,%edi
+ 1fe:	83 c4 10             	add    $0x10,%esp
+ 201:	eb b4                	jmp    1b7 <main+0x123>
+  }
+  bstat(&st, 0);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	6a 00                	push   $0x0
+ 208:	8d 5d bc             	lea    -0x44(%ebp),%ebx
+ 20b:	53                   	push   %ebx
+ 20c:	e8 eb 02 00 00       	call   4fc <bstat>
+  unlink("bcbig");
+ 211:	c7 04 24 3e 07 00 00 	movl   $0x73e,(%esp)
+ 218:	e8 5f 02 00 00       	call   47c <unlink>
+
+  printf(1, "bcbench: %s, %d buffers, %d KB x %d rounds: %d ticks\n",
+         st.policy, st.nbuf, kb, rounds, uptime() - start);
+ 21d:	e8 a2 02 00 00       	call   4c4 <uptime>
+  printf(1, "bcbench: %s, %d buffers, %d KB x %d rounds: %d ticks\n",
+ 222:	83 c4 0c             	add    $0xc,%esp
+ 225:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 228:	29 d0                	sub    %edx,%eax
+ 22a:	50                   	push   %eax
+ 22b:	56                   	push   %esi
+ 22c:	ff 75 b4             	push   -0x4c(%ebp)
+ 22f:	ff 75 cc             	push   -0x34(%ebp)
+ 232:	53                   	push   %ebx
+ 233:	68 90 07 00 00       	push   $0x790
+ 238:	6a 01                	push   $0x1
+ 23a:	e8 6a 03 00 00       	call   5a9 <printf>
+  printf(1, "bcbench: data %d hits %d misses (%d%%), metadata %d hits %d misses (%d%%), %d evictions, %d read ahead\n",
+ 23f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 242:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 245:	83 c4 20             	add    $0x20,%esp
+ 248:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 24b:	89 c2                	mov    %eax,%edx
+ 24d:	89 d8                	mov    %ebx,%eax
+ 24f:	e8 ac fd ff ff       	call   0 <pct>
+ 254:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 257:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 25a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 25d:	89 fa                	mov    %edi,%edx
+ 25f:	89 f0                	mov    %esi,%eax
+ 261:	e8 9a fd ff ff       	call   0 <pct>
+ 266:	83 ec 08             	sub    $0x8,%esp
+ 269:	ff 75 e4             	push   -0x1c(%ebp)
+ 26c:	ff 75 e0             	push   -0x20(%ebp)
+ 26f:	ff 75 b0             	push   -0x50(%ebp)
+ 272:	ff 75 b4             	push   -0x4c(%ebp)
+ 275:	53                   	push   %ebx
+ 276:	50                   	push   %eax
+ 277:	57                   	push   %edi
+ 278:	56                   	push   %esi
+ 279:	68 c8 07 00 00       	push   $0x7c8
+ 27e:	6a 01                	push   $0x1
+ 280:	e8 24 03 00 00       	call   5a9 <printf>
+         st.hits, st.misses, pct(st.hits, st.misses),
+         st.metahits, st.metamisses, pct(st.metahits, st.metamisses),
+         st.evictions, st.prefetches);
+  exit();
+ 285:	83 c4 30             	add    $0x30,%esp
+ 288:	e8 9f 01 00 00       	call   42c <exit>
+
+0000028d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 28d:	55                   	push   %ebp
+ 28e:	89 e5                	mov    %esp,%ebp
+ 290:	56                   	push   %esi
+ 291:	53                   	push   %ebx
+ 292:	8b 75 08             	mov    0x8(%ebp),%esi
+ 295:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 298:	89 f0                	mov    %esi,%eax
+ 29a:	89 d1                	mov    %edx,%ecx
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	89 c3                	mov    %eax,%ebx
+ 2a1:	83 c0 01             	add    $0x1,%eax
+ 2a4:	0f b6 09             	movzbl (%ecx),%ecx
+ 2a7:	88 0b                	mov    %cl,(%ebx)
+ 2a9:	84 c9                	test   %cl,%cl
+ 2ab:	75 ed                	jne    29a <strcpy+0xd>
+    ;
+  return os;
+}
+ 2ad:	89 f0                	mov    %esi,%eax
+ 2af:	5b                   	pop    %ebx
+ 2b0:	5e                   	pop    %esi
+ 2b1:	5d                   	pop    %ebp
+ 2b2:	c3                   	ret
+
+000002b3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b3:	55                   	push   %ebp
+ 2b4:	89 e5                	mov    %esp,%ebp
+ 2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2bc:	eb 06                	jmp    2c4 <strcmp+0x11>
+    p++, q++;
+ 2be:	83 c1 01             	add    $0x1,%ecx
+ 2c1:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2c4:	0f b6 01             	movzbl (%ecx),%eax
+ 2c7:	84 c0                	test   %al,%al
+ 2c9:	74 04                	je     2cf <strcmp+0x1c>
+ 2cb:	3a 02                	cmp    (%edx),%al
+ 2cd:	74 ef                	je     2be <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 2cf:	0f b6 c0             	movzbl %al,%eax
+ 2d2:	0f b6 12             	movzbl (%edx),%edx
+ 2d5:	29 d0                	sub    %edx,%eax
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+
+000002d9 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+ 2dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2df:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e4:	eb 03                	jmp    2e9 <strlen+0x10>
+ 2e6:	83 c0 01             	add    $0x1,%eax
+ 2e9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2ed:	75 f7                	jne    2e6 <strlen+0xd>
+    ;
+  return n;
+}
+ 2ef:	5d                   	pop    %ebp
+ 2f0:	c3                   	ret
+
+000002f1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f1:	55                   	push   %ebp
+ 2f2:	89 e5                	mov    %esp,%ebp
+ 2f4:	57                   	push   %edi
+ 2f5:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f8:	89 d7                	mov    %edx,%edi
+ 2fa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 300:	fc                   	cld
+ 301:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 303:	89 d0                	mov    %edx,%eax
+ 305:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 308:	c9                   	leave
+ 309:	c3                   	ret
+
+0000030a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 30a:	55                   	push   %ebp
+ 30b:	89 e5                	mov    %esp,%ebp
+ 30d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 310:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 314:	eb 03                	jmp    319 <strchr+0xf>
+ 316:	83 c0 01             	add    $0x1,%eax
+ 319:	0f b6 10             	movzbl (%eax),%edx
+ 31c:	84 d2                	test   %dl,%dl
+ 31e:	74 06                	je     326 <strchr+0x1c>
+    if(*s == c)
+ 320:	38 ca                	cmp    %cl,%dl
+ 322:	75 f2                	jne    316 <strchr+0xc>
+ 324:	eb 05                	jmp    32b <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 326:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 32b:	5d                   	pop    %ebp
+ 32c:	c3                   	ret
+
+0000032d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 32d:	55                   	push   %ebp
+ 32e:	89 e5                	mov    %esp,%ebp
+ 330:	57                   	push   %edi
+ 331:	56                   	push   %esi
+ 332:	53                   	push   %ebx
+ 333:	83 ec 1c             	sub    $0x1c,%esp
+ 336:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 339:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 33e:	89 de                	mov    %ebx,%esi
+ 340:	83 c3 01             	add    $0x1,%ebx
+ 343:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 346:	7d 2e                	jge    376 <gets+0x49>
+    cc = read(0, &c, 1);
+ 348:	83 ec 04             	sub    $0x4,%esp
+ 34b:	6a 01                	push   $0x1
+ 34d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 350:	50                   	push   %eax
+ 351:	6a 00                	push   $0x0
+ 353:	e8 ec 00 00 00       	call   444 <read>
+    if(cc < 1)
+ 358:	83 c4 10             	add    $0x10,%esp
+ 35b:	85 c0                	test   %eax,%eax
+ 35d:	7e 17                	jle    376 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 35f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 363:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 366:	3c 0a                	cmp    $0xa,%al
+ 368:	0f 94 c2             	sete   %dl
+ 36b:	3c 0d                	cmp    $0xd,%al
+ 36d:	0f 94 c0             	sete   %al
+ 370:	08 c2                	or     %al,%dl
+ 372:	74 ca                	je     33e <gets+0x11>
+    buf[i++] = c;
+ 374:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 376:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 37a:	89 f8                	mov    %edi,%eax
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+
+00000384 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 384:	55                   	push   %ebp
+ 385:	89 e5                	mov    %esp,%ebp
+ 387:	56                   	push   %esi
+ 388:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	6a 00                	push   $0x0
+ 38e:	ff 75 08             	push   0x8(%ebp)
+ 391:	e8 d6 00 00 00       	call   46c <open>
+  if(fd < 0)
+ 396:	83 c4 10             	add    $0x10,%esp
+ 399:	85 c0                	test   %eax,%eax
+ 39b:	78 24                	js     3c1 <stat+0x3d>
+ 39d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 39f:	83 ec 08             	sub    $0x8,%esp
+ 3a2:	ff 75 0c             	push   0xc(%ebp)
+ 3a5:	50                   	push   %eax
+ 3a6:	e8 d9 00 00 00       	call   484 <fstat>
+ 3ab:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ad:	89 1c 24             	mov    %ebx,(%esp)
+ 3b0:	e8 9f 00 00 00       	call   454 <close>
+  return r;
+ 3b5:	83 c4 10             	add    $0x10,%esp
+}
+ 3b8:	89 f0                	mov    %esi,%eax
+ 3ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+    return -1;
+ 3c1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c6:	eb f0                	jmp    3b8 <stat+0x34>
+
+000003c8 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c8:	55                   	push   %ebp
+ 3c9:	89 e5                	mov    %esp,%ebp
+ 3cb:	53                   	push   %ebx
+ 3cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 3cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 3d4:	eb 10                	jmp    3e6 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 3d6:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 3d9:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 3dc:	83 c1 01             	add    $0x1,%ecx
+ 3df:	0f be c0             	movsbl %al,%eax
+ 3e2:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 3e6:	0f b6 01             	movzbl (%ecx),%eax
+ 3e9:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3ec:	80 fb 09             	cmp    $0x9,%bl
+ 3ef:	76 e5                	jbe    3d6 <atoi+0xe>
+  return n;
+}
+ 3f1:	89 d0                	mov    %edx,%eax
+ 3f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f6:	c9                   	leave
+ 3f7:	c3                   	ret
+
+000003f8 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f8:	55                   	push   %ebp
+ 3f9:	89 e5                	mov    %esp,%ebp
+ 3fb:	56                   	push   %esi
+ 3fc:	53                   	push   %ebx
+ 3fd:	8b 75 08             	mov    0x8(%ebp),%esi
+ 400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 403:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 406:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 408:	eb 0d                	jmp    417 <memmove+0x1f>
+    *dst++ = *src++;
+ 40a:	0f b6 01             	movzbl (%ecx),%eax
+ 40d:	88 02                	mov    %al,(%edx)
+ 40f:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 412:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 415:	89 d8                	mov    %ebx,%eax
+ 417:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 41a:	85 c0                	test   %eax,%eax
+ 41c:	7f ec                	jg     40a <memmove+0x12>
+  return vdst;
+}
+ 41e:	89 f0                	mov    %esi,%eax
+ 420:	5b                   	pop    %ebx
+ 421:	5e                   	pop    %esi
+ 422:	5d                   	pop    %ebp
+ 423:	c3                   	ret
+
+00000424 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 424:	b8 01 00 00 00       	mov    $0x1,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <exit>:
+SYSCALL(exit)
+ 42c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <wait>:
+SYSCALL(wait)
+ 434:	b8 03 00 00 00       	mov    $0x3,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <pipe>:
+SYSCALL(pipe)
+ 43c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <read>:
+SYSCALL(read)
+ 444:	b8 05 00 00 00       	mov    $0x5,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <write>:
+SYSCALL(write)
+ 44c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <close>:
+SYSCALL(close)
+ 454:	b8 15 00 00 00       	mov    $0x15,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <kill>:
+SYSCALL(kill)
+ 45c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <exec>:
+SYSCALL(exec)
+ 464:	b8 07 00 00 00       	mov    $0x7,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <open>:
+SYSCALL(open)
+ 46c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <mknod>:
+SYSCALL(mknod)
+ 474:	b8 11 00 00 00       	mov    $0x11,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <unlink>:
+SYSCALL(unlink)
+ 47c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <fstat>:
+SYSCALL(fstat)
+ 484:	b8 08 00 00 00       	mov    $0x8,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <link>:
+SYSCALL(link)
+ 48c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <mkdir>:
+SYSCALL(mkdir)
+ 494:	b8 14 00 00 00       	mov    $0x14,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <chdir>:
+SYSCALL(chdir)
+ 49c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <dup>:
+SYSCALL(dup)
+ 4a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <getpid>:
+SYSCALL(getpid)
+ 4ac:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <sbrk>:
+SYSCALL(sbrk)
+ 4b4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <sleep>:
+SYSCALL(sleep)
+ 4bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <uptime>:
+SYSCALL(uptime)
+ 4c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <yield>:
+SYSCALL(yield)
+ 4cc:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <shutdown>:
+SYSCALL(shutdown)
+ 4d4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <nicefork>:
+SYSCALL(nicefork)
+ 4dc:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <schedlog>:
+SYSCALL(schedlog)
+ 4e4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <schedstat>:
+SYSCALL(schedstat)
+ 4ec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <spawn>:
+SYSCALL(spawn)
+ 4f4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <bstat>:
+SYSCALL(bstat)
+ 4fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 504:	55                   	push   %ebp
+ 505:	89 e5                	mov    %esp,%ebp
+ 507:	83 ec 1c             	sub    $0x1c,%esp
+ 50a:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 50d:	6a 01                	push   $0x1
+ 50f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 512:	52                   	push   %edx
+ 513:	50                   	push   %eax
+ 514:	e8 33 ff ff ff       	call   44c <write>
+}
+ 519:	83 c4 10             	add    $0x10,%esp
+ 51c:	c9                   	leave
+ 51d:	c3                   	ret
+
+0000051e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 51e:	55                   	push   %ebp
+ 51f:	89 e5                	mov    %esp,%ebp
+ 521:	57                   	push   %edi
+ 522:	56                   	push   %esi
+ 523:	53                   	push   %ebx
+ 524:	83 ec 2c             	sub    $0x2c,%esp
+ 527:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 52a:	89 d0                	mov    %edx,%eax
+ 52c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 52e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 532:	0f 95 c1             	setne  %cl
+ 535:	c1 ea 1f             	shr    $0x1f,%edx
+ 538:	84 d1                	test   %dl,%cl
+ 53a:	74 44                	je     580 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 53c:	f7 d8                	neg    %eax
+ 53e:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 540:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 547:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 54c:	89 c8                	mov    %ecx,%eax
+ 54e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 553:	f7 f6                	div    %esi
+ 555:	89 df                	mov    %ebx,%edi
+ 557:	83 c3 01             	add    $0x1,%ebx
+ 55a:	0f b6 92 90 08 00 00 	movzbl 0x890(%edx),%edx
+ 561:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 565:	89 ca                	mov    %ecx,%edx
+ 567:	89 c1                	mov    %eax,%ecx
+ 569:	39 f2                	cmp    %esi,%edx
+ 56b:	73 df                	jae    54c <printint+0x2e>
+  if(neg)
+ 56d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 571:	74 31                	je     5a4 <printint+0x86>
+    buf[i++] = '-';
+ 573:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 578:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 57b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 57e:	eb 17                	jmp    597 <printint+0x79>
+    x = xx;
+ 580:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 582:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 589:	eb bc                	jmp    547 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 58b:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 590:	89 f0                	mov    %esi,%eax
+ 592:	e8 6d ff ff ff       	call   504 <putc>
+  while(--i >= 0)
+ 597:	83 eb 01             	sub    $0x1,%ebx
+ 59a:	79 ef                	jns    58b <printint+0x6d>
+}
+ 59c:	83 c4 2c             	add    $0x2c,%esp
+ 59f:	5b                   	pop    %ebx
+ 5a0:	5e                   	pop    %esi
+ 5a1:	5f                   	pop    %edi
+ 5a2:	5d                   	pop    %ebp
+ 5a3:	c3                   	ret
+ 5a4:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5a7:	eb ee                	jmp    597 <printint+0x79>
+
+000005a9 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5a9:	55                   	push   %ebp
+ 5aa:	89 e5                	mov    %esp,%ebp
+ 5ac:	57                   	push   %edi
+ 5ad:	56                   	push   %esi
+ 5ae:	53                   	push   %ebx
+ 5af:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 5b2:	8d 45 10             	lea    0x10(%ebp),%eax
+ 5b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 5b8:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 5bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5c2:	eb 14                	jmp    5d8 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5c4:	89 fa                	mov    %edi,%edx
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c9:	e8 36 ff ff ff       	call   504 <putc>
+ 5ce:	eb 05                	jmp    5d5 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 5d0:	83 fe 25             	cmp    $0x25,%esi
+ 5d3:	74 25                	je     5fa <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 5d5:	83 c3 01             	add    $0x1,%ebx
+ 5d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5db:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5df:	84 c0                	test   %al,%al
+ 5e1:	0f 84 4a 01 00 00    	je     731 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 5e7:	0f be f8             	movsbl %al,%edi
+ 5ea:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5ed:	85 f6                	test   %esi,%esi
+ 5ef:	75 df                	jne    5d0 <printf+0x27>
+      if(c == '%'){
+ 5f1:	83 f8 25             	cmp    $0x25,%eax
+ 5f4:	75 ce                	jne    5c4 <printf+0x1b>
+        state = '%';
+ 5f6:	89 c6                	mov    %eax,%esi
+ 5f8:	eb db                	jmp    5d5 <printf+0x2c>
+      if(c == 'd'){
+ 5fa:	83 f8 25             	cmp    $0x25,%eax
+ 5fd:	0f 84 f9 00 00 00    	je     6fc <printf+0x153>
+ 603:	0f 8c 07 01 00 00    	jl     710 <printf+0x167>
+ 609:	83 f8 78             	cmp    $0x78,%eax
+ 60c:	0f 8f fe 00 00 00    	jg     710 <printf+0x167>
+ 612:	83 f8 63             	cmp    $0x63,%eax
+ 615:	0f 8c f5 00 00 00    	jl     710 <printf+0x167>
+ 61b:	83 e8 63             	sub    $0x63,%eax
+ 61e:	83 f8 15             	cmp    $0x15,%eax
+ 621:	0f 87 e9 00 00 00    	ja     710 <printf+0x167>
+ 627:	ff 24 85 38 08 00 00 	jmp    *0x838(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 62e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 631:	8b 17                	mov    (%edi),%edx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	6a 01                	push   $0x1
+ 638:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 63d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 640:	e8 d9 fe ff ff       	call   51e <printint>
+        ap++;
+ 645:	83 c7 04             	add    $0x4,%edi
+ 648:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 64b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 64e:	be 00 00 00 00       	mov    $0x0,%esi
+ 653:	eb 80                	jmp    5d5 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 655:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 658:	8b 17                	mov    (%edi),%edx
+ 65a:	83 ec 0c             	sub    $0xc,%esp
+ 65d:	6a 00                	push   $0x0
+ 65f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 664:	8b 45 08             	mov    0x8(%ebp),%eax
+ 667:	e8 b2 fe ff ff       	call   51e <printint>
+        ap++;
+ 66c:	83 c7 04             	add    $0x4,%edi
+ 66f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 672:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 675:	be 00 00 00 00       	mov    $0x0,%esi
+ 67a:	e9 56 ff ff ff       	jmp    5d5 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 67f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 682:	8b 17                	mov    (%edi),%edx
+ 684:	83 ec 0c             	sub    $0xc,%esp
+ 687:	6a 00                	push   $0x0
+ 689:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 691:	e8 88 fe ff ff       	call   51e <printint>
+        ap++;
+ 696:	83 c7 04             	add    $0x4,%edi
+ 699:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a4:	e9 2c ff ff ff       	jmp    5d5 <printf+0x2c>
+        s = (char*)*ap;
+ 6a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6ac:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 6ae:	83 c0 04             	add    $0x4,%eax
+ 6b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 6b4:	85 f6                	test   %esi,%esi
+ 6b6:	75 15                	jne    6cd <printf+0x124>
+          s = "(null)";
+ 6b8:	be 30 08 00 00       	mov    $0x830,%esi
+ 6bd:	eb 0e                	jmp    6cd <printf+0x124>
+          putc(fd, *s);
+ 6bf:	0f be d2             	movsbl %dl,%edx
+ 6c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c5:	e8 3a fe ff ff       	call   504 <putc>
+          s++;
+ 6ca:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 6cd:	0f b6 16             	movzbl (%esi),%edx
+ 6d0:	84 d2                	test   %dl,%dl
+ 6d2:	75 eb                	jne    6bf <printf+0x116>
+      state = 0;
+ 6d4:	be 00 00 00 00       	mov    $0x0,%esi
+ 6d9:	e9 f7 fe ff ff       	jmp    5d5 <printf+0x2c>
+        putc(fd, *ap);
+ 6de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6e1:	0f be 17             	movsbl (%edi),%edx
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	e8 18 fe ff ff       	call   504 <putc>
+        ap++;
+ 6ec:	83 c7 04             	add    $0x4,%edi
+ 6ef:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 6f2:	be 00 00 00 00       	mov    $0x0,%esi
+ 6f7:	e9 d9 fe ff ff       	jmp    5d5 <printf+0x2c>
+        putc(fd, c);
+ 6fc:	89 fa                	mov    %edi,%edx
+ 6fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 701:	e8 fe fd ff ff       	call   504 <putc>
+      state = 0;
+ 706:	be 00 00 00 00       	mov    $0x0,%esi
+ 70b:	e9 c5 fe ff ff       	jmp    5d5 <printf+0x2c>
+        putc(fd, '%');
+ 710:	ba 25 00 00 00       	mov    $0x25,%edx
+ 715:	8b 45 08             	mov    0x8(%ebp),%eax
+ 718:	e8 e7 fd ff ff       	call   504 <putc>
+        putc(fd, c);
+ 71d:	89 fa                	mov    %edi,%edx
+ 71f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 722:	e8 dd fd ff ff       	call   504 <putc>
+      state = 0;
+ 727:	be 00 00 00 00       	mov    $0x0,%esi
+ 72c:	e9 a4 fe ff ff       	jmp    5d5 <printf+0x2c>
+    }
+  }
+}
+ 731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 734:	5b                   	pop    %ebx
+ 735:	5e                   	pop    %esi
+ 736:	5f                   	pop    %edi
+ 737:	5d                   	pop    %ebp
+ 738:	c3                   	ret
@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -13,6 +13,18 @@
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
+// Each hash bucket has its own lock, so lookups of different
+// blocks do not contend. Buffers are recycled by a clock that
+// sweeps a ring of all buffers; it needs no lock of its own.
+//
+// The clock is scan resistant in the manner of 2Q: a block read
+// for the first time enters on probation, with no credit, and is
+// the first to go when the hand comes round, so one sequential
+// read of a large file only recycles buffers it used itself. A
+// block that is read again earns a sweep of credit. Metadata read
+// with breadmeta (inodes, bitmaps, indirect and directory blocks)
+// earns METACREDIT sweeps, so it stays resident across scans.
+//
 // The implementation uses two state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
@@ -21,38 +33,162 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bstat.h"
 
-struct {
+#define NBHASH  1024  // Hash buckets; power of two
+#define NODEV   (~0u) // dev of a buf that holds no block
+#define METACREDIT  3 // Clock sweeps a metadata block survives unused
+
+#define BHASH(dev, blockno)  (((dev) * 0x9e3779b1 + (blockno)) & (NBHASH-1))
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct bucket bucket[NBHASH];
+  struct buf *hand;  // Clock hand, advanced with compare-and-swap
+  int nbuf;
+  struct bstat st;   // Counters, updated atomically
 } bcache;
 
+static struct buf*
+lookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+static void
+unhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+}
+
+static void
+hash(uint h, struct buf *b)
+{
+  b->hash = h;
+  b->hnext = bcache.bucket[h].head;
+  bcache.bucket[h].head = b;
+}
+
+// Size the cache at about 1/8 of physical memory, between NBUF
+// and MAXNBUF buffers. Must come after kinit2.
 void
 binit(void)
 {
-  struct buf *b;
+  struct buf *b, *last;
+  char *page;
+  int i, n, per;
 
-  initlock(&bcache.lock, "bcache");
+  for(i = 0; i < NBHASH; i++)
+    initlock(&bcache.bucket[i].lock, "bcache");
+
+  n = kpages() * (PGSIZE / BSIZE) / 8;
+  if(n < NBUF)
+    n = NBUF;
+  if(n > MAXNBUF)
+    n = MAXNBUF;
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  // Carve the buffers out of whole pages and link them
+  // into the clock ring. A fresh buffer sits in the bucket
+  // of (NODEV, its index), so no lookup ever finds it.
+  per = PGSIZE / sizeof(struct buf);
+  last = 0;
+  page = 0;
+  for(i = 0; i < n; i++){
+    if(i % per == 0 && (page = kalloc_zeroed()) == 0)
+      break;
+    b = (struct buf*)page + i % per;
+    b->dev = NODEV;
+    b->blockno = i;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    hash(BHASH(b->dev, b->blockno), b);
+    if(last)
+      last->next = b;
+    else
+      bcache.hand = b;
+    last = b;
   }
+  if(i < NBUF)
+    panic("binit");
+  last->next = bcache.hand;
+  bcache.nbuf = i;
+}
+
+// Advance the clock hand by one buffer and return the one it passed.
+static struct buf*
+tick(void)
+{
+  struct buf *b;
+
+  do {
+    b = bcache.hand;
+  } while(!__sync_bool_compare_and_swap(&bcache.hand, b, b->next));
+  return b;
+}
+
+// Choose a buffer to recycle: the first one under the clock
+// hand that is idle and has no credit left, taking a sweep of
+// credit from each one passed over. The checks here are unlocked
+// hints; bget rechecks them under the bucket lock.
+// An idle buffer with full credit is chosen within METACREDIT+1
+// sweeps; allow one more for credit that hits give back meanwhile.
+static struct buf*
+victim(void)
+{
+  struct buf *b;
+  int i;
+
+  for(i = 0; i < (METACREDIT+2)*bcache.nbuf; i++){
+    b = tick();
+    if(b->refcnt != 0 || (b->flags & B_DIRTY))
+      continue;
+    if(b->used > 0){
+      b->used--;
+      continue;
+    }
+    return b;
+  }
+  panic("bget: no buffers");
+}
+
+// Take the locks of buckets a and b in index order.
+static void
+lock2(uint a, uint b)
+{
+  if(a > b){
+    acquire(&bcache.bucket[b].lock);
+    acquire(&bcache.bucket[a].lock);
+    return;
+  }
+  acquire(&bcache.bucket[a].lock);
+  if(b != a)
+    acquire(&bcache.bucket[b].lock);
+}
+
+static void
+unlock2(uint a, uint b)
+{
+  release(&bcache.bucket[a].lock);
+  if(b != a)
+    release(&bcache.bucket[b].lock);
 }
 
 // Look through buffer cache for block on device dev.
@@ -61,50 +197,123 @@ binit(void)
 static struct buf*
 bget(uint dev, uint blockno)
 {
-  struct buf *b;
+  struct bucket *bk;
+  struct buf *b, *v;
+  uint h, vh;
 
-  acquire(&bcache.lock);
+  h = BHASH(dev, blockno);
+  bk = &bcache.bucket[h];
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(&bk->lock);
+  if((b = lookup(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(&bk->lock);
 
   // Not cached; recycle an unused buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
+  for(;;){
+    v = victim();
+    vh = v->hash;
+    lock2(h, vh);
+    if((b = lookup(bk, dev, blockno)) != 0){
+      // Another process cached it meanwhile.
+      b->refcnt++;
+      unlock2(h, vh);
       acquiresleep(&b->lock);
       return b;
     }
+    if(v->hash == vh && v->refcnt == 0 && (v->flags & B_DIRTY) == 0){
+      unhash(&bcache.bucket[vh], v);
+      if(v->dev != NODEV)
+        __sync_fetch_and_add(&bcache.st.evictions, 1);
+      v->dev = dev;
+      v->blockno = blockno;
+      v->flags = 0;
+      v->refcnt = 1;
+      v->used = 0;
+      v->meta = 0;
+      hash(h, v);
+      unlock2(h, vh);
+      acquiresleep(&v->lock);
+      return v;
+    }
+    unlock2(h, vh);
   }
-  panic("bget: no buffers");
 }
 
-// Return a locked buf with the contents of the indicated block.
-struct buf*
-bread(uint dev, uint blockno)
+static struct buf*
+bread1(uint dev, uint blockno, int meta)
 {
   struct buf *b;
+  int prefetched;
 
   b = bget(dev, blockno);
+  if(meta)
+    b->meta = 1;
+  // The first read of a block read ahead is no reuse: it earns
+  // no credit, so a sequential scan only recycles its own
+  // buffers, and it was already counted under prefetches.
+  prefetched = b->flags & B_PREFETCHED;
+  b->flags &= ~B_PREFETCHED;
   if((b->flags & B_VALID) == 0) {
+    __sync_fetch_and_add(meta ? &bcache.st.metamisses : &bcache.st.misses, 1);
     iderw(b);
+  } else if(!prefetched){
+    __sync_fetch_and_add(meta ? &bcache.st.metahits : &bcache.st.hits, 1);
+    b->used = b->meta ? METACREDIT : 1;
   }
+  if(meta)
+    b->used = METACREDIT;
   return b;
 }
 
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+  return bread1(dev, blockno, 0);
+}
+
+// Like bread, for blocks of file system metadata,
+// which the cache keeps in preference to file data.
+struct buf*
+breadmeta(uint dev, uint blockno)
+{
+  return bread1(dev, blockno, 1);
+}
+
+// Start reading the indicated block into the cache, without
+// waiting for it; the disk driver releases the buffer when the
+// read completes. Does nothing if the block is already cached.
+void
+bprefetch(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
+  b = lookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return;
+
+  b = bget(dev, blockno);
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  __sync_fetch_and_add(&bcache.st.prefetches, 1);
+  b->flags |= B_PREFETCHED;
+  idesubmit(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,29 +324,93 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start writing b to disk and release it; the disk driver
+// completes the write in the background.
+void
+bawrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bawrite");
+  b->flags |= B_DIRTY;
+  idesubmit(b);
+}
+
+// Write the contents of n locked buffers to disk as one batch,
+// which the disk driver can merge into fewer requests.
+void
+bwritev(struct buf **b, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&b[i]->lock))
+      panic("bwritev");
+    b[i]->flags |= B_DIRTY;
+  }
+  iderwv(b, n);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bdone(b);
+}
+
+// Release a locked buffer on behalf of whichever process
+// locked it. The disk driver calls this when a read started
+// by bprefetch completes.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b cannot move to another bucket while we hold a reference.
+  bk = &bcache.bucket[b->hash];
+  acquire(&bk->lock);
+  b->refcnt--;
+  release(&bk->lock);
+}
+
+// Take an extra reference to b, keeping it in the cache.
+void
+bpin(struct buf *b)
+{
+  struct bucket *bk = &bcache.bucket[b->hash];
+
+  acquire(&bk->lock);
+  b->refcnt++;
+  release(&bk->lock);
+}
+
+void
+bunpin(struct buf *b)
+{
+  struct bucket *bk = &bcache.bucket[b->hash];
+
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  release(&bk->lock);
+}
+
+// Copy the buffer cache statistics to st and,
+// if reset is set, clear the counters.
+int
+getbstat(struct bstat *st, int reset)
+{
+  bcache.st.nbuf = bcache.nbuf;
+  safestrcpy(bcache.st.policy, "clock-2q", sizeof(bcache.st.policy));
+  *st = bcache.st;
+  if(reset){
+    bcache.st.hits = bcache.st.misses = 0;
+    bcache.st.metahits = bcache.st.metamisses = 0;
+    bcache.st.evictions = bcache.st.prefetches = 0;
   }
-  
-  release(&bcache.lock);
+  return 0;
 }
 //PAGEBREAK!
 // Blank page.
@@ -0,0 +1,12 @@
+// Buffer cache statistics, copied out by the bstat system call.
+struct bstat {
+  char policy[16];  // Replacement policy
+  uint nbuf;        // Buffers in the cache
+  uint hits;        // bread calls that found the block cached, not counting
+                    // the first read of a block read ahead (see prefetches)
+  uint misses;      // bread calls that went to the disk
+  uint metahits;    // The same, for file system metadata only
+  uint metamisses;
+  uint evictions;   // Cached blocks dropped to make room for another
+  uint prefetches;  // Blocks read ahead of the reader
+};
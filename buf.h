@@ -4,11 +4,16 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  uint hash;         // bucket holding this buf; its lock guards refcnt, dev, blockno
+  int used;          // clock sweeps left before eviction
+  int meta;          // holds file system metadata
+  struct buf *hnext; // hash chain
+  struct buf *next;  // clock ring of all bufs
   struct buf *qnext; // disk queue
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // submitted with idesubmit; the disk driver releases the buffer
+#define B_PREFETCHED 0x10  // read ahead by bprefetch and not yet read on demand
 
@@ -0,0 +1,604 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	68 00 02 00 00       	push   $0x200
+  10:	68 c0 04 00 00       	push   $0x4c0
+  15:	56                   	push   %esi
+  16:	e8 ff 00 00 00       	call   11a <read>
+  1b:	89 c3                	mov    %eax,%ebx
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	7e 2b                	jle    4f <cat+0x4f>
+    if (write(1, buf, n) != n) {
+  24:	83 ec 04             	sub    $0x4,%esp
+  27:	53                   	push   %ebx
+  28:	68 c0 04 00 00       	push   $0x4c0
+  2d:	6a 01                	push   $0x1
+  2f:	e8 ee 00 00 00       	call   122 <write>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	39 d8                	cmp    %ebx,%eax
+  39:	74 cd                	je     8 <cat+0x8>
+      printf(1, "cat: write error\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 10 04 00 00       	push   $0x410
+  43:	6a 01                	push   $0x1
+  45:	e8 35 02 00 00       	call   27f <printf>
+      exit();
+  4a:	e8 b3 00 00 00       	call   102 <exit>
+    }
+  }
+  if(n < 0){
+  4f:	78 07                	js     58 <cat+0x58>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  54:	5b                   	pop    %ebx
+  55:	5e                   	pop    %esi
+  56:	5d                   	pop    %ebp
+  57:	c3                   	ret
+    printf(1, "cat: read error\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 22 04 00 00       	push   $0x422
+  60:	6a 01                	push   $0x1
+  62:	e8 18 02 00 00       	call   27f <printf>
+    exit();
+  67:	e8 96 00 00 00       	call   102 <exit>
+
+0000006c <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  70:	83 e4 f0             	and    $0xfffffff0,%esp
+  73:	ff 71 fc             	push   -0x4(%ecx)
+  76:	55                   	push   %ebp
+  77:	89 e5                	mov    %esp,%ebp
+  79:	57                   	push   %edi
+  7a:	56                   	push   %esi
+  7b:	53                   	push   %ebx
+  7c:	51                   	push   %ecx
+  7d:	83 ec 18             	sub    $0x18,%esp
+  80:	8b 01                	mov    (%ecx),%eax
+  82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  85:	8b 51 04             	mov    0x4(%ecx),%edx
+  88:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  8b:	83 f8 01             	cmp    $0x1,%eax
+  8e:	7e 07                	jle    97 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  90:	be 01 00 00 00       	mov    $0x1,%esi
+  95:	eb 26                	jmp    bd <main+0x51>
+    cat(0);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	6a 00                	push   $0x0
+  9c:	e8 5f ff ff ff       	call   0 <cat>
+    exit();
+  a1:	e8 5c 00 00 00       	call   102 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	50                   	push   %eax
+  aa:	e8 51 ff ff ff       	call   0 <cat>
+    close(fd);
+  af:	89 1c 24             	mov    %ebx,(%esp)
+  b2:	e8 73 00 00 00       	call   12a <close>
+  for(i = 1; i < argc; i++){
+  b7:	83 c6 01             	add    $0x1,%esi
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c0:	39 c6                	cmp    %eax,%esi
+  c2:	7d 31                	jge    f5 <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+  c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  c7:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+  ca:	83 ec 08             	sub    $0x8,%esp
+  cd:	6a 00                	push   $0x0
+  cf:	ff 37                	push   (%edi)
+  d1:	e8 6c 00 00 00       	call   142 <open>
+  d6:	89 c3                	mov    %eax,%ebx
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	85 c0                	test   %eax,%eax
+  dd:	79 c7                	jns    a6 <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  df:	83 ec 04             	sub    $0x4,%esp
+  e2:	ff 37                	push   (%edi)
+  e4:	68 33 04 00 00       	push   $0x433
+  e9:	6a 01                	push   $0x1
+  eb:	e8 8f 01 00 00       	call   27f <printf>
+      exit();
+  f0:	e8 0d 00 00 00       	call   102 <exit>
+  }
+  exit();
+  f5:	e8 08 00 00 00       	call   102 <exit>
+
+000000fa <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  ff:	cd 40                	int    $0x40
+ 101:	c3                   	ret
+
+00000102 <exit>:
+SYSCALL(exit)
+ 102:	b8 02 00 00 00       	mov    $0x2,%eax
+ 107:	cd 40                	int    $0x40
+ 109:	c3                   	ret
+
+0000010a <wait>:
+SYSCALL(wait)
+ 10a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 10f:	cd 40                	int    $0x40
+ 111:	c3                   	ret
+
+00000112 <pipe>:
+SYSCALL(pipe)
+ 112:	b8 04 00 00 00       	mov    $0x4,%eax
+ 117:	cd 40                	int    $0x40
+ 119:	c3                   	ret
+
+0000011a <read>:
+SYSCALL(read)
+ 11a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 11f:	cd 40                	int    $0x40
+ 121:	c3                   	ret
+
+00000122 <write>:
+SYSCALL(write)
+ 122:	b8 10 00 00 00       	mov    $0x10,%eax
+ 127:	cd 40                	int    $0x40
+ 129:	c3                   	ret
+
+0000012a <close>:
+SYSCALL(close)
+ 12a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 12f:	cd 40                	int    $0x40
+ 131:	c3                   	ret
+
+00000132 <kill>:
+SYSCALL(kill)
+ 132:	b8 06 00 00 00       	mov    $0x6,%eax
+ 137:	cd 40                	int    $0x40
+ 139:	c3                   	ret
+
+0000013a <exec>:
+SYSCALL(exec)
+ 13a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 13f:	cd 40                	int    $0x40
+ 141:	c3                   	ret
+
+00000142 <open>:
+SYSCALL(open)
+ 142:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 147:	cd 40                	int    $0x40
+ 149:	c3                   	ret
+
+0000014a <mknod>:
+SYSCALL(mknod)
+ 14a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 14f:	cd 40                	int    $0x40
+ 151:	c3                   	ret
+
+00000152 <unlink>:
+SYSCALL(unlink)
+ 152:	b8 12 00 00 00       	mov    $0x12,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+
+0000015a <fstat>:
+SYSCALL(fstat)
+ 15a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 15f:	cd 40                	int    $0x40
+ 161:	c3                   	ret
+
+00000162 <link>:
+SYSCALL(link)
+ 162:	b8 13 00 00 00       	mov    $0x13,%eax
+ 167:	cd 40                	int    $0x40
+ 169:	c3                   	ret
+
+0000016a <mkdir>:
+SYSCALL(mkdir)
+ 16a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 16f:	cd 40                	int    $0x40
+ 171:	c3                   	ret
+
+00000172 <chdir>:
+SYSCALL(chdir)
+ 172:	b8 09 00 00 00       	mov    $0x9,%eax
+ 177:	cd 40                	int    $0x40
+ 179:	c3                   	ret
+
+0000017a <dup>:
+SYSCALL(dup)
+ 17a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 17f:	cd 40                	int    $0x40
+ 181:	c3                   	ret
+
+00000182 <getpid>:
+SYSCALL(getpid)
+ 182:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 187:	cd 40                	int    $0x40
+ 189:	c3                   	ret
+
+0000018a <sbrk>:
+SYSCALL(sbrk)
+ 18a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 18f:	cd 40                	int    $0x40
+ 191:	c3                   	ret
+
+00000192 <sleep>:
+SYSCALL(sleep)
+ 192:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 197:	cd 40                	int    $0x40
+ 199:	c3                   	ret
+
+0000019a <uptime>:
+SYSCALL(uptime)
+ 19a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 19f:	cd 40                	int    $0x40
+ 1a1:	c3                   	ret
+
+000001a2 <yield>:
+SYSCALL(yield)
+ 1a2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1a7:	cd 40                	int    $0x40
+ 1a9:	c3                   	ret
+
+000001aa <shutdown>:
+SYSCALL(shutdown)
+ 1aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1af:	cd 40                	int    $0x40
+ 1b1:	c3                   	ret
+
+000001b2 <nicefork>:
+SYSCALL(nicefork)
+ 1b2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 1b7:	cd 40                	int    $0x40
+ 1b9:	c3                   	ret
+
+000001ba <schedlog>:
+SYSCALL(schedlog)
+ 1ba:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1bf:	cd 40                	int    $0x40
+ 1c1:	c3                   	ret
+
+000001c2 <schedstat>:
+SYSCALL(schedstat)
+ 1c2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1c7:	cd 40                	int    $0x40
+ 1c9:	c3                   	ret
+
+000001ca <spawn>:
+SYSCALL(spawn)
+ 1ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1cf:	cd 40                	int    $0x40
+ 1d1:	c3                   	ret
+
+000001d2 <bstat>:
+SYSCALL(bstat)
+ 1d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1d7:	cd 40                	int    $0x40
+ 1d9:	c3                   	ret
+
+000001da <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1da:	55                   	push   %ebp
+ 1db:	89 e5                	mov    %esp,%ebp
+ 1dd:	83 ec 1c             	sub    $0x1c,%esp
+ 1e0:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1e3:	6a 01                	push   $0x1
+ 1e5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 1e8:	52                   	push   %edx
+ 1e9:	50                   	push   %eax
+ 1ea:	e8 33 ff ff ff       	call   122 <write>
+}
+ 1ef:	83 c4 10             	add    $0x10,%esp
+ 1f2:	c9                   	leave
+ 1f3:	c3                   	ret
+
+000001f4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1f4:	55                   	push   %ebp
+ 1f5:	89 e5                	mov    %esp,%ebp
+ 1f7:	57                   	push   %edi
+ 1f8:	56                   	push   %esi
+ 1f9:	53                   	push   %ebx
+ 1fa:	83 ec 2c             	sub    $0x2c,%esp
+ 1fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 200:	89 d0                	mov    %edx,%eax
+ 202:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 204:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 208:	0f 95 c1             	setne  %cl
+ 20b:	c1 ea 1f             	shr    $0x1f,%edx
+ 20e:	84 d1                	test   %dl,%cl
+ 210:	74 44                	je     256 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 212:	f7 d8                	neg    %eax
+ 214:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 216:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 21d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 222:	89 c8                	mov    %ecx,%eax
+ 224:	ba 00 00 00 00       	mov    $0x0,%edx
+ 229:	f7 f6                	div    %esi
+ 22b:	89 df                	mov    %ebx,%edi
+ 22d:	83 c3 01             	add    $0x1,%ebx
+ 230:	0f b6 92 a8 04 00 00 	movzbl 0x4a8(%edx),%edx
+ 237:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 23b:	89 ca                	mov    %ecx,%edx
+ 23d:	89 c1                	mov    %eax,%ecx
+ 23f:	39 f2                	cmp    %esi,%edx
+ 241:	73 df                	jae    222 <printint+0x2e>
+  if(neg)
+ 243:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 247:	74 31                	je     27a <printint+0x86>
+    buf[i++] = '-';
+ 249:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 24e:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 251:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 254:	eb 17                	jmp    26d <printint+0x79>
+    x = xx;
+ 256:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 258:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 25f:	eb bc                	jmp    21d <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 261:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 266:	89 f0                	mov    %esi,%eax
+ 268:	e8 6d ff ff ff       	call   1da <putc>
+  while(--i >= 0)
+ 26d:	83 eb 01             	sub    $0x1,%ebx
+ 270:	79 ef                	jns    261 <printint+0x6d>
+}
+ 272:	83 c4 2c             	add    $0x2c,%esp
+ 275:	5b                   	pop    %ebx
+ 276:	5e                   	pop    %esi
+ 277:	5f                   	pop    %edi
+ 278:	5d                   	pop    %ebp
+ 279:	c3                   	ret
+ 27a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 27d:	eb ee                	jmp    26d <printint+0x79>
+
+0000027f <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 27f:	55                   	push   %ebp
+ 280:	89 e5                	mov    %esp,%ebp
+ 282:	57                   	push   %edi
+ 283:	56                   	push   %esi
+ 284:	53                   	push   %ebx
+ 285:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 288:	8d 45 10             	lea    0x10(%ebp),%eax
+ 28b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 28e:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 293:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 298:	eb 14                	jmp    2ae <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 29a:	89 fa                	mov    %edi,%edx
+ 29c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29f:	e8 36 ff ff ff       	call   1da <putc>
+ 2a4:	eb 05                	jmp    2ab <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 2a6:	83 fe 25             	cmp    $0x25,%esi
+ 2a9:	74 25                	je     2d0 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 2ab:	83 c3 01             	add    $0x1,%ebx
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 2b5:	84 c0                	test   %al,%al
+ 2b7:	0f 84 4a 01 00 00    	je     407 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 2bd:	0f be f8             	movsbl %al,%edi
+ 2c0:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 2c3:	85 f6                	test   %esi,%esi
+ 2c5:	75 df                	jne    2a6 <printf+0x27>
+      if(c == '%'){
+ 2c7:	83 f8 25             	cmp    $0x25,%eax
+ 2ca:	75 ce                	jne    29a <printf+0x1b>
+        state = '%';
+ 2cc:	89 c6                	mov    %eax,%esi
+ 2ce:	eb db                	jmp    2ab <printf+0x2c>
+      if(c == 'd'){
+ 2d0:	83 f8 25             	cmp    $0x25,%eax
+ 2d3:	0f 84 f9 00 00 00    	je     3d2 <printf+0x153>
+ 2d9:	0f 8c 07 01 00 00    	jl     3e6 <printf+0x167>
+ 2df:	83 f8 78             	cmp    $0x78,%eax
+ 2e2:	0f 8f fe 00 00 00    	jg     3e6 <printf+0x167>
+ 2e8:	83 f8 63             	cmp    $0x63,%eax
+ 2eb:	0f 8c f5 00 00 00    	jl     3e6 <printf+0x167>
+ 2f1:	83 e8 63             	sub    $0x63,%eax
+ 2f4:	83 f8 15             	cmp    $0x15,%eax
+ 2f7:	0f 87 e9 00 00 00    	ja     3e6 <printf+0x167>
+ 2fd:	ff 24 85 50 04 00 00 	jmp    *0x450(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 307:	8b 17                	mov    (%edi),%edx
+ 309:	83 ec 0c             	sub    $0xc,%esp
+ 30c:	6a 01                	push   $0x1
+ 30e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	e8 d9 fe ff ff       	call   1f4 <printint>
+        ap++;
+ 31b:	83 c7 04             	add    $0x4,%edi
+ 31e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 321:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 324:	be 00 00 00 00       	mov    $0x0,%esi
+ 329:	eb 80                	jmp    2ab <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 32b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 32e:	8b 17                	mov    (%edi),%edx
+ 330:	83 ec 0c             	sub    $0xc,%esp
+ 333:	6a 00                	push   $0x0
+ 335:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 33a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33d:	e8 b2 fe ff ff       	call   1f4 <printint>
+        ap++;
+ 342:	83 c7 04             	add    $0x4,%edi
+ 345:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 348:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 34b:	be 00 00 00 00       	mov    $0x0,%esi
+ 350:	e9 56 ff ff ff       	jmp    2ab <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 355:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 358:	8b 17                	mov    (%edi),%edx
+ 35a:	83 ec 0c             	sub    $0xc,%esp
+ 35d:	6a 00                	push   $0x0
+ 35f:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	e8 88 fe ff ff       	call   1f4 <printint>
+        ap++;
+ 36c:	83 c7 04             	add    $0x4,%edi
+ 36f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 372:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 375:	be 00 00 00 00       	mov    $0x0,%esi
+ 37a:	e9 2c ff ff ff       	jmp    2ab <printf+0x2c>
+        s = (char*)*ap;
+ 37f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 382:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 384:	83 c0 04             	add    $0x4,%eax
+ 387:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 38a:	85 f6                	test   %esi,%esi
+ 38c:	75 15                	jne    3a3 <printf+0x124>
+          s = "(null)";
+ 38e:	be 48 04 00 00       	mov    $0x448,%esi
+ 393:	eb 0e                	jmp    3a3 <printf+0x124>
+          putc(fd, *s);
+ 395:	0f be d2             	movsbl %dl,%edx
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39b:	e8 3a fe ff ff       	call   1da <putc>
+          s++;
+ 3a0:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 3a3:	0f b6 16             	movzbl (%esi),%edx
+ 3a6:	84 d2                	test   %dl,%dl
+ 3a8:	75 eb                	jne    395 <printf+0x116>
+      state = 0;
+ 3aa:	be 00 00 00 00       	mov    $0x0,%esi
+ 3af:	e9 f7 fe ff ff       	jmp    2ab <printf+0x2c>
+        putc(fd, *ap);
+ 3b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3b7:	0f be 17             	movsbl (%edi),%edx
+ 3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bd:	e8 18 fe ff ff       	call   1da <putc>
+        ap++;
+ 3c2:	83 c7 04             	add    $0x4,%edi
+ 3c5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 3c8:	be 00 00 00 00       	mov    $0x0,%esi
+ 3cd:	e9 d9 fe ff ff       	jmp    2ab <printf+0x2c>
+        putc(fd, c);
+ 3d2:	89 fa                	mov    %edi,%edx
+ 3d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d7:	e8 fe fd ff ff       	call   1da <putc>
+      state = 0;
+ 3dc:	be 00 00 00 00       	mov    $0x0,%esi
+ 3e1:	e9 c5 fe ff ff       	jmp    2ab <printf+0x2c>
+        putc(fd, '%');
+ 3e6:	ba 25 00 00 00       	mov    $0x25,%edx
+ 3eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ee:	e8 e7 fd ff ff       	call   1da <putc>
+        putc(fd, c);
+ 3f3:	89 fa                	mov    %edi,%edx
+ 3f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f8:	e8 dd fd ff ff       	call   1da <putc>
+      state = 0;
+ 3fd:	be 00 00 00 00       	mov    $0x0,%esi
+ 402:	e9 a4 fe ff ff       	jmp    2ab <printf+0x2c>
+    }
+  }
+}
+ 407:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40a:	5b                   	pop    %ebx
+ 40b:	5e                   	pop    %esi
+ 40c:	5f                   	pop    %edi
+ 40d:	5d                   	pop    %ebp
+ 40e:	c3                   	ret
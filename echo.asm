@@ -0,0 +1,511 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	b8 01 00 00 00       	mov    $0x1,%eax
+  1e:	eb 1a                	jmp    3a <main+0x3a>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  20:	ba 6a 03 00 00       	mov    $0x36a,%edx
+  25:	52                   	push   %edx
+  26:	ff 34 87             	push   (%edi,%eax,4)
+  29:	68 6c 03 00 00       	push   $0x36c
+  2e:	6a 01                	push   $0x1
+  30:	e8 a1 01 00 00       	call   1d6 <printf>
+  35:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	39 f0                	cmp    %esi,%eax
+  3c:	7d 0e                	jge    4c <main+0x4c>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  3e:	8d 58 01             	lea    0x1(%eax),%ebx
+  41:	39 f3                	cmp    %esi,%ebx
+  43:	7d db                	jge    20 <main+0x20>
+  45:	ba 68 03 00 00       	mov    $0x368,%edx
+  4a:	eb d9                	jmp    25 <main+0x25>
+  exit();
+  4c:	e8 08 00 00 00       	call   59 <exit>
+
+00000051 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  51:	b8 01 00 00 00       	mov    $0x1,%eax
+  56:	cd 40                	int    $0x40
+  58:	c3                   	ret
+
+00000059 <exit>:
+SYSCALL(exit)
+  59:	b8 02 00 00 00       	mov    $0x2,%eax
+  5e:	cd 40                	int    $0x40
+  60:	c3                   	ret
+
+00000061 <wait>:
+SYSCALL(wait)
+  61:	b8 03 00 00 00       	mov    $0x3,%eax
+  66:	cd 40                	int    $0x40
+  68:	c3                   	ret
+
+00000069 <pipe>:
+SYSCALL(pipe)
+  69:	b8 04 00 00 00       	mov    $0x4,%eax
+  6e:	cd 40                	int    $0x40
+  70:	c3                   	ret
+
+00000071 <read>:
+SYSCALL(read)
+  71:	b8 05 00 00 00       	mov    $0x5,%eax
+  76:	cd 40                	int    $0x40
+  78:	c3                   	ret
+
+00000079 <write>:
+SYSCALL(write)
+  79:	b8 10 00 00 00       	mov    $0x10,%eax
+  7e:	cd 40                	int    $0x40
+  80:	c3                   	ret
+
+00000081 <close>:
+SYSCALL(close)
+  81:	b8 15 00 00 00       	mov    $0x15,%eax
+  86:	cd 40                	int    $0x40
+  88:	c3                   	ret
+
+00000089 <kill>:
+SYSCALL(kill)
+  89:	b8 06 00 00 00       	mov    $0x6,%eax
+  8e:	cd 40                	int    $0x40
+  90:	c3                   	ret
+
+00000091 <exec>:
+SYSCALL(exec)
+  91:	b8 07 00 00 00       	mov    $0x7,%eax
+  96:	cd 40                	int    $0x40
+  98:	c3                   	ret
+
+00000099 <open>:
+SYSCALL(open)
+  99:	b8 0f 00 00 00       	mov    $0xf,%eax
+  9e:	cd 40                	int    $0x40
+  a0:	c3                   	ret
+
+000000a1 <mknod>:
+SYSCALL(mknod)
+  a1:	b8 11 00 00 00       	mov    $0x11,%eax
+  a6:	cd 40                	int    $0x40
+  a8:	c3                   	ret
+
+000000a9 <unlink>:
+SYSCALL(unlink)
+  a9:	b8 12 00 00 00       	mov    $0x12,%eax
+  ae:	cd 40                	int    $0x40
+  b0:	c3                   	ret
+
+000000b1 <fstat>:
+SYSCALL(fstat)
+  b1:	b8 08 00 00 00       	mov    $0x8,%eax
+  b6:	cd 40                	int    $0x40
+  b8:	c3                   	ret
+
+000000b9 <link>:
+SYSCALL(link)
+  b9:	b8 13 00 00 00       	mov    $0x13,%eax
+  be:	cd 40                	int    $0x40
+  c0:	c3                   	ret
+
+000000c1 <mkdir>:
+SYSCALL(mkdir)
+  c1:	b8 14 00 00 00       	mov    $0x14,%eax
+  c6:	cd 40                	int    $0x40
+  c8:	c3                   	ret
+
+000000c9 <chdir>:
+SYSCALL(chdir)
+  c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  ce:	cd 40                	int    $0x40
+  d0:	c3                   	ret
+
+000000d1 <dup>:
+SYSCALL(dup)
+  d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  d6:	cd 40                	int    $0x40
+  d8:	c3                   	ret
+
+000000d9 <getpid>:
+SYSCALL(getpid)
+  d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  de:	cd 40                	int    $0x40
+  e0:	c3                   	ret
+
+000000e1 <sbrk>:
+SYSCALL(sbrk)
+  e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  e6:	cd 40                	int    $0x40
+  e8:	c3                   	ret
+
+000000e9 <sleep>:
+SYSCALL(sleep)
+  e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  ee:	cd 40                	int    $0x40
+  f0:	c3                   	ret
+
+000000f1 <uptime>:
+SYSCALL(uptime)
+  f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  f6:	cd 40                	int    $0x40
+  f8:	c3                   	ret
+
+000000f9 <yield>:
+SYSCALL(yield)
+  f9:	b8 16 00 00 00       	mov    $0x16,%eax
+  fe:	cd 40                	int    $0x40
+ 100:	c3                   	ret
+
+00000101 <shutdown>:
+SYSCALL(shutdown)
+ 101:	b8 17 00 00 00       	mov    $0x17,%eax
+ 106:	cd 40                	int    $0x40
+ 108:	c3                   	ret
+
+00000109 <nicefork>:
+SYSCALL(nicefork)
+ 109:	b8 18 00 00 00       	mov    $0x18,%eax
+ 10e:	cd 40                	int    $0x40
+ 110:	c3                   	ret
+
+00000111 <schedlog>:
+SYSCALL(schedlog)
+ 111:	b8 19 00 00 00       	mov    $0x19,%eax
+ 116:	cd 40                	int    $0x40
+ 118:	c3                   	ret
+
+00000119 <schedstat>:
+SYSCALL(schedstat)
+ 119:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 11e:	cd 40                	int    $0x40
+ 120:	c3                   	ret
+
+00000121 <spawn>:
+SYSCALL(spawn)
+ 121:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 126:	cd 40                	int    $0x40
+ 128:	c3                   	ret
+
+00000129 <bstat>:
+SYSCALL(bstat)
+ 129:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 12e:	cd 40                	int    $0x40
+ 130:	c3                   	ret
+
+00000131 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 131:	55                   	push   %ebp
+ 132:	89 e5                	mov    %esp,%ebp
+ 134:	83 ec 1c             	sub    $0x1c,%esp
+ 137:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 13a:	6a 01                	push   $0x1
+ 13c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 13f:	52                   	push   %edx
+ 140:	50                   	push   %eax
+ 141:	e8 33 ff ff ff       	call   79 <write>
+}
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	c9                   	leave
+ 14a:	c3                   	ret
+
+0000014b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 14b:	55                   	push   %ebp
+ 14c:	89 e5                	mov    %esp,%ebp
+ 14e:	57                   	push   %edi
+ 14f:	56                   	push   %esi
+ 150:	53                   	push   %ebx
+ 151:	83 ec 2c             	sub    $0x2c,%esp
+ 154:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 157:	89 d0                	mov    %edx,%eax
+ 159:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 15b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 15f:	0f 95 c1             	setne  %cl
+ 162:	c1 ea 1f             	shr    $0x1f,%edx
+ 165:	84 d1                	test   %dl,%cl
+ 167:	74 44                	je     1ad <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 169:	f7 d8                	neg    %eax
+ 16b:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 16d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 179:	89 c8                	mov    %ecx,%eax
+ 17b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 180:	f7 f6                	div    %esi
+ 182:	89 df                	mov    %ebx,%edi
+ 184:	83 c3 01             	add    $0x1,%ebx
+ 187:	0f b6 92 d0 03 00 00 	movzbl 0x3d0(%edx),%edx
+ 18e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 192:	89 ca                	mov    %ecx,%edx
+ 194:	89 c1                	mov    %eax,%ecx
+ 196:	39 f2                	cmp    %esi,%edx
+ 198:	73 df                	jae    179 <printint+0x2e>
+  if(neg)
+ 19a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 19e:	74 31                	je     1d1 <printint+0x86>
+    buf[i++] = '-';
+ 1a0:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1a5:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 1a8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1ab:	eb 17                	jmp    1c4 <printint+0x79>
+    x = xx;
+ 1ad:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 1af:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 1b6:	eb bc                	jmp    174 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1b8:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 1bd:	89 f0                	mov    %esi,%eax
+ 1bf:	e8 6d ff ff ff       	call   131 <putc>
+  while(--i >= 0)
+ 1c4:	83 eb 01             	sub    $0x1,%ebx
+ 1c7:	79 ef                	jns    1b8 <printint+0x6d>
+}
+ 1c9:	83 c4 2c             	add    $0x2c,%esp
+ 1cc:	5b                   	pop    %ebx
+ 1cd:	5e                   	pop    %esi
+ 1ce:	5f                   	pop    %edi
+ 1cf:	5d                   	pop    %ebp
+ 1d0:	c3                   	ret
+ 1d1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1d4:	eb ee                	jmp    1c4 <printint+0x79>
+
+000001d6 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 1d6:	55                   	push   %ebp
+ 1d7:	89 e5                	mov    %esp,%ebp
+ 1d9:	57                   	push   %edi
+ 1da:	56                   	push   %esi
+ 1db:	53                   	push   %ebx
+ 1dc:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 1df:	8d 45 10             	lea    0x10(%ebp),%eax
+ 1e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 1e5:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 1ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ef:	eb 14                	jmp    205 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 1f1:	89 fa                	mov    %edi,%edx
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	e8 36 ff ff ff       	call   131 <putc>
+ 1fb:	eb 05                	jmp    202 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 1fd:	83 fe 25             	cmp    $0x25,%esi
+ 200:	74 25                	je     227 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 202:	83 c3 01             	add    $0x1,%ebx
+ 205:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 208:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 20c:	84 c0                	test   %al,%al
+ 20e:	0f 84 4a 01 00 00    	je     35e <printf+0x188>
+    c = fmt[i] & 0xff;
+ 214:	0f be f8             	movsbl %al,%edi
+ 217:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 21a:	85 f6                	test   %esi,%esi
+ 21c:	75 df                	jne    1fd <printf+0x27>
+      if(c == '%'){
+ 21e:	83 f8 25             	cmp    $0x25,%eax
+ 221:	75 ce                	jne    1f1 <printf+0x1b>
+        state = '%';
+ 223:	89 c6                	mov    %eax,%esi
+ 225:	eb db                	jmp    202 <printf+0x2c>
+      if(c == 'd'){
+ 227:	83 f8 25             	cmp    $0x25,%eax
+ 22a:	0f 84 f9 00 00 00    	je     329 <printf+0x153>
+ 230:	0f 8c 07 01 00 00    	jl     33d <printf+0x167>
+ 236:	83 f8 78             	cmp    $0x78,%eax
+ 239:	0f 8f fe 00 00 00    	jg     33d <printf+0x167>
+ 23f:	83 f8 63             	cmp    $0x63,%eax
+ 242:	0f 8c f5 00 00 00    	jl     33d <printf+0x167>
+ 248:	83 e8 63             	sub    $0x63,%eax
+ 24b:	83 f8 15             	cmp    $0x15,%eax
+ 24e:	0f 87 e9 00 00 00    	ja     33d <printf+0x167>
+ 254:	ff 24 85 78 03 00 00 	jmp    *0x378(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 25b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 25e:	8b 17                	mov    (%edi),%edx
+ 260:	83 ec 0c             	sub    $0xc,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	e8 d9 fe ff ff       	call   14b <printint>
+        ap++;
+ 272:	83 c7 04             	add    $0x4,%edi
+ 275:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 278:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 27b:	be 00 00 00 00       	mov    $0x0,%esi
+ 280:	eb 80                	jmp    202 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 282:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 285:	8b 17                	mov    (%edi),%edx
+ 287:	83 ec 0c             	sub    $0xc,%esp
+ 28a:	6a 00                	push   $0x0
+ 28c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	e8 b2 fe ff ff       	call   14b <printint>
+        ap++;
+ 299:	83 c7 04             	add    $0x4,%edi
+ 29c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 29f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2a2:	be 00 00 00 00       	mov    $0x0,%esi
+ 2a7:	e9 56 ff ff ff       	jmp    202 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2af:	8b 17                	mov    (%edi),%edx
+ 2b1:	83 ec 0c             	sub    $0xc,%esp
+ 2b4:	6a 00                	push   $0x0
+ 2b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2be:	e8 88 fe ff ff       	call   14b <printint>
+        ap++;
+ 2c3:	83 c7 04             	add    $0x4,%edi
+ 2c6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2c9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2cc:	be 00 00 00 00       	mov    $0x0,%esi
+ 2d1:	e9 2c ff ff ff       	jmp    202 <printf+0x2c>
+        s = (char*)*ap;
+ 2d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2d9:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2db:	83 c0 04             	add    $0x4,%eax
+ 2de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 2e1:	85 f6                	test   %esi,%esi
+ 2e3:	75 15                	jne    2fa <printf+0x124>
+          s = "(null)";
+ 2e5:	be 71 03 00 00       	mov    $0x371,%esi
+ 2ea:	eb 0e                	jmp    2fa <printf+0x124>
+          putc(fd, *s);
+ 2ec:	0f be d2             	movsbl %dl,%edx
+ 2ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f2:	e8 3a fe ff ff       	call   131 <putc>
+          s++;
+ 2f7:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 2fa:	0f b6 16             	movzbl (%esi),%edx
+ 2fd:	84 d2                	test   %dl,%dl
+ 2ff:	75 eb                	jne    2ec <printf+0x116>
+      state = 0;
+ 301:	be 00 00 00 00       	mov    $0x0,%esi
+ 306:	e9 f7 fe ff ff       	jmp    202 <printf+0x2c>
+        putc(fd, *ap);
+ 30b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 30e:	0f be 17             	movsbl (%edi),%edx
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+ 314:	e8 18 fe ff ff       	call   131 <putc>
+        ap++;
+ 319:	83 c7 04             	add    $0x4,%edi
+ 31c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 31f:	be 00 00 00 00       	mov    $0x0,%esi
+ 324:	e9 d9 fe ff ff       	jmp    202 <printf+0x2c>
+        putc(fd, c);
+ 329:	89 fa                	mov    %edi,%edx
+ 32b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32e:	e8 fe fd ff ff       	call   131 <putc>
+      state = 0;
+ 333:	be 00 00 00 00       	mov    $0x0,%esi
+ 338:	e9 c5 fe ff ff       	jmp    202 <printf+0x2c>
+        putc(fd, '%');
+ 33d:	ba 25 00 00 00       	mov    $0x25,%edx
+ 342:	8b 45 08             	mov    0x8(%ebp),%eax
+ 345:	e8 e7 fd ff ff       	call   131 <putc>
+        putc(fd, c);
+ 34a:	89 fa                	mov    %edi,%edx
+ 34c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34f:	e8 dd fd ff ff       	call   131 <putc>
+      state = 0;
+ 354:	be 00 00 00 00       	mov    $0x0,%esi
+ 359:	e9 a4 fe ff ff       	jmp    202 <printf+0x2c>
+    }
+  }
+}
+ 35e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 361:	5b                   	pop    %ebx
+ 362:	5e                   	pop    %esi
+ 363:	5f                   	pop    %edi
+ 364:	5d                   	pop    %ebp
+ 365:	c3                   	ret
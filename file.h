@@ -14,6 +14,10 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int nexec;          // Processes running this program (see iexec)
+  struct inode *hnext;  // Next in icache hash chain
+  struct inode *lrunext;  // On icache.lru while ref == 0
+  struct inode *lruprev;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +26,14 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
+
+  uint ranext;        // block readi expects next if reading sequentially
+  uint raend;         // first block not yet read ahead
+  uint rawin;         // read-ahead window in blocks; 0 if not sequential
+  uint l1idx;         // index in the double-indirect block of ...
+  uint l1addr;        // ... the indirect block bmap used last; 0 if none
+  int pcached;        // pages may be in the executable page cache
 };
 
 // table mapping major device number to
@@ -0,0 +1,947 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <average>:
+#include "schedstat.h"
+
+// sum / n without 64-bit division, which user programs lack.
+static uint
+average(uint64 sum, uint n)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	89 cb                	mov    %ecx,%ebx
+  while(sum >> 32){
+   6:	eb 08                	jmp    10 <average+0x10>
+    sum >>= 1;
+   8:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+   c:	d1 ea                	shr    %edx
+    n >>= 1;
+   e:	d1 eb                	shr    %ebx
+  while(sum >> 32){
+  10:	89 d1                	mov    %edx,%ecx
+  12:	83 c9 00             	or     $0x0,%ecx
+  15:	75 f1                	jne    8 <average+0x8>
+  }
+  return n ? (uint)sum / n : 0;
+  17:	85 db                	test   %ebx,%ebx
+  19:	74 0a                	je     25 <average+0x25>
+  1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  20:	f7 f3                	div    %ebx
+}
+  22:	5b                   	pop    %ebx
+  23:	5d                   	pop    %ebp
+  24:	c3                   	ret
+  return n ? (uint)sum / n : 0;
+  25:	89 d8                	mov    %ebx,%eax
+  27:	eb f9                	jmp    22 <average+0x22>
+
+00000029 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  29:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  2d:	83 e4 f0             	and    $0xfffffff0,%esp
+  30:	ff 71 fc             	push   -0x4(%ecx)
+  33:	55                   	push   %ebp
+  34:	89 e5                	mov    %esp,%ebp
+  36:	57                   	push   %edi
+  37:	56                   	push   %esi
+  38:	53                   	push   %ebx
+  39:	51                   	push   %ecx
+  3a:	81 ec a8 01 00 00    	sub    $0x1a8,%esp
+  40:	8b 19                	mov    (%ecx),%ebx
+  42:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct schedstat st;
+  int batch, rounds, i, j, n, start;
+
+  batch = argc > 1 ? atoi(argv[1]) : 50;
+  45:	83 fb 01             	cmp    $0x1,%ebx
+  48:	7f 3a                	jg     84 <main+0x5b>
+  4a:	bf 32 00 00 00       	mov    $0x32,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : 100;
+  4f:	c7 85 50 fe ff ff 64 	movl   $0x64,-0x1b0(%ebp)
+  56:	00 00 00 
+
+  schedstat(&st, 1);
+  59:	83 ec 08             	sub    $0x8,%esp
+  5c:	6a 01                	push   $0x1
+  5e:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+  64:	50                   	push   %eax
+  65:	e8 47 03 00 00       	call   3b1 <schedstat>
+  start = uptime();
+  6a:	e8 1a 03 00 00       	call   389 <uptime>
+  6f:	89 85 4c fe ff ff    	mov    %eax,-0x1b4(%ebp)
+  for(i = 0; i < rounds; i++){
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	c7 85 54 fe ff ff 00 	movl   $0x0,-0x1ac(%ebp)
+  7f:	00 00 00 
+  82:	eb 56                	jmp    da <main+0xb1>
+  batch = argc > 1 ? atoi(argv[1]) : 50;
+  84:	83 ec 0c             	sub    $0xc,%esp
+  87:	ff 76 04             	push   0x4(%esi)
+  8a:	e8 fe 01 00 00       	call   28d <atoi>
+  8f:	89 c7                	mov    %eax,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : 100;
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	83 fb 02             	cmp    $0x2,%ebx
+  97:	7f 0c                	jg     a5 <main+0x7c>
+  99:	c7 85 50 fe ff ff 64 	movl   $0x64,-0x1b0(%ebp)
+  a0:	00 00 00 
+  a3:	eb b4                	jmp    59 <main+0x30>
+  a5:	83 ec 0c             	sub    $0xc,%esp
+  a8:	ff 76 08             	push   0x8(%esi)
+  ab:	e8 dd 01 00 00       	call   28d <atoi>
+  b0:	89 85 50 fe ff ff    	mov    %eax,-0x1b0(%ebp)
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	eb 9e                	jmp    59 <main+0x30>
+    for(n = 0; n < batch; n++){
+      int pid = fork();
+      if(pid < 0)
+        break;
+      if(pid == 0)
+        exit();
+  bb:	e8 31 02 00 00       	call   2f1 <exit>
+    for(n = 0; n < batch; n++){
+  c0:	be 00 00 00 00       	mov    $0x0,%esi
+  c5:	eb 08                	jmp    cf <main+0xa6>
+    }
+    for(j = 0; j < n; j++)
+      wait();
+  c7:	e8 2d 02 00 00       	call   2f9 <wait>
+    for(j = 0; j < n; j++)
+  cc:	83 c6 01             	add    $0x1,%esi
+  cf:	39 de                	cmp    %ebx,%esi
+  d1:	7c f4                	jl     c7 <main+0x9e>
+  for(i = 0; i < rounds; i++){
+  d3:	83 85 54 fe ff ff 01 	addl   $0x1,-0x1ac(%ebp)
+  da:	8b 95 50 fe ff ff    	mov    -0x1b0(%ebp),%edx
+  e0:	39 95 54 fe ff ff    	cmp    %edx,-0x1ac(%ebp)
+  e6:	7d 19                	jge    101 <main+0xd8>
+    for(n = 0; n < batch; n++){
+  e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  ed:	39 fb                	cmp    %edi,%ebx
+  ef:	7d cf                	jge    c0 <main+0x97>
+      int pid = fork();
+  f1:	e8 f3 01 00 00       	call   2e9 <fork>
+      if(pid < 0)
+  f6:	85 c0                	test   %eax,%eax
+  f8:	78 c6                	js     c0 <main+0x97>
+      if(pid == 0)
+  fa:	74 bf                	je     bb <main+0x92>
+    for(n = 0; n < batch; n++){
+  fc:	83 c3 01             	add    $0x1,%ebx
+  ff:	eb ec                	jmp    ed <main+0xc4>
+  }
+  schedstat(&st, 0);
+ 101:	83 ec 08             	sub    $0x8,%esp
+ 104:	6a 00                	push   $0x0
+ 106:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+ 10c:	50                   	push   %eax
+ 10d:	e8 9f 02 00 00       	call   3b1 <schedstat>
+
+  printf(1, "forkbench: %d rounds x %d children: %d ticks, %u ptable.lock acquires, %u cycles held/acquire\n",
+ 112:	8b 75 d8             	mov    -0x28(%ebp),%esi
+ 115:	89 f1                	mov    %esi,%ecx
+ 117:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 11a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 11d:	e8 de fe ff ff       	call   0 <average>
+ 122:	89 c3                	mov    %eax,%ebx
+         rounds, batch, uptime() - start, st.ptacquire,
+ 124:	e8 60 02 00 00       	call   389 <uptime>
+  printf(1, "forkbench: %d rounds x %d children: %d ticks, %u ptable.lock acquires, %u cycles held/acquire\n",
+ 129:	83 c4 0c             	add    $0xc,%esp
+ 12c:	53                   	push   %ebx
+ 12d:	56                   	push   %esi
+ 12e:	8b 95 4c fe ff ff    	mov    -0x1b4(%ebp),%edx
+ 134:	29 d0                	sub    %edx,%eax
+ 136:	50                   	push   %eax
+ 137:	57                   	push   %edi
+ 138:	ff b5 50 fe ff ff    	push   -0x1b0(%ebp)
+ 13e:	68 00 06 00 00       	push   $0x600
+ 143:	6a 01                	push   $0x1
+ 145:	e8 24 03 00 00       	call   46e <printf>
+         average(st.ptholdcycles, st.ptacquire));
+  exit();
+ 14a:	83 c4 20             	add    $0x20,%esp
+ 14d:	e8 9f 01 00 00       	call   2f1 <exit>
+
+00000152 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	56                   	push   %esi
+ 156:	53                   	push   %ebx
+ 157:	8b 75 08             	mov    0x8(%ebp),%esi
+ 15a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 15d:	89 f0                	mov    %esi,%eax
+ 15f:	89 d1                	mov    %edx,%ecx
+ 161:	83 c2 01             	add    $0x1,%edx
+ 164:	89 c3                	mov    %eax,%ebx
+ 166:	83 c0 01             	add    $0x1,%eax
+ 169:	0f b6 09             	movzbl (%ecx),%ecx
+ 16c:	88 0b                	mov    %cl,(%ebx)
+ 16e:	84 c9                	test   %cl,%cl
+ 170:	75 ed                	jne    15f <strcpy+0xd>
+    ;
+  return os;
+}
+ 172:	89 f0                	mov    %esi,%eax
+ 174:	5b                   	pop    %ebx
+ 175:	5e                   	pop    %esi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 17e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 181:	eb 06                	jmp    189 <strcmp+0x11>
+    p++, q++;
+ 183:	83 c1 01             	add    $0x1,%ecx
+ 186:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 189:	0f b6 01             	movzbl (%ecx),%eax
+ 18c:	84 c0                	test   %al,%al
+ 18e:	74 04                	je     194 <strcmp+0x1c>
+ 190:	3a 02                	cmp    (%edx),%al
+ 192:	74 ef                	je     183 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	29 d0                	sub    %edx,%eax
+}
+ 19c:	5d                   	pop    %ebp
+ 19d:	c3                   	ret
+
+0000019e <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 19e:	55                   	push   %ebp
+ 19f:	89 e5                	mov    %esp,%ebp
+ 1a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1a9:	eb 03                	jmp    1ae <strlen+0x10>
+ 1ab:	83 c0 01             	add    $0x1,%eax
+ 1ae:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b2:	75 f7                	jne    1ab <strlen+0xd>
+    ;
+  return n;
+}
+ 1b4:	5d                   	pop    %ebp
+ 1b5:	c3                   	ret
+
+000001b6 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b6:	55                   	push   %ebp
+ 1b7:	89 e5                	mov    %esp,%ebp
+ 1b9:	57                   	push   %edi
+ 1ba:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c5:	fc                   	cld
+ 1c6:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c8:	89 d0                	mov    %edx,%eax
+ 1ca:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1cd:	c9                   	leave
+ 1ce:	c3                   	ret
+
+000001cf <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1d9:	eb 03                	jmp    1de <strchr+0xf>
+ 1db:	83 c0 01             	add    $0x1,%eax
+ 1de:	0f b6 10             	movzbl (%eax),%edx
+ 1e1:	84 d2                	test   %dl,%dl
+ 1e3:	74 06                	je     1eb <strchr+0x1c>
+    if(*s == c)
+ 1e5:	38 ca                	cmp    %cl,%dl
+ 1e7:	75 f2                	jne    1db <strchr+0xc>
+ 1e9:	eb 05                	jmp    1f0 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+
+000001f2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f2:	55                   	push   %ebp
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	57                   	push   %edi
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 203:	89 de                	mov    %ebx,%esi
+ 205:	83 c3 01             	add    $0x1,%ebx
+ 208:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 20b:	7d 2e                	jge    23b <gets+0x49>
+    cc = read(0, &c, 1);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 01                	push   $0x1
+ 212:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 215:	50                   	push   %eax
+ 216:	6a 00                	push   $0x0
+ 218:	e8 ec 00 00 00       	call   309 <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 17                	jle    23b <gets+0x49>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 22b:	3c 0a                	cmp    $0xa,%al
+ 22d:	0f 94 c2             	sete   %dl
+ 230:	3c 0d                	cmp    $0xd,%al
+ 232:	0f 94 c0             	sete   %al
+ 235:	08 c2                	or     %al,%dl
+ 237:	74 ca                	je     203 <gets+0x11>
+    buf[i++] = c;
+ 239:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 23b:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 23f:	89 f8                	mov    %edi,%eax
+ 241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 244:	5b                   	pop    %ebx
+ 245:	5e                   	pop    %esi
+ 246:	5f                   	pop    %edi
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+
+00000249 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 249:	55                   	push   %ebp
+ 24a:	89 e5                	mov    %esp,%ebp
+ 24c:	56                   	push   %esi
+ 24d:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	6a 00                	push   $0x0
+ 253:	ff 75 08             	push   0x8(%ebp)
+ 256:	e8 d6 00 00 00       	call   331 <open>
+  if(fd < 0)
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	78 24                	js     286 <stat+0x3d>
+ 262:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 264:	83 ec 08             	sub    $0x8,%esp
+ 267:	ff 75 0c             	push   0xc(%ebp)
+ 26a:	50                   	push   %eax
+ 26b:	e8 d9 00 00 00       	call   349 <fstat>
+ 270:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 272:	89 1c 24             	mov    %ebx,(%esp)
+ 275:	e8 9f 00 00 00       	call   319 <close>
+  return r;
+ 27a:	83 c4 10             	add    $0x10,%esp
+}
+ 27d:	89 f0                	mov    %esi,%eax
+ 27f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 282:	5b                   	pop    %ebx
+ 283:	5e                   	pop    %esi
+ 284:	5d                   	pop    %ebp
+ 285:	c3                   	ret
+    return -1;
+ 286:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 28b:	eb f0                	jmp    27d <stat+0x34>
+
+0000028d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 28d:	55                   	push   %ebp
+ 28e:	89 e5                	mov    %esp,%ebp
+ 290:	53                   	push   %ebx
+ 291:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 294:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 299:	eb 10                	jmp    2ab <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 29b:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 29e:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 2a1:	83 c1 01             	add    $0x1,%ecx
+ 2a4:	0f be c0             	movsbl %al,%eax
+ 2a7:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 2ab:	0f b6 01             	movzbl (%ecx),%eax
+ 2ae:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2b1:	80 fb 09             	cmp    $0x9,%bl
+ 2b4:	76 e5                	jbe    29b <atoi+0xe>
+  return n;
+}
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2bb:	c9                   	leave
+ 2bc:	c3                   	ret
+
+000002bd <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2bd:	55                   	push   %ebp
+ 2be:	89 e5                	mov    %esp,%ebp
+ 2c0:	56                   	push   %esi
+ 2c1:	53                   	push   %ebx
+ 2c2:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2cb:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2cd:	eb 0d                	jmp    2dc <memmove+0x1f>
+    *dst++ = *src++;
+ 2cf:	0f b6 01             	movzbl (%ecx),%eax
+ 2d2:	88 02                	mov    %al,(%edx)
+ 2d4:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2d7:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2da:	89 d8                	mov    %ebx,%eax
+ 2dc:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2df:	85 c0                	test   %eax,%eax
+ 2e1:	7f ec                	jg     2cf <memmove+0x12>
+  return vdst;
+}
+ 2e3:	89 f0                	mov    %esi,%eax
+ 2e5:	5b                   	pop    %ebx
+ 2e6:	5e                   	pop    %esi
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+
+000002e9 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2e9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <exit>:
+SYSCALL(exit)
+ 2f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <wait>:
+SYSCALL(wait)
+ 2f9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <pipe>:
+SYSCALL(pipe)
+ 301:	b8 04 00 00 00       	mov    $0x4,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <read>:
+SYSCALL(read)
+ 309:	b8 05 00 00 00       	mov    $0x5,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <write>:
+SYSCALL(write)
+ 311:	b8 10 00 00 00       	mov    $0x10,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <close>:
+SYSCALL(close)
+ 319:	b8 15 00 00 00       	mov    $0x15,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <kill>:
+SYSCALL(kill)
+ 321:	b8 06 00 00 00       	mov    $0x6,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <exec>:
+SYSCALL(exec)
+ 329:	b8 07 00 00 00       	mov    $0x7,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <open>:
+SYSCALL(open)
+ 331:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <mknod>:
+SYSCALL(mknod)
+ 339:	b8 11 00 00 00       	mov    $0x11,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <unlink>:
+SYSCALL(unlink)
+ 341:	b8 12 00 00 00       	mov    $0x12,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <fstat>:
+SYSCALL(fstat)
+ 349:	b8 08 00 00 00       	mov    $0x8,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <link>:
+SYSCALL(link)
+ 351:	b8 13 00 00 00       	mov    $0x13,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <mkdir>:
+SYSCALL(mkdir)
+ 359:	b8 14 00 00 00       	mov    $0x14,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <chdir>:
+SYSCALL(chdir)
+ 361:	b8 09 00 00 00       	mov    $0x9,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <dup>:
+SYSCALL(dup)
+ 369:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <getpid>:
+SYSCALL(getpid)
+ 371:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <sbrk>:
+SYSCALL(sbrk)
+ 379:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <sleep>:
+SYSCALL(sleep)
+ 381:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <uptime>:
+SYSCALL(uptime)
+ 389:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <yield>:
+SYSCALL(yield)
+ 391:	b8 16 00 00 00       	mov    $0x16,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <shutdown>:
+SYSCALL(shutdown)
+ 399:	b8 17 00 00 00       	mov    $0x17,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <nicefork>:
+SYSCALL(nicefork)
+ 3a1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <schedlog>:
+SYSCALL(schedlog)
+ 3a9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <schedstat>:
+SYSCALL(schedstat)
+ 3b1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <spawn>:
+SYSCALL(spawn)
+ 3b9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <bstat>:
+SYSCALL(bstat)
+ 3c1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3c9:	55                   	push   %ebp
+ 3ca:	89 e5                	mov    %esp,%ebp
+ 3cc:	83 ec 1c             	sub    $0x1c,%esp
+ 3cf:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3d2:	6a 01                	push   $0x1
+ 3d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3d7:	52                   	push   %edx
+ 3d8:	50                   	push   %eax
+ 3d9:	e8 33 ff ff ff       	call   311 <write>
+}
+ 3de:	83 c4 10             	add    $0x10,%esp
+ 3e1:	c9                   	leave
+ 3e2:	c3                   	ret
+
+000003e3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e3:	55                   	push   %ebp
+ 3e4:	89 e5                	mov    %esp,%ebp
+ 3e6:	57                   	push   %edi
+ 3e7:	56                   	push   %esi
+ 3e8:	53                   	push   %ebx
+ 3e9:	83 ec 2c             	sub    $0x2c,%esp
+ 3ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3ef:	89 d0                	mov    %edx,%eax
+ 3f1:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3f3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3f7:	0f 95 c1             	setne  %cl
+ 3fa:	c1 ea 1f             	shr    $0x1f,%edx
+ 3fd:	84 d1                	test   %dl,%cl
+ 3ff:	74 44                	je     445 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 401:	f7 d8                	neg    %eax
+ 403:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 405:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 40c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	ba 00 00 00 00       	mov    $0x0,%edx
+ 418:	f7 f6                	div    %esi
+ 41a:	89 df                	mov    %ebx,%edi
+ 41c:	83 c3 01             	add    $0x1,%ebx
+ 41f:	0f b6 92 c0 06 00 00 	movzbl 0x6c0(%edx),%edx
+ 426:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 42a:	89 ca                	mov    %ecx,%edx
+ 42c:	89 c1                	mov    %eax,%ecx
+ 42e:	39 f2                	cmp    %esi,%edx
+ 430:	73 df                	jae    411 <printint+0x2e>
+  if(neg)
+ 432:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 436:	74 31                	je     469 <printint+0x86>
+    buf[i++] = '-';
+ 438:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 43d:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 440:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 443:	eb 17                	jmp    45c <printint+0x79>
+    x = xx;
+ 445:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 447:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 44e:	eb bc                	jmp    40c <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 450:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 455:	89 f0                	mov    %esi,%eax
+ 457:	e8 6d ff ff ff       	call   3c9 <putc>
+  while(--i >= 0)
+ 45c:	83 eb 01             	sub    $0x1,%ebx
+ 45f:	79 ef                	jns    450 <printint+0x6d>
+}
+ 461:	83 c4 2c             	add    $0x2c,%esp
+ 464:	5b                   	pop    %ebx
+ 465:	5e                   	pop    %esi
+ 466:	5f                   	pop    %edi
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 46c:	eb ee                	jmp    45c <printint+0x79>
+
+0000046e <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 46e:	55                   	push   %ebp
+ 46f:	89 e5                	mov    %esp,%ebp
+ 471:	57                   	push   %edi
+ 472:	56                   	push   %esi
+ 473:	53                   	push   %ebx
+ 474:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 477:	8d 45 10             	lea    0x10(%ebp),%eax
+ 47a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 47d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 482:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 487:	eb 14                	jmp    49d <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 489:	89 fa                	mov    %edi,%edx
+ 48b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48e:	e8 36 ff ff ff       	call   3c9 <putc>
+ 493:	eb 05                	jmp    49a <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 495:	83 fe 25             	cmp    $0x25,%esi
+ 498:	74 25                	je     4bf <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 49a:	83 c3 01             	add    $0x1,%ebx
+ 49d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a0:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4a4:	84 c0                	test   %al,%al
+ 4a6:	0f 84 4a 01 00 00    	je     5f6 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 4ac:	0f be f8             	movsbl %al,%edi
+ 4af:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4b2:	85 f6                	test   %esi,%esi
+ 4b4:	75 df                	jne    495 <printf+0x27>
+      if(c == '%'){
+ 4b6:	83 f8 25             	cmp    $0x25,%eax
+ 4b9:	75 ce                	jne    489 <printf+0x1b>
+        state = '%';
+ 4bb:	89 c6                	mov    %eax,%esi
+ 4bd:	eb db                	jmp    49a <printf+0x2c>
+      if(c == 'd'){
+ 4bf:	83 f8 25             	cmp    $0x25,%eax
+ 4c2:	0f 84 f9 00 00 00    	je     5c1 <printf+0x153>
+ 4c8:	0f 8c 07 01 00 00    	jl     5d5 <printf+0x167>
+ 4ce:	83 f8 78             	cmp    $0x78,%eax
+ 4d1:	0f 8f fe 00 00 00    	jg     5d5 <printf+0x167>
+ 4d7:	83 f8 63             	cmp    $0x63,%eax
+ 4da:	0f 8c f5 00 00 00    	jl     5d5 <printf+0x167>
+ 4e0:	83 e8 63             	sub    $0x63,%eax
+ 4e3:	83 f8 15             	cmp    $0x15,%eax
+ 4e6:	0f 87 e9 00 00 00    	ja     5d5 <printf+0x167>
+ 4ec:	ff 24 85 68 06 00 00 	jmp    *0x668(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4f6:	8b 17                	mov    (%edi),%edx
+ 4f8:	83 ec 0c             	sub    $0xc,%esp
+ 4fb:	6a 01                	push   $0x1
+ 4fd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 502:	8b 45 08             	mov    0x8(%ebp),%eax
+ 505:	e8 d9 fe ff ff       	call   3e3 <printint>
+        ap++;
+ 50a:	83 c7 04             	add    $0x4,%edi
+ 50d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 510:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 513:	be 00 00 00 00       	mov    $0x0,%esi
+ 518:	eb 80                	jmp    49a <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 51a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 51d:	8b 17                	mov    (%edi),%edx
+ 51f:	83 ec 0c             	sub    $0xc,%esp
+ 522:	6a 00                	push   $0x0
+ 524:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 529:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52c:	e8 b2 fe ff ff       	call   3e3 <printint>
+        ap++;
+ 531:	83 c7 04             	add    $0x4,%edi
+ 534:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 537:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53a:	be 00 00 00 00       	mov    $0x0,%esi
+ 53f:	e9 56 ff ff ff       	jmp    49a <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 544:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 547:	8b 17                	mov    (%edi),%edx
+ 549:	83 ec 0c             	sub    $0xc,%esp
+ 54c:	6a 00                	push   $0x0
+ 54e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	e8 88 fe ff ff       	call   3e3 <printint>
+        ap++;
+ 55b:	83 c7 04             	add    $0x4,%edi
+ 55e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 561:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 564:	be 00 00 00 00       	mov    $0x0,%esi
+ 569:	e9 2c ff ff ff       	jmp    49a <printf+0x2c>
+        s = (char*)*ap;
+ 56e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 571:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 573:	83 c0 04             	add    $0x4,%eax
+ 576:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 579:	85 f6                	test   %esi,%esi
+ 57b:	75 15                	jne    592 <printf+0x124>
+          s = "(null)";
+ 57d:	be 5f 06 00 00       	mov    $0x65f,%esi
+ 582:	eb 0e                	jmp    592 <printf+0x124>
+          putc(fd, *s);
+ 584:	0f be d2             	movsbl %dl,%edx
+ 587:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58a:	e8 3a fe ff ff       	call   3c9 <putc>
+          s++;
+ 58f:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 592:	0f b6 16             	movzbl (%esi),%edx
+ 595:	84 d2                	test   %dl,%dl
+ 597:	75 eb                	jne    584 <printf+0x116>
+      state = 0;
+ 599:	be 00 00 00 00       	mov    $0x0,%esi
+ 59e:	e9 f7 fe ff ff       	jmp    49a <printf+0x2c>
+        putc(fd, *ap);
+ 5a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5a6:	0f be 17             	movsbl (%edi),%edx
+ 5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ac:	e8 18 fe ff ff       	call   3c9 <putc>
+        ap++;
+ 5b1:	83 c7 04             	add    $0x4,%edi
+ 5b4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5b7:	be 00 00 00 00       	mov    $0x0,%esi
+ 5bc:	e9 d9 fe ff ff       	jmp    49a <printf+0x2c>
+        putc(fd, c);
+ 5c1:	89 fa                	mov    %edi,%edx
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	e8 fe fd ff ff       	call   3c9 <putc>
+      state = 0;
+ 5cb:	be 00 00 00 00       	mov    $0x0,%esi
+ 5d0:	e9 c5 fe ff ff       	jmp    49a <printf+0x2c>
+        putc(fd, '%');
+ 5d5:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5dd:	e8 e7 fd ff ff       	call   3c9 <putc>
+        putc(fd, c);
+ 5e2:	89 fa                	mov    %edi,%edx
+ 5e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e7:	e8 dd fd ff ff       	call   3c9 <putc>
+      state = 0;
+ 5ec:	be 00 00 00 00       	mov    $0x0,%esi
+ 5f1:	e9 a4 fe ff ff       	jmp    49a <printf+0x2c>
+    }
+  }
+}
+ 5f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5f9:	5b                   	pop    %ebx
+ 5fa:	5e                   	pop    %esi
+ 5fb:	5f                   	pop    %edi
+ 5fc:	5d                   	pop    %ebp
+ 5fd:	c3                   	ret
@@ -0,0 +1,51 @@
+// Fork/exit churn benchmark. Repeatedly forks batch children that
+// exit at once and reaps them, then reports how often ptable.lock
+// was taken and how long it was held on average, which is where
+// fork, exit and wait contend with the scheduler.
+//
+// Usage: forkbench [batch] [rounds]
+
+#include "types.h"
+#include "user.h"
+#include "schedstat.h"
+
+// sum / n without 64-bit division, which user programs lack.
+static uint
+average(uint64 sum, uint n)
+{
+  while(sum >> 32){
+    sum >>= 1;
+    n >>= 1;
+  }
+  return n ? (uint)sum / n : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedstat st;
+  int batch, rounds, i, j, n, start;
+
+  batch = argc > 1 ? atoi(argv[1]) : 50;
+  rounds = argc > 2 ? atoi(argv[2]) : 100;
+
+  schedstat(&st, 1);
+  start = uptime();
+  for(i = 0; i < rounds; i++){
+    for(n = 0; n < batch; n++){
+      int pid = fork();
+      if(pid < 0)
+        break;
+      if(pid == 0)
+        exit();
+    }
+    for(j = 0; j < n; j++)
+      wait();
+  }
+  schedstat(&st, 0);
+
+  printf(1, "forkbench: %d rounds x %d children: %d ticks, %u ptable.lock acquires, %u cycles held/acquire\n",
+         rounds, batch, uptime() - start, st.ptacquire,
+         average(st.ptholdcycles, st.ptacquire));
+  exit();
+}
@@ -20,6 +20,7 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "slab.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
@@ -33,7 +34,7 @@ readsb(int dev, struct superblock *sb)
 {
   struct buf *bp;
 
-  bp = bread(dev, 1);
+  bp = breadmeta(dev, 1);
   memmove(sb, bp->data, sizeof(*sb));
   brelse(bp);
 }
@@ -61,7 +62,7 @@ balloc(uint dev)
 
   bp = 0;
   for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
+    bp = breadmeta(dev, BBLOCK(b, sb));
     for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
@@ -84,7 +85,7 @@ bfree(int dev, uint b)
   struct buf *bp;
   int bi, m;
 
-  bp = bread(dev, BBLOCK(b, sb));
+  bp = breadmeta(dev, BBLOCK(b, sb));
   bi = b % BPB;
   m = 1 << (bi % 8);
   if((bp->data[bi/8] & m) == 0)
@@ -119,18 +120,19 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to a cache entry (open files and
+//   current directories). iget() finds or creates a cache
+//   entry and increments its ref; iput() decrements ref.
+//   Up to NINODE entries whose ref has reached zero stay
+//   cached, least recently used first out, so that files
+//   opened again keep their contents and read-ahead state.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid when it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,29 +157,73 @@ bfree(int dev, uint b)
 // multi-step atomic operations.
 //
 // The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// entries and the hash table that finds them by (dev, inum).
+// Since ip->ref indicates whether an entry is in use, and ip->dev
+// and ip->inum indicate which i-node an entry holds, one must
+// hold icache.lock while using any of those fields.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 64  // Buckets in icache.hash; power of two
+#define IHASH(dev, inum)  (((dev) * 31 + (inum)) & (NIHASH-1))
+
+// Entries come from a slab cache, so there is no fixed
+// limit on the number of active inodes.
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
-} icache;
+  struct inode *hash[NIHASH];  // Chained through ip->hnext
+  struct inode *lru;           // Valid entries with ref 0, newest first
+  struct inode *lrutail;
+  int nlru;
+} icache = { .lock = { .name = "icache" } };
+
+static struct slabcache inodecache = SLABCACHE("inode", sizeof(struct inode));
+
+static void
+lruunlink(struct inode *ip)
+{
+  if(ip->lruprev)
+    ip->lruprev->lrunext = ip->lrunext;
+  else
+    icache.lru = ip->lrunext;
+  if(ip->lrunext)
+    ip->lrunext->lruprev = ip->lruprev;
+  else
+    icache.lrutail = ip->lruprev;
+  ip->lrunext = ip->lruprev = 0;
+  icache.nlru--;
+}
+
+static void
+unhash(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+    ;
+  *pp = ip->hnext;
+}
+
+// Drop the least recently used unreferenced entry from the
+// cache and return its memory, or 0 if there is none.
+// Caller must hold icache.lock.
+static struct inode*
+ievict(void)
+{
+  struct inode *ip;
+
+  if((ip = icache.lrutail) == 0)
+    return 0;
+  lruunlink(ip);
+  unhash(ip);
+  return ip;
+}
 
 void
 iinit(int dev)
 {
-  int i = 0;
-  
-  initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
-
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
@@ -199,7 +245,7 @@ ialloc(uint dev, short type)
   struct dinode *dip;
 
   for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
+    bp = breadmeta(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
@@ -223,7 +269,7 @@ iupdate(struct inode *ip)
   struct buf *bp;
   struct dinode *dip;
 
-  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+  bp = breadmeta(ip->dev, IBLOCK(ip->inum, sb));
   dip = (struct dinode*)bp->data + ip->inum%IPB;
   dip->type = ip->type;
   dip->major = ip->major;
@@ -241,31 +287,32 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **head;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  head = &icache.hash[IHASH(dev, inum)];
+  for(ip = *head; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lruunlink(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Allocate an inode cache entry.
+  if((ip = slaballoc(&inodecache)) == 0 && (ip = ievict()) == 0)
     panic("iget: no inodes");
-
-  ip = empty;
+  memset(ip, 0, sizeof(*ip));
+  initsleeplock(&ip->lock, "inode");
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->hnext = *head;
+  *head = ip;
   release(&icache.lock);
 
   return ip;
@@ -282,6 +329,16 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Count n more (or fewer) processes running the program in ip.
+// writei refuses to change it while any do: their pages are
+// faulted in from the file lazily, and would mix old and new
+// contents.
+void
+iexec(struct inode *ip, int n)
+{
+  __sync_fetch_and_add(&ip->nexec, n);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -296,7 +353,7 @@ ilock(struct inode *ip)
   acquiresleep(&ip->lock);
 
   if(ip->valid == 0){
-    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+    bp = breadmeta(ip->dev, IBLOCK(ip->inum, sb));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     ip->type = dip->type;
     ip->major = dip->major;
@@ -305,6 +362,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->l1addr = 0;
+    ip->pcached = pcmaybe(ip);
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -347,7 +406,23 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    if(ip->valid){
+      // Keep it cached for the next iget.
+      ip->lruprev = 0;
+      ip->lrunext = icache.lru;
+      if(icache.lru)
+        icache.lru->lruprev = ip;
+      else
+        icache.lrutail = ip;
+      icache.lru = ip;
+      if(++icache.nlru > NINODE)
+        slabfree(&inodecache, ievict());
+    } else {
+      unhash(ip);
+      slabfree(&inodecache, ip);
+    }
+  }
   release(&icache.lock);
 }
 
@@ -365,15 +440,34 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. The last NDINDIRECT
+// blocks are listed in the indirect blocks listed in the
+// double-indirect block ip->addrs[NDIRECT+1].
+
+// Return the address of entry i of indirect block addr,
+// allocating a block for it if necessary.
+static uint
+indirect(struct inode *ip, uint addr, uint i)
+{
+  uint *a;
+  struct buf *bp;
+
+  bp = breadmeta(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[i]) == 0){
+    a[i] = addr = balloc(ip->dev);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
-  struct buf *bp;
+  uint addr;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
@@ -386,14 +480,21 @@ bmap(struct inode *ip, uint bn)
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
       ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+    return indirect(ip, addr, bn);
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    // Sequential access stays within one indirect block for
+    // NINDIRECT blocks, so remember which one to skip reading
+    // the double-indirect block.
+    if(ip->l1addr == 0 || ip->l1idx != bn / NINDIRECT){
+      if((addr = ip->addrs[NDIRECT+1]) == 0)
+        ip->addrs[NDIRECT+1] = addr = balloc(ip->dev);
+      ip->l1addr = indirect(ip, addr, bn / NINDIRECT);
+      ip->l1idx = bn / NINDIRECT;
     }
-    brelse(bp);
-    return addr;
+    return indirect(ip, ip->l1addr, bn % NINDIRECT);
   }
 
   panic("bmap: out of range");
@@ -408,9 +509,11 @@ static void
 itrunc(struct inode *ip)
 {
   int i, j;
-  struct buf *bp;
-  uint *a;
+  struct buf *bp, *bp2;
+  uint *a, *a2;
 
+  if(ip->pcached)
+    pcinval(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -419,7 +522,7 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+    bp = breadmeta(ip->dev, ip->addrs[NDIRECT]);
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
@@ -430,6 +533,27 @@ itrunc(struct inode *ip)
     ip->addrs[NDIRECT] = 0;
   }
 
+  if(ip->addrs[NDIRECT+1]){
+    bp = breadmeta(ip->dev, ip->addrs[NDIRECT+1]);
+    a = (uint*)bp->data;
+    for(i = 0; i < NINDIRECT; i++){
+      if(a[i] == 0)
+        continue;
+      bp2 = breadmeta(ip->dev, a[i]);
+      a2 = (uint*)bp2->data;
+      for(j = 0; j < NINDIRECT; j++){
+        if(a2[j])
+          bfree(ip->dev, a2[j]);
+      }
+      brelse(bp2);
+      bfree(ip->dev, a[i]);
+    }
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+  ip->l1addr = 0;
+
   ip->size = 0;
   iupdate(ip);
 }
@@ -446,6 +570,54 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Read-ahead window limits, in blocks.
+#define RAMIN   4
+#define RAMAX  32
+
+// Called by readi before it reads block bn of ip. While ip is
+// read sequentially, keep up to rawin blocks beyond bn in flight,
+// doubling the window each time the reader catches up with half
+// of it. Any other access pattern turns read-ahead off.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint b, end, nb;
+
+  if(bn + 1 == ip->ranext)
+    return;  // Another read within the same block
+  if(bn != ip->ranext){
+    ip->ranext = bn + 1;
+    ip->raend = 0;
+    ip->rawin = 0;
+    return;
+  }
+  ip->ranext = bn + 1;
+  if(ip->raend > bn + ip->rawin / 2)
+    return;
+
+  ip->rawin = ip->rawin ? ip->rawin * 2 : RAMIN;
+  if(ip->rawin > RAMAX)
+    ip->rawin = RAMAX;
+  nb = (ip->size + BSIZE - 1) / BSIZE;
+  end = bn + 1 + ip->rawin;
+  if(end > nb)
+    end = nb;
+  b = ip->raend > bn + 1 ? ip->raend : bn + 1;
+  for(; b < end; b++)
+    bprefetch(ip->dev, bmap(ip, b));
+  ip->raend = end;
+}
+
+// Read the block holding byte bn*BSIZE of ip.
+// Directory blocks are metadata to the buffer cache.
+static struct buf*
+breadi(struct inode *ip, uint bn)
+{
+  if(ip->type == T_DIR)
+    return breadmeta(ip->dev, bmap(ip, bn));
+  return bread(ip->dev, bmap(ip, bn));
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -467,7 +639,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    readahead(ip, off/BSIZE);
+    bp = breadi(ip, off/BSIZE);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
@@ -494,9 +667,13 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->nexec > 0)
+    return -1;
+  if(ip->pcached)
+    pcinval(ip);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bp = breadi(ip, off/BSIZE);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
@@ -0,0 +1,487 @@
+
+_hellotest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+    printf(0, "hello world\n");
+  11:	68 3c 03 00 00       	push   $0x33c
+  16:	6a 00                	push   $0x0
+  18:	e8 8f 01 00 00       	call   1ac <printf>
+    fork();
+  1d:	e8 05 00 00 00       	call   27 <fork>
+    exit();
+  22:	e8 08 00 00 00       	call   2f <exit>
+
+00000027 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  27:	b8 01 00 00 00       	mov    $0x1,%eax
+  2c:	cd 40                	int    $0x40
+  2e:	c3                   	ret
+
+0000002f <exit>:
+SYSCALL(exit)
+  2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  34:	cd 40                	int    $0x40
+  36:	c3                   	ret
+
+00000037 <wait>:
+SYSCALL(wait)
+  37:	b8 03 00 00 00       	mov    $0x3,%eax
+  3c:	cd 40                	int    $0x40
+  3e:	c3                   	ret
+
+0000003f <pipe>:
+SYSCALL(pipe)
+  3f:	b8 04 00 00 00       	mov    $0x4,%eax
+  44:	cd 40                	int    $0x40
+  46:	c3                   	ret
+
+00000047 <read>:
+SYSCALL(read)
+  47:	b8 05 00 00 00       	mov    $0x5,%eax
+  4c:	cd 40                	int    $0x40
+  4e:	c3                   	ret
+
+0000004f <write>:
+SYSCALL(write)
+  4f:	b8 10 00 00 00       	mov    $0x10,%eax
+  54:	cd 40                	int    $0x40
+  56:	c3                   	ret
+
+00000057 <close>:
+SYSCALL(close)
+  57:	b8 15 00 00 00       	mov    $0x15,%eax
+  5c:	cd 40                	int    $0x40
+  5e:	c3                   	ret
+
+0000005f <kill>:
+SYSCALL(kill)
+  5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  64:	cd 40                	int    $0x40
+  66:	c3                   	ret
+
+00000067 <exec>:
+SYSCALL(exec)
+  67:	b8 07 00 00 00       	mov    $0x7,%eax
+  6c:	cd 40                	int    $0x40
+  6e:	c3                   	ret
+
+0000006f <open>:
+SYSCALL(open)
+  6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  74:	cd 40                	int    $0x40
+  76:	c3                   	ret
+
+00000077 <mknod>:
+SYSCALL(mknod)
+  77:	b8 11 00 00 00       	mov    $0x11,%eax
+  7c:	cd 40                	int    $0x40
+  7e:	c3                   	ret
+
+0000007f <unlink>:
+SYSCALL(unlink)
+  7f:	b8 12 00 00 00       	mov    $0x12,%eax
+  84:	cd 40                	int    $0x40
+  86:	c3                   	ret
+
+00000087 <fstat>:
+SYSCALL(fstat)
+  87:	b8 08 00 00 00       	mov    $0x8,%eax
+  8c:	cd 40                	int    $0x40
+  8e:	c3                   	ret
+
+0000008f <link>:
+SYSCALL(link)
+  8f:	b8 13 00 00 00       	mov    $0x13,%eax
+  94:	cd 40                	int    $0x40
+  96:	c3                   	ret
+
+00000097 <mkdir>:
+SYSCALL(mkdir)
+  97:	b8 14 00 00 00       	mov    $0x14,%eax
+  9c:	cd 40                	int    $0x40
+  9e:	c3                   	ret
+
+0000009f <chdir>:
+SYSCALL(chdir)
+  9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  a4:	cd 40                	int    $0x40
+  a6:	c3                   	ret
+
+000000a7 <dup>:
+SYSCALL(dup)
+  a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  ac:	cd 40                	int    $0x40
+  ae:	c3                   	ret
+
+000000af <getpid>:
+SYSCALL(getpid)
+  af:	b8 0b 00 00 00       	mov    $0xb,%eax
+  b4:	cd 40                	int    $0x40
+  b6:	c3                   	ret
+
+000000b7 <sbrk>:
+SYSCALL(sbrk)
+  b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  bc:	cd 40                	int    $0x40
+  be:	c3                   	ret
+
+000000bf <sleep>:
+SYSCALL(sleep)
+  bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  c4:	cd 40                	int    $0x40
+  c6:	c3                   	ret
+
+000000c7 <uptime>:
+SYSCALL(uptime)
+  c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  cc:	cd 40                	int    $0x40
+  ce:	c3                   	ret
+
+000000cf <yield>:
+SYSCALL(yield)
+  cf:	b8 16 00 00 00       	mov    $0x16,%eax
+  d4:	cd 40                	int    $0x40
+  d6:	c3                   	ret
+
+000000d7 <shutdown>:
+SYSCALL(shutdown)
+  d7:	b8 17 00 00 00       	mov    $0x17,%eax
+  dc:	cd 40                	int    $0x40
+  de:	c3                   	ret
+
+000000df <nicefork>:
+SYSCALL(nicefork)
+  df:	b8 18 00 00 00       	mov    $0x18,%eax
+  e4:	cd 40                	int    $0x40
+  e6:	c3                   	ret
+
+000000e7 <schedlog>:
+SYSCALL(schedlog)
+  e7:	b8 19 00 00 00       	mov    $0x19,%eax
+  ec:	cd 40                	int    $0x40
+  ee:	c3                   	ret
+
+000000ef <schedstat>:
+SYSCALL(schedstat)
+  ef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  f4:	cd 40                	int    $0x40
+  f6:	c3                   	ret
+
+000000f7 <spawn>:
+SYSCALL(spawn)
+  f7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  fc:	cd 40                	int    $0x40
+  fe:	c3                   	ret
+
+000000ff <bstat>:
+SYSCALL(bstat)
+  ff:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 104:	cd 40                	int    $0x40
+ 106:	c3                   	ret
+
+00000107 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 1c             	sub    $0x1c,%esp
+ 10d:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 110:	6a 01                	push   $0x1
+ 112:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 115:	52                   	push   %edx
+ 116:	50                   	push   %eax
+ 117:	e8 33 ff ff ff       	call   4f <write>
+}
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+ 124:	57                   	push   %edi
+ 125:	56                   	push   %esi
+ 126:	53                   	push   %ebx
+ 127:	83 ec 2c             	sub    $0x2c,%esp
+ 12a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 12d:	89 d0                	mov    %edx,%eax
+ 12f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 131:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 135:	0f 95 c1             	setne  %cl
+ 138:	c1 ea 1f             	shr    $0x1f,%edx
+ 13b:	84 d1                	test   %dl,%cl
+ 13d:	74 44                	je     183 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 13f:	f7 d8                	neg    %eax
+ 141:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 143:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 14a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 14f:	89 c8                	mov    %ecx,%eax
+ 151:	ba 00 00 00 00       	mov    $0x0,%edx
+ 156:	f7 f6                	div    %esi
+ 158:	89 df                	mov    %ebx,%edi
+ 15a:	83 c3 01             	add    $0x1,%ebx
+ 15d:	0f b6 92 a8 03 00 00 	movzbl 0x3a8(%edx),%edx
+ 164:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 168:	89 ca                	mov    %ecx,%edx
+ 16a:	89 c1                	mov    %eax,%ecx
+ 16c:	39 f2                	cmp    %esi,%edx
+ 16e:	73 df                	jae    14f <printint+0x2e>
+  if(neg)
+ 170:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 174:	74 31                	je     1a7 <printint+0x86>
+    buf[i++] = '-';
+ 176:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 17b:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 17e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 181:	eb 17                	jmp    19a <printint+0x79>
+    x = xx;
+ 183:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 185:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 18c:	eb bc                	jmp    14a <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 18e:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 193:	89 f0                	mov    %esi,%eax
+ 195:	e8 6d ff ff ff       	call   107 <putc>
+  while(--i >= 0)
+ 19a:	83 eb 01             	sub    $0x1,%ebx
+ 19d:	79 ef                	jns    18e <printint+0x6d>
+}
+ 19f:	83 c4 2c             	add    $0x2c,%esp
+ 1a2:	5b                   	pop    %ebx
+ 1a3:	5e                   	pop    %esi
+ 1a4:	5f                   	pop    %edi
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+ 1a7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1aa:	eb ee                	jmp    19a <printint+0x79>
+
+000001ac <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 1ac:	55                   	push   %ebp
+ 1ad:	89 e5                	mov    %esp,%ebp
+ 1af:	57                   	push   %edi
+ 1b0:	56                   	push   %esi
+ 1b1:	53                   	push   %ebx
+ 1b2:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 1b5:	8d 45 10             	lea    0x10(%ebp),%eax
+ 1b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 1bb:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 1c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1c5:	eb 14                	jmp    1db <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 1c7:	89 fa                	mov    %edi,%edx
+ 1c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cc:	e8 36 ff ff ff       	call   107 <putc>
+ 1d1:	eb 05                	jmp    1d8 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 1d3:	83 fe 25             	cmp    $0x25,%esi
+ 1d6:	74 25                	je     1fd <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 1d8:	83 c3 01             	add    $0x1,%ebx
+ 1db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1de:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 1e2:	84 c0                	test   %al,%al
+ 1e4:	0f 84 4a 01 00 00    	je     334 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 1ea:	0f be f8             	movsbl %al,%edi
+ 1ed:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 1f0:	85 f6                	test   %esi,%esi
+ 1f2:	75 df                	jne    1d3 <printf+0x27>
+      if(c == '%'){
+ 1f4:	83 f8 25             	cmp    $0x25,%eax
+ 1f7:	75 ce                	jne    1c7 <printf+0x1b>
+        state = '%';
+ 1f9:	89 c6                	mov    %eax,%esi
+ 1fb:	eb db                	jmp    1d8 <printf+0x2c>
+      if(c == 'd'){
+ 1fd:	83 f8 25             	cmp    $0x25,%eax
+ 200:	0f 84 f9 00 00 00    	je     2ff <printf+0x153>
+ 206:	0f 8c 07 01 00 00    	jl     313 <printf+0x167>
+ 20c:	83 f8 78             	cmp    $0x78,%eax
+ 20f:	0f 8f fe 00 00 00    	jg     313 <printf+0x167>
+ 215:	83 f8 63             	cmp    $0x63,%eax
+ 218:	0f 8c f5 00 00 00    	jl     313 <printf+0x167>
+ 21e:	83 e8 63             	sub    $0x63,%eax
+ 221:	83 f8 15             	cmp    $0x15,%eax
+ 224:	0f 87 e9 00 00 00    	ja     313 <printf+0x167>
+ 22a:	ff 24 85 50 03 00 00 	jmp    *0x350(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 231:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 234:	8b 17                	mov    (%edi),%edx
+ 236:	83 ec 0c             	sub    $0xc,%esp
+ 239:	6a 01                	push   $0x1
+ 23b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	e8 d9 fe ff ff       	call   121 <printint>
+        ap++;
+ 248:	83 c7 04             	add    $0x4,%edi
+ 24b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 24e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 251:	be 00 00 00 00       	mov    $0x0,%esi
+ 256:	eb 80                	jmp    1d8 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 258:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 25b:	8b 17                	mov    (%edi),%edx
+ 25d:	83 ec 0c             	sub    $0xc,%esp
+ 260:	6a 00                	push   $0x0
+ 262:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26a:	e8 b2 fe ff ff       	call   121 <printint>
+        ap++;
+ 26f:	83 c7 04             	add    $0x4,%edi
+ 272:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 275:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 278:	be 00 00 00 00       	mov    $0x0,%esi
+ 27d:	e9 56 ff ff ff       	jmp    1d8 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 282:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 285:	8b 17                	mov    (%edi),%edx
+ 287:	83 ec 0c             	sub    $0xc,%esp
+ 28a:	6a 00                	push   $0x0
+ 28c:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	e8 88 fe ff ff       	call   121 <printint>
+        ap++;
+ 299:	83 c7 04             	add    $0x4,%edi
+ 29c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 29f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2a2:	be 00 00 00 00       	mov    $0x0,%esi
+ 2a7:	e9 2c ff ff ff       	jmp    1d8 <printf+0x2c>
+        s = (char*)*ap;
+ 2ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2af:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2b1:	83 c0 04             	add    $0x4,%eax
+ 2b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 2b7:	85 f6                	test   %esi,%esi
+ 2b9:	75 15                	jne    2d0 <printf+0x124>
+          s = "(null)";
+ 2bb:	be 49 03 00 00       	mov    $0x349,%esi
+ 2c0:	eb 0e                	jmp    2d0 <printf+0x124>
+          putc(fd, *s);
+ 2c2:	0f be d2             	movsbl %dl,%edx
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c8:	e8 3a fe ff ff       	call   107 <putc>
+          s++;
+ 2cd:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 2d0:	0f b6 16             	movzbl (%esi),%edx
+ 2d3:	84 d2                	test   %dl,%dl
+ 2d5:	75 eb                	jne    2c2 <printf+0x116>
+      state = 0;
+ 2d7:	be 00 00 00 00       	mov    $0x0,%esi
+ 2dc:	e9 f7 fe ff ff       	jmp    1d8 <printf+0x2c>
+        putc(fd, *ap);
+ 2e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2e4:	0f be 17             	movsbl (%edi),%edx
+ 2e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ea:	e8 18 fe ff ff       	call   107 <putc>
+        ap++;
+ 2ef:	83 c7 04             	add    $0x4,%edi
+ 2f2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 2f5:	be 00 00 00 00       	mov    $0x0,%esi
+ 2fa:	e9 d9 fe ff ff       	jmp    1d8 <printf+0x2c>
+        putc(fd, c);
+ 2ff:	89 fa                	mov    %edi,%edx
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	e8 fe fd ff ff       	call   107 <putc>
+      state = 0;
+ 309:	be 00 00 00 00       	mov    $0x0,%esi
+ 30e:	e9 c5 fe ff ff       	jmp    1d8 <printf+0x2c>
+        putc(fd, '%');
+ 313:	ba 25 00 00 00       	mov    $0x25,%edx
+ 318:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31b:	e8 e7 fd ff ff       	call   107 <putc>
+        putc(fd, c);
+ 320:	89 fa                	mov    %edi,%edx
+ 322:	8b 45 08             	mov    0x8(%ebp),%eax
+ 325:	e8 dd fd ff ff       	call   107 <putc>
+      state = 0;
+ 32a:	be 00 00 00 00       	mov    $0x0,%esi
+ 32f:	e9 a4 fe ff ff       	jmp    1d8 <printf+0x2c>
+    }
+  }
+}
+ 334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 337:	5b                   	pop    %ebx
+ 338:	5e                   	pop    %esi
+ 339:	5f                   	pop    %edi
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
@@ -1,8 +1,8 @@
-#include "types.h"
-#include "user.h"
-
-int main() {
-    printf(0, "hello world\n");
-    fork();
-    exit();
+#include "types.h"
+#include "user.h"
+
+int main() {
+    printf(0, "hello world\n");
+    fork();
+    exit();
 }
\ No newline at end of file
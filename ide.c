@@ -1,4 +1,9 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.
+//
+// Requests are sorted by an elevator and adjacent ones are
+// merged into multi-sector transfers. Data moves by bus-master
+// DMA when the controller is a PCI IDE function that supports
+// it, and otherwise by PIO.
 
 #include "types.h"
 #include "defs.h"
@@ -12,27 +17,71 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
 #define IDE_DRDY      0x40
 #define IDE_DF        0x20
+#define IDE_DRQ       0x08
 #define IDE_ERR       0x01
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_READDMA  0xc8
+#define IDE_CMD_WRITEDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Bus-master registers, at an offset from idebm.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRD        4
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // Device to memory
+#define BM_ST_ERR     0x02
+#define BM_ST_INTR    0x04
+
+#define IDE_MULT      16   // Sectors per interrupt asked of the disk
+#define IDE_MAXSECT   255  // Sectors per command; the count register is 8 bits
+
+// Elevator key: requests are served in ascending order of key,
+// wrapping round to the lowest once the highest has been served.
+#define KEY(b)  (((b)->dev << 24) | (b)->blockno)
+
+// idequeue holds the requests waiting for the disk, linked
+// through qnext in elevator order after idepos, the key of the
+// request last started. ideactive is the request in progress:
+// one or more bufs for consecutive blocks, merged into a single
+// transfer and also linked through qnext. You must hold idelock
+// while manipulating either.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *ideactive;
+static uint idepos;
+
+static struct buf *idexfer;  // Buf the next sector goes to or from
+static int idexoff;          // Sector within idexfer
+static int idenleft;         // Sectors of ideactive still to transfer
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemult[2];       // Sectors per interrupt, per disk
+static void idestart(void);
+
+// Physical region descriptor: one per buf of a DMA transfer.
+// The table is aligned so that it cannot cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort n;     // Bytes
+  ushort flags;
+};
+#define PRD_EOT  0x8000  // Last entry of the table
+
+static int idebm;  // Bus-master I/O base; 0 to use PIO
+static int idedma; // ideactive is moving by DMA
+static struct prd ideprd[IDE_MAXSECT] __attribute__((aligned(PGSIZE)));
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +96,35 @@ idewait(int checkerr)
   return 0;
 }
 
+// Ask disk dev to transfer IDE_MULT sectors per interrupt
+// in RDMUL/WRMUL commands. Returns how many it will.
+static int
+setmult(int dev)
+{
+  idewait(0);
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f6, 0xe0 | ((dev&1)<<4));
+  outb(0x1f7, IDE_CMD_SETMUL);
+  return idewait(1) < 0 ? 1 : IDE_MULT;
+}
+
+// Use bus-master DMA if the controller is a PCI IDE function
+// with a bus-master range.
+static void
+dmainit(void)
+{
+  struct pcidev d;
+  uint bar;
+
+  if(pcifind(PCI_ANY, PCI_ANY, PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &d) < 0)
+    return;
+  bar = pcibar(&d, 4);
+  if((bar & 1) == 0 || (bar & ~3) == 0)
+    return;
+  pcienable(&d);
+  idebm = bar & ~3;
+}
+
 void
 ideinit(void)
 {
@@ -65,37 +143,156 @@ ideinit(void)
     }
   }
 
+  idemult[0] = setmult(0);
+  if(havedisk1)
+    idemult[1] = setmult(1);
+  dmainit();
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next block of sectors, as many as the disk transfers
+// per interrupt, between the disk and the active bufs.
+static void
+idepio(int write)
+{
+  uchar *p;
+  int n;
+
+  for(n = 0; n < idemult[ideactive->dev&1] && idenleft > 0; n++, idenleft--){
+    p = idexfer->data + idexoff*SECTOR_SIZE;
+    if(write)
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+    if(++idexoff == BSIZE/SECTOR_SIZE){
+      idexoff = 0;
+      idexfer = idexfer->qnext;
+    }
+  }
+}
+
+// Can the bufs from b on be moved by DMA? A PRD entry
+// must not cross a 64KB physical boundary.
+static int
+dmaok(struct buf *b)
+{
+  for(; b; b = b->qnext)
+    if((V2P(b->data) ^ (V2P(b->data) + BSIZE - 1)) & ~0xffff)
+      return 0;
+  return 1;
+}
+
+// Start a DMA transfer of the nsect sectors at sector
+// to or from the bufs of the active request.
+static void
+dmastart(struct buf *b, int nsect, int sector, int write)
+{
+  int i;
+
+  for(i = 0; b; b = b->qnext, i++){
+    ideprd[i].addr = V2P(b->data);
+    ideprd[i].n = BSIZE;
+    ideprd[i].flags = b->qnext ? 0 : PRD_EOT;
+  }
+  idenleft = 0;
+
+  outl(idebm + BM_PRD, V2P(ideprd));
+  outb(idebm + BM_CMD, write ? 0 : BM_CMD_READ);
+  outb(idebm + BM_STATUS, inb(idebm + BM_STATUS) | BM_ST_ERR | BM_ST_INTR);
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nsect);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((ideactive->dev&1)<<4) | ((sector>>24)&0x0f));
+  outb(0x1f7, write ? IDE_CMD_WRITEDMA : IDE_CMD_READDMA);
+  outb(idebm + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+}
+
+// The DMA transfer of the active request has ended. Returns 0 if
+// it succeeded; otherwise falls back to PIO and requeues it.
+static int
+dmadone(void)
+{
+  struct buf *b;
+  uchar st;
+
+  st = inb(idebm + BM_STATUS);
+  outb(idebm + BM_CMD, 0);
+  outb(idebm + BM_STATUS, st | BM_ST_ERR | BM_ST_INTR);
+  if((st & BM_ST_ERR) == 0 && idewait(1) >= 0)
+    return 0;
+
+  cprintf("ide: DMA failed, using PIO\n");
+  idebm = 0;
+  for(b = ideactive; b->qnext; b = b->qnext)
+    ;
+  b->qnext = idequeue;
+  idequeue = ideactive;
+  ideactive = 0;
+  idestart();
+  return -1;
+}
+
+// Start the request at the head of idequeue, merged with the
+// requests behind it for the following blocks in the same
+// direction. Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(void)
 {
-  if(b == 0)
+  struct buf *b, *last;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector, nsect, write, cmd;
+
+  if((b = idequeue) == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  write = (b->flags & B_DIRTY) != 0;
+  nsect = sector_per_block;
+  for(last = b; last->qnext; last = last->qnext){
+    if(last->qnext->dev != b->dev || last->qnext->blockno != last->blockno + 1)
+      break;
+    if(((last->qnext->flags & B_DIRTY) != 0) != write)
+      break;
+    if(nsect + sector_per_block > IDE_MAXSECT)
+      break;
+    nsect += sector_per_block;
+  }
+  if(last->blockno >= FSSIZE)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  idequeue = last->qnext;
+  last->qnext = 0;
+  ideactive = idexfer = b;
+  idexoff = 0;
+  idenleft = nsect;
+  idepos = KEY(b);
 
-  if (sector_per_block > 7) panic("idestart");
+  sector = b->blockno * sector_per_block;
+  idedma = idebm && dmaok(b);
+  if(idedma){
+    dmastart(b, nsect, sector, write);
+    return;
+  }
+  if(idemult[b->dev&1] > 1)
+    cmd = write ? IDE_CMD_WRMUL : IDE_CMD_RDMUL;
+  else
+    cmd = write ? IDE_CMD_WRITE : IDE_CMD_READ;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
-  } else {
-    outb(0x1f7, read_cmd);
+  outb(0x1f7, cmd);
+  if(write){
+    while((inb(0x1f7) & (IDE_BSY|IDE_DRQ)) != IDE_DRQ)
+      ;
+    idepio(1);
   }
 }
 
@@ -103,41 +300,79 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next, *done;
+  int write;
 
-  // First queued buffer is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if(ideactive == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
+  write = (ideactive->flags & B_DIRTY) != 0;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idedma){
+    if(dmadone() < 0){
+      release(&idelock);
+      return;
+    }
+  } else if(idewait(1) < 0){
+    // The request failed; finish it.
+    idenleft = 0;
+  } else if(write){
+    // The disk took the last block sent. Send the next one, if
+    // any; the write is done only when the disk acknowledges
+    // the final block with an interrupt of its own.
+    if(idenleft > 0){
+      idepio(1);
+      release(&idelock);
+      return;
+    }
+  } else {
+    // A block of sectors is ready to read.
+    idepio(0);
+    if(idenleft > 0){
+      release(&idelock);
+      return;
+    }
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for these bufs. Nobody waits for
+  // a submitted one; collect them to be released instead.
+  done = 0;
+  for(b = ideactive; b; b = next){
+    next = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      b->qnext = done;
+      done = b;
+    }
+    wakeup(b);
+  }
+  ideactive = 0;
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart();
 
   release(&idelock);
+
+  for(b = done; b; b = next){
+    next = b->qnext;
+    bdone(b);
+  }
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Queue b for the disk in elevator order. Caller must hold
+// idelock and start the disk if it is idle.
+static void
+idequeueb(struct buf *b)
 {
   struct buf **pp;
+  uint k;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -146,23 +381,63 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  k = KEY(b) - idepos;
+  for(pp=&idequeue; *pp && KEY(*pp) - idepos <= k; pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC:acquire-lock
+
+  idequeueb(b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(ideactive == 0)
+    idestart();
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
+  release(&idelock);
+}
+
+// Like iderw, but return as soon as b is queued. The driver
+// releases b with bdone when the request completes, so the
+// caller must not touch b after submitting it.
+void
+idesubmit(struct buf *b)
+{
+  acquire(&idelock);
+  b->flags |= B_ASYNC;
+  idequeueb(b);
+  if(ideactive == 0)
+    idestart();
+  release(&idelock);
+}
+
+// Like iderw for n bufs at once. They are all queued before
+// the disk starts, so that adjacent ones are merged.
+void
+iderwv(struct buf **b, int n)
+{
+  int i;
 
+  acquire(&idelock);
+  for(i = 0; i < n; i++)
+    idequeueb(b[i]);
+  if(ideactive == 0 && idequeue != 0)
+    idestart();
+  for(i = 0; i < n; i++)
+    while((b[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(b[i], &idelock);
   release(&idelock);
 }
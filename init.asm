@@ -0,0 +1,571 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 f4 03 00 00       	push   $0x3f4
+  19:	e8 07 01 00 00       	call   125 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 1b                	js     40 <main+0x40>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 2e 01 00 00       	call   15d <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 22 01 00 00       	call   15d <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	eb 58                	jmp    98 <main+0x98>
+    mknod("console", 1, 1);
+  40:	83 ec 04             	sub    $0x4,%esp
+  43:	6a 01                	push   $0x1
+  45:	6a 01                	push   $0x1
+  47:	68 f4 03 00 00       	push   $0x3f4
+  4c:	e8 dc 00 00 00       	call   12d <mknod>
+    open("console", O_RDWR);
+  51:	83 c4 08             	add    $0x8,%esp
+  54:	6a 02                	push   $0x2
+  56:	68 f4 03 00 00       	push   $0x3f4
+  5b:	e8 c5 00 00 00       	call   125 <open>
+  60:	83 c4 10             	add    $0x10,%esp
+  63:	eb c0                	jmp    25 <main+0x25>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    pid = fork();
+    if(pid < 0){
+      printf(1, "init: fork failed\n");
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	68 0f 04 00 00       	push   $0x40f
+  6d:	6a 01                	push   $0x1
+  6f:	e8 ee 01 00 00       	call   262 <printf>
+      exit();
+  74:	e8 6c 00 00 00       	call   e5 <exit>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 3b 04 00 00       	push   $0x43b
+  81:	6a 01                	push   $0x1
+  83:	e8 da 01 00 00       	call   262 <printf>
+  88:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  8b:	e8 5d 00 00 00       	call   ed <wait>
+  90:	85 c0                	test   %eax,%eax
+  92:	78 04                	js     98 <main+0x98>
+  94:	39 c3                	cmp    %eax,%ebx
+  96:	75 e1                	jne    79 <main+0x79>
+    printf(1, "init: starting sh\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 fc 03 00 00       	push   $0x3fc
+  a0:	6a 01                	push   $0x1
+  a2:	e8 bb 01 00 00       	call   262 <printf>
+    pid = fork();
+  a7:	e8 31 00 00 00       	call   dd <fork>
+  ac:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	85 c0                	test   %eax,%eax
+  b3:	78 b0                	js     65 <main+0x65>
+    if(pid == 0){
+  b5:	75 d4                	jne    8b <main+0x8b>
+      exec("sh", argv);
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 b8 04 00 00       	push   $0x4b8
+  bf:	68 22 04 00 00       	push   $0x422
+  c4:	e8 54 00 00 00       	call   11d <exec>
+      printf(1, "init: exec sh failed\n");
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	68 25 04 00 00       	push   $0x425
+  d1:	6a 01                	push   $0x1
+  d3:	e8 8a 01 00 00       	call   262 <printf>
+      exit();
+  d8:	e8 08 00 00 00       	call   e5 <exit>
+
+000000dd <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  e2:	cd 40                	int    $0x40
+  e4:	c3                   	ret
+
+000000e5 <exit>:
+SYSCALL(exit)
+  e5:	b8 02 00 00 00       	mov    $0x2,%eax
+  ea:	cd 40                	int    $0x40
+  ec:	c3                   	ret
+
+000000ed <wait>:
+SYSCALL(wait)
+  ed:	b8 03 00 00 00       	mov    $0x3,%eax
+  f2:	cd 40                	int    $0x40
+  f4:	c3                   	ret
+
+000000f5 <pipe>:
+SYSCALL(pipe)
+  f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  fa:	cd 40                	int    $0x40
+  fc:	c3                   	ret
+
+000000fd <read>:
+SYSCALL(read)
+  fd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 102:	cd 40                	int    $0x40
+ 104:	c3                   	ret
+
+00000105 <write>:
+SYSCALL(write)
+ 105:	b8 10 00 00 00       	mov    $0x10,%eax
+ 10a:	cd 40                	int    $0x40
+ 10c:	c3                   	ret
+
+0000010d <close>:
+SYSCALL(close)
+ 10d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 112:	cd 40                	int    $0x40
+ 114:	c3                   	ret
+
+00000115 <kill>:
+SYSCALL(kill)
+ 115:	b8 06 00 00 00       	mov    $0x6,%eax
+ 11a:	cd 40                	int    $0x40
+ 11c:	c3                   	ret
+
+0000011d <exec>:
+SYSCALL(exec)
+ 11d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 122:	cd 40                	int    $0x40
+ 124:	c3                   	ret
+
+00000125 <open>:
+SYSCALL(open)
+ 125:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 12a:	cd 40                	int    $0x40
+ 12c:	c3                   	ret
+
+0000012d <mknod>:
+SYSCALL(mknod)
+ 12d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 132:	cd 40                	int    $0x40
+ 134:	c3                   	ret
+
+00000135 <unlink>:
+SYSCALL(unlink)
+ 135:	b8 12 00 00 00       	mov    $0x12,%eax
+ 13a:	cd 40                	int    $0x40
+ 13c:	c3                   	ret
+
+0000013d <fstat>:
+SYSCALL(fstat)
+ 13d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 142:	cd 40                	int    $0x40
+ 144:	c3                   	ret
+
+00000145 <link>:
+SYSCALL(link)
+ 145:	b8 13 00 00 00       	mov    $0x13,%eax
+ 14a:	cd 40                	int    $0x40
+ 14c:	c3                   	ret
+
+0000014d <mkdir>:
+SYSCALL(mkdir)
+ 14d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 152:	cd 40                	int    $0x40
+ 154:	c3                   	ret
+
+00000155 <chdir>:
+SYSCALL(chdir)
+ 155:	b8 09 00 00 00       	mov    $0x9,%eax
+ 15a:	cd 40                	int    $0x40
+ 15c:	c3                   	ret
+
+0000015d <dup>:
+SYSCALL(dup)
+ 15d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 162:	cd 40                	int    $0x40
+ 164:	c3                   	ret
+
+00000165 <getpid>:
+SYSCALL(getpid)
+ 165:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 16a:	cd 40                	int    $0x40
+ 16c:	c3                   	ret
+
+0000016d <sbrk>:
+SYSCALL(sbrk)
+ 16d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 172:	cd 40                	int    $0x40
+ 174:	c3                   	ret
+
+00000175 <sleep>:
+SYSCALL(sleep)
+ 175:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 17a:	cd 40                	int    $0x40
+ 17c:	c3                   	ret
+
+0000017d <uptime>:
+SYSCALL(uptime)
+ 17d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 182:	cd 40                	int    $0x40
+ 184:	c3                   	ret
+
+00000185 <yield>:
+SYSCALL(yield)
+ 185:	b8 16 00 00 00       	mov    $0x16,%eax
+ 18a:	cd 40                	int    $0x40
+ 18c:	c3                   	ret
+
+0000018d <shutdown>:
+SYSCALL(shutdown)
+ 18d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 192:	cd 40                	int    $0x40
+ 194:	c3                   	ret
+
+00000195 <nicefork>:
+SYSCALL(nicefork)
+ 195:	b8 18 00 00 00       	mov    $0x18,%eax
+ 19a:	cd 40                	int    $0x40
+ 19c:	c3                   	ret
+
+0000019d <schedlog>:
+SYSCALL(schedlog)
+ 19d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1a2:	cd 40                	int    $0x40
+ 1a4:	c3                   	ret
+
+000001a5 <schedstat>:
+SYSCALL(schedstat)
+ 1a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1aa:	cd 40                	int    $0x40
+ 1ac:	c3                   	ret
+
+000001ad <spawn>:
+SYSCALL(spawn)
+ 1ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1b2:	cd 40                	int    $0x40
+ 1b4:	c3                   	ret
+
+000001b5 <bstat>:
+SYSCALL(bstat)
+ 1b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1ba:	cd 40                	int    $0x40
+ 1bc:	c3                   	ret
+
+000001bd <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	83 ec 1c             	sub    $0x1c,%esp
+ 1c3:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 1cb:	52                   	push   %edx
+ 1cc:	50                   	push   %eax
+ 1cd:	e8 33 ff ff ff       	call   105 <write>
+}
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	57                   	push   %edi
+ 1db:	56                   	push   %esi
+ 1dc:	53                   	push   %ebx
+ 1dd:	83 ec 2c             	sub    $0x2c,%esp
+ 1e0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 1e3:	89 d0                	mov    %edx,%eax
+ 1e5:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 1e7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 1eb:	0f 95 c1             	setne  %cl
+ 1ee:	c1 ea 1f             	shr    $0x1f,%edx
+ 1f1:	84 d1                	test   %dl,%cl
+ 1f3:	74 44                	je     239 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 1f5:	f7 d8                	neg    %eax
+ 1f7:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 1f9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 200:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 205:	89 c8                	mov    %ecx,%eax
+ 207:	ba 00 00 00 00       	mov    $0x0,%edx
+ 20c:	f7 f6                	div    %esi
+ 20e:	89 df                	mov    %ebx,%edi
+ 210:	83 c3 01             	add    $0x1,%ebx
+ 213:	0f b6 92 a4 04 00 00 	movzbl 0x4a4(%edx),%edx
+ 21a:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 21e:	89 ca                	mov    %ecx,%edx
+ 220:	89 c1                	mov    %eax,%ecx
+ 222:	39 f2                	cmp    %esi,%edx
+ 224:	73 df                	jae    205 <printint+0x2e>
+  if(neg)
+ 226:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 22a:	74 31                	je     25d <printint+0x86>
+    buf[i++] = '-';
+ 22c:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 231:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 234:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 237:	eb 17                	jmp    250 <printint+0x79>
+    x = xx;
+ 239:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 23b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 242:	eb bc                	jmp    200 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 244:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 249:	89 f0                	mov    %esi,%eax
+ 24b:	e8 6d ff ff ff       	call   1bd <putc>
+  while(--i >= 0)
+ 250:	83 eb 01             	sub    $0x1,%ebx
+ 253:	79 ef                	jns    244 <printint+0x6d>
+}
+ 255:	83 c4 2c             	add    $0x2c,%esp
+ 258:	5b                   	pop    %ebx
+ 259:	5e                   	pop    %esi
+ 25a:	5f                   	pop    %edi
+ 25b:	5d                   	pop    %ebp
+ 25c:	c3                   	ret
+ 25d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 260:	eb ee                	jmp    250 <printint+0x79>
+
+00000262 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 262:	55                   	push   %ebp
+ 263:	89 e5                	mov    %esp,%ebp
+ 265:	57                   	push   %edi
+ 266:	56                   	push   %esi
+ 267:	53                   	push   %ebx
+ 268:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 26b:	8d 45 10             	lea    0x10(%ebp),%eax
+ 26e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 271:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 276:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 27b:	eb 14                	jmp    291 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 27d:	89 fa                	mov    %edi,%edx
+ 27f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 282:	e8 36 ff ff ff       	call   1bd <putc>
+ 287:	eb 05                	jmp    28e <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 289:	83 fe 25             	cmp    $0x25,%esi
+ 28c:	74 25                	je     2b3 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 28e:	83 c3 01             	add    $0x1,%ebx
+ 291:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 294:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 298:	84 c0                	test   %al,%al
+ 29a:	0f 84 4a 01 00 00    	je     3ea <printf+0x188>
+    c = fmt[i] & 0xff;
+ 2a0:	0f be f8             	movsbl %al,%edi
+ 2a3:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 2a6:	85 f6                	test   %esi,%esi
+ 2a8:	75 df                	jne    289 <printf+0x27>
+      if(c == '%'){
+ 2aa:	83 f8 25             	cmp    $0x25,%eax
+ 2ad:	75 ce                	jne    27d <printf+0x1b>
+        state = '%';
+ 2af:	89 c6                	mov    %eax,%esi
+ 2b1:	eb db                	jmp    28e <printf+0x2c>
+      if(c == 'd'){
+ 2b3:	83 f8 25             	cmp    $0x25,%eax
+ 2b6:	0f 84 f9 00 00 00    	je     3b5 <printf+0x153>
+ 2bc:	0f 8c 07 01 00 00    	jl     3c9 <printf+0x167>
+ 2c2:	83 f8 78             	cmp    $0x78,%eax
+ 2c5:	0f 8f fe 00 00 00    	jg     3c9 <printf+0x167>
+ 2cb:	83 f8 63             	cmp    $0x63,%eax
+ 2ce:	0f 8c f5 00 00 00    	jl     3c9 <printf+0x167>
+ 2d4:	83 e8 63             	sub    $0x63,%eax
+ 2d7:	83 f8 15             	cmp    $0x15,%eax
+ 2da:	0f 87 e9 00 00 00    	ja     3c9 <printf+0x167>
+ 2e0:	ff 24 85 4c 04 00 00 	jmp    *0x44c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 2e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2ea:	8b 17                	mov    (%edi),%edx
+ 2ec:	83 ec 0c             	sub    $0xc,%esp
+ 2ef:	6a 01                	push   $0x1
+ 2f1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f9:	e8 d9 fe ff ff       	call   1d7 <printint>
+        ap++;
+ 2fe:	83 c7 04             	add    $0x4,%edi
+ 301:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 304:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 307:	be 00 00 00 00       	mov    $0x0,%esi
+ 30c:	eb 80                	jmp    28e <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 30e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 311:	8b 17                	mov    (%edi),%edx
+ 313:	83 ec 0c             	sub    $0xc,%esp
+ 316:	6a 00                	push   $0x0
+ 318:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 31d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 320:	e8 b2 fe ff ff       	call   1d7 <printint>
+        ap++;
+ 325:	83 c7 04             	add    $0x4,%edi
+ 328:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 32b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 32e:	be 00 00 00 00       	mov    $0x0,%esi
+ 333:	e9 56 ff ff ff       	jmp    28e <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 338:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 33b:	8b 17                	mov    (%edi),%edx
+ 33d:	83 ec 0c             	sub    $0xc,%esp
+ 340:	6a 00                	push   $0x0
+ 342:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 347:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34a:	e8 88 fe ff ff       	call   1d7 <printint>
+        ap++;
+ 34f:	83 c7 04             	add    $0x4,%edi
+ 352:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 355:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 358:	be 00 00 00 00       	mov    $0x0,%esi
+ 35d:	e9 2c ff ff ff       	jmp    28e <printf+0x2c>
+        s = (char*)*ap;
+ 362:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 365:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 367:	83 c0 04             	add    $0x4,%eax
+ 36a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 36d:	85 f6                	test   %esi,%esi
+ 36f:	75 15                	jne    386 <printf+0x124>
+          s = "(null)";
+ 371:	be 44 04 00 00       	mov    $0x444,%esi
+ 376:	eb 0e                	jmp    386 <printf+0x124>
+          putc(fd, *s);
+ 378:	0f be d2             	movsbl %dl,%edx
+ 37b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37e:	e8 3a fe ff ff       	call   1bd <putc>
+          s++;
+ 383:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 386:	0f b6 16             	movzbl (%esi),%edx
+ 389:	84 d2                	test   %dl,%dl
+ 38b:	75 eb                	jne    378 <printf+0x116>
+      state = 0;
+ 38d:	be 00 00 00 00       	mov    $0x0,%esi
+ 392:	e9 f7 fe ff ff       	jmp    28e <printf+0x2c>
+        putc(fd, *ap);
+ 397:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 39a:	0f be 17             	movsbl (%edi),%edx
+ 39d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a0:	e8 18 fe ff ff       	call   1bd <putc>
+        ap++;
+ 3a5:	83 c7 04             	add    $0x4,%edi
+ 3a8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 3ab:	be 00 00 00 00       	mov    $0x0,%esi
+ 3b0:	e9 d9 fe ff ff       	jmp    28e <printf+0x2c>
+        putc(fd, c);
+ 3b5:	89 fa                	mov    %edi,%edx
+ 3b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ba:	e8 fe fd ff ff       	call   1bd <putc>
+      state = 0;
+ 3bf:	be 00 00 00 00       	mov    $0x0,%esi
+ 3c4:	e9 c5 fe ff ff       	jmp    28e <printf+0x2c>
+        putc(fd, '%');
+ 3c9:	ba 25 00 00 00       	mov    $0x25,%edx
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d1:	e8 e7 fd ff ff       	call   1bd <putc>
+        putc(fd, c);
+ 3d6:	89 fa                	mov    %edi,%edx
+ 3d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3db:	e8 dd fd ff ff       	call   1bd <putc>
+      state = 0;
+ 3e0:	be 00 00 00 00       	mov    $0x0,%esi
+ 3e5:	e9 a4 fe ff ff       	jmp    28e <printf+0x2c>
+    }
+  }
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
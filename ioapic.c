@@ -73,3 +73,12 @@ ioapicenable(int irq, int cpunum)
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
   ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Like ioapicenable, for the level-triggered line irq of a PCI
+// device, delivered on the vector of IRQ vecirq.
+void
+ioapicenablepci(int irq, int vecirq, int cpunum)
+{
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | (T_IRQ0 + vecirq));
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+}
@@ -7,9 +7,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "x86.h"
+#include "proc.h"
 #include "spinlock.h"
 
 void freerange(void *vstart, void *vend);
+static char* kalloc_zeroed_pool(void);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
@@ -17,12 +20,45 @@ struct run {
   struct run *next;
 };
 
+#define MAGSIZE   64  // Free pages a CPU may cache before spilling some
+#define MAGBATCH  32  // Pages moved to or from the global list at a time
+#define NZEROED   64  // Pre-zeroed pages the idle loop keeps ready
+
+// Build with `make DEBUG=1` to fill freed pages with junk.
+#ifdef DEBUG
+#define KALLOC_POISON 1
+#else
+#define KALLOC_POISON 0
+#endif
+
+// Each CPU keeps a magazine of free pages so that most kalloc()
+// and kfree() calls take no lock at all: only the owning CPU
+// touches its magazine, with interrupts off. Batches move to and
+// from kmem.freelist under kmem.lock. A CPU that finds both empty
+// sets kmem.needy, and the others then hand back their whole
+// magazines the next time they allocate or free a page.
+struct magazine {
+  struct run *list;
+  int n;
+};
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int needy;               // A CPU ran dry; return magazines to freelist
+  struct magazine mag[NCPU];
+  struct spinlock zlock;   // Protects zeroed and nzeroed
+  struct run *zeroed;      // Pages already cleared by kzerofill
+  int nzeroed;
+  int npage;               // Pages handed to the allocator by freerange
+  // References to each allocated page, so that copy-on-write
+  // fork can share them. Updated atomically, without a lock.
+  ushort ref[PHYSTOP / PGSIZE];
 } kmem;
 
+#define REF(v)  kmem.ref[V2P(v) / PGSIZE]
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -32,6 +68,7 @@ void
 kinit1(void *vstart, void *vend)
 {
   initlock(&kmem.lock, "kmem");
+  initlock(&kmem.zlock, "kzero");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -49,32 +86,116 @@ freerange(void *vstart, void *vend)
   char *p;
   if (vend < vstart) panic("freerange");
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    REF(p) = 1;
     kfree(p);
+    kmem.npage++;
+  }
 }
+
+// Number of pages of physical memory the allocator manages,
+// free or not, for sizing caches at boot.
+int
+kpages(void)
+{
+  return kmem.npage;
+}
+
+// Detach up to n pages from the front of *list.
+// Returns the chain, its length in *got and its last page in *tail.
+static struct run*
+take(struct run **list, int n, int *got, struct run **tail)
+{
+  struct run *head, *r;
+  int i;
+
+  head = r = *list;
+  *tail = 0;
+  for(i = 0; i < n && r; i++){
+    *tail = r;
+    r = r->next;
+  }
+  if(*tail)
+    (*tail)->next = 0;
+  *list = r;
+  *got = i;
+  return head;
+}
+
+// Move up to n pages from the calling CPU's magazine m to the
+// global list. Called with interrupts off.
+static void
+spill(struct magazine *m, int n)
+{
+  struct run *r, *tail;
+  int got;
+
+  if((r = take(&m->list, n, &got, &tail)) == 0)
+    return;
+  m->n -= got;
+  acquire(&kmem.lock);
+  tail->next = kmem.freelist;
+  kmem.freelist = r;
+  if(m->list == 0)
+    kmem.needy = 0;
+  release(&kmem.lock);
+}
+// Add a reference to the allocated page v.
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kref");
+  __sync_fetch_and_add(&REF(v), 1);
+}
+
+// Number of references to the allocated page v.
+int
+krefcount(char *v)
+{
+  return REF(v);
+}
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
+// call to kalloc(), and free it if that was the last one.
+// (The exception is when initializing the allocator; see
+// kinit above.)
 void
 kfree(char *v)
 {
+  struct magazine *m;
   struct run *r;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
+  if(REF(v) == 0)
+    panic("kfree: free page");
+  if(__sync_sub_and_fetch(&REF(v), 1) != 0)
+    return;
 
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  if(KALLOC_POISON)
+    memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    return;
+  }
+
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  r->next = m->list;
+  m->list = r;
+  m->n++;
+  if(kmem.needy)
+    spill(m, m->n);
+  else if(m->n > MAGSIZE)
+    spill(m, MAGBATCH);
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,15 +204,90 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  struct run *r;
+  struct magazine *m;
+  struct run *r, *tail;
+
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      REF(r) = 1;
+    }
+    return (char*)r;
+  }
 
-  if(kmem.use_lock)
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  if(kmem.needy && m->list)
+    spill(m, m->n);
+  if(m->list == 0){
+    // Refill a batch from the global list.
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
+    m->list = take(&kmem.freelist, MAGBATCH, &m->n, &tail);
+    if(m->list == 0)
+      kmem.needy = 1;
     release(&kmem.lock);
+  }
+  r = m->list;
+  if(r){
+    m->list = r->next;
+    m->n--;
+  }
+  popcli();
+  if(r == 0)
+    r = (struct run*)kalloc_zeroed_pool();
+  if(r)
+    REF(r) = 1;
   return (char*)r;
 }
 
+// Take a page from the pre-zeroed pool, or 0 if it is empty.
+static char*
+kalloc_zeroed_pool(void)
+{
+  struct run *r;
+
+  acquire(&kmem.zlock);
+  r = kmem.zeroed;
+  if(r){
+    kmem.zeroed = r->next;
+    kmem.nzeroed--;
+    r->next = 0;  // The link was the only non-zero word
+  }
+  release(&kmem.zlock);
+  return (char*)r;
+}
+
+// Allocate one page filled with zeros, from the pool
+// kzerofill() keeps when it can.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if(kmem.use_lock && (v = kalloc_zeroed_pool()) != 0)
+    return v;
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Called by the scheduler when it has nothing to run:
+// zero one free page into the pool if it is below NZEROED.
+void
+kzerofill(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock || kmem.nzeroed >= NZEROED)
+    return;
+  if((r = (struct run*)kalloc()) == 0)
+    return;
+  memset(r, 0, PGSIZE);
+  acquire(&kmem.zlock);
+  r->next = kmem.zeroed;
+  kmem.zeroed = r;
+  kmem.nzeroed++;
+  release(&kmem.zlock);
+}
+
@@ -0,0 +1,22324 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages, and global
+  # pages so kernel mappings survive cr3 loads (see kmap in vm.c)
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE|CR4_PGE), %eax
+8010000f:	0d 90 00 00 00       	or     $0x90,%eax
+  movl    %eax, %cr4
+80100014:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100017:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001c:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001f:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100022:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100027:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+8010002a:	bc 50 a1 19 80       	mov    $0x8019a150,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002f:	b8 eb 46 10 80       	mov    $0x801046eb,%eax
+  jmp *%eax
+80100034:	ff e0                	jmp    *%eax
+
+80100036 <lookup>:
+static struct buf*
+lookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+80100036:	8b 40 4c             	mov    0x4c(%eax),%eax
+80100039:	eb 03                	jmp    8010003e <lookup+0x8>
+8010003b:	8b 40 74             	mov    0x74(%eax),%eax
+8010003e:	85 c0                	test   %eax,%eax
+80100040:	74 0a                	je     8010004c <lookup+0x16>
+    if(b->dev == dev && b->blockno == blockno)
+80100042:	39 50 04             	cmp    %edx,0x4(%eax)
+80100045:	75 f4                	jne    8010003b <lookup+0x5>
+80100047:	39 48 08             	cmp    %ecx,0x8(%eax)
+8010004a:	75 ef                	jne    8010003b <lookup+0x5>
+      return b;
+  return 0;
+}
+8010004c:	c3                   	ret
+
+8010004d <unhash>:
+static void
+unhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+8010004d:	83 c0 4c             	add    $0x4c,%eax
+80100050:	eb 03                	jmp    80100055 <unhash+0x8>
+80100052:	8d 41 74             	lea    0x74(%ecx),%eax
+80100055:	8b 08                	mov    (%eax),%ecx
+80100057:	39 d1                	cmp    %edx,%ecx
+80100059:	75 f7                	jne    80100052 <unhash+0x5>
+    ;
+  *pp = b->hnext;
+8010005b:	8b 52 74             	mov    0x74(%edx),%edx
+8010005e:	89 10                	mov    %edx,(%eax)
+}
+80100060:	c3                   	ret
+
+80100061 <hash>:
+
+static void
+hash(uint h, struct buf *b)
+{
+80100061:	55                   	push   %ebp
+80100062:	89 e5                	mov    %esp,%ebp
+80100064:	53                   	push   %ebx
+80100065:	89 c1                	mov    %eax,%ecx
+  b->hash = h;
+80100067:	89 42 68             	mov    %eax,0x68(%edx)
+  b->hnext = bcache.bucket[h].head;
+8010006a:	8d 04 85 00 00 00 00 	lea    0x0(,%eax,4),%eax
+80100071:	8d 1c 08             	lea    (%eax,%ecx,1),%ebx
+80100074:	c1 e3 04             	shl    $0x4,%ebx
+80100077:	8b 9b 4c 00 11 80    	mov    -0x7feeffb4(%ebx),%ebx
+8010007d:	89 5a 74             	mov    %ebx,0x74(%edx)
+  bcache.bucket[h].head = b;
+80100080:	01 c8                	add    %ecx,%eax
+80100082:	c1 e0 04             	shl    $0x4,%eax
+80100085:	89 90 4c 00 11 80    	mov    %edx,-0x7feeffb4(%eax)
+}
+8010008b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010008e:	c9                   	leave
+8010008f:	c3                   	ret
+
+80100090 <lock2>:
+}
+
+// Take the locks of buckets a and b in index order.
+static void
+lock2(uint a, uint b)
+{
+80100090:	55                   	push   %ebp
+80100091:	89 e5                	mov    %esp,%ebp
+80100093:	56                   	push   %esi
+80100094:	53                   	push   %ebx
+80100095:	89 c3                	mov    %eax,%ebx
+80100097:	89 d6                	mov    %edx,%esi
+  if(a > b){
+80100099:	39 c2                	cmp    %eax,%edx
+8010009b:	72 34                	jb     801000d1 <lock2+0x41>
+    acquire(&bcache.bucket[b].lock);
+    acquire(&bcache.bucket[a].lock);
+    return;
+  }
+  acquire(&bcache.bucket[a].lock);
+8010009d:	83 ec 0c             	sub    $0xc,%esp
+801000a0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801000a3:	c1 e0 04             	shl    $0x4,%eax
+801000a6:	05 00 00 11 80       	add    $0x80110000,%eax
+801000ab:	50                   	push   %eax
+801000ac:	e8 6c 7b 00 00       	call   80107c1d <acquire>
+  if(b != a)
+801000b1:	83 c4 10             	add    $0x10,%esp
+801000b4:	39 f3                	cmp    %esi,%ebx
+801000b6:	74 43                	je     801000fb <lock2+0x6b>
+    acquire(&bcache.bucket[b].lock);
+801000b8:	83 ec 0c             	sub    $0xc,%esp
+801000bb:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+801000be:	c1 e0 04             	shl    $0x4,%eax
+801000c1:	05 00 00 11 80       	add    $0x80110000,%eax
+801000c6:	50                   	push   %eax
+801000c7:	e8 51 7b 00 00       	call   80107c1d <acquire>
+801000cc:	83 c4 10             	add    $0x10,%esp
+801000cf:	eb 2a                	jmp    801000fb <lock2+0x6b>
+    acquire(&bcache.bucket[b].lock);
+801000d1:	83 ec 0c             	sub    $0xc,%esp
+801000d4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+801000d7:	c1 e0 04             	shl    $0x4,%eax
+801000da:	05 00 00 11 80       	add    $0x80110000,%eax
+801000df:	50                   	push   %eax
+801000e0:	e8 38 7b 00 00       	call   80107c1d <acquire>
+    acquire(&bcache.bucket[a].lock);
+801000e5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+801000e8:	c1 e0 04             	shl    $0x4,%eax
+801000eb:	05 00 00 11 80       	add    $0x80110000,%eax
+801000f0:	89 04 24             	mov    %eax,(%esp)
+801000f3:	e8 25 7b 00 00       	call   80107c1d <acquire>
+    return;
+801000f8:	83 c4 10             	add    $0x10,%esp
+}
+801000fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801000fe:	5b                   	pop    %ebx
+801000ff:	5e                   	pop    %esi
+80100100:	5d                   	pop    %ebp
+80100101:	c3                   	ret
+
+80100102 <unlock2>:
+
+static void
+unlock2(uint a, uint b)
+{
+80100102:	55                   	push   %ebp
+80100103:	89 e5                	mov    %esp,%ebp
+80100105:	56                   	push   %esi
+80100106:	53                   	push   %ebx
+80100107:	89 c3                	mov    %eax,%ebx
+80100109:	89 d6                	mov    %edx,%esi
+  release(&bcache.bucket[a].lock);
+8010010b:	83 ec 0c             	sub    $0xc,%esp
+8010010e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+80100111:	c1 e0 04             	shl    $0x4,%eax
+80100114:	05 00 00 11 80       	add    $0x80110000,%eax
+80100119:	50                   	push   %eax
+8010011a:	e8 7d 7b 00 00       	call   80107c9c <release>
+  if(b != a)
+8010011f:	83 c4 10             	add    $0x10,%esp
+80100122:	39 f3                	cmp    %esi,%ebx
+80100124:	75 07                	jne    8010012d <unlock2+0x2b>
+    release(&bcache.bucket[b].lock);
+}
+80100126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100129:	5b                   	pop    %ebx
+8010012a:	5e                   	pop    %esi
+8010012b:	5d                   	pop    %ebp
+8010012c:	c3                   	ret
+    release(&bcache.bucket[b].lock);
+8010012d:	83 ec 0c             	sub    $0xc,%esp
+80100130:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+80100133:	c1 e0 04             	shl    $0x4,%eax
+80100136:	05 00 00 11 80       	add    $0x80110000,%eax
+8010013b:	50                   	push   %eax
+8010013c:	e8 5b 7b 00 00       	call   80107c9c <release>
+80100141:	83 c4 10             	add    $0x10,%esp
+}
+80100144:	eb e0                	jmp    80100126 <unlock2+0x24>
+
+80100146 <tick>:
+    b = bcache.hand;
+80100146:	8b 15 00 40 12 80    	mov    0x80124000,%edx
+  } while(!__sync_bool_compare_and_swap(&bcache.hand, b, b->next));
+8010014c:	8b 4a 78             	mov    0x78(%edx),%ecx
+8010014f:	89 d0                	mov    %edx,%eax
+80100151:	f0 0f b1 0d 00 40 12 	lock cmpxchg %ecx,0x80124000
+80100158:	80 
+80100159:	75 eb                	jne    80100146 <tick>
+}
+8010015b:	89 d0                	mov    %edx,%eax
+8010015d:	c3                   	ret
+
+8010015e <victim>:
+{
+8010015e:	55                   	push   %ebp
+8010015f:	89 e5                	mov    %esp,%ebp
+80100161:	53                   	push   %ebx
+80100162:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < (METACREDIT+2)*bcache.nbuf; i++){
+80100165:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010016a:	eb 09                	jmp    80100175 <victim+0x17>
+      b->used--;
+8010016c:	83 ea 01             	sub    $0x1,%edx
+8010016f:	89 50 6c             	mov    %edx,0x6c(%eax)
+  for(i = 0; i < (METACREDIT+2)*bcache.nbuf; i++){
+80100172:	83 c3 01             	add    $0x1,%ebx
+80100175:	a1 04 40 12 80       	mov    0x80124004,%eax
+8010017a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+8010017d:	39 d8                	cmp    %ebx,%eax
+8010017f:	7e 1c                	jle    8010019d <victim+0x3f>
+    b = tick();
+80100181:	e8 c0 ff ff ff       	call   80100146 <tick>
+    if(b->refcnt != 0 || (b->flags & B_DIRTY))
+80100186:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+8010018a:	75 e6                	jne    80100172 <victim+0x14>
+8010018c:	f6 00 04             	testb  $0x4,(%eax)
+8010018f:	75 e1                	jne    80100172 <victim+0x14>
+    if(b->used > 0){
+80100191:	8b 50 6c             	mov    0x6c(%eax),%edx
+80100194:	85 d2                	test   %edx,%edx
+80100196:	7f d4                	jg     8010016c <victim+0xe>
+}
+80100198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010019b:	c9                   	leave
+8010019c:	c3                   	ret
+  panic("bget: no buffers");
+8010019d:	83 ec 0c             	sub    $0xc,%esp
+801001a0:	68 40 ad 10 80       	push   $0x8010ad40
+801001a5:	e8 58 07 00 00       	call   80100902 <panic>
+
+801001aa <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+801001aa:	55                   	push   %ebp
+801001ab:	89 e5                	mov    %esp,%ebp
+801001ad:	57                   	push   %edi
+801001ae:	56                   	push   %esi
+801001af:	53                   	push   %ebx
+801001b0:	83 ec 28             	sub    $0x28,%esp
+801001b3:	89 c7                	mov    %eax,%edi
+801001b5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  struct bucket *bk;
+  struct buf *b, *v;
+  uint h, vh;
+
+  h = BHASH(dev, blockno);
+801001b8:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+801001be:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801001c1:	01 d0                	add    %edx,%eax
+801001c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+801001c8:	89 c6                	mov    %eax,%esi
+  bk = &bcache.bucket[h];
+801001ca:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801001cd:	c1 e0 04             	shl    $0x4,%eax
+801001d0:	8d 98 00 00 11 80    	lea    -0x7fef0000(%eax),%ebx
+801001d6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+
+  // Is the block already cached?
+  acquire(&bk->lock);
+801001d9:	53                   	push   %ebx
+801001da:	e8 3e 7a 00 00       	call   80107c1d <acquire>
+  if((b = lookup(bk, dev, blockno)) != 0){
+801001df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801001e2:	89 fa                	mov    %edi,%edx
+801001e4:	89 d8                	mov    %ebx,%eax
+801001e6:	e8 4b fe ff ff       	call   80100036 <lookup>
+801001eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801001ee:	83 c4 10             	add    $0x10,%esp
+801001f1:	85 c0                	test   %eax,%eax
+801001f3:	74 32                	je     80100227 <bget+0x7d>
+801001f5:	89 c1                	mov    %eax,%ecx
+    b->refcnt++;
+801001f7:	89 c6                	mov    %eax,%esi
+801001f9:	8b 40 64             	mov    0x64(%eax),%eax
+801001fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801001ff:	83 c0 01             	add    $0x1,%eax
+80100202:	89 41 64             	mov    %eax,0x64(%ecx)
+    release(&bk->lock);
+80100205:	83 ec 0c             	sub    $0xc,%esp
+80100208:	53                   	push   %ebx
+80100209:	e8 8e 7a 00 00       	call   80107c9c <release>
+    acquiresleep(&b->lock);
+8010020e:	8d 46 0c             	lea    0xc(%esi),%eax
+80100211:	89 04 24             	mov    %eax,(%esp)
+80100214:	e8 e1 77 00 00       	call   801079fa <acquiresleep>
+    return b;
+80100219:	83 c4 10             	add    $0x10,%esp
+      acquiresleep(&v->lock);
+      return v;
+    }
+    unlock2(h, vh);
+  }
+}
+8010021c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010021f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100222:	5b                   	pop    %ebx
+80100223:	5e                   	pop    %esi
+80100224:	5f                   	pop    %edi
+80100225:	5d                   	pop    %ebp
+80100226:	c3                   	ret
+  release(&bk->lock);
+80100227:	83 ec 0c             	sub    $0xc,%esp
+8010022a:	ff 75 e0             	push   -0x20(%ebp)
+8010022d:	e8 6a 7a 00 00       	call   80107c9c <release>
+80100232:	83 c4 10             	add    $0x10,%esp
+80100235:	eb 3e                	jmp    80100275 <bget+0xcb>
+      b->refcnt++;
+80100237:	89 c3                	mov    %eax,%ebx
+80100239:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010023c:	8b 40 64             	mov    0x64(%eax),%eax
+8010023f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100242:	83 c0 01             	add    $0x1,%eax
+80100245:	89 43 64             	mov    %eax,0x64(%ebx)
+      unlock2(h, vh);
+80100248:	89 fa                	mov    %edi,%edx
+8010024a:	89 f0                	mov    %esi,%eax
+8010024c:	e8 b1 fe ff ff       	call   80100102 <unlock2>
+      acquiresleep(&b->lock);
+80100251:	83 ec 0c             	sub    $0xc,%esp
+80100254:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100257:	50                   	push   %eax
+80100258:	e8 9d 77 00 00       	call   801079fa <acquiresleep>
+      return b;
+8010025d:	83 c4 10             	add    $0x10,%esp
+80100260:	eb ba                	jmp    8010021c <bget+0x72>
+        __sync_fetch_and_add(&bcache.st.evictions, 1);
+80100262:	f0 83 05 2c 40 12 80 	lock addl $0x1,0x8012402c
+80100269:	01 
+8010026a:	eb 56                	jmp    801002c2 <bget+0x118>
+    unlock2(h, vh);
+8010026c:	89 fa                	mov    %edi,%edx
+8010026e:	89 f0                	mov    %esi,%eax
+80100270:	e8 8d fe ff ff       	call   80100102 <unlock2>
+    v = victim();
+80100275:	e8 e4 fe ff ff       	call   8010015e <victim>
+8010027a:	89 c3                	mov    %eax,%ebx
+    vh = v->hash;
+8010027c:	8b 78 68             	mov    0x68(%eax),%edi
+    lock2(h, vh);
+8010027f:	89 fa                	mov    %edi,%edx
+80100281:	89 f0                	mov    %esi,%eax
+80100283:	e8 08 fe ff ff       	call   80100090 <lock2>
+    if((b = lookup(bk, dev, blockno)) != 0){
+80100288:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010028b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010028e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100291:	e8 a0 fd ff ff       	call   80100036 <lookup>
+80100296:	85 c0                	test   %eax,%eax
+80100298:	75 9d                	jne    80100237 <bget+0x8d>
+    if(v->hash == vh && v->refcnt == 0 && (v->flags & B_DIRTY) == 0){
+8010029a:	39 7b 68             	cmp    %edi,0x68(%ebx)
+8010029d:	75 cd                	jne    8010026c <bget+0xc2>
+8010029f:	83 7b 64 00          	cmpl   $0x0,0x64(%ebx)
+801002a3:	75 c7                	jne    8010026c <bget+0xc2>
+801002a5:	f6 03 04             	testb  $0x4,(%ebx)
+801002a8:	75 c2                	jne    8010026c <bget+0xc2>
+      unhash(&bcache.bucket[vh], v);
+801002aa:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+801002ad:	c1 e0 04             	shl    $0x4,%eax
+801002b0:	05 00 00 11 80       	add    $0x80110000,%eax
+801002b5:	89 da                	mov    %ebx,%edx
+801002b7:	e8 91 fd ff ff       	call   8010004d <unhash>
+      if(v->dev != NODEV)
+801002bc:	83 7b 04 ff          	cmpl   $0xffffffff,0x4(%ebx)
+801002c0:	75 a0                	jne    80100262 <bget+0xb8>
+      v->dev = dev;
+801002c2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801002c5:	89 43 04             	mov    %eax,0x4(%ebx)
+      v->blockno = blockno;
+801002c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801002cb:	89 43 08             	mov    %eax,0x8(%ebx)
+      v->flags = 0;
+801002ce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      v->refcnt = 1;
+801002d4:	c7 43 64 01 00 00 00 	movl   $0x1,0x64(%ebx)
+      v->used = 0;
+801002db:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+      v->meta = 0;
+801002e2:	c7 43 70 00 00 00 00 	movl   $0x0,0x70(%ebx)
+      hash(h, v);
+801002e9:	89 da                	mov    %ebx,%edx
+801002eb:	89 f0                	mov    %esi,%eax
+801002ed:	e8 6f fd ff ff       	call   80100061 <hash>
+      unlock2(h, vh);
+801002f2:	89 fa                	mov    %edi,%edx
+801002f4:	89 f0                	mov    %esi,%eax
+801002f6:	e8 07 fe ff ff       	call   80100102 <unlock2>
+      acquiresleep(&v->lock);
+801002fb:	83 ec 0c             	sub    $0xc,%esp
+801002fe:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100301:	50                   	push   %eax
+80100302:	e8 f3 76 00 00       	call   801079fa <acquiresleep>
+      return v;
+80100307:	83 c4 10             	add    $0x10,%esp
+8010030a:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+8010030d:	e9 0a ff ff ff       	jmp    8010021c <bget+0x72>
+
+80100312 <bread1>:
+
+static struct buf*
+bread1(uint dev, uint blockno, int meta)
+{
+80100312:	55                   	push   %ebp
+80100313:	89 e5                	mov    %esp,%ebp
+80100315:	56                   	push   %esi
+80100316:	53                   	push   %ebx
+80100317:	89 ce                	mov    %ecx,%esi
+  struct buf *b;
+  int prefetched;
+
+  b = bget(dev, blockno);
+80100319:	e8 8c fe ff ff       	call   801001aa <bget>
+8010031e:	89 c3                	mov    %eax,%ebx
+  if(meta)
+80100320:	85 f6                	test   %esi,%esi
+80100322:	74 07                	je     8010032b <bread1+0x19>
+    b->meta = 1;
+80100324:	c7 40 70 01 00 00 00 	movl   $0x1,0x70(%eax)
+  // The first read of a block read ahead is no reuse: it earns
+  // no credit, so a sequential scan only recycles its own
+  // buffers, and it was already counted under prefetches.
+  prefetched = b->flags & B_PREFETCHED;
+8010032b:	8b 03                	mov    (%ebx),%eax
+8010032d:	89 c1                	mov    %eax,%ecx
+8010032f:	83 e1 10             	and    $0x10,%ecx
+  b->flags &= ~B_PREFETCHED;
+80100332:	89 c2                	mov    %eax,%edx
+80100334:	83 e2 ef             	and    $0xffffffef,%edx
+80100337:	89 13                	mov    %edx,(%ebx)
+  if((b->flags & B_VALID) == 0) {
+80100339:	a8 02                	test   $0x2,%al
+8010033b:	75 34                	jne    80100371 <bread1+0x5f>
+    __sync_fetch_and_add(meta ? &bcache.st.metamisses : &bcache.st.misses, 1);
+8010033d:	85 f6                	test   %esi,%esi
+8010033f:	74 29                	je     8010036a <bread1+0x58>
+80100341:	b8 28 40 12 80       	mov    $0x80124028,%eax
+80100346:	f0 83 00 01          	lock addl $0x1,(%eax)
+    iderw(b);
+8010034a:	83 ec 0c             	sub    $0xc,%esp
+8010034d:	53                   	push   %ebx
+8010034e:	e8 02 2e 00 00       	call   80103155 <iderw>
+80100353:	83 c4 10             	add    $0x10,%esp
+  } else if(!prefetched){
+    __sync_fetch_and_add(meta ? &bcache.st.metahits : &bcache.st.hits, 1);
+    b->used = b->meta ? METACREDIT : 1;
+  }
+  if(meta)
+80100356:	85 f6                	test   %esi,%esi
+80100358:	74 07                	je     80100361 <bread1+0x4f>
+    b->used = METACREDIT;
+8010035a:	c7 43 6c 03 00 00 00 	movl   $0x3,0x6c(%ebx)
+  return b;
+}
+80100361:	89 d8                	mov    %ebx,%eax
+80100363:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100366:	5b                   	pop    %ebx
+80100367:	5e                   	pop    %esi
+80100368:	5d                   	pop    %ebp
+80100369:	c3                   	ret
+    __sync_fetch_and_add(meta ? &bcache.st.metamisses : &bcache.st.misses, 1);
+8010036a:	b8 20 40 12 80       	mov    $0x80124020,%eax
+8010036f:	eb d5                	jmp    80100346 <bread1+0x34>
+  } else if(!prefetched){
+80100371:	85 c9                	test   %ecx,%ecx
+80100373:	75 e1                	jne    80100356 <bread1+0x44>
+    __sync_fetch_and_add(meta ? &bcache.st.metahits : &bcache.st.hits, 1);
+80100375:	85 f6                	test   %esi,%esi
+80100377:	74 19                	je     80100392 <bread1+0x80>
+80100379:	b8 24 40 12 80       	mov    $0x80124024,%eax
+8010037e:	f0 83 00 01          	lock addl $0x1,(%eax)
+    b->used = b->meta ? METACREDIT : 1;
+80100382:	83 7b 70 00          	cmpl   $0x0,0x70(%ebx)
+80100386:	74 11                	je     80100399 <bread1+0x87>
+80100388:	b8 03 00 00 00       	mov    $0x3,%eax
+8010038d:	89 43 6c             	mov    %eax,0x6c(%ebx)
+80100390:	eb c4                	jmp    80100356 <bread1+0x44>
+    __sync_fetch_and_add(meta ? &bcache.st.metahits : &bcache.st.hits, 1);
+80100392:	b8 1c 40 12 80       	mov    $0x8012401c,%eax
+80100397:	eb e5                	jmp    8010037e <bread1+0x6c>
+    b->used = b->meta ? METACREDIT : 1;
+80100399:	b8 01 00 00 00       	mov    $0x1,%eax
+8010039e:	eb ed                	jmp    8010038d <bread1+0x7b>
+
+801003a0 <binit>:
+{
+801003a0:	55                   	push   %ebp
+801003a1:	89 e5                	mov    %esp,%ebp
+801003a3:	57                   	push   %edi
+801003a4:	56                   	push   %esi
+801003a5:	53                   	push   %ebx
+801003a6:	83 ec 1c             	sub    $0x1c,%esp
+  for(i = 0; i < NBHASH; i++)
+801003a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+801003ae:	eb 1f                	jmp    801003cf <binit+0x2f>
+    initlock(&bcache.bucket[i].lock, "bcache");
+801003b0:	83 ec 08             	sub    $0x8,%esp
+801003b3:	68 51 ad 10 80       	push   $0x8010ad51
+801003b8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+801003bb:	c1 e0 04             	shl    $0x4,%eax
+801003be:	05 00 00 11 80       	add    $0x80110000,%eax
+801003c3:	50                   	push   %eax
+801003c4:	e8 09 77 00 00       	call   80107ad2 <initlock>
+  for(i = 0; i < NBHASH; i++)
+801003c9:	83 c3 01             	add    $0x1,%ebx
+801003cc:	83 c4 10             	add    $0x10,%esp
+801003cf:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+801003d5:	7e d9                	jle    801003b0 <binit+0x10>
+  n = kpages() * (PGSIZE / BSIZE) / 8;
+801003d7:	e8 ca 30 00 00       	call   801034a6 <kpages>
+801003dc:	89 c1                	mov    %eax,%ecx
+  if(n < NBUF)
+801003de:	83 f8 1d             	cmp    $0x1d,%eax
+801003e1:	7e 0e                	jle    801003f1 <binit+0x51>
+  if(n > MAXNBUF)
+801003e3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+801003e8:	7e 0c                	jle    801003f6 <binit+0x56>
+    n = MAXNBUF;
+801003ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801003ef:	eb 05                	jmp    801003f6 <binit+0x56>
+    n = NBUF;
+801003f1:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  for(i = 0; i < n; i++){
+801003f6:	be 00 00 00 00       	mov    $0x0,%esi
+  page = 0;
+801003fb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  last = 0;
+80100402:	bf 00 00 00 00       	mov    $0x0,%edi
+80100407:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  for(i = 0; i < n; i++){
+8010040a:	eb 4b                	jmp    80100457 <binit+0xb7>
+    b = (struct buf*)page + i % per;
+8010040c:	8d 1c 9b             	lea    (%ebx,%ebx,4),%ebx
+8010040f:	c1 e3 07             	shl    $0x7,%ebx
+80100412:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100415:	01 c3                	add    %eax,%ebx
+    b->dev = NODEV;
+80100417:	c7 43 04 ff ff ff ff 	movl   $0xffffffff,0x4(%ebx)
+    b->blockno = i;
+8010041e:	89 73 08             	mov    %esi,0x8(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100421:	83 ec 08             	sub    $0x8,%esp
+80100424:	68 58 ad 10 80       	push   $0x8010ad58
+80100429:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010042c:	50                   	push   %eax
+8010042d:	e8 95 75 00 00       	call   801079c7 <initsleeplock>
+    hash(BHASH(b->dev, b->blockno), b);
+80100432:	69 43 04 b1 79 37 9e 	imul   $0x9e3779b1,0x4(%ebx),%eax
+80100439:	03 43 08             	add    0x8(%ebx),%eax
+8010043c:	25 ff 03 00 00       	and    $0x3ff,%eax
+80100441:	89 da                	mov    %ebx,%edx
+80100443:	e8 19 fc ff ff       	call   80100061 <hash>
+    if(last)
+80100448:	83 c4 10             	add    $0x10,%esp
+8010044b:	85 ff                	test   %edi,%edi
+8010044d:	74 53                	je     801004a2 <binit+0x102>
+      last->next = b;
+8010044f:	89 5f 78             	mov    %ebx,0x78(%edi)
+  for(i = 0; i < n; i++){
+80100452:	83 c6 01             	add    $0x1,%esi
+    last = b;
+80100455:	89 df                	mov    %ebx,%edi
+  for(i = 0; i < n; i++){
+80100457:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010045a:	39 c6                	cmp    %eax,%esi
+8010045c:	7d 29                	jge    80100487 <binit+0xe7>
+    if(i % per == 0 && (page = kalloc_zeroed()) == 0)
+8010045e:	bb ab aa aa 2a       	mov    $0x2aaaaaab,%ebx
+80100463:	89 f0                	mov    %esi,%eax
+80100465:	f7 eb                	imul   %ebx
+80100467:	89 d3                	mov    %edx,%ebx
+80100469:	89 f0                	mov    %esi,%eax
+8010046b:	c1 f8 1f             	sar    $0x1f,%eax
+8010046e:	29 c3                	sub    %eax,%ebx
+80100470:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+80100473:	01 c0                	add    %eax,%eax
+80100475:	89 f3                	mov    %esi,%ebx
+80100477:	29 c3                	sub    %eax,%ebx
+80100479:	75 91                	jne    8010040c <binit+0x6c>
+8010047b:	e8 f1 33 00 00       	call   80103871 <kalloc_zeroed>
+80100480:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100483:	85 c0                	test   %eax,%eax
+80100485:	75 85                	jne    8010040c <binit+0x6c>
+  if(i < NBUF)
+80100487:	83 fe 1d             	cmp    $0x1d,%esi
+8010048a:	7e 1e                	jle    801004aa <binit+0x10a>
+  last->next = bcache.hand;
+8010048c:	a1 00 40 12 80       	mov    0x80124000,%eax
+80100491:	89 47 78             	mov    %eax,0x78(%edi)
+  bcache.nbuf = i;
+80100494:	89 35 04 40 12 80    	mov    %esi,0x80124004
+}
+8010049a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010049d:	5b                   	pop    %ebx
+8010049e:	5e                   	pop    %esi
+8010049f:	5f                   	pop    %edi
+801004a0:	5d                   	pop    %ebp
+801004a1:	c3                   	ret
+      bcache.hand = b;
+801004a2:	89 1d 00 40 12 80    	mov    %ebx,0x80124000
+801004a8:	eb a8                	jmp    80100452 <binit+0xb2>
+    panic("binit");
+801004aa:	83 ec 0c             	sub    $0xc,%esp
+801004ad:	68 5f ad 10 80       	push   $0x8010ad5f
+801004b2:	e8 4b 04 00 00       	call   80100902 <panic>
+
+801004b7 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801004b7:	55                   	push   %ebp
+801004b8:	89 e5                	mov    %esp,%ebp
+801004ba:	83 ec 08             	sub    $0x8,%esp
+  return bread1(dev, blockno, 0);
+801004bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+801004c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+801004c5:	8b 45 08             	mov    0x8(%ebp),%eax
+801004c8:	e8 45 fe ff ff       	call   80100312 <bread1>
+}
+801004cd:	c9                   	leave
+801004ce:	c3                   	ret
+
+801004cf <breadmeta>:
+
+// Like bread, for blocks of file system metadata,
+// which the cache keeps in preference to file data.
+struct buf*
+breadmeta(uint dev, uint blockno)
+{
+801004cf:	55                   	push   %ebp
+801004d0:	89 e5                	mov    %esp,%ebp
+801004d2:	83 ec 08             	sub    $0x8,%esp
+  return bread1(dev, blockno, 1);
+801004d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+801004da:	8b 55 0c             	mov    0xc(%ebp),%edx
+801004dd:	8b 45 08             	mov    0x8(%ebp),%eax
+801004e0:	e8 2d fe ff ff       	call   80100312 <bread1>
+}
+801004e5:	c9                   	leave
+801004e6:	c3                   	ret
+
+801004e7 <bwrite>:
+}
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801004e7:	55                   	push   %ebp
+801004e8:	89 e5                	mov    %esp,%ebp
+801004ea:	53                   	push   %ebx
+801004eb:	83 ec 10             	sub    $0x10,%esp
+801004ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801004f1:	8d 43 0c             	lea    0xc(%ebx),%eax
+801004f4:	50                   	push   %eax
+801004f5:	e8 8a 75 00 00       	call   80107a84 <holdingsleep>
+801004fa:	83 c4 10             	add    $0x10,%esp
+801004fd:	85 c0                	test   %eax,%eax
+801004ff:	74 18                	je     80100519 <bwrite+0x32>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+80100501:	8b 03                	mov    (%ebx),%eax
+80100503:	83 c8 04             	or     $0x4,%eax
+80100506:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+80100508:	83 ec 0c             	sub    $0xc,%esp
+8010050b:	53                   	push   %ebx
+8010050c:	e8 44 2c 00 00       	call   80103155 <iderw>
+}
+80100511:	83 c4 10             	add    $0x10,%esp
+80100514:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100517:	c9                   	leave
+80100518:	c3                   	ret
+    panic("bwrite");
+80100519:	83 ec 0c             	sub    $0xc,%esp
+8010051c:	68 65 ad 10 80       	push   $0x8010ad65
+80100521:	e8 dc 03 00 00       	call   80100902 <panic>
+
+80100526 <bawrite>:
+
+// Start writing b to disk and release it; the disk driver
+// completes the write in the background.
+void
+bawrite(struct buf *b)
+{
+80100526:	55                   	push   %ebp
+80100527:	89 e5                	mov    %esp,%ebp
+80100529:	53                   	push   %ebx
+8010052a:	83 ec 10             	sub    $0x10,%esp
+8010052d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100530:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100533:	50                   	push   %eax
+80100534:	e8 4b 75 00 00       	call   80107a84 <holdingsleep>
+80100539:	83 c4 10             	add    $0x10,%esp
+8010053c:	85 c0                	test   %eax,%eax
+8010053e:	74 18                	je     80100558 <bawrite+0x32>
+    panic("bawrite");
+  b->flags |= B_DIRTY;
+80100540:	8b 03                	mov    (%ebx),%eax
+80100542:	83 c8 04             	or     $0x4,%eax
+80100545:	89 03                	mov    %eax,(%ebx)
+  idesubmit(b);
+80100547:	83 ec 0c             	sub    $0xc,%esp
+8010054a:	53                   	push   %ebx
+8010054b:	e8 63 2c 00 00       	call   801031b3 <idesubmit>
+}
+80100550:	83 c4 10             	add    $0x10,%esp
+80100553:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100556:	c9                   	leave
+80100557:	c3                   	ret
+    panic("bawrite");
+80100558:	83 ec 0c             	sub    $0xc,%esp
+8010055b:	68 6c ad 10 80       	push   $0x8010ad6c
+80100560:	e8 9d 03 00 00       	call   80100902 <panic>
+
+80100565 <bwritev>:
+
+// Write the contents of n locked buffers to disk as one batch,
+// which the disk driver can merge into fewer requests.
+void
+bwritev(struct buf **b, int n)
+{
+80100565:	55                   	push   %ebp
+80100566:	89 e5                	mov    %esp,%ebp
+80100568:	57                   	push   %edi
+80100569:	56                   	push   %esi
+8010056a:	53                   	push   %ebx
+8010056b:	83 ec 0c             	sub    $0xc,%esp
+8010056e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++){
+80100571:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100576:	39 fb                	cmp    %edi,%ebx
+80100578:	7d 36                	jge    801005b0 <bwritev+0x4b>
+    if(!holdingsleep(&b[i]->lock))
+8010057a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010057d:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+80100580:	83 ec 0c             	sub    $0xc,%esp
+80100583:	8b 06                	mov    (%esi),%eax
+80100585:	83 c0 0c             	add    $0xc,%eax
+80100588:	50                   	push   %eax
+80100589:	e8 f6 74 00 00       	call   80107a84 <holdingsleep>
+8010058e:	83 c4 10             	add    $0x10,%esp
+80100591:	85 c0                	test   %eax,%eax
+80100593:	74 0e                	je     801005a3 <bwritev+0x3e>
+      panic("bwritev");
+    b[i]->flags |= B_DIRTY;
+80100595:	8b 16                	mov    (%esi),%edx
+80100597:	8b 02                	mov    (%edx),%eax
+80100599:	83 c8 04             	or     $0x4,%eax
+8010059c:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < n; i++){
+8010059e:	83 c3 01             	add    $0x1,%ebx
+801005a1:	eb d3                	jmp    80100576 <bwritev+0x11>
+      panic("bwritev");
+801005a3:	83 ec 0c             	sub    $0xc,%esp
+801005a6:	68 74 ad 10 80       	push   $0x8010ad74
+801005ab:	e8 52 03 00 00       	call   80100902 <panic>
+  }
+  iderwv(b, n);
+801005b0:	83 ec 08             	sub    $0x8,%esp
+801005b3:	57                   	push   %edi
+801005b4:	ff 75 08             	push   0x8(%ebp)
+801005b7:	e8 41 2c 00 00       	call   801031fd <iderwv>
+}
+801005bc:	83 c4 10             	add    $0x10,%esp
+801005bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801005c2:	5b                   	pop    %ebx
+801005c3:	5e                   	pop    %esi
+801005c4:	5f                   	pop    %edi
+801005c5:	5d                   	pop    %ebp
+801005c6:	c3                   	ret
+
+801005c7 <bdone>:
+// Release a locked buffer on behalf of whichever process
+// locked it. The disk driver calls this when a read started
+// by bprefetch completes.
+void
+bdone(struct buf *b)
+{
+801005c7:	55                   	push   %ebp
+801005c8:	89 e5                	mov    %esp,%ebp
+801005ca:	56                   	push   %esi
+801005cb:	53                   	push   %ebx
+801005cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct bucket *bk;
+
+  releasesleep(&b->lock);
+801005cf:	83 ec 0c             	sub    $0xc,%esp
+801005d2:	8d 46 0c             	lea    0xc(%esi),%eax
+801005d5:	50                   	push   %eax
+801005d6:	e8 6e 74 00 00       	call   80107a49 <releasesleep>
+
+  // b cannot move to another bucket while we hold a reference.
+  bk = &bcache.bucket[b->hash];
+801005db:	8b 46 68             	mov    0x68(%esi),%eax
+  acquire(&bk->lock);
+801005de:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801005e1:	c1 e0 04             	shl    $0x4,%eax
+801005e4:	89 c3                	mov    %eax,%ebx
+801005e6:	81 c3 00 00 11 80    	add    $0x80110000,%ebx
+801005ec:	89 1c 24             	mov    %ebx,(%esp)
+801005ef:	e8 29 76 00 00       	call   80107c1d <acquire>
+  b->refcnt--;
+801005f4:	8b 46 64             	mov    0x64(%esi),%eax
+801005f7:	83 e8 01             	sub    $0x1,%eax
+801005fa:	89 46 64             	mov    %eax,0x64(%esi)
+  release(&bk->lock);
+801005fd:	89 1c 24             	mov    %ebx,(%esp)
+80100600:	e8 97 76 00 00       	call   80107c9c <release>
+}
+80100605:	83 c4 10             	add    $0x10,%esp
+80100608:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010060b:	5b                   	pop    %ebx
+8010060c:	5e                   	pop    %esi
+8010060d:	5d                   	pop    %ebp
+8010060e:	c3                   	ret
+
+8010060f <brelse>:
+{
+8010060f:	55                   	push   %ebp
+80100610:	89 e5                	mov    %esp,%ebp
+80100612:	53                   	push   %ebx
+80100613:	83 ec 10             	sub    $0x10,%esp
+80100616:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100619:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010061c:	50                   	push   %eax
+8010061d:	e8 62 74 00 00       	call   80107a84 <holdingsleep>
+80100622:	83 c4 10             	add    $0x10,%esp
+80100625:	85 c0                	test   %eax,%eax
+80100627:	74 11                	je     8010063a <brelse+0x2b>
+  bdone(b);
+80100629:	83 ec 0c             	sub    $0xc,%esp
+8010062c:	53                   	push   %ebx
+8010062d:	e8 95 ff ff ff       	call   801005c7 <bdone>
+}
+80100632:	83 c4 10             	add    $0x10,%esp
+80100635:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100638:	c9                   	leave
+80100639:	c3                   	ret
+    panic("brelse");
+8010063a:	83 ec 0c             	sub    $0xc,%esp
+8010063d:	68 7c ad 10 80       	push   $0x8010ad7c
+80100642:	e8 bb 02 00 00       	call   80100902 <panic>
+
+80100647 <bprefetch>:
+{
+80100647:	55                   	push   %ebp
+80100648:	89 e5                	mov    %esp,%ebp
+8010064a:	57                   	push   %edi
+8010064b:	56                   	push   %esi
+8010064c:	53                   	push   %ebx
+8010064d:	83 ec 18             	sub    $0x18,%esp
+80100650:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+80100653:	69 45 08 b1 79 37 9e 	imul   $0x9e3779b1,0x8(%ebp),%eax
+8010065a:	01 f8                	add    %edi,%eax
+8010065c:	25 ff 03 00 00       	and    $0x3ff,%eax
+80100661:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+80100668:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010066b:	c1 e6 04             	shl    $0x4,%esi
+8010066e:	81 c6 00 00 11 80    	add    $0x80110000,%esi
+  acquire(&bk->lock);
+80100674:	89 f3                	mov    %esi,%ebx
+80100676:	56                   	push   %esi
+80100677:	e8 a1 75 00 00       	call   80107c1d <acquire>
+  b = lookup(bk, dev, blockno);
+8010067c:	89 f9                	mov    %edi,%ecx
+8010067e:	8b 55 08             	mov    0x8(%ebp),%edx
+80100681:	89 f0                	mov    %esi,%eax
+80100683:	e8 ae f9 ff ff       	call   80100036 <lookup>
+80100688:	89 c6                	mov    %eax,%esi
+  release(&bk->lock);
+8010068a:	89 1c 24             	mov    %ebx,(%esp)
+8010068d:	e8 0a 76 00 00       	call   80107c9c <release>
+  if(b)
+80100692:	83 c4 10             	add    $0x10,%esp
+80100695:	85 f6                	test   %esi,%esi
+80100697:	74 08                	je     801006a1 <bprefetch+0x5a>
+}
+80100699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010069c:	5b                   	pop    %ebx
+8010069d:	5e                   	pop    %esi
+8010069e:	5f                   	pop    %edi
+8010069f:	5d                   	pop    %ebp
+801006a0:	c3                   	ret
+  b = bget(dev, blockno);
+801006a1:	89 fa                	mov    %edi,%edx
+801006a3:	8b 45 08             	mov    0x8(%ebp),%eax
+801006a6:	e8 ff fa ff ff       	call   801001aa <bget>
+  if(b->flags & B_VALID){
+801006ab:	f6 00 02             	testb  $0x2,(%eax)
+801006ae:	75 1d                	jne    801006cd <bprefetch+0x86>
+  __sync_fetch_and_add(&bcache.st.prefetches, 1);
+801006b0:	f0 83 05 30 40 12 80 	lock addl $0x1,0x80124030
+801006b7:	01 
+  b->flags |= B_PREFETCHED;
+801006b8:	8b 10                	mov    (%eax),%edx
+801006ba:	83 ca 10             	or     $0x10,%edx
+801006bd:	89 10                	mov    %edx,(%eax)
+  idesubmit(b);
+801006bf:	83 ec 0c             	sub    $0xc,%esp
+801006c2:	50                   	push   %eax
+801006c3:	e8 eb 2a 00 00       	call   801031b3 <idesubmit>
+801006c8:	83 c4 10             	add    $0x10,%esp
+801006cb:	eb cc                	jmp    80100699 <bprefetch+0x52>
+    brelse(b);
+801006cd:	83 ec 0c             	sub    $0xc,%esp
+801006d0:	50                   	push   %eax
+801006d1:	e8 39 ff ff ff       	call   8010060f <brelse>
+    return;
+801006d6:	83 c4 10             	add    $0x10,%esp
+801006d9:	eb be                	jmp    80100699 <bprefetch+0x52>
+
+801006db <bpin>:
+
+// Take an extra reference to b, keeping it in the cache.
+void
+bpin(struct buf *b)
+{
+801006db:	55                   	push   %ebp
+801006dc:	89 e5                	mov    %esp,%ebp
+801006de:	56                   	push   %esi
+801006df:	53                   	push   %ebx
+801006e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct bucket *bk = &bcache.bucket[b->hash];
+801006e3:	8b 46 68             	mov    0x68(%esi),%eax
+
+  acquire(&bk->lock);
+801006e6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801006e9:	c1 e0 04             	shl    $0x4,%eax
+801006ec:	89 c3                	mov    %eax,%ebx
+801006ee:	81 c3 00 00 11 80    	add    $0x80110000,%ebx
+801006f4:	83 ec 0c             	sub    $0xc,%esp
+801006f7:	53                   	push   %ebx
+801006f8:	e8 20 75 00 00       	call   80107c1d <acquire>
+  b->refcnt++;
+801006fd:	8b 46 64             	mov    0x64(%esi),%eax
+80100700:	83 c0 01             	add    $0x1,%eax
+80100703:	89 46 64             	mov    %eax,0x64(%esi)
+  release(&bk->lock);
+80100706:	89 1c 24             	mov    %ebx,(%esp)
+80100709:	e8 8e 75 00 00       	call   80107c9c <release>
+}
+8010070e:	83 c4 10             	add    $0x10,%esp
+80100711:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100714:	5b                   	pop    %ebx
+80100715:	5e                   	pop    %esi
+80100716:	5d                   	pop    %ebp
+80100717:	c3                   	ret
+
+80100718 <bunpin>:
+
+void
+bunpin(struct buf *b)
+{
+80100718:	55                   	push   %ebp
+80100719:	89 e5                	mov    %esp,%ebp
+8010071b:	56                   	push   %esi
+8010071c:	53                   	push   %ebx
+8010071d:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct bucket *bk = &bcache.bucket[b->hash];
+80100720:	8b 46 68             	mov    0x68(%esi),%eax
+
+  acquire(&bk->lock);
+80100723:	8d 04 80             	lea    (%eax,%eax,4),%eax
+80100726:	c1 e0 04             	shl    $0x4,%eax
+80100729:	89 c3                	mov    %eax,%ebx
+8010072b:	81 c3 00 00 11 80    	add    $0x80110000,%ebx
+80100731:	83 ec 0c             	sub    $0xc,%esp
+80100734:	53                   	push   %ebx
+80100735:	e8 e3 74 00 00       	call   80107c1d <acquire>
+  b->refcnt--;
+8010073a:	8b 46 64             	mov    0x64(%esi),%eax
+8010073d:	83 e8 01             	sub    $0x1,%eax
+80100740:	89 46 64             	mov    %eax,0x64(%esi)
+  release(&bk->lock);
+80100743:	89 1c 24             	mov    %ebx,(%esp)
+80100746:	e8 51 75 00 00       	call   80107c9c <release>
+}
+8010074b:	83 c4 10             	add    $0x10,%esp
+8010074e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100751:	5b                   	pop    %ebx
+80100752:	5e                   	pop    %esi
+80100753:	5d                   	pop    %ebp
+80100754:	c3                   	ret
+
+80100755 <getbstat>:
+
+// Copy the buffer cache statistics to st and,
+// if reset is set, clear the counters.
+int
+getbstat(struct bstat *st, int reset)
+{
+80100755:	55                   	push   %ebp
+80100756:	89 e5                	mov    %esp,%ebp
+80100758:	53                   	push   %ebx
+80100759:	83 ec 08             	sub    $0x8,%esp
+8010075c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bcache.st.nbuf = bcache.nbuf;
+8010075f:	a1 04 40 12 80       	mov    0x80124004,%eax
+80100764:	a3 18 40 12 80       	mov    %eax,0x80124018
+  safestrcpy(bcache.st.policy, "clock-2q", sizeof(bcache.st.policy));
+80100769:	6a 10                	push   $0x10
+8010076b:	68 83 ad 10 80       	push   $0x8010ad83
+80100770:	68 08 40 12 80       	push   $0x80124008
+80100775:	e8 e9 76 00 00       	call   80107e63 <safestrcpy>
+  *st = bcache.st;
+8010077a:	a1 08 40 12 80       	mov    0x80124008,%eax
+8010077f:	89 03                	mov    %eax,(%ebx)
+80100781:	a1 0c 40 12 80       	mov    0x8012400c,%eax
+80100786:	89 43 04             	mov    %eax,0x4(%ebx)
+80100789:	a1 10 40 12 80       	mov    0x80124010,%eax
+8010078e:	89 43 08             	mov    %eax,0x8(%ebx)
+80100791:	a1 14 40 12 80       	mov    0x80124014,%eax
+80100796:	89 43 0c             	mov    %eax,0xc(%ebx)
+80100799:	a1 18 40 12 80       	mov    0x80124018,%eax
+8010079e:	89 43 10             	mov    %eax,0x10(%ebx)
+801007a1:	a1 1c 40 12 80       	mov    0x8012401c,%eax
+801007a6:	89 43 14             	mov    %eax,0x14(%ebx)
+801007a9:	a1 20 40 12 80       	mov    0x80124020,%eax
+801007ae:	89 43 18             	mov    %eax,0x18(%ebx)
+801007b1:	a1 24 40 12 80       	mov    0x80124024,%eax
+801007b6:	89 43 1c             	mov    %eax,0x1c(%ebx)
+801007b9:	a1 28 40 12 80       	mov    0x80124028,%eax
+801007be:	89 43 20             	mov    %eax,0x20(%ebx)
+801007c1:	a1 2c 40 12 80       	mov    0x8012402c,%eax
+801007c6:	89 43 24             	mov    %eax,0x24(%ebx)
+801007c9:	a1 30 40 12 80       	mov    0x80124030,%eax
+801007ce:	89 43 28             	mov    %eax,0x28(%ebx)
+  if(reset){
+801007d1:	83 c4 10             	add    $0x10,%esp
+801007d4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801007d8:	74 3c                	je     80100816 <getbstat+0xc1>
+    bcache.st.hits = bcache.st.misses = 0;
+801007da:	c7 05 20 40 12 80 00 	movl   $0x0,0x80124020
+801007e1:	00 00 00 
+801007e4:	c7 05 1c 40 12 80 00 	movl   $0x0,0x8012401c
+801007eb:	00 00 00 
+    bcache.st.metahits = bcache.st.metamisses = 0;
+801007ee:	c7 05 28 40 12 80 00 	movl   $0x0,0x80124028
+801007f5:	00 00 00 
+801007f8:	c7 05 24 40 12 80 00 	movl   $0x0,0x80124024
+801007ff:	00 00 00 
+    bcache.st.evictions = bcache.st.prefetches = 0;
+80100802:	c7 05 30 40 12 80 00 	movl   $0x0,0x80124030
+80100809:	00 00 00 
+8010080c:	c7 05 2c 40 12 80 00 	movl   $0x0,0x8012402c
+80100813:	00 00 00 
+  }
+  return 0;
+}
+80100816:	b8 00 00 00 00       	mov    $0x0,%eax
+8010081b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010081e:	c9                   	leave
+8010081f:	c3                   	ret
+
+80100820 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100820:	55                   	push   %ebp
+80100821:	89 e5                	mov    %esp,%ebp
+80100823:	57                   	push   %edi
+80100824:	56                   	push   %esi
+80100825:	53                   	push   %ebx
+80100826:	83 ec 28             	sub    $0x28,%esp
+80100829:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010082c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010082f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100832:	57                   	push   %edi
+80100833:	e8 68 1a 00 00       	call   801022a0 <iunlock>
+  target = n;
+80100838:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  acquire(&cons.lock);
+8010083b:	c7 04 24 e0 40 12 80 	movl   $0x801240e0,(%esp)
+80100842:	e8 d6 73 00 00       	call   80107c1d <acquire>
+  while(n > 0){
+80100847:	83 c4 10             	add    $0x10,%esp
+8010084a:	85 db                	test   %ebx,%ebx
+8010084c:	0f 8e 91 00 00 00    	jle    801008e3 <consoleread+0xc3>
+    while(input.r == input.w){
+80100852:	a1 c0 40 12 80       	mov    0x801240c0,%eax
+80100857:	3b 05 c4 40 12 80    	cmp    0x801240c4,%eax
+8010085d:	75 47                	jne    801008a6 <consoleread+0x86>
+      if(myproc()->killed){
+8010085f:	e8 74 51 00 00       	call   801059d8 <myproc>
+80100864:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80100868:	75 17                	jne    80100881 <consoleread+0x61>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+8010086a:	83 ec 08             	sub    $0x8,%esp
+8010086d:	68 e0 40 12 80       	push   $0x801240e0
+80100872:	68 c0 40 12 80       	push   $0x801240c0
+80100877:	e8 fb 5c 00 00       	call   80106577 <sleep>
+8010087c:	83 c4 10             	add    $0x10,%esp
+8010087f:	eb d1                	jmp    80100852 <consoleread+0x32>
+        release(&cons.lock);
+80100881:	83 ec 0c             	sub    $0xc,%esp
+80100884:	68 e0 40 12 80       	push   $0x801240e0
+80100889:	e8 0e 74 00 00       	call   80107c9c <release>
+        ilock(ip);
+8010088e:	89 3c 24             	mov    %edi,(%esp)
+80100891:	e8 27 19 00 00       	call   801021bd <ilock>
+        return -1;
+80100896:	83 c4 10             	add    $0x10,%esp
+80100899:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+8010089e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801008a1:	5b                   	pop    %ebx
+801008a2:	5e                   	pop    %esi
+801008a3:	5f                   	pop    %edi
+801008a4:	5d                   	pop    %ebp
+801008a5:	c3                   	ret
+    c = input.buf[input.r++ % INPUT_BUF];
+801008a6:	8d 50 01             	lea    0x1(%eax),%edx
+801008a9:	89 15 c0 40 12 80    	mov    %edx,0x801240c0
+801008af:	89 c2                	mov    %eax,%edx
+801008b1:	83 e2 7f             	and    $0x7f,%edx
+801008b4:	0f b6 92 40 40 12 80 	movzbl -0x7fedbfc0(%edx),%edx
+801008bb:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+801008be:	80 fa 04             	cmp    $0x4,%dl
+801008c1:	74 14                	je     801008d7 <consoleread+0xb7>
+    *dst++ = c;
+801008c3:	8d 46 01             	lea    0x1(%esi),%eax
+801008c6:	88 16                	mov    %dl,(%esi)
+    --n;
+801008c8:	83 eb 01             	sub    $0x1,%ebx
+    if(c == '\n')
+801008cb:	83 f9 0a             	cmp    $0xa,%ecx
+801008ce:	74 13                	je     801008e3 <consoleread+0xc3>
+    *dst++ = c;
+801008d0:	89 c6                	mov    %eax,%esi
+801008d2:	e9 73 ff ff ff       	jmp    8010084a <consoleread+0x2a>
+      if(n < target){
+801008d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801008da:	39 cb                	cmp    %ecx,%ebx
+801008dc:	73 05                	jae    801008e3 <consoleread+0xc3>
+        input.r--;
+801008de:	a3 c0 40 12 80       	mov    %eax,0x801240c0
+  release(&cons.lock);
+801008e3:	83 ec 0c             	sub    $0xc,%esp
+801008e6:	68 e0 40 12 80       	push   $0x801240e0
+801008eb:	e8 ac 73 00 00       	call   80107c9c <release>
+  ilock(ip);
+801008f0:	89 3c 24             	mov    %edi,(%esp)
+801008f3:	e8 c5 18 00 00       	call   801021bd <ilock>
+  return target - n;
+801008f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801008fb:	29 d8                	sub    %ebx,%eax
+801008fd:	83 c4 10             	add    $0x10,%esp
+80100900:	eb 9c                	jmp    8010089e <consoleread+0x7e>
+
+80100902 <panic>:
+{
+80100902:	55                   	push   %ebp
+80100903:	89 e5                	mov    %esp,%ebp
+80100905:	53                   	push   %ebx
+80100906:	83 ec 34             	sub    $0x34,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100909:	fa                   	cli
+  cons.locking = 0;
+8010090a:	c7 05 2c 41 12 80 00 	movl   $0x0,0x8012412c
+80100911:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100914:	e8 7b 32 00 00       	call   80103b94 <lapicid>
+80100919:	83 ec 08             	sub    $0x8,%esp
+8010091c:	50                   	push   %eax
+8010091d:	68 8c ad 10 80       	push   $0x8010ad8c
+80100922:	e8 d2 03 00 00       	call   80100cf9 <cprintf>
+  cprintf(s);
+80100927:	83 c4 04             	add    $0x4,%esp
+8010092a:	ff 75 08             	push   0x8(%ebp)
+8010092d:	e8 c7 03 00 00       	call   80100cf9 <cprintf>
+  cprintf("\n");
+80100932:	c7 04 24 ab c0 10 80 	movl   $0x8010c0ab,(%esp)
+80100939:	e8 bb 03 00 00       	call   80100cf9 <cprintf>
+  getcallerpcs(&s, pcs);
+8010093e:	83 c4 08             	add    $0x8,%esp
+80100941:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80100944:	50                   	push   %eax
+80100945:	8d 45 08             	lea    0x8(%ebp),%eax
+80100948:	50                   	push   %eax
+80100949:	e8 a6 71 00 00       	call   80107af4 <getcallerpcs>
+  for(i=0; i<10; i++)
+8010094e:	83 c4 10             	add    $0x10,%esp
+80100951:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100956:	eb 17                	jmp    8010096f <panic+0x6d>
+    cprintf(" %p", pcs[i]);
+80100958:	83 ec 08             	sub    $0x8,%esp
+8010095b:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+8010095f:	68 a0 ad 10 80       	push   $0x8010ada0
+80100964:	e8 90 03 00 00       	call   80100cf9 <cprintf>
+  for(i=0; i<10; i++)
+80100969:	83 c3 01             	add    $0x1,%ebx
+8010096c:	83 c4 10             	add    $0x10,%esp
+8010096f:	83 fb 09             	cmp    $0x9,%ebx
+80100972:	7e e4                	jle    80100958 <panic+0x56>
+  panicked = 1; // freeze other CPU
+80100974:	c7 05 30 41 12 80 01 	movl   $0x1,0x80124130
+8010097b:	00 00 00 
+  for(;;)
+8010097e:	eb fe                	jmp    8010097e <panic+0x7c>
+
+80100980 <cgaputc>:
+{
+80100980:	55                   	push   %ebp
+80100981:	89 e5                	mov    %esp,%ebp
+80100983:	57                   	push   %edi
+80100984:	56                   	push   %esi
+80100985:	53                   	push   %ebx
+80100986:	83 ec 0c             	sub    $0xc,%esp
+80100989:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010098b:	bf d4 03 00 00       	mov    $0x3d4,%edi
+80100990:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100995:	89 fa                	mov    %edi,%edx
+80100997:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100998:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010099d:	89 ca                	mov    %ecx,%edx
+8010099f:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+801009a0:	0f b6 f0             	movzbl %al,%esi
+801009a3:	c1 e6 08             	shl    $0x8,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801009a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+801009ab:	89 fa                	mov    %edi,%edx
+801009ad:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801009ae:	89 ca                	mov    %ecx,%edx
+801009b0:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+801009b1:	0f b6 c8             	movzbl %al,%ecx
+801009b4:	09 f1                	or     %esi,%ecx
+  if(c == '\n')
+801009b6:	83 fb 0a             	cmp    $0xa,%ebx
+801009b9:	74 60                	je     80100a1b <cgaputc+0x9b>
+  else if(c == BACKSPACE){
+801009bb:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+801009c1:	74 79                	je     80100a3c <cgaputc+0xbc>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801009c3:	0f b6 c3             	movzbl %bl,%eax
+801009c6:	8d 59 01             	lea    0x1(%ecx),%ebx
+801009c9:	80 cc 07             	or     $0x7,%ah
+801009cc:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+801009d3:	80 
+  if(pos < 0 || pos > 25*80)
+801009d4:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+801009da:	77 6d                	ja     80100a49 <cgaputc+0xc9>
+  if((pos/80) >= 24){  // Scroll up.
+801009dc:	81 fb 7f 07 00 00    	cmp    $0x77f,%ebx
+801009e2:	7f 72                	jg     80100a56 <cgaputc+0xd6>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801009e4:	be d4 03 00 00       	mov    $0x3d4,%esi
+801009e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+801009ee:	89 f2                	mov    %esi,%edx
+801009f0:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+801009f1:	0f b6 c7             	movzbl %bh,%eax
+801009f4:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+801009f9:	89 ca                	mov    %ecx,%edx
+801009fb:	ee                   	out    %al,(%dx)
+801009fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100a01:	89 f2                	mov    %esi,%edx
+80100a03:	ee                   	out    %al,(%dx)
+80100a04:	89 d8                	mov    %ebx,%eax
+80100a06:	89 ca                	mov    %ecx,%edx
+80100a08:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100a09:	66 c7 84 1b 00 80 0b 	movw   $0x720,-0x7ff48000(%ebx,%ebx,1)
+80100a10:	80 20 07 
+}
+80100a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a16:	5b                   	pop    %ebx
+80100a17:	5e                   	pop    %esi
+80100a18:	5f                   	pop    %edi
+80100a19:	5d                   	pop    %ebp
+80100a1a:	c3                   	ret
+    pos += 80 - pos%80;
+80100a1b:	ba 67 66 66 66       	mov    $0x66666667,%edx
+80100a20:	89 c8                	mov    %ecx,%eax
+80100a22:	f7 ea                	imul   %edx
+80100a24:	c1 fa 05             	sar    $0x5,%edx
+80100a27:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100a2a:	c1 e0 04             	shl    $0x4,%eax
+80100a2d:	89 ca                	mov    %ecx,%edx
+80100a2f:	29 c2                	sub    %eax,%edx
+80100a31:	bb 50 00 00 00       	mov    $0x50,%ebx
+80100a36:	29 d3                	sub    %edx,%ebx
+80100a38:	01 cb                	add    %ecx,%ebx
+80100a3a:	eb 98                	jmp    801009d4 <cgaputc+0x54>
+    if(pos > 0) --pos;
+80100a3c:	85 c9                	test   %ecx,%ecx
+80100a3e:	7e 05                	jle    80100a45 <cgaputc+0xc5>
+80100a40:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+80100a43:	eb 8f                	jmp    801009d4 <cgaputc+0x54>
+  pos |= inb(CRTPORT+1);
+80100a45:	89 cb                	mov    %ecx,%ebx
+80100a47:	eb 8b                	jmp    801009d4 <cgaputc+0x54>
+    panic("pos under/overflow");
+80100a49:	83 ec 0c             	sub    $0xc,%esp
+80100a4c:	68 a4 ad 10 80       	push   $0x8010ada4
+80100a51:	e8 ac fe ff ff       	call   80100902 <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100a56:	83 ec 04             	sub    $0x4,%esp
+80100a59:	68 60 0e 00 00       	push   $0xe60
+80100a5e:	68 a0 80 0b 80       	push   $0x800b80a0
+80100a63:	68 00 80 0b 80       	push   $0x800b8000
+80100a68:	e8 02 73 00 00       	call   80107d6f <memmove>
+    pos -= 80;
+80100a6d:	83 eb 50             	sub    $0x50,%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100a70:	b8 80 07 00 00       	mov    $0x780,%eax
+80100a75:	29 d8                	sub    %ebx,%eax
+80100a77:	8d 94 1b 00 80 0b 80 	lea    -0x7ff48000(%ebx,%ebx,1),%edx
+80100a7e:	83 c4 0c             	add    $0xc,%esp
+80100a81:	01 c0                	add    %eax,%eax
+80100a83:	50                   	push   %eax
+80100a84:	6a 00                	push   $0x0
+80100a86:	52                   	push   %edx
+80100a87:	e8 6b 72 00 00       	call   80107cf7 <memset>
+80100a8c:	83 c4 10             	add    $0x10,%esp
+80100a8f:	e9 50 ff ff ff       	jmp    801009e4 <cgaputc+0x64>
+
+80100a94 <consputc>:
+  if(panicked){
+80100a94:	83 3d 30 41 12 80 00 	cmpl   $0x0,0x80124130
+80100a9b:	74 03                	je     80100aa0 <consputc+0xc>
+  asm volatile("cli");
+80100a9d:	fa                   	cli
+    for(;;)
+80100a9e:	eb fe                	jmp    80100a9e <consputc+0xa>
+{
+80100aa0:	55                   	push   %ebp
+80100aa1:	89 e5                	mov    %esp,%ebp
+80100aa3:	53                   	push   %ebx
+80100aa4:	83 ec 04             	sub    $0x4,%esp
+80100aa7:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+80100aa9:	3d 00 01 00 00       	cmp    $0x100,%eax
+80100aae:	74 18                	je     80100ac8 <consputc+0x34>
+    uartputc(c);
+80100ab0:	83 ec 0c             	sub    $0xc,%esp
+80100ab3:	50                   	push   %eax
+80100ab4:	e8 23 88 00 00       	call   801092dc <uartputc>
+80100ab9:	83 c4 10             	add    $0x10,%esp
+  cgaputc(c);
+80100abc:	89 d8                	mov    %ebx,%eax
+80100abe:	e8 bd fe ff ff       	call   80100980 <cgaputc>
+}
+80100ac3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100ac6:	c9                   	leave
+80100ac7:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100ac8:	83 ec 0c             	sub    $0xc,%esp
+80100acb:	6a 08                	push   $0x8
+80100acd:	e8 0a 88 00 00       	call   801092dc <uartputc>
+80100ad2:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100ad9:	e8 fe 87 00 00       	call   801092dc <uartputc>
+80100ade:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100ae5:	e8 f2 87 00 00       	call   801092dc <uartputc>
+80100aea:	83 c4 10             	add    $0x10,%esp
+80100aed:	eb cd                	jmp    80100abc <consputc+0x28>
+
+80100aef <printint>:
+{
+80100aef:	55                   	push   %ebp
+80100af0:	89 e5                	mov    %esp,%ebp
+80100af2:	57                   	push   %edi
+80100af3:	56                   	push   %esi
+80100af4:	53                   	push   %ebx
+80100af5:	83 ec 2c             	sub    $0x2c,%esp
+80100af8:	89 c3                	mov    %eax,%ebx
+80100afa:	89 d6                	mov    %edx,%esi
+80100afc:	89 c8                	mov    %ecx,%eax
+  if(sign && (sign = xx < 0))
+80100afe:	85 c9                	test   %ecx,%ecx
+80100b00:	74 09                	je     80100b0b <printint+0x1c>
+80100b02:	89 d8                	mov    %ebx,%eax
+80100b04:	c1 e8 1f             	shr    $0x1f,%eax
+80100b07:	85 db                	test   %ebx,%ebx
+80100b09:	78 3c                	js     80100b47 <printint+0x58>
+    x = xx;
+80100b0b:	89 d9                	mov    %ebx,%ecx
+  i = 0;
+80100b0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100b12:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    buf[i++] = digits[x % base];
+80100b15:	89 c8                	mov    %ecx,%eax
+80100b17:	ba 00 00 00 00       	mov    $0x0,%edx
+80100b1c:	f7 f6                	div    %esi
+80100b1e:	89 df                	mov    %ebx,%edi
+80100b20:	83 c3 01             	add    $0x1,%ebx
+80100b23:	0f b6 92 d0 ad 10 80 	movzbl -0x7fef5230(%edx),%edx
+80100b2a:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+80100b2e:	89 ca                	mov    %ecx,%edx
+80100b30:	89 c1                	mov    %eax,%ecx
+80100b32:	39 f2                	cmp    %esi,%edx
+80100b34:	73 df                	jae    80100b15 <printint+0x26>
+  if(sign)
+80100b36:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100b39:	85 c0                	test   %eax,%eax
+80100b3b:	74 1a                	je     80100b57 <printint+0x68>
+    buf[i++] = '-';
+80100b3d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+80100b42:	8d 5f 02             	lea    0x2(%edi),%ebx
+80100b45:	eb 10                	jmp    80100b57 <printint+0x68>
+    x = -xx;
+80100b47:	89 d9                	mov    %ebx,%ecx
+80100b49:	f7 d9                	neg    %ecx
+80100b4b:	eb c0                	jmp    80100b0d <printint+0x1e>
+    consputc(buf[i]);
+80100b4d:	0f be 44 1d d8       	movsbl -0x28(%ebp,%ebx,1),%eax
+80100b52:	e8 3d ff ff ff       	call   80100a94 <consputc>
+  while(--i >= 0)
+80100b57:	83 eb 01             	sub    $0x1,%ebx
+80100b5a:	79 f1                	jns    80100b4d <printint+0x5e>
+}
+80100b5c:	83 c4 2c             	add    $0x2c,%esp
+80100b5f:	5b                   	pop    %ebx
+80100b60:	5e                   	pop    %esi
+80100b61:	5f                   	pop    %edi
+80100b62:	5d                   	pop    %ebp
+80100b63:	c3                   	ret
+
+80100b64 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100b64:	55                   	push   %ebp
+80100b65:	89 e5                	mov    %esp,%ebp
+80100b67:	57                   	push   %edi
+80100b68:	56                   	push   %esi
+80100b69:	53                   	push   %ebx
+80100b6a:	83 ec 18             	sub    $0x18,%esp
+80100b6d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100b70:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100b73:	ff 75 08             	push   0x8(%ebp)
+80100b76:	e8 25 17 00 00       	call   801022a0 <iunlock>
+  acquire(&cons.lock);
+80100b7b:	c7 04 24 e0 40 12 80 	movl   $0x801240e0,(%esp)
+80100b82:	e8 96 70 00 00       	call   80107c1d <acquire>
+  for(i = 0; i < n; i++)
+80100b87:	83 c4 10             	add    $0x10,%esp
+80100b8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100b8f:	eb 0c                	jmp    80100b9d <consolewrite+0x39>
+    consputc(buf[i] & 0xff);
+80100b91:	0f b6 04 1f          	movzbl (%edi,%ebx,1),%eax
+80100b95:	e8 fa fe ff ff       	call   80100a94 <consputc>
+  for(i = 0; i < n; i++)
+80100b9a:	83 c3 01             	add    $0x1,%ebx
+80100b9d:	39 f3                	cmp    %esi,%ebx
+80100b9f:	7c f0                	jl     80100b91 <consolewrite+0x2d>
+  release(&cons.lock);
+80100ba1:	83 ec 0c             	sub    $0xc,%esp
+80100ba4:	68 e0 40 12 80       	push   $0x801240e0
+80100ba9:	e8 ee 70 00 00       	call   80107c9c <release>
+  ilock(ip);
+80100bae:	83 c4 04             	add    $0x4,%esp
+80100bb1:	ff 75 08             	push   0x8(%ebp)
+80100bb4:	e8 04 16 00 00       	call   801021bd <ilock>
+
+  return n;
+}
+80100bb9:	89 f0                	mov    %esi,%eax
+80100bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100bbe:	5b                   	pop    %ebx
+80100bbf:	5e                   	pop    %esi
+80100bc0:	5f                   	pop    %edi
+80100bc1:	5d                   	pop    %ebp
+80100bc2:	c3                   	ret
+
+80100bc3 <dbgprintf>:
+void dbgprintf(int cond, char *fmt, ...) {
+80100bc3:	55                   	push   %ebp
+80100bc4:	89 e5                	mov    %esp,%ebp
+80100bc6:	57                   	push   %edi
+80100bc7:	56                   	push   %esi
+80100bc8:	53                   	push   %ebx
+80100bc9:	83 ec 1c             	sub    $0x1c,%esp
+  if (!cond) return;
+80100bcc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+80100bd0:	0f 84 09 01 00 00    	je     80100cdf <dbgprintf+0x11c>
+  locking = cons.locking;
+80100bd6:	a1 2c 41 12 80       	mov    0x8012412c,%eax
+80100bdb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(locking)
+80100bde:	85 c0                	test   %eax,%eax
+80100be0:	75 10                	jne    80100bf2 <dbgprintf+0x2f>
+  if (fmt == 0)
+80100be2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80100be6:	74 1c                	je     80100c04 <dbgprintf+0x41>
+  argp = (uint*)(void*)(&fmt + 1);
+80100be8:	8d 7d 10             	lea    0x10(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100beb:	be 00 00 00 00       	mov    $0x0,%esi
+80100bf0:	eb 27                	jmp    80100c19 <dbgprintf+0x56>
+    acquire(&cons.lock);
+80100bf2:	83 ec 0c             	sub    $0xc,%esp
+80100bf5:	68 e0 40 12 80       	push   $0x801240e0
+80100bfa:	e8 1e 70 00 00       	call   80107c1d <acquire>
+80100bff:	83 c4 10             	add    $0x10,%esp
+80100c02:	eb de                	jmp    80100be2 <dbgprintf+0x1f>
+    panic("null fmt");
+80100c04:	83 ec 0c             	sub    $0xc,%esp
+80100c07:	68 be ad 10 80       	push   $0x8010adbe
+80100c0c:	e8 f1 fc ff ff       	call   80100902 <panic>
+      consputc(c);
+80100c11:	e8 7e fe ff ff       	call   80100a94 <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100c16:	83 c6 01             	add    $0x1,%esi
+80100c19:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100c1c:	0f b6 04 32          	movzbl (%edx,%esi,1),%eax
+80100c20:	85 c0                	test   %eax,%eax
+80100c22:	0f 84 b1 00 00 00    	je     80100cd9 <dbgprintf+0x116>
+    if(c != '%'){
+80100c28:	83 f8 25             	cmp    $0x25,%eax
+80100c2b:	75 e4                	jne    80100c11 <dbgprintf+0x4e>
+    c = fmt[++i] & 0xff;
+80100c2d:	83 c6 01             	add    $0x1,%esi
+80100c30:	0f b6 1c 32          	movzbl (%edx,%esi,1),%ebx
+    if(c == 0)
+80100c34:	85 db                	test   %ebx,%ebx
+80100c36:	0f 84 9d 00 00 00    	je     80100cd9 <dbgprintf+0x116>
+    switch(c){
+80100c3c:	83 fb 70             	cmp    $0x70,%ebx
+80100c3f:	74 2e                	je     80100c6f <dbgprintf+0xac>
+80100c41:	7f 22                	jg     80100c65 <dbgprintf+0xa2>
+80100c43:	83 fb 25             	cmp    $0x25,%ebx
+80100c46:	74 6c                	je     80100cb4 <dbgprintf+0xf1>
+80100c48:	83 fb 64             	cmp    $0x64,%ebx
+80100c4b:	75 76                	jne    80100cc3 <dbgprintf+0x100>
+      printint(*argp++, 10, 1);
+80100c4d:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100c50:	8b 07                	mov    (%edi),%eax
+80100c52:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100c57:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100c5c:	e8 8e fe ff ff       	call   80100aef <printint>
+80100c61:	89 df                	mov    %ebx,%edi
+      break;
+80100c63:	eb b1                	jmp    80100c16 <dbgprintf+0x53>
+    switch(c){
+80100c65:	83 fb 73             	cmp    $0x73,%ebx
+80100c68:	74 1d                	je     80100c87 <dbgprintf+0xc4>
+80100c6a:	83 fb 78             	cmp    $0x78,%ebx
+80100c6d:	75 54                	jne    80100cc3 <dbgprintf+0x100>
+      printint(*argp++, 16, 0);
+80100c6f:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100c72:	8b 07                	mov    (%edi),%eax
+80100c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+80100c79:	ba 10 00 00 00       	mov    $0x10,%edx
+80100c7e:	e8 6c fe ff ff       	call   80100aef <printint>
+80100c83:	89 df                	mov    %ebx,%edi
+      break;
+80100c85:	eb 8f                	jmp    80100c16 <dbgprintf+0x53>
+      if((s = (char*)*argp++) == 0)
+80100c87:	8d 47 04             	lea    0x4(%edi),%eax
+80100c8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100c8d:	8b 1f                	mov    (%edi),%ebx
+80100c8f:	85 db                	test   %ebx,%ebx
+80100c91:	75 12                	jne    80100ca5 <dbgprintf+0xe2>
+        s = "(null)";
+80100c93:	bb b7 ad 10 80       	mov    $0x8010adb7,%ebx
+80100c98:	eb 0b                	jmp    80100ca5 <dbgprintf+0xe2>
+        consputc(*s);
+80100c9a:	0f be c0             	movsbl %al,%eax
+80100c9d:	e8 f2 fd ff ff       	call   80100a94 <consputc>
+      for(; *s; s++)
+80100ca2:	83 c3 01             	add    $0x1,%ebx
+80100ca5:	0f b6 03             	movzbl (%ebx),%eax
+80100ca8:	84 c0                	test   %al,%al
+80100caa:	75 ee                	jne    80100c9a <dbgprintf+0xd7>
+      if((s = (char*)*argp++) == 0)
+80100cac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80100caf:	e9 62 ff ff ff       	jmp    80100c16 <dbgprintf+0x53>
+      consputc('%');
+80100cb4:	b8 25 00 00 00       	mov    $0x25,%eax
+80100cb9:	e8 d6 fd ff ff       	call   80100a94 <consputc>
+      break;
+80100cbe:	e9 53 ff ff ff       	jmp    80100c16 <dbgprintf+0x53>
+      consputc('%');
+80100cc3:	b8 25 00 00 00       	mov    $0x25,%eax
+80100cc8:	e8 c7 fd ff ff       	call   80100a94 <consputc>
+      consputc(c);
+80100ccd:	89 d8                	mov    %ebx,%eax
+80100ccf:	e8 c0 fd ff ff       	call   80100a94 <consputc>
+      break;
+80100cd4:	e9 3d ff ff ff       	jmp    80100c16 <dbgprintf+0x53>
+  if(locking)
+80100cd9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80100cdd:	75 08                	jne    80100ce7 <dbgprintf+0x124>
+}
+80100cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ce2:	5b                   	pop    %ebx
+80100ce3:	5e                   	pop    %esi
+80100ce4:	5f                   	pop    %edi
+80100ce5:	5d                   	pop    %ebp
+80100ce6:	c3                   	ret
+    release(&cons.lock);
+80100ce7:	83 ec 0c             	sub    $0xc,%esp
+80100cea:	68 e0 40 12 80       	push   $0x801240e0
+80100cef:	e8 a8 6f 00 00       	call   80107c9c <release>
+80100cf4:	83 c4 10             	add    $0x10,%esp
+80100cf7:	eb e6                	jmp    80100cdf <dbgprintf+0x11c>
+
+80100cf9 <cprintf>:
+{
+80100cf9:	55                   	push   %ebp
+80100cfa:	89 e5                	mov    %esp,%ebp
+80100cfc:	57                   	push   %edi
+80100cfd:	56                   	push   %esi
+80100cfe:	53                   	push   %ebx
+80100cff:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100d02:	a1 2c 41 12 80       	mov    0x8012412c,%eax
+80100d07:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(locking)
+80100d0a:	85 c0                	test   %eax,%eax
+80100d0c:	75 10                	jne    80100d1e <cprintf+0x25>
+  if (fmt == 0)
+80100d0e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+80100d12:	74 1c                	je     80100d30 <cprintf+0x37>
+  argp = (uint*)(void*)(&fmt + 1);
+80100d14:	8d 7d 0c             	lea    0xc(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100d17:	be 00 00 00 00       	mov    $0x0,%esi
+80100d1c:	eb 27                	jmp    80100d45 <cprintf+0x4c>
+    acquire(&cons.lock);
+80100d1e:	83 ec 0c             	sub    $0xc,%esp
+80100d21:	68 e0 40 12 80       	push   $0x801240e0
+80100d26:	e8 f2 6e 00 00       	call   80107c1d <acquire>
+80100d2b:	83 c4 10             	add    $0x10,%esp
+80100d2e:	eb de                	jmp    80100d0e <cprintf+0x15>
+    panic("null fmt");
+80100d30:	83 ec 0c             	sub    $0xc,%esp
+80100d33:	68 be ad 10 80       	push   $0x8010adbe
+80100d38:	e8 c5 fb ff ff       	call   80100902 <panic>
+      consputc(c);
+80100d3d:	e8 52 fd ff ff       	call   80100a94 <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100d42:	83 c6 01             	add    $0x1,%esi
+80100d45:	8b 55 08             	mov    0x8(%ebp),%edx
+80100d48:	0f b6 04 32          	movzbl (%edx,%esi,1),%eax
+80100d4c:	85 c0                	test   %eax,%eax
+80100d4e:	0f 84 b1 00 00 00    	je     80100e05 <cprintf+0x10c>
+    if(c != '%'){
+80100d54:	83 f8 25             	cmp    $0x25,%eax
+80100d57:	75 e4                	jne    80100d3d <cprintf+0x44>
+    c = fmt[++i] & 0xff;
+80100d59:	83 c6 01             	add    $0x1,%esi
+80100d5c:	0f b6 1c 32          	movzbl (%edx,%esi,1),%ebx
+    if(c == 0)
+80100d60:	85 db                	test   %ebx,%ebx
+80100d62:	0f 84 9d 00 00 00    	je     80100e05 <cprintf+0x10c>
+    switch(c){
+80100d68:	83 fb 70             	cmp    $0x70,%ebx
+80100d6b:	74 2e                	je     80100d9b <cprintf+0xa2>
+80100d6d:	7f 22                	jg     80100d91 <cprintf+0x98>
+80100d6f:	83 fb 25             	cmp    $0x25,%ebx
+80100d72:	74 6c                	je     80100de0 <cprintf+0xe7>
+80100d74:	83 fb 64             	cmp    $0x64,%ebx
+80100d77:	75 76                	jne    80100def <cprintf+0xf6>
+      printint(*argp++, 10, 1);
+80100d79:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100d7c:	8b 07                	mov    (%edi),%eax
+80100d7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100d83:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100d88:	e8 62 fd ff ff       	call   80100aef <printint>
+80100d8d:	89 df                	mov    %ebx,%edi
+      break;
+80100d8f:	eb b1                	jmp    80100d42 <cprintf+0x49>
+    switch(c){
+80100d91:	83 fb 73             	cmp    $0x73,%ebx
+80100d94:	74 1d                	je     80100db3 <cprintf+0xba>
+80100d96:	83 fb 78             	cmp    $0x78,%ebx
+80100d99:	75 54                	jne    80100def <cprintf+0xf6>
+      printint(*argp++, 16, 0);
+80100d9b:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100d9e:	8b 07                	mov    (%edi),%eax
+80100da0:	b9 00 00 00 00       	mov    $0x0,%ecx
+80100da5:	ba 10 00 00 00       	mov    $0x10,%edx
+80100daa:	e8 40 fd ff ff       	call   80100aef <printint>
+80100daf:	89 df                	mov    %ebx,%edi
+      break;
+80100db1:	eb 8f                	jmp    80100d42 <cprintf+0x49>
+      if((s = (char*)*argp++) == 0)
+80100db3:	8d 47 04             	lea    0x4(%edi),%eax
+80100db6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100db9:	8b 1f                	mov    (%edi),%ebx
+80100dbb:	85 db                	test   %ebx,%ebx
+80100dbd:	75 12                	jne    80100dd1 <cprintf+0xd8>
+        s = "(null)";
+80100dbf:	bb b7 ad 10 80       	mov    $0x8010adb7,%ebx
+80100dc4:	eb 0b                	jmp    80100dd1 <cprintf+0xd8>
+        consputc(*s);
+80100dc6:	0f be c0             	movsbl %al,%eax
+80100dc9:	e8 c6 fc ff ff       	call   80100a94 <consputc>
+      for(; *s; s++)
+80100dce:	83 c3 01             	add    $0x1,%ebx
+80100dd1:	0f b6 03             	movzbl (%ebx),%eax
+80100dd4:	84 c0                	test   %al,%al
+80100dd6:	75 ee                	jne    80100dc6 <cprintf+0xcd>
+      if((s = (char*)*argp++) == 0)
+80100dd8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80100ddb:	e9 62 ff ff ff       	jmp    80100d42 <cprintf+0x49>
+      consputc('%');
+80100de0:	b8 25 00 00 00       	mov    $0x25,%eax
+80100de5:	e8 aa fc ff ff       	call   80100a94 <consputc>
+      break;
+80100dea:	e9 53 ff ff ff       	jmp    80100d42 <cprintf+0x49>
+      consputc('%');
+80100def:	b8 25 00 00 00       	mov    $0x25,%eax
+80100df4:	e8 9b fc ff ff       	call   80100a94 <consputc>
+      consputc(c);
+80100df9:	89 d8                	mov    %ebx,%eax
+80100dfb:	e8 94 fc ff ff       	call   80100a94 <consputc>
+      break;
+80100e00:	e9 3d ff ff ff       	jmp    80100d42 <cprintf+0x49>
+  if(locking)
+80100e05:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80100e09:	75 08                	jne    80100e13 <cprintf+0x11a>
+}
+80100e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100e0e:	5b                   	pop    %ebx
+80100e0f:	5e                   	pop    %esi
+80100e10:	5f                   	pop    %edi
+80100e11:	5d                   	pop    %ebp
+80100e12:	c3                   	ret
+    release(&cons.lock);
+80100e13:	83 ec 0c             	sub    $0xc,%esp
+80100e16:	68 e0 40 12 80       	push   $0x801240e0
+80100e1b:	e8 7c 6e 00 00       	call   80107c9c <release>
+80100e20:	83 c4 10             	add    $0x10,%esp
+}
+80100e23:	eb e6                	jmp    80100e0b <cprintf+0x112>
+
+80100e25 <consoleintr>:
+{
+80100e25:	55                   	push   %ebp
+80100e26:	89 e5                	mov    %esp,%ebp
+80100e28:	57                   	push   %edi
+80100e29:	56                   	push   %esi
+80100e2a:	53                   	push   %ebx
+80100e2b:	83 ec 18             	sub    $0x18,%esp
+80100e2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cons.lock);
+80100e31:	68 e0 40 12 80       	push   $0x801240e0
+80100e36:	e8 e2 6d 00 00       	call   80107c1d <acquire>
+  while((c = getc()) >= 0){
+80100e3b:	83 c4 10             	add    $0x10,%esp
+  int c, doprocdump = 0;
+80100e3e:	be 00 00 00 00       	mov    $0x0,%esi
+  while((c = getc()) >= 0){
+80100e43:	eb 13                	jmp    80100e58 <consoleintr+0x33>
+    switch(c){
+80100e45:	83 ff 08             	cmp    $0x8,%edi
+80100e48:	0f 84 d9 00 00 00    	je     80100f27 <consoleintr+0x102>
+80100e4e:	83 ff 10             	cmp    $0x10,%edi
+80100e51:	75 25                	jne    80100e78 <consoleintr+0x53>
+80100e53:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100e58:	ff d3                	call   *%ebx
+80100e5a:	89 c7                	mov    %eax,%edi
+80100e5c:	85 c0                	test   %eax,%eax
+80100e5e:	0f 88 f5 00 00 00    	js     80100f59 <consoleintr+0x134>
+    switch(c){
+80100e64:	83 ff 15             	cmp    $0x15,%edi
+80100e67:	0f 84 93 00 00 00    	je     80100f00 <consoleintr+0xdb>
+80100e6d:	7e d6                	jle    80100e45 <consoleintr+0x20>
+80100e6f:	83 ff 7f             	cmp    $0x7f,%edi
+80100e72:	0f 84 af 00 00 00    	je     80100f27 <consoleintr+0x102>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100e78:	85 ff                	test   %edi,%edi
+80100e7a:	74 dc                	je     80100e58 <consoleintr+0x33>
+80100e7c:	a1 c8 40 12 80       	mov    0x801240c8,%eax
+80100e81:	89 c2                	mov    %eax,%edx
+80100e83:	2b 15 c0 40 12 80    	sub    0x801240c0,%edx
+80100e89:	83 fa 7f             	cmp    $0x7f,%edx
+80100e8c:	77 ca                	ja     80100e58 <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+80100e8e:	83 ff 0d             	cmp    $0xd,%edi
+80100e91:	0f 84 b8 00 00 00    	je     80100f4f <consoleintr+0x12a>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100e97:	8d 50 01             	lea    0x1(%eax),%edx
+80100e9a:	89 15 c8 40 12 80    	mov    %edx,0x801240c8
+80100ea0:	83 e0 7f             	and    $0x7f,%eax
+80100ea3:	89 f9                	mov    %edi,%ecx
+80100ea5:	88 88 40 40 12 80    	mov    %cl,-0x7fedbfc0(%eax)
+        consputc(c);
+80100eab:	89 f8                	mov    %edi,%eax
+80100ead:	e8 e2 fb ff ff       	call   80100a94 <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100eb2:	83 ff 0a             	cmp    $0xa,%edi
+80100eb5:	0f 94 c0             	sete   %al
+80100eb8:	83 ff 04             	cmp    $0x4,%edi
+80100ebb:	0f 94 c2             	sete   %dl
+80100ebe:	08 d0                	or     %dl,%al
+80100ec0:	75 10                	jne    80100ed2 <consoleintr+0xad>
+80100ec2:	a1 c0 40 12 80       	mov    0x801240c0,%eax
+80100ec7:	83 e8 80             	sub    $0xffffff80,%eax
+80100eca:	39 05 c8 40 12 80    	cmp    %eax,0x801240c8
+80100ed0:	75 86                	jne    80100e58 <consoleintr+0x33>
+          input.w = input.e;
+80100ed2:	a1 c8 40 12 80       	mov    0x801240c8,%eax
+80100ed7:	a3 c4 40 12 80       	mov    %eax,0x801240c4
+          wakeup(&input.r);
+80100edc:	83 ec 0c             	sub    $0xc,%esp
+80100edf:	68 c0 40 12 80       	push   $0x801240c0
+80100ee4:	e8 e3 57 00 00       	call   801066cc <wakeup>
+80100ee9:	83 c4 10             	add    $0x10,%esp
+80100eec:	e9 67 ff ff ff       	jmp    80100e58 <consoleintr+0x33>
+        input.e--;
+80100ef1:	a3 c8 40 12 80       	mov    %eax,0x801240c8
+        consputc(BACKSPACE);
+80100ef6:	b8 00 01 00 00       	mov    $0x100,%eax
+80100efb:	e8 94 fb ff ff       	call   80100a94 <consputc>
+      while(input.e != input.w &&
+80100f00:	a1 c8 40 12 80       	mov    0x801240c8,%eax
+80100f05:	3b 05 c4 40 12 80    	cmp    0x801240c4,%eax
+80100f0b:	0f 84 47 ff ff ff    	je     80100e58 <consoleintr+0x33>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100f11:	83 e8 01             	sub    $0x1,%eax
+80100f14:	89 c2                	mov    %eax,%edx
+80100f16:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100f19:	80 ba 40 40 12 80 0a 	cmpb   $0xa,-0x7fedbfc0(%edx)
+80100f20:	75 cf                	jne    80100ef1 <consoleintr+0xcc>
+80100f22:	e9 31 ff ff ff       	jmp    80100e58 <consoleintr+0x33>
+      if(input.e != input.w){
+80100f27:	a1 c8 40 12 80       	mov    0x801240c8,%eax
+80100f2c:	3b 05 c4 40 12 80    	cmp    0x801240c4,%eax
+80100f32:	0f 84 20 ff ff ff    	je     80100e58 <consoleintr+0x33>
+        input.e--;
+80100f38:	83 e8 01             	sub    $0x1,%eax
+80100f3b:	a3 c8 40 12 80       	mov    %eax,0x801240c8
+        consputc(BACKSPACE);
+80100f40:	b8 00 01 00 00       	mov    $0x100,%eax
+80100f45:	e8 4a fb ff ff       	call   80100a94 <consputc>
+80100f4a:	e9 09 ff ff ff       	jmp    80100e58 <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+80100f4f:	bf 0a 00 00 00       	mov    $0xa,%edi
+80100f54:	e9 3e ff ff ff       	jmp    80100e97 <consoleintr+0x72>
+  release(&cons.lock);
+80100f59:	83 ec 0c             	sub    $0xc,%esp
+80100f5c:	68 e0 40 12 80       	push   $0x801240e0
+80100f61:	e8 36 6d 00 00       	call   80107c9c <release>
+  if(doprocdump) {
+80100f66:	83 c4 10             	add    $0x10,%esp
+80100f69:	85 f6                	test   %esi,%esi
+80100f6b:	75 08                	jne    80100f75 <consoleintr+0x150>
+}
+80100f6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f70:	5b                   	pop    %ebx
+80100f71:	5e                   	pop    %esi
+80100f72:	5f                   	pop    %edi
+80100f73:	5d                   	pop    %ebp
+80100f74:	c3                   	ret
+    procdump();  // now call procdump() wo. cons.lock held
+80100f75:	e8 ec 57 00 00       	call   80106766 <procdump>
+}
+80100f7a:	eb f1                	jmp    80100f6d <consoleintr+0x148>
+
+80100f7c <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100f7c:	55                   	push   %ebp
+80100f7d:	89 e5                	mov    %esp,%ebp
+80100f7f:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100f82:	68 c7 ad 10 80       	push   $0x8010adc7
+80100f87:	68 e0 40 12 80       	push   $0x801240e0
+80100f8c:	e8 41 6b 00 00       	call   80107ad2 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100f91:	c7 05 ac 41 12 80 64 	movl   $0x80100b64,0x801241ac
+80100f98:	0b 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100f9b:	c7 05 a8 41 12 80 20 	movl   $0x80100820,0x801241a8
+80100fa2:	08 10 80 
+  cons.locking = 1;
+80100fa5:	c7 05 2c 41 12 80 01 	movl   $0x1,0x8012412c
+80100fac:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100faf:	83 c4 08             	add    $0x8,%esp
+80100fb2:	6a 00                	push   $0x0
+80100fb4:	6a 01                	push   $0x1
+80100fb6:	e8 77 23 00 00       	call   80103332 <ioapicenable>
+}
+80100fbb:	83 c4 10             	add    $0x10,%esp
+80100fbe:	c9                   	leave
+80100fbf:	c3                   	ret
+
+80100fc0 <execinto>:
+// p is either the calling process (exec) or a new one that
+// has no image yet (spawn); path and argv are read in the
+// caller's address space either way.
+int
+execinto(struct proc *p, char *path, char **argv)
+{
+80100fc0:	55                   	push   %ebp
+80100fc1:	89 e5                	mov    %esp,%ebp
+80100fc3:	57                   	push   %edi
+80100fc4:	56                   	push   %esi
+80100fc5:	53                   	push   %ebx
+80100fc6:	81 ec 6c 01 00 00    	sub    $0x16c,%esp
+  pde_t *pgdir, *oldpgdir;
+  struct vmseg seg[NSEG];
+  struct inode *exe, *oldexe;
+  int nseg;
+
+  begin_op();
+80100fcc:	e8 10 34 00 00       	call   801043e1 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100fd1:	83 ec 0c             	sub    $0xc,%esp
+80100fd4:	ff 75 0c             	push   0xc(%ebp)
+80100fd7:	e8 27 19 00 00       	call   80102903 <namei>
+80100fdc:	83 c4 10             	add    $0x10,%esp
+80100fdf:	85 c0                	test   %eax,%eax
+80100fe1:	74 43                	je     80101026 <execinto+0x66>
+80100fe3:	89 c7                	mov    %eax,%edi
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100fe5:	83 ec 0c             	sub    $0xc,%esp
+80100fe8:	50                   	push   %eax
+80100fe9:	e8 cf 11 00 00       	call   801021bd <ilock>
+  pgdir = 0;
+  exe = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100fee:	6a 34                	push   $0x34
+80100ff0:	6a 00                	push   $0x0
+80100ff2:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100ff8:	50                   	push   %eax
+80100ff9:	57                   	push   %edi
+80100ffa:	e8 62 14 00 00       	call   80102461 <readi>
+80100fff:	83 c4 20             	add    $0x20,%esp
+80101002:	83 f8 34             	cmp    $0x34,%eax
+80101005:	0f 85 b9 03 00 00    	jne    801013c4 <execinto+0x404>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+8010100b:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80101012:	45 4c 46 
+80101015:	74 2e                	je     80101045 <execinto+0x85>
+  exe = 0;
+80101017:	bb 00 00 00 00       	mov    $0x0,%ebx
+  pgdir = 0;
+8010101c:	be 00 00 00 00       	mov    $0x0,%esi
+80101021:	e9 a8 03 00 00       	jmp    801013ce <execinto+0x40e>
+    end_op();
+80101026:	e8 40 34 00 00       	call   8010446b <end_op>
+    cprintf("exec: fail\n");
+8010102b:	83 ec 0c             	sub    $0xc,%esp
+8010102e:	68 e1 ad 10 80       	push   $0x8010ade1
+80101033:	e8 c1 fc ff ff       	call   80100cf9 <cprintf>
+    return -1;
+80101038:	83 c4 10             	add    $0x10,%esp
+8010103b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101040:	e9 db 03 00 00       	jmp    80101420 <execinto+0x460>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80101045:	e8 dd 91 00 00       	call   8010a227 <setupkvm>
+8010104a:	89 c6                	mov    %eax,%esi
+8010104c:	85 c0                	test   %eax,%eax
+8010104e:	0f 84 d4 03 00 00    	je     80101428 <execinto+0x468>
+
+  // Record the program's segments; pgfault() maps their
+  // pages from the file when they are first touched.
+  sz = 0;
+  nseg = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101054:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  nseg = 0;
+8010105a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  sz = 0;
+8010105f:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%ebp)
+80101066:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101069:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010106e:	89 bd a0 fe ff ff    	mov    %edi,-0x160(%ebp)
+80101074:	89 b5 94 fe ff ff    	mov    %esi,-0x16c(%ebp)
+8010107a:	89 cf                	mov    %ecx,%edi
+8010107c:	eb 0c                	jmp    8010108a <execinto+0xca>
+8010107e:	83 c3 01             	add    $0x1,%ebx
+80101081:	8b 85 a4 fe ff ff    	mov    -0x15c(%ebp),%eax
+80101087:	83 c0 20             	add    $0x20,%eax
+8010108a:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+80101091:	39 da                	cmp    %ebx,%edx
+80101093:	0f 8e d3 00 00 00    	jle    8010116c <execinto+0x1ac>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80101099:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+8010109f:	6a 20                	push   $0x20
+801010a1:	50                   	push   %eax
+801010a2:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+801010a8:	50                   	push   %eax
+801010a9:	ff b5 a0 fe ff ff    	push   -0x160(%ebp)
+801010af:	e8 ad 13 00 00       	call   80102461 <readi>
+801010b4:	83 c4 10             	add    $0x10,%esp
+801010b7:	83 f8 20             	cmp    $0x20,%eax
+801010ba:	0f 85 6c 03 00 00    	jne    8010142c <execinto+0x46c>
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+801010c0:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+801010c7:	75 b5                	jne    8010107e <execinto+0xbe>
+      continue;
+    if(ph.memsz < ph.filesz)
+801010c9:	8b 95 18 ff ff ff    	mov    -0xe8(%ebp),%edx
+801010cf:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+801010d5:	89 85 9c fe ff ff    	mov    %eax,-0x164(%ebp)
+801010db:	39 c2                	cmp    %eax,%edx
+801010dd:	0f 82 5c 03 00 00    	jb     8010143f <execinto+0x47f>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= KERNBASE)
+801010e3:	8b 8d 0c ff ff ff    	mov    -0xf4(%ebp),%ecx
+801010e9:	89 d6                	mov    %edx,%esi
+801010eb:	01 ce                	add    %ecx,%esi
+801010ed:	0f 82 62 03 00 00    	jb     80101455 <execinto+0x495>
+801010f3:	85 f6                	test   %esi,%esi
+801010f5:	0f 88 70 03 00 00    	js     8010146b <execinto+0x4ab>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0 || nseg == NSEG)
+801010fb:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+80101101:	0f 85 7a 03 00 00    	jne    80101481 <execinto+0x4c1>
+80101107:	83 ff 04             	cmp    $0x4,%edi
+8010110a:	0f 84 87 03 00 00    	je     80101497 <execinto+0x4d7>
+      goto bad;
+    seg[nseg].va = ph.vaddr;
+80101110:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+80101113:	c1 e0 02             	shl    $0x2,%eax
+80101116:	89 8c 05 b4 fe ff ff 	mov    %ecx,-0x14c(%ebp,%eax,1)
+    seg[nseg].memsz = ph.memsz;
+8010111d:	89 94 05 b8 fe ff ff 	mov    %edx,-0x148(%ebp,%eax,1)
+    seg[nseg].filesz = ph.filesz;
+80101124:	8b 8d 9c fe ff ff    	mov    -0x164(%ebp),%ecx
+8010112a:	89 8c 05 bc fe ff ff 	mov    %ecx,-0x144(%ebp,%eax,1)
+    seg[nseg].off = ph.off;
+80101131:	8b 95 08 ff ff ff    	mov    -0xf8(%ebp),%edx
+80101137:	89 94 05 c0 fe ff ff 	mov    %edx,-0x140(%ebp,%eax,1)
+    seg[nseg].writable = (ph.flags & ELF_PROG_FLAG_WRITE) != 0;
+8010113e:	f6 85 1c ff ff ff 02 	testb  $0x2,-0xe4(%ebp)
+80101145:	0f 95 c2             	setne  %dl
+80101148:	0f b6 d2             	movzbl %dl,%edx
+8010114b:	89 94 05 c4 fe ff ff 	mov    %edx,-0x13c(%ebp,%eax,1)
+    nseg++;
+80101152:	83 c7 01             	add    $0x1,%edi
+    if(ph.vaddr + ph.memsz > sz)
+80101155:	39 b5 98 fe ff ff    	cmp    %esi,-0x168(%ebp)
+8010115b:	0f 83 1d ff ff ff    	jae    8010107e <execinto+0xbe>
+      sz = ph.vaddr + ph.memsz;
+80101161:	89 b5 98 fe ff ff    	mov    %esi,-0x168(%ebp)
+80101167:	e9 12 ff ff ff       	jmp    8010107e <execinto+0xbe>
+  }
+  iexec(ip, 1);
+8010116c:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+80101172:	89 bd 9c fe ff ff    	mov    %edi,-0x164(%ebp)
+80101178:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+8010117e:	83 ec 08             	sub    $0x8,%esp
+80101181:	6a 01                	push   $0x1
+80101183:	57                   	push   %edi
+80101184:	e8 25 10 00 00       	call   801021ae <iexec>
+  iunlock(ip);
+80101189:	89 3c 24             	mov    %edi,(%esp)
+8010118c:	e8 0f 11 00 00       	call   801022a0 <iunlock>
+  end_op();
+80101191:	e8 d5 32 00 00       	call   8010446b <end_op>
+  exe = ip;
+  ip = 0;
+
+  // Allocate two pages at the next page boundary.
+  // Make the first inaccessible.  Use the second as the user stack.
+  sz = PGROUNDUP(sz);
+80101196:	8b 85 98 fe ff ff    	mov    -0x168(%ebp),%eax
+8010119c:	05 ff 0f 00 00       	add    $0xfff,%eax
+801011a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+801011a6:	83 c4 0c             	add    $0xc,%esp
+801011a9:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+801011af:	52                   	push   %edx
+801011b0:	50                   	push   %eax
+801011b1:	56                   	push   %esi
+801011b2:	e8 b5 94 00 00       	call   8010a66c <allocuvm>
+801011b7:	89 c3                	mov    %eax,%ebx
+801011b9:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%ebp)
+801011bf:	83 c4 10             	add    $0x10,%esp
+801011c2:	85 c0                	test   %eax,%eax
+801011c4:	75 0c                	jne    801011d2 <execinto+0x212>
+  exe = ip;
+801011c6:	89 fb                	mov    %edi,%ebx
+  ip = 0;
+801011c8:	bf 00 00 00 00       	mov    $0x0,%edi
+801011cd:	e9 fc 01 00 00       	jmp    801013ce <execinto+0x40e>
+    goto bad;
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011d2:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+801011d8:	83 ec 08             	sub    $0x8,%esp
+801011db:	50                   	push   %eax
+801011dc:	56                   	push   %esi
+801011dd:	e8 f5 95 00 00       	call   8010a7d7 <clearpteu>
+  sp = sz;
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+801011e2:	83 c4 10             	add    $0x10,%esp
+801011e5:	b8 00 00 00 00       	mov    $0x0,%eax
+801011ea:	89 bd 98 fe ff ff    	mov    %edi,-0x168(%ebp)
+801011f0:	89 b5 a4 fe ff ff    	mov    %esi,-0x15c(%ebp)
+801011f6:	89 c6                	mov    %eax,%esi
+801011f8:	eb 0a                	jmp    80101204 <execinto+0x244>
+    if(argc >= MAXARG)
+      goto bad;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+      goto bad;
+    ustack[3+argc] = sp;
+801011fa:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+  for(argc = 0; argv[argc]; argc++) {
+80101201:	83 c6 01             	add    $0x1,%esi
+80101204:	8b 45 10             	mov    0x10(%ebp),%eax
+80101207:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+8010120a:	8b 07                	mov    (%edi),%eax
+8010120c:	85 c0                	test   %eax,%eax
+8010120e:	74 55                	je     80101265 <execinto+0x2a5>
+    if(argc >= MAXARG)
+80101210:	83 fe 1f             	cmp    $0x1f,%esi
+80101213:	0f 87 94 02 00 00    	ja     801014ad <execinto+0x4ed>
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101219:	83 ec 0c             	sub    $0xc,%esp
+8010121c:	50                   	push   %eax
+8010121d:	e8 7e 6c 00 00       	call   80107ea0 <strlen>
+80101222:	29 c3                	sub    %eax,%ebx
+80101224:	83 eb 01             	sub    $0x1,%ebx
+80101227:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+8010122a:	83 c4 04             	add    $0x4,%esp
+8010122d:	ff 37                	push   (%edi)
+8010122f:	e8 6c 6c 00 00       	call   80107ea0 <strlen>
+80101234:	83 c0 01             	add    $0x1,%eax
+80101237:	50                   	push   %eax
+80101238:	ff 37                	push   (%edi)
+8010123a:	53                   	push   %ebx
+8010123b:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+80101241:	e8 4d 9a 00 00       	call   8010ac93 <copyout>
+80101246:	83 c4 20             	add    $0x20,%esp
+80101249:	85 c0                	test   %eax,%eax
+8010124b:	79 ad                	jns    801011fa <execinto+0x23a>
+  exe = ip;
+8010124d:	8b bd 98 fe ff ff    	mov    -0x168(%ebp),%edi
+80101253:	8b b5 a4 fe ff ff    	mov    -0x15c(%ebp),%esi
+80101259:	89 fb                	mov    %edi,%ebx
+  ip = 0;
+8010125b:	bf 00 00 00 00       	mov    $0x0,%edi
+80101260:	e9 69 01 00 00       	jmp    801013ce <execinto+0x40e>
+  }
+  ustack[3+argc] = 0;
+80101265:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+8010126b:	89 f1                	mov    %esi,%ecx
+8010126d:	8b bd 98 fe ff ff    	mov    -0x168(%ebp),%edi
+80101273:	8b b5 a4 fe ff ff    	mov    -0x15c(%ebp),%esi
+80101279:	c7 84 8d 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%ecx,4)
+80101280:	00 00 00 00 
+
+  ustack[0] = 0xffffffff;  // fake return PC
+80101284:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+8010128b:	ff ff ff 
+  ustack[1] = argc;
+8010128e:	89 8d 5c ff ff ff    	mov    %ecx,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101294:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+8010129b:	89 d8                	mov    %ebx,%eax
+8010129d:	29 d0                	sub    %edx,%eax
+8010129f:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+
+  sp -= (3+argc+1) * 4;
+801012a5:	8d 04 8d 10 00 00 00 	lea    0x10(,%ecx,4),%eax
+801012ac:	29 c3                	sub    %eax,%ebx
+801012ae:	89 9d a4 fe ff ff    	mov    %ebx,-0x15c(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+801012b4:	50                   	push   %eax
+801012b5:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+801012bb:	50                   	push   %eax
+801012bc:	53                   	push   %ebx
+801012bd:	56                   	push   %esi
+801012be:	e8 d0 99 00 00       	call   8010ac93 <copyout>
+801012c3:	83 c4 10             	add    $0x10,%esp
+801012c6:	85 c0                	test   %eax,%eax
+801012c8:	0f 88 f7 01 00 00    	js     801014c5 <execinto+0x505>
+    goto bad;
+
+  // Save program name for debugging.
+  for(last=s=path; *s; s++)
+801012ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+801012d1:	89 d0                	mov    %edx,%eax
+801012d3:	eb 03                	jmp    801012d8 <execinto+0x318>
+801012d5:	83 c0 01             	add    $0x1,%eax
+801012d8:	0f b6 08             	movzbl (%eax),%ecx
+801012db:	84 c9                	test   %cl,%cl
+801012dd:	74 0a                	je     801012e9 <execinto+0x329>
+    if(*s == '/')
+801012df:	80 f9 2f             	cmp    $0x2f,%cl
+801012e2:	75 f1                	jne    801012d5 <execinto+0x315>
+      last = s+1;
+801012e4:	8d 50 01             	lea    0x1(%eax),%edx
+801012e7:	eb ec                	jmp    801012d5 <execinto+0x315>
+  safestrcpy(p->name, last, sizeof(p->name));
+801012e9:	8b 45 08             	mov    0x8(%ebp),%eax
+801012ec:	83 c0 6c             	add    $0x6c,%eax
+801012ef:	83 ec 04             	sub    $0x4,%esp
+801012f2:	6a 10                	push   $0x10
+801012f4:	52                   	push   %edx
+801012f5:	50                   	push   %eax
+801012f6:	e8 68 6b 00 00       	call   80107e63 <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = p->pgdir;
+801012fb:	8b 45 08             	mov    0x8(%ebp),%eax
+801012fe:	8b 58 04             	mov    0x4(%eax),%ebx
+  oldexe = p->exeip;
+80101301:	8b 80 c8 00 00 00    	mov    0xc8(%eax),%eax
+80101307:	89 85 98 fe ff ff    	mov    %eax,-0x168(%ebp)
+  p->pgdir = pgdir;
+8010130d:	8b 45 08             	mov    0x8(%ebp),%eax
+80101310:	89 70 04             	mov    %esi,0x4(%eax)
+  p->sz = sz;
+80101313:	8b 8d a0 fe ff ff    	mov    -0x160(%ebp),%ecx
+80101319:	89 08                	mov    %ecx,(%eax)
+  p->exeip = exe;
+8010131b:	89 b8 c8 00 00 00    	mov    %edi,0xc8(%eax)
+  memmove(p->seg, seg, sizeof(seg));
+80101321:	05 cc 00 00 00       	add    $0xcc,%eax
+80101326:	83 c4 0c             	add    $0xc,%esp
+80101329:	6a 50                	push   $0x50
+8010132b:	8d 95 b4 fe ff ff    	lea    -0x14c(%ebp),%edx
+80101331:	52                   	push   %edx
+80101332:	50                   	push   %eax
+80101333:	e8 37 6a 00 00       	call   80107d6f <memmove>
+  p->nseg = nseg;
+80101338:	8b 45 08             	mov    0x8(%ebp),%eax
+8010133b:	8b 8d 9c fe ff ff    	mov    -0x164(%ebp),%ecx
+80101341:	89 88 1c 01 00 00    	mov    %ecx,0x11c(%eax)
+  p->tf->eip = elf.entry;  // main
+80101347:	8b 40 18             	mov    0x18(%eax),%eax
+8010134a:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80101350:	89 50 38             	mov    %edx,0x38(%eax)
+  p->tf->esp = sp;
+80101353:	8b 45 08             	mov    0x8(%ebp),%eax
+80101356:	8b 40 18             	mov    0x18(%eax),%eax
+80101359:	8b 8d a4 fe ff ff    	mov    -0x15c(%ebp),%ecx
+8010135f:	89 48 44             	mov    %ecx,0x44(%eax)
+  if(p == myproc())
+80101362:	e8 71 46 00 00       	call   801059d8 <myproc>
+80101367:	83 c4 10             	add    $0x10,%esp
+8010136a:	39 45 08             	cmp    %eax,0x8(%ebp)
+8010136d:	74 45                	je     801013b4 <execinto+0x3f4>
+    switchuvm(p);
+  if(oldpgdir)
+8010136f:	85 db                	test   %ebx,%ebx
+80101371:	74 0c                	je     8010137f <execinto+0x3bf>
+    freevm(oldpgdir);
+80101373:	83 ec 0c             	sub    $0xc,%esp
+80101376:	53                   	push   %ebx
+80101377:	e8 d9 93 00 00       	call   8010a755 <freevm>
+8010137c:	83 c4 10             	add    $0x10,%esp
+  if(oldexe){
+8010137f:	8b 9d 98 fe ff ff    	mov    -0x168(%ebp),%ebx
+80101385:	85 db                	test   %ebx,%ebx
+80101387:	0f 84 45 01 00 00    	je     801014d2 <execinto+0x512>
+    iexec(oldexe, -1);
+8010138d:	83 ec 08             	sub    $0x8,%esp
+80101390:	6a ff                	push   $0xffffffff
+80101392:	53                   	push   %ebx
+80101393:	e8 16 0e 00 00       	call   801021ae <iexec>
+    begin_op();
+80101398:	e8 44 30 00 00       	call   801043e1 <begin_op>
+    iput(oldexe);
+8010139d:	89 1c 24             	mov    %ebx,(%esp)
+801013a0:	e8 40 0f 00 00       	call   801022e5 <iput>
+    end_op();
+801013a5:	e8 c1 30 00 00       	call   8010446b <end_op>
+801013aa:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+801013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+801013b2:	eb 6c                	jmp    80101420 <execinto+0x460>
+    switchuvm(p);
+801013b4:	83 ec 0c             	sub    $0xc,%esp
+801013b7:	ff 75 08             	push   0x8(%ebp)
+801013ba:	e8 96 90 00 00       	call   8010a455 <switchuvm>
+801013bf:	83 c4 10             	add    $0x10,%esp
+801013c2:	eb ab                	jmp    8010136f <execinto+0x3af>
+  exe = 0;
+801013c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  pgdir = 0;
+801013c9:	be 00 00 00 00       	mov    $0x0,%esi
+
+ bad:
+  if(pgdir)
+801013ce:	85 f6                	test   %esi,%esi
+801013d0:	74 0c                	je     801013de <execinto+0x41e>
+    freevm(pgdir);
+801013d2:	83 ec 0c             	sub    $0xc,%esp
+801013d5:	56                   	push   %esi
+801013d6:	e8 7a 93 00 00       	call   8010a755 <freevm>
+801013db:	83 c4 10             	add    $0x10,%esp
+  if(ip){
+801013de:	85 ff                	test   %edi,%edi
+801013e0:	74 11                	je     801013f3 <execinto+0x433>
+    iunlockput(ip);
+801013e2:	83 ec 0c             	sub    $0xc,%esp
+801013e5:	57                   	push   %edi
+801013e6:	e8 28 10 00 00       	call   80102413 <iunlockput>
+    end_op();
+801013eb:	e8 7b 30 00 00       	call   8010446b <end_op>
+801013f0:	83 c4 10             	add    $0x10,%esp
+  }
+  if(exe){
+801013f3:	85 db                	test   %ebx,%ebx
+801013f5:	0f 84 e1 00 00 00    	je     801014dc <execinto+0x51c>
+    iexec(exe, -1);
+801013fb:	83 ec 08             	sub    $0x8,%esp
+801013fe:	6a ff                	push   $0xffffffff
+80101400:	53                   	push   %ebx
+80101401:	e8 a8 0d 00 00       	call   801021ae <iexec>
+    begin_op();
+80101406:	e8 d6 2f 00 00       	call   801043e1 <begin_op>
+    iput(exe);
+8010140b:	89 1c 24             	mov    %ebx,(%esp)
+8010140e:	e8 d2 0e 00 00       	call   801022e5 <iput>
+    end_op();
+80101413:	e8 53 30 00 00       	call   8010446b <end_op>
+80101418:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+8010141b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101423:	5b                   	pop    %ebx
+80101424:	5e                   	pop    %esi
+80101425:	5f                   	pop    %edi
+80101426:	5d                   	pop    %ebp
+80101427:	c3                   	ret
+  exe = 0;
+80101428:	89 c3                	mov    %eax,%ebx
+8010142a:	eb a2                	jmp    801013ce <execinto+0x40e>
+8010142c:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+80101432:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+80101438:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010143d:	eb 8f                	jmp    801013ce <execinto+0x40e>
+8010143f:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+80101445:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+8010144b:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101450:	e9 79 ff ff ff       	jmp    801013ce <execinto+0x40e>
+80101455:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+8010145b:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+80101461:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101466:	e9 63 ff ff ff       	jmp    801013ce <execinto+0x40e>
+8010146b:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+80101471:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+80101477:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010147c:	e9 4d ff ff ff       	jmp    801013ce <execinto+0x40e>
+80101481:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+80101487:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+8010148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101492:	e9 37 ff ff ff       	jmp    801013ce <execinto+0x40e>
+80101497:	8b bd a0 fe ff ff    	mov    -0x160(%ebp),%edi
+8010149d:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+801014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+801014a8:	e9 21 ff ff ff       	jmp    801013ce <execinto+0x40e>
+  exe = ip;
+801014ad:	8b bd 98 fe ff ff    	mov    -0x168(%ebp),%edi
+801014b3:	8b b5 a4 fe ff ff    	mov    -0x15c(%ebp),%esi
+801014b9:	89 fb                	mov    %edi,%ebx
+  ip = 0;
+801014bb:	bf 00 00 00 00       	mov    $0x0,%edi
+801014c0:	e9 09 ff ff ff       	jmp    801013ce <execinto+0x40e>
+  exe = ip;
+801014c5:	89 fb                	mov    %edi,%ebx
+  ip = 0;
+801014c7:	8b bd 94 fe ff ff    	mov    -0x16c(%ebp),%edi
+801014cd:	e9 fc fe ff ff       	jmp    801013ce <execinto+0x40e>
+  return 0;
+801014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+801014d7:	e9 44 ff ff ff       	jmp    80101420 <execinto+0x460>
+  return -1;
+801014dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801014e1:	e9 3a ff ff ff       	jmp    80101420 <execinto+0x460>
+
+801014e6 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+801014e6:	55                   	push   %ebp
+801014e7:	89 e5                	mov    %esp,%ebp
+801014e9:	83 ec 08             	sub    $0x8,%esp
+  return execinto(myproc(), path, argv);
+801014ec:	e8 e7 44 00 00       	call   801059d8 <myproc>
+801014f1:	83 ec 04             	sub    $0x4,%esp
+801014f4:	ff 75 0c             	push   0xc(%ebp)
+801014f7:	ff 75 08             	push   0x8(%ebp)
+801014fa:	50                   	push   %eax
+801014fb:	e8 c0 fa ff ff       	call   80100fc0 <execinto>
+}
+80101500:	c9                   	leave
+80101501:	c3                   	ret
+
+80101502 <fileinit>:
+
+static struct slabcache filecache = SLABCACHE("file", sizeof(struct file));
+
+void
+fileinit(void)
+{
+80101502:	55                   	push   %ebp
+80101503:	89 e5                	mov    %esp,%ebp
+80101505:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101508:	68 ed ad 10 80       	push   $0x8010aded
+8010150d:	68 40 41 12 80       	push   $0x80124140
+80101512:	e8 bb 65 00 00       	call   80107ad2 <initlock>
+}
+80101517:	83 c4 10             	add    $0x10,%esp
+8010151a:	c9                   	leave
+8010151b:	c3                   	ret
+
+8010151c <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+8010151c:	55                   	push   %ebp
+8010151d:	89 e5                	mov    %esp,%ebp
+8010151f:	53                   	push   %ebx
+80101520:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  if((f = slaballoc(&filecache)) == 0)
+80101523:	68 00 d0 10 80       	push   $0x8010d000
+80101528:	e8 22 63 00 00       	call   8010784f <slaballoc>
+8010152d:	89 c3                	mov    %eax,%ebx
+8010152f:	83 c4 10             	add    $0x10,%esp
+80101532:	85 c0                	test   %eax,%eax
+80101534:	74 17                	je     8010154d <filealloc+0x31>
+    return 0;
+  memset(f, 0, sizeof(*f));
+80101536:	83 ec 04             	sub    $0x4,%esp
+80101539:	6a 18                	push   $0x18
+8010153b:	6a 00                	push   $0x0
+8010153d:	50                   	push   %eax
+8010153e:	e8 b4 67 00 00       	call   80107cf7 <memset>
+  f->ref = 1;
+80101543:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+  return f;
+8010154a:	83 c4 10             	add    $0x10,%esp
+}
+8010154d:	89 d8                	mov    %ebx,%eax
+8010154f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101552:	c9                   	leave
+80101553:	c3                   	ret
+
+80101554 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101554:	55                   	push   %ebp
+80101555:	89 e5                	mov    %esp,%ebp
+80101557:	53                   	push   %ebx
+80101558:	83 ec 10             	sub    $0x10,%esp
+8010155b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010155e:	68 40 41 12 80       	push   $0x80124140
+80101563:	e8 b5 66 00 00       	call   80107c1d <acquire>
+  if(f->ref < 1)
+80101568:	8b 43 04             	mov    0x4(%ebx),%eax
+8010156b:	83 c4 10             	add    $0x10,%esp
+8010156e:	85 c0                	test   %eax,%eax
+80101570:	7e 1a                	jle    8010158c <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80101572:	83 c0 01             	add    $0x1,%eax
+80101575:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101578:	83 ec 0c             	sub    $0xc,%esp
+8010157b:	68 40 41 12 80       	push   $0x80124140
+80101580:	e8 17 67 00 00       	call   80107c9c <release>
+  return f;
+}
+80101585:	89 d8                	mov    %ebx,%eax
+80101587:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010158a:	c9                   	leave
+8010158b:	c3                   	ret
+    panic("filedup");
+8010158c:	83 ec 0c             	sub    $0xc,%esp
+8010158f:	68 f4 ad 10 80       	push   $0x8010adf4
+80101594:	e8 69 f3 ff ff       	call   80100902 <panic>
+
+80101599 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101599:	55                   	push   %ebp
+8010159a:	89 e5                	mov    %esp,%ebp
+8010159c:	53                   	push   %ebx
+8010159d:	83 ec 30             	sub    $0x30,%esp
+801015a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+801015a3:	68 40 41 12 80       	push   $0x80124140
+801015a8:	e8 70 66 00 00       	call   80107c1d <acquire>
+  if(f->ref < 1)
+801015ad:	8b 43 04             	mov    0x4(%ebx),%eax
+801015b0:	83 c4 10             	add    $0x10,%esp
+801015b3:	85 c0                	test   %eax,%eax
+801015b5:	0f 8e 83 00 00 00    	jle    8010163e <fileclose+0xa5>
+    panic("fileclose");
+  if(--f->ref > 0){
+801015bb:	83 e8 01             	sub    $0x1,%eax
+801015be:	89 43 04             	mov    %eax,0x4(%ebx)
+801015c1:	85 c0                	test   %eax,%eax
+801015c3:	0f 8f 82 00 00 00    	jg     8010164b <fileclose+0xb2>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+801015c9:	8b 03                	mov    (%ebx),%eax
+801015cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801015ce:	8b 43 04             	mov    0x4(%ebx),%eax
+801015d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801015d4:	8b 43 08             	mov    0x8(%ebx),%eax
+801015d7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801015da:	8b 43 0c             	mov    0xc(%ebx),%eax
+801015dd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+801015e0:	8b 43 10             	mov    0x10(%ebx),%eax
+801015e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+801015e6:	8b 43 14             	mov    0x14(%ebx),%eax
+801015e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  f->ref = 0;
+801015ec:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+801015f3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&ftable.lock);
+801015f9:	83 ec 0c             	sub    $0xc,%esp
+801015fc:	68 40 41 12 80       	push   $0x80124140
+80101601:	e8 96 66 00 00       	call   80107c9c <release>
+  slabfree(&filecache, f);
+80101606:	83 c4 08             	add    $0x8,%esp
+80101609:	53                   	push   %ebx
+8010160a:	68 00 d0 10 80       	push   $0x8010d000
+8010160f:	e8 07 63 00 00       	call   8010791b <slabfree>
+
+  if(ff.type == FD_PIPE)
+80101614:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101617:	83 c4 10             	add    $0x10,%esp
+8010161a:	83 f8 01             	cmp    $0x1,%eax
+8010161d:	74 41                	je     80101660 <fileclose+0xc7>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+8010161f:	83 f8 02             	cmp    $0x2,%eax
+80101622:	75 37                	jne    8010165b <fileclose+0xc2>
+    begin_op();
+80101624:	e8 b8 2d 00 00       	call   801043e1 <begin_op>
+    iput(ff.ip);
+80101629:	83 ec 0c             	sub    $0xc,%esp
+8010162c:	ff 75 f0             	push   -0x10(%ebp)
+8010162f:	e8 b1 0c 00 00       	call   801022e5 <iput>
+    end_op();
+80101634:	e8 32 2e 00 00       	call   8010446b <end_op>
+80101639:	83 c4 10             	add    $0x10,%esp
+8010163c:	eb 1d                	jmp    8010165b <fileclose+0xc2>
+    panic("fileclose");
+8010163e:	83 ec 0c             	sub    $0xc,%esp
+80101641:	68 fc ad 10 80       	push   $0x8010adfc
+80101646:	e8 b7 f2 ff ff       	call   80100902 <panic>
+    release(&ftable.lock);
+8010164b:	83 ec 0c             	sub    $0xc,%esp
+8010164e:	68 40 41 12 80       	push   $0x80124140
+80101653:	e8 44 66 00 00       	call   80107c9c <release>
+    return;
+80101658:	83 c4 10             	add    $0x10,%esp
+  }
+}
+8010165b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010165e:	c9                   	leave
+8010165f:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+80101660:	83 ec 08             	sub    $0x8,%esp
+80101663:	0f be 45 e9          	movsbl -0x17(%ebp),%eax
+80101667:	50                   	push   %eax
+80101668:	ff 75 ec             	push   -0x14(%ebp)
+8010166b:	e8 bb 39 00 00       	call   8010502b <pipeclose>
+80101670:	83 c4 10             	add    $0x10,%esp
+80101673:	eb e6                	jmp    8010165b <fileclose+0xc2>
+
+80101675 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101675:	55                   	push   %ebp
+80101676:	89 e5                	mov    %esp,%ebp
+80101678:	53                   	push   %ebx
+80101679:	83 ec 04             	sub    $0x4,%esp
+8010167c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010167f:	83 3b 02             	cmpl   $0x2,(%ebx)
+80101682:	75 31                	jne    801016b5 <filestat+0x40>
+    ilock(f->ip);
+80101684:	83 ec 0c             	sub    $0xc,%esp
+80101687:	ff 73 10             	push   0x10(%ebx)
+8010168a:	e8 2e 0b 00 00       	call   801021bd <ilock>
+    stati(f->ip, st);
+8010168f:	83 c4 08             	add    $0x8,%esp
+80101692:	ff 75 0c             	push   0xc(%ebp)
+80101695:	ff 73 10             	push   0x10(%ebx)
+80101698:	e8 96 0d 00 00       	call   80102433 <stati>
+    iunlock(f->ip);
+8010169d:	83 c4 04             	add    $0x4,%esp
+801016a0:	ff 73 10             	push   0x10(%ebx)
+801016a3:	e8 f8 0b 00 00       	call   801022a0 <iunlock>
+    return 0;
+801016a8:	83 c4 10             	add    $0x10,%esp
+801016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+801016b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801016b3:	c9                   	leave
+801016b4:	c3                   	ret
+  return -1;
+801016b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801016ba:	eb f4                	jmp    801016b0 <filestat+0x3b>
+
+801016bc <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+801016bc:	55                   	push   %ebp
+801016bd:	89 e5                	mov    %esp,%ebp
+801016bf:	56                   	push   %esi
+801016c0:	53                   	push   %ebx
+801016c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  if(f->readable == 0)
+801016c4:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801016c8:	74 70                	je     8010173a <fileread+0x7e>
+    return -1;
+  if(f->type == FD_PIPE)
+801016ca:	8b 03                	mov    (%ebx),%eax
+801016cc:	83 f8 01             	cmp    $0x1,%eax
+801016cf:	74 44                	je     80101715 <fileread+0x59>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801016d1:	83 f8 02             	cmp    $0x2,%eax
+801016d4:	75 57                	jne    8010172d <fileread+0x71>
+    ilock(f->ip);
+801016d6:	83 ec 0c             	sub    $0xc,%esp
+801016d9:	ff 73 10             	push   0x10(%ebx)
+801016dc:	e8 dc 0a 00 00       	call   801021bd <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+801016e1:	ff 75 10             	push   0x10(%ebp)
+801016e4:	ff 73 14             	push   0x14(%ebx)
+801016e7:	ff 75 0c             	push   0xc(%ebp)
+801016ea:	ff 73 10             	push   0x10(%ebx)
+801016ed:	e8 6f 0d 00 00       	call   80102461 <readi>
+801016f2:	89 c6                	mov    %eax,%esi
+801016f4:	83 c4 20             	add    $0x20,%esp
+801016f7:	85 c0                	test   %eax,%eax
+801016f9:	7e 03                	jle    801016fe <fileread+0x42>
+      f->off += r;
+801016fb:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801016fe:	83 ec 0c             	sub    $0xc,%esp
+80101701:	ff 73 10             	push   0x10(%ebx)
+80101704:	e8 97 0b 00 00       	call   801022a0 <iunlock>
+    return r;
+80101709:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+8010170c:	89 f0                	mov    %esi,%eax
+8010170e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101711:	5b                   	pop    %ebx
+80101712:	5e                   	pop    %esi
+80101713:	5d                   	pop    %ebp
+80101714:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80101715:	83 ec 04             	sub    $0x4,%esp
+80101718:	ff 75 10             	push   0x10(%ebp)
+8010171b:	ff 75 0c             	push   0xc(%ebp)
+8010171e:	ff 73 0c             	push   0xc(%ebx)
+80101721:	e8 5c 3a 00 00       	call   80105182 <piperead>
+80101726:	89 c6                	mov    %eax,%esi
+80101728:	83 c4 10             	add    $0x10,%esp
+8010172b:	eb df                	jmp    8010170c <fileread+0x50>
+  panic("fileread");
+8010172d:	83 ec 0c             	sub    $0xc,%esp
+80101730:	68 06 ae 10 80       	push   $0x8010ae06
+80101735:	e8 c8 f1 ff ff       	call   80100902 <panic>
+    return -1;
+8010173a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010173f:	eb cb                	jmp    8010170c <fileread+0x50>
+
+80101741 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101741:	55                   	push   %ebp
+80101742:	89 e5                	mov    %esp,%ebp
+80101744:	57                   	push   %edi
+80101745:	56                   	push   %esi
+80101746:	53                   	push   %ebx
+80101747:	83 ec 1c             	sub    $0x1c,%esp
+8010174a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+
+  if(f->writable == 0)
+8010174d:	80 7e 09 00          	cmpb   $0x0,0x9(%esi)
+80101751:	0f 84 cc 00 00 00    	je     80101823 <filewrite+0xe2>
+    return -1;
+  if(f->type == FD_PIPE)
+80101757:	8b 06                	mov    (%esi),%eax
+80101759:	83 f8 01             	cmp    $0x1,%eax
+8010175c:	74 10                	je     8010176e <filewrite+0x2d>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010175e:	83 f8 02             	cmp    $0x2,%eax
+80101761:	0f 85 af 00 00 00    	jne    80101816 <filewrite+0xd5>
+    // i-node, two levels of indirect block, allocation
+    // blocks, and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-2-2) / 2) * 512;
+    int i = 0;
+80101767:	bf 00 00 00 00       	mov    $0x0,%edi
+8010176c:	eb 67                	jmp    801017d5 <filewrite+0x94>
+    return pipewrite(f->pipe, addr, n);
+8010176e:	83 ec 04             	sub    $0x4,%esp
+80101771:	ff 75 10             	push   0x10(%ebp)
+80101774:	ff 75 0c             	push   0xc(%ebp)
+80101777:	ff 76 0c             	push   0xc(%esi)
+8010177a:	e8 3e 39 00 00       	call   801050bd <pipewrite>
+8010177f:	83 c4 10             	add    $0x10,%esp
+80101782:	e9 82 00 00 00       	jmp    80101809 <filewrite+0xc8>
+    while(i < n){
+      int n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+
+      begin_op();
+80101787:	e8 55 2c 00 00       	call   801043e1 <begin_op>
+      ilock(f->ip);
+8010178c:	83 ec 0c             	sub    $0xc,%esp
+8010178f:	ff 76 10             	push   0x10(%esi)
+80101792:	e8 26 0a 00 00       	call   801021bd <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80101797:	ff 75 e4             	push   -0x1c(%ebp)
+8010179a:	ff 76 14             	push   0x14(%esi)
+8010179d:	89 f8                	mov    %edi,%eax
+8010179f:	03 45 0c             	add    0xc(%ebp),%eax
+801017a2:	50                   	push   %eax
+801017a3:	ff 76 10             	push   0x10(%esi)
+801017a6:	e8 b5 0d 00 00       	call   80102560 <writei>
+801017ab:	89 c3                	mov    %eax,%ebx
+801017ad:	83 c4 20             	add    $0x20,%esp
+801017b0:	85 c0                	test   %eax,%eax
+801017b2:	7e 03                	jle    801017b7 <filewrite+0x76>
+        f->off += r;
+801017b4:	01 46 14             	add    %eax,0x14(%esi)
+      iunlock(f->ip);
+801017b7:	83 ec 0c             	sub    $0xc,%esp
+801017ba:	ff 76 10             	push   0x10(%esi)
+801017bd:	e8 de 0a 00 00       	call   801022a0 <iunlock>
+      end_op();
+801017c2:	e8 a4 2c 00 00       	call   8010446b <end_op>
+
+      if(r < 0)
+801017c7:	83 c4 10             	add    $0x10,%esp
+801017ca:	85 db                	test   %ebx,%ebx
+801017cc:	78 31                	js     801017ff <filewrite+0xbe>
+        break;
+      if(r != n1)
+801017ce:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+801017d1:	75 1f                	jne    801017f2 <filewrite+0xb1>
+        panic("short filewrite");
+      i += r;
+801017d3:	01 df                	add    %ebx,%edi
+    while(i < n){
+801017d5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+801017d8:	7d 25                	jge    801017ff <filewrite+0xbe>
+      int n1 = n - i;
+801017da:	8b 45 10             	mov    0x10(%ebp),%eax
+801017dd:	29 f8                	sub    %edi,%eax
+801017df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(n1 > max)
+801017e2:	3d 00 04 00 00       	cmp    $0x400,%eax
+801017e7:	7e 9e                	jle    80101787 <filewrite+0x46>
+        n1 = max;
+801017e9:	c7 45 e4 00 04 00 00 	movl   $0x400,-0x1c(%ebp)
+801017f0:	eb 95                	jmp    80101787 <filewrite+0x46>
+        panic("short filewrite");
+801017f2:	83 ec 0c             	sub    $0xc,%esp
+801017f5:	68 0f ae 10 80       	push   $0x8010ae0f
+801017fa:	e8 03 f1 ff ff       	call   80100902 <panic>
+    }
+    return i == n ? n : -1;
+801017ff:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80101802:	74 0d                	je     80101811 <filewrite+0xd0>
+80101804:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  panic("filewrite");
+}
+80101809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010180c:	5b                   	pop    %ebx
+8010180d:	5e                   	pop    %esi
+8010180e:	5f                   	pop    %edi
+8010180f:	5d                   	pop    %ebp
+80101810:	c3                   	ret
+    return i == n ? n : -1;
+80101811:	8b 45 10             	mov    0x10(%ebp),%eax
+80101814:	eb f3                	jmp    80101809 <filewrite+0xc8>
+  panic("filewrite");
+80101816:	83 ec 0c             	sub    $0xc,%esp
+80101819:	68 15 ae 10 80       	push   $0x8010ae15
+8010181e:	e8 df f0 ff ff       	call   80100902 <panic>
+    return -1;
+80101823:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101828:	eb df                	jmp    80101809 <filewrite+0xc8>
+
+8010182a <lruunlink>:
+static struct slabcache inodecache = SLABCACHE("inode", sizeof(struct inode));
+
+static void
+lruunlink(struct inode *ip)
+{
+  if(ip->lruprev)
+8010182a:	8b 50 18             	mov    0x18(%eax),%edx
+8010182d:	85 d2                	test   %edx,%edx
+8010182f:	74 2f                	je     80101860 <lruunlink+0x36>
+    ip->lruprev->lrunext = ip->lrunext;
+80101831:	8b 48 14             	mov    0x14(%eax),%ecx
+80101834:	89 4a 14             	mov    %ecx,0x14(%edx)
+  else
+    icache.lru = ip->lrunext;
+  if(ip->lrunext)
+80101837:	8b 50 14             	mov    0x14(%eax),%edx
+8010183a:	85 d2                	test   %edx,%edx
+8010183c:	74 2d                	je     8010186b <lruunlink+0x41>
+    ip->lrunext->lruprev = ip->lruprev;
+8010183e:	8b 48 18             	mov    0x18(%eax),%ecx
+80101841:	89 4a 18             	mov    %ecx,0x18(%edx)
+  else
+    icache.lrutail = ip->lruprev;
+  ip->lrunext = ip->lruprev = 0;
+80101844:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+8010184b:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  icache.nlru--;
+80101852:	a1 54 d6 10 80       	mov    0x8010d654,%eax
+80101857:	83 e8 01             	sub    $0x1,%eax
+8010185a:	a3 54 d6 10 80       	mov    %eax,0x8010d654
+}
+8010185f:	c3                   	ret
+    icache.lru = ip->lrunext;
+80101860:	8b 50 14             	mov    0x14(%eax),%edx
+80101863:	89 15 4c d6 10 80    	mov    %edx,0x8010d64c
+80101869:	eb cc                	jmp    80101837 <lruunlink+0xd>
+    icache.lrutail = ip->lruprev;
+8010186b:	8b 50 18             	mov    0x18(%eax),%edx
+8010186e:	89 15 50 d6 10 80    	mov    %edx,0x8010d650
+80101874:	eb ce                	jmp    80101844 <lruunlink+0x1a>
+
+80101876 <unhash>:
+
+static void
+unhash(struct inode *ip)
+{
+80101876:	89 c1                	mov    %eax,%ecx
+  struct inode **pp;
+
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+80101878:	8b 10                	mov    (%eax),%edx
+8010187a:	89 d0                	mov    %edx,%eax
+8010187c:	c1 e0 05             	shl    $0x5,%eax
+8010187f:	29 d0                	sub    %edx,%eax
+80101881:	03 41 04             	add    0x4(%ecx),%eax
+80101884:	83 e0 3f             	and    $0x3f,%eax
+80101887:	8d 14 85 4c d5 10 80 	lea    -0x7fef2ab4(,%eax,4),%edx
+8010188e:	eb 03                	jmp    80101893 <unhash+0x1d>
+80101890:	8d 50 10             	lea    0x10(%eax),%edx
+80101893:	8b 02                	mov    (%edx),%eax
+80101895:	39 c8                	cmp    %ecx,%eax
+80101897:	75 f7                	jne    80101890 <unhash+0x1a>
+    ;
+  *pp = ip->hnext;
+80101899:	8b 41 10             	mov    0x10(%ecx),%eax
+8010189c:	89 02                	mov    %eax,(%edx)
+}
+8010189e:	c3                   	ret
+
+8010189f <ievict>:
+// Drop the least recently used unreferenced entry from the
+// cache and return its memory, or 0 if there is none.
+// Caller must hold icache.lock.
+static struct inode*
+ievict(void)
+{
+8010189f:	55                   	push   %ebp
+801018a0:	89 e5                	mov    %esp,%ebp
+801018a2:	53                   	push   %ebx
+801018a3:	83 ec 04             	sub    $0x4,%esp
+  struct inode *ip;
+
+  if((ip = icache.lrutail) == 0)
+801018a6:	8b 1d 50 d6 10 80    	mov    0x8010d650,%ebx
+801018ac:	85 db                	test   %ebx,%ebx
+801018ae:	74 0e                	je     801018be <ievict+0x1f>
+    return 0;
+  lruunlink(ip);
+801018b0:	89 d8                	mov    %ebx,%eax
+801018b2:	e8 73 ff ff ff       	call   8010182a <lruunlink>
+  unhash(ip);
+801018b7:	89 d8                	mov    %ebx,%eax
+801018b9:	e8 b8 ff ff ff       	call   80101876 <unhash>
+  return ip;
+}
+801018be:	89 d8                	mov    %ebx,%eax
+801018c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801018c3:	c9                   	leave
+801018c4:	c3                   	ret
+
+801018c5 <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+801018c5:	55                   	push   %ebp
+801018c6:	89 e5                	mov    %esp,%ebp
+801018c8:	57                   	push   %edi
+801018c9:	56                   	push   %esi
+801018ca:	53                   	push   %ebx
+801018cb:	83 ec 0c             	sub    $0xc,%esp
+801018ce:	89 d6                	mov    %edx,%esi
+  char *s;
+  int len;
+
+  while(*path == '/')
+801018d0:	eb 03                	jmp    801018d5 <skipelem+0x10>
+    path++;
+801018d2:	83 c0 01             	add    $0x1,%eax
+  while(*path == '/')
+801018d5:	0f b6 10             	movzbl (%eax),%edx
+801018d8:	80 fa 2f             	cmp    $0x2f,%dl
+801018db:	74 f5                	je     801018d2 <skipelem+0xd>
+  if(*path == 0)
+801018dd:	84 d2                	test   %dl,%dl
+801018df:	74 53                	je     80101934 <skipelem+0x6f>
+801018e1:	89 c3                	mov    %eax,%ebx
+801018e3:	eb 03                	jmp    801018e8 <skipelem+0x23>
+    return 0;
+  s = path;
+  while(*path != '/' && *path != 0)
+    path++;
+801018e5:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+801018e8:	0f b6 13             	movzbl (%ebx),%edx
+801018eb:	80 fa 2f             	cmp    $0x2f,%dl
+801018ee:	74 04                	je     801018f4 <skipelem+0x2f>
+801018f0:	84 d2                	test   %dl,%dl
+801018f2:	75 f1                	jne    801018e5 <skipelem+0x20>
+  len = path - s;
+801018f4:	89 df                	mov    %ebx,%edi
+801018f6:	29 c7                	sub    %eax,%edi
+  if(len >= DIRSIZ)
+801018f8:	83 ff 0d             	cmp    $0xd,%edi
+801018fb:	7e 11                	jle    8010190e <skipelem+0x49>
+    memmove(name, s, DIRSIZ);
+801018fd:	83 ec 04             	sub    $0x4,%esp
+80101900:	6a 0e                	push   $0xe
+80101902:	50                   	push   %eax
+80101903:	56                   	push   %esi
+80101904:	e8 66 64 00 00       	call   80107d6f <memmove>
+80101909:	83 c4 10             	add    $0x10,%esp
+8010190c:	eb 17                	jmp    80101925 <skipelem+0x60>
+  else {
+    memmove(name, s, len);
+8010190e:	83 ec 04             	sub    $0x4,%esp
+80101911:	57                   	push   %edi
+80101912:	50                   	push   %eax
+80101913:	56                   	push   %esi
+80101914:	e8 56 64 00 00       	call   80107d6f <memmove>
+    name[len] = 0;
+80101919:	c6 04 3e 00          	movb   $0x0,(%esi,%edi,1)
+8010191d:	83 c4 10             	add    $0x10,%esp
+80101920:	eb 03                	jmp    80101925 <skipelem+0x60>
+  }
+  while(*path == '/')
+    path++;
+80101922:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101925:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101928:	74 f8                	je     80101922 <skipelem+0x5d>
+  return path;
+}
+8010192a:	89 d8                	mov    %ebx,%eax
+8010192c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010192f:	5b                   	pop    %ebx
+80101930:	5e                   	pop    %esi
+80101931:	5f                   	pop    %edi
+80101932:	5d                   	pop    %ebp
+80101933:	c3                   	ret
+    return 0;
+80101934:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101939:	eb ef                	jmp    8010192a <skipelem+0x65>
+
+8010193b <bfree>:
+{
+8010193b:	55                   	push   %ebp
+8010193c:	89 e5                	mov    %esp,%ebp
+8010193e:	56                   	push   %esi
+8010193f:	53                   	push   %ebx
+80101940:	89 c3                	mov    %eax,%ebx
+80101942:	89 d6                	mov    %edx,%esi
+  bp = breadmeta(dev, BBLOCK(b, sb));
+80101944:	89 d0                	mov    %edx,%eax
+80101946:	c1 e8 0c             	shr    $0xc,%eax
+80101949:	83 ec 08             	sub    $0x8,%esp
+8010194c:	03 05 08 42 12 80    	add    0x80124208,%eax
+80101952:	50                   	push   %eax
+80101953:	53                   	push   %ebx
+80101954:	e8 76 eb ff ff       	call   801004cf <breadmeta>
+80101959:	89 c3                	mov    %eax,%ebx
+  bi = b % BPB;
+8010195b:	89 f2                	mov    %esi,%edx
+8010195d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  m = 1 << (bi % 8);
+80101963:	89 f1                	mov    %esi,%ecx
+80101965:	83 e1 07             	and    $0x7,%ecx
+80101968:	b8 01 00 00 00       	mov    $0x1,%eax
+8010196d:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+8010196f:	83 c4 10             	add    $0x10,%esp
+80101972:	c1 fa 03             	sar    $0x3,%edx
+80101975:	0f b6 8c 13 80 00 00 	movzbl 0x80(%ebx,%edx,1),%ecx
+8010197c:	00 
+8010197d:	0f b6 f1             	movzbl %cl,%esi
+80101980:	85 c6                	test   %eax,%esi
+80101982:	74 26                	je     801019aa <bfree+0x6f>
+  bp->data[bi/8] &= ~m;
+80101984:	f7 d0                	not    %eax
+80101986:	21 c8                	and    %ecx,%eax
+80101988:	88 84 13 80 00 00 00 	mov    %al,0x80(%ebx,%edx,1)
+  log_write(bp);
+8010198f:	83 ec 0c             	sub    $0xc,%esp
+80101992:	53                   	push   %ebx
+80101993:	e8 a1 2b 00 00       	call   80104539 <log_write>
+  brelse(bp);
+80101998:	89 1c 24             	mov    %ebx,(%esp)
+8010199b:	e8 6f ec ff ff       	call   8010060f <brelse>
+}
+801019a0:	83 c4 10             	add    $0x10,%esp
+801019a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801019a6:	5b                   	pop    %ebx
+801019a7:	5e                   	pop    %esi
+801019a8:	5d                   	pop    %ebp
+801019a9:	c3                   	ret
+    panic("freeing free block");
+801019aa:	83 ec 0c             	sub    $0xc,%esp
+801019ad:	68 24 ae 10 80       	push   $0x8010ae24
+801019b2:	e8 4b ef ff ff       	call   80100902 <panic>
+
+801019b7 <iget>:
+{
+801019b7:	55                   	push   %ebp
+801019b8:	89 e5                	mov    %esp,%ebp
+801019ba:	57                   	push   %edi
+801019bb:	56                   	push   %esi
+801019bc:	53                   	push   %ebx
+801019bd:	83 ec 28             	sub    $0x28,%esp
+801019c0:	89 c6                	mov    %eax,%esi
+801019c2:	89 d7                	mov    %edx,%edi
+  acquire(&icache.lock);
+801019c4:	68 00 d5 10 80       	push   $0x8010d500
+801019c9:	e8 4f 62 00 00       	call   80107c1d <acquire>
+  head = &icache.hash[IHASH(dev, inum)];
+801019ce:	89 f0                	mov    %esi,%eax
+801019d0:	c1 e0 05             	shl    $0x5,%eax
+801019d3:	29 f0                	sub    %esi,%eax
+801019d5:	01 f8                	add    %edi,%eax
+801019d7:	83 e0 3f             	and    $0x3f,%eax
+801019da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(ip = *head; ip; ip = ip->hnext){
+801019dd:	8b 1c 85 4c d5 10 80 	mov    -0x7fef2ab4(,%eax,4),%ebx
+801019e4:	83 c4 10             	add    $0x10,%esp
+801019e7:	eb 0c                	jmp    801019f5 <iget+0x3e>
+        lruunlink(ip);
+801019e9:	89 d8                	mov    %ebx,%eax
+801019eb:	e8 3a fe ff ff       	call   8010182a <lruunlink>
+801019f0:	eb 1d                	jmp    80101a0f <iget+0x58>
+  for(ip = *head; ip; ip = ip->hnext){
+801019f2:	8b 5b 10             	mov    0x10(%ebx),%ebx
+801019f5:	85 db                	test   %ebx,%ebx
+801019f7:	74 28                	je     80101a21 <iget+0x6a>
+    if(ip->dev == dev && ip->inum == inum){
+801019f9:	39 33                	cmp    %esi,(%ebx)
+801019fb:	75 f5                	jne    801019f2 <iget+0x3b>
+801019fd:	39 7b 04             	cmp    %edi,0x4(%ebx)
+80101a00:	75 f0                	jne    801019f2 <iget+0x3b>
+      if(ip->ref++ == 0)
+80101a02:	8b 43 08             	mov    0x8(%ebx),%eax
+80101a05:	8d 50 01             	lea    0x1(%eax),%edx
+80101a08:	89 53 08             	mov    %edx,0x8(%ebx)
+80101a0b:	85 c0                	test   %eax,%eax
+80101a0d:	74 da                	je     801019e9 <iget+0x32>
+      release(&icache.lock);
+80101a0f:	83 ec 0c             	sub    $0xc,%esp
+80101a12:	68 00 d5 10 80       	push   $0x8010d500
+80101a17:	e8 80 62 00 00       	call   80107c9c <release>
+      return ip;
+80101a1c:	83 c4 10             	add    $0x10,%esp
+80101a1f:	eb 70                	jmp    80101a91 <iget+0xda>
+  if((ip = slaballoc(&inodecache)) == 0 && (ip = ievict()) == 0)
+80101a21:	83 ec 0c             	sub    $0xc,%esp
+80101a24:	68 80 d2 10 80       	push   $0x8010d280
+80101a29:	e8 21 5e 00 00       	call   8010784f <slaballoc>
+80101a2e:	89 c3                	mov    %eax,%ebx
+80101a30:	83 c4 10             	add    $0x10,%esp
+80101a33:	85 c0                	test   %eax,%eax
+80101a35:	74 64                	je     80101a9b <iget+0xe4>
+  memset(ip, 0, sizeof(*ip));
+80101a37:	83 ec 04             	sub    $0x4,%esp
+80101a3a:	68 d0 00 00 00       	push   $0xd0
+80101a3f:	6a 00                	push   $0x0
+80101a41:	53                   	push   %ebx
+80101a42:	e8 b0 62 00 00       	call   80107cf7 <memset>
+  initsleeplock(&ip->lock, "inode");
+80101a47:	83 c4 08             	add    $0x8,%esp
+80101a4a:	68 47 ae 10 80       	push   $0x8010ae47
+80101a4f:	8d 43 1c             	lea    0x1c(%ebx),%eax
+80101a52:	50                   	push   %eax
+80101a53:	e8 6f 5f 00 00       	call   801079c7 <initsleeplock>
+  ip->dev = dev;
+80101a58:	89 33                	mov    %esi,(%ebx)
+  ip->inum = inum;
+80101a5a:	89 7b 04             	mov    %edi,0x4(%ebx)
+  ip->ref = 1;
+80101a5d:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  ip->valid = 0;
+80101a64:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+  ip->hnext = *head;
+80101a6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101a6e:	83 c0 10             	add    $0x10,%eax
+80101a71:	8b 14 85 0c d5 10 80 	mov    -0x7fef2af4(,%eax,4),%edx
+80101a78:	89 53 10             	mov    %edx,0x10(%ebx)
+  *head = ip;
+80101a7b:	89 1c 85 0c d5 10 80 	mov    %ebx,-0x7fef2af4(,%eax,4)
+  release(&icache.lock);
+80101a82:	c7 04 24 00 d5 10 80 	movl   $0x8010d500,(%esp)
+80101a89:	e8 0e 62 00 00       	call   80107c9c <release>
+  return ip;
+80101a8e:	83 c4 10             	add    $0x10,%esp
+}
+80101a91:	89 d8                	mov    %ebx,%eax
+80101a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a96:	5b                   	pop    %ebx
+80101a97:	5e                   	pop    %esi
+80101a98:	5f                   	pop    %edi
+80101a99:	5d                   	pop    %ebp
+80101a9a:	c3                   	ret
+  if((ip = slaballoc(&inodecache)) == 0 && (ip = ievict()) == 0)
+80101a9b:	e8 ff fd ff ff       	call   8010189f <ievict>
+80101aa0:	89 c3                	mov    %eax,%ebx
+80101aa2:	85 c0                	test   %eax,%eax
+80101aa4:	75 91                	jne    80101a37 <iget+0x80>
+    panic("iget: no inodes");
+80101aa6:	83 ec 0c             	sub    $0xc,%esp
+80101aa9:	68 37 ae 10 80       	push   $0x8010ae37
+80101aae:	e8 4f ee ff ff       	call   80100902 <panic>
+
+80101ab3 <bzero>:
+{
+80101ab3:	55                   	push   %ebp
+80101ab4:	89 e5                	mov    %esp,%ebp
+80101ab6:	53                   	push   %ebx
+80101ab7:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, bno);
+80101aba:	52                   	push   %edx
+80101abb:	50                   	push   %eax
+80101abc:	e8 f6 e9 ff ff       	call   801004b7 <bread>
+80101ac1:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80101ac3:	8d 80 80 00 00 00    	lea    0x80(%eax),%eax
+80101ac9:	83 c4 0c             	add    $0xc,%esp
+80101acc:	68 00 02 00 00       	push   $0x200
+80101ad1:	6a 00                	push   $0x0
+80101ad3:	50                   	push   %eax
+80101ad4:	e8 1e 62 00 00       	call   80107cf7 <memset>
+  log_write(bp);
+80101ad9:	89 1c 24             	mov    %ebx,(%esp)
+80101adc:	e8 58 2a 00 00       	call   80104539 <log_write>
+  brelse(bp);
+80101ae1:	89 1c 24             	mov    %ebx,(%esp)
+80101ae4:	e8 26 eb ff ff       	call   8010060f <brelse>
+}
+80101ae9:	83 c4 10             	add    $0x10,%esp
+80101aec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101aef:	c9                   	leave
+80101af0:	c3                   	ret
+
+80101af1 <balloc>:
+{
+80101af1:	55                   	push   %ebp
+80101af2:	89 e5                	mov    %esp,%ebp
+80101af4:	57                   	push   %edi
+80101af5:	56                   	push   %esi
+80101af6:	53                   	push   %ebx
+80101af7:	83 ec 1c             	sub    $0x1c,%esp
+80101afa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101afd:	be 00 00 00 00       	mov    $0x0,%esi
+80101b02:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80101b05:	eb 15                	jmp    80101b1c <balloc+0x2b>
+    brelse(bp);
+80101b07:	83 ec 0c             	sub    $0xc,%esp
+80101b0a:	ff 75 e0             	push   -0x20(%ebp)
+80101b0d:	e8 fd ea ff ff       	call   8010060f <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80101b12:	81 45 e4 00 10 00 00 	addl   $0x1000,-0x1c(%ebp)
+80101b19:	83 c4 10             	add    $0x10,%esp
+80101b1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101b1f:	3b 05 f0 41 12 80    	cmp    0x801241f0,%eax
+80101b25:	73 71                	jae    80101b98 <balloc+0xa7>
+    bp = breadmeta(dev, BBLOCK(b, sb));
+80101b27:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101b2a:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+80101b30:	85 db                	test   %ebx,%ebx
+80101b32:	0f 49 c3             	cmovns %ebx,%eax
+80101b35:	c1 f8 0c             	sar    $0xc,%eax
+80101b38:	83 ec 08             	sub    $0x8,%esp
+80101b3b:	03 05 08 42 12 80    	add    0x80124208,%eax
+80101b41:	50                   	push   %eax
+80101b42:	ff 75 dc             	push   -0x24(%ebp)
+80101b45:	e8 85 e9 ff ff       	call   801004cf <breadmeta>
+80101b4a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b4d:	83 c4 10             	add    $0x10,%esp
+80101b50:	b8 00 00 00 00       	mov    $0x0,%eax
+80101b55:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80101b5a:	7f ab                	jg     80101b07 <balloc+0x16>
+80101b5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101b5f:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+80101b62:	3b 1d f0 41 12 80    	cmp    0x801241f0,%ebx
+80101b68:	73 9d                	jae    80101b07 <balloc+0x16>
+      m = 1 << (bi % 8);
+80101b6a:	89 c1                	mov    %eax,%ecx
+80101b6c:	83 e1 07             	and    $0x7,%ecx
+80101b6f:	be 01 00 00 00       	mov    $0x1,%esi
+80101b74:	d3 e6                	shl    %cl,%esi
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b76:	8d 50 07             	lea    0x7(%eax),%edx
+80101b79:	85 c0                	test   %eax,%eax
+80101b7b:	0f 49 d0             	cmovns %eax,%edx
+80101b7e:	c1 fa 03             	sar    $0x3,%edx
+80101b81:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80101b84:	0f b6 8c 17 80 00 00 	movzbl 0x80(%edi,%edx,1),%ecx
+80101b8b:	00 
+80101b8c:	0f b6 f9             	movzbl %cl,%edi
+80101b8f:	85 f7                	test   %esi,%edi
+80101b91:	74 12                	je     80101ba5 <balloc+0xb4>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b93:	83 c0 01             	add    $0x1,%eax
+80101b96:	eb bd                	jmp    80101b55 <balloc+0x64>
+  panic("balloc: out of blocks");
+80101b98:	83 ec 0c             	sub    $0xc,%esp
+80101b9b:	68 4d ae 10 80       	push   $0x8010ae4d
+80101ba0:	e8 5d ed ff ff       	call   80100902 <panic>
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101ba5:	89 c8                	mov    %ecx,%eax
+80101ba7:	89 f1                	mov    %esi,%ecx
+80101ba9:	09 c1                	or     %eax,%ecx
+80101bab:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101bae:	88 8c 16 80 00 00 00 	mov    %cl,0x80(%esi,%edx,1)
+        log_write(bp);
+80101bb5:	83 ec 0c             	sub    $0xc,%esp
+80101bb8:	56                   	push   %esi
+80101bb9:	e8 7b 29 00 00       	call   80104539 <log_write>
+        brelse(bp);
+80101bbe:	89 34 24             	mov    %esi,(%esp)
+80101bc1:	e8 49 ea ff ff       	call   8010060f <brelse>
+        bzero(dev, b + bi);
+80101bc6:	89 da                	mov    %ebx,%edx
+80101bc8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101bcb:	e8 e3 fe ff ff       	call   80101ab3 <bzero>
+}
+80101bd0:	89 d8                	mov    %ebx,%eax
+80101bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101bd5:	5b                   	pop    %ebx
+80101bd6:	5e                   	pop    %esi
+80101bd7:	5f                   	pop    %edi
+80101bd8:	5d                   	pop    %ebp
+80101bd9:	c3                   	ret
+
+80101bda <indirect>:
+{
+80101bda:	55                   	push   %ebp
+80101bdb:	89 e5                	mov    %esp,%ebp
+80101bdd:	57                   	push   %edi
+80101bde:	56                   	push   %esi
+80101bdf:	53                   	push   %ebx
+80101be0:	83 ec 24             	sub    $0x24,%esp
+80101be3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101be6:	89 ce                	mov    %ecx,%esi
+  bp = breadmeta(ip->dev, addr);
+80101be8:	52                   	push   %edx
+80101be9:	ff 30                	push   (%eax)
+80101beb:	e8 df e8 ff ff       	call   801004cf <breadmeta>
+80101bf0:	89 c3                	mov    %eax,%ebx
+  if((addr = a[i]) == 0){
+80101bf2:	8d bc b0 80 00 00 00 	lea    0x80(%eax,%esi,4),%edi
+80101bf9:	8b 37                	mov    (%edi),%esi
+80101bfb:	83 c4 10             	add    $0x10,%esp
+80101bfe:	85 f6                	test   %esi,%esi
+80101c00:	74 13                	je     80101c15 <indirect+0x3b>
+  brelse(bp);
+80101c02:	83 ec 0c             	sub    $0xc,%esp
+80101c05:	53                   	push   %ebx
+80101c06:	e8 04 ea ff ff       	call   8010060f <brelse>
+}
+80101c0b:	89 f0                	mov    %esi,%eax
+80101c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c10:	5b                   	pop    %ebx
+80101c11:	5e                   	pop    %esi
+80101c12:	5f                   	pop    %edi
+80101c13:	5d                   	pop    %ebp
+80101c14:	c3                   	ret
+    a[i] = addr = balloc(ip->dev);
+80101c15:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101c18:	8b 00                	mov    (%eax),%eax
+80101c1a:	e8 d2 fe ff ff       	call   80101af1 <balloc>
+80101c1f:	89 c6                	mov    %eax,%esi
+80101c21:	89 07                	mov    %eax,(%edi)
+    log_write(bp);
+80101c23:	83 ec 0c             	sub    $0xc,%esp
+80101c26:	53                   	push   %ebx
+80101c27:	e8 0d 29 00 00       	call   80104539 <log_write>
+80101c2c:	83 c4 10             	add    $0x10,%esp
+80101c2f:	eb d1                	jmp    80101c02 <indirect+0x28>
+
+80101c31 <bmap>:
+{
+80101c31:	55                   	push   %ebp
+80101c32:	89 e5                	mov    %esp,%ebp
+80101c34:	57                   	push   %edi
+80101c35:	56                   	push   %esi
+80101c36:	53                   	push   %ebx
+80101c37:	83 ec 0c             	sub    $0xc,%esp
+80101c3a:	89 c6                	mov    %eax,%esi
+80101c3c:	89 d3                	mov    %edx,%ebx
+  if(bn < NDIRECT){
+80101c3e:	83 fa 0a             	cmp    $0xa,%edx
+80101c41:	76 72                	jbe    80101cb5 <bmap+0x84>
+  bn -= NDIRECT;
+80101c43:	8d 7a f5             	lea    -0xb(%edx),%edi
+  if(bn < NINDIRECT){
+80101c46:	83 ff 7f             	cmp    $0x7f,%edi
+80101c49:	0f 86 81 00 00 00    	jbe    80101cd0 <bmap+0x9f>
+  bn -= NINDIRECT;
+80101c4f:	81 eb 8b 00 00 00    	sub    $0x8b,%ebx
+  if(bn < NDINDIRECT){
+80101c55:	81 fb ff 3f 00 00    	cmp    $0x3fff,%ebx
+80101c5b:	0f 87 a9 00 00 00    	ja     80101d0a <bmap+0xd9>
+    if(ip->l1addr == 0 || ip->l1idx != bn / NINDIRECT){
+80101c61:	83 b8 c8 00 00 00 00 	cmpl   $0x0,0xc8(%eax)
+80101c68:	74 0d                	je     80101c77 <bmap+0x46>
+80101c6a:	89 d8                	mov    %ebx,%eax
+80101c6c:	c1 e8 07             	shr    $0x7,%eax
+80101c6f:	39 86 c4 00 00 00    	cmp    %eax,0xc4(%esi)
+80101c75:	74 24                	je     80101c9b <bmap+0x6a>
+      if((addr = ip->addrs[NDIRECT+1]) == 0)
+80101c77:	8b 96 b4 00 00 00    	mov    0xb4(%esi),%edx
+80101c7d:	85 d2                	test   %edx,%edx
+80101c7f:	74 75                	je     80101cf6 <bmap+0xc5>
+      ip->l1addr = indirect(ip, addr, bn / NINDIRECT);
+80101c81:	89 df                	mov    %ebx,%edi
+80101c83:	c1 ef 07             	shr    $0x7,%edi
+80101c86:	89 f9                	mov    %edi,%ecx
+80101c88:	89 f0                	mov    %esi,%eax
+80101c8a:	e8 4b ff ff ff       	call   80101bda <indirect>
+80101c8f:	89 86 c8 00 00 00    	mov    %eax,0xc8(%esi)
+      ip->l1idx = bn / NINDIRECT;
+80101c95:	89 be c4 00 00 00    	mov    %edi,0xc4(%esi)
+    return indirect(ip, ip->l1addr, bn % NINDIRECT);
+80101c9b:	89 d9                	mov    %ebx,%ecx
+80101c9d:	83 e1 7f             	and    $0x7f,%ecx
+80101ca0:	8b 96 c8 00 00 00    	mov    0xc8(%esi),%edx
+80101ca6:	89 f0                	mov    %esi,%eax
+80101ca8:	e8 2d ff ff ff       	call   80101bda <indirect>
+}
+80101cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101cb0:	5b                   	pop    %ebx
+80101cb1:	5e                   	pop    %esi
+80101cb2:	5f                   	pop    %edi
+80101cb3:	5d                   	pop    %ebp
+80101cb4:	c3                   	ret
+    if((addr = ip->addrs[bn]) == 0)
+80101cb5:	8b 84 90 84 00 00 00 	mov    0x84(%eax,%edx,4),%eax
+80101cbc:	85 c0                	test   %eax,%eax
+80101cbe:	75 ed                	jne    80101cad <bmap+0x7c>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101cc0:	8b 06                	mov    (%esi),%eax
+80101cc2:	e8 2a fe ff ff       	call   80101af1 <balloc>
+80101cc7:	89 84 9e 84 00 00 00 	mov    %eax,0x84(%esi,%ebx,4)
+    return addr;
+80101cce:	eb dd                	jmp    80101cad <bmap+0x7c>
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101cd0:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+80101cd6:	85 d2                	test   %edx,%edx
+80101cd8:	74 0b                	je     80101ce5 <bmap+0xb4>
+    return indirect(ip, addr, bn);
+80101cda:	89 f9                	mov    %edi,%ecx
+80101cdc:	89 f0                	mov    %esi,%eax
+80101cde:	e8 f7 fe ff ff       	call   80101bda <indirect>
+80101ce3:	eb c8                	jmp    80101cad <bmap+0x7c>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101ce5:	8b 00                	mov    (%eax),%eax
+80101ce7:	e8 05 fe ff ff       	call   80101af1 <balloc>
+80101cec:	89 c2                	mov    %eax,%edx
+80101cee:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+80101cf4:	eb e4                	jmp    80101cda <bmap+0xa9>
+        ip->addrs[NDIRECT+1] = addr = balloc(ip->dev);
+80101cf6:	8b 06                	mov    (%esi),%eax
+80101cf8:	e8 f4 fd ff ff       	call   80101af1 <balloc>
+80101cfd:	89 c2                	mov    %eax,%edx
+80101cff:	89 86 b4 00 00 00    	mov    %eax,0xb4(%esi)
+80101d05:	e9 77 ff ff ff       	jmp    80101c81 <bmap+0x50>
+  panic("bmap: out of range");
+80101d0a:	83 ec 0c             	sub    $0xc,%esp
+80101d0d:	68 63 ae 10 80       	push   $0x8010ae63
+80101d12:	e8 eb eb ff ff       	call   80100902 <panic>
+
+80101d17 <readahead>:
+{
+80101d17:	55                   	push   %ebp
+80101d18:	89 e5                	mov    %esp,%ebp
+80101d1a:	57                   	push   %edi
+80101d1b:	56                   	push   %esi
+80101d1c:	53                   	push   %ebx
+80101d1d:	83 ec 0c             	sub    $0xc,%esp
+80101d20:	89 c3                	mov    %eax,%ebx
+80101d22:	89 d0                	mov    %edx,%eax
+  if(bn + 1 == ip->ranext)
+80101d24:	8d 52 01             	lea    0x1(%edx),%edx
+80101d27:	8b 8b b8 00 00 00    	mov    0xb8(%ebx),%ecx
+80101d2d:	39 ca                	cmp    %ecx,%edx
+80101d2f:	74 1e                	je     80101d4f <readahead+0x38>
+  if(bn != ip->ranext){
+80101d31:	39 c1                	cmp    %eax,%ecx
+80101d33:	74 22                	je     80101d57 <readahead+0x40>
+    ip->ranext = bn + 1;
+80101d35:	89 93 b8 00 00 00    	mov    %edx,0xb8(%ebx)
+    ip->raend = 0;
+80101d3b:	c7 83 bc 00 00 00 00 	movl   $0x0,0xbc(%ebx)
+80101d42:	00 00 00 
+    ip->rawin = 0;
+80101d45:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+80101d4c:	00 00 00 
+}
+80101d4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d52:	5b                   	pop    %ebx
+80101d53:	5e                   	pop    %esi
+80101d54:	5f                   	pop    %edi
+80101d55:	5d                   	pop    %ebp
+80101d56:	c3                   	ret
+  ip->ranext = bn + 1;
+80101d57:	89 93 b8 00 00 00    	mov    %edx,0xb8(%ebx)
+  if(ip->raend > bn + ip->rawin / 2)
+80101d5d:	8b b3 bc 00 00 00    	mov    0xbc(%ebx),%esi
+80101d63:	8b 8b c0 00 00 00    	mov    0xc0(%ebx),%ecx
+80101d69:	89 cf                	mov    %ecx,%edi
+80101d6b:	d1 ef                	shr    %edi
+80101d6d:	01 c7                	add    %eax,%edi
+80101d6f:	39 f7                	cmp    %esi,%edi
+80101d71:	72 dc                	jb     80101d4f <readahead+0x38>
+  ip->rawin = ip->rawin ? ip->rawin * 2 : RAMIN;
+80101d73:	85 c9                	test   %ecx,%ecx
+80101d75:	74 3c                	je     80101db3 <readahead+0x9c>
+80101d77:	01 c9                	add    %ecx,%ecx
+80101d79:	89 8b c0 00 00 00    	mov    %ecx,0xc0(%ebx)
+  if(ip->rawin > RAMAX)
+80101d7f:	83 f9 20             	cmp    $0x20,%ecx
+80101d82:	76 0a                	jbe    80101d8e <readahead+0x77>
+    ip->rawin = RAMAX;
+80101d84:	c7 83 c0 00 00 00 20 	movl   $0x20,0xc0(%ebx)
+80101d8b:	00 00 00 
+  nb = (ip->size + BSIZE - 1) / BSIZE;
+80101d8e:	8b 8b 80 00 00 00    	mov    0x80(%ebx),%ecx
+80101d94:	8d b9 ff 01 00 00    	lea    0x1ff(%ecx),%edi
+80101d9a:	c1 ef 09             	shr    $0x9,%edi
+  end = bn + 1 + ip->rawin;
+80101d9d:	03 83 c0 00 00 00    	add    0xc0(%ebx),%eax
+80101da3:	83 c0 01             	add    $0x1,%eax
+  if(end > nb)
+80101da6:	39 c7                	cmp    %eax,%edi
+80101da8:	72 02                	jb     80101dac <readahead+0x95>
+  end = bn + 1 + ip->rawin;
+80101daa:	89 c7                	mov    %eax,%edi
+  b = ip->raend > bn + 1 ? ip->raend : bn + 1;
+80101dac:	39 f2                	cmp    %esi,%edx
+80101dae:	0f 43 f2             	cmovae %edx,%esi
+  for(; b < end; b++)
+80101db1:	eb 21                	jmp    80101dd4 <readahead+0xbd>
+  ip->rawin = ip->rawin ? ip->rawin * 2 : RAMIN;
+80101db3:	b9 04 00 00 00       	mov    $0x4,%ecx
+80101db8:	eb bf                	jmp    80101d79 <readahead+0x62>
+    bprefetch(ip->dev, bmap(ip, b));
+80101dba:	89 f2                	mov    %esi,%edx
+80101dbc:	89 d8                	mov    %ebx,%eax
+80101dbe:	e8 6e fe ff ff       	call   80101c31 <bmap>
+80101dc3:	83 ec 08             	sub    $0x8,%esp
+80101dc6:	50                   	push   %eax
+80101dc7:	ff 33                	push   (%ebx)
+80101dc9:	e8 79 e8 ff ff       	call   80100647 <bprefetch>
+  for(; b < end; b++)
+80101dce:	83 c6 01             	add    $0x1,%esi
+80101dd1:	83 c4 10             	add    $0x10,%esp
+80101dd4:	39 fe                	cmp    %edi,%esi
+80101dd6:	72 e2                	jb     80101dba <readahead+0xa3>
+  ip->raend = end;
+80101dd8:	89 bb bc 00 00 00    	mov    %edi,0xbc(%ebx)
+80101dde:	e9 6c ff ff ff       	jmp    80101d4f <readahead+0x38>
+
+80101de3 <breadi>:
+{
+80101de3:	55                   	push   %ebp
+80101de4:	89 e5                	mov    %esp,%ebp
+80101de6:	53                   	push   %ebx
+80101de7:	83 ec 04             	sub    $0x4,%esp
+80101dea:	89 c3                	mov    %eax,%ebx
+  if(ip->type == T_DIR)
+80101dec:	66 83 78 78 01       	cmpw   $0x1,0x78(%eax)
+80101df1:	74 18                	je     80101e0b <breadi+0x28>
+  return bread(ip->dev, bmap(ip, bn));
+80101df3:	e8 39 fe ff ff       	call   80101c31 <bmap>
+80101df8:	83 ec 08             	sub    $0x8,%esp
+80101dfb:	50                   	push   %eax
+80101dfc:	ff 33                	push   (%ebx)
+80101dfe:	e8 b4 e6 ff ff       	call   801004b7 <bread>
+80101e03:	83 c4 10             	add    $0x10,%esp
+}
+80101e06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101e09:	c9                   	leave
+80101e0a:	c3                   	ret
+    return breadmeta(ip->dev, bmap(ip, bn));
+80101e0b:	e8 21 fe ff ff       	call   80101c31 <bmap>
+80101e10:	83 ec 08             	sub    $0x8,%esp
+80101e13:	50                   	push   %eax
+80101e14:	ff 33                	push   (%ebx)
+80101e16:	e8 b4 e6 ff ff       	call   801004cf <breadmeta>
+80101e1b:	83 c4 10             	add    $0x10,%esp
+80101e1e:	eb e6                	jmp    80101e06 <breadi+0x23>
+
+80101e20 <readsb>:
+{
+80101e20:	55                   	push   %ebp
+80101e21:	89 e5                	mov    %esp,%ebp
+80101e23:	53                   	push   %ebx
+80101e24:	83 ec 0c             	sub    $0xc,%esp
+  bp = breadmeta(dev, 1);
+80101e27:	6a 01                	push   $0x1
+80101e29:	ff 75 08             	push   0x8(%ebp)
+80101e2c:	e8 9e e6 ff ff       	call   801004cf <breadmeta>
+80101e31:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101e33:	8d 80 80 00 00 00    	lea    0x80(%eax),%eax
+80101e39:	83 c4 0c             	add    $0xc,%esp
+80101e3c:	6a 1c                	push   $0x1c
+80101e3e:	50                   	push   %eax
+80101e3f:	ff 75 0c             	push   0xc(%ebp)
+80101e42:	e8 28 5f 00 00       	call   80107d6f <memmove>
+  brelse(bp);
+80101e47:	89 1c 24             	mov    %ebx,(%esp)
+80101e4a:	e8 c0 e7 ff ff       	call   8010060f <brelse>
+}
+80101e4f:	83 c4 10             	add    $0x10,%esp
+80101e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101e55:	c9                   	leave
+80101e56:	c3                   	ret
+
+80101e57 <iinit>:
+{
+80101e57:	55                   	push   %ebp
+80101e58:	89 e5                	mov    %esp,%ebp
+80101e5a:	83 ec 10             	sub    $0x10,%esp
+  readsb(dev, &sb);
+80101e5d:	68 f0 41 12 80       	push   $0x801241f0
+80101e62:	ff 75 08             	push   0x8(%ebp)
+80101e65:	e8 b6 ff ff ff       	call   80101e20 <readsb>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101e6a:	ff 35 08 42 12 80    	push   0x80124208
+80101e70:	ff 35 04 42 12 80    	push   0x80124204
+80101e76:	ff 35 00 42 12 80    	push   0x80124200
+80101e7c:	ff 35 fc 41 12 80    	push   0x801241fc
+80101e82:	ff 35 f8 41 12 80    	push   0x801241f8
+80101e88:	ff 35 f4 41 12 80    	push   0x801241f4
+80101e8e:	ff 35 f0 41 12 80    	push   0x801241f0
+80101e94:	68 dc ae 10 80       	push   $0x8010aedc
+80101e99:	e8 5b ee ff ff       	call   80100cf9 <cprintf>
+}
+80101e9e:	83 c4 30             	add    $0x30,%esp
+80101ea1:	c9                   	leave
+80101ea2:	c3                   	ret
+
+80101ea3 <ialloc>:
+{
+80101ea3:	55                   	push   %ebp
+80101ea4:	89 e5                	mov    %esp,%ebp
+80101ea6:	57                   	push   %edi
+80101ea7:	56                   	push   %esi
+80101ea8:	53                   	push   %ebx
+80101ea9:	83 ec 1c             	sub    $0x1c,%esp
+80101eac:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101eaf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101eb2:	bb 01 00 00 00       	mov    $0x1,%ebx
+80101eb7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101eba:	3b 1d f8 41 12 80    	cmp    0x801241f8,%ebx
+80101ec0:	73 42                	jae    80101f04 <ialloc+0x61>
+    bp = breadmeta(dev, IBLOCK(inum, sb));
+80101ec2:	89 d8                	mov    %ebx,%eax
+80101ec4:	c1 e8 03             	shr    $0x3,%eax
+80101ec7:	83 ec 08             	sub    $0x8,%esp
+80101eca:	03 05 04 42 12 80    	add    0x80124204,%eax
+80101ed0:	50                   	push   %eax
+80101ed1:	ff 75 08             	push   0x8(%ebp)
+80101ed4:	e8 f6 e5 ff ff       	call   801004cf <breadmeta>
+80101ed9:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101edb:	89 d8                	mov    %ebx,%eax
+80101edd:	83 e0 07             	and    $0x7,%eax
+80101ee0:	c1 e0 06             	shl    $0x6,%eax
+80101ee3:	8d bc 06 80 00 00 00 	lea    0x80(%esi,%eax,1),%edi
+    if(dip->type == 0){  // a free inode
+80101eea:	83 c4 10             	add    $0x10,%esp
+80101eed:	66 83 3f 00          	cmpw   $0x0,(%edi)
+80101ef1:	74 1e                	je     80101f11 <ialloc+0x6e>
+    brelse(bp);
+80101ef3:	83 ec 0c             	sub    $0xc,%esp
+80101ef6:	56                   	push   %esi
+80101ef7:	e8 13 e7 ff ff       	call   8010060f <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101efc:	83 c3 01             	add    $0x1,%ebx
+80101eff:	83 c4 10             	add    $0x10,%esp
+80101f02:	eb b3                	jmp    80101eb7 <ialloc+0x14>
+  panic("ialloc: no inodes");
+80101f04:	83 ec 0c             	sub    $0xc,%esp
+80101f07:	68 76 ae 10 80       	push   $0x8010ae76
+80101f0c:	e8 f1 e9 ff ff       	call   80100902 <panic>
+      memset(dip, 0, sizeof(*dip));
+80101f11:	83 ec 04             	sub    $0x4,%esp
+80101f14:	6a 40                	push   $0x40
+80101f16:	6a 00                	push   $0x0
+80101f18:	57                   	push   %edi
+80101f19:	e8 d9 5d 00 00       	call   80107cf7 <memset>
+      dip->type = type;
+80101f1e:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+80101f22:	66 89 07             	mov    %ax,(%edi)
+      log_write(bp);   // mark it allocated on the disk
+80101f25:	89 34 24             	mov    %esi,(%esp)
+80101f28:	e8 0c 26 00 00       	call   80104539 <log_write>
+      brelse(bp);
+80101f2d:	89 34 24             	mov    %esi,(%esp)
+80101f30:	e8 da e6 ff ff       	call   8010060f <brelse>
+      return iget(dev, inum);
+80101f35:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101f38:	8b 45 08             	mov    0x8(%ebp),%eax
+80101f3b:	e8 77 fa ff ff       	call   801019b7 <iget>
+}
+80101f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101f43:	5b                   	pop    %ebx
+80101f44:	5e                   	pop    %esi
+80101f45:	5f                   	pop    %edi
+80101f46:	5d                   	pop    %ebp
+80101f47:	c3                   	ret
+
+80101f48 <iupdate>:
+{
+80101f48:	55                   	push   %ebp
+80101f49:	89 e5                	mov    %esp,%ebp
+80101f4b:	56                   	push   %esi
+80101f4c:	53                   	push   %ebx
+80101f4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = breadmeta(ip->dev, IBLOCK(ip->inum, sb));
+80101f50:	8b 43 04             	mov    0x4(%ebx),%eax
+80101f53:	c1 e8 03             	shr    $0x3,%eax
+80101f56:	83 ec 08             	sub    $0x8,%esp
+80101f59:	03 05 04 42 12 80    	add    0x80124204,%eax
+80101f5f:	50                   	push   %eax
+80101f60:	ff 33                	push   (%ebx)
+80101f62:	e8 68 e5 ff ff       	call   801004cf <breadmeta>
+80101f67:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80101f69:	8b 43 04             	mov    0x4(%ebx),%eax
+80101f6c:	83 e0 07             	and    $0x7,%eax
+80101f6f:	c1 e0 06             	shl    $0x6,%eax
+80101f72:	8d 84 06 80 00 00 00 	lea    0x80(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80101f79:	0f b7 53 78          	movzwl 0x78(%ebx),%edx
+80101f7d:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80101f80:	0f b7 53 7a          	movzwl 0x7a(%ebx),%edx
+80101f84:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+80101f88:	0f b7 53 7c          	movzwl 0x7c(%ebx),%edx
+80101f8c:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+80101f90:	0f b7 53 7e          	movzwl 0x7e(%ebx),%edx
+80101f94:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+80101f98:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80101f9e:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101fa1:	81 c3 84 00 00 00    	add    $0x84,%ebx
+80101fa7:	83 c0 0c             	add    $0xc,%eax
+80101faa:	83 c4 0c             	add    $0xc,%esp
+80101fad:	6a 34                	push   $0x34
+80101faf:	53                   	push   %ebx
+80101fb0:	50                   	push   %eax
+80101fb1:	e8 b9 5d 00 00       	call   80107d6f <memmove>
+  log_write(bp);
+80101fb6:	89 34 24             	mov    %esi,(%esp)
+80101fb9:	e8 7b 25 00 00       	call   80104539 <log_write>
+  brelse(bp);
+80101fbe:	89 34 24             	mov    %esi,(%esp)
+80101fc1:	e8 49 e6 ff ff       	call   8010060f <brelse>
+}
+80101fc6:	83 c4 10             	add    $0x10,%esp
+80101fc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101fcc:	5b                   	pop    %ebx
+80101fcd:	5e                   	pop    %esi
+80101fce:	5d                   	pop    %ebp
+80101fcf:	c3                   	ret
+
+80101fd0 <itrunc>:
+{
+80101fd0:	55                   	push   %ebp
+80101fd1:	89 e5                	mov    %esp,%ebp
+80101fd3:	57                   	push   %edi
+80101fd4:	56                   	push   %esi
+80101fd5:	53                   	push   %ebx
+80101fd6:	83 ec 2c             	sub    $0x2c,%esp
+80101fd9:	89 c7                	mov    %eax,%edi
+  if(ip->pcached)
+80101fdb:	83 b8 cc 00 00 00 00 	cmpl   $0x0,0xcc(%eax)
+80101fe2:	75 07                	jne    80101feb <itrunc+0x1b>
+{
+80101fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101fe9:	eb 11                	jmp    80101ffc <itrunc+0x2c>
+    pcinval(ip);
+80101feb:	83 ec 0c             	sub    $0xc,%esp
+80101fee:	50                   	push   %eax
+80101fef:	e8 53 2c 00 00       	call   80104c47 <pcinval>
+80101ff4:	83 c4 10             	add    $0x10,%esp
+80101ff7:	eb eb                	jmp    80101fe4 <itrunc+0x14>
+  for(i = 0; i < NDIRECT; i++){
+80101ff9:	83 c3 01             	add    $0x1,%ebx
+80101ffc:	83 fb 0a             	cmp    $0xa,%ebx
+80101fff:	7f 1f                	jg     80102020 <itrunc+0x50>
+    if(ip->addrs[i]){
+80102001:	8b 94 9f 84 00 00 00 	mov    0x84(%edi,%ebx,4),%edx
+80102008:	85 d2                	test   %edx,%edx
+8010200a:	74 ed                	je     80101ff9 <itrunc+0x29>
+      bfree(ip->dev, ip->addrs[i]);
+8010200c:	8b 07                	mov    (%edi),%eax
+8010200e:	e8 28 f9 ff ff       	call   8010193b <bfree>
+      ip->addrs[i] = 0;
+80102013:	c7 84 9f 84 00 00 00 	movl   $0x0,0x84(%edi,%ebx,4)
+8010201a:	00 00 00 00 
+8010201e:	eb d9                	jmp    80101ff9 <itrunc+0x29>
+  if(ip->addrs[NDIRECT]){
+80102020:	8b 87 b0 00 00 00    	mov    0xb0(%edi),%eax
+80102026:	85 c0                	test   %eax,%eax
+80102028:	75 36                	jne    80102060 <itrunc+0x90>
+  if(ip->addrs[NDIRECT+1]){
+8010202a:	8b 87 b4 00 00 00    	mov    0xb4(%edi),%eax
+80102030:	85 c0                	test   %eax,%eax
+80102032:	0f 85 89 00 00 00    	jne    801020c1 <itrunc+0xf1>
+  ip->l1addr = 0;
+80102038:	c7 87 c8 00 00 00 00 	movl   $0x0,0xc8(%edi)
+8010203f:	00 00 00 
+  ip->size = 0;
+80102042:	c7 87 80 00 00 00 00 	movl   $0x0,0x80(%edi)
+80102049:	00 00 00 
+  iupdate(ip);
+8010204c:	83 ec 0c             	sub    $0xc,%esp
+8010204f:	57                   	push   %edi
+80102050:	e8 f3 fe ff ff       	call   80101f48 <iupdate>
+}
+80102055:	83 c4 10             	add    $0x10,%esp
+80102058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010205b:	5b                   	pop    %ebx
+8010205c:	5e                   	pop    %esi
+8010205d:	5f                   	pop    %edi
+8010205e:	5d                   	pop    %ebp
+8010205f:	c3                   	ret
+    bp = breadmeta(ip->dev, ip->addrs[NDIRECT]);
+80102060:	83 ec 08             	sub    $0x8,%esp
+80102063:	50                   	push   %eax
+80102064:	ff 37                	push   (%edi)
+80102066:	e8 64 e4 ff ff       	call   801004cf <breadmeta>
+    a = (uint*)bp->data;
+8010206b:	8d b0 80 00 00 00    	lea    0x80(%eax),%esi
+    for(j = 0; j < NINDIRECT; j++){
+80102071:	83 c4 10             	add    $0x10,%esp
+80102074:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102079:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010207c:	eb 03                	jmp    80102081 <itrunc+0xb1>
+8010207e:	83 c3 01             	add    $0x1,%ebx
+80102081:	83 fb 7f             	cmp    $0x7f,%ebx
+80102084:	77 10                	ja     80102096 <itrunc+0xc6>
+      if(a[j])
+80102086:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+80102089:	85 d2                	test   %edx,%edx
+8010208b:	74 f1                	je     8010207e <itrunc+0xae>
+        bfree(ip->dev, a[j]);
+8010208d:	8b 07                	mov    (%edi),%eax
+8010208f:	e8 a7 f8 ff ff       	call   8010193b <bfree>
+80102094:	eb e8                	jmp    8010207e <itrunc+0xae>
+    brelse(bp);
+80102096:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102099:	83 ec 0c             	sub    $0xc,%esp
+8010209c:	50                   	push   %eax
+8010209d:	e8 6d e5 ff ff       	call   8010060f <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+801020a2:	8b 07                	mov    (%edi),%eax
+801020a4:	8b 97 b0 00 00 00    	mov    0xb0(%edi),%edx
+801020aa:	e8 8c f8 ff ff       	call   8010193b <bfree>
+    ip->addrs[NDIRECT] = 0;
+801020af:	c7 87 b0 00 00 00 00 	movl   $0x0,0xb0(%edi)
+801020b6:	00 00 00 
+801020b9:	83 c4 10             	add    $0x10,%esp
+801020bc:	e9 69 ff ff ff       	jmp    8010202a <itrunc+0x5a>
+    bp = breadmeta(ip->dev, ip->addrs[NDIRECT+1]);
+801020c1:	83 ec 08             	sub    $0x8,%esp
+801020c4:	50                   	push   %eax
+801020c5:	ff 37                	push   (%edi)
+801020c7:	e8 03 e4 ff ff       	call   801004cf <breadmeta>
+801020cc:	89 c3                	mov    %eax,%ebx
+    a = (uint*)bp->data;
+801020ce:	8d 80 80 00 00 00    	lea    0x80(%eax),%eax
+801020d4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(i = 0; i < NINDIRECT; i++){
+801020d7:	83 c4 10             	add    $0x10,%esp
+801020da:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+801020e1:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+801020e4:	eb 37                	jmp    8010211d <itrunc+0x14d>
+      for(j = 0; j < NINDIRECT; j++){
+801020e6:	83 c3 01             	add    $0x1,%ebx
+801020e9:	83 fb 7f             	cmp    $0x7f,%ebx
+801020ec:	77 10                	ja     801020fe <itrunc+0x12e>
+        if(a2[j])
+801020ee:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+801020f1:	85 d2                	test   %edx,%edx
+801020f3:	74 f1                	je     801020e6 <itrunc+0x116>
+          bfree(ip->dev, a2[j]);
+801020f5:	8b 07                	mov    (%edi),%eax
+801020f7:	e8 3f f8 ff ff       	call   8010193b <bfree>
+801020fc:	eb e8                	jmp    801020e6 <itrunc+0x116>
+      brelse(bp2);
+801020fe:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102101:	83 ec 0c             	sub    $0xc,%esp
+80102104:	50                   	push   %eax
+80102105:	e8 05 e5 ff ff       	call   8010060f <brelse>
+      bfree(ip->dev, a[i]);
+8010210a:	8b 07                	mov    (%edi),%eax
+8010210c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010210f:	8b 11                	mov    (%ecx),%edx
+80102111:	e8 25 f8 ff ff       	call   8010193b <bfree>
+80102116:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NINDIRECT; i++){
+80102119:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+8010211d:	83 7d e4 7f          	cmpl   $0x7f,-0x1c(%ebp)
+80102121:	77 30                	ja     80102153 <itrunc+0x183>
+      if(a[i] == 0)
+80102123:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102126:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102129:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+8010212c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010212f:	8b 00                	mov    (%eax),%eax
+80102131:	85 c0                	test   %eax,%eax
+80102133:	74 e4                	je     80102119 <itrunc+0x149>
+      bp2 = breadmeta(ip->dev, a[i]);
+80102135:	83 ec 08             	sub    $0x8,%esp
+80102138:	50                   	push   %eax
+80102139:	ff 37                	push   (%edi)
+8010213b:	e8 8f e3 ff ff       	call   801004cf <breadmeta>
+      a2 = (uint*)bp2->data;
+80102140:	8d b0 80 00 00 00    	lea    0x80(%eax),%esi
+      for(j = 0; j < NINDIRECT; j++){
+80102146:	83 c4 10             	add    $0x10,%esp
+80102149:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010214e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102151:	eb 96                	jmp    801020e9 <itrunc+0x119>
+    brelse(bp);
+80102153:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80102156:	83 ec 0c             	sub    $0xc,%esp
+80102159:	53                   	push   %ebx
+8010215a:	e8 b0 e4 ff ff       	call   8010060f <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+8010215f:	8b 07                	mov    (%edi),%eax
+80102161:	8b 97 b4 00 00 00    	mov    0xb4(%edi),%edx
+80102167:	e8 cf f7 ff ff       	call   8010193b <bfree>
+    ip->addrs[NDIRECT+1] = 0;
+8010216c:	c7 87 b4 00 00 00 00 	movl   $0x0,0xb4(%edi)
+80102173:	00 00 00 
+80102176:	83 c4 10             	add    $0x10,%esp
+80102179:	e9 ba fe ff ff       	jmp    80102038 <itrunc+0x68>
+
+8010217e <idup>:
+{
+8010217e:	55                   	push   %ebp
+8010217f:	89 e5                	mov    %esp,%ebp
+80102181:	53                   	push   %ebx
+80102182:	83 ec 10             	sub    $0x10,%esp
+80102185:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+80102188:	68 00 d5 10 80       	push   $0x8010d500
+8010218d:	e8 8b 5a 00 00       	call   80107c1d <acquire>
+  ip->ref++;
+80102192:	8b 43 08             	mov    0x8(%ebx),%eax
+80102195:	83 c0 01             	add    $0x1,%eax
+80102198:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&icache.lock);
+8010219b:	c7 04 24 00 d5 10 80 	movl   $0x8010d500,(%esp)
+801021a2:	e8 f5 5a 00 00       	call   80107c9c <release>
+}
+801021a7:	89 d8                	mov    %ebx,%eax
+801021a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801021ac:	c9                   	leave
+801021ad:	c3                   	ret
+
+801021ae <iexec>:
+{
+801021ae:	55                   	push   %ebp
+801021af:	89 e5                	mov    %esp,%ebp
+801021b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&ip->nexec, n);
+801021b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801021b7:	f0 01 50 0c          	lock add %edx,0xc(%eax)
+}
+801021bb:	5d                   	pop    %ebp
+801021bc:	c3                   	ret
+
+801021bd <ilock>:
+{
+801021bd:	55                   	push   %ebp
+801021be:	89 e5                	mov    %esp,%ebp
+801021c0:	56                   	push   %esi
+801021c1:	53                   	push   %ebx
+801021c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+801021c5:	85 db                	test   %ebx,%ebx
+801021c7:	74 22                	je     801021eb <ilock+0x2e>
+801021c9:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+801021cd:	7e 1c                	jle    801021eb <ilock+0x2e>
+  acquiresleep(&ip->lock);
+801021cf:	83 ec 0c             	sub    $0xc,%esp
+801021d2:	8d 43 1c             	lea    0x1c(%ebx),%eax
+801021d5:	50                   	push   %eax
+801021d6:	e8 1f 58 00 00       	call   801079fa <acquiresleep>
+  if(ip->valid == 0){
+801021db:	83 c4 10             	add    $0x10,%esp
+801021de:	83 7b 74 00          	cmpl   $0x0,0x74(%ebx)
+801021e2:	74 14                	je     801021f8 <ilock+0x3b>
+}
+801021e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801021e7:	5b                   	pop    %ebx
+801021e8:	5e                   	pop    %esi
+801021e9:	5d                   	pop    %ebp
+801021ea:	c3                   	ret
+    panic("ilock");
+801021eb:	83 ec 0c             	sub    $0xc,%esp
+801021ee:	68 88 ae 10 80       	push   $0x8010ae88
+801021f3:	e8 0a e7 ff ff       	call   80100902 <panic>
+    bp = breadmeta(ip->dev, IBLOCK(ip->inum, sb));
+801021f8:	8b 43 04             	mov    0x4(%ebx),%eax
+801021fb:	c1 e8 03             	shr    $0x3,%eax
+801021fe:	83 ec 08             	sub    $0x8,%esp
+80102201:	03 05 04 42 12 80    	add    0x80124204,%eax
+80102207:	50                   	push   %eax
+80102208:	ff 33                	push   (%ebx)
+8010220a:	e8 c0 e2 ff ff       	call   801004cf <breadmeta>
+8010220f:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102211:	8b 43 04             	mov    0x4(%ebx),%eax
+80102214:	83 e0 07             	and    $0x7,%eax
+80102217:	c1 e0 06             	shl    $0x6,%eax
+8010221a:	8d 84 06 80 00 00 00 	lea    0x80(%esi,%eax,1),%eax
+    ip->type = dip->type;
+80102221:	0f b7 10             	movzwl (%eax),%edx
+80102224:	66 89 53 78          	mov    %dx,0x78(%ebx)
+    ip->major = dip->major;
+80102228:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+8010222c:	66 89 53 7a          	mov    %dx,0x7a(%ebx)
+    ip->minor = dip->minor;
+80102230:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+80102234:	66 89 53 7c          	mov    %dx,0x7c(%ebx)
+    ip->nlink = dip->nlink;
+80102238:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+8010223c:	66 89 53 7e          	mov    %dx,0x7e(%ebx)
+    ip->size = dip->size;
+80102240:	8b 50 08             	mov    0x8(%eax),%edx
+80102243:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102249:	83 c0 0c             	add    $0xc,%eax
+8010224c:	8d 93 84 00 00 00    	lea    0x84(%ebx),%edx
+80102252:	83 c4 0c             	add    $0xc,%esp
+80102255:	6a 34                	push   $0x34
+80102257:	50                   	push   %eax
+80102258:	52                   	push   %edx
+80102259:	e8 11 5b 00 00       	call   80107d6f <memmove>
+    brelse(bp);
+8010225e:	89 34 24             	mov    %esi,(%esp)
+80102261:	e8 a9 e3 ff ff       	call   8010060f <brelse>
+    ip->l1addr = 0;
+80102266:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+8010226d:	00 00 00 
+    ip->pcached = pcmaybe(ip);
+80102270:	89 1c 24             	mov    %ebx,(%esp)
+80102273:	e8 62 2a 00 00       	call   80104cda <pcmaybe>
+80102278:	89 83 cc 00 00 00    	mov    %eax,0xcc(%ebx)
+    ip->valid = 1;
+8010227e:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+    if(ip->type == 0)
+80102285:	83 c4 10             	add    $0x10,%esp
+80102288:	66 83 7b 78 00       	cmpw   $0x0,0x78(%ebx)
+8010228d:	0f 85 51 ff ff ff    	jne    801021e4 <ilock+0x27>
+      panic("ilock: no type");
+80102293:	83 ec 0c             	sub    $0xc,%esp
+80102296:	68 8e ae 10 80       	push   $0x8010ae8e
+8010229b:	e8 62 e6 ff ff       	call   80100902 <panic>
+
+801022a0 <iunlock>:
+{
+801022a0:	55                   	push   %ebp
+801022a1:	89 e5                	mov    %esp,%ebp
+801022a3:	56                   	push   %esi
+801022a4:	53                   	push   %ebx
+801022a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801022a8:	85 db                	test   %ebx,%ebx
+801022aa:	74 2c                	je     801022d8 <iunlock+0x38>
+801022ac:	8d 73 1c             	lea    0x1c(%ebx),%esi
+801022af:	83 ec 0c             	sub    $0xc,%esp
+801022b2:	56                   	push   %esi
+801022b3:	e8 cc 57 00 00       	call   80107a84 <holdingsleep>
+801022b8:	83 c4 10             	add    $0x10,%esp
+801022bb:	85 c0                	test   %eax,%eax
+801022bd:	74 19                	je     801022d8 <iunlock+0x38>
+801022bf:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+801022c3:	7e 13                	jle    801022d8 <iunlock+0x38>
+  releasesleep(&ip->lock);
+801022c5:	83 ec 0c             	sub    $0xc,%esp
+801022c8:	56                   	push   %esi
+801022c9:	e8 7b 57 00 00       	call   80107a49 <releasesleep>
+}
+801022ce:	83 c4 10             	add    $0x10,%esp
+801022d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801022d4:	5b                   	pop    %ebx
+801022d5:	5e                   	pop    %esi
+801022d6:	5d                   	pop    %ebp
+801022d7:	c3                   	ret
+    panic("iunlock");
+801022d8:	83 ec 0c             	sub    $0xc,%esp
+801022db:	68 9d ae 10 80       	push   $0x8010ae9d
+801022e0:	e8 1d e6 ff ff       	call   80100902 <panic>
+
+801022e5 <iput>:
+{
+801022e5:	55                   	push   %ebp
+801022e6:	89 e5                	mov    %esp,%ebp
+801022e8:	57                   	push   %edi
+801022e9:	56                   	push   %esi
+801022ea:	53                   	push   %ebx
+801022eb:	83 ec 18             	sub    $0x18,%esp
+801022ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+801022f1:	8d 73 1c             	lea    0x1c(%ebx),%esi
+801022f4:	56                   	push   %esi
+801022f5:	e8 00 57 00 00       	call   801079fa <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+801022fa:	83 c4 10             	add    $0x10,%esp
+801022fd:	83 7b 74 00          	cmpl   $0x0,0x74(%ebx)
+80102301:	74 07                	je     8010230a <iput+0x25>
+80102303:	66 83 7b 7e 00       	cmpw   $0x0,0x7e(%ebx)
+80102308:	74 79                	je     80102383 <iput+0x9e>
+  releasesleep(&ip->lock);
+8010230a:	83 ec 0c             	sub    $0xc,%esp
+8010230d:	56                   	push   %esi
+8010230e:	e8 36 57 00 00       	call   80107a49 <releasesleep>
+  acquire(&icache.lock);
+80102313:	c7 04 24 00 d5 10 80 	movl   $0x8010d500,(%esp)
+8010231a:	e8 fe 58 00 00       	call   80107c1d <acquire>
+  if(--ip->ref == 0){
+8010231f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102322:	83 e8 01             	sub    $0x1,%eax
+80102325:	89 43 08             	mov    %eax,0x8(%ebx)
+80102328:	83 c4 10             	add    $0x10,%esp
+8010232b:	85 c0                	test   %eax,%eax
+8010232d:	75 3c                	jne    8010236b <iput+0x86>
+    if(ip->valid){
+8010232f:	83 7b 74 00          	cmpl   $0x0,0x74(%ebx)
+80102333:	0f 84 bd 00 00 00    	je     801023f6 <iput+0x111>
+      ip->lruprev = 0;
+80102339:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+      ip->lrunext = icache.lru;
+80102340:	a1 4c d6 10 80       	mov    0x8010d64c,%eax
+80102345:	89 43 14             	mov    %eax,0x14(%ebx)
+      if(icache.lru)
+80102348:	85 c0                	test   %eax,%eax
+8010234a:	0f 84 80 00 00 00    	je     801023d0 <iput+0xeb>
+        icache.lru->lruprev = ip;
+80102350:	89 58 18             	mov    %ebx,0x18(%eax)
+      icache.lru = ip;
+80102353:	89 1d 4c d6 10 80    	mov    %ebx,0x8010d64c
+      if(++icache.nlru > NINODE)
+80102359:	a1 54 d6 10 80       	mov    0x8010d654,%eax
+8010235e:	83 c0 01             	add    $0x1,%eax
+80102361:	a3 54 d6 10 80       	mov    %eax,0x8010d654
+80102366:	83 f8 32             	cmp    $0x32,%eax
+80102369:	7f 70                	jg     801023db <iput+0xf6>
+  release(&icache.lock);
+8010236b:	83 ec 0c             	sub    $0xc,%esp
+8010236e:	68 00 d5 10 80       	push   $0x8010d500
+80102373:	e8 24 59 00 00       	call   80107c9c <release>
+}
+80102378:	83 c4 10             	add    $0x10,%esp
+8010237b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010237e:	5b                   	pop    %ebx
+8010237f:	5e                   	pop    %esi
+80102380:	5f                   	pop    %edi
+80102381:	5d                   	pop    %ebp
+80102382:	c3                   	ret
+    acquire(&icache.lock);
+80102383:	83 ec 0c             	sub    $0xc,%esp
+80102386:	68 00 d5 10 80       	push   $0x8010d500
+8010238b:	e8 8d 58 00 00       	call   80107c1d <acquire>
+    int r = ip->ref;
+80102390:	8b 7b 08             	mov    0x8(%ebx),%edi
+    release(&icache.lock);
+80102393:	c7 04 24 00 d5 10 80 	movl   $0x8010d500,(%esp)
+8010239a:	e8 fd 58 00 00       	call   80107c9c <release>
+    if(r == 1){
+8010239f:	83 c4 10             	add    $0x10,%esp
+801023a2:	83 ff 01             	cmp    $0x1,%edi
+801023a5:	0f 85 5f ff ff ff    	jne    8010230a <iput+0x25>
+      itrunc(ip);
+801023ab:	89 d8                	mov    %ebx,%eax
+801023ad:	e8 1e fc ff ff       	call   80101fd0 <itrunc>
+      ip->type = 0;
+801023b2:	66 c7 43 78 00 00    	movw   $0x0,0x78(%ebx)
+      iupdate(ip);
+801023b8:	83 ec 0c             	sub    $0xc,%esp
+801023bb:	53                   	push   %ebx
+801023bc:	e8 87 fb ff ff       	call   80101f48 <iupdate>
+      ip->valid = 0;
+801023c1:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+801023c8:	83 c4 10             	add    $0x10,%esp
+801023cb:	e9 3a ff ff ff       	jmp    8010230a <iput+0x25>
+        icache.lrutail = ip;
+801023d0:	89 1d 50 d6 10 80    	mov    %ebx,0x8010d650
+801023d6:	e9 78 ff ff ff       	jmp    80102353 <iput+0x6e>
+        slabfree(&inodecache, ievict());
+801023db:	e8 bf f4 ff ff       	call   8010189f <ievict>
+801023e0:	83 ec 08             	sub    $0x8,%esp
+801023e3:	50                   	push   %eax
+801023e4:	68 80 d2 10 80       	push   $0x8010d280
+801023e9:	e8 2d 55 00 00       	call   8010791b <slabfree>
+801023ee:	83 c4 10             	add    $0x10,%esp
+801023f1:	e9 75 ff ff ff       	jmp    8010236b <iput+0x86>
+      unhash(ip);
+801023f6:	89 d8                	mov    %ebx,%eax
+801023f8:	e8 79 f4 ff ff       	call   80101876 <unhash>
+      slabfree(&inodecache, ip);
+801023fd:	83 ec 08             	sub    $0x8,%esp
+80102400:	53                   	push   %ebx
+80102401:	68 80 d2 10 80       	push   $0x8010d280
+80102406:	e8 10 55 00 00       	call   8010791b <slabfree>
+8010240b:	83 c4 10             	add    $0x10,%esp
+8010240e:	e9 58 ff ff ff       	jmp    8010236b <iput+0x86>
+
+80102413 <iunlockput>:
+{
+80102413:	55                   	push   %ebp
+80102414:	89 e5                	mov    %esp,%ebp
+80102416:	53                   	push   %ebx
+80102417:	83 ec 10             	sub    $0x10,%esp
+8010241a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+8010241d:	53                   	push   %ebx
+8010241e:	e8 7d fe ff ff       	call   801022a0 <iunlock>
+  iput(ip);
+80102423:	89 1c 24             	mov    %ebx,(%esp)
+80102426:	e8 ba fe ff ff       	call   801022e5 <iput>
+}
+8010242b:	83 c4 10             	add    $0x10,%esp
+8010242e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102431:	c9                   	leave
+80102432:	c3                   	ret
+
+80102433 <stati>:
+{
+80102433:	55                   	push   %ebp
+80102434:	89 e5                	mov    %esp,%ebp
+80102436:	8b 55 08             	mov    0x8(%ebp),%edx
+80102439:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+8010243c:	8b 0a                	mov    (%edx),%ecx
+8010243e:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102441:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102444:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102447:	0f b7 4a 78          	movzwl 0x78(%edx),%ecx
+8010244b:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+8010244e:	0f b7 4a 7e          	movzwl 0x7e(%edx),%ecx
+80102452:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102456:	8b 92 80 00 00 00    	mov    0x80(%edx),%edx
+8010245c:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010245f:	5d                   	pop    %ebp
+80102460:	c3                   	ret
+
+80102461 <readi>:
+{
+80102461:	55                   	push   %ebp
+80102462:	89 e5                	mov    %esp,%ebp
+80102464:	57                   	push   %edi
+80102465:	56                   	push   %esi
+80102466:	53                   	push   %ebx
+80102467:	83 ec 1c             	sub    $0x1c,%esp
+8010246a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010246d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80102470:	66 83 79 78 03       	cmpw   $0x3,0x78(%ecx)
+80102475:	74 2f                	je     801024a6 <readi+0x45>
+  if(off > ip->size || off + n < off)
+80102477:	8b 81 80 00 00 00    	mov    0x80(%ecx),%eax
+8010247d:	39 f8                	cmp    %edi,%eax
+8010247f:	0f 82 cd 00 00 00    	jb     80102552 <readi+0xf1>
+80102485:	89 fa                	mov    %edi,%edx
+80102487:	03 55 14             	add    0x14(%ebp),%edx
+8010248a:	0f 82 c9 00 00 00    	jb     80102559 <readi+0xf8>
+  if(off + n > ip->size)
+80102490:	39 d0                	cmp    %edx,%eax
+80102492:	73 05                	jae    80102499 <readi+0x38>
+    n = ip->size - off;
+80102494:	29 f8                	sub    %edi,%eax
+80102496:	89 45 14             	mov    %eax,0x14(%ebp)
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102499:	be 00 00 00 00       	mov    $0x0,%esi
+8010249e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+801024a1:	e9 8e 00 00 00       	jmp    80102534 <readi+0xd3>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801024a6:	0f b7 41 7a          	movzwl 0x7a(%ecx),%eax
+801024aa:	66 83 f8 09          	cmp    $0x9,%ax
+801024ae:	0f 87 90 00 00 00    	ja     80102544 <readi+0xe3>
+801024b4:	98                   	cwtl
+801024b5:	8b 04 c5 a0 41 12 80 	mov    -0x7fedbe60(,%eax,8),%eax
+801024bc:	85 c0                	test   %eax,%eax
+801024be:	0f 84 87 00 00 00    	je     8010254b <readi+0xea>
+    return devsw[ip->major].read(ip, dst, n);
+801024c4:	83 ec 04             	sub    $0x4,%esp
+801024c7:	ff 75 14             	push   0x14(%ebp)
+801024ca:	ff 75 0c             	push   0xc(%ebp)
+801024cd:	51                   	push   %ecx
+801024ce:	ff d0                	call   *%eax
+801024d0:	83 c4 10             	add    $0x10,%esp
+801024d3:	eb 67                	jmp    8010253c <readi+0xdb>
+    readahead(ip, off/BSIZE);
+801024d5:	89 fb                	mov    %edi,%ebx
+801024d7:	c1 eb 09             	shr    $0x9,%ebx
+801024da:	89 da                	mov    %ebx,%edx
+801024dc:	8b 45 08             	mov    0x8(%ebp),%eax
+801024df:	e8 33 f8 ff ff       	call   80101d17 <readahead>
+    bp = breadi(ip, off/BSIZE);
+801024e4:	89 da                	mov    %ebx,%edx
+801024e6:	8b 45 08             	mov    0x8(%ebp),%eax
+801024e9:	e8 f5 f8 ff ff       	call   80101de3 <breadi>
+801024ee:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801024f0:	89 f8                	mov    %edi,%eax
+801024f2:	25 ff 01 00 00       	and    $0x1ff,%eax
+801024f7:	bb 00 02 00 00       	mov    $0x200,%ebx
+801024fc:	29 c3                	sub    %eax,%ebx
+801024fe:	8b 55 14             	mov    0x14(%ebp),%edx
+80102501:	29 f2                	sub    %esi,%edx
+80102503:	39 d3                	cmp    %edx,%ebx
+80102505:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80102508:	83 ec 04             	sub    $0x4,%esp
+8010250b:	53                   	push   %ebx
+8010250c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010250f:	8d 84 01 80 00 00 00 	lea    0x80(%ecx,%eax,1),%eax
+80102516:	50                   	push   %eax
+80102517:	ff 75 0c             	push   0xc(%ebp)
+8010251a:	e8 50 58 00 00       	call   80107d6f <memmove>
+    brelse(bp);
+8010251f:	83 c4 04             	add    $0x4,%esp
+80102522:	ff 75 e4             	push   -0x1c(%ebp)
+80102525:	e8 e5 e0 ff ff       	call   8010060f <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010252a:	01 de                	add    %ebx,%esi
+8010252c:	01 df                	add    %ebx,%edi
+8010252e:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80102531:	83 c4 10             	add    $0x10,%esp
+80102534:	3b 75 14             	cmp    0x14(%ebp),%esi
+80102537:	72 9c                	jb     801024d5 <readi+0x74>
+  return n;
+80102539:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+8010253c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010253f:	5b                   	pop    %ebx
+80102540:	5e                   	pop    %esi
+80102541:	5f                   	pop    %edi
+80102542:	5d                   	pop    %ebp
+80102543:	c3                   	ret
+      return -1;
+80102544:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102549:	eb f1                	jmp    8010253c <readi+0xdb>
+8010254b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102550:	eb ea                	jmp    8010253c <readi+0xdb>
+    return -1;
+80102552:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102557:	eb e3                	jmp    8010253c <readi+0xdb>
+80102559:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010255e:	eb dc                	jmp    8010253c <readi+0xdb>
+
+80102560 <writei>:
+{
+80102560:	55                   	push   %ebp
+80102561:	89 e5                	mov    %esp,%ebp
+80102563:	57                   	push   %edi
+80102564:	56                   	push   %esi
+80102565:	53                   	push   %ebx
+80102566:	83 ec 1c             	sub    $0x1c,%esp
+80102569:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+8010256c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010256f:	66 83 78 78 03       	cmpw   $0x3,0x78(%eax)
+80102574:	74 45                	je     801025bb <writei+0x5b>
+  if(off > ip->size || off + n < off)
+80102576:	8b 45 08             	mov    0x8(%ebp),%eax
+80102579:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+8010257f:	0f 82 19 01 00 00    	jb     8010269e <writei+0x13e>
+80102585:	89 f8                	mov    %edi,%eax
+80102587:	03 45 14             	add    0x14(%ebp),%eax
+8010258a:	0f 82 15 01 00 00    	jb     801026a5 <writei+0x145>
+  if(off + n > MAXFILE*BSIZE)
+80102590:	3d 00 16 81 00       	cmp    $0x811600,%eax
+80102595:	0f 87 11 01 00 00    	ja     801026ac <writei+0x14c>
+  if(ip->nexec > 0)
+8010259b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010259e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+801025a2:	0f 8f 0b 01 00 00    	jg     801026b3 <writei+0x153>
+  if(ip->pcached)
+801025a8:	83 b8 cc 00 00 00 00 	cmpl   $0x0,0xcc(%eax)
+801025af:	75 3e                	jne    801025ef <writei+0x8f>
+{
+801025b1:	be 00 00 00 00       	mov    $0x0,%esi
+801025b6:	e9 a0 00 00 00       	jmp    8010265b <writei+0xfb>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801025bb:	0f b7 40 7a          	movzwl 0x7a(%eax),%eax
+801025bf:	66 83 f8 09          	cmp    $0x9,%ax
+801025c3:	0f 87 c7 00 00 00    	ja     80102690 <writei+0x130>
+801025c9:	98                   	cwtl
+801025ca:	8b 04 c5 a4 41 12 80 	mov    -0x7fedbe5c(,%eax,8),%eax
+801025d1:	85 c0                	test   %eax,%eax
+801025d3:	0f 84 be 00 00 00    	je     80102697 <writei+0x137>
+    return devsw[ip->major].write(ip, src, n);
+801025d9:	83 ec 04             	sub    $0x4,%esp
+801025dc:	ff 75 14             	push   0x14(%ebp)
+801025df:	ff 75 0c             	push   0xc(%ebp)
+801025e2:	ff 75 08             	push   0x8(%ebp)
+801025e5:	ff d0                	call   *%eax
+801025e7:	83 c4 10             	add    $0x10,%esp
+801025ea:	e9 85 00 00 00       	jmp    80102674 <writei+0x114>
+    pcinval(ip);
+801025ef:	83 ec 0c             	sub    $0xc,%esp
+801025f2:	50                   	push   %eax
+801025f3:	e8 4f 26 00 00       	call   80104c47 <pcinval>
+801025f8:	83 c4 10             	add    $0x10,%esp
+801025fb:	eb b4                	jmp    801025b1 <writei+0x51>
+    bp = breadi(ip, off/BSIZE);
+801025fd:	89 fa                	mov    %edi,%edx
+801025ff:	c1 ea 09             	shr    $0x9,%edx
+80102602:	8b 45 08             	mov    0x8(%ebp),%eax
+80102605:	e8 d9 f7 ff ff       	call   80101de3 <breadi>
+8010260a:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010260c:	89 f8                	mov    %edi,%eax
+8010260e:	25 ff 01 00 00       	and    $0x1ff,%eax
+80102613:	bb 00 02 00 00       	mov    $0x200,%ebx
+80102618:	29 c3                	sub    %eax,%ebx
+8010261a:	8b 55 14             	mov    0x14(%ebp),%edx
+8010261d:	29 f2                	sub    %esi,%edx
+8010261f:	39 d3                	cmp    %edx,%ebx
+80102621:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80102624:	83 ec 04             	sub    $0x4,%esp
+80102627:	53                   	push   %ebx
+80102628:	ff 75 0c             	push   0xc(%ebp)
+8010262b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010262e:	8d 84 01 80 00 00 00 	lea    0x80(%ecx,%eax,1),%eax
+80102635:	50                   	push   %eax
+80102636:	e8 34 57 00 00       	call   80107d6f <memmove>
+    log_write(bp);
+8010263b:	83 c4 04             	add    $0x4,%esp
+8010263e:	ff 75 e4             	push   -0x1c(%ebp)
+80102641:	e8 f3 1e 00 00       	call   80104539 <log_write>
+    brelse(bp);
+80102646:	83 c4 04             	add    $0x4,%esp
+80102649:	ff 75 e4             	push   -0x1c(%ebp)
+8010264c:	e8 be df ff ff       	call   8010060f <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102651:	01 de                	add    %ebx,%esi
+80102653:	01 df                	add    %ebx,%edi
+80102655:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80102658:	83 c4 10             	add    $0x10,%esp
+8010265b:	3b 75 14             	cmp    0x14(%ebp),%esi
+8010265e:	72 9d                	jb     801025fd <writei+0x9d>
+  if(n > 0 && off > ip->size){
+80102660:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80102664:	74 0b                	je     80102671 <writei+0x111>
+80102666:	8b 45 08             	mov    0x8(%ebp),%eax
+80102669:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+8010266f:	72 0b                	jb     8010267c <writei+0x11c>
+  return n;
+80102671:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80102674:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102677:	5b                   	pop    %ebx
+80102678:	5e                   	pop    %esi
+80102679:	5f                   	pop    %edi
+8010267a:	5d                   	pop    %ebp
+8010267b:	c3                   	ret
+    ip->size = off;
+8010267c:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+    iupdate(ip);
+80102682:	83 ec 0c             	sub    $0xc,%esp
+80102685:	50                   	push   %eax
+80102686:	e8 bd f8 ff ff       	call   80101f48 <iupdate>
+8010268b:	83 c4 10             	add    $0x10,%esp
+8010268e:	eb e1                	jmp    80102671 <writei+0x111>
+      return -1;
+80102690:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102695:	eb dd                	jmp    80102674 <writei+0x114>
+80102697:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010269c:	eb d6                	jmp    80102674 <writei+0x114>
+    return -1;
+8010269e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801026a3:	eb cf                	jmp    80102674 <writei+0x114>
+801026a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801026aa:	eb c8                	jmp    80102674 <writei+0x114>
+    return -1;
+801026ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801026b1:	eb c1                	jmp    80102674 <writei+0x114>
+    return -1;
+801026b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801026b8:	eb ba                	jmp    80102674 <writei+0x114>
+
+801026ba <namecmp>:
+{
+801026ba:	55                   	push   %ebp
+801026bb:	89 e5                	mov    %esp,%ebp
+801026bd:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+801026c0:	6a 0e                	push   $0xe
+801026c2:	ff 75 0c             	push   0xc(%ebp)
+801026c5:	ff 75 08             	push   0x8(%ebp)
+801026c8:	e8 0e 57 00 00       	call   80107ddb <strncmp>
+}
+801026cd:	c9                   	leave
+801026ce:	c3                   	ret
+
+801026cf <dirlookup>:
+{
+801026cf:	55                   	push   %ebp
+801026d0:	89 e5                	mov    %esp,%ebp
+801026d2:	57                   	push   %edi
+801026d3:	56                   	push   %esi
+801026d4:	53                   	push   %ebx
+801026d5:	83 ec 1c             	sub    $0x1c,%esp
+801026d8:	8b 75 08             	mov    0x8(%ebp),%esi
+801026db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(dp->type != T_DIR)
+801026de:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+801026e3:	75 07                	jne    801026ec <dirlookup+0x1d>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801026e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801026ea:	eb 1d                	jmp    80102709 <dirlookup+0x3a>
+    panic("dirlookup not DIR");
+801026ec:	83 ec 0c             	sub    $0xc,%esp
+801026ef:	68 a5 ae 10 80       	push   $0x8010aea5
+801026f4:	e8 09 e2 ff ff       	call   80100902 <panic>
+      panic("dirlookup read");
+801026f9:	83 ec 0c             	sub    $0xc,%esp
+801026fc:	68 b7 ae 10 80       	push   $0x8010aeb7
+80102701:	e8 fc e1 ff ff       	call   80100902 <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102706:	83 c3 10             	add    $0x10,%ebx
+80102709:	3b 9e 80 00 00 00    	cmp    0x80(%esi),%ebx
+8010270f:	73 48                	jae    80102759 <dirlookup+0x8a>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102711:	6a 10                	push   $0x10
+80102713:	53                   	push   %ebx
+80102714:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80102717:	50                   	push   %eax
+80102718:	56                   	push   %esi
+80102719:	e8 43 fd ff ff       	call   80102461 <readi>
+8010271e:	83 c4 10             	add    $0x10,%esp
+80102721:	83 f8 10             	cmp    $0x10,%eax
+80102724:	75 d3                	jne    801026f9 <dirlookup+0x2a>
+    if(de.inum == 0)
+80102726:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010272b:	74 d9                	je     80102706 <dirlookup+0x37>
+    if(namecmp(name, de.name) == 0){
+8010272d:	83 ec 08             	sub    $0x8,%esp
+80102730:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102733:	50                   	push   %eax
+80102734:	57                   	push   %edi
+80102735:	e8 80 ff ff ff       	call   801026ba <namecmp>
+8010273a:	83 c4 10             	add    $0x10,%esp
+8010273d:	85 c0                	test   %eax,%eax
+8010273f:	75 c5                	jne    80102706 <dirlookup+0x37>
+      if(poff)
+80102741:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80102745:	74 05                	je     8010274c <dirlookup+0x7d>
+        *poff = off;
+80102747:	8b 45 10             	mov    0x10(%ebp),%eax
+8010274a:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+8010274c:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80102750:	8b 06                	mov    (%esi),%eax
+80102752:	e8 60 f2 ff ff       	call   801019b7 <iget>
+80102757:	eb 05                	jmp    8010275e <dirlookup+0x8f>
+  return 0;
+80102759:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010275e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102761:	5b                   	pop    %ebx
+80102762:	5e                   	pop    %esi
+80102763:	5f                   	pop    %edi
+80102764:	5d                   	pop    %ebp
+80102765:	c3                   	ret
+
+80102766 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80102766:	55                   	push   %ebp
+80102767:	89 e5                	mov    %esp,%ebp
+80102769:	57                   	push   %edi
+8010276a:	56                   	push   %esi
+8010276b:	53                   	push   %ebx
+8010276c:	83 ec 1c             	sub    $0x1c,%esp
+8010276f:	89 c3                	mov    %eax,%ebx
+80102771:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102774:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80102777:	80 38 2f             	cmpb   $0x2f,(%eax)
+8010277a:	74 17                	je     80102793 <namex+0x2d>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+8010277c:	e8 57 32 00 00       	call   801059d8 <myproc>
+80102781:	83 ec 0c             	sub    $0xc,%esp
+80102784:	ff 70 68             	push   0x68(%eax)
+80102787:	e8 f2 f9 ff ff       	call   8010217e <idup>
+8010278c:	89 c6                	mov    %eax,%esi
+8010278e:	83 c4 10             	add    $0x10,%esp
+80102791:	eb 53                	jmp    801027e6 <namex+0x80>
+    ip = iget(ROOTDEV, ROOTINO);
+80102793:	ba 01 00 00 00       	mov    $0x1,%edx
+80102798:	b8 01 00 00 00       	mov    $0x1,%eax
+8010279d:	e8 15 f2 ff ff       	call   801019b7 <iget>
+801027a2:	89 c6                	mov    %eax,%esi
+801027a4:	eb 40                	jmp    801027e6 <namex+0x80>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+801027a6:	83 ec 0c             	sub    $0xc,%esp
+801027a9:	56                   	push   %esi
+801027aa:	e8 64 fc ff ff       	call   80102413 <iunlockput>
+      return 0;
+801027af:	83 c4 10             	add    $0x10,%esp
+801027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+801027b7:	89 f0                	mov    %esi,%eax
+801027b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027bc:	5b                   	pop    %ebx
+801027bd:	5e                   	pop    %esi
+801027be:	5f                   	pop    %edi
+801027bf:	5d                   	pop    %ebp
+801027c0:	c3                   	ret
+    if((next = dirlookup(ip, name, 0)) == 0){
+801027c1:	83 ec 04             	sub    $0x4,%esp
+801027c4:	6a 00                	push   $0x0
+801027c6:	ff 75 e4             	push   -0x1c(%ebp)
+801027c9:	56                   	push   %esi
+801027ca:	e8 00 ff ff ff       	call   801026cf <dirlookup>
+801027cf:	89 c7                	mov    %eax,%edi
+801027d1:	83 c4 10             	add    $0x10,%esp
+801027d4:	85 c0                	test   %eax,%eax
+801027d6:	74 4a                	je     80102822 <namex+0xbc>
+    iunlockput(ip);
+801027d8:	83 ec 0c             	sub    $0xc,%esp
+801027db:	56                   	push   %esi
+801027dc:	e8 32 fc ff ff       	call   80102413 <iunlockput>
+801027e1:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+801027e4:	89 fe                	mov    %edi,%esi
+  while((path = skipelem(path, name)) != 0){
+801027e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801027e9:	89 d8                	mov    %ebx,%eax
+801027eb:	e8 d5 f0 ff ff       	call   801018c5 <skipelem>
+801027f0:	89 c3                	mov    %eax,%ebx
+801027f2:	85 c0                	test   %eax,%eax
+801027f4:	74 3c                	je     80102832 <namex+0xcc>
+    ilock(ip);
+801027f6:	83 ec 0c             	sub    $0xc,%esp
+801027f9:	56                   	push   %esi
+801027fa:	e8 be f9 ff ff       	call   801021bd <ilock>
+    if(ip->type != T_DIR){
+801027ff:	83 c4 10             	add    $0x10,%esp
+80102802:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+80102807:	75 9d                	jne    801027a6 <namex+0x40>
+    if(nameiparent && *path == '\0'){
+80102809:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+8010280d:	74 b2                	je     801027c1 <namex+0x5b>
+8010280f:	80 3b 00             	cmpb   $0x0,(%ebx)
+80102812:	75 ad                	jne    801027c1 <namex+0x5b>
+      iunlock(ip);
+80102814:	83 ec 0c             	sub    $0xc,%esp
+80102817:	56                   	push   %esi
+80102818:	e8 83 fa ff ff       	call   801022a0 <iunlock>
+      return ip;
+8010281d:	83 c4 10             	add    $0x10,%esp
+80102820:	eb 95                	jmp    801027b7 <namex+0x51>
+      iunlockput(ip);
+80102822:	83 ec 0c             	sub    $0xc,%esp
+80102825:	56                   	push   %esi
+80102826:	e8 e8 fb ff ff       	call   80102413 <iunlockput>
+      return 0;
+8010282b:	83 c4 10             	add    $0x10,%esp
+8010282e:	89 fe                	mov    %edi,%esi
+80102830:	eb 85                	jmp    801027b7 <namex+0x51>
+  if(nameiparent){
+80102832:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80102836:	0f 84 7b ff ff ff    	je     801027b7 <namex+0x51>
+    iput(ip);
+8010283c:	83 ec 0c             	sub    $0xc,%esp
+8010283f:	56                   	push   %esi
+80102840:	e8 a0 fa ff ff       	call   801022e5 <iput>
+    return 0;
+80102845:	83 c4 10             	add    $0x10,%esp
+80102848:	89 de                	mov    %ebx,%esi
+8010284a:	e9 68 ff ff ff       	jmp    801027b7 <namex+0x51>
+
+8010284f <dirlink>:
+{
+8010284f:	55                   	push   %ebp
+80102850:	89 e5                	mov    %esp,%ebp
+80102852:	57                   	push   %edi
+80102853:	56                   	push   %esi
+80102854:	53                   	push   %ebx
+80102855:	83 ec 20             	sub    $0x20,%esp
+80102858:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010285b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((ip = dirlookup(dp, name, 0)) != 0){
+8010285e:	6a 00                	push   $0x0
+80102860:	57                   	push   %edi
+80102861:	53                   	push   %ebx
+80102862:	e8 68 fe ff ff       	call   801026cf <dirlookup>
+80102867:	83 c4 10             	add    $0x10,%esp
+8010286a:	85 c0                	test   %eax,%eax
+8010286c:	75 30                	jne    8010289e <dirlink+0x4f>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+8010286e:	b8 00 00 00 00       	mov    $0x0,%eax
+80102873:	89 c6                	mov    %eax,%esi
+80102875:	3b 83 80 00 00 00    	cmp    0x80(%ebx),%eax
+8010287b:	73 41                	jae    801028be <dirlink+0x6f>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010287d:	6a 10                	push   $0x10
+8010287f:	50                   	push   %eax
+80102880:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80102883:	50                   	push   %eax
+80102884:	53                   	push   %ebx
+80102885:	e8 d7 fb ff ff       	call   80102461 <readi>
+8010288a:	83 c4 10             	add    $0x10,%esp
+8010288d:	83 f8 10             	cmp    $0x10,%eax
+80102890:	75 1f                	jne    801028b1 <dirlink+0x62>
+    if(de.inum == 0)
+80102892:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80102897:	74 25                	je     801028be <dirlink+0x6f>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102899:	8d 46 10             	lea    0x10(%esi),%eax
+8010289c:	eb d5                	jmp    80102873 <dirlink+0x24>
+    iput(ip);
+8010289e:	83 ec 0c             	sub    $0xc,%esp
+801028a1:	50                   	push   %eax
+801028a2:	e8 3e fa ff ff       	call   801022e5 <iput>
+    return -1;
+801028a7:	83 c4 10             	add    $0x10,%esp
+801028aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801028af:	eb 3d                	jmp    801028ee <dirlink+0x9f>
+      panic("dirlink read");
+801028b1:	83 ec 0c             	sub    $0xc,%esp
+801028b4:	68 c6 ae 10 80       	push   $0x8010aec6
+801028b9:	e8 44 e0 ff ff       	call   80100902 <panic>
+  strncpy(de.name, name, DIRSIZ);
+801028be:	83 ec 04             	sub    $0x4,%esp
+801028c1:	6a 0e                	push   $0xe
+801028c3:	57                   	push   %edi
+801028c4:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801028c7:	8d 45 da             	lea    -0x26(%ebp),%eax
+801028ca:	50                   	push   %eax
+801028cb:	e8 4a 55 00 00       	call   80107e1a <strncpy>
+  de.inum = inum;
+801028d0:	8b 45 10             	mov    0x10(%ebp),%eax
+801028d3:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801028d7:	6a 10                	push   $0x10
+801028d9:	56                   	push   %esi
+801028da:	57                   	push   %edi
+801028db:	53                   	push   %ebx
+801028dc:	e8 7f fc ff ff       	call   80102560 <writei>
+801028e1:	83 c4 20             	add    $0x20,%esp
+801028e4:	83 f8 10             	cmp    $0x10,%eax
+801028e7:	75 0d                	jne    801028f6 <dirlink+0xa7>
+  return 0;
+801028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801028ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801028f1:	5b                   	pop    %ebx
+801028f2:	5e                   	pop    %esi
+801028f3:	5f                   	pop    %edi
+801028f4:	5d                   	pop    %ebp
+801028f5:	c3                   	ret
+    panic("dirlink");
+801028f6:	83 ec 0c             	sub    $0xc,%esp
+801028f9:	68 4c be 10 80       	push   $0x8010be4c
+801028fe:	e8 ff df ff ff       	call   80100902 <panic>
+
+80102903 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102903:	55                   	push   %ebp
+80102904:	89 e5                	mov    %esp,%ebp
+80102906:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102909:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010290c:	ba 00 00 00 00       	mov    $0x0,%edx
+80102911:	8b 45 08             	mov    0x8(%ebp),%eax
+80102914:	e8 4d fe ff ff       	call   80102766 <namex>
+}
+80102919:	c9                   	leave
+8010291a:	c3                   	ret
+
+8010291b <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+8010291b:	55                   	push   %ebp
+8010291c:	89 e5                	mov    %esp,%ebp
+8010291e:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80102921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102924:	ba 01 00 00 00       	mov    $0x1,%edx
+80102929:	8b 45 08             	mov    0x8(%ebp),%eax
+8010292c:	e8 35 fe ff ff       	call   80102766 <namex>
+}
+80102931:	c9                   	leave
+80102932:	c3                   	ret
+
+80102933 <idewait>:
+static struct prd ideprd[IDE_MAXSECT] __attribute__((aligned(PGSIZE)));
+
+// Wait for IDE disk to become ready.
+static int
+idewait(int checkerr)
+{
+80102933:	89 c1                	mov    %eax,%ecx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102935:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010293a:	ec                   	in     (%dx),%al
+  int r;
+
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+8010293b:	89 c2                	mov    %eax,%edx
+8010293d:	83 e2 c0             	and    $0xffffffc0,%edx
+80102940:	80 fa 40             	cmp    $0x40,%dl
+80102943:	75 f0                	jne    80102935 <idewait+0x2>
+    ;
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80102945:	85 c9                	test   %ecx,%ecx
+80102947:	74 09                	je     80102952 <idewait+0x1f>
+80102949:	a8 21                	test   $0x21,%al
+8010294b:	75 08                	jne    80102955 <idewait+0x22>
+    return -1;
+  return 0;
+8010294d:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+80102952:	89 c8                	mov    %ecx,%eax
+80102954:	c3                   	ret
+    return -1;
+80102955:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+8010295a:	eb f6                	jmp    80102952 <idewait+0x1f>
+
+8010295c <setmult>:
+
+// Ask disk dev to transfer IDE_MULT sectors per interrupt
+// in RDMUL/WRMUL commands. Returns how many it will.
+static int
+setmult(int dev)
+{
+8010295c:	55                   	push   %ebp
+8010295d:	89 e5                	mov    %esp,%ebp
+8010295f:	53                   	push   %ebx
+80102960:	83 ec 04             	sub    $0x4,%esp
+80102963:	89 c3                	mov    %eax,%ebx
+  idewait(0);
+80102965:	b8 00 00 00 00       	mov    $0x0,%eax
+8010296a:	e8 c4 ff ff ff       	call   80102933 <idewait>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010296f:	b8 10 00 00 00       	mov    $0x10,%eax
+80102974:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102979:	ee                   	out    %al,(%dx)
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f6, 0xe0 | ((dev&1)<<4));
+8010297a:	89 d8                	mov    %ebx,%eax
+8010297c:	c1 e0 04             	shl    $0x4,%eax
+8010297f:	83 e0 10             	and    $0x10,%eax
+80102982:	83 c8 e0             	or     $0xffffffe0,%eax
+80102985:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010298a:	ee                   	out    %al,(%dx)
+8010298b:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+80102990:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102995:	ee                   	out    %al,(%dx)
+  outb(0x1f7, IDE_CMD_SETMUL);
+  return idewait(1) < 0 ? 1 : IDE_MULT;
+80102996:	b8 01 00 00 00       	mov    $0x1,%eax
+8010299b:	e8 93 ff ff ff       	call   80102933 <idewait>
+801029a0:	85 c0                	test   %eax,%eax
+801029a2:	79 0a                	jns    801029ae <setmult+0x52>
+801029a4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+801029a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801029ac:	c9                   	leave
+801029ad:	c3                   	ret
+  return idewait(1) < 0 ? 1 : IDE_MULT;
+801029ae:	b8 10 00 00 00       	mov    $0x10,%eax
+801029b3:	eb f4                	jmp    801029a9 <setmult+0x4d>
+
+801029b5 <idepio>:
+
+// Move the next block of sectors, as many as the disk transfers
+// per interrupt, between the disk and the active bufs.
+static void
+idepio(int write)
+{
+801029b5:	55                   	push   %ebp
+801029b6:	89 e5                	mov    %esp,%ebp
+801029b8:	57                   	push   %edi
+801029b9:	56                   	push   %esi
+801029ba:	53                   	push   %ebx
+801029bb:	89 c3                	mov    %eax,%ebx
+  uchar *p;
+  int n;
+
+  for(n = 0; n < idemult[ideactive->dev&1] && idenleft > 0; n++, idenleft--){
+801029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+801029c2:	eb 2b                	jmp    801029ef <idepio+0x3a>
+  asm volatile("cld; rep insl" :
+801029c4:	b9 80 00 00 00       	mov    $0x80,%ecx
+801029c9:	ba f0 01 00 00       	mov    $0x1f0,%edx
+801029ce:	fc                   	cld
+801029cf:	f3 6d                	rep insl (%dx),%es:(%edi)
+    p = idexfer->data + idexoff*SECTOR_SIZE;
+    if(write)
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+    if(++idexoff == BSIZE/SECTOR_SIZE){
+801029d1:	8b 35 10 58 12 80    	mov    0x80125810,%esi
+801029d7:	8d 56 01             	lea    0x1(%esi),%edx
+801029da:	89 15 10 58 12 80    	mov    %edx,0x80125810
+801029e0:	83 fa 01             	cmp    $0x1,%edx
+801029e3:	74 53                	je     80102a38 <idepio+0x83>
+  for(n = 0; n < idemult[ideactive->dev&1] && idenleft > 0; n++, idenleft--){
+801029e5:	83 c0 01             	add    $0x1,%eax
+801029e8:	83 2d 0c 58 12 80 01 	subl   $0x1,0x8012580c
+801029ef:	8b 15 1c 58 12 80    	mov    0x8012581c,%edx
+801029f5:	8b 52 04             	mov    0x4(%edx),%edx
+801029f8:	83 e2 01             	and    $0x1,%edx
+801029fb:	39 04 95 00 58 12 80 	cmp    %eax,-0x7feda800(,%edx,4)
+80102a02:	7e 4f                	jle    80102a53 <idepio+0x9e>
+80102a04:	83 3d 0c 58 12 80 00 	cmpl   $0x0,0x8012580c
+80102a0b:	7e 46                	jle    80102a53 <idepio+0x9e>
+    p = idexfer->data + idexoff*SECTOR_SIZE;
+80102a0d:	8b 15 10 58 12 80    	mov    0x80125810,%edx
+80102a13:	c1 e2 09             	shl    $0x9,%edx
+80102a16:	8b 0d 14 58 12 80    	mov    0x80125814,%ecx
+80102a1c:	8d bc 11 80 00 00 00 	lea    0x80(%ecx,%edx,1),%edi
+    if(write)
+80102a23:	85 db                	test   %ebx,%ebx
+80102a25:	74 9d                	je     801029c4 <idepio+0xf>
+  asm volatile("cld; rep outsl" :
+80102a27:	89 fe                	mov    %edi,%esi
+80102a29:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102a2e:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102a33:	fc                   	cld
+80102a34:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80102a36:	eb 99                	jmp    801029d1 <idepio+0x1c>
+      idexoff = 0;
+80102a38:	c7 05 10 58 12 80 00 	movl   $0x0,0x80125810
+80102a3f:	00 00 00 
+      idexfer = idexfer->qnext;
+80102a42:	8b 15 14 58 12 80    	mov    0x80125814,%edx
+80102a48:	8b 52 7c             	mov    0x7c(%edx),%edx
+80102a4b:	89 15 14 58 12 80    	mov    %edx,0x80125814
+80102a51:	eb 92                	jmp    801029e5 <idepio+0x30>
+    }
+  }
+}
+80102a53:	5b                   	pop    %ebx
+80102a54:	5e                   	pop    %esi
+80102a55:	5f                   	pop    %edi
+80102a56:	5d                   	pop    %ebp
+80102a57:	c3                   	ret
+
+80102a58 <dmainit>:
+{
+80102a58:	55                   	push   %ebp
+80102a59:	89 e5                	mov    %esp,%ebp
+80102a5b:	53                   	push   %ebx
+80102a5c:	83 ec 20             	sub    $0x20,%esp
+  if(pcifind(PCI_ANY, PCI_ANY, PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &d) < 0)
+80102a5f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80102a62:	50                   	push   %eax
+80102a63:	6a 01                	push   $0x1
+80102a65:	6a 01                	push   $0x1
+80102a67:	6a ff                	push   $0xffffffff
+80102a69:	6a ff                	push   $0xffffffff
+80102a6b:	e8 03 23 00 00       	call   80104d73 <pcifind>
+80102a70:	83 c4 20             	add    $0x20,%esp
+80102a73:	85 c0                	test   %eax,%eax
+80102a75:	78 1c                	js     80102a93 <dmainit+0x3b>
+  bar = pcibar(&d, 4);
+80102a77:	83 ec 08             	sub    $0x8,%esp
+80102a7a:	6a 04                	push   $0x4
+80102a7c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80102a7f:	50                   	push   %eax
+80102a80:	e8 2f 24 00 00       	call   80104eb4 <pcibar>
+80102a85:	89 c3                	mov    %eax,%ebx
+  if((bar & 1) == 0 || (bar & ~3) == 0)
+80102a87:	83 c4 10             	add    $0x10,%esp
+80102a8a:	a8 01                	test   $0x1,%al
+80102a8c:	74 05                	je     80102a93 <dmainit+0x3b>
+80102a8e:	83 f8 03             	cmp    $0x3,%eax
+80102a91:	77 05                	ja     80102a98 <dmainit+0x40>
+}
+80102a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102a96:	c9                   	leave
+80102a97:	c3                   	ret
+  pcienable(&d);
+80102a98:	83 ec 0c             	sub    $0xc,%esp
+80102a9b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80102a9e:	50                   	push   %eax
+80102a9f:	e8 3a 24 00 00       	call   80104ede <pcienable>
+  idebm = bar & ~3;
+80102aa4:	83 e3 fc             	and    $0xfffffffc,%ebx
+80102aa7:	89 1d fc 57 12 80    	mov    %ebx,0x801257fc
+80102aad:	83 c4 10             	add    $0x10,%esp
+80102ab0:	eb e1                	jmp    80102a93 <dmainit+0x3b>
+
+80102ab2 <dmaok>:
+// Can the bufs from b on be moved by DMA? A PRD entry
+// must not cross a 64KB physical boundary.
+static int
+dmaok(struct buf *b)
+{
+  for(; b; b = b->qnext)
+80102ab2:	85 c0                	test   %eax,%eax
+80102ab4:	74 32                	je     80102ae8 <dmaok+0x36>
+
+// Convert kernel virtual address to physical address
+static inline uint V2P(void *a) {
+    // define panic() here because memlayout.h is included before defs.h
+    extern void panic(char*) __attribute__((noreturn));
+    if (a < (void*) KERNBASE)
+80102ab6:	89 c2                	mov    %eax,%edx
+80102ab8:	83 ea 80             	sub    $0xffffff80,%edx
+80102abb:	79 1b                	jns    80102ad8 <dmaok+0x26>
+        panic("V2P on address < KERNBASE "
+              "(not a kernel virtual address; consider walking page "
+              "table to determine physical address of a user virtual address)");
+    return (uint)a - KERNBASE;
+80102abd:	8d 8a 00 00 00 80    	lea    -0x80000000(%edx),%ecx
+    if((V2P(b->data) ^ (V2P(b->data) + BSIZE - 1)) & ~0xffff)
+80102ac3:	81 ea 01 fe ff 7f    	sub    $0x7ffffe01,%edx
+80102ac9:	31 ca                	xor    %ecx,%edx
+80102acb:	81 fa ff ff 00 00    	cmp    $0xffff,%edx
+80102ad1:	77 1b                	ja     80102aee <dmaok+0x3c>
+  for(; b; b = b->qnext)
+80102ad3:	8b 40 7c             	mov    0x7c(%eax),%eax
+80102ad6:	eb da                	jmp    80102ab2 <dmaok>
+{
+80102ad8:	55                   	push   %ebp
+80102ad9:	89 e5                	mov    %esp,%ebp
+80102adb:	83 ec 14             	sub    $0x14,%esp
+        panic("V2P on address < KERNBASE "
+80102ade:	68 30 af 10 80       	push   $0x8010af30
+80102ae3:	e8 1a de ff ff       	call   80100902 <panic>
+      return 0;
+  return 1;
+80102ae8:	b8 01 00 00 00       	mov    $0x1,%eax
+80102aed:	c3                   	ret
+      return 0;
+80102aee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80102af3:	c3                   	ret
+
+80102af4 <dmastart>:
+
+// Start a DMA transfer of the nsect sectors at sector
+// to or from the bufs of the active request.
+static void
+dmastart(struct buf *b, int nsect, int sector, int write)
+{
+80102af4:	55                   	push   %ebp
+80102af5:	89 e5                	mov    %esp,%ebp
+80102af7:	57                   	push   %edi
+80102af8:	56                   	push   %esi
+80102af9:	53                   	push   %ebx
+80102afa:	83 ec 1c             	sub    $0x1c,%esp
+80102afd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102b00:	89 cb                	mov    %ecx,%ebx
+80102b02:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i;
+
+  for(i = 0; b; b = b->qnext, i++){
+80102b05:	ba 00 00 00 00       	mov    $0x0,%edx
+80102b0a:	eb 20                	jmp    80102b2c <dmastart+0x38>
+80102b0c:	83 ec 0c             	sub    $0xc,%esp
+80102b0f:	68 30 af 10 80       	push   $0x8010af30
+80102b14:	e8 e9 dd ff ff       	call   80100902 <panic>
+    ideprd[i].addr = V2P(b->data);
+    ideprd[i].n = BSIZE;
+    ideprd[i].flags = b->qnext ? 0 : PRD_EOT;
+80102b19:	b9 00 80 ff ff       	mov    $0xffff8000,%ecx
+80102b1e:	66 89 0c d5 06 50 12 	mov    %cx,-0x7fedaffa(,%edx,8)
+80102b25:	80 
+  for(i = 0; b; b = b->qnext, i++){
+80102b26:	8b 40 7c             	mov    0x7c(%eax),%eax
+80102b29:	83 c2 01             	add    $0x1,%edx
+80102b2c:	85 c0                	test   %eax,%eax
+80102b2e:	74 2b                	je     80102b5b <dmastart+0x67>
+    if (a < (void*) KERNBASE)
+80102b30:	89 c1                	mov    %eax,%ecx
+80102b32:	83 e9 80             	sub    $0xffffff80,%ecx
+80102b35:	79 d5                	jns    80102b0c <dmastart+0x18>
+    return (uint)a - KERNBASE;
+80102b37:	81 c1 00 00 00 80    	add    $0x80000000,%ecx
+    ideprd[i].addr = V2P(b->data);
+80102b3d:	89 0c d5 00 50 12 80 	mov    %ecx,-0x7fedb000(,%edx,8)
+    ideprd[i].n = BSIZE;
+80102b44:	66 c7 04 d5 04 50 12 	movw   $0x200,-0x7fedaffc(,%edx,8)
+80102b4b:	80 00 02 
+    ideprd[i].flags = b->qnext ? 0 : PRD_EOT;
+80102b4e:	83 78 7c 00          	cmpl   $0x0,0x7c(%eax)
+80102b52:	74 c5                	je     80102b19 <dmastart+0x25>
+80102b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+80102b59:	eb c3                	jmp    80102b1e <dmastart+0x2a>
+  }
+  idenleft = 0;
+80102b5b:	c7 05 0c 58 12 80 00 	movl   $0x0,0x8012580c
+80102b62:	00 00 00 
+    if (a < (void*) KERNBASE)
+80102b65:	b8 00 50 12 80       	mov    $0x80125000,%eax
+80102b6a:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80102b6f:	0f 86 ab 00 00 00    	jbe    80102c20 <dmastart+0x12c>
+
+  outl(idebm + BM_PRD, V2P(ideprd));
+80102b75:	8b 0d fc 57 12 80    	mov    0x801257fc,%ecx
+80102b7b:	89 cf                	mov    %ecx,%edi
+80102b7d:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b80:	b8 00 50 12 00       	mov    $0x125000,%eax
+80102b85:	ef                   	out    %eax,(%dx)
+  outb(idebm + BM_CMD, write ? 0 : BM_CMD_READ);
+80102b86:	85 f6                	test   %esi,%esi
+80102b88:	0f 84 9f 00 00 00    	je     80102c2d <dmastart+0x139>
+80102b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b93:	89 fa                	mov    %edi,%edx
+80102b95:	ee                   	out    %al,(%dx)
+  outb(idebm + BM_STATUS, inb(idebm + BM_STATUS) | BM_ST_ERR | BM_ST_INTR);
+80102b96:	8d 51 02             	lea    0x2(%ecx),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b99:	ec                   	in     (%dx),%al
+80102b9a:	83 c8 06             	or     $0x6,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b9d:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+80102b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+80102ba3:	e8 8b fd ff ff       	call   80102933 <idewait>
+80102ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+80102bad:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102bb2:	ee                   	out    %al,(%dx)
+80102bb3:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102bb8:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+80102bbc:	ee                   	out    %al,(%dx)
+80102bbd:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102bc2:	89 d8                	mov    %ebx,%eax
+80102bc4:	ee                   	out    %al,(%dx)
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nsect);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102bc5:	0f b6 c7             	movzbl %bh,%eax
+80102bc8:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102bcd:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80102bce:	89 d8                	mov    %ebx,%eax
+80102bd0:	c1 f8 10             	sar    $0x10,%eax
+80102bd3:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102bd8:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((ideactive->dev&1)<<4) | ((sector>>24)&0x0f));
+80102bd9:	a1 1c 58 12 80       	mov    0x8012581c,%eax
+80102bde:	8b 40 04             	mov    0x4(%eax),%eax
+80102be1:	c1 e0 04             	shl    $0x4,%eax
+80102be4:	83 e0 10             	and    $0x10,%eax
+80102be7:	c1 fb 18             	sar    $0x18,%ebx
+80102bea:	83 e3 0f             	and    $0xf,%ebx
+80102bed:	09 d8                	or     %ebx,%eax
+80102bef:	83 c8 e0             	or     $0xffffffe0,%eax
+80102bf2:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102bf7:	ee                   	out    %al,(%dx)
+  outb(0x1f7, write ? IDE_CMD_WRITEDMA : IDE_CMD_READDMA);
+80102bf8:	85 f6                	test   %esi,%esi
+80102bfa:	74 3b                	je     80102c37 <dmastart+0x143>
+80102bfc:	b8 ca 00 00 00       	mov    $0xca,%eax
+80102c01:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102c06:	ee                   	out    %al,(%dx)
+  outb(idebm + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+80102c07:	85 f6                	test   %esi,%esi
+80102c09:	74 33                	je     80102c3e <dmastart+0x14a>
+80102c0b:	b8 01 00 00 00       	mov    $0x1,%eax
+80102c10:	0f b7 15 fc 57 12 80 	movzwl 0x801257fc,%edx
+80102c17:	ee                   	out    %al,(%dx)
+}
+80102c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c1b:	5b                   	pop    %ebx
+80102c1c:	5e                   	pop    %esi
+80102c1d:	5f                   	pop    %edi
+80102c1e:	5d                   	pop    %ebp
+80102c1f:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+80102c20:	83 ec 0c             	sub    $0xc,%esp
+80102c23:	68 30 af 10 80       	push   $0x8010af30
+80102c28:	e8 d5 dc ff ff       	call   80100902 <panic>
+  outb(idebm + BM_CMD, write ? 0 : BM_CMD_READ);
+80102c2d:	b8 08 00 00 00       	mov    $0x8,%eax
+80102c32:	e9 5c ff ff ff       	jmp    80102b93 <dmastart+0x9f>
+  outb(0x1f7, write ? IDE_CMD_WRITEDMA : IDE_CMD_READDMA);
+80102c37:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80102c3c:	eb c3                	jmp    80102c01 <dmastart+0x10d>
+  outb(idebm + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+80102c3e:	b8 09 00 00 00       	mov    $0x9,%eax
+80102c43:	eb cb                	jmp    80102c10 <dmastart+0x11c>
+
+80102c45 <idestart>:
+// Start the request at the head of idequeue, merged with the
+// requests behind it for the following blocks in the same
+// direction. Caller must hold idelock.
+static void
+idestart(void)
+{
+80102c45:	55                   	push   %ebp
+80102c46:	89 e5                	mov    %esp,%ebp
+80102c48:	57                   	push   %edi
+80102c49:	56                   	push   %esi
+80102c4a:	53                   	push   %ebx
+80102c4b:	83 ec 1c             	sub    $0x1c,%esp
+  struct buf *b, *last;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector, nsect, write, cmd;
+
+  if((b = idequeue) == 0)
+80102c4e:	8b 35 20 58 12 80    	mov    0x80125820,%esi
+80102c54:	85 f6                	test   %esi,%esi
+80102c56:	74 58                	je     80102cb0 <idestart+0x6b>
+    panic("idestart");
+  write = (b->flags & B_DIRTY) != 0;
+80102c58:	8b 06                	mov    (%esi),%eax
+80102c5a:	83 e0 04             	and    $0x4,%eax
+80102c5d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102c60:	0f 95 c0             	setne  %al
+80102c63:	89 c7                	mov    %eax,%edi
+80102c65:	0f 95 c0             	setne  %al
+80102c68:	0f b6 c0             	movzbl %al,%eax
+80102c6b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  nsect = sector_per_block;
+  for(last = b; last->qnext; last = last->qnext){
+80102c6e:	89 f0                	mov    %esi,%eax
+  nsect = sector_per_block;
+80102c70:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(last = b; last->qnext; last = last->qnext){
+80102c75:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102c78:	8b 40 7c             	mov    0x7c(%eax),%eax
+80102c7b:	85 c0                	test   %eax,%eax
+80102c7d:	74 3e                	je     80102cbd <idestart+0x78>
+    if(last->qnext->dev != b->dev || last->qnext->blockno != last->blockno + 1)
+80102c7f:	8b 4e 04             	mov    0x4(%esi),%ecx
+80102c82:	39 48 04             	cmp    %ecx,0x4(%eax)
+80102c85:	75 36                	jne    80102cbd <idestart+0x78>
+80102c87:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102c8a:	8b 4a 08             	mov    0x8(%edx),%ecx
+80102c8d:	8d 51 01             	lea    0x1(%ecx),%edx
+80102c90:	39 50 08             	cmp    %edx,0x8(%eax)
+80102c93:	75 28                	jne    80102cbd <idestart+0x78>
+      break;
+    if(((last->qnext->flags & B_DIRTY) != 0) != write)
+80102c95:	f6 00 04             	testb  $0x4,(%eax)
+80102c98:	0f 95 c2             	setne  %dl
+80102c9b:	89 f9                	mov    %edi,%ecx
+80102c9d:	38 d1                	cmp    %dl,%cl
+80102c9f:	75 1c                	jne    80102cbd <idestart+0x78>
+      break;
+    if(nsect + sector_per_block > IDE_MAXSECT)
+80102ca1:	8d 53 01             	lea    0x1(%ebx),%edx
+80102ca4:	81 fb fe 00 00 00    	cmp    $0xfe,%ebx
+80102caa:	7f 11                	jg     80102cbd <idestart+0x78>
+      break;
+    nsect += sector_per_block;
+80102cac:	89 d3                	mov    %edx,%ebx
+80102cae:	eb c5                	jmp    80102c75 <idestart+0x30>
+    panic("idestart");
+80102cb0:	83 ec 0c             	sub    $0xc,%esp
+80102cb3:	68 be af 10 80       	push   $0x8010afbe
+80102cb8:	e8 45 dc ff ff       	call   80100902 <panic>
+  }
+  if(last->blockno >= FSSIZE)
+80102cbd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102cc0:	81 79 08 1f 4e 00 00 	cmpl   $0x4e1f,0x8(%ecx)
+80102cc7:	0f 87 fc 00 00 00    	ja     80102dc9 <idestart+0x184>
+    panic("incorrect blockno");
+  idequeue = last->qnext;
+80102ccd:	a3 20 58 12 80       	mov    %eax,0x80125820
+  last->qnext = 0;
+80102cd2:	c7 41 7c 00 00 00 00 	movl   $0x0,0x7c(%ecx)
+  ideactive = idexfer = b;
+80102cd9:	89 35 14 58 12 80    	mov    %esi,0x80125814
+80102cdf:	89 35 1c 58 12 80    	mov    %esi,0x8012581c
+  idexoff = 0;
+80102ce5:	c7 05 10 58 12 80 00 	movl   $0x0,0x80125810
+80102cec:	00 00 00 
+  idenleft = nsect;
+80102cef:	89 1d 0c 58 12 80    	mov    %ebx,0x8012580c
+  idepos = KEY(b);
+80102cf5:	8b 7e 04             	mov    0x4(%esi),%edi
+80102cf8:	89 f8                	mov    %edi,%eax
+80102cfa:	c1 e0 18             	shl    $0x18,%eax
+80102cfd:	8b 4e 08             	mov    0x8(%esi),%ecx
+80102d00:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102d03:	09 c8                	or     %ecx,%eax
+80102d05:	a3 18 58 12 80       	mov    %eax,0x80125818
+
+  sector = b->blockno * sector_per_block;
+  idedma = idebm && dmaok(b);
+80102d0a:	a1 fc 57 12 80       	mov    0x801257fc,%eax
+80102d0f:	85 c0                	test   %eax,%eax
+80102d11:	0f 85 bf 00 00 00    	jne    80102dd6 <idestart+0x191>
+80102d17:	a3 f8 57 12 80       	mov    %eax,0x801257f8
+  if(idedma){
+80102d1c:	85 c0                	test   %eax,%eax
+80102d1e:	0f 85 cb 00 00 00    	jne    80102def <idestart+0x1aa>
+    dmastart(b, nsect, sector, write);
+    return;
+  }
+  if(idemult[b->dev&1] > 1)
+80102d24:	83 e7 01             	and    $0x1,%edi
+80102d27:	83 3c bd 00 58 12 80 	cmpl   $0x1,-0x7feda800(,%edi,4)
+80102d2e:	01 
+80102d2f:	0f 8e d1 00 00 00    	jle    80102e06 <idestart+0x1c1>
+    cmd = write ? IDE_CMD_WRMUL : IDE_CMD_RDMUL;
+80102d35:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80102d39:	0f 84 d7 00 00 00    	je     80102e16 <idestart+0x1d1>
+80102d3f:	bf c5 00 00 00       	mov    $0xc5,%edi
+  else
+    cmd = write ? IDE_CMD_WRITE : IDE_CMD_READ;
+
+  idewait(0);
+80102d44:	b8 00 00 00 00       	mov    $0x0,%eax
+80102d49:	e8 e5 fb ff ff       	call   80102933 <idewait>
+80102d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+80102d53:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102d58:	ee                   	out    %al,(%dx)
+80102d59:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102d5e:	89 d8                	mov    %ebx,%eax
+80102d60:	ee                   	out    %al,(%dx)
+80102d61:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102d66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102d69:	89 c8                	mov    %ecx,%eax
+80102d6b:	ee                   	out    %al,(%dx)
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nsect);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102d6c:	0f b6 c5             	movzbl %ch,%eax
+80102d6f:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102d74:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80102d75:	89 c8                	mov    %ecx,%eax
+80102d77:	c1 f8 10             	sar    $0x10,%eax
+80102d7a:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102d7f:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80102d80:	8b 46 04             	mov    0x4(%esi),%eax
+80102d83:	c1 e0 04             	shl    $0x4,%eax
+80102d86:	83 e0 10             	and    $0x10,%eax
+80102d89:	c1 f9 18             	sar    $0x18,%ecx
+80102d8c:	89 ca                	mov    %ecx,%edx
+80102d8e:	83 e2 0f             	and    $0xf,%edx
+80102d91:	09 d0                	or     %edx,%eax
+80102d93:	83 c8 e0             	or     $0xffffffe0,%eax
+80102d96:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102d9b:	ee                   	out    %al,(%dx)
+80102d9c:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102da1:	89 f8                	mov    %edi,%eax
+80102da3:	ee                   	out    %al,(%dx)
+  outb(0x1f7, cmd);
+  if(write){
+80102da4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80102da8:	74 17                	je     80102dc1 <idestart+0x17c>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102daa:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102daf:	ec                   	in     (%dx),%al
+    while((inb(0x1f7) & (IDE_BSY|IDE_DRQ)) != IDE_DRQ)
+80102db0:	83 e0 88             	and    $0xffffff88,%eax
+80102db3:	3c 08                	cmp    $0x8,%al
+80102db5:	75 f3                	jne    80102daa <idestart+0x165>
+      ;
+    idepio(1);
+80102db7:	b8 01 00 00 00       	mov    $0x1,%eax
+80102dbc:	e8 f4 fb ff ff       	call   801029b5 <idepio>
+  }
+}
+80102dc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102dc4:	5b                   	pop    %ebx
+80102dc5:	5e                   	pop    %esi
+80102dc6:	5f                   	pop    %edi
+80102dc7:	5d                   	pop    %ebp
+80102dc8:	c3                   	ret
+    panic("incorrect blockno");
+80102dc9:	83 ec 0c             	sub    $0xc,%esp
+80102dcc:	68 c7 af 10 80       	push   $0x8010afc7
+80102dd1:	e8 2c db ff ff       	call   80100902 <panic>
+  idedma = idebm && dmaok(b);
+80102dd6:	89 f0                	mov    %esi,%eax
+80102dd8:	e8 d5 fc ff ff       	call   80102ab2 <dmaok>
+80102ddd:	85 c0                	test   %eax,%eax
+80102ddf:	0f 84 32 ff ff ff    	je     80102d17 <idestart+0xd2>
+80102de5:	b8 01 00 00 00       	mov    $0x1,%eax
+80102dea:	e9 28 ff ff ff       	jmp    80102d17 <idestart+0xd2>
+    dmastart(b, nsect, sector, write);
+80102def:	83 ec 0c             	sub    $0xc,%esp
+80102df2:	ff 75 dc             	push   -0x24(%ebp)
+80102df5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102df8:	89 da                	mov    %ebx,%edx
+80102dfa:	89 f0                	mov    %esi,%eax
+80102dfc:	e8 f3 fc ff ff       	call   80102af4 <dmastart>
+    return;
+80102e01:	83 c4 10             	add    $0x10,%esp
+80102e04:	eb bb                	jmp    80102dc1 <idestart+0x17c>
+    cmd = write ? IDE_CMD_WRITE : IDE_CMD_READ;
+80102e06:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80102e0a:	74 14                	je     80102e20 <idestart+0x1db>
+80102e0c:	bf 30 00 00 00       	mov    $0x30,%edi
+80102e11:	e9 2e ff ff ff       	jmp    80102d44 <idestart+0xff>
+    cmd = write ? IDE_CMD_WRMUL : IDE_CMD_RDMUL;
+80102e16:	bf c4 00 00 00       	mov    $0xc4,%edi
+80102e1b:	e9 24 ff ff ff       	jmp    80102d44 <idestart+0xff>
+    cmd = write ? IDE_CMD_WRITE : IDE_CMD_READ;
+80102e20:	bf 20 00 00 00       	mov    $0x20,%edi
+80102e25:	e9 1a ff ff ff       	jmp    80102d44 <idestart+0xff>
+
+80102e2a <dmadone>:
+{
+80102e2a:	55                   	push   %ebp
+80102e2b:	89 e5                	mov    %esp,%ebp
+80102e2d:	56                   	push   %esi
+80102e2e:	53                   	push   %ebx
+  st = inb(idebm + BM_STATUS);
+80102e2f:	8b 0d fc 57 12 80    	mov    0x801257fc,%ecx
+80102e35:	89 ce                	mov    %ecx,%esi
+80102e37:	83 c1 02             	add    $0x2,%ecx
+80102e3a:	89 ca                	mov    %ecx,%edx
+80102e3c:	ec                   	in     (%dx),%al
+80102e3d:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+80102e44:	89 f2                	mov    %esi,%edx
+80102e46:	ee                   	out    %al,(%dx)
+  outb(idebm + BM_STATUS, st | BM_ST_ERR | BM_ST_INTR);
+80102e47:	89 d8                	mov    %ebx,%eax
+80102e49:	83 c8 06             	or     $0x6,%eax
+80102e4c:	89 ca                	mov    %ecx,%edx
+80102e4e:	ee                   	out    %al,(%dx)
+  if((st & BM_ST_ERR) == 0 && idewait(1) >= 0)
+80102e4f:	f6 c3 02             	test   $0x2,%bl
+80102e52:	75 1a                	jne    80102e6e <dmadone+0x44>
+80102e54:	b8 01 00 00 00       	mov    $0x1,%eax
+80102e59:	e8 d5 fa ff ff       	call   80102933 <idewait>
+80102e5e:	85 c0                	test   %eax,%eax
+80102e60:	78 0c                	js     80102e6e <dmadone+0x44>
+    return 0;
+80102e62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80102e67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102e6a:	5b                   	pop    %ebx
+80102e6b:	5e                   	pop    %esi
+80102e6c:	5d                   	pop    %ebp
+80102e6d:	c3                   	ret
+  cprintf("ide: DMA failed, using PIO\n");
+80102e6e:	83 ec 0c             	sub    $0xc,%esp
+80102e71:	68 d9 af 10 80       	push   $0x8010afd9
+80102e76:	e8 7e de ff ff       	call   80100cf9 <cprintf>
+  idebm = 0;
+80102e7b:	c7 05 fc 57 12 80 00 	movl   $0x0,0x801257fc
+80102e82:	00 00 00 
+  for(b = ideactive; b->qnext; b = b->qnext)
+80102e85:	8b 0d 1c 58 12 80    	mov    0x8012581c,%ecx
+80102e8b:	83 c4 10             	add    $0x10,%esp
+80102e8e:	89 c8                	mov    %ecx,%eax
+80102e90:	89 c2                	mov    %eax,%edx
+80102e92:	8b 40 7c             	mov    0x7c(%eax),%eax
+80102e95:	85 c0                	test   %eax,%eax
+80102e97:	75 f7                	jne    80102e90 <dmadone+0x66>
+  b->qnext = idequeue;
+80102e99:	a1 20 58 12 80       	mov    0x80125820,%eax
+80102e9e:	89 42 7c             	mov    %eax,0x7c(%edx)
+  idequeue = ideactive;
+80102ea1:	89 0d 20 58 12 80    	mov    %ecx,0x80125820
+  ideactive = 0;
+80102ea7:	c7 05 1c 58 12 80 00 	movl   $0x0,0x8012581c
+80102eae:	00 00 00 
+  idestart();
+80102eb1:	e8 8f fd ff ff       	call   80102c45 <idestart>
+  return -1;
+80102eb6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102ebb:	eb aa                	jmp    80102e67 <dmadone+0x3d>
+
+80102ebd <idequeueb>:
+//PAGEBREAK!
+// Queue b for the disk in elevator order. Caller must hold
+// idelock and start the disk if it is idle.
+static void
+idequeueb(struct buf *b)
+{
+80102ebd:	55                   	push   %ebp
+80102ebe:	89 e5                	mov    %esp,%ebp
+80102ec0:	57                   	push   %edi
+80102ec1:	56                   	push   %esi
+80102ec2:	53                   	push   %ebx
+80102ec3:	83 ec 18             	sub    $0x18,%esp
+80102ec6:	89 c3                	mov    %eax,%ebx
+  struct buf **pp;
+  uint k;
+
+  if(!holdingsleep(&b->lock))
+80102ec8:	8d 40 0c             	lea    0xc(%eax),%eax
+80102ecb:	50                   	push   %eax
+80102ecc:	e8 b3 4b 00 00       	call   80107a84 <holdingsleep>
+80102ed1:	83 c4 10             	add    $0x10,%esp
+80102ed4:	85 c0                	test   %eax,%eax
+80102ed6:	74 2f                	je     80102f07 <idequeueb+0x4a>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80102ed8:	8b 03                	mov    (%ebx),%eax
+80102eda:	83 e0 06             	and    $0x6,%eax
+80102edd:	83 f8 02             	cmp    $0x2,%eax
+80102ee0:	74 32                	je     80102f14 <idequeueb+0x57>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+80102ee2:	8b 73 04             	mov    0x4(%ebx),%esi
+80102ee5:	85 f6                	test   %esi,%esi
+80102ee7:	74 09                	je     80102ef2 <idequeueb+0x35>
+80102ee9:	83 3d 08 58 12 80 00 	cmpl   $0x0,0x80125808
+80102ef0:	74 2f                	je     80102f21 <idequeueb+0x64>
+    panic("iderw: ide disk 1 not present");
+
+  k = KEY(b) - idepos;
+80102ef2:	c1 e6 18             	shl    $0x18,%esi
+80102ef5:	0b 73 08             	or     0x8(%ebx),%esi
+80102ef8:	8b 3d 18 58 12 80    	mov    0x80125818,%edi
+80102efe:	29 fe                	sub    %edi,%esi
+  for(pp=&idequeue; *pp && KEY(*pp) - idepos <= k; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102f00:	b9 20 58 12 80       	mov    $0x80125820,%ecx
+80102f05:	eb 2a                	jmp    80102f31 <idequeueb+0x74>
+    panic("iderw: buf not locked");
+80102f07:	83 ec 0c             	sub    $0xc,%esp
+80102f0a:	68 f5 af 10 80       	push   $0x8010aff5
+80102f0f:	e8 ee d9 ff ff       	call   80100902 <panic>
+    panic("iderw: nothing to do");
+80102f14:	83 ec 0c             	sub    $0xc,%esp
+80102f17:	68 0b b0 10 80       	push   $0x8010b00b
+80102f1c:	e8 e1 d9 ff ff       	call   80100902 <panic>
+    panic("iderw: ide disk 1 not present");
+80102f21:	83 ec 0c             	sub    $0xc,%esp
+80102f24:	68 20 b0 10 80       	push   $0x8010b020
+80102f29:	e8 d4 d9 ff ff       	call   80100902 <panic>
+  for(pp=&idequeue; *pp && KEY(*pp) - idepos <= k; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102f2e:	8d 4a 7c             	lea    0x7c(%edx),%ecx
+80102f31:	8b 11                	mov    (%ecx),%edx
+80102f33:	85 d2                	test   %edx,%edx
+80102f35:	74 0f                	je     80102f46 <idequeueb+0x89>
+80102f37:	8b 42 04             	mov    0x4(%edx),%eax
+80102f3a:	c1 e0 18             	shl    $0x18,%eax
+80102f3d:	0b 42 08             	or     0x8(%edx),%eax
+80102f40:	29 f8                	sub    %edi,%eax
+80102f42:	39 c6                	cmp    %eax,%esi
+80102f44:	73 e8                	jae    80102f2e <idequeueb+0x71>
+    ;
+  b->qnext = *pp;
+80102f46:	89 53 7c             	mov    %edx,0x7c(%ebx)
+  *pp = b;
+80102f49:	89 19                	mov    %ebx,(%ecx)
+}
+80102f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f4e:	5b                   	pop    %ebx
+80102f4f:	5e                   	pop    %esi
+80102f50:	5f                   	pop    %edi
+80102f51:	5d                   	pop    %ebp
+80102f52:	c3                   	ret
+
+80102f53 <ideinit>:
+{
+80102f53:	55                   	push   %ebp
+80102f54:	89 e5                	mov    %esp,%ebp
+80102f56:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80102f59:	68 3e b0 10 80       	push   $0x8010b03e
+80102f5e:	68 40 58 12 80       	push   $0x80125840
+80102f63:	e8 6a 4b 00 00       	call   80107ad2 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102f68:	83 c4 08             	add    $0x8,%esp
+80102f6b:	a1 84 62 14 80       	mov    0x80146284,%eax
+80102f70:	83 e8 01             	sub    $0x1,%eax
+80102f73:	50                   	push   %eax
+80102f74:	6a 0e                	push   $0xe
+80102f76:	e8 b7 03 00 00       	call   80103332 <ioapicenable>
+  idewait(0);
+80102f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+80102f80:	e8 ae f9 ff ff       	call   80102933 <idewait>
+80102f85:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80102f8a:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102f8f:	ee                   	out    %al,(%dx)
+  for(i=0; i<1000; i++){
+80102f90:	83 c4 10             	add    $0x10,%esp
+80102f93:	b9 00 00 00 00       	mov    $0x0,%ecx
+80102f98:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+80102f9e:	7f 19                	jg     80102fb9 <ideinit+0x66>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fa0:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102fa5:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102fa6:	84 c0                	test   %al,%al
+80102fa8:	75 05                	jne    80102faf <ideinit+0x5c>
+  for(i=0; i<1000; i++){
+80102faa:	83 c1 01             	add    $0x1,%ecx
+80102fad:	eb e9                	jmp    80102f98 <ideinit+0x45>
+      havedisk1 = 1;
+80102faf:	c7 05 08 58 12 80 01 	movl   $0x1,0x80125808
+80102fb6:	00 00 00 
+  idemult[0] = setmult(0);
+80102fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+80102fbe:	e8 99 f9 ff ff       	call   8010295c <setmult>
+80102fc3:	a3 00 58 12 80       	mov    %eax,0x80125800
+  if(havedisk1)
+80102fc8:	83 3d 08 58 12 80 00 	cmpl   $0x0,0x80125808
+80102fcf:	75 12                	jne    80102fe3 <ideinit+0x90>
+  dmainit();
+80102fd1:	e8 82 fa ff ff       	call   80102a58 <dmainit>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fd6:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102fdb:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102fe0:	ee                   	out    %al,(%dx)
+}
+80102fe1:	c9                   	leave
+80102fe2:	c3                   	ret
+    idemult[1] = setmult(1);
+80102fe3:	b8 01 00 00 00       	mov    $0x1,%eax
+80102fe8:	e8 6f f9 ff ff       	call   8010295c <setmult>
+80102fed:	a3 04 58 12 80       	mov    %eax,0x80125804
+80102ff2:	eb dd                	jmp    80102fd1 <ideinit+0x7e>
+
+80102ff4 <ideintr>:
+{
+80102ff4:	55                   	push   %ebp
+80102ff5:	89 e5                	mov    %esp,%ebp
+80102ff7:	56                   	push   %esi
+80102ff8:	53                   	push   %ebx
+  acquire(&idelock);
+80102ff9:	83 ec 0c             	sub    $0xc,%esp
+80102ffc:	68 40 58 12 80       	push   $0x80125840
+80103001:	e8 17 4c 00 00       	call   80107c1d <acquire>
+  if(ideactive == 0){
+80103006:	a1 1c 58 12 80       	mov    0x8012581c,%eax
+8010300b:	83 c4 10             	add    $0x10,%esp
+8010300e:	85 c0                	test   %eax,%eax
+80103010:	74 28                	je     8010303a <ideintr+0x46>
+  write = (ideactive->flags & B_DIRTY) != 0;
+80103012:	8b 00                	mov    (%eax),%eax
+80103014:	83 e0 04             	and    $0x4,%eax
+80103017:	89 c3                	mov    %eax,%ebx
+  if(idedma){
+80103019:	83 3d f8 57 12 80 00 	cmpl   $0x0,0x801257f8
+80103020:	74 42                	je     80103064 <ideintr+0x70>
+    if(dmadone() < 0){
+80103022:	e8 03 fe ff ff       	call   80102e2a <dmadone>
+80103027:	85 c0                	test   %eax,%eax
+80103029:	78 24                	js     8010304f <ideintr+0x5b>
+  for(b = ideactive; b; b = next){
+8010302b:	a1 1c 58 12 80       	mov    0x8012581c,%eax
+  done = 0;
+80103030:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(b = ideactive; b; b = next){
+80103035:	e9 a7 00 00 00       	jmp    801030e1 <ideintr+0xed>
+    release(&idelock);
+8010303a:	83 ec 0c             	sub    $0xc,%esp
+8010303d:	68 40 58 12 80       	push   $0x80125840
+80103042:	e8 55 4c 00 00       	call   80107c9c <release>
+    return;
+80103047:	83 c4 10             	add    $0x10,%esp
+8010304a:	e9 ff 00 00 00       	jmp    8010314e <ideintr+0x15a>
+      release(&idelock);
+8010304f:	83 ec 0c             	sub    $0xc,%esp
+80103052:	68 40 58 12 80       	push   $0x80125840
+80103057:	e8 40 4c 00 00       	call   80107c9c <release>
+      return;
+8010305c:	83 c4 10             	add    $0x10,%esp
+8010305f:	e9 ea 00 00 00       	jmp    8010314e <ideintr+0x15a>
+  } else if(idewait(1) < 0){
+80103064:	b8 01 00 00 00       	mov    $0x1,%eax
+80103069:	e8 c5 f8 ff ff       	call   80102933 <idewait>
+8010306e:	85 c0                	test   %eax,%eax
+80103070:	78 2c                	js     8010309e <ideintr+0xaa>
+  } else if(write){
+80103072:	85 db                	test   %ebx,%ebx
+80103074:	74 34                	je     801030aa <ideintr+0xb6>
+    if(idenleft > 0){
+80103076:	83 3d 0c 58 12 80 00 	cmpl   $0x0,0x8012580c
+8010307d:	7e ac                	jle    8010302b <ideintr+0x37>
+      idepio(1);
+8010307f:	b8 01 00 00 00       	mov    $0x1,%eax
+80103084:	e8 2c f9 ff ff       	call   801029b5 <idepio>
+      release(&idelock);
+80103089:	83 ec 0c             	sub    $0xc,%esp
+8010308c:	68 40 58 12 80       	push   $0x80125840
+80103091:	e8 06 4c 00 00       	call   80107c9c <release>
+      return;
+80103096:	83 c4 10             	add    $0x10,%esp
+80103099:	e9 b0 00 00 00       	jmp    8010314e <ideintr+0x15a>
+    idenleft = 0;
+8010309e:	c7 05 0c 58 12 80 00 	movl   $0x0,0x8012580c
+801030a5:	00 00 00 
+801030a8:	eb 81                	jmp    8010302b <ideintr+0x37>
+    idepio(0);
+801030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+801030af:	e8 01 f9 ff ff       	call   801029b5 <idepio>
+    if(idenleft > 0){
+801030b4:	83 3d 0c 58 12 80 00 	cmpl   $0x0,0x8012580c
+801030bb:	0f 8e 6a ff ff ff    	jle    8010302b <ideintr+0x37>
+      release(&idelock);
+801030c1:	83 ec 0c             	sub    $0xc,%esp
+801030c4:	68 40 58 12 80       	push   $0x80125840
+801030c9:	e8 ce 4b 00 00       	call   80107c9c <release>
+      return;
+801030ce:	83 c4 10             	add    $0x10,%esp
+801030d1:	eb 7b                	jmp    8010314e <ideintr+0x15a>
+    wakeup(b);
+801030d3:	83 ec 0c             	sub    $0xc,%esp
+801030d6:	50                   	push   %eax
+801030d7:	e8 f0 35 00 00       	call   801066cc <wakeup>
+801030dc:	83 c4 10             	add    $0x10,%esp
+  for(b = ideactive; b; b = next){
+801030df:	89 f0                	mov    %esi,%eax
+801030e1:	85 c0                	test   %eax,%eax
+801030e3:	74 2a                	je     8010310f <ideintr+0x11b>
+    next = b->qnext;
+801030e5:	8b 70 7c             	mov    0x7c(%eax),%esi
+    b->flags |= B_VALID;
+801030e8:	8b 10                	mov    (%eax),%edx
+801030ea:	89 d1                	mov    %edx,%ecx
+801030ec:	83 c9 02             	or     $0x2,%ecx
+801030ef:	89 08                	mov    %ecx,(%eax)
+    b->flags &= ~B_DIRTY;
+801030f1:	89 d1                	mov    %edx,%ecx
+801030f3:	83 e1 fb             	and    $0xfffffffb,%ecx
+801030f6:	83 c9 02             	or     $0x2,%ecx
+801030f9:	89 08                	mov    %ecx,(%eax)
+    if(b->flags & B_ASYNC){
+801030fb:	f6 c2 08             	test   $0x8,%dl
+801030fe:	74 d3                	je     801030d3 <ideintr+0xdf>
+      b->flags &= ~B_ASYNC;
+80103100:	83 e2 f3             	and    $0xfffffff3,%edx
+80103103:	83 ca 02             	or     $0x2,%edx
+80103106:	89 10                	mov    %edx,(%eax)
+      b->qnext = done;
+80103108:	89 58 7c             	mov    %ebx,0x7c(%eax)
+      done = b;
+8010310b:	89 c3                	mov    %eax,%ebx
+8010310d:	eb c4                	jmp    801030d3 <ideintr+0xdf>
+  ideactive = 0;
+8010310f:	c7 05 1c 58 12 80 00 	movl   $0x0,0x8012581c
+80103116:	00 00 00 
+  if(idequeue != 0)
+80103119:	83 3d 20 58 12 80 00 	cmpl   $0x0,0x80125820
+80103120:	74 05                	je     80103127 <ideintr+0x133>
+    idestart();
+80103122:	e8 1e fb ff ff       	call   80102c45 <idestart>
+  release(&idelock);
+80103127:	83 ec 0c             	sub    $0xc,%esp
+8010312a:	68 40 58 12 80       	push   $0x80125840
+8010312f:	e8 68 4b 00 00       	call   80107c9c <release>
+  for(b = done; b; b = next){
+80103134:	83 c4 10             	add    $0x10,%esp
+80103137:	eb 11                	jmp    8010314a <ideintr+0x156>
+    next = b->qnext;
+80103139:	8b 73 7c             	mov    0x7c(%ebx),%esi
+    bdone(b);
+8010313c:	83 ec 0c             	sub    $0xc,%esp
+8010313f:	53                   	push   %ebx
+80103140:	e8 82 d4 ff ff       	call   801005c7 <bdone>
+80103145:	83 c4 10             	add    $0x10,%esp
+  for(b = done; b; b = next){
+80103148:	89 f3                	mov    %esi,%ebx
+8010314a:	85 db                	test   %ebx,%ebx
+8010314c:	75 eb                	jne    80103139 <ideintr+0x145>
+}
+8010314e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103151:	5b                   	pop    %ebx
+80103152:	5e                   	pop    %esi
+80103153:	5d                   	pop    %ebp
+80103154:	c3                   	ret
+
+80103155 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80103155:	55                   	push   %ebp
+80103156:	89 e5                	mov    %esp,%ebp
+80103158:	53                   	push   %ebx
+80103159:	83 ec 10             	sub    $0x10,%esp
+8010315c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);  //DOC:acquire-lock
+8010315f:	68 40 58 12 80       	push   $0x80125840
+80103164:	e8 b4 4a 00 00       	call   80107c1d <acquire>
+
+  idequeueb(b);
+80103169:	89 d8                	mov    %ebx,%eax
+8010316b:	e8 4d fd ff ff       	call   80102ebd <idequeueb>
+
+  // Start disk if necessary.
+  if(ideactive == 0)
+80103170:	83 c4 10             	add    $0x10,%esp
+80103173:	83 3d 1c 58 12 80 00 	cmpl   $0x0,0x8012581c
+8010317a:	75 18                	jne    80103194 <iderw+0x3f>
+    idestart();
+8010317c:	e8 c4 fa ff ff       	call   80102c45 <idestart>
+80103181:	eb 11                	jmp    80103194 <iderw+0x3f>
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+    sleep(b, &idelock);
+80103183:	83 ec 08             	sub    $0x8,%esp
+80103186:	68 40 58 12 80       	push   $0x80125840
+8010318b:	53                   	push   %ebx
+8010318c:	e8 e6 33 00 00       	call   80106577 <sleep>
+80103191:	83 c4 10             	add    $0x10,%esp
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103194:	8b 03                	mov    (%ebx),%eax
+80103196:	83 e0 06             	and    $0x6,%eax
+80103199:	83 f8 02             	cmp    $0x2,%eax
+8010319c:	75 e5                	jne    80103183 <iderw+0x2e>
+  }
+
+  release(&idelock);
+8010319e:	83 ec 0c             	sub    $0xc,%esp
+801031a1:	68 40 58 12 80       	push   $0x80125840
+801031a6:	e8 f1 4a 00 00       	call   80107c9c <release>
+}
+801031ab:	83 c4 10             	add    $0x10,%esp
+801031ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801031b1:	c9                   	leave
+801031b2:	c3                   	ret
+
+801031b3 <idesubmit>:
+// Like iderw, but return as soon as b is queued. The driver
+// releases b with bdone when the request completes, so the
+// caller must not touch b after submitting it.
+void
+idesubmit(struct buf *b)
+{
+801031b3:	55                   	push   %ebp
+801031b4:	89 e5                	mov    %esp,%ebp
+801031b6:	53                   	push   %ebx
+801031b7:	83 ec 10             	sub    $0x10,%esp
+801031ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);
+801031bd:	68 40 58 12 80       	push   $0x80125840
+801031c2:	e8 56 4a 00 00       	call   80107c1d <acquire>
+  b->flags |= B_ASYNC;
+801031c7:	8b 03                	mov    (%ebx),%eax
+801031c9:	83 c8 08             	or     $0x8,%eax
+801031cc:	89 03                	mov    %eax,(%ebx)
+  idequeueb(b);
+801031ce:	89 d8                	mov    %ebx,%eax
+801031d0:	e8 e8 fc ff ff       	call   80102ebd <idequeueb>
+  if(ideactive == 0)
+801031d5:	83 c4 10             	add    $0x10,%esp
+801031d8:	83 3d 1c 58 12 80 00 	cmpl   $0x0,0x8012581c
+801031df:	74 15                	je     801031f6 <idesubmit+0x43>
+    idestart();
+  release(&idelock);
+801031e1:	83 ec 0c             	sub    $0xc,%esp
+801031e4:	68 40 58 12 80       	push   $0x80125840
+801031e9:	e8 ae 4a 00 00       	call   80107c9c <release>
+}
+801031ee:	83 c4 10             	add    $0x10,%esp
+801031f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801031f4:	c9                   	leave
+801031f5:	c3                   	ret
+    idestart();
+801031f6:	e8 4a fa ff ff       	call   80102c45 <idestart>
+801031fb:	eb e4                	jmp    801031e1 <idesubmit+0x2e>
+
+801031fd <iderwv>:
+
+// Like iderw for n bufs at once. They are all queued before
+// the disk starts, so that adjacent ones are merged.
+void
+iderwv(struct buf **b, int n)
+{
+801031fd:	55                   	push   %ebp
+801031fe:	89 e5                	mov    %esp,%ebp
+80103200:	57                   	push   %edi
+80103201:	56                   	push   %esi
+80103202:	53                   	push   %ebx
+80103203:	83 ec 18             	sub    $0x18,%esp
+80103206:	8b 75 08             	mov    0x8(%ebp),%esi
+80103209:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&idelock);
+8010320c:	68 40 58 12 80       	push   $0x80125840
+80103211:	e8 07 4a 00 00       	call   80107c1d <acquire>
+  for(i = 0; i < n; i++)
+80103216:	83 c4 10             	add    $0x10,%esp
+80103219:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010321e:	eb 0b                	jmp    8010322b <iderwv+0x2e>
+    idequeueb(b[i]);
+80103220:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+80103223:	e8 95 fc ff ff       	call   80102ebd <idequeueb>
+  for(i = 0; i < n; i++)
+80103228:	83 c3 01             	add    $0x1,%ebx
+8010322b:	39 fb                	cmp    %edi,%ebx
+8010322d:	7c f1                	jl     80103220 <iderwv+0x23>
+  if(ideactive == 0 && idequeue != 0)
+8010322f:	83 3d 1c 58 12 80 00 	cmpl   $0x0,0x8012581c
+80103236:	74 07                	je     8010323f <iderwv+0x42>
+  for(i = 0; i < n; i++)
+80103238:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010323d:	eb 31                	jmp    80103270 <iderwv+0x73>
+  if(ideactive == 0 && idequeue != 0)
+8010323f:	83 3d 20 58 12 80 00 	cmpl   $0x0,0x80125820
+80103246:	74 f0                	je     80103238 <iderwv+0x3b>
+    idestart();
+80103248:	e8 f8 f9 ff ff       	call   80102c45 <idestart>
+8010324d:	eb e9                	jmp    80103238 <iderwv+0x3b>
+  for(i = 0; i < n; i++)
+    while((b[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(b[i], &idelock);
+8010324f:	83 ec 08             	sub    $0x8,%esp
+80103252:	68 40 58 12 80       	push   $0x80125840
+80103257:	52                   	push   %edx
+80103258:	e8 1a 33 00 00       	call   80106577 <sleep>
+8010325d:	83 c4 10             	add    $0x10,%esp
+    while((b[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80103260:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+80103263:	8b 02                	mov    (%edx),%eax
+80103265:	83 e0 06             	and    $0x6,%eax
+80103268:	83 f8 02             	cmp    $0x2,%eax
+8010326b:	75 e2                	jne    8010324f <iderwv+0x52>
+  for(i = 0; i < n; i++)
+8010326d:	83 c3 01             	add    $0x1,%ebx
+80103270:	39 fb                	cmp    %edi,%ebx
+80103272:	7c ec                	jl     80103260 <iderwv+0x63>
+  release(&idelock);
+80103274:	83 ec 0c             	sub    $0xc,%esp
+80103277:	68 40 58 12 80       	push   $0x80125840
+8010327c:	e8 1b 4a 00 00       	call   80107c9c <release>
+}
+80103281:	83 c4 10             	add    $0x10,%esp
+80103284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103287:	5b                   	pop    %ebx
+80103288:	5e                   	pop    %esi
+80103289:	5f                   	pop    %edi
+8010328a:	5d                   	pop    %ebp
+8010328b:	c3                   	ret
+
+8010328c <ioapicread>:
+};
+
+static uint
+ioapicread(int reg)
+{
+  ioapic->reg = reg;
+8010328c:	8b 15 8c 58 12 80    	mov    0x8012588c,%edx
+80103292:	89 02                	mov    %eax,(%edx)
+  return ioapic->data;
+80103294:	a1 8c 58 12 80       	mov    0x8012588c,%eax
+80103299:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010329c:	c3                   	ret
+
+8010329d <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+  ioapic->reg = reg;
+8010329d:	8b 0d 8c 58 12 80    	mov    0x8012588c,%ecx
+801032a3:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801032a5:	a1 8c 58 12 80       	mov    0x8012588c,%eax
+801032aa:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801032ad:	c3                   	ret
+
+801032ae <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+801032ae:	55                   	push   %ebp
+801032af:	89 e5                	mov    %esp,%ebp
+801032b1:	57                   	push   %edi
+801032b2:	56                   	push   %esi
+801032b3:	53                   	push   %ebx
+801032b4:	83 ec 0c             	sub    $0xc,%esp
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801032b7:	c7 05 8c 58 12 80 00 	movl   $0xfec00000,0x8012588c
+801032be:	00 c0 fe 
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801032c1:	b8 01 00 00 00       	mov    $0x1,%eax
+801032c6:	e8 c1 ff ff ff       	call   8010328c <ioapicread>
+801032cb:	c1 e8 10             	shr    $0x10,%eax
+801032ce:	0f b6 f8             	movzbl %al,%edi
+  id = ioapicread(REG_ID) >> 24;
+801032d1:	b8 00 00 00 00       	mov    $0x0,%eax
+801032d6:	e8 b1 ff ff ff       	call   8010328c <ioapicread>
+801032db:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+801032de:	0f b6 15 80 62 14 80 	movzbl 0x80146280,%edx
+801032e5:	39 c2                	cmp    %eax,%edx
+801032e7:	75 07                	jne    801032f0 <ioapicinit+0x42>
+{
+801032e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+801032ee:	eb 36                	jmp    80103326 <ioapicinit+0x78>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801032f0:	83 ec 0c             	sub    $0xc,%esp
+801032f3:	68 44 b0 10 80       	push   $0x8010b044
+801032f8:	e8 fc d9 ff ff       	call   80100cf9 <cprintf>
+801032fd:	83 c4 10             	add    $0x10,%esp
+80103300:	eb e7                	jmp    801032e9 <ioapicinit+0x3b>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+80103302:	8d 53 20             	lea    0x20(%ebx),%edx
+80103305:	81 ca 00 00 01 00    	or     $0x10000,%edx
+8010330b:	8d 74 1b 10          	lea    0x10(%ebx,%ebx,1),%esi
+8010330f:	89 f0                	mov    %esi,%eax
+80103311:	e8 87 ff ff ff       	call   8010329d <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+80103316:	8d 46 01             	lea    0x1(%esi),%eax
+80103319:	ba 00 00 00 00       	mov    $0x0,%edx
+8010331e:	e8 7a ff ff ff       	call   8010329d <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+80103323:	83 c3 01             	add    $0x1,%ebx
+80103326:	39 fb                	cmp    %edi,%ebx
+80103328:	7e d8                	jle    80103302 <ioapicinit+0x54>
+  }
+}
+8010332a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010332d:	5b                   	pop    %ebx
+8010332e:	5e                   	pop    %esi
+8010332f:	5f                   	pop    %edi
+80103330:	5d                   	pop    %ebp
+80103331:	c3                   	ret
+
+80103332 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80103332:	55                   	push   %ebp
+80103333:	89 e5                	mov    %esp,%ebp
+80103335:	53                   	push   %ebx
+80103336:	83 ec 04             	sub    $0x4,%esp
+80103339:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010333c:	8d 50 20             	lea    0x20(%eax),%edx
+8010333f:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+80103343:	89 d8                	mov    %ebx,%eax
+80103345:	e8 53 ff ff ff       	call   8010329d <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010334a:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010334d:	c1 e2 18             	shl    $0x18,%edx
+80103350:	8d 43 01             	lea    0x1(%ebx),%eax
+80103353:	e8 45 ff ff ff       	call   8010329d <ioapicwrite>
+}
+80103358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010335b:	c9                   	leave
+8010335c:	c3                   	ret
+
+8010335d <ioapicenablepci>:
+
+// Like ioapicenable, for the level-triggered line irq of a PCI
+// device, delivered on the vector of IRQ vecirq.
+void
+ioapicenablepci(int irq, int vecirq, int cpunum)
+{
+8010335d:	55                   	push   %ebp
+8010335e:	89 e5                	mov    %esp,%ebp
+80103360:	53                   	push   %ebx
+80103361:	83 ec 04             	sub    $0x4,%esp
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | (T_IRQ0 + vecirq));
+80103364:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103367:	8d 50 20             	lea    0x20(%eax),%edx
+8010336a:	80 ce 80             	or     $0x80,%dh
+8010336d:	8b 45 08             	mov    0x8(%ebp),%eax
+80103370:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+80103374:	89 d8                	mov    %ebx,%eax
+80103376:	e8 22 ff ff ff       	call   8010329d <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010337b:	8b 55 10             	mov    0x10(%ebp),%edx
+8010337e:	c1 e2 18             	shl    $0x18,%edx
+80103381:	8d 43 01             	lea    0x1(%ebx),%eax
+80103384:	e8 14 ff ff ff       	call   8010329d <ioapicwrite>
+}
+80103389:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010338c:	c9                   	leave
+8010338d:	c3                   	ret
+
+8010338e <take>:
+
+// Detach up to n pages from the front of *list.
+// Returns the chain, its length in *got and its last page in *tail.
+static struct run*
+take(struct run **list, int n, int *got, struct run **tail)
+{
+8010338e:	55                   	push   %ebp
+8010338f:	89 e5                	mov    %esp,%ebp
+80103391:	57                   	push   %edi
+80103392:	56                   	push   %esi
+80103393:	53                   	push   %ebx
+80103394:	83 ec 08             	sub    $0x8,%esp
+80103397:	89 45 f0             	mov    %eax,-0x10(%ebp)
+8010339a:	89 d3                	mov    %edx,%ebx
+8010339c:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+8010339f:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct run *head, *r;
+  int i;
+
+  head = r = *list;
+801033a2:	8b 38                	mov    (%eax),%edi
+  *tail = 0;
+801033a4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  head = r = *list;
+801033aa:	89 f8                	mov    %edi,%eax
+  for(i = 0; i < n && r; i++){
+801033ac:	ba 00 00 00 00       	mov    $0x0,%edx
+801033b1:	eb 07                	jmp    801033ba <take+0x2c>
+    *tail = r;
+801033b3:	89 06                	mov    %eax,(%esi)
+    r = r->next;
+801033b5:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < n && r; i++){
+801033b7:	83 c2 01             	add    $0x1,%edx
+801033ba:	39 da                	cmp    %ebx,%edx
+801033bc:	0f 9c c1             	setl   %cl
+801033bf:	85 c0                	test   %eax,%eax
+801033c1:	74 04                	je     801033c7 <take+0x39>
+801033c3:	84 c9                	test   %cl,%cl
+801033c5:	75 ec                	jne    801033b3 <take+0x25>
+  }
+  if(*tail)
+801033c7:	8b 0e                	mov    (%esi),%ecx
+801033c9:	85 c9                	test   %ecx,%ecx
+801033cb:	74 06                	je     801033d3 <take+0x45>
+    (*tail)->next = 0;
+801033cd:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  *list = r;
+801033d3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+801033d6:	89 03                	mov    %eax,(%ebx)
+  *got = i;
+801033d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801033db:	89 10                	mov    %edx,(%eax)
+  return head;
+}
+801033dd:	89 f8                	mov    %edi,%eax
+801033df:	83 c4 08             	add    $0x8,%esp
+801033e2:	5b                   	pop    %ebx
+801033e3:	5e                   	pop    %esi
+801033e4:	5f                   	pop    %edi
+801033e5:	5d                   	pop    %ebp
+801033e6:	c3                   	ret
+
+801033e7 <spill>:
+
+// Move up to n pages from the calling CPU's magazine m to the
+// global list. Called with interrupts off.
+static void
+spill(struct magazine *m, int n)
+{
+801033e7:	55                   	push   %ebp
+801033e8:	89 e5                	mov    %esp,%ebp
+801033ea:	56                   	push   %esi
+801033eb:	53                   	push   %ebx
+801033ec:	83 ec 10             	sub    $0x10,%esp
+801033ef:	89 c3                	mov    %eax,%ebx
+  struct run *r, *tail;
+  int got;
+
+  if((r = take(&m->list, n, &got, &tail)) == 0)
+801033f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801033f4:	50                   	push   %eax
+801033f5:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+801033f8:	89 d8                	mov    %ebx,%eax
+801033fa:	e8 8f ff ff ff       	call   8010338e <take>
+801033ff:	83 c4 04             	add    $0x4,%esp
+80103402:	85 c0                	test   %eax,%eax
+80103404:	74 41                	je     80103447 <spill+0x60>
+80103406:	89 c6                	mov    %eax,%esi
+    return;
+  m->n -= got;
+80103408:	8b 43 04             	mov    0x4(%ebx),%eax
+8010340b:	2b 45 f0             	sub    -0x10(%ebp),%eax
+8010340e:	89 43 04             	mov    %eax,0x4(%ebx)
+  acquire(&kmem.lock);
+80103411:	83 ec 0c             	sub    $0xc,%esp
+80103414:	68 a0 58 12 80       	push   $0x801258a0
+80103419:	e8 ff 47 00 00       	call   80107c1d <acquire>
+  tail->next = kmem.freelist;
+8010341e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80103421:	8b 15 f0 58 12 80    	mov    0x801258f0,%edx
+80103427:	89 10                	mov    %edx,(%eax)
+  kmem.freelist = r;
+80103429:	89 35 f0 58 12 80    	mov    %esi,0x801258f0
+  if(m->list == 0)
+8010342f:	83 c4 10             	add    $0x10,%esp
+80103432:	83 3b 00             	cmpl   $0x0,(%ebx)
+80103435:	74 17                	je     8010344e <spill+0x67>
+    kmem.needy = 0;
+  release(&kmem.lock);
+80103437:	83 ec 0c             	sub    $0xc,%esp
+8010343a:	68 a0 58 12 80       	push   $0x801258a0
+8010343f:	e8 58 48 00 00       	call   80107c9c <release>
+80103444:	83 c4 10             	add    $0x10,%esp
+}
+80103447:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010344a:	5b                   	pop    %ebx
+8010344b:	5e                   	pop    %esi
+8010344c:	5d                   	pop    %ebp
+8010344d:	c3                   	ret
+    kmem.needy = 0;
+8010344e:	c7 05 f4 58 12 80 00 	movl   $0x0,0x801258f4
+80103455:	00 00 00 
+80103458:	eb dd                	jmp    80103437 <spill+0x50>
+
+8010345a <kalloc_zeroed_pool>:
+}
+
+// Take a page from the pre-zeroed pool, or 0 if it is empty.
+static char*
+kalloc_zeroed_pool(void)
+{
+8010345a:	55                   	push   %ebp
+8010345b:	89 e5                	mov    %esp,%ebp
+8010345d:	53                   	push   %ebx
+8010345e:	83 ec 10             	sub    $0x10,%esp
+  struct run *r;
+
+  acquire(&kmem.zlock);
+80103461:	68 38 59 12 80       	push   $0x80125938
+80103466:	e8 b2 47 00 00       	call   80107c1d <acquire>
+  r = kmem.zeroed;
+8010346b:	8b 1d 84 59 12 80    	mov    0x80125984,%ebx
+  if(r){
+80103471:	83 c4 10             	add    $0x10,%esp
+80103474:	85 db                	test   %ebx,%ebx
+80103476:	74 1a                	je     80103492 <kalloc_zeroed_pool+0x38>
+    kmem.zeroed = r->next;
+80103478:	8b 03                	mov    (%ebx),%eax
+8010347a:	a3 84 59 12 80       	mov    %eax,0x80125984
+    kmem.nzeroed--;
+8010347f:	a1 88 59 12 80       	mov    0x80125988,%eax
+80103484:	83 e8 01             	sub    $0x1,%eax
+80103487:	a3 88 59 12 80       	mov    %eax,0x80125988
+    r->next = 0;  // The link was the only non-zero word
+8010348c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  }
+  release(&kmem.zlock);
+80103492:	83 ec 0c             	sub    $0xc,%esp
+80103495:	68 38 59 12 80       	push   $0x80125938
+8010349a:	e8 fd 47 00 00       	call   80107c9c <release>
+  return (char*)r;
+}
+8010349f:	89 d8                	mov    %ebx,%eax
+801034a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801034a4:	c9                   	leave
+801034a5:	c3                   	ret
+
+801034a6 <kpages>:
+}
+801034a6:	a1 8c 59 12 80       	mov    0x8012598c,%eax
+801034ab:	c3                   	ret
+
+801034ac <kref>:
+{
+801034ac:	55                   	push   %ebp
+801034ad:	89 e5                	mov    %esp,%ebp
+801034af:	83 ec 08             	sub    $0x8,%esp
+801034b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801034b5:	a9 ff 0f 00 00       	test   $0xfff,%eax
+801034ba:	75 3c                	jne    801034f8 <kref+0x4c>
+801034bc:	3d 50 a1 19 80       	cmp    $0x8019a150,%eax
+801034c1:	72 35                	jb     801034f8 <kref+0x4c>
+    if (a < (void*) KERNBASE)
+801034c3:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+801034c8:	76 21                	jbe    801034eb <kref+0x3f>
+    return (uint)a - KERNBASE;
+801034ca:	05 00 00 00 80       	add    $0x80000000,%eax
+801034cf:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801034d4:	77 22                	ja     801034f8 <kref+0x4c>
+  __sync_fetch_and_add(&REF(v), 1);
+801034d6:	c1 e8 0c             	shr    $0xc,%eax
+801034d9:	8d 84 00 f0 00 00 00 	lea    0xf0(%eax,%eax,1),%eax
+801034e0:	66 f0 83 80 a0 58 12 	lock addw $0x1,-0x7feda760(%eax)
+801034e7:	80 01 
+}
+801034e9:	c9                   	leave
+801034ea:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+801034eb:	83 ec 0c             	sub    $0xc,%esp
+801034ee:	68 30 af 10 80       	push   $0x8010af30
+801034f3:	e8 0a d4 ff ff       	call   80100902 <panic>
+    panic("kref");
+801034f8:	83 ec 0c             	sub    $0xc,%esp
+801034fb:	68 76 b0 10 80       	push   $0x8010b076
+80103500:	e8 fd d3 ff ff       	call   80100902 <panic>
+
+80103505 <krefcount>:
+{
+80103505:	55                   	push   %ebp
+80103506:	89 e5                	mov    %esp,%ebp
+80103508:	83 ec 08             	sub    $0x8,%esp
+8010350b:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (a < (void*) KERNBASE)
+8010350e:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80103513:	76 12                	jbe    80103527 <krefcount+0x22>
+    return (uint)a - KERNBASE;
+80103515:	05 00 00 00 80       	add    $0x80000000,%eax
+  return REF(v);
+8010351a:	c1 e8 0c             	shr    $0xc,%eax
+8010351d:	0f b7 84 00 90 59 12 	movzwl -0x7feda670(%eax,%eax,1),%eax
+80103524:	80 
+}
+80103525:	c9                   	leave
+80103526:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+80103527:	83 ec 0c             	sub    $0xc,%esp
+8010352a:	68 30 af 10 80       	push   $0x8010af30
+8010352f:	e8 ce d3 ff ff       	call   80100902 <panic>
+
+80103534 <kfree>:
+{
+80103534:	55                   	push   %ebp
+80103535:	89 e5                	mov    %esp,%ebp
+80103537:	53                   	push   %ebx
+80103538:	83 ec 04             	sub    $0x4,%esp
+8010353b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+8010353e:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80103544:	75 6a                	jne    801035b0 <kfree+0x7c>
+80103546:	81 fb 50 a1 19 80    	cmp    $0x8019a150,%ebx
+8010354c:	72 62                	jb     801035b0 <kfree+0x7c>
+    if (a < (void*) KERNBASE)
+8010354e:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+80103554:	76 4d                	jbe    801035a3 <kfree+0x6f>
+    return (uint)a - KERNBASE;
+80103556:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010355c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103561:	77 4d                	ja     801035b0 <kfree+0x7c>
+  if(REF(v) == 0)
+80103563:	c1 e8 0c             	shr    $0xc,%eax
+80103566:	66 83 bc 00 90 59 12 	cmpw   $0x0,-0x7feda670(%eax,%eax,1)
+8010356d:	80 00 
+8010356f:	74 4c                	je     801035bd <kfree+0x89>
+  if(__sync_sub_and_fetch(&REF(v), 1) != 0)
+80103571:	8d 84 00 90 59 12 80 	lea    -0x7feda670(%eax,%eax,1),%eax
+80103578:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010357d:	66 f0 0f c1 10       	lock xadd %dx,(%eax)
+80103582:	66 83 fa 01          	cmp    $0x1,%dx
+80103586:	75 16                	jne    8010359e <kfree+0x6a>
+  if(!kmem.use_lock){
+80103588:	83 3d ec 58 12 80 00 	cmpl   $0x0,0x801258ec
+8010358f:	75 39                	jne    801035ca <kfree+0x96>
+    r->next = kmem.freelist;
+80103591:	a1 f0 58 12 80       	mov    0x801258f0,%eax
+80103596:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = r;
+80103598:	89 1d f0 58 12 80    	mov    %ebx,0x801258f0
+}
+8010359e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801035a1:	c9                   	leave
+801035a2:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+801035a3:	83 ec 0c             	sub    $0xc,%esp
+801035a6:	68 30 af 10 80       	push   $0x8010af30
+801035ab:	e8 52 d3 ff ff       	call   80100902 <panic>
+    panic("kfree");
+801035b0:	83 ec 0c             	sub    $0xc,%esp
+801035b3:	68 7b b0 10 80       	push   $0x8010b07b
+801035b8:	e8 45 d3 ff ff       	call   80100902 <panic>
+    panic("kfree: free page");
+801035bd:	83 ec 0c             	sub    $0xc,%esp
+801035c0:	68 81 b0 10 80       	push   $0x8010b081
+801035c5:	e8 38 d3 ff ff       	call   80100902 <panic>
+  pushcli();
+801035ca:	e8 6b 45 00 00       	call   80107b3a <pushcli>
+  m = &kmem.mag[cpuid()];
+801035cf:	e8 e9 23 00 00       	call   801059bd <cpuid>
+801035d4:	89 c2                	mov    %eax,%edx
+801035d6:	8d 40 0a             	lea    0xa(%eax),%eax
+801035d9:	8d 0c d5 f8 58 12 80 	lea    -0x7feda708(,%edx,8),%ecx
+  r->next = m->list;
+801035e0:	8b 14 c5 a8 58 12 80 	mov    -0x7feda758(,%eax,8),%edx
+801035e7:	89 13                	mov    %edx,(%ebx)
+  m->list = r;
+801035e9:	89 1c c5 a8 58 12 80 	mov    %ebx,-0x7feda758(,%eax,8)
+  m->n++;
+801035f0:	8b 1c c5 ac 58 12 80 	mov    -0x7feda754(,%eax,8),%ebx
+801035f7:	8d 53 01             	lea    0x1(%ebx),%edx
+801035fa:	89 14 c5 ac 58 12 80 	mov    %edx,-0x7feda754(,%eax,8)
+  if(kmem.needy)
+80103601:	83 3d f4 58 12 80 00 	cmpl   $0x0,0x801258f4
+80103608:	75 0c                	jne    80103616 <kfree+0xe2>
+  else if(m->n > MAGSIZE)
+8010360a:	83 fa 40             	cmp    $0x40,%edx
+8010360d:	7f 10                	jg     8010361f <kfree+0xeb>
+  popcli();
+8010360f:	e8 6a 45 00 00       	call   80107b7e <popcli>
+80103614:	eb 88                	jmp    8010359e <kfree+0x6a>
+    spill(m, m->n);
+80103616:	89 c8                	mov    %ecx,%eax
+80103618:	e8 ca fd ff ff       	call   801033e7 <spill>
+8010361d:	eb f0                	jmp    8010360f <kfree+0xdb>
+    spill(m, MAGBATCH);
+8010361f:	ba 20 00 00 00       	mov    $0x20,%edx
+80103624:	89 c8                	mov    %ecx,%eax
+80103626:	e8 bc fd ff ff       	call   801033e7 <spill>
+8010362b:	eb e2                	jmp    8010360f <kfree+0xdb>
+
+8010362d <freerange>:
+{
+8010362d:	55                   	push   %ebp
+8010362e:	89 e5                	mov    %esp,%ebp
+80103630:	56                   	push   %esi
+80103631:	53                   	push   %ebx
+80103632:	8b 45 08             	mov    0x8(%ebp),%eax
+80103635:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (vend < vstart) panic("freerange");
+80103638:	39 c3                	cmp    %eax,%ebx
+8010363a:	72 4b                	jb     80103687 <freerange+0x5a>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010363c:	05 ff 0f 00 00       	add    $0xfff,%eax
+80103641:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103646:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+8010364c:	39 f3                	cmp    %esi,%ebx
+8010364e:	72 51                	jb     801036a1 <freerange+0x74>
+    if (a < (void*) KERNBASE)
+80103650:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80103655:	76 3d                	jbe    80103694 <freerange+0x67>
+    return (uint)a - KERNBASE;
+80103657:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+    REF(p) = 1;
+8010365d:	c1 ea 0c             	shr    $0xc,%edx
+80103660:	66 c7 84 12 90 59 12 	movw   $0x1,-0x7feda670(%edx,%edx,1)
+80103667:	80 01 00 
+    kfree(p);
+8010366a:	83 ec 0c             	sub    $0xc,%esp
+8010366d:	50                   	push   %eax
+8010366e:	e8 c1 fe ff ff       	call   80103534 <kfree>
+    kmem.npage++;
+80103673:	a1 8c 59 12 80       	mov    0x8012598c,%eax
+80103678:	83 c0 01             	add    $0x1,%eax
+8010367b:	a3 8c 59 12 80       	mov    %eax,0x8012598c
+80103680:	83 c4 10             	add    $0x10,%esp
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103683:	89 f0                	mov    %esi,%eax
+80103685:	eb bf                	jmp    80103646 <freerange+0x19>
+  if (vend < vstart) panic("freerange");
+80103687:	83 ec 0c             	sub    $0xc,%esp
+8010368a:	68 92 b0 10 80       	push   $0x8010b092
+8010368f:	e8 6e d2 ff ff       	call   80100902 <panic>
+        panic("V2P on address < KERNBASE "
+80103694:	83 ec 0c             	sub    $0xc,%esp
+80103697:	68 30 af 10 80       	push   $0x8010af30
+8010369c:	e8 61 d2 ff ff       	call   80100902 <panic>
+}
+801036a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801036a4:	5b                   	pop    %ebx
+801036a5:	5e                   	pop    %esi
+801036a6:	5d                   	pop    %ebp
+801036a7:	c3                   	ret
+
+801036a8 <kinit1>:
+{
+801036a8:	55                   	push   %ebp
+801036a9:	89 e5                	mov    %esp,%ebp
+801036ab:	83 ec 10             	sub    $0x10,%esp
+  initlock(&kmem.lock, "kmem");
+801036ae:	68 9c b0 10 80       	push   $0x8010b09c
+801036b3:	68 a0 58 12 80       	push   $0x801258a0
+801036b8:	e8 15 44 00 00       	call   80107ad2 <initlock>
+  initlock(&kmem.zlock, "kzero");
+801036bd:	83 c4 08             	add    $0x8,%esp
+801036c0:	68 a1 b0 10 80       	push   $0x8010b0a1
+801036c5:	68 38 59 12 80       	push   $0x80125938
+801036ca:	e8 03 44 00 00       	call   80107ad2 <initlock>
+  kmem.use_lock = 0;
+801036cf:	c7 05 ec 58 12 80 00 	movl   $0x0,0x801258ec
+801036d6:	00 00 00 
+  freerange(vstart, vend);
+801036d9:	83 c4 08             	add    $0x8,%esp
+801036dc:	ff 75 0c             	push   0xc(%ebp)
+801036df:	ff 75 08             	push   0x8(%ebp)
+801036e2:	e8 46 ff ff ff       	call   8010362d <freerange>
+}
+801036e7:	83 c4 10             	add    $0x10,%esp
+801036ea:	c9                   	leave
+801036eb:	c3                   	ret
+
+801036ec <kinit2>:
+{
+801036ec:	55                   	push   %ebp
+801036ed:	89 e5                	mov    %esp,%ebp
+801036ef:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+801036f2:	ff 75 0c             	push   0xc(%ebp)
+801036f5:	ff 75 08             	push   0x8(%ebp)
+801036f8:	e8 30 ff ff ff       	call   8010362d <freerange>
+  kmem.use_lock = 1;
+801036fd:	c7 05 ec 58 12 80 01 	movl   $0x1,0x801258ec
+80103704:	00 00 00 
+}
+80103707:	83 c4 10             	add    $0x10,%esp
+8010370a:	c9                   	leave
+8010370b:	c3                   	ret
+
+8010370c <kalloc>:
+{
+8010370c:	55                   	push   %ebp
+8010370d:	89 e5                	mov    %esp,%ebp
+8010370f:	56                   	push   %esi
+80103710:	53                   	push   %ebx
+80103711:	83 ec 10             	sub    $0x10,%esp
+  if(!kmem.use_lock){
+80103714:	83 3d ec 58 12 80 00 	cmpl   $0x0,0x801258ec
+8010371b:	75 42                	jne    8010375f <kalloc+0x53>
+    r = kmem.freelist;
+8010371d:	8b 1d f0 58 12 80    	mov    0x801258f0,%ebx
+    if(r){
+80103723:	85 db                	test   %ebx,%ebx
+80103725:	74 22                	je     80103749 <kalloc+0x3d>
+      kmem.freelist = r->next;
+80103727:	8b 03                	mov    (%ebx),%eax
+80103729:	a3 f0 58 12 80       	mov    %eax,0x801258f0
+    if (a < (void*) KERNBASE)
+8010372e:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+80103734:	76 1c                	jbe    80103752 <kalloc+0x46>
+    return (uint)a - KERNBASE;
+80103736:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+      REF(r) = 1;
+8010373c:	c1 e8 0c             	shr    $0xc,%eax
+8010373f:	66 c7 84 00 90 59 12 	movw   $0x1,-0x7feda670(%eax,%eax,1)
+80103746:	80 01 00 
+}
+80103749:	89 d8                	mov    %ebx,%eax
+8010374b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010374e:	5b                   	pop    %ebx
+8010374f:	5e                   	pop    %esi
+80103750:	5d                   	pop    %ebp
+80103751:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+80103752:	83 ec 0c             	sub    $0xc,%esp
+80103755:	68 30 af 10 80       	push   $0x8010af30
+8010375a:	e8 a3 d1 ff ff       	call   80100902 <panic>
+  pushcli();
+8010375f:	e8 d6 43 00 00       	call   80107b3a <pushcli>
+  m = &kmem.mag[cpuid()];
+80103764:	e8 54 22 00 00       	call   801059bd <cpuid>
+80103769:	89 c6                	mov    %eax,%esi
+8010376b:	8d 04 c5 f8 58 12 80 	lea    -0x7feda708(,%eax,8),%eax
+  if(kmem.needy && m->list)
+80103772:	83 3d f4 58 12 80 00 	cmpl   $0x0,0x801258f4
+80103779:	74 16                	je     80103791 <kalloc+0x85>
+8010377b:	83 3c f5 f8 58 12 80 	cmpl   $0x0,-0x7feda708(,%esi,8)
+80103782:	00 
+80103783:	74 0c                	je     80103791 <kalloc+0x85>
+    spill(m, m->n);
+80103785:	8b 14 f5 fc 58 12 80 	mov    -0x7feda704(,%esi,8),%edx
+8010378c:	e8 56 fc ff ff       	call   801033e7 <spill>
+  if(m->list == 0){
+80103791:	83 3c f5 f8 58 12 80 	cmpl   $0x0,-0x7feda708(,%esi,8)
+80103798:	00 
+80103799:	74 55                	je     801037f0 <kalloc+0xe4>
+  r = m->list;
+8010379b:	8b 1c f5 f8 58 12 80 	mov    -0x7feda708(,%esi,8),%ebx
+  if(r){
+801037a2:	85 db                	test   %ebx,%ebx
+801037a4:	0f 84 a1 00 00 00    	je     8010384b <kalloc+0x13f>
+    m->list = r->next;
+801037aa:	8b 03                	mov    (%ebx),%eax
+801037ac:	83 c6 0a             	add    $0xa,%esi
+801037af:	89 04 f5 a8 58 12 80 	mov    %eax,-0x7feda758(,%esi,8)
+    m->n--;
+801037b6:	8b 04 f5 ac 58 12 80 	mov    -0x7feda754(,%esi,8),%eax
+801037bd:	83 e8 01             	sub    $0x1,%eax
+801037c0:	89 04 f5 ac 58 12 80 	mov    %eax,-0x7feda754(,%esi,8)
+  popcli();
+801037c7:	e8 b2 43 00 00       	call   80107b7e <popcli>
+    if (a < (void*) KERNBASE)
+801037cc:	81 fb ff ff ff 7f    	cmp    $0x7fffffff,%ebx
+801037d2:	0f 86 8c 00 00 00    	jbe    80103864 <kalloc+0x158>
+    return (uint)a - KERNBASE;
+801037d8:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+    REF(r) = 1;
+801037de:	c1 e8 0c             	shr    $0xc,%eax
+801037e1:	66 c7 84 00 90 59 12 	movw   $0x1,-0x7feda670(%eax,%eax,1)
+801037e8:	80 01 00 
+801037eb:	e9 59 ff ff ff       	jmp    80103749 <kalloc+0x3d>
+    acquire(&kmem.lock);
+801037f0:	83 ec 0c             	sub    $0xc,%esp
+801037f3:	68 a0 58 12 80       	push   $0x801258a0
+801037f8:	e8 20 44 00 00       	call   80107c1d <acquire>
+    m->list = take(&kmem.freelist, MAGBATCH, &m->n, &tail);
+801037fd:	8d 5e 0a             	lea    0xa(%esi),%ebx
+80103800:	8d 0c f5 fc 58 12 80 	lea    -0x7feda704(,%esi,8),%ecx
+80103807:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010380a:	89 04 24             	mov    %eax,(%esp)
+8010380d:	ba 20 00 00 00       	mov    $0x20,%edx
+80103812:	b8 f0 58 12 80       	mov    $0x801258f0,%eax
+80103817:	e8 72 fb ff ff       	call   8010338e <take>
+8010381c:	89 04 dd a8 58 12 80 	mov    %eax,-0x7feda758(,%ebx,8)
+    if(m->list == 0)
+80103823:	83 c4 10             	add    $0x10,%esp
+80103826:	85 c0                	test   %eax,%eax
+80103828:	74 15                	je     8010383f <kalloc+0x133>
+    release(&kmem.lock);
+8010382a:	83 ec 0c             	sub    $0xc,%esp
+8010382d:	68 a0 58 12 80       	push   $0x801258a0
+80103832:	e8 65 44 00 00       	call   80107c9c <release>
+80103837:	83 c4 10             	add    $0x10,%esp
+8010383a:	e9 5c ff ff ff       	jmp    8010379b <kalloc+0x8f>
+      kmem.needy = 1;
+8010383f:	c7 05 f4 58 12 80 01 	movl   $0x1,0x801258f4
+80103846:	00 00 00 
+80103849:	eb df                	jmp    8010382a <kalloc+0x11e>
+  popcli();
+8010384b:	e8 2e 43 00 00       	call   80107b7e <popcli>
+    r = (struct run*)kalloc_zeroed_pool();
+80103850:	e8 05 fc ff ff       	call   8010345a <kalloc_zeroed_pool>
+80103855:	89 c3                	mov    %eax,%ebx
+  if(r)
+80103857:	85 c0                	test   %eax,%eax
+80103859:	0f 85 6d ff ff ff    	jne    801037cc <kalloc+0xc0>
+8010385f:	e9 e5 fe ff ff       	jmp    80103749 <kalloc+0x3d>
+        panic("V2P on address < KERNBASE "
+80103864:	83 ec 0c             	sub    $0xc,%esp
+80103867:	68 30 af 10 80       	push   $0x8010af30
+8010386c:	e8 91 d0 ff ff       	call   80100902 <panic>
+
+80103871 <kalloc_zeroed>:
+
+// Allocate one page filled with zeros, from the pool
+// kzerofill() keeps when it can.
+char*
+kalloc_zeroed(void)
+{
+80103871:	55                   	push   %ebp
+80103872:	89 e5                	mov    %esp,%ebp
+80103874:	53                   	push   %ebx
+80103875:	83 ec 04             	sub    $0x4,%esp
+  char *v;
+
+  if(kmem.use_lock && (v = kalloc_zeroed_pool()) != 0)
+80103878:	83 3d ec 58 12 80 00 	cmpl   $0x0,0x801258ec
+8010387f:	74 0b                	je     8010388c <kalloc_zeroed+0x1b>
+80103881:	e8 d4 fb ff ff       	call   8010345a <kalloc_zeroed_pool>
+80103886:	89 c3                	mov    %eax,%ebx
+80103888:	85 c0                	test   %eax,%eax
+8010388a:	75 1e                	jne    801038aa <kalloc_zeroed+0x39>
+    return v;
+  if((v = kalloc()) != 0)
+8010388c:	e8 7b fe ff ff       	call   8010370c <kalloc>
+80103891:	89 c3                	mov    %eax,%ebx
+80103893:	85 c0                	test   %eax,%eax
+80103895:	74 13                	je     801038aa <kalloc_zeroed+0x39>
+    memset(v, 0, PGSIZE);
+80103897:	83 ec 04             	sub    $0x4,%esp
+8010389a:	68 00 10 00 00       	push   $0x1000
+8010389f:	6a 00                	push   $0x0
+801038a1:	50                   	push   %eax
+801038a2:	e8 50 44 00 00       	call   80107cf7 <memset>
+801038a7:	83 c4 10             	add    $0x10,%esp
+  return v;
+}
+801038aa:	89 d8                	mov    %ebx,%eax
+801038ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801038af:	c9                   	leave
+801038b0:	c3                   	ret
+
+801038b1 <kzerofill>:
+void
+kzerofill(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock || kmem.nzeroed >= NZEROED)
+801038b1:	83 3d ec 58 12 80 00 	cmpl   $0x0,0x801258ec
+801038b8:	74 09                	je     801038c3 <kzerofill+0x12>
+801038ba:	83 3d 88 59 12 80 3f 	cmpl   $0x3f,0x80125988
+801038c1:	7e 01                	jle    801038c4 <kzerofill+0x13>
+801038c3:	c3                   	ret
+{
+801038c4:	55                   	push   %ebp
+801038c5:	89 e5                	mov    %esp,%ebp
+801038c7:	53                   	push   %ebx
+801038c8:	83 ec 04             	sub    $0x4,%esp
+    return;
+  if((r = (struct run*)kalloc()) == 0)
+801038cb:	e8 3c fe ff ff       	call   8010370c <kalloc>
+801038d0:	89 c3                	mov    %eax,%ebx
+801038d2:	85 c0                	test   %eax,%eax
+801038d4:	74 45                	je     8010391b <kzerofill+0x6a>
+    return;
+  memset(r, 0, PGSIZE);
+801038d6:	83 ec 04             	sub    $0x4,%esp
+801038d9:	68 00 10 00 00       	push   $0x1000
+801038de:	6a 00                	push   $0x0
+801038e0:	50                   	push   %eax
+801038e1:	e8 11 44 00 00       	call   80107cf7 <memset>
+  acquire(&kmem.zlock);
+801038e6:	c7 04 24 38 59 12 80 	movl   $0x80125938,(%esp)
+801038ed:	e8 2b 43 00 00       	call   80107c1d <acquire>
+  r->next = kmem.zeroed;
+801038f2:	a1 84 59 12 80       	mov    0x80125984,%eax
+801038f7:	89 03                	mov    %eax,(%ebx)
+  kmem.zeroed = r;
+801038f9:	89 1d 84 59 12 80    	mov    %ebx,0x80125984
+  kmem.nzeroed++;
+801038ff:	a1 88 59 12 80       	mov    0x80125988,%eax
+80103904:	83 c0 01             	add    $0x1,%eax
+80103907:	a3 88 59 12 80       	mov    %eax,0x80125988
+  release(&kmem.zlock);
+8010390c:	c7 04 24 38 59 12 80 	movl   $0x80125938,(%esp)
+80103913:	e8 84 43 00 00       	call   80107c9c <release>
+80103918:	83 c4 10             	add    $0x10,%esp
+}
+8010391b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010391e:	c9                   	leave
+8010391f:	c3                   	ret
+
+80103920 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103920:	ba 64 00 00 00       	mov    $0x64,%edx
+80103925:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103926:	a8 01                	test   $0x1,%al
+80103928:	0f 84 b4 00 00 00    	je     801039e2 <kbdgetc+0xc2>
+8010392e:	ba 60 00 00 00       	mov    $0x60,%edx
+80103933:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+80103934:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+80103937:	3c e0                	cmp    $0xe0,%al
+80103939:	74 61                	je     8010399c <kbdgetc+0x7c>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+8010393b:	84 c0                	test   %al,%al
+8010393d:	78 6a                	js     801039a9 <kbdgetc+0x89>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+8010393f:	8b 15 90 19 14 80    	mov    0x80141990,%edx
+80103945:	f6 c2 40             	test   $0x40,%dl
+80103948:	74 0f                	je     80103959 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+8010394a:	83 c8 80             	or     $0xffffff80,%eax
+8010394d:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+80103950:	83 e2 bf             	and    $0xffffffbf,%edx
+80103953:	89 15 90 19 14 80    	mov    %edx,0x80141990
+  }
+
+  shift |= shiftcode[data];
+80103959:	0f b6 91 e0 b1 10 80 	movzbl -0x7fef4e20(%ecx),%edx
+80103960:	0b 15 90 19 14 80    	or     0x80141990,%edx
+80103966:	89 15 90 19 14 80    	mov    %edx,0x80141990
+  shift ^= togglecode[data];
+8010396c:	0f b6 81 e0 b0 10 80 	movzbl -0x7fef4f20(%ecx),%eax
+80103973:	31 c2                	xor    %eax,%edx
+80103975:	89 15 90 19 14 80    	mov    %edx,0x80141990
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010397b:	89 d0                	mov    %edx,%eax
+8010397d:	83 e0 03             	and    $0x3,%eax
+80103980:	8b 04 85 c0 b0 10 80 	mov    -0x7fef4f40(,%eax,4),%eax
+80103987:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+8010398b:	f6 c2 08             	test   $0x8,%dl
+8010398e:	74 57                	je     801039e7 <kbdgetc+0xc7>
+    if('a' <= c && c <= 'z')
+80103990:	8d 50 9f             	lea    -0x61(%eax),%edx
+80103993:	83 fa 19             	cmp    $0x19,%edx
+80103996:	77 3e                	ja     801039d6 <kbdgetc+0xb6>
+      c += 'A' - 'a';
+80103998:	83 e8 20             	sub    $0x20,%eax
+8010399b:	c3                   	ret
+    shift |= E0ESC;
+8010399c:	83 0d 90 19 14 80 40 	orl    $0x40,0x80141990
+    return 0;
+801039a3:	b8 00 00 00 00       	mov    $0x0,%eax
+801039a8:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+801039a9:	8b 15 90 19 14 80    	mov    0x80141990,%edx
+801039af:	f6 c2 40             	test   $0x40,%dl
+801039b2:	75 05                	jne    801039b9 <kbdgetc+0x99>
+801039b4:	89 c1                	mov    %eax,%ecx
+801039b6:	83 e1 7f             	and    $0x7f,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+801039b9:	0f b6 81 e0 b1 10 80 	movzbl -0x7fef4e20(%ecx),%eax
+801039c0:	83 c8 40             	or     $0x40,%eax
+801039c3:	0f b6 c0             	movzbl %al,%eax
+801039c6:	f7 d0                	not    %eax
+801039c8:	21 c2                	and    %eax,%edx
+801039ca:	89 15 90 19 14 80    	mov    %edx,0x80141990
+    return 0;
+801039d0:	b8 00 00 00 00       	mov    $0x0,%eax
+801039d5:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+801039d6:	8d 50 bf             	lea    -0x41(%eax),%edx
+801039d9:	83 fa 19             	cmp    $0x19,%edx
+801039dc:	77 09                	ja     801039e7 <kbdgetc+0xc7>
+      c += 'a' - 'A';
+801039de:	83 c0 20             	add    $0x20,%eax
+  }
+  return c;
+801039e1:	c3                   	ret
+    return -1;
+801039e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801039e7:	c3                   	ret
+
+801039e8 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801039e8:	55                   	push   %ebp
+801039e9:	89 e5                	mov    %esp,%ebp
+801039eb:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+801039ee:	68 20 39 10 80       	push   $0x80103920
+801039f3:	e8 2d d4 ff ff       	call   80100e25 <consoleintr>
+}
+801039f8:	83 c4 10             	add    $0x10,%esp
+801039fb:	c9                   	leave
+801039fc:	c3                   	ret
+
+801039fd <shutdown>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801039fd:	b8 00 00 00 00       	mov    $0x0,%eax
+80103a02:	ba 01 05 00 00       	mov    $0x501,%edx
+80103a07:	ee                   	out    %al,(%dx)
+  /*
+     This only works in QEMU and assumes QEMU was run 
+     with -device isa-debug-exit
+   */
+  outb(0x501, 0x0);
+}
+80103a08:	c3                   	ret
+
+80103a09 <lapicw>:
+
+//PAGEBREAK!
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+80103a09:	8b 0d 94 19 14 80    	mov    0x80141994,%ecx
+80103a0f:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80103a12:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103a14:	a1 94 19 14 80       	mov    0x80141994,%eax
+80103a19:	8b 40 20             	mov    0x20(%eax),%eax
+}
+80103a1c:	c3                   	ret
+
+80103a1d <cmos_read>:
+80103a1d:	ba 70 00 00 00       	mov    $0x70,%edx
+80103a22:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a23:	ba 71 00 00 00       	mov    $0x71,%edx
+80103a28:	ec                   	in     (%dx),%al
+cmos_read(uint reg)
+{
+  outb(CMOS_PORT,  reg);
+  microdelay(200);
+
+  return inb(CMOS_RETURN);
+80103a29:	0f b6 c0             	movzbl %al,%eax
+}
+80103a2c:	c3                   	ret
+
+80103a2d <fill_rtcdate>:
+
+static void
+fill_rtcdate(struct rtcdate *r)
+{
+80103a2d:	55                   	push   %ebp
+80103a2e:	89 e5                	mov    %esp,%ebp
+80103a30:	53                   	push   %ebx
+80103a31:	83 ec 04             	sub    $0x4,%esp
+80103a34:	89 c3                	mov    %eax,%ebx
+  r->second = cmos_read(SECS);
+80103a36:	b8 00 00 00 00       	mov    $0x0,%eax
+80103a3b:	e8 dd ff ff ff       	call   80103a1d <cmos_read>
+80103a40:	89 03                	mov    %eax,(%ebx)
+  r->minute = cmos_read(MINS);
+80103a42:	b8 02 00 00 00       	mov    $0x2,%eax
+80103a47:	e8 d1 ff ff ff       	call   80103a1d <cmos_read>
+80103a4c:	89 43 04             	mov    %eax,0x4(%ebx)
+  r->hour   = cmos_read(HOURS);
+80103a4f:	b8 04 00 00 00       	mov    $0x4,%eax
+80103a54:	e8 c4 ff ff ff       	call   80103a1d <cmos_read>
+80103a59:	89 43 08             	mov    %eax,0x8(%ebx)
+  r->day    = cmos_read(DAY);
+80103a5c:	b8 07 00 00 00       	mov    $0x7,%eax
+80103a61:	e8 b7 ff ff ff       	call   80103a1d <cmos_read>
+80103a66:	89 43 0c             	mov    %eax,0xc(%ebx)
+  r->month  = cmos_read(MONTH);
+80103a69:	b8 08 00 00 00       	mov    $0x8,%eax
+80103a6e:	e8 aa ff ff ff       	call   80103a1d <cmos_read>
+80103a73:	89 43 10             	mov    %eax,0x10(%ebx)
+  r->year   = cmos_read(YEAR);
+80103a76:	b8 09 00 00 00       	mov    $0x9,%eax
+80103a7b:	e8 9d ff ff ff       	call   80103a1d <cmos_read>
+80103a80:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+80103a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103a86:	c9                   	leave
+80103a87:	c3                   	ret
+
+80103a88 <lapicinit>:
+  if(!lapic)
+80103a88:	83 3d 94 19 14 80 00 	cmpl   $0x0,0x80141994
+80103a8f:	0f 84 fe 00 00 00    	je     80103b93 <lapicinit+0x10b>
+{
+80103a95:	55                   	push   %ebp
+80103a96:	89 e5                	mov    %esp,%ebp
+80103a98:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+80103a9b:	ba 3f 01 00 00       	mov    $0x13f,%edx
+80103aa0:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80103aa5:	e8 5f ff ff ff       	call   80103a09 <lapicw>
+  lapicw(TDCR, X1);
+80103aaa:	ba 0b 00 00 00       	mov    $0xb,%edx
+80103aaf:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80103ab4:	e8 50 ff ff ff       	call   80103a09 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80103ab9:	ba 20 00 02 00       	mov    $0x20020,%edx
+80103abe:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80103ac3:	e8 41 ff ff ff       	call   80103a09 <lapicw>
+  lapicw(TICR, 10000000);
+80103ac8:	ba 80 96 98 00       	mov    $0x989680,%edx
+80103acd:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80103ad2:	e8 32 ff ff ff       	call   80103a09 <lapicw>
+  lapicw(LINT0, MASKED);
+80103ad7:	ba 00 00 01 00       	mov    $0x10000,%edx
+80103adc:	b8 d4 00 00 00       	mov    $0xd4,%eax
+80103ae1:	e8 23 ff ff ff       	call   80103a09 <lapicw>
+  lapicw(LINT1, MASKED);
+80103ae6:	ba 00 00 01 00       	mov    $0x10000,%edx
+80103aeb:	b8 d8 00 00 00       	mov    $0xd8,%eax
+80103af0:	e8 14 ff ff ff       	call   80103a09 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80103af5:	a1 94 19 14 80       	mov    0x80141994,%eax
+80103afa:	8b 40 30             	mov    0x30(%eax),%eax
+80103afd:	c1 e8 10             	shr    $0x10,%eax
+80103b00:	a8 fc                	test   $0xfc,%al
+80103b02:	75 7b                	jne    80103b7f <lapicinit+0xf7>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+80103b04:	ba 33 00 00 00       	mov    $0x33,%edx
+80103b09:	b8 dc 00 00 00       	mov    $0xdc,%eax
+80103b0e:	e8 f6 fe ff ff       	call   80103a09 <lapicw>
+  lapicw(ESR, 0);
+80103b13:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b18:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80103b1d:	e8 e7 fe ff ff       	call   80103a09 <lapicw>
+  lapicw(ESR, 0);
+80103b22:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b27:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80103b2c:	e8 d8 fe ff ff       	call   80103a09 <lapicw>
+  lapicw(EOI, 0);
+80103b31:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b36:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80103b3b:	e8 c9 fe ff ff       	call   80103a09 <lapicw>
+  lapicw(ICRHI, 0);
+80103b40:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b45:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80103b4a:	e8 ba fe ff ff       	call   80103a09 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+80103b4f:	ba 00 85 08 00       	mov    $0x88500,%edx
+80103b54:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80103b59:	e8 ab fe ff ff       	call   80103a09 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+80103b5e:	a1 94 19 14 80       	mov    0x80141994,%eax
+80103b63:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+80103b69:	f6 c4 10             	test   $0x10,%ah
+80103b6c:	75 f0                	jne    80103b5e <lapicinit+0xd6>
+  lapicw(TPR, 0);
+80103b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b73:	b8 20 00 00 00       	mov    $0x20,%eax
+80103b78:	e8 8c fe ff ff       	call   80103a09 <lapicw>
+}
+80103b7d:	c9                   	leave
+80103b7e:	c3                   	ret
+    lapicw(PCINT, MASKED);
+80103b7f:	ba 00 00 01 00       	mov    $0x10000,%edx
+80103b84:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80103b89:	e8 7b fe ff ff       	call   80103a09 <lapicw>
+80103b8e:	e9 71 ff ff ff       	jmp    80103b04 <lapicinit+0x7c>
+80103b93:	c3                   	ret
+
+80103b94 <lapicid>:
+  if (!lapic)
+80103b94:	a1 94 19 14 80       	mov    0x80141994,%eax
+80103b99:	85 c0                	test   %eax,%eax
+80103b9b:	74 07                	je     80103ba4 <lapicid+0x10>
+  return lapic[ID] >> 24;
+80103b9d:	8b 40 20             	mov    0x20(%eax),%eax
+80103ba0:	c1 e8 18             	shr    $0x18,%eax
+80103ba3:	c3                   	ret
+    return 0;
+80103ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103ba9:	c3                   	ret
+
+80103baa <lapiceoi>:
+  if(lapic)
+80103baa:	83 3d 94 19 14 80 00 	cmpl   $0x0,0x80141994
+80103bb1:	74 17                	je     80103bca <lapiceoi+0x20>
+{
+80103bb3:	55                   	push   %ebp
+80103bb4:	89 e5                	mov    %esp,%ebp
+80103bb6:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+80103bb9:	ba 00 00 00 00       	mov    $0x0,%edx
+80103bbe:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80103bc3:	e8 41 fe ff ff       	call   80103a09 <lapicw>
+}
+80103bc8:	c9                   	leave
+80103bc9:	c3                   	ret
+80103bca:	c3                   	ret
+
+80103bcb <microdelay>:
+}
+80103bcb:	c3                   	ret
+
+80103bcc <lapicstartap>:
+{
+80103bcc:	55                   	push   %ebp
+80103bcd:	89 e5                	mov    %esp,%ebp
+80103bcf:	57                   	push   %edi
+80103bd0:	56                   	push   %esi
+80103bd1:	53                   	push   %ebx
+80103bd2:	83 ec 0c             	sub    $0xc,%esp
+80103bd5:	8b 75 08             	mov    0x8(%ebp),%esi
+80103bd8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103bdb:	b8 0f 00 00 00       	mov    $0xf,%eax
+80103be0:	ba 70 00 00 00       	mov    $0x70,%edx
+80103be5:	ee                   	out    %al,(%dx)
+80103be6:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103beb:	ba 71 00 00 00       	mov    $0x71,%edx
+80103bf0:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+80103bf1:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+80103bf8:	00 00 
+  wrv[1] = addr >> 4;
+80103bfa:	89 f8                	mov    %edi,%eax
+80103bfc:	c1 e8 04             	shr    $0x4,%eax
+80103bff:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+80103c05:	c1 e6 18             	shl    $0x18,%esi
+80103c08:	89 f2                	mov    %esi,%edx
+80103c0a:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80103c0f:	e8 f5 fd ff ff       	call   80103a09 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+80103c14:	ba 00 c5 00 00       	mov    $0xc500,%edx
+80103c19:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80103c1e:	e8 e6 fd ff ff       	call   80103a09 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+80103c23:	ba 00 85 00 00       	mov    $0x8500,%edx
+80103c28:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80103c2d:	e8 d7 fd ff ff       	call   80103a09 <lapicw>
+  for(i = 0; i < 2; i++){
+80103c32:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103c37:	eb 21                	jmp    80103c5a <lapicstartap+0x8e>
+    lapicw(ICRHI, apicid<<24);
+80103c39:	89 f2                	mov    %esi,%edx
+80103c3b:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80103c40:	e8 c4 fd ff ff       	call   80103a09 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103c45:	89 fa                	mov    %edi,%edx
+80103c47:	c1 ea 0c             	shr    $0xc,%edx
+80103c4a:	80 ce 06             	or     $0x6,%dh
+80103c4d:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80103c52:	e8 b2 fd ff ff       	call   80103a09 <lapicw>
+  for(i = 0; i < 2; i++){
+80103c57:	83 c3 01             	add    $0x1,%ebx
+80103c5a:	83 fb 01             	cmp    $0x1,%ebx
+80103c5d:	7e da                	jle    80103c39 <lapicstartap+0x6d>
+}
+80103c5f:	83 c4 0c             	add    $0xc,%esp
+80103c62:	5b                   	pop    %ebx
+80103c63:	5e                   	pop    %esi
+80103c64:	5f                   	pop    %edi
+80103c65:	5d                   	pop    %ebp
+80103c66:	c3                   	ret
+
+80103c67 <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80103c67:	55                   	push   %ebp
+80103c68:	89 e5                	mov    %esp,%ebp
+80103c6a:	57                   	push   %edi
+80103c6b:	56                   	push   %esi
+80103c6c:	53                   	push   %ebx
+80103c6d:	83 ec 3c             	sub    $0x3c,%esp
+80103c70:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+80103c73:	b8 0b 00 00 00       	mov    $0xb,%eax
+80103c78:	e8 a0 fd ff ff       	call   80103a1d <cmos_read>
+
+  bcd = (sb & (1 << 2)) == 0;
+80103c7d:	83 e0 04             	and    $0x4,%eax
+80103c80:	89 c7                	mov    %eax,%edi
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+80103c82:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80103c85:	e8 a3 fd ff ff       	call   80103a2d <fill_rtcdate>
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80103c8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103c8f:	e8 89 fd ff ff       	call   80103a1d <cmos_read>
+80103c94:	a8 80                	test   $0x80,%al
+80103c96:	75 ea                	jne    80103c82 <cmostime+0x1b>
+        continue;
+    fill_rtcdate(&t2);
+80103c98:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+80103c9b:	89 d8                	mov    %ebx,%eax
+80103c9d:	e8 8b fd ff ff       	call   80103a2d <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103ca2:	83 ec 04             	sub    $0x4,%esp
+80103ca5:	6a 18                	push   $0x18
+80103ca7:	53                   	push   %ebx
+80103ca8:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80103cab:	50                   	push   %eax
+80103cac:	e8 89 40 00 00       	call   80107d3a <memcmp>
+80103cb1:	83 c4 10             	add    $0x10,%esp
+80103cb4:	85 c0                	test   %eax,%eax
+80103cb6:	75 ca                	jne    80103c82 <cmostime+0x1b>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80103cb8:	85 ff                	test   %edi,%edi
+80103cba:	75 78                	jne    80103d34 <cmostime+0xcd>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80103cbc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80103cbf:	89 c2                	mov    %eax,%edx
+80103cc1:	c1 ea 04             	shr    $0x4,%edx
+80103cc4:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103cc7:	83 e0 0f             	and    $0xf,%eax
+80103cca:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103ccd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+80103cd0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80103cd3:	89 c2                	mov    %eax,%edx
+80103cd5:	c1 ea 04             	shr    $0x4,%edx
+80103cd8:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103cdb:	83 e0 0f             	and    $0xf,%eax
+80103cde:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103ce1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+80103ce4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80103ce7:	89 c2                	mov    %eax,%edx
+80103ce9:	c1 ea 04             	shr    $0x4,%edx
+80103cec:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103cef:	83 e0 0f             	and    $0xf,%eax
+80103cf2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103cf5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+80103cf8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80103cfb:	89 c2                	mov    %eax,%edx
+80103cfd:	c1 ea 04             	shr    $0x4,%edx
+80103d00:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103d03:	83 e0 0f             	and    $0xf,%eax
+80103d06:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103d09:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+80103d0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103d0f:	89 c2                	mov    %eax,%edx
+80103d11:	c1 ea 04             	shr    $0x4,%edx
+80103d14:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103d17:	83 e0 0f             	and    $0xf,%eax
+80103d1a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103d1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+80103d20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103d23:	89 c2                	mov    %eax,%edx
+80103d25:	c1 ea 04             	shr    $0x4,%edx
+80103d28:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103d2b:	83 e0 0f             	and    $0xf,%eax
+80103d2e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103d31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80103d34:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80103d37:	89 06                	mov    %eax,(%esi)
+80103d39:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80103d3c:	89 46 04             	mov    %eax,0x4(%esi)
+80103d3f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80103d42:	89 46 08             	mov    %eax,0x8(%esi)
+80103d45:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80103d48:	89 46 0c             	mov    %eax,0xc(%esi)
+80103d4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103d4e:	89 46 10             	mov    %eax,0x10(%esi)
+80103d51:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103d54:	89 46 14             	mov    %eax,0x14(%esi)
+  r->year += 2000;
+80103d57:	05 d0 07 00 00       	add    $0x7d0,%eax
+80103d5c:	89 46 14             	mov    %eax,0x14(%esi)
+}
+80103d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103d62:	5b                   	pop    %ebx
+80103d63:	5e                   	pop    %esi
+80103d64:	5f                   	pop    %edi
+80103d65:	5d                   	pop    %ebp
+80103d66:	c3                   	ret
+
+80103d67 <lhfind>:
+
+// Index of block b in the open transaction, or -1.
+// Caller holds log.lock.
+static int
+lhfind(uint b)
+{
+80103d67:	89 c2                	mov    %eax,%edx
+  int i;
+
+  for (i = log.lhhead[b % NLHASH]; i >= 0; i = log.lhnext[i])
+80103d69:	0f b6 c0             	movzbl %al,%eax
+80103d6c:	0f bf 84 00 74 40 14 	movswl -0x7febbf8c(%eax,%eax,1),%eax
+80103d73:	80 
+80103d74:	eb 08                	jmp    80103d7e <lhfind+0x17>
+80103d76:	0f bf 84 00 74 42 14 	movswl -0x7febbd8c(%eax,%eax,1),%eax
+80103d7d:	80 
+80103d7e:	85 c0                	test   %eax,%eax
+80103d80:	78 0b                	js     80103d8d <lhfind+0x26>
+    if (log.lh.block[i] == b)
+80103d82:	39 14 85 70 20 14 80 	cmp    %edx,-0x7febdf90(,%eax,4)
+80103d89:	75 eb                	jne    80103d76 <lhfind+0xf>
+80103d8b:	eb 05                	jmp    80103d92 <lhfind+0x2b>
+      return i;
+  return -1;
+80103d8d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103d92:	c3                   	ret
+
+80103d93 <read_head>:
+}
+
+// Read the log header from disk into h
+static void
+read_head(struct logheader *h)
+{
+80103d93:	55                   	push   %ebp
+80103d94:	89 e5                	mov    %esp,%ebp
+80103d96:	57                   	push   %edi
+80103d97:	56                   	push   %esi
+80103d98:	53                   	push   %ebx
+80103d99:	83 ec 1c             	sub    $0x1c,%esp
+80103d9c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  struct buf *buf = 0;
+  int i, nw;
+
+  nw = 1;
+80103d9f:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  for (i = 0; i < nw; i++) {
+80103da6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  struct buf *buf = 0;
+80103dab:	bf 00 00 00 00       	mov    $0x0,%edi
+  for (i = 0; i < nw; i++) {
+80103db0:	eb 40                	jmp    80103df2 <read_head+0x5f>
+    if (i % HPB == 0)
+      buf = bread(log.dev, log.start + i / HPB);
+80103db2:	89 d8                	mov    %ebx,%eax
+80103db4:	c1 e8 07             	shr    $0x7,%eax
+80103db7:	83 ec 08             	sub    $0x8,%esp
+80103dba:	03 05 4c 20 14 80    	add    0x8014204c,%eax
+80103dc0:	50                   	push   %eax
+80103dc1:	ff 35 60 20 14 80    	push   0x80142060
+80103dc7:	e8 eb c6 ff ff       	call   801004b7 <bread>
+80103dcc:	89 c7                	mov    %eax,%edi
+80103dce:	83 c4 10             	add    $0x10,%esp
+80103dd1:	eb 30                	jmp    80103e03 <read_head+0x70>
+    ((int*)h)[i] = ((int*)buf->data)[i % HPB];
+    if (i == 0) {
+      if (h->n < 0 || h->n > log.cap)
+        panic("read_head");
+80103dd3:	83 ec 0c             	sub    $0xc,%esp
+80103dd6:	68 e0 b2 10 80       	push   $0x8010b2e0
+80103ddb:	e8 22 cb ff ff       	call   80100902 <panic>
+      nw = 1 + h->n;
+    }
+    if (i % HPB == HPB - 1 || i == nw - 1)
+80103de0:	83 fe 7f             	cmp    $0x7f,%esi
+80103de3:	74 48                	je     80103e2d <read_head+0x9a>
+80103de5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103de8:	83 e8 01             	sub    $0x1,%eax
+80103deb:	39 d8                	cmp    %ebx,%eax
+80103ded:	74 3e                	je     80103e2d <read_head+0x9a>
+  for (i = 0; i < nw; i++) {
+80103def:	83 c3 01             	add    $0x1,%ebx
+80103df2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103df5:	39 c3                	cmp    %eax,%ebx
+80103df7:	7d 42                	jge    80103e3b <read_head+0xa8>
+    if (i % HPB == 0)
+80103df9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80103dfc:	89 de                	mov    %ebx,%esi
+80103dfe:	83 e6 7f             	and    $0x7f,%esi
+80103e01:	74 af                	je     80103db2 <read_head+0x1f>
+    ((int*)h)[i] = ((int*)buf->data)[i % HPB];
+80103e03:	8b 84 b7 80 00 00 00 	mov    0x80(%edi,%esi,4),%eax
+80103e0a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80103e0d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80103e10:	89 04 8a             	mov    %eax,(%edx,%ecx,4)
+    if (i == 0) {
+80103e13:	85 db                	test   %ebx,%ebx
+80103e15:	75 c9                	jne    80103de0 <read_head+0x4d>
+      if (h->n < 0 || h->n > log.cap)
+80103e17:	8b 02                	mov    (%edx),%eax
+80103e19:	85 c0                	test   %eax,%eax
+80103e1b:	78 b6                	js     80103dd3 <read_head+0x40>
+80103e1d:	3b 05 68 20 14 80    	cmp    0x80142068,%eax
+80103e23:	7f ae                	jg     80103dd3 <read_head+0x40>
+      nw = 1 + h->n;
+80103e25:	83 c0 01             	add    $0x1,%eax
+80103e28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103e2b:	eb b3                	jmp    80103de0 <read_head+0x4d>
+      brelse(buf);
+80103e2d:	83 ec 0c             	sub    $0xc,%esp
+80103e30:	57                   	push   %edi
+80103e31:	e8 d9 c7 ff ff       	call   8010060f <brelse>
+80103e36:	83 c4 10             	add    $0x10,%esp
+80103e39:	eb b4                	jmp    80103def <read_head+0x5c>
+  }
+}
+80103e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e3e:	5b                   	pop    %ebx
+80103e3f:	5e                   	pop    %esi
+80103e40:	5f                   	pop    %edi
+80103e41:	5d                   	pop    %ebp
+80103e42:	c3                   	ret
+
+80103e43 <copy_log>:
+
+// Copy modified blocks from cache to the log buffers, returned
+// locked in lbuf. Nothing may change the blocks meanwhile.
+static void
+copy_log(struct buf **lbuf)
+{
+80103e43:	55                   	push   %ebp
+80103e44:	89 e5                	mov    %esp,%ebp
+80103e46:	57                   	push   %edi
+80103e47:	56                   	push   %esi
+80103e48:	53                   	push   %ebx
+80103e49:	83 ec 1c             	sub    $0x1c,%esp
+80103e4c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int tail;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+80103e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103e54:	eb 64                	jmp    80103eba <copy_log+0x77>
+    struct buf *to = bread(log.dev, log.start+log.nhead+tail); // log block
+80103e56:	a1 64 20 14 80       	mov    0x80142064,%eax
+80103e5b:	03 05 4c 20 14 80    	add    0x8014204c,%eax
+80103e61:	01 d8                	add    %ebx,%eax
+80103e63:	83 ec 08             	sub    $0x8,%esp
+80103e66:	50                   	push   %eax
+80103e67:	ff 35 60 20 14 80    	push   0x80142060
+80103e6d:	e8 45 c6 ff ff       	call   801004b7 <bread>
+80103e72:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.clh.block[tail]); // cache block
+80103e74:	83 c4 08             	add    $0x8,%esp
+80103e77:	ff 34 9d 74 30 14 80 	push   -0x7febcf8c(,%ebx,4)
+80103e7e:	ff 35 60 20 14 80    	push   0x80142060
+80103e84:	e8 2e c6 ff ff       	call   801004b7 <bread>
+80103e89:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+80103e8b:	8d 90 80 00 00 00    	lea    0x80(%eax),%edx
+80103e91:	8d 86 80 00 00 00    	lea    0x80(%esi),%eax
+80103e97:	83 c4 0c             	add    $0xc,%esp
+80103e9a:	68 00 02 00 00       	push   $0x200
+80103e9f:	52                   	push   %edx
+80103ea0:	50                   	push   %eax
+80103ea1:	e8 c9 3e 00 00       	call   80107d6f <memmove>
+    brelse(from);
+80103ea6:	89 3c 24             	mov    %edi,(%esp)
+80103ea9:	e8 61 c7 ff ff       	call   8010060f <brelse>
+    lbuf[tail] = to;
+80103eae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103eb1:	89 34 98             	mov    %esi,(%eax,%ebx,4)
+  for (tail = 0; tail < log.clh.n; tail++) {
+80103eb4:	83 c3 01             	add    $0x1,%ebx
+80103eb7:	83 c4 10             	add    $0x10,%esp
+80103eba:	39 1d 70 30 14 80    	cmp    %ebx,0x80143070
+80103ec0:	7f 94                	jg     80103e56 <copy_log+0x13>
+  }
+}
+80103ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103ec5:	5b                   	pop    %ebx
+80103ec6:	5e                   	pop    %esi
+80103ec7:	5f                   	pop    %edi
+80103ec8:	5d                   	pop    %ebp
+80103ec9:	c3                   	ret
+
+80103eca <write_log>:
+
+// Write the log buffers to disk in one batch.
+static void
+write_log(struct buf **lbuf)
+{
+80103eca:	55                   	push   %ebp
+80103ecb:	89 e5                	mov    %esp,%ebp
+80103ecd:	83 ec 10             	sub    $0x10,%esp
+  bwritev(lbuf, log.clh.n);
+80103ed0:	ff 35 70 30 14 80    	push   0x80143070
+80103ed6:	50                   	push   %eax
+80103ed7:	e8 89 c6 ff ff       	call   80100565 <bwritev>
+}
+80103edc:	83 c4 10             	add    $0x10,%esp
+80103edf:	c9                   	leave
+80103ee0:	c3                   	ret
+
+80103ee1 <install_trans>:
+{
+80103ee1:	55                   	push   %ebp
+80103ee2:	89 e5                	mov    %esp,%ebp
+80103ee4:	57                   	push   %edi
+80103ee5:	56                   	push   %esi
+80103ee6:	53                   	push   %ebx
+80103ee7:	83 ec 0c             	sub    $0xc,%esp
+80103eea:	89 c7                	mov    %eax,%edi
+  for (tail = 0; tail < log.clh.n; tail++) {
+80103eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103ef1:	eb 6c                	jmp    80103f5f <install_trans+0x7e>
+      brelse(b);
+80103ef3:	83 ec 0c             	sub    $0xc,%esp
+80103ef6:	56                   	push   %esi
+80103ef7:	e8 13 c7 ff ff       	call   8010060f <brelse>
+      acquiresleep(&ibuf.lock);
+80103efc:	c7 04 24 0c 60 14 80 	movl   $0x8014600c,(%esp)
+80103f03:	e8 f2 3a 00 00       	call   801079fa <acquiresleep>
+      ibuf.dev = log.dev;
+80103f08:	a1 60 20 14 80       	mov    0x80142060,%eax
+80103f0d:	a3 04 60 14 80       	mov    %eax,0x80146004
+      ibuf.blockno = log.clh.block[tail];
+80103f12:	8b 04 9d 74 30 14 80 	mov    -0x7febcf8c(,%ebx,4),%eax
+80103f19:	a3 08 60 14 80       	mov    %eax,0x80146008
+      ibuf.flags = B_VALID | B_DIRTY;
+80103f1e:	c7 05 00 60 14 80 06 	movl   $0x6,0x80146000
+80103f25:	00 00 00 
+      memmove(ibuf.data, lbuf[tail]->data, BSIZE);
+80103f28:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+80103f2b:	83 e8 80             	sub    $0xffffff80,%eax
+80103f2e:	83 c4 0c             	add    $0xc,%esp
+80103f31:	68 00 02 00 00       	push   $0x200
+80103f36:	50                   	push   %eax
+80103f37:	68 80 60 14 80       	push   $0x80146080
+80103f3c:	e8 2e 3e 00 00       	call   80107d6f <memmove>
+      iderw(&ibuf);
+80103f41:	c7 04 24 00 60 14 80 	movl   $0x80146000,(%esp)
+80103f48:	e8 08 f2 ff ff       	call   80103155 <iderw>
+      releasesleep(&ibuf.lock);
+80103f4d:	c7 04 24 0c 60 14 80 	movl   $0x8014600c,(%esp)
+80103f54:	e8 f0 3a 00 00       	call   80107a49 <releasesleep>
+80103f59:	83 c4 10             	add    $0x10,%esp
+  for (tail = 0; tail < log.clh.n; tail++) {
+80103f5c:	83 c3 01             	add    $0x1,%ebx
+80103f5f:	39 1d 70 30 14 80    	cmp    %ebx,0x80143070
+80103f65:	7e 66                	jle    80103fcd <install_trans+0xec>
+    b = bread(log.dev, log.clh.block[tail]);  // cached: no disk read
+80103f67:	83 ec 08             	sub    $0x8,%esp
+80103f6a:	ff 34 9d 74 30 14 80 	push   -0x7febcf8c(,%ebx,4)
+80103f71:	ff 35 60 20 14 80    	push   0x80142060
+80103f77:	e8 3b c5 ff ff       	call   801004b7 <bread>
+80103f7c:	89 c6                	mov    %eax,%esi
+    acquire(&log.lock);
+80103f7e:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+80103f85:	e8 93 3c 00 00       	call   80107c1d <acquire>
+    started[tail] = lhfind(b->blockno) < 0;
+80103f8a:	8b 46 08             	mov    0x8(%esi),%eax
+80103f8d:	e8 d5 fd ff ff       	call   80103d67 <lhfind>
+80103f92:	c1 e8 1f             	shr    $0x1f,%eax
+80103f95:	88 83 c0 4a 14 80    	mov    %al,-0x7febb540(%ebx)
+    release(&log.lock);
+80103f9b:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+80103fa2:	e8 f5 3c 00 00       	call   80107c9c <release>
+    if (started[tail]) {
+80103fa7:	83 c4 10             	add    $0x10,%esp
+80103faa:	80 bb c0 4a 14 80 00 	cmpb   $0x0,-0x7febb540(%ebx)
+80103fb1:	0f 84 3c ff ff ff    	je     80103ef3 <install_trans+0x12>
+      bpin(b);
+80103fb7:	83 ec 0c             	sub    $0xc,%esp
+80103fba:	56                   	push   %esi
+80103fbb:	e8 1b c7 ff ff       	call   801006db <bpin>
+      bawrite(b);
+80103fc0:	89 34 24             	mov    %esi,(%esp)
+80103fc3:	e8 5e c5 ff ff       	call   80100526 <bawrite>
+80103fc8:	83 c4 10             	add    $0x10,%esp
+80103fcb:	eb 8f                	jmp    80103f5c <install_trans+0x7b>
+  for (tail = 0; tail < log.clh.n; tail++) {
+80103fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103fd2:	eb 03                	jmp    80103fd7 <install_trans+0xf6>
+80103fd4:	83 c3 01             	add    $0x1,%ebx
+80103fd7:	39 1d 70 30 14 80    	cmp    %ebx,0x80143070
+80103fdd:	7e 35                	jle    80104014 <install_trans+0x133>
+    if (!started[tail])
+80103fdf:	80 bb c0 4a 14 80 00 	cmpb   $0x0,-0x7febb540(%ebx)
+80103fe6:	74 ec                	je     80103fd4 <install_trans+0xf3>
+    b = bread(log.dev, log.clh.block[tail]);
+80103fe8:	83 ec 08             	sub    $0x8,%esp
+80103feb:	ff 34 9d 74 30 14 80 	push   -0x7febcf8c(,%ebx,4)
+80103ff2:	ff 35 60 20 14 80    	push   0x80142060
+80103ff8:	e8 ba c4 ff ff       	call   801004b7 <bread>
+80103ffd:	89 c6                	mov    %eax,%esi
+    bunpin(b);
+80103fff:	89 04 24             	mov    %eax,(%esp)
+80104002:	e8 11 c7 ff ff       	call   80100718 <bunpin>
+    brelse(b);
+80104007:	89 34 24             	mov    %esi,(%esp)
+8010400a:	e8 00 c6 ff ff       	call   8010060f <brelse>
+8010400f:	83 c4 10             	add    $0x10,%esp
+80104012:	eb c0                	jmp    80103fd4 <install_trans+0xf3>
+}
+80104014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104017:	5b                   	pop    %ebx
+80104018:	5e                   	pop    %esi
+80104019:	5f                   	pop    %edi
+8010401a:	5d                   	pop    %ebp
+8010401b:	c3                   	ret
+
+8010401c <write_head>:
+{
+8010401c:	55                   	push   %ebp
+8010401d:	89 e5                	mov    %esp,%ebp
+8010401f:	57                   	push   %edi
+80104020:	56                   	push   %esi
+80104021:	53                   	push   %ebx
+80104022:	83 ec 0c             	sub    $0xc,%esp
+80104025:	89 c7                	mov    %eax,%edi
+  nb = (1 + h->n + HPB - 1) / HPB;
+80104027:	8b 00                	mov    (%eax),%eax
+80104029:	8d b0 80 00 00 00    	lea    0x80(%eax),%esi
+8010402f:	c1 ee 07             	shr    $0x7,%esi
+  for (i = 0; i < nb; i++) {
+80104032:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104037:	eb 2b                	jmp    80104064 <write_head+0x48>
+            i == nb - 1 ? ((1 + h->n) - i * HPB) * sizeof(int) : BSIZE);
+80104039:	89 d9                	mov    %ebx,%ecx
+8010403b:	c1 e1 07             	shl    $0x7,%ecx
+8010403e:	8b 17                	mov    (%edi),%edx
+80104040:	29 ca                	sub    %ecx,%edx
+    memmove(hbuf[i]->data, (int*)h + i * HPB,
+80104042:	8d 0c 95 04 00 00 00 	lea    0x4(,%edx,4),%ecx
+80104049:	89 da                	mov    %ebx,%edx
+8010404b:	c1 e2 09             	shl    $0x9,%edx
+8010404e:	83 e8 80             	sub    $0xffffff80,%eax
+80104051:	83 ec 04             	sub    $0x4,%esp
+80104054:	51                   	push   %ecx
+80104055:	01 fa                	add    %edi,%edx
+80104057:	52                   	push   %edx
+80104058:	50                   	push   %eax
+80104059:	e8 11 3d 00 00       	call   80107d6f <memmove>
+  for (i = 0; i < nb; i++) {
+8010405e:	83 c3 01             	add    $0x1,%ebx
+80104061:	83 c4 10             	add    $0x10,%esp
+80104064:	39 f3                	cmp    %esi,%ebx
+80104066:	7d 2f                	jge    80104097 <write_head+0x7b>
+    hbuf[i] = bread(log.dev, log.start + i);
+80104068:	89 d8                	mov    %ebx,%eax
+8010406a:	03 05 4c 20 14 80    	add    0x8014204c,%eax
+80104070:	83 ec 08             	sub    $0x8,%esp
+80104073:	50                   	push   %eax
+80104074:	ff 35 60 20 14 80    	push   0x80142060
+8010407a:	e8 38 c4 ff ff       	call   801004b7 <bread>
+8010407f:	89 04 9d 80 4a 14 80 	mov    %eax,-0x7febb580(,%ebx,4)
+            i == nb - 1 ? ((1 + h->n) - i * HPB) * sizeof(int) : BSIZE);
+80104086:	8d 56 ff             	lea    -0x1(%esi),%edx
+    memmove(hbuf[i]->data, (int*)h + i * HPB,
+80104089:	83 c4 10             	add    $0x10,%esp
+8010408c:	39 da                	cmp    %ebx,%edx
+8010408e:	74 a9                	je     80104039 <write_head+0x1d>
+80104090:	b9 00 02 00 00       	mov    $0x200,%ecx
+80104095:	eb b2                	jmp    80104049 <write_head+0x2d>
+  if (nb > 1)
+80104097:	83 fe 01             	cmp    $0x1,%esi
+8010409a:	7f 18                	jg     801040b4 <write_head+0x98>
+  bwrite(hbuf[0]);
+8010409c:	83 ec 0c             	sub    $0xc,%esp
+8010409f:	ff 35 80 4a 14 80    	push   0x80144a80
+801040a5:	e8 3d c4 ff ff       	call   801004e7 <bwrite>
+  for (i = 0; i < nb; i++)
+801040aa:	83 c4 10             	add    $0x10,%esp
+801040ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+801040b2:	eb 2b                	jmp    801040df <write_head+0xc3>
+    bwritev(hbuf + 1, nb - 1);
+801040b4:	83 ec 08             	sub    $0x8,%esp
+801040b7:	8d 46 ff             	lea    -0x1(%esi),%eax
+801040ba:	50                   	push   %eax
+801040bb:	68 84 4a 14 80       	push   $0x80144a84
+801040c0:	e8 a0 c4 ff ff       	call   80100565 <bwritev>
+801040c5:	83 c4 10             	add    $0x10,%esp
+801040c8:	eb d2                	jmp    8010409c <write_head+0x80>
+    brelse(hbuf[i]);
+801040ca:	83 ec 0c             	sub    $0xc,%esp
+801040cd:	ff 34 9d 80 4a 14 80 	push   -0x7febb580(,%ebx,4)
+801040d4:	e8 36 c5 ff ff       	call   8010060f <brelse>
+  for (i = 0; i < nb; i++)
+801040d9:	83 c3 01             	add    $0x1,%ebx
+801040dc:	83 c4 10             	add    $0x10,%esp
+801040df:	39 f3                	cmp    %esi,%ebx
+801040e1:	7c e7                	jl     801040ca <write_head+0xae>
+}
+801040e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801040e6:	5b                   	pop    %ebx
+801040e7:	5e                   	pop    %esi
+801040e8:	5f                   	pop    %edi
+801040e9:	5d                   	pop    %ebp
+801040ea:	c3                   	ret
+
+801040eb <install_from_log>:
+{
+801040eb:	55                   	push   %ebp
+801040ec:	89 e5                	mov    %esp,%ebp
+801040ee:	57                   	push   %edi
+801040ef:	56                   	push   %esi
+801040f0:	53                   	push   %ebx
+801040f1:	83 ec 1c             	sub    $0x1c,%esp
+801040f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (tail = 0; tail < h->n; tail++) {
+801040f7:	be 00 00 00 00       	mov    $0x0,%esi
+801040fc:	eb 6e                	jmp    8010416c <install_from_log+0x81>
+    struct buf *lbuf = bread(log.dev, log.start+log.nhead+tail); // read log block
+801040fe:	a1 64 20 14 80       	mov    0x80142064,%eax
+80104103:	03 05 4c 20 14 80    	add    0x8014204c,%eax
+80104109:	01 f0                	add    %esi,%eax
+8010410b:	83 ec 08             	sub    $0x8,%esp
+8010410e:	50                   	push   %eax
+8010410f:	ff 35 60 20 14 80    	push   0x80142060
+80104115:	e8 9d c3 ff ff       	call   801004b7 <bread>
+8010411a:	89 c7                	mov    %eax,%edi
+    struct buf *dbuf = bread(log.dev, h->block[tail]); // read dst
+8010411c:	83 c4 08             	add    $0x8,%esp
+8010411f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104122:	ff 74 b0 04          	push   0x4(%eax,%esi,4)
+80104126:	ff 35 60 20 14 80    	push   0x80142060
+8010412c:	e8 86 c3 ff ff       	call   801004b7 <bread>
+80104131:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80104133:	8d 97 80 00 00 00    	lea    0x80(%edi),%edx
+80104139:	8d 80 80 00 00 00    	lea    0x80(%eax),%eax
+8010413f:	83 c4 0c             	add    $0xc,%esp
+80104142:	68 00 02 00 00       	push   $0x200
+80104147:	52                   	push   %edx
+80104148:	50                   	push   %eax
+80104149:	e8 21 3c 00 00       	call   80107d6f <memmove>
+    bwrite(dbuf);  // write dst to disk
+8010414e:	89 1c 24             	mov    %ebx,(%esp)
+80104151:	e8 91 c3 ff ff       	call   801004e7 <bwrite>
+    brelse(lbuf);
+80104156:	89 3c 24             	mov    %edi,(%esp)
+80104159:	e8 b1 c4 ff ff       	call   8010060f <brelse>
+    brelse(dbuf);
+8010415e:	89 1c 24             	mov    %ebx,(%esp)
+80104161:	e8 a9 c4 ff ff       	call   8010060f <brelse>
+  for (tail = 0; tail < h->n; tail++) {
+80104166:	83 c6 01             	add    $0x1,%esi
+80104169:	83 c4 10             	add    $0x10,%esp
+8010416c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010416f:	39 30                	cmp    %esi,(%eax)
+80104171:	7f 8b                	jg     801040fe <install_from_log+0x13>
+}
+80104173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104176:	5b                   	pop    %ebx
+80104177:	5e                   	pop    %esi
+80104178:	5f                   	pop    %edi
+80104179:	5d                   	pop    %ebp
+8010417a:	c3                   	ret
+
+8010417b <recover_from_log>:
+{
+8010417b:	55                   	push   %ebp
+8010417c:	89 e5                	mov    %esp,%ebp
+8010417e:	83 ec 08             	sub    $0x8,%esp
+  read_head(&log.clh);
+80104181:	b8 70 30 14 80       	mov    $0x80143070,%eax
+80104186:	e8 08 fc ff ff       	call   80103d93 <read_head>
+  install_from_log(&log.clh); // if committed, copy from log to disk
+8010418b:	b8 70 30 14 80       	mov    $0x80143070,%eax
+80104190:	e8 56 ff ff ff       	call   801040eb <install_from_log>
+  log.clh.n = 0;
+80104195:	c7 05 70 30 14 80 00 	movl   $0x0,0x80143070
+8010419c:	00 00 00 
+  write_head(&log.clh); // clear the log
+8010419f:	b8 70 30 14 80       	mov    $0x80143070,%eax
+801041a4:	e8 73 fe ff ff       	call   8010401c <write_head>
+}
+801041a9:	c9                   	leave
+801041aa:	c3                   	ret
+
+801041ab <lhclear>:
+{
+801041ab:	55                   	push   %ebp
+801041ac:	89 e5                	mov    %esp,%ebp
+801041ae:	83 ec 0c             	sub    $0xc,%esp
+  log.lh.n = 0;
+801041b1:	c7 05 6c 20 14 80 00 	movl   $0x0,0x8014206c
+801041b8:	00 00 00 
+  memset(log.lhhead, 0xff, sizeof(log.lhhead));
+801041bb:	68 00 02 00 00       	push   $0x200
+801041c0:	68 ff 00 00 00       	push   $0xff
+801041c5:	68 74 40 14 80       	push   $0x80144074
+801041ca:	e8 28 3b 00 00       	call   80107cf7 <memset>
+}
+801041cf:	83 c4 10             	add    $0x10,%esp
+801041d2:	c9                   	leave
+801041d3:	c3                   	ret
+
+801041d4 <committer>:
+// The commit thread. Waits for a transaction with no FS system
+// calls active, freezes it and commits it while the next one
+// accumulates.
+static void
+committer(void)
+{
+801041d4:	55                   	push   %ebp
+801041d5:	89 e5                	mov    %esp,%ebp
+801041d7:	57                   	push   %edi
+801041d8:	56                   	push   %esi
+801041d9:	53                   	push   %ebx
+801041da:	83 ec 18             	sub    $0x18,%esp
+  static struct buf *lbuf[MAXLOGSIZE];
+  int i;
+
+  acquire(&log.lock);
+801041dd:	68 00 20 14 80       	push   $0x80142000
+801041e2:	e8 36 3a 00 00       	call   80107c1d <acquire>
+801041e7:	83 c4 10             	add    $0x10,%esp
+801041ea:	eb 15                	jmp    80104201 <committer+0x2d>
+  for(;;){
+    while(log.lh.n == 0 || log.outstanding > 0)
+      sleep(&log.clh, &log.lock);
+801041ec:	83 ec 08             	sub    $0x8,%esp
+801041ef:	68 00 20 14 80       	push   $0x80142000
+801041f4:	68 70 30 14 80       	push   $0x80143070
+801041f9:	e8 79 23 00 00       	call   80106577 <sleep>
+801041fe:	83 c4 10             	add    $0x10,%esp
+    while(log.lh.n == 0 || log.outstanding > 0)
+80104201:	83 3d 6c 20 14 80 00 	cmpl   $0x0,0x8014206c
+80104208:	74 e2                	je     801041ec <committer+0x18>
+8010420a:	83 3d 54 20 14 80 00 	cmpl   $0x0,0x80142054
+80104211:	7f d9                	jg     801041ec <committer+0x18>
+
+    log.freezing = 1;
+80104213:	c7 05 58 20 14 80 01 	movl   $0x1,0x80142058
+8010421a:	00 00 00 
+    log.committing = 1;
+8010421d:	c7 05 5c 20 14 80 01 	movl   $0x1,0x8014205c
+80104224:	00 00 00 
+    log.clh = log.lh;
+80104227:	b8 70 30 14 80       	mov    $0x80143070,%eax
+8010422c:	be 6c 20 14 80       	mov    $0x8014206c,%esi
+80104231:	b9 01 04 00 00       	mov    $0x401,%ecx
+80104236:	89 c7                	mov    %eax,%edi
+80104238:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    lhclear();
+8010423a:	e8 6c ff ff ff       	call   801041ab <lhclear>
+    release(&log.lock);
+8010423f:	83 ec 0c             	sub    $0xc,%esp
+80104242:	68 00 20 14 80       	push   $0x80142000
+80104247:	e8 50 3a 00 00       	call   80107c9c <release>
+
+    copy_log(lbuf);
+8010424c:	b8 c0 4e 14 80       	mov    $0x80144ec0,%eax
+80104251:	e8 ed fb ff ff       	call   80103e43 <copy_log>
+
+    acquire(&log.lock);
+80104256:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+8010425d:	e8 bb 39 00 00       	call   80107c1d <acquire>
+    log.freezing = 0;
+80104262:	c7 05 58 20 14 80 00 	movl   $0x0,0x80142058
+80104269:	00 00 00 
+    wakeup(&log);
+8010426c:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+80104273:	e8 54 24 00 00       	call   801066cc <wakeup>
+    release(&log.lock);
+80104278:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+8010427f:	e8 18 3a 00 00       	call   80107c9c <release>
+
+    write_log(lbuf);            // Write modified blocks to log
+80104284:	b8 c0 4e 14 80       	mov    $0x80144ec0,%eax
+80104289:	e8 3c fc ff ff       	call   80103eca <write_log>
+    write_head(&log.clh);       // Write header to disk -- the real commit
+8010428e:	b8 70 30 14 80       	mov    $0x80143070,%eax
+80104293:	e8 84 fd ff ff       	call   8010401c <write_head>
+    install_trans(lbuf);        // Now install writes to home locations
+80104298:	b8 c0 4e 14 80       	mov    $0x80144ec0,%eax
+8010429d:	e8 3f fc ff ff       	call   80103ee1 <install_trans>
+    for (i = 0; i < log.clh.n; i++)
+801042a2:	83 c4 10             	add    $0x10,%esp
+801042a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801042aa:	39 1d 70 30 14 80    	cmp    %ebx,0x80143070
+801042b0:	7e 17                	jle    801042c9 <committer+0xf5>
+      brelse(lbuf[i]);
+801042b2:	83 ec 0c             	sub    $0xc,%esp
+801042b5:	ff 34 9d c0 4e 14 80 	push   -0x7febb140(,%ebx,4)
+801042bc:	e8 4e c3 ff ff       	call   8010060f <brelse>
+    for (i = 0; i < log.clh.n; i++)
+801042c1:	83 c3 01             	add    $0x1,%ebx
+801042c4:	83 c4 10             	add    $0x10,%esp
+801042c7:	eb e1                	jmp    801042aa <committer+0xd6>
+    log.clh.n = 0;
+801042c9:	c7 05 70 30 14 80 00 	movl   $0x0,0x80143070
+801042d0:	00 00 00 
+    write_head(&log.clh);       // Erase the transaction from the log
+801042d3:	b8 70 30 14 80       	mov    $0x80143070,%eax
+801042d8:	e8 3f fd ff ff       	call   8010401c <write_head>
+
+    acquire(&log.lock);
+801042dd:	83 ec 0c             	sub    $0xc,%esp
+801042e0:	68 00 20 14 80       	push   $0x80142000
+801042e5:	e8 33 39 00 00       	call   80107c1d <acquire>
+    log.committing = 0;
+801042ea:	c7 05 5c 20 14 80 00 	movl   $0x0,0x8014205c
+801042f1:	00 00 00 
+    wakeup(&log);
+801042f4:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+801042fb:	e8 cc 23 00 00       	call   801066cc <wakeup>
+    while(log.lh.n == 0 || log.outstanding > 0)
+80104300:	83 c4 10             	add    $0x10,%esp
+80104303:	e9 f9 fe ff ff       	jmp    80104201 <committer+0x2d>
+
+80104308 <initlog>:
+{
+80104308:	55                   	push   %ebp
+80104309:	89 e5                	mov    %esp,%ebp
+8010430b:	56                   	push   %esi
+8010430c:	53                   	push   %ebx
+8010430d:	83 ec 28             	sub    $0x28,%esp
+80104310:	8b 75 08             	mov    0x8(%ebp),%esi
+  initlock(&log.lock, "log");
+80104313:	68 ea b2 10 80       	push   $0x8010b2ea
+80104318:	68 00 20 14 80       	push   $0x80142000
+8010431d:	e8 b0 37 00 00       	call   80107ad2 <initlock>
+  readsb(dev, &sb);
+80104322:	83 c4 08             	add    $0x8,%esp
+80104325:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80104328:	50                   	push   %eax
+80104329:	56                   	push   %esi
+8010432a:	e8 f1 da ff ff       	call   80101e20 <readsb>
+  log.start = sb.logstart;
+8010432f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80104332:	a3 4c 20 14 80       	mov    %eax,0x8014204c
+  log.size = sb.nlog;
+80104337:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+8010433a:	89 1d 50 20 14 80    	mov    %ebx,0x80142050
+  log.dev = dev;
+80104340:	89 35 60 20 14 80    	mov    %esi,0x80142060
+  for (h = 1; h * HPB - 1 < log.size - h; h++)
+80104346:	83 c4 10             	add    $0x10,%esp
+80104349:	b8 01 00 00 00       	mov    $0x1,%eax
+8010434e:	eb 03                	jmp    80104353 <initlog+0x4b>
+80104350:	83 c0 01             	add    $0x1,%eax
+80104353:	89 c2                	mov    %eax,%edx
+80104355:	c1 e2 07             	shl    $0x7,%edx
+80104358:	83 ea 01             	sub    $0x1,%edx
+8010435b:	89 d9                	mov    %ebx,%ecx
+8010435d:	29 c1                	sub    %eax,%ecx
+8010435f:	39 ca                	cmp    %ecx,%edx
+80104361:	72 ed                	jb     80104350 <initlog+0x48>
+  log.nhead = h;
+80104363:	a3 64 20 14 80       	mov    %eax,0x80142064
+  log.cap = log.size - h;
+80104368:	89 0d 68 20 14 80    	mov    %ecx,0x80142068
+  if (log.cap > MAXLOGSIZE)
+8010436e:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+80104374:	7e 0a                	jle    80104380 <initlog+0x78>
+    log.cap = MAXLOGSIZE;
+80104376:	c7 05 68 20 14 80 00 	movl   $0x400,0x80142068
+8010437d:	04 00 00 
+  if (log.cap < MAXOPBLOCKS)
+80104380:	83 3d 68 20 14 80 09 	cmpl   $0x9,0x80142068
+80104387:	7e 3e                	jle    801043c7 <initlog+0xbf>
+  lhclear();
+80104389:	e8 1d fe ff ff       	call   801041ab <lhclear>
+  recover_from_log();
+8010438e:	e8 e8 fd ff ff       	call   8010417b <recover_from_log>
+  initsleeplock(&ibuf.lock, "logibuf");
+80104393:	83 ec 08             	sub    $0x8,%esp
+80104396:	68 05 b3 10 80       	push   $0x8010b305
+8010439b:	68 0c 60 14 80       	push   $0x8014600c
+801043a0:	e8 22 36 00 00       	call   801079c7 <initsleeplock>
+  if(kthread("committer", committer, 0) < 0)
+801043a5:	83 c4 0c             	add    $0xc,%esp
+801043a8:	6a 00                	push   $0x0
+801043aa:	68 d4 41 10 80       	push   $0x801041d4
+801043af:	68 16 b3 10 80       	push   $0x8010b316
+801043b4:	e8 51 17 00 00       	call   80105b0a <kthread>
+801043b9:	83 c4 10             	add    $0x10,%esp
+801043bc:	85 c0                	test   %eax,%eax
+801043be:	78 14                	js     801043d4 <initlog+0xcc>
+}
+801043c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801043c3:	5b                   	pop    %ebx
+801043c4:	5e                   	pop    %esi
+801043c5:	5d                   	pop    %ebp
+801043c6:	c3                   	ret
+    panic("initlog: log too small");
+801043c7:	83 ec 0c             	sub    $0xc,%esp
+801043ca:	68 ee b2 10 80       	push   $0x8010b2ee
+801043cf:	e8 2e c5 ff ff       	call   80100902 <panic>
+    panic("initlog: committer");
+801043d4:	83 ec 0c             	sub    $0xc,%esp
+801043d7:	68 0d b3 10 80       	push   $0x8010b30d
+801043dc:	e8 21 c5 ff ff       	call   80100902 <panic>
+
+801043e1 <begin_op>:
+{
+801043e1:	55                   	push   %ebp
+801043e2:	89 e5                	mov    %esp,%ebp
+801043e4:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+801043e7:	68 00 20 14 80       	push   $0x80142000
+801043ec:	e8 2c 38 00 00       	call   80107c1d <acquire>
+801043f1:	83 c4 10             	add    $0x10,%esp
+801043f4:	eb 15                	jmp    8010440b <begin_op+0x2a>
+      sleep(&log, &log.lock);
+801043f6:	83 ec 08             	sub    $0x8,%esp
+801043f9:	68 00 20 14 80       	push   $0x80142000
+801043fe:	68 00 20 14 80       	push   $0x80142000
+80104403:	e8 6f 21 00 00       	call   80106577 <sleep>
+80104408:	83 c4 10             	add    $0x10,%esp
+    if(log.freezing){
+8010440b:	83 3d 58 20 14 80 00 	cmpl   $0x0,0x80142058
+80104412:	75 e2                	jne    801043f6 <begin_op+0x15>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > log.cap){
+80104414:	a1 54 20 14 80       	mov    0x80142054,%eax
+80104419:	83 c0 01             	add    $0x1,%eax
+8010441c:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+8010441f:	8d 14 09             	lea    (%ecx,%ecx,1),%edx
+80104422:	03 15 6c 20 14 80    	add    0x8014206c,%edx
+80104428:	3b 15 68 20 14 80    	cmp    0x80142068,%edx
+8010442e:	7e 24                	jle    80104454 <begin_op+0x73>
+      wakeup(&log.clh);
+80104430:	83 ec 0c             	sub    $0xc,%esp
+80104433:	68 70 30 14 80       	push   $0x80143070
+80104438:	e8 8f 22 00 00       	call   801066cc <wakeup>
+      sleep(&log, &log.lock);
+8010443d:	83 c4 08             	add    $0x8,%esp
+80104440:	68 00 20 14 80       	push   $0x80142000
+80104445:	68 00 20 14 80       	push   $0x80142000
+8010444a:	e8 28 21 00 00       	call   80106577 <sleep>
+8010444f:	83 c4 10             	add    $0x10,%esp
+80104452:	eb b7                	jmp    8010440b <begin_op+0x2a>
+      log.outstanding += 1;
+80104454:	a3 54 20 14 80       	mov    %eax,0x80142054
+      release(&log.lock);
+80104459:	83 ec 0c             	sub    $0xc,%esp
+8010445c:	68 00 20 14 80       	push   $0x80142000
+80104461:	e8 36 38 00 00       	call   80107c9c <release>
+}
+80104466:	83 c4 10             	add    $0x10,%esp
+80104469:	c9                   	leave
+8010446a:	c3                   	ret
+
+8010446b <end_op>:
+{
+8010446b:	55                   	push   %ebp
+8010446c:	89 e5                	mov    %esp,%ebp
+8010446e:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104471:	68 00 20 14 80       	push   $0x80142000
+80104476:	e8 a2 37 00 00       	call   80107c1d <acquire>
+  log.outstanding -= 1;
+8010447b:	a1 54 20 14 80       	mov    0x80142054,%eax
+80104480:	83 e8 01             	sub    $0x1,%eax
+80104483:	a3 54 20 14 80       	mov    %eax,0x80142054
+  if(log.freezing)
+80104488:	83 c4 10             	add    $0x10,%esp
+8010448b:	83 3d 58 20 14 80 00 	cmpl   $0x0,0x80142058
+80104492:	75 2b                	jne    801044bf <end_op+0x54>
+  if(log.outstanding == 0 && log.lh.n > 0)
+80104494:	85 c0                	test   %eax,%eax
+80104496:	75 09                	jne    801044a1 <end_op+0x36>
+80104498:	83 3d 6c 20 14 80 00 	cmpl   $0x0,0x8014206c
+8010449f:	7f 2b                	jg     801044cc <end_op+0x61>
+  wakeup(&log);
+801044a1:	83 ec 0c             	sub    $0xc,%esp
+801044a4:	68 00 20 14 80       	push   $0x80142000
+801044a9:	e8 1e 22 00 00       	call   801066cc <wakeup>
+  release(&log.lock);
+801044ae:	c7 04 24 00 20 14 80 	movl   $0x80142000,(%esp)
+801044b5:	e8 e2 37 00 00       	call   80107c9c <release>
+}
+801044ba:	83 c4 10             	add    $0x10,%esp
+801044bd:	c9                   	leave
+801044be:	c3                   	ret
+    panic("log.freezing");
+801044bf:	83 ec 0c             	sub    $0xc,%esp
+801044c2:	68 20 b3 10 80       	push   $0x8010b320
+801044c7:	e8 36 c4 ff ff       	call   80100902 <panic>
+    wakeup(&log.clh);
+801044cc:	83 ec 0c             	sub    $0xc,%esp
+801044cf:	68 70 30 14 80       	push   $0x80143070
+801044d4:	e8 f3 21 00 00       	call   801066cc <wakeup>
+801044d9:	83 c4 10             	add    $0x10,%esp
+801044dc:	eb c3                	jmp    801044a1 <end_op+0x36>
+
+801044de <log_sync>:
+}
+
+// Wait until every transaction that has ended is on disk.
+void
+log_sync(void)
+{
+801044de:	55                   	push   %ebp
+801044df:	89 e5                	mov    %esp,%ebp
+801044e1:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+801044e4:	68 00 20 14 80       	push   $0x80142000
+801044e9:	e8 2f 37 00 00       	call   80107c1d <acquire>
+  while(log.lh.n > 0 || log.committing){
+801044ee:	83 c4 10             	add    $0x10,%esp
+801044f1:	eb 22                	jmp    80104515 <log_sync+0x37>
+    wakeup(&log.clh);
+801044f3:	83 ec 0c             	sub    $0xc,%esp
+801044f6:	68 70 30 14 80       	push   $0x80143070
+801044fb:	e8 cc 21 00 00       	call   801066cc <wakeup>
+    sleep(&log, &log.lock);
+80104500:	83 c4 08             	add    $0x8,%esp
+80104503:	68 00 20 14 80       	push   $0x80142000
+80104508:	68 00 20 14 80       	push   $0x80142000
+8010450d:	e8 65 20 00 00       	call   80106577 <sleep>
+80104512:	83 c4 10             	add    $0x10,%esp
+  while(log.lh.n > 0 || log.committing){
+80104515:	83 3d 6c 20 14 80 00 	cmpl   $0x0,0x8014206c
+8010451c:	7f d5                	jg     801044f3 <log_sync+0x15>
+8010451e:	83 3d 5c 20 14 80 00 	cmpl   $0x0,0x8014205c
+80104525:	75 cc                	jne    801044f3 <log_sync+0x15>
+  }
+  release(&log.lock);
+80104527:	83 ec 0c             	sub    $0xc,%esp
+8010452a:	68 00 20 14 80       	push   $0x80142000
+8010452f:	e8 68 37 00 00       	call   80107c9c <release>
+}
+80104534:	83 c4 10             	add    $0x10,%esp
+80104537:	c9                   	leave
+80104538:	c3                   	ret
+
+80104539 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80104539:	55                   	push   %ebp
+8010453a:	89 e5                	mov    %esp,%ebp
+8010453c:	53                   	push   %ebx
+8010453d:	83 ec 04             	sub    $0x4,%esp
+80104540:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= log.cap)
+80104543:	a1 68 20 14 80       	mov    0x80142068,%eax
+80104548:	39 05 6c 20 14 80    	cmp    %eax,0x8014206c
+8010454e:	7d 41                	jge    80104591 <log_write+0x58>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104550:	83 3d 54 20 14 80 00 	cmpl   $0x0,0x80142054
+80104557:	7e 45                	jle    8010459e <log_write+0x65>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80104559:	83 ec 0c             	sub    $0xc,%esp
+8010455c:	68 00 20 14 80       	push   $0x80142000
+80104561:	e8 b7 36 00 00       	call   80107c1d <acquire>
+  if (lhfind(b->blockno) < 0) {   // log absorbtion
+80104566:	8b 43 08             	mov    0x8(%ebx),%eax
+80104569:	e8 f9 f7 ff ff       	call   80103d67 <lhfind>
+8010456e:	83 c4 10             	add    $0x10,%esp
+80104571:	85 c0                	test   %eax,%eax
+80104573:	78 36                	js     801045ab <log_write+0x72>
+    i = log.lh.n++;
+    log.lh.block[i] = b->blockno;
+    log.lhnext[i] = log.lhhead[b->blockno % NLHASH];
+    log.lhhead[b->blockno % NLHASH] = i;
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+80104575:	8b 03                	mov    (%ebx),%eax
+80104577:	83 c8 04             	or     $0x4,%eax
+8010457a:	89 03                	mov    %eax,(%ebx)
+  release(&log.lock);
+8010457c:	83 ec 0c             	sub    $0xc,%esp
+8010457f:	68 00 20 14 80       	push   $0x80142000
+80104584:	e8 13 37 00 00       	call   80107c9c <release>
+}
+80104589:	83 c4 10             	add    $0x10,%esp
+8010458c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010458f:	c9                   	leave
+80104590:	c3                   	ret
+    panic("too big a transaction");
+80104591:	83 ec 0c             	sub    $0xc,%esp
+80104594:	68 2d b3 10 80       	push   $0x8010b32d
+80104599:	e8 64 c3 ff ff       	call   80100902 <panic>
+    panic("log_write outside of trans");
+8010459e:	83 ec 0c             	sub    $0xc,%esp
+801045a1:	68 43 b3 10 80       	push   $0x8010b343
+801045a6:	e8 57 c3 ff ff       	call   80100902 <panic>
+    i = log.lh.n++;
+801045ab:	ba 00 20 14 80       	mov    $0x80142000,%edx
+801045b0:	a1 6c 20 14 80       	mov    0x8014206c,%eax
+801045b5:	8d 48 01             	lea    0x1(%eax),%ecx
+801045b8:	89 0d 6c 20 14 80    	mov    %ecx,0x8014206c
+    log.lh.block[i] = b->blockno;
+801045be:	8b 4b 08             	mov    0x8(%ebx),%ecx
+801045c1:	89 0c 85 70 20 14 80 	mov    %ecx,-0x7febdf90(,%eax,4)
+    log.lhnext[i] = log.lhhead[b->blockno % NLHASH];
+801045c8:	0f b6 4b 08          	movzbl 0x8(%ebx),%ecx
+801045cc:	0f b7 8c 4a 74 20 00 	movzwl 0x2074(%edx,%ecx,2),%ecx
+801045d3:	00 
+801045d4:	66 89 8c 42 74 22 00 	mov    %cx,0x2274(%edx,%eax,2)
+801045db:	00 
+    log.lhhead[b->blockno % NLHASH] = i;
+801045dc:	0f b6 4b 08          	movzbl 0x8(%ebx),%ecx
+801045e0:	66 89 84 4a 74 20 00 	mov    %ax,0x2074(%edx,%ecx,2)
+801045e7:	00 
+801045e8:	eb 8b                	jmp    80104575 <log_write+0x3c>
+
+801045ea <startothers>:
+pde_t entrypgdir[];  // For entry.S
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+801045ea:	55                   	push   %ebp
+801045eb:	89 e5                	mov    %esp,%ebp
+801045ed:	53                   	push   %ebx
+801045ee:	83 ec 08             	sub    $0x8,%esp
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801045f1:	68 8e 00 00 00       	push   $0x8e
+801045f6:	68 fc f9 10 80       	push   $0x8010f9fc
+801045fb:	68 00 70 00 80       	push   $0x80007000
+80104600:	e8 6a 37 00 00       	call   80107d6f <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80104605:	83 c4 10             	add    $0x10,%esp
+80104608:	bb a0 62 14 80       	mov    $0x801462a0,%ebx
+8010460d:	eb 13                	jmp    80104622 <startothers+0x38>
+8010460f:	83 ec 0c             	sub    $0xc,%esp
+80104612:	68 30 af 10 80       	push   $0x8010af30
+80104617:	e8 e6 c2 ff ff       	call   80100902 <panic>
+8010461c:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+80104622:	69 05 84 62 14 80 b0 	imul   $0xb0,0x80146284,%eax
+80104629:	00 00 00 
+8010462c:	05 a0 62 14 80       	add    $0x801462a0,%eax
+80104631:	39 c3                	cmp    %eax,%ebx
+80104633:	73 58                	jae    8010468d <startothers+0xa3>
+    if(c == mycpu())  // We've started already.
+80104635:	e8 27 13 00 00       	call   80105961 <mycpu>
+8010463a:	39 c3                	cmp    %eax,%ebx
+8010463c:	74 de                	je     8010461c <startothers+0x32>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+8010463e:	e8 c9 f0 ff ff       	call   8010370c <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104643:	05 00 10 00 00       	add    $0x1000,%eax
+80104648:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void(**)(void))(code-8) = mpenter;
+8010464d:	c7 05 f8 6f 00 80 d1 	movl   $0x801046d1,0x80006ff8
+80104654:	46 10 80 
+    if (a < (void*) KERNBASE)
+80104657:	b8 00 e0 10 80       	mov    $0x8010e000,%eax
+8010465c:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80104661:	76 ac                	jbe    8010460f <startothers+0x25>
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80104663:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+8010466a:	e0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+8010466d:	83 ec 08             	sub    $0x8,%esp
+80104670:	68 00 70 00 00       	push   $0x7000
+80104675:	0f b6 03             	movzbl (%ebx),%eax
+80104678:	50                   	push   %eax
+80104679:	e8 4e f5 ff ff       	call   80103bcc <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+8010467e:	83 c4 10             	add    $0x10,%esp
+80104681:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80104687:	85 c0                	test   %eax,%eax
+80104689:	74 f6                	je     80104681 <startothers+0x97>
+8010468b:	eb 8f                	jmp    8010461c <startothers+0x32>
+      ;
+  }
+}
+8010468d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104690:	c9                   	leave
+80104691:	c3                   	ret
+
+80104692 <mpmain>:
+{
+80104692:	55                   	push   %ebp
+80104693:	89 e5                	mov    %esp,%ebp
+80104695:	53                   	push   %ebx
+80104696:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80104699:	e8 1f 13 00 00       	call   801059bd <cpuid>
+8010469e:	89 c3                	mov    %eax,%ebx
+801046a0:	e8 18 13 00 00       	call   801059bd <cpuid>
+801046a5:	83 ec 04             	sub    $0x4,%esp
+801046a8:	53                   	push   %ebx
+801046a9:	50                   	push   %eax
+801046aa:	68 5e b3 10 80       	push   $0x8010b35e
+801046af:	e8 45 c6 ff ff       	call   80100cf9 <cprintf>
+  idtinit();       // load idt register
+801046b4:	e8 8b 49 00 00       	call   80109044 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+801046b9:	e8 a3 12 00 00       	call   80105961 <mycpu>
+801046be:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+801046c0:	b8 01 00 00 00       	mov    $0x1,%eax
+801046c5:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+801046cc:	e8 ce 19 00 00       	call   8010609f <scheduler>
+
+801046d1 <mpenter>:
+{
+801046d1:	55                   	push   %ebp
+801046d2:	89 e5                	mov    %esp,%ebp
+801046d4:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+801046d7:	e8 86 5b 00 00       	call   8010a262 <switchkvm>
+  seginit();
+801046dc:	e8 d1 58 00 00       	call   80109fb2 <seginit>
+  lapicinit();
+801046e1:	e8 a2 f3 ff ff       	call   80103a88 <lapicinit>
+  mpmain();
+801046e6:	e8 a7 ff ff ff       	call   80104692 <mpmain>
+
+801046eb <main>:
+{
+801046eb:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+801046ef:	83 e4 f0             	and    $0xfffffff0,%esp
+801046f2:	ff 71 fc             	push   -0x4(%ecx)
+801046f5:	55                   	push   %ebp
+801046f6:	89 e5                	mov    %esp,%ebp
+801046f8:	51                   	push   %ecx
+801046f9:	83 ec 0c             	sub    $0xc,%esp
+  kinit1(end, P2V(EARLYMEM)); // phys page allocator
+801046fc:	68 00 00 00 81       	push   $0x81000000
+80104701:	68 50 a1 19 80       	push   $0x8019a150
+80104706:	e8 9d ef ff ff       	call   801036a8 <kinit1>
+  kvmalloc();      // kernel page table
+8010470b:	e8 77 5b 00 00       	call   8010a287 <kvmalloc>
+  mpinit();        // detect other processors
+80104710:	e8 e0 01 00 00       	call   801048f5 <mpinit>
+  lapicinit();     // interrupt controller
+80104715:	e8 6e f3 ff ff       	call   80103a88 <lapicinit>
+  seginit();       // segment descriptors
+8010471a:	e8 93 58 00 00       	call   80109fb2 <seginit>
+  picinit();       // disable pic
+8010471f:	e8 fc 07 00 00       	call   80104f20 <picinit>
+  ioapicinit();    // another interrupt controller
+80104724:	e8 85 eb ff ff       	call   801032ae <ioapicinit>
+  consoleinit();   // console hardware
+80104729:	e8 4e c8 ff ff       	call   80100f7c <consoleinit>
+  uartinit();      // serial port
+8010472e:	e8 ee 4b 00 00       	call   80109321 <uartinit>
+  pinit();         // process table
+80104733:	e8 88 11 00 00       	call   801058c0 <pinit>
+  tvinit();        // trap vectors
+80104738:	e8 02 48 00 00       	call   80108f3f <tvinit>
+  pcinit();        // executable page cache
+8010473d:	e8 12 03 00 00       	call   80104a54 <pcinit>
+  fileinit();      // file table
+80104742:	e8 bb cd ff ff       	call   80101502 <fileinit>
+  ideinit();       // disk 
+80104747:	e8 07 e8 ff ff       	call   80102f53 <ideinit>
+  startothers();   // start other processors
+8010474c:	e8 99 fe ff ff       	call   801045ea <startothers>
+  kinit2(P2V(EARLYMEM), P2V(PHYSTOP)); // must come after startothers()
+80104751:	83 c4 08             	add    $0x8,%esp
+80104754:	68 00 00 00 8e       	push   $0x8e000000
+80104759:	68 00 00 00 81       	push   $0x81000000
+8010475e:	e8 89 ef ff ff       	call   801036ec <kinit2>
+  binit();         // buffer cache, sized from memory
+80104763:	e8 38 bc ff ff       	call   801003a0 <binit>
+  userinit();      // first user process
+80104768:	e8 b5 12 00 00       	call   80105a22 <userinit>
+  mpmain();        // finish this processor's setup
+8010476d:	e8 20 ff ff ff       	call   80104692 <mpmain>
+
+80104772 <sum>:
+int ncpu;
+uchar ioapicid;
+
+static uchar
+sum(uchar *addr, int len)
+{
+80104772:	55                   	push   %ebp
+80104773:	89 e5                	mov    %esp,%ebp
+80104775:	56                   	push   %esi
+80104776:	53                   	push   %ebx
+80104777:	89 c6                	mov    %eax,%esi
+  int i, sum;
+
+  sum = 0;
+80104779:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i=0; i<len; i++)
+8010477e:	b9 00 00 00 00       	mov    $0x0,%ecx
+80104783:	eb 09                	jmp    8010478e <sum+0x1c>
+    sum += addr[i];
+80104785:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+80104789:	01 d8                	add    %ebx,%eax
+  for(i=0; i<len; i++)
+8010478b:	83 c1 01             	add    $0x1,%ecx
+8010478e:	39 d1                	cmp    %edx,%ecx
+80104790:	7c f3                	jl     80104785 <sum+0x13>
+  return sum;
+}
+80104792:	5b                   	pop    %ebx
+80104793:	5e                   	pop    %esi
+80104794:	5d                   	pop    %ebp
+80104795:	c3                   	ret
+
+80104796 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80104796:	55                   	push   %ebp
+80104797:	89 e5                	mov    %esp,%ebp
+80104799:	56                   	push   %esi
+8010479a:	53                   	push   %ebx
+}
+
+// Convert physical address to kernel virtual address
+static inline void *P2V(uint a) {
+    extern void panic(char*) __attribute__((noreturn));
+    if (a > KERNBASE)
+8010479b:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+801047a0:	77 0b                	ja     801047ad <mpsearch1+0x17>
+        panic("P2V on address > KERNBASE");
+    return (char*)a + KERNBASE;
+801047a2:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+  e = addr+len;
+801047a8:	8d 34 13             	lea    (%ebx,%edx,1),%esi
+  for(p = addr; p < e; p += sizeof(struct mp))
+801047ab:	eb 10                	jmp    801047bd <mpsearch1+0x27>
+        panic("P2V on address > KERNBASE");
+801047ad:	83 ec 0c             	sub    $0xc,%esp
+801047b0:	68 72 b3 10 80       	push   $0x8010b372
+801047b5:	e8 48 c1 ff ff       	call   80100902 <panic>
+801047ba:	83 c3 10             	add    $0x10,%ebx
+801047bd:	39 f3                	cmp    %esi,%ebx
+801047bf:	73 29                	jae    801047ea <mpsearch1+0x54>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801047c1:	83 ec 04             	sub    $0x4,%esp
+801047c4:	6a 04                	push   $0x4
+801047c6:	68 8c b3 10 80       	push   $0x8010b38c
+801047cb:	53                   	push   %ebx
+801047cc:	e8 69 35 00 00       	call   80107d3a <memcmp>
+801047d1:	83 c4 10             	add    $0x10,%esp
+801047d4:	85 c0                	test   %eax,%eax
+801047d6:	75 e2                	jne    801047ba <mpsearch1+0x24>
+801047d8:	ba 10 00 00 00       	mov    $0x10,%edx
+801047dd:	89 d8                	mov    %ebx,%eax
+801047df:	e8 8e ff ff ff       	call   80104772 <sum>
+801047e4:	84 c0                	test   %al,%al
+801047e6:	75 d2                	jne    801047ba <mpsearch1+0x24>
+801047e8:	eb 05                	jmp    801047ef <mpsearch1+0x59>
+      return (struct mp*)p;
+  return 0;
+801047ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+801047ef:	89 d8                	mov    %ebx,%eax
+801047f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801047f4:	5b                   	pop    %ebx
+801047f5:	5e                   	pop    %esi
+801047f6:	5d                   	pop    %ebp
+801047f7:	c3                   	ret
+
+801047f8 <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct mp*
+mpsearch(void)
+{
+801047f8:	55                   	push   %ebp
+801047f9:	89 e5                	mov    %esp,%ebp
+801047fb:	83 ec 08             	sub    $0x8,%esp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+801047fe:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104805:	c1 e0 08             	shl    $0x8,%eax
+80104808:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+8010480f:	09 d0                	or     %edx,%eax
+80104811:	c1 e0 04             	shl    $0x4,%eax
+80104814:	74 1f                	je     80104835 <mpsearch+0x3d>
+    if((mp = mpsearch1(p, 1024)))
+80104816:	ba 00 04 00 00       	mov    $0x400,%edx
+8010481b:	e8 76 ff ff ff       	call   80104796 <mpsearch1>
+80104820:	85 c0                	test   %eax,%eax
+80104822:	75 0f                	jne    80104833 <mpsearch+0x3b>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+    if((mp = mpsearch1(p-1024, 1024)))
+      return mp;
+  }
+  return mpsearch1(0xF0000, 0x10000);
+80104824:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104829:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+8010482e:	e8 63 ff ff ff       	call   80104796 <mpsearch1>
+}
+80104833:	c9                   	leave
+80104834:	c3                   	ret
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104835:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+8010483c:	c1 e0 08             	shl    $0x8,%eax
+8010483f:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80104846:	09 d0                	or     %edx,%eax
+80104848:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+8010484b:	2d 00 04 00 00       	sub    $0x400,%eax
+80104850:	ba 00 04 00 00       	mov    $0x400,%edx
+80104855:	e8 3c ff ff ff       	call   80104796 <mpsearch1>
+8010485a:	85 c0                	test   %eax,%eax
+8010485c:	75 d5                	jne    80104833 <mpsearch+0x3b>
+8010485e:	eb c4                	jmp    80104824 <mpsearch+0x2c>
+
+80104860 <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+80104860:	55                   	push   %ebp
+80104861:	89 e5                	mov    %esp,%ebp
+80104863:	57                   	push   %edi
+80104864:	56                   	push   %esi
+80104865:	53                   	push   %ebx
+80104866:	83 ec 0c             	sub    $0xc,%esp
+80104869:	89 c7                	mov    %eax,%edi
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+8010486b:	e8 88 ff ff ff       	call   801047f8 <mpsearch>
+80104870:	89 c6                	mov    %eax,%esi
+80104872:	85 c0                	test   %eax,%eax
+80104874:	74 66                	je     801048dc <mpconfig+0x7c>
+80104876:	8b 58 04             	mov    0x4(%eax),%ebx
+80104879:	85 db                	test   %ebx,%ebx
+8010487b:	74 48                	je     801048c5 <mpconfig+0x65>
+    if (a > KERNBASE)
+8010487d:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+80104883:	77 4a                	ja     801048cf <mpconfig+0x6f>
+    return (char*)a + KERNBASE;
+80104885:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+    return 0;
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010488b:	83 ec 04             	sub    $0x4,%esp
+8010488e:	6a 04                	push   $0x4
+80104890:	68 91 b3 10 80       	push   $0x8010b391
+80104895:	53                   	push   %ebx
+80104896:	e8 9f 34 00 00       	call   80107d3a <memcmp>
+8010489b:	83 c4 10             	add    $0x10,%esp
+8010489e:	85 c0                	test   %eax,%eax
+801048a0:	75 3e                	jne    801048e0 <mpconfig+0x80>
+    return 0;
+  if(conf->version != 1 && conf->version != 4)
+801048a2:	0f b6 43 06          	movzbl 0x6(%ebx),%eax
+801048a6:	3c 01                	cmp    $0x1,%al
+801048a8:	0f 95 c2             	setne  %dl
+801048ab:	3c 04                	cmp    $0x4,%al
+801048ad:	0f 95 c0             	setne  %al
+801048b0:	84 c2                	test   %al,%dl
+801048b2:	75 33                	jne    801048e7 <mpconfig+0x87>
+    return 0;
+  if(sum((uchar*)conf, conf->length) != 0)
+801048b4:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+801048b8:	89 d8                	mov    %ebx,%eax
+801048ba:	e8 b3 fe ff ff       	call   80104772 <sum>
+801048bf:	84 c0                	test   %al,%al
+801048c1:	75 2b                	jne    801048ee <mpconfig+0x8e>
+    return 0;
+  *pmp = mp;
+801048c3:	89 37                	mov    %esi,(%edi)
+  return conf;
+}
+801048c5:	89 d8                	mov    %ebx,%eax
+801048c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801048ca:	5b                   	pop    %ebx
+801048cb:	5e                   	pop    %esi
+801048cc:	5f                   	pop    %edi
+801048cd:	5d                   	pop    %ebp
+801048ce:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+801048cf:	83 ec 0c             	sub    $0xc,%esp
+801048d2:	68 72 b3 10 80       	push   $0x8010b372
+801048d7:	e8 26 c0 ff ff       	call   80100902 <panic>
+    return 0;
+801048dc:	89 c3                	mov    %eax,%ebx
+801048de:	eb e5                	jmp    801048c5 <mpconfig+0x65>
+    return 0;
+801048e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+801048e5:	eb de                	jmp    801048c5 <mpconfig+0x65>
+    return 0;
+801048e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+801048ec:	eb d7                	jmp    801048c5 <mpconfig+0x65>
+    return 0;
+801048ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+801048f3:	eb d0                	jmp    801048c5 <mpconfig+0x65>
+
+801048f5 <mpinit>:
+
+void
+mpinit(void)
+{
+801048f5:	55                   	push   %ebp
+801048f6:	89 e5                	mov    %esp,%ebp
+801048f8:	57                   	push   %edi
+801048f9:	56                   	push   %esi
+801048fa:	53                   	push   %ebx
+801048fb:	83 ec 1c             	sub    $0x1c,%esp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+801048fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80104901:	e8 5a ff ff ff       	call   80104860 <mpconfig>
+80104906:	85 c0                	test   %eax,%eax
+80104908:	74 19                	je     80104923 <mpinit+0x2e>
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+8010490a:	8b 50 24             	mov    0x24(%eax),%edx
+8010490d:	89 15 94 19 14 80    	mov    %edx,0x80141994
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104913:	8d 50 2c             	lea    0x2c(%eax),%edx
+80104916:	0f b7 48 04          	movzwl 0x4(%eax),%ecx
+8010491a:	01 c1                	add    %eax,%ecx
+  ismp = 1;
+8010491c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104921:	eb 20                	jmp    80104943 <mpinit+0x4e>
+    panic("Expect to run on an SMP");
+80104923:	83 ec 0c             	sub    $0xc,%esp
+80104926:	68 96 b3 10 80       	push   $0x8010b396
+8010492b:	e8 d2 bf ff ff       	call   80100902 <panic>
+    switch(*p){
+80104930:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104935:	eb 0c                	jmp    80104943 <mpinit+0x4e>
+80104937:	83 e8 03             	sub    $0x3,%eax
+8010493a:	3c 01                	cmp    $0x1,%al
+8010493c:	76 1a                	jbe    80104958 <mpinit+0x63>
+8010493e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104943:	39 ca                	cmp    %ecx,%edx
+80104945:	73 4d                	jae    80104994 <mpinit+0x9f>
+    switch(*p){
+80104947:	0f b6 02             	movzbl (%edx),%eax
+8010494a:	3c 02                	cmp    $0x2,%al
+8010494c:	74 38                	je     80104986 <mpinit+0x91>
+8010494e:	77 e7                	ja     80104937 <mpinit+0x42>
+80104950:	84 c0                	test   %al,%al
+80104952:	74 09                	je     8010495d <mpinit+0x68>
+80104954:	3c 01                	cmp    $0x1,%al
+80104956:	75 d8                	jne    80104930 <mpinit+0x3b>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80104958:	83 c2 08             	add    $0x8,%edx
+      continue;
+8010495b:	eb e6                	jmp    80104943 <mpinit+0x4e>
+      if(ncpu < NCPU) {
+8010495d:	8b 35 84 62 14 80    	mov    0x80146284,%esi
+80104963:	83 fe 07             	cmp    $0x7,%esi
+80104966:	7f 19                	jg     80104981 <mpinit+0x8c>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104968:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+8010496c:	69 fe b0 00 00 00    	imul   $0xb0,%esi,%edi
+80104972:	88 87 a0 62 14 80    	mov    %al,-0x7feb9d60(%edi)
+        ncpu++;
+80104978:	83 c6 01             	add    $0x1,%esi
+8010497b:	89 35 84 62 14 80    	mov    %esi,0x80146284
+      p += sizeof(struct mpproc);
+80104981:	83 c2 14             	add    $0x14,%edx
+      continue;
+80104984:	eb bd                	jmp    80104943 <mpinit+0x4e>
+      ioapicid = ioapic->apicno;
+80104986:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+8010498a:	a2 80 62 14 80       	mov    %al,0x80146280
+      p += sizeof(struct mpioapic);
+8010498f:	83 c2 08             	add    $0x8,%edx
+      continue;
+80104992:	eb af                	jmp    80104943 <mpinit+0x4e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80104994:	85 db                	test   %ebx,%ebx
+80104996:	74 26                	je     801049be <mpinit+0xc9>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80104998:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010499b:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+8010499f:	74 15                	je     801049b6 <mpinit+0xc1>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049a1:	b8 70 00 00 00       	mov    $0x70,%eax
+801049a6:	ba 22 00 00 00       	mov    $0x22,%edx
+801049ab:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801049ac:	ba 23 00 00 00       	mov    $0x23,%edx
+801049b1:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+801049b2:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049b5:	ee                   	out    %al,(%dx)
+  }
+}
+801049b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801049b9:	5b                   	pop    %ebx
+801049ba:	5e                   	pop    %esi
+801049bb:	5f                   	pop    %edi
+801049bc:	5d                   	pop    %ebp
+801049bd:	c3                   	ret
+    panic("Didn't find a suitable machine");
+801049be:	83 ec 0c             	sub    $0xc,%esp
+801049c1:	68 b0 b3 10 80       	push   $0x8010b3b0
+801049c6:	e8 37 bf ff ff       	call   80100902 <panic>
+
+801049cb <pcslot>:
+  initlock(&pcache.lock, "pcache");
+}
+
+static struct pcentry*
+pcslot(uint dev, uint inum, uint off)
+{
+801049cb:	55                   	push   %ebp
+801049cc:	89 e5                	mov    %esp,%ebp
+801049ce:	53                   	push   %ebx
+801049cf:	89 c3                	mov    %eax,%ebx
+  return &pcache.e[(dev * 31 + inum * 131 + off / PGSIZE) & (NPCACHE-1)];
+801049d1:	c1 e0 05             	shl    $0x5,%eax
+801049d4:	29 d8                	sub    %ebx,%eax
+801049d6:	69 d2 83 00 00 00    	imul   $0x83,%edx,%edx
+801049dc:	01 d0                	add    %edx,%eax
+801049de:	c1 e9 0c             	shr    $0xc,%ecx
+801049e1:	01 c8                	add    %ecx,%eax
+801049e3:	0f b6 c0             	movzbl %al,%eax
+801049e6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801049e9:	8d 04 85 70 69 14 80 	lea    -0x7feb9690(,%eax,4),%eax
+}
+801049f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801049f3:	c9                   	leave
+801049f4:	c3                   	ret
+
+801049f5 <pcfile>:
+
+static uint*
+pcfile(uint dev, uint inum)
+{
+801049f5:	89 d1                	mov    %edx,%ecx
+  return &pcache.nfile[(dev * 31 + inum) & (NPCFILE-1)];
+801049f7:	89 c2                	mov    %eax,%edx
+801049f9:	c1 e2 05             	shl    $0x5,%edx
+801049fc:	29 c2                	sub    %eax,%edx
+801049fe:	01 ca                	add    %ecx,%edx
+80104a00:	83 e2 3f             	and    $0x3f,%edx
+80104a03:	8d 04 95 70 68 14 80 	lea    -0x7feb9790(,%edx,4),%eax
+}
+80104a0a:	c3                   	ret
+
+80104a0b <pcmatch>:
+
+static int
+pcmatch(struct pcentry *e, uint dev, uint inum, uint off, uint n)
+{
+  return e->page && e->dev == dev && e->inum == inum && e->off == off && e->n == n;
+80104a0b:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+80104a0f:	74 36                	je     80104a47 <pcmatch+0x3c>
+80104a11:	39 10                	cmp    %edx,(%eax)
+80104a13:	74 06                	je     80104a1b <pcmatch+0x10>
+80104a15:	b8 00 00 00 00       	mov    $0x0,%eax
+80104a1a:	c3                   	ret
+80104a1b:	39 48 04             	cmp    %ecx,0x4(%eax)
+80104a1e:	74 06                	je     80104a26 <pcmatch+0x1b>
+80104a20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104a25:	c3                   	ret
+{
+80104a26:	55                   	push   %ebp
+80104a27:	89 e5                	mov    %esp,%ebp
+  return e->page && e->dev == dev && e->inum == inum && e->off == off && e->n == n;
+80104a29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80104a2c:	39 48 08             	cmp    %ecx,0x8(%eax)
+80104a2f:	74 07                	je     80104a38 <pcmatch+0x2d>
+80104a31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104a36:	5d                   	pop    %ebp
+80104a37:	c3                   	ret
+  return e->page && e->dev == dev && e->inum == inum && e->off == off && e->n == n;
+80104a38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104a3b:	39 48 0c             	cmp    %ecx,0xc(%eax)
+80104a3e:	74 0d                	je     80104a4d <pcmatch+0x42>
+80104a40:	b8 00 00 00 00       	mov    $0x0,%eax
+80104a45:	eb ef                	jmp    80104a36 <pcmatch+0x2b>
+80104a47:	b8 00 00 00 00       	mov    $0x0,%eax
+80104a4c:	c3                   	ret
+80104a4d:	b8 01 00 00 00       	mov    $0x1,%eax
+80104a52:	eb e2                	jmp    80104a36 <pcmatch+0x2b>
+
+80104a54 <pcinit>:
+{
+80104a54:	55                   	push   %ebp
+80104a55:	89 e5                	mov    %esp,%ebp
+80104a57:	83 ec 10             	sub    $0x10,%esp
+  initlock(&pcache.lock, "pcache");
+80104a5a:	68 cf b3 10 80       	push   $0x8010b3cf
+80104a5f:	68 20 68 14 80       	push   $0x80146820
+80104a64:	e8 69 30 00 00       	call   80107ad2 <initlock>
+}
+80104a69:	83 c4 10             	add    $0x10,%esp
+80104a6c:	c9                   	leave
+80104a6d:	c3                   	ret
+
+80104a6e <pcget>:
+
+// Return a page holding n bytes of ip at off, with a reference
+// for the caller, or 0 on error. Must not be called with ip locked.
+char*
+pcget(struct inode *ip, uint off, uint n)
+{
+80104a6e:	55                   	push   %ebp
+80104a6f:	89 e5                	mov    %esp,%ebp
+80104a71:	57                   	push   %edi
+80104a72:	56                   	push   %esi
+80104a73:	53                   	push   %ebx
+80104a74:	83 ec 1c             	sub    $0x1c,%esp
+80104a77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct pcentry *e;
+  char *mem;
+  uint gen;
+
+  if(n > PGSIZE)
+80104a7a:	81 7d 10 00 10 00 00 	cmpl   $0x1000,0x10(%ebp)
+80104a81:	0f 87 df 00 00 00    	ja     80104b66 <pcget+0xf8>
+    panic("pcget");
+
+  acquire(&pcache.lock);
+80104a87:	83 ec 0c             	sub    $0xc,%esp
+80104a8a:	68 20 68 14 80       	push   $0x80146820
+80104a8f:	e8 89 31 00 00       	call   80107c1d <acquire>
+  e = pcslot(ip->dev, ip->inum, off);
+80104a94:	8b 7b 04             	mov    0x4(%ebx),%edi
+80104a97:	8b 33                	mov    (%ebx),%esi
+80104a99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104a9c:	89 fa                	mov    %edi,%edx
+80104a9e:	89 f0                	mov    %esi,%eax
+80104aa0:	e8 26 ff ff ff       	call   801049cb <pcslot>
+80104aa5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pcmatch(e, ip->dev, ip->inum, off, n)){
+80104aa8:	83 c4 08             	add    $0x8,%esp
+80104aab:	ff 75 10             	push   0x10(%ebp)
+80104aae:	ff 75 0c             	push   0xc(%ebp)
+80104ab1:	89 f9                	mov    %edi,%ecx
+80104ab3:	89 f2                	mov    %esi,%edx
+80104ab5:	e8 51 ff ff ff       	call   80104a0b <pcmatch>
+80104aba:	83 c4 10             	add    $0x10,%esp
+80104abd:	85 c0                	test   %eax,%eax
+80104abf:	0f 85 ae 00 00 00    	jne    80104b73 <pcget+0x105>
+    kref(e->page);
+    release(&pcache.lock);
+    return e->page;
+  }
+  gen = pcache.gen;
+80104ac5:	8b 3d 6c 68 14 80    	mov    0x8014686c,%edi
+  release(&pcache.lock);
+80104acb:	83 ec 0c             	sub    $0xc,%esp
+80104ace:	68 20 68 14 80       	push   $0x80146820
+80104ad3:	e8 c4 31 00 00       	call   80107c9c <release>
+
+  if((mem = kalloc_zeroed()) == 0)
+80104ad8:	e8 94 ed ff ff       	call   80103871 <kalloc_zeroed>
+80104add:	89 c6                	mov    %eax,%esi
+80104adf:	83 c4 10             	add    $0x10,%esp
+80104ae2:	85 c0                	test   %eax,%eax
+80104ae4:	0f 84 a9 00 00 00    	je     80104b93 <pcget+0x125>
+    return 0;
+  ilock(ip);
+80104aea:	83 ec 0c             	sub    $0xc,%esp
+80104aed:	53                   	push   %ebx
+80104aee:	e8 ca d6 ff ff       	call   801021bd <ilock>
+  ip->pcached = 1;
+80104af3:	c7 83 cc 00 00 00 01 	movl   $0x1,0xcc(%ebx)
+80104afa:	00 00 00 
+  if(readi(ip, mem, off, n) != n){
+80104afd:	ff 75 10             	push   0x10(%ebp)
+80104b00:	ff 75 0c             	push   0xc(%ebp)
+80104b03:	56                   	push   %esi
+80104b04:	53                   	push   %ebx
+80104b05:	e8 57 d9 ff ff       	call   80102461 <readi>
+80104b0a:	83 c4 20             	add    $0x20,%esp
+80104b0d:	3b 45 10             	cmp    0x10(%ebp),%eax
+80104b10:	0f 85 87 00 00 00    	jne    80104b9d <pcget+0x12f>
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+  iunlock(ip);
+80104b16:	83 ec 0c             	sub    $0xc,%esp
+80104b19:	53                   	push   %ebx
+80104b1a:	e8 81 d7 ff ff       	call   801022a0 <iunlock>
+
+  acquire(&pcache.lock);
+80104b1f:	c7 04 24 20 68 14 80 	movl   $0x80146820,(%esp)
+80104b26:	e8 f2 30 00 00       	call   80107c1d <acquire>
+  if(pcmatch(e, ip->dev, ip->inum, off, n)){
+80104b2b:	8b 4b 04             	mov    0x4(%ebx),%ecx
+80104b2e:	8b 13                	mov    (%ebx),%edx
+80104b30:	83 c4 08             	add    $0x8,%esp
+80104b33:	ff 75 10             	push   0x10(%ebp)
+80104b36:	ff 75 0c             	push   0xc(%ebp)
+80104b39:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104b3c:	e8 ca fe ff ff       	call   80104a0b <pcmatch>
+80104b41:	83 c4 10             	add    $0x10,%esp
+80104b44:	85 c0                	test   %eax,%eax
+80104b46:	75 70                	jne    80104bb8 <pcget+0x14a>
+    kref(e->page);
+    release(&pcache.lock);
+    kfree(mem);
+    return e->page;
+  }
+  if(gen == pcache.gen){
+80104b48:	39 3d 6c 68 14 80    	cmp    %edi,0x8014686c
+80104b4e:	0f 84 8e 00 00 00    	je     80104be2 <pcget+0x174>
+    e->off = off;
+    e->n = n;
+    e->page = mem;
+    kref(mem);
+  }
+  release(&pcache.lock);
+80104b54:	83 ec 0c             	sub    $0xc,%esp
+80104b57:	68 20 68 14 80       	push   $0x80146820
+80104b5c:	e8 3b 31 00 00       	call   80107c9c <release>
+  return mem;
+80104b61:	83 c4 10             	add    $0x10,%esp
+80104b64:	eb 2d                	jmp    80104b93 <pcget+0x125>
+    panic("pcget");
+80104b66:	83 ec 0c             	sub    $0xc,%esp
+80104b69:	68 d6 b3 10 80       	push   $0x8010b3d6
+80104b6e:	e8 8f bd ff ff       	call   80100902 <panic>
+    kref(e->page);
+80104b73:	83 ec 0c             	sub    $0xc,%esp
+80104b76:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104b79:	ff 77 10             	push   0x10(%edi)
+80104b7c:	e8 2b e9 ff ff       	call   801034ac <kref>
+    release(&pcache.lock);
+80104b81:	c7 04 24 20 68 14 80 	movl   $0x80146820,(%esp)
+80104b88:	e8 0f 31 00 00       	call   80107c9c <release>
+    return e->page;
+80104b8d:	8b 77 10             	mov    0x10(%edi),%esi
+80104b90:	83 c4 10             	add    $0x10,%esp
+}
+80104b93:	89 f0                	mov    %esi,%eax
+80104b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104b98:	5b                   	pop    %ebx
+80104b99:	5e                   	pop    %esi
+80104b9a:	5f                   	pop    %edi
+80104b9b:	5d                   	pop    %ebp
+80104b9c:	c3                   	ret
+    iunlock(ip);
+80104b9d:	83 ec 0c             	sub    $0xc,%esp
+80104ba0:	53                   	push   %ebx
+80104ba1:	e8 fa d6 ff ff       	call   801022a0 <iunlock>
+    kfree(mem);
+80104ba6:	89 34 24             	mov    %esi,(%esp)
+80104ba9:	e8 86 e9 ff ff       	call   80103534 <kfree>
+    return 0;
+80104bae:	83 c4 10             	add    $0x10,%esp
+80104bb1:	be 00 00 00 00       	mov    $0x0,%esi
+80104bb6:	eb db                	jmp    80104b93 <pcget+0x125>
+    kref(e->page);
+80104bb8:	83 ec 0c             	sub    $0xc,%esp
+80104bbb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104bbe:	ff 77 10             	push   0x10(%edi)
+80104bc1:	e8 e6 e8 ff ff       	call   801034ac <kref>
+    release(&pcache.lock);
+80104bc6:	c7 04 24 20 68 14 80 	movl   $0x80146820,(%esp)
+80104bcd:	e8 ca 30 00 00       	call   80107c9c <release>
+    kfree(mem);
+80104bd2:	89 34 24             	mov    %esi,(%esp)
+80104bd5:	e8 5a e9 ff ff       	call   80103534 <kfree>
+    return e->page;
+80104bda:	8b 77 10             	mov    0x10(%edi),%esi
+80104bdd:	83 c4 10             	add    $0x10,%esp
+80104be0:	eb b1                	jmp    80104b93 <pcget+0x125>
+    if(e->page){
+80104be2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104be5:	8b 47 10             	mov    0x10(%edi),%eax
+80104be8:	85 c0                	test   %eax,%eax
+80104bea:	74 1d                	je     80104c09 <pcget+0x19b>
+      kfree(e->page);
+80104bec:	83 ec 0c             	sub    $0xc,%esp
+80104bef:	50                   	push   %eax
+80104bf0:	e8 3f e9 ff ff       	call   80103534 <kfree>
+      (*pcfile(e->dev, e->inum))--;
+80104bf5:	8b 57 04             	mov    0x4(%edi),%edx
+80104bf8:	8b 07                	mov    (%edi),%eax
+80104bfa:	e8 f6 fd ff ff       	call   801049f5 <pcfile>
+80104bff:	8b 10                	mov    (%eax),%edx
+80104c01:	83 ea 01             	sub    $0x1,%edx
+80104c04:	89 10                	mov    %edx,(%eax)
+80104c06:	83 c4 10             	add    $0x10,%esp
+    (*pcfile(ip->dev, ip->inum))++;
+80104c09:	8b 53 04             	mov    0x4(%ebx),%edx
+80104c0c:	8b 03                	mov    (%ebx),%eax
+80104c0e:	e8 e2 fd ff ff       	call   801049f5 <pcfile>
+80104c13:	8b 10                	mov    (%eax),%edx
+80104c15:	83 c2 01             	add    $0x1,%edx
+80104c18:	89 10                	mov    %edx,(%eax)
+    e->dev = ip->dev;
+80104c1a:	8b 03                	mov    (%ebx),%eax
+80104c1c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80104c1f:	89 01                	mov    %eax,(%ecx)
+    e->inum = ip->inum;
+80104c21:	8b 43 04             	mov    0x4(%ebx),%eax
+80104c24:	89 41 04             	mov    %eax,0x4(%ecx)
+    e->off = off;
+80104c27:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104c2a:	89 41 08             	mov    %eax,0x8(%ecx)
+    e->n = n;
+80104c2d:	8b 45 10             	mov    0x10(%ebp),%eax
+80104c30:	89 41 0c             	mov    %eax,0xc(%ecx)
+    e->page = mem;
+80104c33:	89 71 10             	mov    %esi,0x10(%ecx)
+    kref(mem);
+80104c36:	83 ec 0c             	sub    $0xc,%esp
+80104c39:	56                   	push   %esi
+80104c3a:	e8 6d e8 ff ff       	call   801034ac <kref>
+80104c3f:	83 c4 10             	add    $0x10,%esp
+80104c42:	e9 0d ff ff ff       	jmp    80104b54 <pcget+0xe6>
+
+80104c47 <pcinval>:
+
+// Drop every cached page of ip, which must be locked.
+// Processes that have the pages mapped keep their own references.
+void
+pcinval(struct inode *ip)
+{
+80104c47:	55                   	push   %ebp
+80104c48:	89 e5                	mov    %esp,%ebp
+80104c4a:	56                   	push   %esi
+80104c4b:	53                   	push   %ebx
+80104c4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+80104c4f:	83 ec 0c             	sub    $0xc,%esp
+80104c52:	68 20 68 14 80       	push   $0x80146820
+80104c57:	e8 c1 2f 00 00       	call   80107c1d <acquire>
+  pcache.gen++;
+80104c5c:	a1 6c 68 14 80       	mov    0x8014686c,%eax
+80104c61:	83 c0 01             	add    $0x1,%eax
+80104c64:	a3 6c 68 14 80       	mov    %eax,0x8014686c
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80104c69:	83 c4 10             	add    $0x10,%esp
+80104c6c:	bb 70 69 14 80       	mov    $0x80146970,%ebx
+80104c71:	eb 03                	jmp    80104c76 <pcinval+0x2f>
+80104c73:	83 c3 14             	add    $0x14,%ebx
+80104c76:	81 fb 70 7d 14 80    	cmp    $0x80147d70,%ebx
+80104c7c:	73 3b                	jae    80104cb9 <pcinval+0x72>
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+80104c7e:	8b 43 10             	mov    0x10(%ebx),%eax
+80104c81:	85 c0                	test   %eax,%eax
+80104c83:	74 ee                	je     80104c73 <pcinval+0x2c>
+80104c85:	8b 0e                	mov    (%esi),%ecx
+80104c87:	39 0b                	cmp    %ecx,(%ebx)
+80104c89:	75 e8                	jne    80104c73 <pcinval+0x2c>
+80104c8b:	8b 56 04             	mov    0x4(%esi),%edx
+80104c8e:	39 53 04             	cmp    %edx,0x4(%ebx)
+80104c91:	75 e0                	jne    80104c73 <pcinval+0x2c>
+      kfree(e->page);
+80104c93:	83 ec 0c             	sub    $0xc,%esp
+80104c96:	50                   	push   %eax
+80104c97:	e8 98 e8 ff ff       	call   80103534 <kfree>
+      e->page = 0;
+80104c9c:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+      (*pcfile(ip->dev, ip->inum))--;
+80104ca3:	8b 56 04             	mov    0x4(%esi),%edx
+80104ca6:	8b 06                	mov    (%esi),%eax
+80104ca8:	e8 48 fd ff ff       	call   801049f5 <pcfile>
+80104cad:	8b 10                	mov    (%eax),%edx
+80104caf:	83 ea 01             	sub    $0x1,%edx
+80104cb2:	89 10                	mov    %edx,(%eax)
+80104cb4:	83 c4 10             	add    $0x10,%esp
+80104cb7:	eb ba                	jmp    80104c73 <pcinval+0x2c>
+    }
+  }
+  release(&pcache.lock);
+80104cb9:	83 ec 0c             	sub    $0xc,%esp
+80104cbc:	68 20 68 14 80       	push   $0x80146820
+80104cc1:	e8 d6 2f 00 00       	call   80107c9c <release>
+  ip->pcached = 0;
+80104cc6:	c7 86 cc 00 00 00 00 	movl   $0x0,0xcc(%esi)
+80104ccd:	00 00 00 
+}
+80104cd0:	83 c4 10             	add    $0x10,%esp
+80104cd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104cd6:	5b                   	pop    %ebx
+80104cd7:	5e                   	pop    %esi
+80104cd8:	5d                   	pop    %ebp
+80104cd9:	c3                   	ret
+
+80104cda <pcmaybe>:
+
+// Might ip have pages in the cache? Used by ilock
+// when it reads the inode from disk.
+int
+pcmaybe(struct inode *ip)
+{
+80104cda:	55                   	push   %ebp
+80104cdb:	89 e5                	mov    %esp,%ebp
+80104cdd:	53                   	push   %ebx
+80104cde:	83 ec 10             	sub    $0x10,%esp
+80104ce1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  acquire(&pcache.lock);
+80104ce4:	68 20 68 14 80       	push   $0x80146820
+80104ce9:	e8 2f 2f 00 00       	call   80107c1d <acquire>
+  r = *pcfile(ip->dev, ip->inum) != 0;
+80104cee:	8b 53 04             	mov    0x4(%ebx),%edx
+80104cf1:	8b 03                	mov    (%ebx),%eax
+80104cf3:	e8 fd fc ff ff       	call   801049f5 <pcfile>
+80104cf8:	83 38 00             	cmpl   $0x0,(%eax)
+80104cfb:	0f 95 c3             	setne  %bl
+80104cfe:	0f b6 db             	movzbl %bl,%ebx
+  release(&pcache.lock);
+80104d01:	c7 04 24 20 68 14 80 	movl   $0x80146820,(%esp)
+80104d08:	e8 8f 2f 00 00       	call   80107c9c <release>
+  return r;
+}
+80104d0d:	89 d8                	mov    %ebx,%eax
+80104d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104d12:	c9                   	leave
+80104d13:	c3                   	ret
+
+80104d14 <confread>:
+#define PCI_CMD_MEM     0x2
+#define PCI_CMD_MASTER  0x4
+
+static uint
+confread(int bus, int dev, int func, int off)
+{
+80104d14:	55                   	push   %ebp
+80104d15:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xfc));
+80104d17:	c1 e0 10             	shl    $0x10,%eax
+80104d1a:	c1 e2 0b             	shl    $0xb,%edx
+80104d1d:	c1 e1 08             	shl    $0x8,%ecx
+80104d20:	09 d0                	or     %edx,%eax
+80104d22:	09 c8                	or     %ecx,%eax
+80104d24:	8b 55 08             	mov    0x8(%ebp),%edx
+80104d27:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104d2d:	09 d0                	or     %edx,%eax
+80104d2f:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d34:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104d39:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104d3a:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104d3f:	ed                   	in     (%dx),%eax
+  return inl(PCI_CONFDATA);
+}
+80104d40:	5d                   	pop    %ebp
+80104d41:	c3                   	ret
+
+80104d42 <confwrite>:
+
+static void
+confwrite(int bus, int dev, int func, int off, uint v)
+{
+80104d42:	55                   	push   %ebp
+80104d43:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xfc));
+80104d45:	c1 e0 10             	shl    $0x10,%eax
+80104d48:	c1 e2 0b             	shl    $0xb,%edx
+80104d4b:	c1 e1 08             	shl    $0x8,%ecx
+80104d4e:	09 d0                	or     %edx,%eax
+80104d50:	09 c8                	or     %ecx,%eax
+80104d52:	8b 55 08             	mov    0x8(%ebp),%edx
+80104d55:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104d5b:	09 d0                	or     %edx,%eax
+80104d5d:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d62:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104d67:	ef                   	out    %eax,(%dx)
+80104d68:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104d6b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104d70:	ef                   	out    %eax,(%dx)
+  outl(PCI_CONFDATA, v);
+}
+80104d71:	5d                   	pop    %ebp
+80104d72:	c3                   	ret
+
+80104d73 <pcifind>:
+// Find the first function on bus 0 that matches vendor, device,
+// class and subclass, any of which may be PCI_ANY. Returns 0 and
+// fills in *d, or -1 if there is none.
+int
+pcifind(int vendor, int device, int class, int subclass, struct pcidev *d)
+{
+80104d73:	55                   	push   %ebp
+80104d74:	89 e5                	mov    %esp,%ebp
+80104d76:	57                   	push   %edi
+80104d77:	56                   	push   %esi
+80104d78:	53                   	push   %ebx
+80104d79:	83 ec 1c             	sub    $0x1c,%esp
+  int dev, func, nfunc;
+  uint id, cl;
+
+  for(dev = 0; dev < 32; dev++){
+80104d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+80104d81:	89 c6                	mov    %eax,%esi
+80104d83:	83 fe 1f             	cmp    $0x1f,%esi
+80104d86:	0f 8f 21 01 00 00    	jg     80104ead <pcifind+0x13a>
+    nfunc = confread(0, dev, 0, PCI_HDRTYPE) & 0x800000 ? 8 : 1;
+80104d8c:	83 ec 0c             	sub    $0xc,%esp
+80104d8f:	6a 0c                	push   $0xc
+80104d91:	b9 00 00 00 00       	mov    $0x0,%ecx
+80104d96:	89 f2                	mov    %esi,%edx
+80104d98:	b8 00 00 00 00       	mov    $0x0,%eax
+80104d9d:	e8 72 ff ff ff       	call   80104d14 <confread>
+80104da2:	83 c4 10             	add    $0x10,%esp
+80104da5:	a9 00 00 80 00       	test   $0x800000,%eax
+80104daa:	74 0e                	je     80104dba <pcifind+0x47>
+80104dac:	c7 45 e0 08 00 00 00 	movl   $0x8,-0x20(%ebp)
+    for(func = 0; func < nfunc; func++){
+80104db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104db8:	eb 0c                	jmp    80104dc6 <pcifind+0x53>
+    nfunc = confread(0, dev, 0, PCI_HDRTYPE) & 0x800000 ? 8 : 1;
+80104dba:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+80104dc1:	eb f0                	jmp    80104db3 <pcifind+0x40>
+    for(func = 0; func < nfunc; func++){
+80104dc3:	83 c3 01             	add    $0x1,%ebx
+80104dc6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104dc9:	39 c3                	cmp    %eax,%ebx
+80104dcb:	0f 8d d4 00 00 00    	jge    80104ea5 <pcifind+0x132>
+      id = confread(0, dev, func, PCI_ID);
+80104dd1:	83 ec 0c             	sub    $0xc,%esp
+80104dd4:	6a 00                	push   $0x0
+80104dd6:	89 d9                	mov    %ebx,%ecx
+80104dd8:	89 f2                	mov    %esi,%edx
+80104dda:	b8 00 00 00 00       	mov    $0x0,%eax
+80104ddf:	e8 30 ff ff ff       	call   80104d14 <confread>
+80104de4:	89 c7                	mov    %eax,%edi
+      if((id & 0xffff) == 0xffff)
+80104de6:	0f b7 c0             	movzwl %ax,%eax
+80104de9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104dec:	83 c4 10             	add    $0x10,%esp
+80104def:	66 83 ff ff          	cmp    $0xffff,%di
+80104df3:	74 ce                	je     80104dc3 <pcifind+0x50>
+        continue;
+      cl = confread(0, dev, func, PCI_CLASSREG);
+80104df5:	83 ec 0c             	sub    $0xc,%esp
+80104df8:	6a 08                	push   $0x8
+80104dfa:	89 d9                	mov    %ebx,%ecx
+80104dfc:	89 f2                	mov    %esi,%edx
+80104dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+80104e03:	e8 0c ff ff ff       	call   80104d14 <confread>
+      if((vendor != PCI_ANY && (id & 0xffff) != vendor) ||
+80104e08:	83 c4 10             	add    $0x10,%esp
+80104e0b:	83 7d 08 ff          	cmpl   $0xffffffff,0x8(%ebp)
+80104e0f:	74 08                	je     80104e19 <pcifind+0xa6>
+80104e11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80104e14:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+80104e17:	75 aa                	jne    80104dc3 <pcifind+0x50>
+80104e19:	83 7d 0c ff          	cmpl   $0xffffffff,0xc(%ebp)
+80104e1d:	74 0a                	je     80104e29 <pcifind+0xb6>
+         (device != PCI_ANY && (id >> 16) != device) ||
+80104e1f:	89 fa                	mov    %edi,%edx
+80104e21:	c1 ea 10             	shr    $0x10,%edx
+80104e24:	3b 55 0c             	cmp    0xc(%ebp),%edx
+80104e27:	75 9a                	jne    80104dc3 <pcifind+0x50>
+80104e29:	83 7d 10 ff          	cmpl   $0xffffffff,0x10(%ebp)
+80104e2d:	74 0a                	je     80104e39 <pcifind+0xc6>
+         (class != PCI_ANY && (cl >> 24) != class) ||
+80104e2f:	89 c2                	mov    %eax,%edx
+80104e31:	c1 ea 18             	shr    $0x18,%edx
+80104e34:	3b 55 10             	cmp    0x10(%ebp),%edx
+80104e37:	75 8a                	jne    80104dc3 <pcifind+0x50>
+80104e39:	83 7d 14 ff          	cmpl   $0xffffffff,0x14(%ebp)
+80104e3d:	74 11                	je     80104e50 <pcifind+0xdd>
+         (subclass != PCI_ANY && ((cl >> 16) & 0xff) != subclass))
+80104e3f:	89 c2                	mov    %eax,%edx
+80104e41:	c1 ea 10             	shr    $0x10,%edx
+80104e44:	0f b6 d2             	movzbl %dl,%edx
+80104e47:	3b 55 14             	cmp    0x14(%ebp),%edx
+80104e4a:	0f 85 73 ff ff ff    	jne    80104dc3 <pcifind+0x50>
+        continue;
+      d->bus = 0;
+80104e50:	89 f1                	mov    %esi,%ecx
+80104e52:	89 c2                	mov    %eax,%edx
+80104e54:	8b 75 18             	mov    0x18(%ebp),%esi
+80104e57:	c6 06 00             	movb   $0x0,(%esi)
+      d->dev = dev;
+80104e5a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80104e5d:	88 4e 01             	mov    %cl,0x1(%esi)
+      d->func = func;
+80104e60:	88 5e 02             	mov    %bl,0x2(%esi)
+      d->vendor = id & 0xffff;
+80104e63:	66 89 7e 04          	mov    %di,0x4(%esi)
+      d->device = id >> 16;
+80104e67:	89 f8                	mov    %edi,%eax
+80104e69:	c1 e8 10             	shr    $0x10,%eax
+80104e6c:	66 89 46 06          	mov    %ax,0x6(%esi)
+      d->class = cl >> 24;
+80104e70:	89 d0                	mov    %edx,%eax
+80104e72:	c1 e8 18             	shr    $0x18,%eax
+80104e75:	88 46 08             	mov    %al,0x8(%esi)
+      d->subclass = (cl >> 16) & 0xff;
+80104e78:	c1 ea 10             	shr    $0x10,%edx
+80104e7b:	88 56 09             	mov    %dl,0x9(%esi)
+      d->irq = confread(0, dev, func, PCI_INTR) & 0xff;
+80104e7e:	83 ec 0c             	sub    $0xc,%esp
+80104e81:	6a 3c                	push   $0x3c
+80104e83:	89 d9                	mov    %ebx,%ecx
+80104e85:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80104e88:	b8 00 00 00 00       	mov    $0x0,%eax
+80104e8d:	e8 82 fe ff ff       	call   80104d14 <confread>
+80104e92:	88 46 0a             	mov    %al,0xa(%esi)
+      return 0;
+80104e95:	83 c4 10             	add    $0x10,%esp
+80104e98:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+  }
+  return -1;
+}
+80104e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104ea0:	5b                   	pop    %ebx
+80104ea1:	5e                   	pop    %esi
+80104ea2:	5f                   	pop    %edi
+80104ea3:	5d                   	pop    %ebp
+80104ea4:	c3                   	ret
+  for(dev = 0; dev < 32; dev++){
+80104ea5:	83 c6 01             	add    $0x1,%esi
+80104ea8:	e9 d6 fe ff ff       	jmp    80104d83 <pcifind+0x10>
+  return -1;
+80104ead:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104eb2:	eb e9                	jmp    80104e9d <pcifind+0x12a>
+
+80104eb4 <pcibar>:
+
+// Base address register n of d, with its type bits.
+uint
+pcibar(struct pcidev *d, int n)
+{
+80104eb4:	55                   	push   %ebp
+80104eb5:	89 e5                	mov    %esp,%ebp
+80104eb7:	53                   	push   %ebx
+80104eb8:	83 ec 10             	sub    $0x10,%esp
+80104ebb:	8b 45 08             	mov    0x8(%ebp),%eax
+  return confread(d->bus, d->dev, d->func, PCI_BAR0 + 4*n);
+80104ebe:	0f b6 48 02          	movzbl 0x2(%eax),%ecx
+80104ec2:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+80104ec6:	0f b6 00             	movzbl (%eax),%eax
+80104ec9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80104ecc:	8d 1c 9d 10 00 00 00 	lea    0x10(,%ebx,4),%ebx
+80104ed3:	53                   	push   %ebx
+80104ed4:	e8 3b fe ff ff       	call   80104d14 <confread>
+}
+80104ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104edc:	c9                   	leave
+80104edd:	c3                   	ret
+
+80104ede <pcienable>:
+
+// Let d decode its I/O and memory ranges and master the bus.
+void
+pcienable(struct pcidev *d)
+{
+80104ede:	55                   	push   %ebp
+80104edf:	89 e5                	mov    %esp,%ebp
+80104ee1:	53                   	push   %ebx
+80104ee2:	83 ec 10             	sub    $0x10,%esp
+80104ee5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint cmd;
+
+  cmd = confread(d->bus, d->dev, d->func, PCI_CMD);
+80104ee8:	0f b6 4b 02          	movzbl 0x2(%ebx),%ecx
+80104eec:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+80104ef0:	0f b6 03             	movzbl (%ebx),%eax
+80104ef3:	6a 04                	push   $0x4
+80104ef5:	e8 1a fe ff ff       	call   80104d14 <confread>
+  cmd |= PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER;
+  confwrite(d->bus, d->dev, d->func, PCI_CMD, cmd & 0xffff);
+80104efa:	0f b6 4b 02          	movzbl 0x2(%ebx),%ecx
+80104efe:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+80104f02:	0f b6 1b             	movzbl (%ebx),%ebx
+80104f05:	83 c4 08             	add    $0x8,%esp
+80104f08:	0f b7 c0             	movzwl %ax,%eax
+80104f0b:	83 c8 07             	or     $0x7,%eax
+80104f0e:	50                   	push   %eax
+80104f0f:	6a 04                	push   $0x4
+80104f11:	89 d8                	mov    %ebx,%eax
+80104f13:	e8 2a fe ff ff       	call   80104d42 <confwrite>
+}
+80104f18:	83 c4 10             	add    $0x10,%esp
+80104f1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104f1e:	c9                   	leave
+80104f1f:	c3                   	ret
+
+80104f20 <picinit>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104f20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f25:	ba 21 00 00 00       	mov    $0x21,%edx
+80104f2a:	ee                   	out    %al,(%dx)
+80104f2b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80104f30:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80104f31:	c3                   	ret
+
+80104f32 <pipealloc>:
+
+static struct slabcache pipecache = SLABCACHE("pipe", sizeof(struct pipe));
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80104f32:	55                   	push   %ebp
+80104f33:	89 e5                	mov    %esp,%ebp
+80104f35:	57                   	push   %edi
+80104f36:	56                   	push   %esi
+80104f37:	53                   	push   %ebx
+80104f38:	83 ec 0c             	sub    $0xc,%esp
+80104f3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104f3e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+80104f41:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80104f47:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80104f4d:	e8 ca c5 ff ff       	call   8010151c <filealloc>
+80104f52:	89 03                	mov    %eax,(%ebx)
+80104f54:	85 c0                	test   %eax,%eax
+80104f56:	0f 84 97 00 00 00    	je     80104ff3 <pipealloc+0xc1>
+80104f5c:	e8 bb c5 ff ff       	call   8010151c <filealloc>
+80104f61:	89 06                	mov    %eax,(%esi)
+80104f63:	85 c0                	test   %eax,%eax
+80104f65:	0f 84 88 00 00 00    	je     80104ff3 <pipealloc+0xc1>
+    goto bad;
+  if((p = slaballoc(&pipecache)) == 0)
+80104f6b:	83 ec 0c             	sub    $0xc,%esp
+80104f6e:	68 00 f0 10 80       	push   $0x8010f000
+80104f73:	e8 d7 28 00 00       	call   8010784f <slaballoc>
+80104f78:	89 c7                	mov    %eax,%edi
+80104f7a:	83 c4 10             	add    $0x10,%esp
+80104f7d:	85 c0                	test   %eax,%eax
+80104f7f:	74 72                	je     80104ff3 <pipealloc+0xc1>
+    goto bad;
+  p->readopen = 1;
+80104f81:	c7 80 54 02 00 00 01 	movl   $0x1,0x254(%eax)
+80104f88:	00 00 00 
+  p->writeopen = 1;
+80104f8b:	c7 80 58 02 00 00 01 	movl   $0x1,0x258(%eax)
+80104f92:	00 00 00 
+  p->nwrite = 0;
+80104f95:	c7 80 50 02 00 00 00 	movl   $0x0,0x250(%eax)
+80104f9c:	00 00 00 
+  p->nread = 0;
+80104f9f:	c7 80 4c 02 00 00 00 	movl   $0x0,0x24c(%eax)
+80104fa6:	00 00 00 
+  initlock(&p->lock, "pipe");
+80104fa9:	83 ec 08             	sub    $0x8,%esp
+80104fac:	68 dc b3 10 80       	push   $0x8010b3dc
+80104fb1:	50                   	push   %eax
+80104fb2:	e8 1b 2b 00 00       	call   80107ad2 <initlock>
+  (*f0)->type = FD_PIPE;
+80104fb7:	8b 03                	mov    (%ebx),%eax
+80104fb9:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80104fbf:	8b 03                	mov    (%ebx),%eax
+80104fc1:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+80104fc5:	8b 03                	mov    (%ebx),%eax
+80104fc7:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80104fcb:	8b 03                	mov    (%ebx),%eax
+80104fcd:	89 78 0c             	mov    %edi,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80104fd0:	8b 06                	mov    (%esi),%eax
+80104fd2:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80104fd8:	8b 06                	mov    (%esi),%eax
+80104fda:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80104fde:	8b 06                	mov    (%esi),%eax
+80104fe0:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80104fe4:	8b 06                	mov    (%esi),%eax
+80104fe6:	89 78 0c             	mov    %edi,0xc(%eax)
+  return 0;
+80104fe9:	83 c4 10             	add    $0x10,%esp
+80104fec:	b8 00 00 00 00       	mov    $0x0,%eax
+80104ff1:	eb 29                	jmp    8010501c <pipealloc+0xea>
+
+//PAGEBREAK: 20
+ bad:
+  if(p)
+    slabfree(&pipecache, p);
+  if(*f0)
+80104ff3:	8b 03                	mov    (%ebx),%eax
+80104ff5:	85 c0                	test   %eax,%eax
+80104ff7:	74 0c                	je     80105005 <pipealloc+0xd3>
+    fileclose(*f0);
+80104ff9:	83 ec 0c             	sub    $0xc,%esp
+80104ffc:	50                   	push   %eax
+80104ffd:	e8 97 c5 ff ff       	call   80101599 <fileclose>
+80105002:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80105005:	8b 06                	mov    (%esi),%eax
+80105007:	85 c0                	test   %eax,%eax
+80105009:	74 19                	je     80105024 <pipealloc+0xf2>
+    fileclose(*f1);
+8010500b:	83 ec 0c             	sub    $0xc,%esp
+8010500e:	50                   	push   %eax
+8010500f:	e8 85 c5 ff ff       	call   80101599 <fileclose>
+80105014:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105017:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010501c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010501f:	5b                   	pop    %ebx
+80105020:	5e                   	pop    %esi
+80105021:	5f                   	pop    %edi
+80105022:	5d                   	pop    %ebp
+80105023:	c3                   	ret
+  return -1;
+80105024:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105029:	eb f1                	jmp    8010501c <pipealloc+0xea>
+
+8010502b <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+8010502b:	55                   	push   %ebp
+8010502c:	89 e5                	mov    %esp,%ebp
+8010502e:	53                   	push   %ebx
+8010502f:	83 ec 10             	sub    $0x10,%esp
+80105032:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80105035:	53                   	push   %ebx
+80105036:	e8 e2 2b 00 00       	call   80107c1d <acquire>
+  if(writable){
+8010503b:	83 c4 10             	add    $0x10,%esp
+8010503e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80105042:	74 3f                	je     80105083 <pipeclose+0x58>
+    p->writeopen = 0;
+80105044:	c7 83 58 02 00 00 00 	movl   $0x0,0x258(%ebx)
+8010504b:	00 00 00 
+    wakeup(&p->nread);
+8010504e:	8d 83 4c 02 00 00    	lea    0x24c(%ebx),%eax
+80105054:	83 ec 0c             	sub    $0xc,%esp
+80105057:	50                   	push   %eax
+80105058:	e8 6f 16 00 00       	call   801066cc <wakeup>
+8010505d:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80105060:	83 bb 54 02 00 00 00 	cmpl   $0x0,0x254(%ebx)
+80105067:	75 09                	jne    80105072 <pipeclose+0x47>
+80105069:	83 bb 58 02 00 00 00 	cmpl   $0x0,0x258(%ebx)
+80105070:	74 2f                	je     801050a1 <pipeclose+0x76>
+    release(&p->lock);
+    slabfree(&pipecache, p);
+  } else
+    release(&p->lock);
+80105072:	83 ec 0c             	sub    $0xc,%esp
+80105075:	53                   	push   %ebx
+80105076:	e8 21 2c 00 00       	call   80107c9c <release>
+8010507b:	83 c4 10             	add    $0x10,%esp
+}
+8010507e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105081:	c9                   	leave
+80105082:	c3                   	ret
+    p->readopen = 0;
+80105083:	c7 83 54 02 00 00 00 	movl   $0x0,0x254(%ebx)
+8010508a:	00 00 00 
+    wakeup(&p->nwrite);
+8010508d:	8d 83 50 02 00 00    	lea    0x250(%ebx),%eax
+80105093:	83 ec 0c             	sub    $0xc,%esp
+80105096:	50                   	push   %eax
+80105097:	e8 30 16 00 00       	call   801066cc <wakeup>
+8010509c:	83 c4 10             	add    $0x10,%esp
+8010509f:	eb bf                	jmp    80105060 <pipeclose+0x35>
+    release(&p->lock);
+801050a1:	83 ec 0c             	sub    $0xc,%esp
+801050a4:	53                   	push   %ebx
+801050a5:	e8 f2 2b 00 00       	call   80107c9c <release>
+    slabfree(&pipecache, p);
+801050aa:	83 c4 08             	add    $0x8,%esp
+801050ad:	53                   	push   %ebx
+801050ae:	68 00 f0 10 80       	push   $0x8010f000
+801050b3:	e8 63 28 00 00       	call   8010791b <slabfree>
+801050b8:	83 c4 10             	add    $0x10,%esp
+801050bb:	eb c1                	jmp    8010507e <pipeclose+0x53>
+
+801050bd <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801050bd:	55                   	push   %ebp
+801050be:	89 e5                	mov    %esp,%ebp
+801050c0:	57                   	push   %edi
+801050c1:	56                   	push   %esi
+801050c2:	53                   	push   %ebx
+801050c3:	83 ec 18             	sub    $0x18,%esp
+801050c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801050c9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  acquire(&p->lock);
+801050cc:	53                   	push   %ebx
+801050cd:	e8 4b 2b 00 00       	call   80107c1d <acquire>
+  for(i = 0; i < n; i++){
+801050d2:	83 c4 10             	add    $0x10,%esp
+801050d5:	bf 00 00 00 00       	mov    $0x0,%edi
+801050da:	39 f7                	cmp    %esi,%edi
+801050dc:	7c 40                	jl     8010511e <pipewrite+0x61>
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+    }
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801050de:	8d 83 4c 02 00 00    	lea    0x24c(%ebx),%eax
+801050e4:	83 ec 0c             	sub    $0xc,%esp
+801050e7:	50                   	push   %eax
+801050e8:	e8 df 15 00 00       	call   801066cc <wakeup>
+  release(&p->lock);
+801050ed:	89 1c 24             	mov    %ebx,(%esp)
+801050f0:	e8 a7 2b 00 00       	call   80107c9c <release>
+  return n;
+801050f5:	83 c4 10             	add    $0x10,%esp
+801050f8:	89 f0                	mov    %esi,%eax
+801050fa:	eb 5c                	jmp    80105158 <pipewrite+0x9b>
+      wakeup(&p->nread);
+801050fc:	8d 83 4c 02 00 00    	lea    0x24c(%ebx),%eax
+80105102:	83 ec 0c             	sub    $0xc,%esp
+80105105:	50                   	push   %eax
+80105106:	e8 c1 15 00 00       	call   801066cc <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+8010510b:	8d 83 50 02 00 00    	lea    0x250(%ebx),%eax
+80105111:	83 c4 08             	add    $0x8,%esp
+80105114:	53                   	push   %ebx
+80105115:	50                   	push   %eax
+80105116:	e8 5c 14 00 00       	call   80106577 <sleep>
+8010511b:	83 c4 10             	add    $0x10,%esp
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010511e:	8b 93 50 02 00 00    	mov    0x250(%ebx),%edx
+80105124:	8b 83 4c 02 00 00    	mov    0x24c(%ebx),%eax
+8010512a:	05 00 02 00 00       	add    $0x200,%eax
+8010512f:	39 c2                	cmp    %eax,%edx
+80105131:	75 2d                	jne    80105160 <pipewrite+0xa3>
+      if(p->readopen == 0 || myproc()->killed){
+80105133:	83 bb 54 02 00 00 00 	cmpl   $0x0,0x254(%ebx)
+8010513a:	74 0b                	je     80105147 <pipewrite+0x8a>
+8010513c:	e8 97 08 00 00       	call   801059d8 <myproc>
+80105141:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80105145:	74 b5                	je     801050fc <pipewrite+0x3f>
+        release(&p->lock);
+80105147:	83 ec 0c             	sub    $0xc,%esp
+8010514a:	53                   	push   %ebx
+8010514b:	e8 4c 2b 00 00       	call   80107c9c <release>
+        return -1;
+80105150:	83 c4 10             	add    $0x10,%esp
+80105153:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010515b:	5b                   	pop    %ebx
+8010515c:	5e                   	pop    %esi
+8010515d:	5f                   	pop    %edi
+8010515e:	5d                   	pop    %ebp
+8010515f:	c3                   	ret
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80105160:	8d 42 01             	lea    0x1(%edx),%eax
+80105163:	89 83 50 02 00 00    	mov    %eax,0x250(%ebx)
+80105169:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+8010516f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105172:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+80105176:	88 44 13 4c          	mov    %al,0x4c(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+8010517a:	83 c7 01             	add    $0x1,%edi
+8010517d:	e9 58 ff ff ff       	jmp    801050da <pipewrite+0x1d>
+
+80105182 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105182:	55                   	push   %ebp
+80105183:	89 e5                	mov    %esp,%ebp
+80105185:	57                   	push   %edi
+80105186:	56                   	push   %esi
+80105187:	53                   	push   %ebx
+80105188:	83 ec 18             	sub    $0x18,%esp
+8010518b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010518e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+80105191:	53                   	push   %ebx
+80105192:	e8 86 2a 00 00       	call   80107c1d <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105197:	83 c4 10             	add    $0x10,%esp
+8010519a:	eb 13                	jmp    801051af <piperead+0x2d>
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+8010519c:	8d 83 4c 02 00 00    	lea    0x24c(%ebx),%eax
+801051a2:	83 ec 08             	sub    $0x8,%esp
+801051a5:	53                   	push   %ebx
+801051a6:	50                   	push   %eax
+801051a7:	e8 cb 13 00 00       	call   80106577 <sleep>
+801051ac:	83 c4 10             	add    $0x10,%esp
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801051af:	8b 83 50 02 00 00    	mov    0x250(%ebx),%eax
+801051b5:	39 83 4c 02 00 00    	cmp    %eax,0x24c(%ebx)
+801051bb:	75 7a                	jne    80105237 <piperead+0xb5>
+801051bd:	8b b3 58 02 00 00    	mov    0x258(%ebx),%esi
+801051c3:	85 f6                	test   %esi,%esi
+801051c5:	74 3a                	je     80105201 <piperead+0x7f>
+    if(myproc()->killed){
+801051c7:	e8 0c 08 00 00       	call   801059d8 <myproc>
+801051cc:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+801051d0:	74 ca                	je     8010519c <piperead+0x1a>
+      release(&p->lock);
+801051d2:	83 ec 0c             	sub    $0xc,%esp
+801051d5:	53                   	push   %ebx
+801051d6:	e8 c1 2a 00 00       	call   80107c9c <release>
+      return -1;
+801051db:	83 c4 10             	add    $0x10,%esp
+801051de:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801051e3:	eb 48                	jmp    8010522d <piperead+0xab>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+801051e5:	8d 50 01             	lea    0x1(%eax),%edx
+801051e8:	89 93 4c 02 00 00    	mov    %edx,0x24c(%ebx)
+801051ee:	25 ff 01 00 00       	and    $0x1ff,%eax
+801051f3:	0f b6 44 03 4c       	movzbl 0x4c(%ebx,%eax,1),%eax
+801051f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801051fb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+801051fe:	83 c6 01             	add    $0x1,%esi
+80105201:	39 fe                	cmp    %edi,%esi
+80105203:	7d 0e                	jge    80105213 <piperead+0x91>
+    if(p->nread == p->nwrite)
+80105205:	8b 83 4c 02 00 00    	mov    0x24c(%ebx),%eax
+8010520b:	3b 83 50 02 00 00    	cmp    0x250(%ebx),%eax
+80105211:	75 d2                	jne    801051e5 <piperead+0x63>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80105213:	8d 83 50 02 00 00    	lea    0x250(%ebx),%eax
+80105219:	83 ec 0c             	sub    $0xc,%esp
+8010521c:	50                   	push   %eax
+8010521d:	e8 aa 14 00 00       	call   801066cc <wakeup>
+  release(&p->lock);
+80105222:	89 1c 24             	mov    %ebx,(%esp)
+80105225:	e8 72 2a 00 00       	call   80107c9c <release>
+  return i;
+8010522a:	83 c4 10             	add    $0x10,%esp
+}
+8010522d:	89 f0                	mov    %esi,%eax
+8010522f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105232:	5b                   	pop    %ebx
+80105233:	5e                   	pop    %esi
+80105234:	5f                   	pop    %edi
+80105235:	5d                   	pop    %ebp
+80105236:	c3                   	ret
+80105237:	be 00 00 00 00       	mov    $0x0,%esi
+8010523c:	eb c3                	jmp    80105201 <piperead+0x7f>
+
+8010523e <rqcharge>:
+
+// Run queue operations, timed for schedstat.
+// The ptable lock must be held.
+static void
+rqcharge(uint64 t0)
+{
+8010523e:	89 c1                	mov    %eax,%ecx
+  sstat.rqops++;
+80105240:	a1 0c 7f 14 80       	mov    0x80147f0c,%eax
+80105245:	83 c0 01             	add    $0x1,%eax
+80105248:	a3 0c 7f 14 80       	mov    %eax,0x80147f0c
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+8010524d:	0f 31                	rdtsc
+  sstat.rqcycles += rdtsc() - t0;
+8010524f:	29 c8                	sub    %ecx,%eax
+80105251:	01 05 10 7f 14 80    	add    %eax,0x80147f10
+}
+80105257:	c3                   	ret
+
+80105258 <rqremove>:
+  rqcharge(t0);
+}
+
+static void
+rqremove(struct proc *p)
+{
+80105258:	55                   	push   %ebp
+80105259:	89 e5                	mov    %esp,%ebp
+8010525b:	57                   	push   %edi
+8010525c:	56                   	push   %esi
+8010525d:	89 c1                	mov    %eax,%ecx
+8010525f:	0f 31                	rdtsc
+80105261:	89 c6                	mov    %eax,%esi
+80105263:	89 d7                	mov    %edx,%edi
+  uint64 t0 = rdtsc();
+
+  rq->remove(p);
+80105265:	a1 98 07 15 80       	mov    0x80150798,%eax
+8010526a:	8b 40 0c             	mov    0xc(%eax),%eax
+8010526d:	83 ec 0c             	sub    $0xc,%esp
+80105270:	51                   	push   %ecx
+80105271:	ff d0                	call   *%eax
+  rqcharge(t0);
+80105273:	89 f0                	mov    %esi,%eax
+80105275:	89 fa                	mov    %edi,%edx
+80105277:	e8 c2 ff ff ff       	call   8010523e <rqcharge>
+}
+8010527c:	83 c4 10             	add    $0x10,%esp
+8010527f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105282:	5e                   	pop    %esi
+80105283:	5f                   	pop    %edi
+80105284:	5d                   	pop    %ebp
+80105285:	c3                   	ret
+
+80105286 <rqpeekmin>:
+
+static struct proc*
+rqpeekmin(void)
+{
+80105286:	55                   	push   %ebp
+80105287:	89 e5                	mov    %esp,%ebp
+80105289:	57                   	push   %edi
+8010528a:	56                   	push   %esi
+8010528b:	53                   	push   %ebx
+8010528c:	83 ec 0c             	sub    $0xc,%esp
+8010528f:	0f 31                	rdtsc
+80105291:	89 c6                	mov    %eax,%esi
+80105293:	89 d7                	mov    %edx,%edi
+  uint64 t0 = rdtsc();
+  struct proc *p;
+
+  p = rq->peekmin();
+80105295:	a1 98 07 15 80       	mov    0x80150798,%eax
+8010529a:	ff 50 10             	call   *0x10(%eax)
+8010529d:	89 c3                	mov    %eax,%ebx
+  rqcharge(t0);
+8010529f:	89 f0                	mov    %esi,%eax
+801052a1:	89 fa                	mov    %edi,%edx
+801052a3:	e8 96 ff ff ff       	call   8010523e <rqcharge>
+  return p;
+}
+801052a8:	89 d8                	mov    %ebx,%eax
+801052aa:	83 c4 0c             	add    $0xc,%esp
+801052ad:	5b                   	pop    %ebx
+801052ae:	5e                   	pop    %esi
+801052af:	5f                   	pop    %edi
+801052b0:	5d                   	pop    %ebp
+801052b1:	c3                   	ret
+
+801052b2 <newdeadline>:
+
+// Give p a fresh virtual deadline: now plus its priority
+// ratio worth of quanta. Re-keys p if it is queued.
+static void
+newdeadline(struct proc *p)
+{
+801052b2:	55                   	push   %ebp
+801052b3:	89 e5                	mov    %esp,%ebp
+801052b5:	57                   	push   %edi
+801052b6:	56                   	push   %esi
+801052b7:	53                   	push   %ebx
+801052b8:	83 ec 0c             	sub    $0xc,%esp
+801052bb:	89 c3                	mov    %eax,%ebx
+  int deadline = ticks + PRIO_RATIO(p->niceness) * BFS_DEFAULT_QUANTUM;
+801052bd:	8b 40 7c             	mov    0x7c(%eax),%eax
+801052c0:	8d 48 15             	lea    0x15(%eax),%ecx
+801052c3:	6b c9 32             	imul   $0x32,%ecx,%ecx
+801052c6:	03 0d c0 88 19 80    	add    0x801988c0,%ecx
+  uint64 t0;
+
+  if(p->state == RUNNABLE){
+801052cc:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+801052d0:	74 0e                	je     801052e0 <newdeadline+0x2e>
+    t0 = rdtsc();
+    rq->update(p, deadline);
+    rqcharge(t0);
+  } else {
+    p->vdeadline = deadline;
+801052d2:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+  }
+}
+801052d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801052db:	5b                   	pop    %ebx
+801052dc:	5e                   	pop    %esi
+801052dd:	5f                   	pop    %edi
+801052de:	5d                   	pop    %ebp
+801052df:	c3                   	ret
+801052e0:	0f 31                	rdtsc
+801052e2:	89 c6                	mov    %eax,%esi
+801052e4:	89 d7                	mov    %edx,%edi
+    rq->update(p, deadline);
+801052e6:	a1 98 07 15 80       	mov    0x80150798,%eax
+801052eb:	8b 40 14             	mov    0x14(%eax),%eax
+801052ee:	83 ec 08             	sub    $0x8,%esp
+801052f1:	51                   	push   %ecx
+801052f2:	53                   	push   %ebx
+801052f3:	ff d0                	call   *%eax
+    rqcharge(t0);
+801052f5:	89 f0                	mov    %esi,%eax
+801052f7:	89 fa                	mov    %edi,%edx
+801052f9:	e8 40 ff ff ff       	call   8010523e <rqcharge>
+801052fe:	83 c4 10             	add    $0x10,%esp
+80105301:	eb d5                	jmp    801052d8 <newdeadline+0x26>
+
+80105303 <siblink>:
+// Parent's children and zombies lists.
+// The ptable lock must be held.
+static void
+siblink(struct proc **head, struct proc *p)
+{
+  p->sibprev = 0;
+80105303:	c7 82 c4 00 00 00 00 	movl   $0x0,0xc4(%edx)
+8010530a:	00 00 00 
+  p->sibnext = *head;
+8010530d:	8b 08                	mov    (%eax),%ecx
+8010530f:	89 8a c0 00 00 00    	mov    %ecx,0xc0(%edx)
+  if(*head)
+80105315:	85 c9                	test   %ecx,%ecx
+80105317:	74 06                	je     8010531f <siblink+0x1c>
+    (*head)->sibprev = p;
+80105319:	89 91 c4 00 00 00    	mov    %edx,0xc4(%ecx)
+  *head = p;
+8010531f:	89 10                	mov    %edx,(%eax)
+}
+80105321:	c3                   	ret
+
+80105322 <sibunlink>:
+
+static void
+sibunlink(struct proc **head, struct proc *p)
+{
+  if(p->sibprev)
+80105322:	8b 8a c4 00 00 00    	mov    0xc4(%edx),%ecx
+80105328:	85 c9                	test   %ecx,%ecx
+8010532a:	74 37                	je     80105363 <sibunlink+0x41>
+    p->sibprev->sibnext = p->sibnext;
+8010532c:	8b 82 c0 00 00 00    	mov    0xc0(%edx),%eax
+80105332:	89 81 c0 00 00 00    	mov    %eax,0xc0(%ecx)
+  else
+    *head = p->sibnext;
+  if(p->sibnext)
+80105338:	8b 82 c0 00 00 00    	mov    0xc0(%edx),%eax
+8010533e:	85 c0                	test   %eax,%eax
+80105340:	74 0c                	je     8010534e <sibunlink+0x2c>
+    p->sibnext->sibprev = p->sibprev;
+80105342:	8b 8a c4 00 00 00    	mov    0xc4(%edx),%ecx
+80105348:	89 88 c4 00 00 00    	mov    %ecx,0xc4(%eax)
+  p->sibnext = p->sibprev = 0;
+8010534e:	c7 82 c4 00 00 00 00 	movl   $0x0,0xc4(%edx)
+80105355:	00 00 00 
+80105358:	c7 82 c0 00 00 00 00 	movl   $0x0,0xc0(%edx)
+8010535f:	00 00 00 
+}
+80105362:	c3                   	ret
+    *head = p->sibnext;
+80105363:	8b 8a c0 00 00 00    	mov    0xc0(%edx),%ecx
+80105369:	89 08                	mov    %ecx,(%eax)
+8010536b:	eb cb                	jmp    80105338 <sibunlink+0x16>
+
+8010536d <chanlink>:
+// Sleep channel hash; p is linked while SLEEPING.
+// The ptable lock must be held.
+static void
+chanlink(struct proc *p)
+{
+  struct proc **head = &ptable.chanhash[CHANHASH(p->chan)];
+8010536d:	69 50 20 b1 79 37 9e 	imul   $0x9e3779b1,0x20(%eax),%edx
+80105374:	c1 ea 18             	shr    $0x18,%edx
+
+  p->chprev = 0;
+80105377:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+8010537e:	00 00 00 
+  p->chnext = *head;
+80105381:	8b 0c 95 98 03 15 80 	mov    -0x7feafc68(,%edx,4),%ecx
+80105388:	89 88 b0 00 00 00    	mov    %ecx,0xb0(%eax)
+  if(*head)
+8010538e:	85 c9                	test   %ecx,%ecx
+80105390:	74 06                	je     80105398 <chanlink+0x2b>
+    (*head)->chprev = p;
+80105392:	89 81 b4 00 00 00    	mov    %eax,0xb4(%ecx)
+  *head = p;
+80105398:	89 04 95 98 03 15 80 	mov    %eax,-0x7feafc68(,%edx,4)
+}
+8010539f:	c3                   	ret
+
+801053a0 <chanunlink>:
+
+static void
+chanunlink(struct proc *p)
+{
+  if(p->chprev)
+801053a0:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+801053a6:	85 d2                	test   %edx,%edx
+801053a8:	74 37                	je     801053e1 <chanunlink+0x41>
+    p->chprev->chnext = p->chnext;
+801053aa:	8b 88 b0 00 00 00    	mov    0xb0(%eax),%ecx
+801053b0:	89 8a b0 00 00 00    	mov    %ecx,0xb0(%edx)
+  else
+    ptable.chanhash[CHANHASH(p->chan)] = p->chnext;
+  if(p->chnext)
+801053b6:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+801053bc:	85 d2                	test   %edx,%edx
+801053be:	74 0c                	je     801053cc <chanunlink+0x2c>
+    p->chnext->chprev = p->chprev;
+801053c0:	8b 88 b4 00 00 00    	mov    0xb4(%eax),%ecx
+801053c6:	89 8a b4 00 00 00    	mov    %ecx,0xb4(%edx)
+  p->chnext = p->chprev = 0;
+801053cc:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+801053d3:	00 00 00 
+801053d6:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+801053dd:	00 00 00 
+}
+801053e0:	c3                   	ret
+    ptable.chanhash[CHANHASH(p->chan)] = p->chnext;
+801053e1:	69 50 20 b1 79 37 9e 	imul   $0x9e3779b1,0x20(%eax),%edx
+801053e8:	c1 ea 18             	shr    $0x18,%edx
+801053eb:	8b 88 b0 00 00 00    	mov    0xb0(%eax),%ecx
+801053f1:	89 0c 95 98 03 15 80 	mov    %ecx,-0x7feafc68(,%edx,4)
+801053f8:	eb bc                	jmp    801053b6 <chanunlink+0x16>
+
+801053fa <waitbound>:
+// now), every other runnable process can be picked at most once per
+// its own PRIO_RATIO quanta, plus the quantum it may already hold.
+// cnt[] holds the number of runnable processes per nice level.
+static int
+waitbound(struct proc *p, int *cnt)
+{
+801053fa:	55                   	push   %ebp
+801053fb:	89 e5                	mov    %esp,%ebp
+801053fd:	57                   	push   %edi
+801053fe:	56                   	push   %esi
+801053ff:	53                   	push   %ebx
+80105400:	83 ec 08             	sub    $0x8,%esp
+80105403:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  int l, n, span, bound;
+
+  span = PRIO_RATIO(p->niceness) * BFS_DEFAULT_QUANTUM;
+80105406:	8b 78 7c             	mov    0x7c(%eax),%edi
+80105409:	8d 47 15             	lea    0x15(%edi),%eax
+8010540c:	6b c0 32             	imul   $0x32,%eax,%eax
+8010540f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  bound = 0;
+80105412:	be 00 00 00 00       	mov    $0x0,%esi
+  for(l = 0; l < BFS_NICE_LEVELS; l++){
+80105417:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010541c:	eb 11                	jmp    8010542f <waitbound+0x35>
+    n = cnt[l];
+    if(l == p->niceness - BFS_NICE_FIRST_LEVEL)
+      n--;
+    bound += n * (span / PRIO_RATIO(l + BFS_NICE_FIRST_LEVEL) + BFS_DEFAULT_QUANTUM);
+8010541e:	83 c1 01             	add    $0x1,%ecx
+80105421:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80105424:	99                   	cltd
+80105425:	f7 f9                	idiv   %ecx
+80105427:	83 c0 32             	add    $0x32,%eax
+8010542a:	0f af c3             	imul   %ebx,%eax
+8010542d:	01 c6                	add    %eax,%esi
+  for(l = 0; l < BFS_NICE_LEVELS; l++){
+8010542f:	83 f9 27             	cmp    $0x27,%ecx
+80105432:	7f 12                	jg     80105446 <waitbound+0x4c>
+    n = cnt[l];
+80105434:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80105437:	8b 1c 88             	mov    (%eax,%ecx,4),%ebx
+    if(l == p->niceness - BFS_NICE_FIRST_LEVEL)
+8010543a:	8d 47 14             	lea    0x14(%edi),%eax
+8010543d:	39 c8                	cmp    %ecx,%eax
+8010543f:	75 dd                	jne    8010541e <waitbound+0x24>
+      n--;
+80105441:	83 eb 01             	sub    $0x1,%ebx
+80105444:	eb d8                	jmp    8010541e <waitbound+0x24>
+  }
+  return bound / ncpu + BFS_DEFAULT_QUANTUM + BFS_AUDIT_PERIOD;
+80105446:	89 f0                	mov    %esi,%eax
+80105448:	99                   	cltd
+80105449:	f7 3d 84 62 14 80    	idivl  0x80146284
+8010544f:	05 96 00 00 00       	add    $0x96,%eax
+}
+80105454:	83 c4 08             	add    $0x8,%esp
+80105457:	5b                   	pop    %ebx
+80105458:	5e                   	pop    %esi
+80105459:	5f                   	pop    %edi
+8010545a:	5d                   	pop    %ebp
+8010545b:	c3                   	ret
+
+8010545c <rqinsert>:
+{
+8010545c:	55                   	push   %ebp
+8010545d:	89 e5                	mov    %esp,%ebp
+8010545f:	57                   	push   %edi
+80105460:	56                   	push   %esi
+80105461:	89 c1                	mov    %eax,%ecx
+80105463:	0f 31                	rdtsc
+80105465:	89 c6                	mov    %eax,%esi
+80105467:	89 d7                	mov    %edx,%edi
+  if(rq->insert(p) < 0)
+80105469:	a1 98 07 15 80       	mov    0x80150798,%eax
+8010546e:	8b 40 08             	mov    0x8(%eax),%eax
+80105471:	83 ec 0c             	sub    $0xc,%esp
+80105474:	51                   	push   %ecx
+80105475:	ff d0                	call   *%eax
+80105477:	83 c4 10             	add    $0x10,%esp
+8010547a:	85 c0                	test   %eax,%eax
+8010547c:	78 10                	js     8010548e <rqinsert+0x32>
+  rqcharge(t0);
+8010547e:	89 f0                	mov    %esi,%eax
+80105480:	89 fa                	mov    %edi,%edx
+80105482:	e8 b7 fd ff ff       	call   8010523e <rqcharge>
+}
+80105487:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010548a:	5e                   	pop    %esi
+8010548b:	5f                   	pop    %edi
+8010548c:	5d                   	pop    %ebp
+8010548d:	c3                   	ret
+    panic("rqinsert");
+8010548e:	83 ec 0c             	sub    $0xc,%esp
+80105491:	68 e1 b3 10 80       	push   $0x8010b3e1
+80105496:	e8 67 b4 ff ff       	call   80100902 <panic>
+
+8010549b <setrunnable>:
+{
+8010549b:	55                   	push   %ebp
+8010549c:	89 e5                	mov    %esp,%ebp
+8010549e:	83 ec 08             	sub    $0x8,%esp
+  p->state = RUNNABLE;
+801054a1:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  p->readytick = ticks;
+801054a8:	8b 15 c0 88 19 80    	mov    0x801988c0,%edx
+801054ae:	89 90 8c 00 00 00    	mov    %edx,0x8c(%eax)
+  p->starved = 0;
+801054b4:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+801054bb:	00 00 00 
+  rqinsert(p);
+801054be:	e8 99 ff ff ff       	call   8010545c <rqinsert>
+}
+801054c3:	c9                   	leave
+801054c4:	c3                   	ret
+
+801054c5 <wakeup1>:
+//PAGEBREAK!
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+801054c5:	55                   	push   %ebp
+801054c6:	89 e5                	mov    %esp,%ebp
+801054c8:	57                   	push   %edi
+801054c9:	56                   	push   %esi
+801054ca:	53                   	push   %ebx
+801054cb:	83 ec 0c             	sub    $0xc,%esp
+801054ce:	89 c7                	mov    %eax,%edi
+  struct proc *p, *next;
+
+  for(p = ptable.chanhash[CHANHASH(chan)]; p; p = next){
+801054d0:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+801054d6:	c1 e8 18             	shr    $0x18,%eax
+801054d9:	8b 1c 85 98 03 15 80 	mov    -0x7feafc68(,%eax,4),%ebx
+801054e0:	eb 02                	jmp    801054e4 <wakeup1+0x1f>
+{
+801054e2:	89 f3                	mov    %esi,%ebx
+  for(p = ptable.chanhash[CHANHASH(chan)]; p; p = next){
+801054e4:	85 db                	test   %ebx,%ebx
+801054e6:	74 1b                	je     80105503 <wakeup1+0x3e>
+    next = p->chnext;
+801054e8:	8b b3 b0 00 00 00    	mov    0xb0(%ebx),%esi
+    if(p->chan == chan){
+801054ee:	39 7b 20             	cmp    %edi,0x20(%ebx)
+801054f1:	75 ef                	jne    801054e2 <wakeup1+0x1d>
+      chanunlink(p);
+801054f3:	89 d8                	mov    %ebx,%eax
+801054f5:	e8 a6 fe ff ff       	call   801053a0 <chanunlink>
+      setrunnable(p);
+801054fa:	89 d8                	mov    %ebx,%eax
+801054fc:	e8 9a ff ff ff       	call   8010549b <setrunnable>
+80105501:	eb df                	jmp    801054e2 <wakeup1+0x1d>
+    }
+  }
+}
+80105503:	83 c4 0c             	add    $0xc,%esp
+80105506:	5b                   	pop    %ebx
+80105507:	5e                   	pop    %esi
+80105508:	5f                   	pop    %edi
+80105509:	5d                   	pop    %ebp
+8010550a:	c3                   	ret
+
+8010550b <freeproc>:
+{
+8010550b:	55                   	push   %ebp
+8010550c:	89 e5                	mov    %esp,%ebp
+8010550e:	83 ec 08             	sub    $0x8,%esp
+80105511:	89 c2                	mov    %eax,%edx
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80105513:	0f b6 40 10          	movzbl 0x10(%eax),%eax
+80105517:	8d 0c 85 98 ff 14 80 	lea    -0x7feb0068(,%eax,4),%ecx
+8010551e:	eb 06                	jmp    80105526 <freeproc+0x1b>
+80105520:	8d 88 ac 00 00 00    	lea    0xac(%eax),%ecx
+80105526:	8b 01                	mov    (%ecx),%eax
+80105528:	39 d0                	cmp    %edx,%eax
+8010552a:	75 f4                	jne    80105520 <freeproc+0x15>
+  *pp = p->pidnext;
+8010552c:	8b 82 ac 00 00 00    	mov    0xac(%edx),%eax
+80105532:	89 01                	mov    %eax,(%ecx)
+  if(p->allprev)
+80105534:	8b 82 a8 00 00 00    	mov    0xa8(%edx),%eax
+8010553a:	85 c0                	test   %eax,%eax
+8010553c:	74 68                	je     801055a6 <freeproc+0x9b>
+    p->allprev->allnext = p->allnext;
+8010553e:	8b 8a a4 00 00 00    	mov    0xa4(%edx),%ecx
+80105544:	89 88 a4 00 00 00    	mov    %ecx,0xa4(%eax)
+  if(p->allnext)
+8010554a:	8b 82 a4 00 00 00    	mov    0xa4(%edx),%eax
+80105550:	85 c0                	test   %eax,%eax
+80105552:	74 0c                	je     80105560 <freeproc+0x55>
+    p->allnext->allprev = p->allprev;
+80105554:	8b 8a a8 00 00 00    	mov    0xa8(%edx),%ecx
+8010555a:	89 88 a8 00 00 00    	mov    %ecx,0xa8(%eax)
+  ptable.slot[p->slot] = 0;
+80105560:	8b 82 a0 00 00 00    	mov    0xa0(%edx),%eax
+80105566:	c7 04 85 8c 7f 14 80 	movl   $0x0,-0x7feb8074(,%eax,4)
+8010556d:	00 00 00 00 
+  ptable.freeslot[ptable.nfreeslot++] = p->slot;
+80105571:	a1 90 ff 14 80       	mov    0x8014ff90,%eax
+80105576:	8d 48 01             	lea    0x1(%eax),%ecx
+80105579:	89 0d 90 ff 14 80    	mov    %ecx,0x8014ff90
+8010557f:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+80105585:	89 0c 85 90 bf 14 80 	mov    %ecx,-0x7feb4070(,%eax,4)
+  p->state = UNUSED;
+8010558c:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+  slabfree(&proccache, p);
+80105593:	83 ec 08             	sub    $0x8,%esp
+80105596:	52                   	push   %edx
+80105597:	68 a0 f2 10 80       	push   $0x8010f2a0
+8010559c:	e8 7a 23 00 00       	call   8010791b <slabfree>
+}
+801055a1:	83 c4 10             	add    $0x10,%esp
+801055a4:	c9                   	leave
+801055a5:	c3                   	ret
+    ptable.all = p->allnext;
+801055a6:	8b 82 a4 00 00 00    	mov    0xa4(%edx),%eax
+801055ac:	a3 94 ff 14 80       	mov    %eax,0x8014ff94
+801055b1:	eb 97                	jmp    8010554a <freeproc+0x3f>
+
+801055b3 <allocproc>:
+{
+801055b3:	55                   	push   %ebp
+801055b4:	89 e5                	mov    %esp,%ebp
+801055b6:	56                   	push   %esi
+801055b7:	53                   	push   %ebx
+  acquire(&ptable.lock);
+801055b8:	83 ec 0c             	sub    $0xc,%esp
+801055bb:	68 40 7f 14 80       	push   $0x80147f40
+801055c0:	e8 58 26 00 00       	call   80107c1d <acquire>
+  if((ptable.nfreeslot == 0 && ptable.nslot == NPROC) ||
+801055c5:	83 c4 10             	add    $0x10,%esp
+801055c8:	83 3d 90 ff 14 80 00 	cmpl   $0x0,0x8014ff90
+801055cf:	75 10                	jne    801055e1 <allocproc+0x2e>
+801055d1:	81 3d 8c bf 14 80 00 	cmpl   $0x1000,0x8014bf8c
+801055d8:	10 00 00 
+801055db:	0f 84 21 01 00 00    	je     80105702 <allocproc+0x14f>
+     (p = slaballoc(&proccache)) == 0){
+801055e1:	83 ec 0c             	sub    $0xc,%esp
+801055e4:	68 a0 f2 10 80       	push   $0x8010f2a0
+801055e9:	e8 61 22 00 00       	call   8010784f <slaballoc>
+801055ee:	89 c3                	mov    %eax,%ebx
+  if((ptable.nfreeslot == 0 && ptable.nslot == NPROC) ||
+801055f0:	83 c4 10             	add    $0x10,%esp
+801055f3:	85 c0                	test   %eax,%eax
+801055f5:	0f 84 07 01 00 00    	je     80105702 <allocproc+0x14f>
+  memset(p, 0, sizeof(*p));
+801055fb:	83 ec 04             	sub    $0x4,%esp
+801055fe:	68 20 01 00 00       	push   $0x120
+80105603:	6a 00                	push   $0x0
+80105605:	50                   	push   %eax
+80105606:	e8 ec 26 00 00       	call   80107cf7 <memset>
+  if(ptable.nfreeslot > 0)
+8010560b:	a1 90 ff 14 80       	mov    0x8014ff90,%eax
+80105610:	83 c4 10             	add    $0x10,%esp
+80105613:	85 c0                	test   %eax,%eax
+80105615:	0f 8e fe 00 00 00    	jle    80105719 <allocproc+0x166>
+    p->slot = ptable.freeslot[--ptable.nfreeslot];
+8010561b:	8d 50 ff             	lea    -0x1(%eax),%edx
+8010561e:	89 15 90 ff 14 80    	mov    %edx,0x8014ff90
+80105624:	8b 04 85 8c bf 14 80 	mov    -0x7feb4074(,%eax,4),%eax
+8010562b:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+  ptable.slot[p->slot] = p;
+80105631:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80105637:	89 1c 85 8c 7f 14 80 	mov    %ebx,-0x7feb8074(,%eax,4)
+  p->state = EMBRYO;
+8010563e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->pid = nextpid++;
+80105645:	a1 84 f2 10 80       	mov    0x8010f284,%eax
+8010564a:	8d 50 01             	lea    0x1(%eax),%edx
+8010564d:	89 15 84 f2 10 80    	mov    %edx,0x8010f284
+80105653:	89 43 10             	mov    %eax,0x10(%ebx)
+  p->pidnext = ptable.pidhash[PIDHASH(p->pid)];
+80105656:	0f b6 c0             	movzbl %al,%eax
+80105659:	05 14 20 00 00       	add    $0x2014,%eax
+8010565e:	8b 14 85 48 7f 14 80 	mov    -0x7feb80b8(,%eax,4),%edx
+80105665:	89 93 ac 00 00 00    	mov    %edx,0xac(%ebx)
+  ptable.pidhash[PIDHASH(p->pid)] = p;
+8010566b:	89 1c 85 48 7f 14 80 	mov    %ebx,-0x7feb80b8(,%eax,4)
+  p->allprev = 0;
+80105672:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+80105679:	00 00 00 
+  p->allnext = ptable.all;
+8010567c:	a1 94 ff 14 80       	mov    0x8014ff94,%eax
+80105681:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+  if(ptable.all)
+80105687:	85 c0                	test   %eax,%eax
+80105689:	74 06                	je     80105691 <allocproc+0xde>
+    ptable.all->allprev = p;
+8010568b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+  ptable.all = p;
+80105691:	89 1d 94 ff 14 80    	mov    %ebx,0x8014ff94
+  release(&ptable.lock);
+80105697:	83 ec 0c             	sub    $0xc,%esp
+8010569a:	68 40 7f 14 80       	push   $0x80147f40
+8010569f:	e8 f8 25 00 00       	call   80107c9c <release>
+  if((p->kstack = kalloc()) == 0){
+801056a4:	e8 63 e0 ff ff       	call   8010370c <kalloc>
+801056a9:	89 c6                	mov    %eax,%esi
+801056ab:	89 43 08             	mov    %eax,0x8(%ebx)
+801056ae:	83 c4 10             	add    $0x10,%esp
+801056b1:	85 c0                	test   %eax,%eax
+801056b3:	74 7d                	je     80105732 <allocproc+0x17f>
+  sp -= sizeof *p->tf;
+801056b5:	8d 80 b4 0f 00 00    	lea    0xfb4(%eax),%eax
+  p->tf = (struct trapframe*)sp;
+801056bb:	89 43 18             	mov    %eax,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+801056be:	c7 86 b0 0f 00 00 34 	movl   $0x80108f34,0xfb0(%esi)
+801056c5:	8f 10 80 
+  sp -= sizeof *p->context;
+801056c8:	81 c6 9c 0f 00 00    	add    $0xf9c,%esi
+  p->context = (struct context*)sp;
+801056ce:	89 73 1c             	mov    %esi,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801056d1:	83 ec 04             	sub    $0x4,%esp
+801056d4:	6a 14                	push   $0x14
+801056d6:	6a 00                	push   $0x0
+801056d8:	56                   	push   %esi
+801056d9:	e8 19 26 00 00       	call   80107cf7 <memset>
+  p->context->eip = (uint)forkret;
+801056de:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801056e1:	c7 40 10 7d 58 10 80 	movl   $0x8010587d,0x10(%eax)
+  p->niceness = 0;
+801056e8:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  newdeadline(p);
+801056ef:	89 d8                	mov    %ebx,%eax
+801056f1:	e8 bc fb ff ff       	call   801052b2 <newdeadline>
+  return p;
+801056f6:	83 c4 10             	add    $0x10,%esp
+}
+801056f9:	89 d8                	mov    %ebx,%eax
+801056fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801056fe:	5b                   	pop    %ebx
+801056ff:	5e                   	pop    %esi
+80105700:	5d                   	pop    %ebp
+80105701:	c3                   	ret
+    release(&ptable.lock);
+80105702:	83 ec 0c             	sub    $0xc,%esp
+80105705:	68 40 7f 14 80       	push   $0x80147f40
+8010570a:	e8 8d 25 00 00       	call   80107c9c <release>
+    return 0;
+8010570f:	83 c4 10             	add    $0x10,%esp
+80105712:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105717:	eb e0                	jmp    801056f9 <allocproc+0x146>
+    p->slot = ptable.nslot++;
+80105719:	a1 8c bf 14 80       	mov    0x8014bf8c,%eax
+8010571e:	8d 50 01             	lea    0x1(%eax),%edx
+80105721:	89 15 8c bf 14 80    	mov    %edx,0x8014bf8c
+80105727:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+8010572d:	e9 ff fe ff ff       	jmp    80105631 <allocproc+0x7e>
+    acquire(&ptable.lock);
+80105732:	83 ec 0c             	sub    $0xc,%esp
+80105735:	68 40 7f 14 80       	push   $0x80147f40
+8010573a:	e8 de 24 00 00       	call   80107c1d <acquire>
+    freeproc(p);
+8010573f:	89 d8                	mov    %ebx,%eax
+80105741:	e8 c5 fd ff ff       	call   8010550b <freeproc>
+    release(&ptable.lock);
+80105746:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+8010574d:	e8 4a 25 00 00       	call   80107c9c <release>
+    return 0;
+80105752:	83 c4 10             	add    $0x10,%esp
+80105755:	89 f3                	mov    %esi,%ebx
+80105757:	eb a0                	jmp    801056f9 <allocproc+0x146>
+
+80105759 <schedaudit>:
+{
+80105759:	55                   	push   %ebp
+8010575a:	89 e5                	mov    %esp,%ebp
+8010575c:	56                   	push   %esi
+8010575d:	53                   	push   %ebx
+8010575e:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  acquire(&ptable.lock);
+80105764:	68 40 7f 14 80       	push   $0x80147f40
+80105769:	e8 af 24 00 00       	call   80107c1d <acquire>
+  memset(cnt, 0, sizeof(cnt));
+8010576e:	83 c4 0c             	add    $0xc,%esp
+80105771:	68 a0 00 00 00       	push   $0xa0
+80105776:	6a 00                	push   $0x0
+80105778:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+8010577e:	50                   	push   %eax
+8010577f:	e8 73 25 00 00       	call   80107cf7 <memset>
+  for(p = ptable.all; p; p = p->allnext)
+80105784:	8b 1d 94 ff 14 80    	mov    0x8014ff94,%ebx
+8010578a:	83 c4 10             	add    $0x10,%esp
+8010578d:	89 d8                	mov    %ebx,%eax
+8010578f:	eb 06                	jmp    80105797 <schedaudit+0x3e>
+80105791:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80105797:	85 c0                	test   %eax,%eax
+80105799:	74 2a                	je     801057c5 <schedaudit+0x6c>
+    if(p->state == RUNNABLE || p->state == RUNNING)
+8010579b:	8b 48 0c             	mov    0xc(%eax),%ecx
+8010579e:	8d 51 fd             	lea    -0x3(%ecx),%edx
+801057a1:	83 fa 01             	cmp    $0x1,%edx
+801057a4:	77 eb                	ja     80105791 <schedaudit+0x38>
+      cnt[p->niceness - BFS_NICE_FIRST_LEVEL]++;
+801057a6:	8b 48 7c             	mov    0x7c(%eax),%ecx
+801057a9:	8d 51 14             	lea    0x14(%ecx),%edx
+801057ac:	8b b4 95 58 ff ff ff 	mov    -0xa8(%ebp,%edx,4),%esi
+801057b3:	8d 4e 01             	lea    0x1(%esi),%ecx
+801057b6:	89 8c 95 58 ff ff ff 	mov    %ecx,-0xa8(%ebp,%edx,4)
+801057bd:	eb d2                	jmp    80105791 <schedaudit+0x38>
+  for(p = ptable.all; p; p = p->allnext){
+801057bf:	8b 9b a4 00 00 00    	mov    0xa4(%ebx),%ebx
+801057c5:	85 db                	test   %ebx,%ebx
+801057c7:	0f 84 8c 00 00 00    	je     80105859 <schedaudit+0x100>
+    if(p->state != RUNNABLE)
+801057cd:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+801057d1:	75 ec                	jne    801057bf <schedaudit+0x66>
+    l = p->niceness - BFS_NICE_FIRST_LEVEL;
+801057d3:	8b 43 7c             	mov    0x7c(%ebx),%eax
+801057d6:	8d 50 14             	lea    0x14(%eax),%edx
+    wait = ticks - p->readytick;
+801057d9:	8b 35 c0 88 19 80    	mov    0x801988c0,%esi
+801057df:	2b b3 8c 00 00 00    	sub    0x8c(%ebx),%esi
+    if(wait > sstat.maxwait[l])
+801057e5:	39 34 85 9c 7e 14 80 	cmp    %esi,-0x7feb8164(,%eax,4)
+801057ec:	73 07                	jae    801057f5 <schedaudit+0x9c>
+      sstat.maxwait[l] = wait;
+801057ee:	89 34 95 4c 7e 14 80 	mov    %esi,-0x7feb81b4(,%edx,4)
+    if(p->starved)
+801057f5:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+801057fc:	75 c1                	jne    801057bf <schedaudit+0x66>
+    bound = waitbound(p, cnt);
+801057fe:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+80105804:	89 d8                	mov    %ebx,%eax
+80105806:	e8 ef fb ff ff       	call   801053fa <waitbound>
+    if(wait > bound){
+8010580b:	39 c6                	cmp    %eax,%esi
+8010580d:	7e b0                	jle    801057bf <schedaudit+0x66>
+      p->starved = 1;
+8010580f:	c7 83 90 00 00 00 01 	movl   $0x1,0x90(%ebx)
+80105816:	00 00 00 
+      sstat.starved++;
+80105819:	8b 0d ec 7e 14 80    	mov    0x80147eec,%ecx
+8010581f:	8d 51 01             	lea    0x1(%ecx),%edx
+80105822:	89 15 ec 7e 14 80    	mov    %edx,0x80147eec
+      sstat.starvepid = p->pid;
+80105828:	8b 53 10             	mov    0x10(%ebx),%edx
+8010582b:	89 15 f0 7e 14 80    	mov    %edx,0x80147ef0
+      sstat.starvewait = wait;
+80105831:	89 35 f4 7e 14 80    	mov    %esi,0x80147ef4
+      sstat.starvebound = bound;
+80105837:	a3 f8 7e 14 80       	mov    %eax,0x80147ef8
+      cprintf("schedaudit: pid %d (nice %d) runnable for %d ticks, bound %d\n",
+8010583c:	83 ec 0c             	sub    $0xc,%esp
+8010583f:	50                   	push   %eax
+80105840:	56                   	push   %esi
+80105841:	ff 73 7c             	push   0x7c(%ebx)
+80105844:	ff 73 10             	push   0x10(%ebx)
+80105847:	68 4c b5 10 80       	push   $0x8010b54c
+8010584c:	e8 a8 b4 ff ff       	call   80100cf9 <cprintf>
+80105851:	83 c4 20             	add    $0x20,%esp
+80105854:	e9 66 ff ff ff       	jmp    801057bf <schedaudit+0x66>
+  sstat.audits++;
+80105859:	a1 a8 7d 14 80       	mov    0x80147da8,%eax
+8010585e:	83 c0 01             	add    $0x1,%eax
+80105861:	a3 a8 7d 14 80       	mov    %eax,0x80147da8
+  release(&ptable.lock);
+80105866:	83 ec 0c             	sub    $0xc,%esp
+80105869:	68 40 7f 14 80       	push   $0x80147f40
+8010586e:	e8 29 24 00 00       	call   80107c9c <release>
+}
+80105873:	83 c4 10             	add    $0x10,%esp
+80105876:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105879:	5b                   	pop    %ebx
+8010587a:	5e                   	pop    %esi
+8010587b:	5d                   	pop    %ebp
+8010587c:	c3                   	ret
+
+8010587d <forkret>:
+{
+8010587d:	55                   	push   %ebp
+8010587e:	89 e5                	mov    %esp,%ebp
+80105880:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80105883:	68 40 7f 14 80       	push   $0x80147f40
+80105888:	e8 0f 24 00 00       	call   80107c9c <release>
+  if (first) {
+8010588d:	83 c4 10             	add    $0x10,%esp
+80105890:	83 3d 80 f2 10 80 00 	cmpl   $0x0,0x8010f280
+80105897:	75 02                	jne    8010589b <forkret+0x1e>
+}
+80105899:	c9                   	leave
+8010589a:	c3                   	ret
+    first = 0;
+8010589b:	c7 05 80 f2 10 80 00 	movl   $0x0,0x8010f280
+801058a2:	00 00 00 
+    iinit(ROOTDEV);
+801058a5:	83 ec 0c             	sub    $0xc,%esp
+801058a8:	6a 01                	push   $0x1
+801058aa:	e8 a8 c5 ff ff       	call   80101e57 <iinit>
+    initlog(ROOTDEV);
+801058af:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801058b6:	e8 4d ea ff ff       	call   80104308 <initlog>
+801058bb:	83 c4 10             	add    $0x10,%esp
+}
+801058be:	eb d9                	jmp    80105899 <forkret+0x1c>
+
+801058c0 <pinit>:
+{
+801058c0:	55                   	push   %ebp
+801058c1:	89 e5                	mov    %esp,%ebp
+801058c3:	53                   	push   %ebx
+801058c4:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+801058c7:	68 ea b3 10 80       	push   $0x8010b3ea
+801058cc:	68 40 7f 14 80       	push   $0x80147f40
+801058d1:	e8 fc 21 00 00       	call   80107ad2 <initlock>
+  ptable.lock.profile = 1;
+801058d6:	c7 05 74 7f 14 80 01 	movl   $0x1,0x80147f74
+801058dd:	00 00 00 
+  for(i = 0; i < NELEM(rqbackends); i++)
+801058e0:	83 c4 10             	add    $0x10,%esp
+801058e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+801058e8:	eb 03                	jmp    801058ed <pinit+0x2d>
+801058ea:	83 c3 01             	add    $0x1,%ebx
+801058ed:	83 fb 02             	cmp    $0x2,%ebx
+801058f0:	77 2e                	ja     80105920 <pinit+0x60>
+    if(strncmp(rqbackends[i]->name, RUNQUEUE, sizeof(sstat.rqname)) == 0)
+801058f2:	8b 04 9d 90 b6 10 80 	mov    -0x7fef4970(,%ebx,4),%eax
+801058f9:	8b 00                	mov    (%eax),%eax
+801058fb:	83 ec 04             	sub    $0x4,%esp
+801058fe:	6a 10                	push   $0x10
+80105900:	68 f1 b3 10 80       	push   $0x8010b3f1
+80105905:	50                   	push   %eax
+80105906:	e8 d0 24 00 00       	call   80107ddb <strncmp>
+8010590b:	83 c4 10             	add    $0x10,%esp
+8010590e:	85 c0                	test   %eax,%eax
+80105910:	75 d8                	jne    801058ea <pinit+0x2a>
+      rq = rqbackends[i];
+80105912:	8b 04 9d 90 b6 10 80 	mov    -0x7fef4970(,%ebx,4),%eax
+80105919:	a3 98 07 15 80       	mov    %eax,0x80150798
+8010591e:	eb ca                	jmp    801058ea <pinit+0x2a>
+  if(rq == 0)
+80105920:	a1 98 07 15 80       	mov    0x80150798,%eax
+80105925:	85 c0                	test   %eax,%eax
+80105927:	74 08                	je     80105931 <pinit+0x71>
+  rq->init();
+80105929:	ff 50 04             	call   *0x4(%eax)
+}
+8010592c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010592f:	c9                   	leave
+80105930:	c3                   	ret
+    panic("pinit: unknown RUNQUEUE");
+80105931:	83 ec 0c             	sub    $0xc,%esp
+80105934:	68 fa b3 10 80       	push   $0x8010b3fa
+80105939:	e8 c4 af ff ff       	call   80100902 <panic>
+
+8010593e <findproc>:
+{
+8010593e:	55                   	push   %ebp
+8010593f:	89 e5                	mov    %esp,%ebp
+80105941:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80105944:	0f b6 c2             	movzbl %dl,%eax
+80105947:	8b 04 85 98 ff 14 80 	mov    -0x7feb0068(,%eax,4),%eax
+8010594e:	eb 06                	jmp    80105956 <findproc+0x18>
+80105950:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+80105956:	85 c0                	test   %eax,%eax
+80105958:	74 05                	je     8010595f <findproc+0x21>
+    if(p->pid == pid)
+8010595a:	39 50 10             	cmp    %edx,0x10(%eax)
+8010595d:	75 f1                	jne    80105950 <findproc+0x12>
+}
+8010595f:	5d                   	pop    %ebp
+80105960:	c3                   	ret
+
+80105961 <mycpu>:
+{
+80105961:	55                   	push   %ebp
+80105962:	89 e5                	mov    %esp,%ebp
+80105964:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105967:	9c                   	pushf
+80105968:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80105969:	f6 c4 02             	test   $0x2,%ah
+8010596c:	75 28                	jne    80105996 <mycpu+0x35>
+  apicid = lapicid();
+8010596e:	e8 21 e2 ff ff       	call   80103b94 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80105973:	ba 00 00 00 00       	mov    $0x0,%edx
+80105978:	39 15 84 62 14 80    	cmp    %edx,0x80146284
+8010597e:	7e 23                	jle    801059a3 <mycpu+0x42>
+    if (cpus[i].apicid == apicid)
+80105980:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+80105986:	0f b6 89 a0 62 14 80 	movzbl -0x7feb9d60(%ecx),%ecx
+8010598d:	39 c1                	cmp    %eax,%ecx
+8010598f:	74 1f                	je     801059b0 <mycpu+0x4f>
+  for (i = 0; i < ncpu; ++i) {
+80105991:	83 c2 01             	add    $0x1,%edx
+80105994:	eb e2                	jmp    80105978 <mycpu+0x17>
+    panic("mycpu called with interrupts enabled\n");
+80105996:	83 ec 0c             	sub    $0xc,%esp
+80105999:	68 8c b5 10 80       	push   $0x8010b58c
+8010599e:	e8 5f af ff ff       	call   80100902 <panic>
+  panic("unknown apicid\n");
+801059a3:	83 ec 0c             	sub    $0xc,%esp
+801059a6:	68 12 b4 10 80       	push   $0x8010b412
+801059ab:	e8 52 af ff ff       	call   80100902 <panic>
+      return &cpus[i];
+801059b0:	69 c2 b0 00 00 00    	imul   $0xb0,%edx,%eax
+801059b6:	05 a0 62 14 80       	add    $0x801462a0,%eax
+}
+801059bb:	c9                   	leave
+801059bc:	c3                   	ret
+
+801059bd <cpuid>:
+cpuid() {
+801059bd:	55                   	push   %ebp
+801059be:	89 e5                	mov    %esp,%ebp
+801059c0:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+801059c3:	e8 99 ff ff ff       	call   80105961 <mycpu>
+801059c8:	2d a0 62 14 80       	sub    $0x801462a0,%eax
+801059cd:	c1 f8 04             	sar    $0x4,%eax
+801059d0:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+801059d6:	c9                   	leave
+801059d7:	c3                   	ret
+
+801059d8 <myproc>:
+myproc(void) {
+801059d8:	55                   	push   %ebp
+801059d9:	89 e5                	mov    %esp,%ebp
+801059db:	53                   	push   %ebx
+801059dc:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+801059df:	e8 56 21 00 00       	call   80107b3a <pushcli>
+  c = mycpu();
+801059e4:	e8 78 ff ff ff       	call   80105961 <mycpu>
+  p = c->proc;
+801059e9:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801059ef:	e8 8a 21 00 00       	call   80107b7e <popcli>
+}
+801059f4:	89 d8                	mov    %ebx,%eax
+801059f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801059f9:	c9                   	leave
+801059fa:	c3                   	ret
+
+801059fb <kthreadret>:
+{
+801059fb:	55                   	push   %ebp
+801059fc:	89 e5                	mov    %esp,%ebp
+801059fe:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80105a01:	68 40 7f 14 80       	push   $0x80147f40
+80105a06:	e8 91 22 00 00       	call   80107c9c <release>
+  ((void (*)(void))myproc()->tf->eip)();
+80105a0b:	e8 c8 ff ff ff       	call   801059d8 <myproc>
+80105a10:	8b 40 18             	mov    0x18(%eax),%eax
+80105a13:	ff 50 38             	call   *0x38(%eax)
+  panic("kthread returned");
+80105a16:	c7 04 24 22 b4 10 80 	movl   $0x8010b422,(%esp)
+80105a1d:	e8 e0 ae ff ff       	call   80100902 <panic>
+
+80105a22 <userinit>:
+{
+80105a22:	55                   	push   %ebp
+80105a23:	89 e5                	mov    %esp,%ebp
+80105a25:	53                   	push   %ebx
+80105a26:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80105a29:	e8 85 fb ff ff       	call   801055b3 <allocproc>
+80105a2e:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80105a30:	a3 9c 07 15 80       	mov    %eax,0x8015079c
+  if((p->pgdir = setupkvm()) == 0)
+80105a35:	e8 ed 47 00 00       	call   8010a227 <setupkvm>
+80105a3a:	89 43 04             	mov    %eax,0x4(%ebx)
+80105a3d:	85 c0                	test   %eax,%eax
+80105a3f:	0f 84 b8 00 00 00    	je     80105afd <userinit+0xdb>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105a45:	83 ec 04             	sub    $0x4,%esp
+80105a48:	68 2c 00 00 00       	push   $0x2c
+80105a4d:	68 d0 f9 10 80       	push   $0x8010f9d0
+80105a52:	50                   	push   %eax
+80105a53:	e8 52 4a 00 00       	call   8010a4aa <inituvm>
+  p->sz = PGSIZE;
+80105a58:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105a5e:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a61:	83 c4 0c             	add    $0xc,%esp
+80105a64:	6a 4c                	push   $0x4c
+80105a66:	6a 00                	push   $0x0
+80105a68:	50                   	push   %eax
+80105a69:	e8 89 22 00 00       	call   80107cf7 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105a6e:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a71:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105a77:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a7a:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105a80:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a83:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105a87:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105a8b:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a8e:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105a92:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105a96:	8b 43 18             	mov    0x18(%ebx),%eax
+80105a99:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105aa0:	8b 43 18             	mov    0x18(%ebx),%eax
+80105aa3:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105aaa:	8b 43 18             	mov    0x18(%ebx),%eax
+80105aad:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105ab4:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80105ab7:	83 c4 0c             	add    $0xc,%esp
+80105aba:	6a 10                	push   $0x10
+80105abc:	68 4c b4 10 80       	push   $0x8010b44c
+80105ac1:	50                   	push   %eax
+80105ac2:	e8 9c 23 00 00       	call   80107e63 <safestrcpy>
+  p->cwd = namei("/");
+80105ac7:	c7 04 24 55 b4 10 80 	movl   $0x8010b455,(%esp)
+80105ace:	e8 30 ce ff ff       	call   80102903 <namei>
+80105ad3:	89 43 68             	mov    %eax,0x68(%ebx)
+  acquire(&ptable.lock);
+80105ad6:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105add:	e8 3b 21 00 00       	call   80107c1d <acquire>
+  setrunnable(p);
+80105ae2:	89 d8                	mov    %ebx,%eax
+80105ae4:	e8 b2 f9 ff ff       	call   8010549b <setrunnable>
+  release(&ptable.lock);
+80105ae9:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105af0:	e8 a7 21 00 00       	call   80107c9c <release>
+}
+80105af5:	83 c4 10             	add    $0x10,%esp
+80105af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105afb:	c9                   	leave
+80105afc:	c3                   	ret
+    panic("userinit: out of memory?");
+80105afd:	83 ec 0c             	sub    $0xc,%esp
+80105b00:	68 33 b4 10 80       	push   $0x8010b433
+80105b05:	e8 f8 ad ff ff       	call   80100902 <panic>
+
+80105b0a <kthread>:
+{
+80105b0a:	55                   	push   %ebp
+80105b0b:	89 e5                	mov    %esp,%ebp
+80105b0d:	53                   	push   %ebx
+80105b0e:	83 ec 04             	sub    $0x4,%esp
+  if((p = allocproc()) == 0)
+80105b11:	e8 9d fa ff ff       	call   801055b3 <allocproc>
+80105b16:	85 c0                	test   %eax,%eax
+80105b18:	0f 84 9d 00 00 00    	je     80105bbb <kthread+0xb1>
+80105b1e:	89 c3                	mov    %eax,%ebx
+  if((p->pgdir = setupkvm()) == 0){
+80105b20:	e8 02 47 00 00       	call   8010a227 <setupkvm>
+80105b25:	89 43 04             	mov    %eax,0x4(%ebx)
+80105b28:	85 c0                	test   %eax,%eax
+80105b2a:	74 5b                	je     80105b87 <kthread+0x7d>
+  p->context->eip = (uint)kthreadret;
+80105b2c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105b2f:	c7 40 10 fb 59 10 80 	movl   $0x801059fb,0x10(%eax)
+  p->tf->eip = (uint)fn;
+80105b36:	8b 43 18             	mov    0x18(%ebx),%eax
+80105b39:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105b3c:	89 50 38             	mov    %edx,0x38(%eax)
+  p->niceness = nice;
+80105b3f:	8b 45 10             	mov    0x10(%ebp),%eax
+80105b42:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  newdeadline(p);
+80105b45:	89 d8                	mov    %ebx,%eax
+80105b47:	e8 66 f7 ff ff       	call   801052b2 <newdeadline>
+  safestrcpy(p->name, name, sizeof(p->name));
+80105b4c:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80105b4f:	83 ec 04             	sub    $0x4,%esp
+80105b52:	6a 10                	push   $0x10
+80105b54:	ff 75 08             	push   0x8(%ebp)
+80105b57:	50                   	push   %eax
+80105b58:	e8 06 23 00 00       	call   80107e63 <safestrcpy>
+  acquire(&ptable.lock);
+80105b5d:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105b64:	e8 b4 20 00 00       	call   80107c1d <acquire>
+  setrunnable(p);
+80105b69:	89 d8                	mov    %ebx,%eax
+80105b6b:	e8 2b f9 ff ff       	call   8010549b <setrunnable>
+  release(&ptable.lock);
+80105b70:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105b77:	e8 20 21 00 00       	call   80107c9c <release>
+  return p->pid;
+80105b7c:	8b 43 10             	mov    0x10(%ebx),%eax
+80105b7f:	83 c4 10             	add    $0x10,%esp
+}
+80105b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105b85:	c9                   	leave
+80105b86:	c3                   	ret
+    kfree(p->kstack);
+80105b87:	83 ec 0c             	sub    $0xc,%esp
+80105b8a:	ff 73 08             	push   0x8(%ebx)
+80105b8d:	e8 a2 d9 ff ff       	call   80103534 <kfree>
+    acquire(&ptable.lock);
+80105b92:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105b99:	e8 7f 20 00 00       	call   80107c1d <acquire>
+    freeproc(p);
+80105b9e:	89 d8                	mov    %ebx,%eax
+80105ba0:	e8 66 f9 ff ff       	call   8010550b <freeproc>
+    release(&ptable.lock);
+80105ba5:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105bac:	e8 eb 20 00 00       	call   80107c9c <release>
+    return -1;
+80105bb1:	83 c4 10             	add    $0x10,%esp
+80105bb4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bb9:	eb c7                	jmp    80105b82 <kthread+0x78>
+    return -1;
+80105bbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bc0:	eb c0                	jmp    80105b82 <kthread+0x78>
+
+80105bc2 <growproc>:
+{
+80105bc2:	55                   	push   %ebp
+80105bc3:	89 e5                	mov    %esp,%ebp
+80105bc5:	56                   	push   %esi
+80105bc6:	53                   	push   %ebx
+80105bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80105bca:	e8 09 fe ff ff       	call   801059d8 <myproc>
+80105bcf:	89 c6                	mov    %eax,%esi
+  sz = curproc->sz;
+80105bd1:	8b 00                	mov    (%eax),%eax
+  if(n > 0){
+80105bd3:	85 db                	test   %ebx,%ebx
+80105bd5:	7e 22                	jle    80105bf9 <growproc+0x37>
+    if(sz + n < sz || sz + n >= KERNBASE)
+80105bd7:	01 c3                	add    %eax,%ebx
+80105bd9:	72 43                	jb     80105c1e <growproc+0x5c>
+80105bdb:	85 db                	test   %ebx,%ebx
+80105bdd:	78 46                	js     80105c25 <growproc+0x63>
+  curproc->sz = sz;
+80105bdf:	89 1e                	mov    %ebx,(%esi)
+  switchuvm(curproc);
+80105be1:	83 ec 0c             	sub    $0xc,%esp
+80105be4:	56                   	push   %esi
+80105be5:	e8 6b 48 00 00       	call   8010a455 <switchuvm>
+  return 0;
+80105bea:	83 c4 10             	add    $0x10,%esp
+80105bed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105bf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105bf5:	5b                   	pop    %ebx
+80105bf6:	5e                   	pop    %esi
+80105bf7:	5d                   	pop    %ebp
+80105bf8:	c3                   	ret
+  } else if(n < 0){
+80105bf9:	78 04                	js     80105bff <growproc+0x3d>
+  sz = curproc->sz;
+80105bfb:	89 c3                	mov    %eax,%ebx
+80105bfd:	eb e0                	jmp    80105bdf <growproc+0x1d>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80105bff:	83 ec 04             	sub    $0x4,%esp
+80105c02:	01 c3                	add    %eax,%ebx
+80105c04:	53                   	push   %ebx
+80105c05:	50                   	push   %eax
+80105c06:	ff 76 04             	push   0x4(%esi)
+80105c09:	e8 b8 49 00 00       	call   8010a5c6 <deallocuvm>
+80105c0e:	89 c3                	mov    %eax,%ebx
+80105c10:	83 c4 10             	add    $0x10,%esp
+80105c13:	85 c0                	test   %eax,%eax
+80105c15:	75 c8                	jne    80105bdf <growproc+0x1d>
+      return -1;
+80105c17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c1c:	eb d4                	jmp    80105bf2 <growproc+0x30>
+      return -1;
+80105c1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c23:	eb cd                	jmp    80105bf2 <growproc+0x30>
+80105c25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c2a:	eb c6                	jmp    80105bf2 <growproc+0x30>
+
+80105c2c <populateNewProc>:
+}
+80105c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+80105c31:	c3                   	ret
+
+80105c32 <nicefork>:
+int nicefork(int nice) {
+80105c32:	55                   	push   %ebp
+80105c33:	89 e5                	mov    %esp,%ebp
+80105c35:	57                   	push   %edi
+80105c36:	56                   	push   %esi
+80105c37:	53                   	push   %ebx
+80105c38:	83 ec 1c             	sub    $0x1c,%esp
+  if (nice < BFS_NICE_FIRST_LEVEL || nice > BFS_NICE_LAST_LEVEL) return -1;
+80105c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+80105c3e:	83 c0 14             	add    $0x14,%eax
+80105c41:	83 f8 27             	cmp    $0x27,%eax
+80105c44:	0f 87 95 01 00 00    	ja     80105ddf <nicefork+0x1ad>
+  struct proc *curproc = myproc();
+80105c4a:	e8 89 fd ff ff       	call   801059d8 <myproc>
+80105c4f:	89 c3                	mov    %eax,%ebx
+  if((np = allocproc()) == 0){
+80105c51:	e8 5d f9 ff ff       	call   801055b3 <allocproc>
+80105c56:	89 c6                	mov    %eax,%esi
+80105c58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105c5b:	85 c0                	test   %eax,%eax
+80105c5d:	0f 84 83 01 00 00    	je     80105de6 <nicefork+0x1b4>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80105c63:	83 ec 08             	sub    $0x8,%esp
+80105c66:	ff 33                	push   (%ebx)
+80105c68:	ff 73 04             	push   0x4(%ebx)
+80105c6b:	e8 97 4b 00 00       	call   8010a807 <copyuvm>
+80105c70:	89 46 04             	mov    %eax,0x4(%esi)
+80105c73:	83 c4 10             	add    $0x10,%esp
+80105c76:	85 c0                	test   %eax,%eax
+80105c78:	74 7c                	je     80105cf6 <nicefork+0xc4>
+  np->sz = curproc->sz;
+80105c7a:	8b 03                	mov    (%ebx),%eax
+80105c7c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105c7f:	89 01                	mov    %eax,(%ecx)
+  np->parent = curproc;
+80105c81:	89 59 14             	mov    %ebx,0x14(%ecx)
+  *np->tf = *curproc->tf;
+80105c84:	8b 73 18             	mov    0x18(%ebx),%esi
+80105c87:	8b 79 18             	mov    0x18(%ecx),%edi
+80105c8a:	b9 13 00 00 00       	mov    $0x13,%ecx
+80105c8f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  if(curproc->exeip){
+80105c91:	8b 83 c8 00 00 00    	mov    0xc8(%ebx),%eax
+80105c97:	85 c0                	test   %eax,%eax
+80105c99:	74 20                	je     80105cbb <nicefork+0x89>
+    np->exeip = idup(curproc->exeip);
+80105c9b:	83 ec 0c             	sub    $0xc,%esp
+80105c9e:	50                   	push   %eax
+80105c9f:	e8 da c4 ff ff       	call   8010217e <idup>
+80105ca4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105ca7:	89 81 c8 00 00 00    	mov    %eax,0xc8(%ecx)
+    iexec(np->exeip, 1);
+80105cad:	83 c4 08             	add    $0x8,%esp
+80105cb0:	6a 01                	push   $0x1
+80105cb2:	50                   	push   %eax
+80105cb3:	e8 f6 c4 ff ff       	call   801021ae <iexec>
+80105cb8:	83 c4 10             	add    $0x10,%esp
+  memmove(np->seg, curproc->seg, sizeof(np->seg));
+80105cbb:	8d 93 cc 00 00 00    	lea    0xcc(%ebx),%edx
+80105cc1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80105cc4:	8d 87 cc 00 00 00    	lea    0xcc(%edi),%eax
+80105cca:	83 ec 04             	sub    $0x4,%esp
+80105ccd:	6a 50                	push   $0x50
+80105ccf:	52                   	push   %edx
+80105cd0:	50                   	push   %eax
+80105cd1:	e8 99 20 00 00       	call   80107d6f <memmove>
+  np->nseg = curproc->nseg;
+80105cd6:	8b 83 1c 01 00 00    	mov    0x11c(%ebx),%eax
+80105cdc:	89 87 1c 01 00 00    	mov    %eax,0x11c(%edi)
+  np->tf->eax = 0;
+80105ce2:	8b 47 18             	mov    0x18(%edi),%eax
+80105ce5:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+80105cec:	83 c4 10             	add    $0x10,%esp
+80105cef:	be 00 00 00 00       	mov    $0x0,%esi
+80105cf4:	eb 4d                	jmp    80105d43 <nicefork+0x111>
+    kfree(np->kstack);
+80105cf6:	83 ec 0c             	sub    $0xc,%esp
+80105cf9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80105cfc:	ff 73 08             	push   0x8(%ebx)
+80105cff:	e8 30 d8 ff ff       	call   80103534 <kfree>
+    acquire(&ptable.lock);
+80105d04:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105d0b:	e8 0d 1f 00 00       	call   80107c1d <acquire>
+    freeproc(np);
+80105d10:	89 d8                	mov    %ebx,%eax
+80105d12:	e8 f4 f7 ff ff       	call   8010550b <freeproc>
+    release(&ptable.lock);
+80105d17:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105d1e:	e8 79 1f 00 00       	call   80107c9c <release>
+    return -1;
+80105d23:	83 c4 10             	add    $0x10,%esp
+80105d26:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105d2b:	e9 a5 00 00 00       	jmp    80105dd5 <nicefork+0x1a3>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80105d30:	83 ec 0c             	sub    $0xc,%esp
+80105d33:	50                   	push   %eax
+80105d34:	e8 1b b8 ff ff       	call   80101554 <filedup>
+80105d39:	89 44 b7 28          	mov    %eax,0x28(%edi,%esi,4)
+80105d3d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NOFILE; i++)
+80105d40:	83 c6 01             	add    $0x1,%esi
+80105d43:	83 fe 0f             	cmp    $0xf,%esi
+80105d46:	7f 0a                	jg     80105d52 <nicefork+0x120>
+    if(curproc->ofile[i])
+80105d48:	8b 44 b3 28          	mov    0x28(%ebx,%esi,4),%eax
+80105d4c:	85 c0                	test   %eax,%eax
+80105d4e:	75 e0                	jne    80105d30 <nicefork+0xfe>
+80105d50:	eb ee                	jmp    80105d40 <nicefork+0x10e>
+  np->cwd = idup(curproc->cwd);
+80105d52:	83 ec 0c             	sub    $0xc,%esp
+80105d55:	ff 73 68             	push   0x68(%ebx)
+80105d58:	e8 21 c4 ff ff       	call   8010217e <idup>
+80105d5d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80105d60:	89 47 68             	mov    %eax,0x68(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80105d63:	8d 53 6c             	lea    0x6c(%ebx),%edx
+80105d66:	8d 47 6c             	lea    0x6c(%edi),%eax
+80105d69:	83 c4 0c             	add    $0xc,%esp
+80105d6c:	6a 10                	push   $0x10
+80105d6e:	52                   	push   %edx
+80105d6f:	50                   	push   %eax
+80105d70:	e8 ee 20 00 00       	call   80107e63 <safestrcpy>
+  np->niceness = nice;
+80105d75:	8b 45 08             	mov    0x8(%ebp),%eax
+80105d78:	89 47 7c             	mov    %eax,0x7c(%edi)
+  newdeadline(np);
+80105d7b:	89 f8                	mov    %edi,%eax
+80105d7d:	e8 30 f5 ff ff       	call   801052b2 <newdeadline>
+  dbgprintf(NICEFORK_DBG_LINES, "PID %d; niceness: %d, prioratio: %d, vdl: %d\n", np->pid, np->niceness, PRIO_RATIO(np->niceness), np->vdeadline);
+80105d82:	8b 47 7c             	mov    0x7c(%edi),%eax
+80105d85:	83 c4 08             	add    $0x8,%esp
+80105d88:	ff b7 80 00 00 00    	push   0x80(%edi)
+80105d8e:	8d 50 15             	lea    0x15(%eax),%edx
+80105d91:	52                   	push   %edx
+80105d92:	50                   	push   %eax
+80105d93:	ff 77 10             	push   0x10(%edi)
+80105d96:	68 b4 b5 10 80       	push   $0x8010b5b4
+80105d9b:	6a 00                	push   $0x0
+80105d9d:	e8 21 ae ff ff       	call   80100bc3 <dbgprintf>
+  pid = np->pid;
+80105da2:	8b 77 10             	mov    0x10(%edi),%esi
+  acquire(&ptable.lock);
+80105da5:	83 c4 14             	add    $0x14,%esp
+80105da8:	68 40 7f 14 80       	push   $0x80147f40
+80105dad:	e8 6b 1e 00 00       	call   80107c1d <acquire>
+  siblink(&curproc->children, np);
+80105db2:	8d 83 b8 00 00 00    	lea    0xb8(%ebx),%eax
+80105db8:	89 fa                	mov    %edi,%edx
+80105dba:	e8 44 f5 ff ff       	call   80105303 <siblink>
+  setrunnable(np);
+80105dbf:	89 f8                	mov    %edi,%eax
+80105dc1:	e8 d5 f6 ff ff       	call   8010549b <setrunnable>
+  release(&ptable.lock);
+80105dc6:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105dcd:	e8 ca 1e 00 00       	call   80107c9c <release>
+  return pid;
+80105dd2:	83 c4 10             	add    $0x10,%esp
+}
+80105dd5:	89 f0                	mov    %esi,%eax
+80105dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105dda:	5b                   	pop    %ebx
+80105ddb:	5e                   	pop    %esi
+80105ddc:	5f                   	pop    %edi
+80105ddd:	5d                   	pop    %ebp
+80105dde:	c3                   	ret
+  if (nice < BFS_NICE_FIRST_LEVEL || nice > BFS_NICE_LAST_LEVEL) return -1;
+80105ddf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105de4:	eb ef                	jmp    80105dd5 <nicefork+0x1a3>
+    return -1;
+80105de6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105deb:	eb e8                	jmp    80105dd5 <nicefork+0x1a3>
+
+80105ded <fork>:
+{
+80105ded:	55                   	push   %ebp
+80105dee:	89 e5                	mov    %esp,%ebp
+80105df0:	83 ec 14             	sub    $0x14,%esp
+  return nicefork(0);
+80105df3:	6a 00                	push   $0x0
+80105df5:	e8 38 fe ff ff       	call   80105c32 <nicefork>
+}
+80105dfa:	c9                   	leave
+80105dfb:	c3                   	ret
+
+80105dfc <spawn>:
+{
+80105dfc:	55                   	push   %ebp
+80105dfd:	89 e5                	mov    %esp,%ebp
+80105dff:	57                   	push   %edi
+80105e00:	56                   	push   %esi
+80105e01:	53                   	push   %ebx
+80105e02:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80105e05:	e8 ce fb ff ff       	call   801059d8 <myproc>
+80105e0a:	89 c7                	mov    %eax,%edi
+  if (nice < BFS_NICE_FIRST_LEVEL || nice > BFS_NICE_LAST_LEVEL) return -1;
+80105e0c:	8b 45 10             	mov    0x10(%ebp),%eax
+80105e0f:	83 c0 14             	add    $0x14,%eax
+80105e12:	83 f8 27             	cmp    $0x27,%eax
+80105e15:	0f 87 1e 01 00 00    	ja     80105f39 <spawn+0x13d>
+  if((np = allocproc()) == 0)
+80105e1b:	e8 93 f7 ff ff       	call   801055b3 <allocproc>
+80105e20:	89 c6                	mov    %eax,%esi
+80105e22:	85 c0                	test   %eax,%eax
+80105e24:	0f 84 16 01 00 00    	je     80105f40 <spawn+0x144>
+  memset(np->tf, 0, sizeof(*np->tf));
+80105e2a:	8b 40 18             	mov    0x18(%eax),%eax
+80105e2d:	83 ec 04             	sub    $0x4,%esp
+80105e30:	6a 4c                	push   $0x4c
+80105e32:	6a 00                	push   $0x0
+80105e34:	50                   	push   %eax
+80105e35:	e8 bd 1e 00 00       	call   80107cf7 <memset>
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105e3a:	8b 46 18             	mov    0x18(%esi),%eax
+80105e3d:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105e43:	8b 46 18             	mov    0x18(%esi),%eax
+80105e46:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  np->tf->es = np->tf->ds;
+80105e4c:	8b 46 18             	mov    0x18(%esi),%eax
+80105e4f:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105e53:	66 89 50 28          	mov    %dx,0x28(%eax)
+  np->tf->ss = np->tf->ds;
+80105e57:	8b 46 18             	mov    0x18(%esi),%eax
+80105e5a:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105e5e:	66 89 50 48          	mov    %dx,0x48(%eax)
+  np->tf->eflags = FL_IF;
+80105e62:	8b 46 18             	mov    0x18(%esi),%eax
+80105e65:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  if(execinto(np, path, argv) < 0){
+80105e6c:	83 c4 0c             	add    $0xc,%esp
+80105e6f:	ff 75 0c             	push   0xc(%ebp)
+80105e72:	ff 75 08             	push   0x8(%ebp)
+80105e75:	56                   	push   %esi
+80105e76:	e8 45 b1 ff ff       	call   80100fc0 <execinto>
+80105e7b:	83 c4 10             	add    $0x10,%esp
+80105e7e:	85 c0                	test   %eax,%eax
+80105e80:	78 0a                	js     80105e8c <spawn+0x90>
+  np->parent = curproc;
+80105e82:	89 7e 14             	mov    %edi,0x14(%esi)
+  for(i = 0; i < NOFILE; i++)
+80105e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105e8a:	eb 37                	jmp    80105ec3 <spawn+0xc7>
+    kfree(np->kstack);
+80105e8c:	83 ec 0c             	sub    $0xc,%esp
+80105e8f:	ff 76 08             	push   0x8(%esi)
+80105e92:	e8 9d d6 ff ff       	call   80103534 <kfree>
+    acquire(&ptable.lock);
+80105e97:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105e9e:	e8 7a 1d 00 00       	call   80107c1d <acquire>
+    freeproc(np);
+80105ea3:	89 f0                	mov    %esi,%eax
+80105ea5:	e8 61 f6 ff ff       	call   8010550b <freeproc>
+    release(&ptable.lock);
+80105eaa:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105eb1:	e8 e6 1d 00 00       	call   80107c9c <release>
+    return -1;
+80105eb6:	83 c4 10             	add    $0x10,%esp
+80105eb9:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105ebe:	eb 6f                	jmp    80105f2f <spawn+0x133>
+  for(i = 0; i < NOFILE; i++)
+80105ec0:	83 c3 01             	add    $0x1,%ebx
+80105ec3:	83 fb 0f             	cmp    $0xf,%ebx
+80105ec6:	7f 1a                	jg     80105ee2 <spawn+0xe6>
+    if(curproc->ofile[i])
+80105ec8:	8b 44 9f 28          	mov    0x28(%edi,%ebx,4),%eax
+80105ecc:	85 c0                	test   %eax,%eax
+80105ece:	74 f0                	je     80105ec0 <spawn+0xc4>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80105ed0:	83 ec 0c             	sub    $0xc,%esp
+80105ed3:	50                   	push   %eax
+80105ed4:	e8 7b b6 ff ff       	call   80101554 <filedup>
+80105ed9:	89 44 9e 28          	mov    %eax,0x28(%esi,%ebx,4)
+80105edd:	83 c4 10             	add    $0x10,%esp
+80105ee0:	eb de                	jmp    80105ec0 <spawn+0xc4>
+  np->cwd = idup(curproc->cwd);
+80105ee2:	83 ec 0c             	sub    $0xc,%esp
+80105ee5:	ff 77 68             	push   0x68(%edi)
+80105ee8:	e8 91 c2 ff ff       	call   8010217e <idup>
+80105eed:	89 46 68             	mov    %eax,0x68(%esi)
+  np->niceness = nice;
+80105ef0:	8b 45 10             	mov    0x10(%ebp),%eax
+80105ef3:	89 46 7c             	mov    %eax,0x7c(%esi)
+  newdeadline(np);
+80105ef6:	89 f0                	mov    %esi,%eax
+80105ef8:	e8 b5 f3 ff ff       	call   801052b2 <newdeadline>
+  pid = np->pid;
+80105efd:	8b 5e 10             	mov    0x10(%esi),%ebx
+  acquire(&ptable.lock);
+80105f00:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105f07:	e8 11 1d 00 00       	call   80107c1d <acquire>
+  siblink(&curproc->children, np);
+80105f0c:	8d 87 b8 00 00 00    	lea    0xb8(%edi),%eax
+80105f12:	89 f2                	mov    %esi,%edx
+80105f14:	e8 ea f3 ff ff       	call   80105303 <siblink>
+  setrunnable(np);
+80105f19:	89 f0                	mov    %esi,%eax
+80105f1b:	e8 7b f5 ff ff       	call   8010549b <setrunnable>
+  release(&ptable.lock);
+80105f20:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80105f27:	e8 70 1d 00 00       	call   80107c9c <release>
+  return pid;
+80105f2c:	83 c4 10             	add    $0x10,%esp
+}
+80105f2f:	89 d8                	mov    %ebx,%eax
+80105f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105f34:	5b                   	pop    %ebx
+80105f35:	5e                   	pop    %esi
+80105f36:	5f                   	pop    %edi
+80105f37:	5d                   	pop    %ebp
+80105f38:	c3                   	ret
+  if (nice < BFS_NICE_FIRST_LEVEL || nice > BFS_NICE_LAST_LEVEL) return -1;
+80105f39:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105f3e:	eb ef                	jmp    80105f2f <spawn+0x133>
+    return -1;
+80105f40:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105f45:	eb e8                	jmp    80105f2f <spawn+0x133>
+
+80105f47 <schedlog>:
+void schedlog(int n) {
+80105f47:	55                   	push   %ebp
+80105f48:	89 e5                	mov    %esp,%ebp
+  schedlog_active = 1;
+80105f4a:	c7 05 84 7d 14 80 01 	movl   $0x1,0x80147d84
+80105f51:	00 00 00 
+  schedlog_lasttick = ticks + n;
+80105f54:	a1 c0 88 19 80       	mov    0x801988c0,%eax
+80105f59:	03 45 08             	add    0x8(%ebp),%eax
+80105f5c:	a3 80 7d 14 80       	mov    %eax,0x80147d80
+}
+80105f61:	5d                   	pop    %ebp
+80105f62:	c3                   	ret
+
+80105f63 <schedtick>:
+{
+80105f63:	55                   	push   %ebp
+80105f64:	89 e5                	mov    %esp,%ebp
+80105f66:	83 ec 08             	sub    $0x8,%esp
+  struct proc *p = myproc();
+80105f69:	e8 6a fa ff ff       	call   801059d8 <myproc>
+  if(p && p->state == RUNNING)
+80105f6e:	85 c0                	test   %eax,%eax
+80105f70:	74 06                	je     80105f78 <schedtick+0x15>
+80105f72:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80105f76:	74 24                	je     80105f9c <schedtick+0x39>
+  if(cpuid() == 0 && ticks % BFS_AUDIT_PERIOD == 0)
+80105f78:	e8 40 fa ff ff       	call   801059bd <cpuid>
+80105f7d:	85 c0                	test   %eax,%eax
+80105f7f:	75 19                	jne    80105f9a <schedtick+0x37>
+80105f81:	8b 0d c0 88 19 80    	mov    0x801988c0,%ecx
+80105f87:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+80105f8c:	89 c8                	mov    %ecx,%eax
+80105f8e:	f7 e2                	mul    %edx
+80105f90:	c1 ea 05             	shr    $0x5,%edx
+80105f93:	6b d2 64             	imul   $0x64,%edx,%edx
+80105f96:	39 d1                	cmp    %edx,%ecx
+80105f98:	74 13                	je     80105fad <schedtick+0x4a>
+}
+80105f9a:	c9                   	leave
+80105f9b:	c3                   	ret
+    __sync_fetch_and_add(&sstat.runticks[p->niceness - BFS_NICE_FIRST_LEVEL], 1);
+80105f9c:	8b 40 7c             	mov    0x7c(%eax),%eax
+80105f9f:	8d 04 85 f0 7d 14 80 	lea    -0x7feb8210(,%eax,4),%eax
+80105fa6:	f0 83 40 0c 01       	lock addl $0x1,0xc(%eax)
+80105fab:	eb cb                	jmp    80105f78 <schedtick+0x15>
+    schedaudit();
+80105fad:	e8 a7 f7 ff ff       	call   80105759 <schedaudit>
+}
+80105fb2:	eb e6                	jmp    80105f9a <schedtick+0x37>
+
+80105fb4 <getschedstat>:
+{
+80105fb4:	55                   	push   %ebp
+80105fb5:	89 e5                	mov    %esp,%ebp
+80105fb7:	57                   	push   %edi
+80105fb8:	56                   	push   %esi
+80105fb9:	81 ec 9c 01 00 00    	sub    $0x19c,%esp
+  acquire(&ptable.lock);
+80105fbf:	68 40 7f 14 80       	push   $0x80147f40
+80105fc4:	e8 54 1c 00 00       	call   80107c1d <acquire>
+  sstat.ncpu = ncpu;
+80105fc9:	be a0 7d 14 80       	mov    $0x80147da0,%esi
+80105fce:	a1 84 62 14 80       	mov    0x80146284,%eax
+80105fd3:	a3 a0 7d 14 80       	mov    %eax,0x80147da0
+  sstat.ticks = ticks - sstart;
+80105fd8:	a1 c0 88 19 80       	mov    0x801988c0,%eax
+80105fdd:	2b 05 88 7d 14 80    	sub    0x80147d88,%eax
+80105fe3:	a3 a4 7d 14 80       	mov    %eax,0x80147da4
+  safestrcpy(sstat.rqname, rq->name, sizeof(sstat.rqname));
+80105fe8:	a1 98 07 15 80       	mov    0x80150798,%eax
+80105fed:	8b 00                	mov    (%eax),%eax
+80105fef:	83 c4 0c             	add    $0xc,%esp
+80105ff2:	6a 10                	push   $0x10
+80105ff4:	50                   	push   %eax
+80105ff5:	68 fc 7e 14 80       	push   $0x80147efc
+80105ffa:	e8 64 1e 00 00       	call   80107e63 <safestrcpy>
+  sstat.ptacquire = ptable.lock.nacquire;
+80105fff:	a1 78 7f 14 80       	mov    0x80147f78,%eax
+80106004:	a3 14 7f 14 80       	mov    %eax,0x80147f14
+  sstat.ptholdcycles = ptable.lock.holdcycles;
+80106009:	a1 7c 7f 14 80       	mov    0x80147f7c,%eax
+8010600e:	8b 15 80 7f 14 80    	mov    0x80147f80,%edx
+80106014:	a3 18 7f 14 80       	mov    %eax,0x80147f18
+80106019:	89 15 1c 7f 14 80    	mov    %edx,0x80147f1c
+  s = sstat;
+8010601f:	8d bd 74 fe ff ff    	lea    -0x18c(%ebp),%edi
+80106025:	b9 61 00 00 00       	mov    $0x61,%ecx
+8010602a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  if(reset){
+8010602c:	83 c4 10             	add    $0x10,%esp
+8010602f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80106033:	75 29                	jne    8010605e <getschedstat+0xaa>
+  release(&ptable.lock);
+80106035:	83 ec 0c             	sub    $0xc,%esp
+80106038:	68 40 7f 14 80       	push   $0x80147f40
+8010603d:	e8 5a 1c 00 00       	call   80107c9c <release>
+  *st = s;
+80106042:	8d b5 74 fe ff ff    	lea    -0x18c(%ebp),%esi
+80106048:	b9 61 00 00 00       	mov    $0x61,%ecx
+8010604d:	8b 7d 08             	mov    0x8(%ebp),%edi
+80106050:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+}
+80106052:	b8 00 00 00 00       	mov    $0x0,%eax
+80106057:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010605a:	5e                   	pop    %esi
+8010605b:	5f                   	pop    %edi
+8010605c:	5d                   	pop    %ebp
+8010605d:	c3                   	ret
+    memset(&sstat, 0, sizeof(sstat));
+8010605e:	83 ec 04             	sub    $0x4,%esp
+80106061:	68 84 01 00 00       	push   $0x184
+80106066:	6a 00                	push   $0x0
+80106068:	68 a0 7d 14 80       	push   $0x80147da0
+8010606d:	e8 85 1c 00 00       	call   80107cf7 <memset>
+    sstart = ticks;
+80106072:	a1 c0 88 19 80       	mov    0x801988c0,%eax
+80106077:	a3 88 7d 14 80       	mov    %eax,0x80147d88
+    ptable.lock.nacquire = 0;
+8010607c:	c7 05 78 7f 14 80 00 	movl   $0x0,0x80147f78
+80106083:	00 00 00 
+    ptable.lock.holdcycles = 0;
+80106086:	c7 05 7c 7f 14 80 00 	movl   $0x0,0x80147f7c
+8010608d:	00 00 00 
+80106090:	c7 05 80 7f 14 80 00 	movl   $0x0,0x80147f80
+80106097:	00 00 00 
+8010609a:	83 c4 10             	add    $0x10,%esp
+8010609d:	eb 96                	jmp    80106035 <getschedstat+0x81>
+
+8010609f <scheduler>:
+{
+8010609f:	55                   	push   %ebp
+801060a0:	89 e5                	mov    %esp,%ebp
+801060a2:	57                   	push   %edi
+801060a3:	56                   	push   %esi
+801060a4:	53                   	push   %ebx
+801060a5:	83 ec 1c             	sub    $0x1c,%esp
+  struct cpu *c = mycpu();
+801060a8:	e8 b4 f8 ff ff       	call   80105961 <mycpu>
+801060ad:	89 c7                	mov    %eax,%edi
+  c->proc = 0;
+801060af:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801060b6:	00 00 00 
+801060b9:	e9 ff 01 00 00       	jmp    801062bd <scheduler+0x21e>
+        panic("V2P on address < KERNBASE "
+801060be:	83 ec 0c             	sub    $0xc,%esp
+801060c1:	68 30 af 10 80       	push   $0x8010af30
+801060c6:	e8 37 a8 ff ff       	call   80100902 <panic>
+        sstat.cr3skips++;
+801060cb:	a1 20 7f 14 80       	mov    0x80147f20,%eax
+801060d0:	83 c0 01             	add    $0x1,%eax
+801060d3:	a3 20 7f 14 80       	mov    %eax,0x80147f20
+801060d8:	e9 5e 01 00 00       	jmp    8010623b <scheduler+0x19c>
+      if (nextProc->ticks_left <= 0) nextProc->ticks_left = BFS_DEFAULT_QUANTUM;
+801060dd:	c7 83 84 00 00 00 32 	movl   $0x32,0x84(%ebx)
+801060e4:	00 00 00 
+801060e7:	e9 63 01 00 00       	jmp    8010624f <scheduler+0x1b0>
+          cprintf("%d|", ticks);
+801060ec:	83 ec 08             	sub    $0x8,%esp
+801060ef:	50                   	push   %eax
+801060f0:	68 57 b4 10 80       	push   $0x8010b457
+801060f5:	e8 ff ab ff ff       	call   80100cf9 <cprintf>
+          for (int k = 0; k < ptable.nslot; k++) {
+801060fa:	83 c4 10             	add    $0x10,%esp
+801060fd:	b8 00 00 00 00       	mov    $0x0,%eax
+          int highest_idx = -1;
+80106102:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+          for (int k = 0; k < ptable.nslot; k++) {
+80106107:	eb 03                	jmp    8010610c <scheduler+0x6d>
+80106109:	83 c0 01             	add    $0x1,%eax
+8010610c:	39 05 8c bf 14 80    	cmp    %eax,0x8014bf8c
+80106112:	7e 15                	jle    80106129 <scheduler+0x8a>
+            pp = ptable.slot[k];
+80106114:	8b 14 85 8c 7f 14 80 	mov    -0x7feb8074(,%eax,4),%edx
+            if (pp != 0 && pp->state != UNUSED) {
+8010611b:	85 d2                	test   %edx,%edx
+8010611d:	74 ea                	je     80106109 <scheduler+0x6a>
+8010611f:	83 7a 0c 00          	cmpl   $0x0,0xc(%edx)
+80106123:	74 e4                	je     80106109 <scheduler+0x6a>
+              highest_idx = k;
+80106125:	89 c1                	mov    %eax,%ecx
+80106127:	eb e0                	jmp    80106109 <scheduler+0x6a>
+          for (int k = 0; k <= highest_idx; k++) {
+80106129:	be 00 00 00 00       	mov    $0x0,%esi
+8010612e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80106131:	89 cb                	mov    %ecx,%ebx
+80106133:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80106136:	eb 27                	jmp    8010615f <scheduler+0xc0>
+                cprintf("[-]---:0:-(-)(-)(-)");
+80106138:	83 ec 0c             	sub    $0xc,%esp
+8010613b:	68 5b b4 10 80       	push   $0x8010b45b
+80106140:	e8 b4 ab ff ff       	call   80100cf9 <cprintf>
+                break;
+80106145:	83 c4 10             	add    $0x10,%esp
+            if (k != highest_idx) cprintf(",");
+80106148:	39 f3                	cmp    %esi,%ebx
+8010614a:	74 10                	je     8010615c <scheduler+0xbd>
+8010614c:	83 ec 0c             	sub    $0xc,%esp
+8010614f:	68 88 b4 10 80       	push   $0x8010b488
+80106154:	e8 a0 ab ff ff       	call   80100cf9 <cprintf>
+80106159:	83 c4 10             	add    $0x10,%esp
+          for (int k = 0; k <= highest_idx; k++) {
+8010615c:	83 c6 01             	add    $0x1,%esi
+8010615f:	39 f3                	cmp    %esi,%ebx
+80106161:	7c 49                	jl     801061ac <scheduler+0x10d>
+            pp = ptable.slot[k];
+80106163:	8b 04 b5 8c 7f 14 80 	mov    -0x7feb8074(,%esi,4),%eax
+            switch (pp ? pp->state : UNUSED) {
+8010616a:	85 c0                	test   %eax,%eax
+8010616c:	74 ca                	je     80106138 <scheduler+0x99>
+8010616e:	8b 50 0c             	mov    0xc(%eax),%edx
+80106171:	85 d2                	test   %edx,%edx
+80106173:	74 c3                	je     80106138 <scheduler+0x99>
+                int maxlevel = pp->maxlevel;
+80106175:	8b 88 88 00 00 00    	mov    0x88(%eax),%ecx
+                if (pp->state != RUNNABLE) { // Not in the run queue
+8010617b:	83 fa 03             	cmp    $0x3,%edx
+8010617e:	74 05                	je     80106185 <scheduler+0xe6>
+                  maxlevel = -1;
+80106180:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+                cprintf("[%d]%s:%d:%d(%d)(%d)(%d)", pp->pid, pp->name, pp->state, pp->niceness, maxlevel, pp->vdeadline, pp->ticks_left);
+80106185:	8d 78 6c             	lea    0x6c(%eax),%edi
+80106188:	ff b0 84 00 00 00    	push   0x84(%eax)
+8010618e:	ff b0 80 00 00 00    	push   0x80(%eax)
+80106194:	51                   	push   %ecx
+80106195:	ff 70 7c             	push   0x7c(%eax)
+80106198:	52                   	push   %edx
+80106199:	57                   	push   %edi
+8010619a:	ff 70 10             	push   0x10(%eax)
+8010619d:	68 6f b4 10 80       	push   $0x8010b46f
+801061a2:	e8 52 ab ff ff       	call   80100cf9 <cprintf>
+                break;
+801061a7:	83 c4 20             	add    $0x20,%esp
+801061aa:	eb 9c                	jmp    80106148 <scheduler+0xa9>
+          cprintf("\n");
+801061ac:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801061af:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801061b2:	83 ec 0c             	sub    $0xc,%esp
+801061b5:	68 ab c0 10 80       	push   $0x8010c0ab
+801061ba:	e8 3a ab ff ff       	call   80100cf9 <cprintf>
+801061bf:	83 c4 10             	add    $0x10,%esp
+      swtch(&(c->scheduler), nextProc->context);
+801061c2:	83 ec 08             	sub    $0x8,%esp
+801061c5:	ff 73 1c             	push   0x1c(%ebx)
+801061c8:	8d 47 04             	lea    0x4(%edi),%eax
+801061cb:	50                   	push   %eax
+801061cc:	e8 e7 1c 00 00       	call   80107eb8 <swtch>
+      c->proc = 0;
+801061d1:	c7 87 ac 00 00 00 00 	movl   $0x0,0xac(%edi)
+801061d8:	00 00 00 
+      nextProc = rqpeekmin();
+801061db:	e8 a6 f0 ff ff       	call   80105286 <rqpeekmin>
+      if (nextProc == 0 || nextProc->pgdir != prevProc->pgdir) {
+801061e0:	83 c4 10             	add    $0x10,%esp
+801061e3:	85 c0                	test   %eax,%eax
+801061e5:	0f 84 b5 00 00 00    	je     801062a0 <scheduler+0x201>
+801061eb:	8b 4b 04             	mov    0x4(%ebx),%ecx
+801061ee:	39 48 04             	cmp    %ecx,0x4(%eax)
+801061f1:	0f 85 a9 00 00 00    	jne    801062a0 <scheduler+0x201>
+      nextProc = rqpeekmin();
+801061f7:	89 c3                	mov    %eax,%ebx
+    while (nextProc != 0) {
+801061f9:	85 db                	test   %ebx,%ebx
+801061fb:	0f 84 a8 00 00 00    	je     801062a9 <scheduler+0x20a>
+      rqremove(nextProc);
+80106201:	89 d8                	mov    %ebx,%eax
+80106203:	e8 50 f0 ff ff       	call   80105258 <rqremove>
+      c->proc = nextProc;
+80106208:	89 9f ac 00 00 00    	mov    %ebx,0xac(%edi)
+      switchtss(nextProc);
+8010620e:	83 ec 0c             	sub    $0xc,%esp
+80106211:	53                   	push   %ebx
+80106212:	e8 00 41 00 00       	call   8010a317 <switchtss>
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+80106217:	0f 20 da             	mov    %cr3,%edx
+      if (rcr3() == V2P(nextProc->pgdir))
+8010621a:	8b 43 04             	mov    0x4(%ebx),%eax
+    if (a < (void*) KERNBASE)
+8010621d:	83 c4 10             	add    $0x10,%esp
+80106220:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80106225:	0f 86 93 fe ff ff    	jbe    801060be <scheduler+0x1f>
+    return (uint)a - KERNBASE;
+8010622b:	05 00 00 00 80       	add    $0x80000000,%eax
+80106230:	39 d0                	cmp    %edx,%eax
+80106232:	0f 84 93 fe ff ff    	je     801060cb <scheduler+0x2c>
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80106238:	0f 22 d8             	mov    %eax,%cr3
+      nextProc->state = RUNNING;
+8010623b:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+      if (nextProc->ticks_left <= 0) nextProc->ticks_left = BFS_DEFAULT_QUANTUM;
+80106242:	83 bb 84 00 00 00 00 	cmpl   $0x0,0x84(%ebx)
+80106249:	0f 8e 8e fe ff ff    	jle    801060dd <scheduler+0x3e>
+      dbgprintf(SCHEDULER_DBG_LINES, "NEXTPROC pid: %d, nice: %d, vdeadline: %d, ticks left: %d\n", nextProc->pid,  nextProc->niceness, nextProc->vdeadline, nextProc->ticks_left);
+8010624f:	83 ec 08             	sub    $0x8,%esp
+80106252:	ff b3 84 00 00 00    	push   0x84(%ebx)
+80106258:	ff b3 80 00 00 00    	push   0x80(%ebx)
+8010625e:	ff 73 7c             	push   0x7c(%ebx)
+80106261:	ff 73 10             	push   0x10(%ebx)
+80106264:	68 10 b6 10 80       	push   $0x8010b610
+80106269:	6a 00                	push   $0x0
+8010626b:	e8 53 a9 ff ff       	call   80100bc3 <dbgprintf>
+      if (schedlog_active) {
+80106270:	83 c4 20             	add    $0x20,%esp
+80106273:	83 3d 84 7d 14 80 00 	cmpl   $0x0,0x80147d84
+8010627a:	0f 84 42 ff ff ff    	je     801061c2 <scheduler+0x123>
+        if (ticks > schedlog_lasttick) {
+80106280:	a1 c0 88 19 80       	mov    0x801988c0,%eax
+80106285:	39 05 80 7d 14 80    	cmp    %eax,0x80147d80
+8010628b:	0f 83 5b fe ff ff    	jae    801060ec <scheduler+0x4d>
+          schedlog_active = 0;
+80106291:	c7 05 84 7d 14 80 00 	movl   $0x0,0x80147d84
+80106298:	00 00 00 
+8010629b:	e9 22 ff ff ff       	jmp    801061c2 <scheduler+0x123>
+        switchkvm();
+801062a0:	89 c6                	mov    %eax,%esi
+801062a2:	e8 bb 3f 00 00       	call   8010a262 <switchkvm>
+      nextProc = rqpeekmin();
+801062a7:	89 f3                	mov    %esi,%ebx
+    release(&ptable.lock);
+801062a9:	83 ec 0c             	sub    $0xc,%esp
+801062ac:	68 40 7f 14 80       	push   $0x80147f40
+801062b1:	e8 e6 19 00 00       	call   80107c9c <release>
+    if (nextProc == 0)
+801062b6:	83 c4 10             	add    $0x10,%esp
+801062b9:	85 db                	test   %ebx,%ebx
+801062bb:	74 2b                	je     801062e8 <scheduler+0x249>
+    dbgprintf(SCHEDULER_DBG_LINES, "-----------------------------------------\n\n");
+801062bd:	83 ec 08             	sub    $0x8,%esp
+801062c0:	68 e4 b5 10 80       	push   $0x8010b5e4
+801062c5:	6a 00                	push   $0x0
+801062c7:	e8 f7 a8 ff ff       	call   80100bc3 <dbgprintf>
+  asm volatile("sti");
+801062cc:	fb                   	sti
+    acquire(&ptable.lock);
+801062cd:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+801062d4:	e8 44 19 00 00       	call   80107c1d <acquire>
+    struct proc* nextProc = rqpeekmin();
+801062d9:	e8 a8 ef ff ff       	call   80105286 <rqpeekmin>
+801062de:	89 c3                	mov    %eax,%ebx
+    while (nextProc != 0) {
+801062e0:	83 c4 10             	add    $0x10,%esp
+801062e3:	e9 11 ff ff ff       	jmp    801061f9 <scheduler+0x15a>
+      kzerofill();
+801062e8:	e8 c4 d5 ff ff       	call   801038b1 <kzerofill>
+801062ed:	eb ce                	jmp    801062bd <scheduler+0x21e>
+
+801062ef <sched>:
+{
+801062ef:	55                   	push   %ebp
+801062f0:	89 e5                	mov    %esp,%ebp
+801062f2:	56                   	push   %esi
+801062f3:	53                   	push   %ebx
+  struct proc *p = myproc();
+801062f4:	e8 df f6 ff ff       	call   801059d8 <myproc>
+801062f9:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+801062fb:	83 ec 0c             	sub    $0xc,%esp
+801062fe:	68 40 7f 14 80       	push   $0x80147f40
+80106303:	e8 d6 18 00 00       	call   80107bde <holding>
+80106308:	83 c4 10             	add    $0x10,%esp
+8010630b:	85 c0                	test   %eax,%eax
+8010630d:	74 4f                	je     8010635e <sched+0x6f>
+  if(mycpu()->ncli != 1)
+8010630f:	e8 4d f6 ff ff       	call   80105961 <mycpu>
+80106314:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+8010631b:	75 4e                	jne    8010636b <sched+0x7c>
+  if(p->state == RUNNING)
+8010631d:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80106321:	74 55                	je     80106378 <sched+0x89>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106323:	9c                   	pushf
+80106324:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106325:	f6 c4 02             	test   $0x2,%ah
+80106328:	75 5b                	jne    80106385 <sched+0x96>
+  intena = mycpu()->intena;
+8010632a:	e8 32 f6 ff ff       	call   80105961 <mycpu>
+8010632f:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80106335:	e8 27 f6 ff ff       	call   80105961 <mycpu>
+8010633a:	83 ec 08             	sub    $0x8,%esp
+8010633d:	ff 70 04             	push   0x4(%eax)
+80106340:	83 c3 1c             	add    $0x1c,%ebx
+80106343:	53                   	push   %ebx
+80106344:	e8 6f 1b 00 00       	call   80107eb8 <swtch>
+  mycpu()->intena = intena;
+80106349:	e8 13 f6 ff ff       	call   80105961 <mycpu>
+8010634e:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80106354:	83 c4 10             	add    $0x10,%esp
+80106357:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010635a:	5b                   	pop    %ebx
+8010635b:	5e                   	pop    %esi
+8010635c:	5d                   	pop    %ebp
+8010635d:	c3                   	ret
+    panic("sched ptable.lock");
+8010635e:	83 ec 0c             	sub    $0xc,%esp
+80106361:	68 8a b4 10 80       	push   $0x8010b48a
+80106366:	e8 97 a5 ff ff       	call   80100902 <panic>
+    panic("sched locks");
+8010636b:	83 ec 0c             	sub    $0xc,%esp
+8010636e:	68 9c b4 10 80       	push   $0x8010b49c
+80106373:	e8 8a a5 ff ff       	call   80100902 <panic>
+    panic("sched running");
+80106378:	83 ec 0c             	sub    $0xc,%esp
+8010637b:	68 a8 b4 10 80       	push   $0x8010b4a8
+80106380:	e8 7d a5 ff ff       	call   80100902 <panic>
+    panic("sched interruptible");
+80106385:	83 ec 0c             	sub    $0xc,%esp
+80106388:	68 b6 b4 10 80       	push   $0x8010b4b6
+8010638d:	e8 70 a5 ff ff       	call   80100902 <panic>
+
+80106392 <exit>:
+{
+80106392:	55                   	push   %ebp
+80106393:	89 e5                	mov    %esp,%ebp
+80106395:	56                   	push   %esi
+80106396:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80106397:	e8 3c f6 ff ff       	call   801059d8 <myproc>
+  if(curproc == initproc)
+8010639c:	39 05 9c 07 15 80    	cmp    %eax,0x8015079c
+801063a2:	74 09                	je     801063ad <exit+0x1b>
+801063a4:	89 c6                	mov    %eax,%esi
+  for(fd = 0; fd < NOFILE; fd++){
+801063a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+801063ab:	eb 24                	jmp    801063d1 <exit+0x3f>
+    panic("init exiting");
+801063ad:	83 ec 0c             	sub    $0xc,%esp
+801063b0:	68 ca b4 10 80       	push   $0x8010b4ca
+801063b5:	e8 48 a5 ff ff       	call   80100902 <panic>
+      fileclose(curproc->ofile[fd]);
+801063ba:	83 ec 0c             	sub    $0xc,%esp
+801063bd:	50                   	push   %eax
+801063be:	e8 d6 b1 ff ff       	call   80101599 <fileclose>
+      curproc->ofile[fd] = 0;
+801063c3:	c7 44 9e 28 00 00 00 	movl   $0x0,0x28(%esi,%ebx,4)
+801063ca:	00 
+801063cb:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+801063ce:	83 c3 01             	add    $0x1,%ebx
+801063d1:	83 fb 0f             	cmp    $0xf,%ebx
+801063d4:	7f 0a                	jg     801063e0 <exit+0x4e>
+    if(curproc->ofile[fd]){
+801063d6:	8b 44 9e 28          	mov    0x28(%esi,%ebx,4),%eax
+801063da:	85 c0                	test   %eax,%eax
+801063dc:	75 dc                	jne    801063ba <exit+0x28>
+801063de:	eb ee                	jmp    801063ce <exit+0x3c>
+  begin_op();
+801063e0:	e8 fc df ff ff       	call   801043e1 <begin_op>
+  iput(curproc->cwd);
+801063e5:	83 ec 0c             	sub    $0xc,%esp
+801063e8:	ff 76 68             	push   0x68(%esi)
+801063eb:	e8 f5 be ff ff       	call   801022e5 <iput>
+  if(curproc->exeip){
+801063f0:	8b 86 c8 00 00 00    	mov    0xc8(%esi),%eax
+801063f6:	83 c4 10             	add    $0x10,%esp
+801063f9:	85 c0                	test   %eax,%eax
+801063fb:	74 1c                	je     80106419 <exit+0x87>
+    iexec(curproc->exeip, -1);
+801063fd:	83 ec 08             	sub    $0x8,%esp
+80106400:	6a ff                	push   $0xffffffff
+80106402:	50                   	push   %eax
+80106403:	e8 a6 bd ff ff       	call   801021ae <iexec>
+    iput(curproc->exeip);
+80106408:	83 c4 04             	add    $0x4,%esp
+8010640b:	ff b6 c8 00 00 00    	push   0xc8(%esi)
+80106411:	e8 cf be ff ff       	call   801022e5 <iput>
+80106416:	83 c4 10             	add    $0x10,%esp
+  end_op();
+80106419:	e8 4d e0 ff ff       	call   8010446b <end_op>
+  curproc->cwd = 0;
+8010641e:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+  curproc->exeip = 0;
+80106425:	c7 86 c8 00 00 00 00 	movl   $0x0,0xc8(%esi)
+8010642c:	00 00 00 
+  acquire(&ptable.lock);
+8010642f:	83 ec 0c             	sub    $0xc,%esp
+80106432:	68 40 7f 14 80       	push   $0x80147f40
+80106437:	e8 e1 17 00 00       	call   80107c1d <acquire>
+  wakeup1(curproc->parent);
+8010643c:	8b 46 14             	mov    0x14(%esi),%eax
+8010643f:	e8 81 f0 ff ff       	call   801054c5 <wakeup1>
+  while((p = curproc->children) != 0){
+80106444:	83 c4 10             	add    $0x10,%esp
+80106447:	8b 9e b8 00 00 00    	mov    0xb8(%esi),%ebx
+8010644d:	85 db                	test   %ebx,%ebx
+8010644f:	74 23                	je     80106474 <exit+0xe2>
+    sibunlink(&curproc->children, p);
+80106451:	8d 86 b8 00 00 00    	lea    0xb8(%esi),%eax
+80106457:	89 da                	mov    %ebx,%edx
+80106459:	e8 c4 ee ff ff       	call   80105322 <sibunlink>
+    p->parent = initproc;
+8010645e:	a1 9c 07 15 80       	mov    0x8015079c,%eax
+80106463:	89 43 14             	mov    %eax,0x14(%ebx)
+    siblink(&initproc->children, p);
+80106466:	05 b8 00 00 00       	add    $0xb8,%eax
+8010646b:	89 da                	mov    %ebx,%edx
+8010646d:	e8 91 ee ff ff       	call   80105303 <siblink>
+80106472:	eb d3                	jmp    80106447 <exit+0xb5>
+  if(curproc->zombies){
+80106474:	83 be bc 00 00 00 00 	cmpl   $0x0,0xbc(%esi)
+8010647b:	74 37                	je     801064b4 <exit+0x122>
+    while((p = curproc->zombies) != 0){
+8010647d:	8b 9e bc 00 00 00    	mov    0xbc(%esi),%ebx
+80106483:	85 db                	test   %ebx,%ebx
+80106485:	74 23                	je     801064aa <exit+0x118>
+      sibunlink(&curproc->zombies, p);
+80106487:	8d 86 bc 00 00 00    	lea    0xbc(%esi),%eax
+8010648d:	89 da                	mov    %ebx,%edx
+8010648f:	e8 8e ee ff ff       	call   80105322 <sibunlink>
+      p->parent = initproc;
+80106494:	a1 9c 07 15 80       	mov    0x8015079c,%eax
+80106499:	89 43 14             	mov    %eax,0x14(%ebx)
+      siblink(&initproc->zombies, p);
+8010649c:	05 bc 00 00 00       	add    $0xbc,%eax
+801064a1:	89 da                	mov    %ebx,%edx
+801064a3:	e8 5b ee ff ff       	call   80105303 <siblink>
+801064a8:	eb d3                	jmp    8010647d <exit+0xeb>
+    wakeup1(initproc);
+801064aa:	a1 9c 07 15 80       	mov    0x8015079c,%eax
+801064af:	e8 11 f0 ff ff       	call   801054c5 <wakeup1>
+  sibunlink(&curproc->parent->children, curproc);
+801064b4:	8b 46 14             	mov    0x14(%esi),%eax
+801064b7:	05 b8 00 00 00       	add    $0xb8,%eax
+801064bc:	89 f2                	mov    %esi,%edx
+801064be:	e8 5f ee ff ff       	call   80105322 <sibunlink>
+  siblink(&curproc->parent->zombies, curproc);
+801064c3:	8b 46 14             	mov    0x14(%esi),%eax
+801064c6:	05 bc 00 00 00       	add    $0xbc,%eax
+801064cb:	89 f2                	mov    %esi,%edx
+801064cd:	e8 31 ee ff ff       	call   80105303 <siblink>
+  curproc->state = ZOMBIE;
+801064d2:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  sched();
+801064d9:	e8 11 fe ff ff       	call   801062ef <sched>
+  panic("zombie exit");
+801064de:	83 ec 0c             	sub    $0xc,%esp
+801064e1:	68 d7 b4 10 80       	push   $0x8010b4d7
+801064e6:	e8 17 a4 ff ff       	call   80100902 <panic>
+
+801064eb <yield>:
+{
+801064eb:	55                   	push   %ebp
+801064ec:	89 e5                	mov    %esp,%ebp
+801064ee:	53                   	push   %ebx
+801064ef:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+801064f2:	68 40 7f 14 80       	push   $0x80147f40
+801064f7:	e8 21 17 00 00       	call   80107c1d <acquire>
+  setrunnable(myproc());
+801064fc:	e8 d7 f4 ff ff       	call   801059d8 <myproc>
+80106501:	e8 95 ef ff ff       	call   8010549b <setrunnable>
+  dbgprintf(YIELD_DBG_LINES, "[%d] Ticks Left: %d\n", myproc()->pid, myproc()->ticks_left);
+80106506:	e8 cd f4 ff ff       	call   801059d8 <myproc>
+8010650b:	8b 98 84 00 00 00    	mov    0x84(%eax),%ebx
+80106511:	e8 c2 f4 ff ff       	call   801059d8 <myproc>
+80106516:	53                   	push   %ebx
+80106517:	ff 70 10             	push   0x10(%eax)
+8010651a:	68 e3 b4 10 80       	push   $0x8010b4e3
+8010651f:	6a 00                	push   $0x0
+80106521:	e8 9d a6 ff ff       	call   80100bc3 <dbgprintf>
+  if (myproc()->ticks_left <= 0) {
+80106526:	83 c4 20             	add    $0x20,%esp
+80106529:	e8 aa f4 ff ff       	call   801059d8 <myproc>
+8010652e:	83 b8 84 00 00 00 00 	cmpl   $0x0,0x84(%eax)
+80106535:	7e 1a                	jle    80106551 <yield+0x66>
+  sched();
+80106537:	e8 b3 fd ff ff       	call   801062ef <sched>
+  release(&ptable.lock);
+8010653c:	83 ec 0c             	sub    $0xc,%esp
+8010653f:	68 40 7f 14 80       	push   $0x80147f40
+80106544:	e8 53 17 00 00       	call   80107c9c <release>
+}
+80106549:	83 c4 10             	add    $0x10,%esp
+8010654c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010654f:	c9                   	leave
+80106550:	c3                   	ret
+    dbgprintf(YIELD_DBG_LINES, "[%d] QUANTUM CONSUMED, UPDATE VDEADLINE\n", myproc()->pid);
+80106551:	e8 82 f4 ff ff       	call   801059d8 <myproc>
+80106556:	83 ec 04             	sub    $0x4,%esp
+80106559:	ff 70 10             	push   0x10(%eax)
+8010655c:	68 4c b6 10 80       	push   $0x8010b64c
+80106561:	6a 00                	push   $0x0
+80106563:	e8 5b a6 ff ff       	call   80100bc3 <dbgprintf>
+    newdeadline(myproc());
+80106568:	e8 6b f4 ff ff       	call   801059d8 <myproc>
+8010656d:	e8 40 ed ff ff       	call   801052b2 <newdeadline>
+80106572:	83 c4 10             	add    $0x10,%esp
+80106575:	eb c0                	jmp    80106537 <yield+0x4c>
+
+80106577 <sleep>:
+{
+80106577:	55                   	push   %ebp
+80106578:	89 e5                	mov    %esp,%ebp
+8010657a:	56                   	push   %esi
+8010657b:	53                   	push   %ebx
+8010657c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+8010657f:	e8 54 f4 ff ff       	call   801059d8 <myproc>
+  if(p == 0)
+80106584:	85 c0                	test   %eax,%eax
+80106586:	74 6d                	je     801065f5 <sleep+0x7e>
+80106588:	89 c3                	mov    %eax,%ebx
+  if(lk == 0)
+8010658a:	85 f6                	test   %esi,%esi
+8010658c:	74 74                	je     80106602 <sleep+0x8b>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+8010658e:	81 fe 40 7f 14 80    	cmp    $0x80147f40,%esi
+80106594:	74 18                	je     801065ae <sleep+0x37>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80106596:	83 ec 0c             	sub    $0xc,%esp
+80106599:	68 40 7f 14 80       	push   $0x80147f40
+8010659e:	e8 7a 16 00 00       	call   80107c1d <acquire>
+    release(lk);
+801065a3:	89 34 24             	mov    %esi,(%esp)
+801065a6:	e8 f1 16 00 00       	call   80107c9c <release>
+801065ab:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+801065ae:	8b 45 08             	mov    0x8(%ebp),%eax
+801065b1:	89 43 20             	mov    %eax,0x20(%ebx)
+  p->state = SLEEPING;
+801065b4:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  chanlink(p);
+801065bb:	89 d8                	mov    %ebx,%eax
+801065bd:	e8 ab ed ff ff       	call   8010536d <chanlink>
+  sched();
+801065c2:	e8 28 fd ff ff       	call   801062ef <sched>
+  p->chan = 0;
+801065c7:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+801065ce:	81 fe 40 7f 14 80    	cmp    $0x80147f40,%esi
+801065d4:	74 18                	je     801065ee <sleep+0x77>
+    release(&ptable.lock);
+801065d6:	83 ec 0c             	sub    $0xc,%esp
+801065d9:	68 40 7f 14 80       	push   $0x80147f40
+801065de:	e8 b9 16 00 00       	call   80107c9c <release>
+    acquire(lk);
+801065e3:	89 34 24             	mov    %esi,(%esp)
+801065e6:	e8 32 16 00 00       	call   80107c1d <acquire>
+801065eb:	83 c4 10             	add    $0x10,%esp
+}
+801065ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801065f1:	5b                   	pop    %ebx
+801065f2:	5e                   	pop    %esi
+801065f3:	5d                   	pop    %ebp
+801065f4:	c3                   	ret
+    panic("sleep");
+801065f5:	83 ec 0c             	sub    $0xc,%esp
+801065f8:	68 f8 b4 10 80       	push   $0x8010b4f8
+801065fd:	e8 00 a3 ff ff       	call   80100902 <panic>
+    panic("sleep without lk");
+80106602:	83 ec 0c             	sub    $0xc,%esp
+80106605:	68 fe b4 10 80       	push   $0x8010b4fe
+8010660a:	e8 f3 a2 ff ff       	call   80100902 <panic>
+
+8010660f <wait>:
+{
+8010660f:	55                   	push   %ebp
+80106610:	89 e5                	mov    %esp,%ebp
+80106612:	56                   	push   %esi
+80106613:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80106614:	e8 bf f3 ff ff       	call   801059d8 <myproc>
+80106619:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+8010661b:	83 ec 0c             	sub    $0xc,%esp
+8010661e:	68 40 7f 14 80       	push   $0x80147f40
+80106623:	e8 f5 15 00 00       	call   80107c1d <acquire>
+80106628:	83 c4 10             	add    $0x10,%esp
+8010662b:	eb 68                	jmp    80106695 <wait+0x86>
+      sibunlink(&curproc->zombies, p);
+8010662d:	8d 83 bc 00 00 00    	lea    0xbc(%ebx),%eax
+80106633:	89 f2                	mov    %esi,%edx
+80106635:	e8 e8 ec ff ff       	call   80105322 <sibunlink>
+      release(&ptable.lock);
+8010663a:	83 ec 0c             	sub    $0xc,%esp
+8010663d:	68 40 7f 14 80       	push   $0x80147f40
+80106642:	e8 55 16 00 00       	call   80107c9c <release>
+      pid = p->pid;
+80106647:	8b 5e 10             	mov    0x10(%esi),%ebx
+      kfree(p->kstack);
+8010664a:	83 c4 04             	add    $0x4,%esp
+8010664d:	ff 76 08             	push   0x8(%esi)
+80106650:	e8 df ce ff ff       	call   80103534 <kfree>
+      freevm(p->pgdir);
+80106655:	83 c4 04             	add    $0x4,%esp
+80106658:	ff 76 04             	push   0x4(%esi)
+8010665b:	e8 f5 40 00 00       	call   8010a755 <freevm>
+      acquire(&ptable.lock);
+80106660:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+80106667:	e8 b1 15 00 00       	call   80107c1d <acquire>
+      freeproc(p);
+8010666c:	89 f0                	mov    %esi,%eax
+8010666e:	e8 98 ee ff ff       	call   8010550b <freeproc>
+      release(&ptable.lock);
+80106673:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+8010667a:	e8 1d 16 00 00       	call   80107c9c <release>
+      return pid;
+8010667f:	83 c4 10             	add    $0x10,%esp
+80106682:	eb 3f                	jmp    801066c3 <wait+0xb4>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80106684:	83 ec 08             	sub    $0x8,%esp
+80106687:	68 40 7f 14 80       	push   $0x80147f40
+8010668c:	53                   	push   %ebx
+8010668d:	e8 e5 fe ff ff       	call   80106577 <sleep>
+    if((p = curproc->zombies) != 0){
+80106692:	83 c4 10             	add    $0x10,%esp
+80106695:	8b b3 bc 00 00 00    	mov    0xbc(%ebx),%esi
+8010669b:	85 f6                	test   %esi,%esi
+8010669d:	75 8e                	jne    8010662d <wait+0x1e>
+    if(curproc->children == 0 || curproc->killed){
+8010669f:	83 bb b8 00 00 00 00 	cmpl   $0x0,0xb8(%ebx)
+801066a6:	74 06                	je     801066ae <wait+0x9f>
+801066a8:	83 7b 24 00          	cmpl   $0x0,0x24(%ebx)
+801066ac:	74 d6                	je     80106684 <wait+0x75>
+      release(&ptable.lock);
+801066ae:	83 ec 0c             	sub    $0xc,%esp
+801066b1:	68 40 7f 14 80       	push   $0x80147f40
+801066b6:	e8 e1 15 00 00       	call   80107c9c <release>
+      return -1;
+801066bb:	83 c4 10             	add    $0x10,%esp
+801066be:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801066c3:	89 d8                	mov    %ebx,%eax
+801066c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801066c8:	5b                   	pop    %ebx
+801066c9:	5e                   	pop    %esi
+801066ca:	5d                   	pop    %ebp
+801066cb:	c3                   	ret
+
+801066cc <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+801066cc:	55                   	push   %ebp
+801066cd:	89 e5                	mov    %esp,%ebp
+801066cf:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+801066d2:	68 40 7f 14 80       	push   $0x80147f40
+801066d7:	e8 41 15 00 00       	call   80107c1d <acquire>
+  wakeup1(chan);
+801066dc:	8b 45 08             	mov    0x8(%ebp),%eax
+801066df:	e8 e1 ed ff ff       	call   801054c5 <wakeup1>
+  release(&ptable.lock);
+801066e4:	c7 04 24 40 7f 14 80 	movl   $0x80147f40,(%esp)
+801066eb:	e8 ac 15 00 00       	call   80107c9c <release>
+}
+801066f0:	83 c4 10             	add    $0x10,%esp
+801066f3:	c9                   	leave
+801066f4:	c3                   	ret
+
+801066f5 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+801066f5:	55                   	push   %ebp
+801066f6:	89 e5                	mov    %esp,%ebp
+801066f8:	53                   	push   %ebx
+801066f9:	83 ec 10             	sub    $0x10,%esp
+  struct proc *p;
+
+  acquire(&ptable.lock);
+801066fc:	68 40 7f 14 80       	push   $0x80147f40
+80106701:	e8 17 15 00 00       	call   80107c1d <acquire>
+  if((p = findproc(pid)) != 0){
+80106706:	83 c4 04             	add    $0x4,%esp
+80106709:	ff 75 08             	push   0x8(%ebp)
+8010670c:	e8 2d f2 ff ff       	call   8010593e <findproc>
+80106711:	83 c4 10             	add    $0x10,%esp
+80106714:	85 c0                	test   %eax,%eax
+80106716:	74 37                	je     8010674f <kill+0x5a>
+80106718:	89 c3                	mov    %eax,%ebx
+    p->killed = 1;
+8010671a:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING){
+80106721:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80106725:	74 1a                	je     80106741 <kill+0x4c>
+      chanunlink(p);
+      setrunnable(p);
+    }
+    release(&ptable.lock);
+80106727:	83 ec 0c             	sub    $0xc,%esp
+8010672a:	68 40 7f 14 80       	push   $0x80147f40
+8010672f:	e8 68 15 00 00       	call   80107c9c <release>
+    return 0;
+80106734:	83 c4 10             	add    $0x10,%esp
+80106737:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  release(&ptable.lock);
+  return -1;
+}
+8010673c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010673f:	c9                   	leave
+80106740:	c3                   	ret
+      chanunlink(p);
+80106741:	e8 5a ec ff ff       	call   801053a0 <chanunlink>
+      setrunnable(p);
+80106746:	89 d8                	mov    %ebx,%eax
+80106748:	e8 4e ed ff ff       	call   8010549b <setrunnable>
+8010674d:	eb d8                	jmp    80106727 <kill+0x32>
+  release(&ptable.lock);
+8010674f:	83 ec 0c             	sub    $0xc,%esp
+80106752:	68 40 7f 14 80       	push   $0x80147f40
+80106757:	e8 40 15 00 00       	call   80107c9c <release>
+  return -1;
+8010675c:	83 c4 10             	add    $0x10,%esp
+8010675f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106764:	eb d6                	jmp    8010673c <kill+0x47>
+
+80106766 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80106766:	55                   	push   %ebp
+80106767:	89 e5                	mov    %esp,%ebp
+80106769:	56                   	push   %esi
+8010676a:	53                   	push   %ebx
+8010676b:	83 ec 30             	sub    $0x30,%esp
+  int i;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  for(p = ptable.all; p; p = p->allnext){
+8010676e:	8b 1d 94 ff 14 80    	mov    0x8014ff94,%ebx
+80106774:	eb 36                	jmp    801067ac <procdump+0x46>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+80106776:	b8 0f b5 10 80       	mov    $0x8010b50f,%eax
+    cprintf("%d %s %s", p->pid, state, p->name);
+8010677b:	8d 53 6c             	lea    0x6c(%ebx),%edx
+8010677e:	52                   	push   %edx
+8010677f:	50                   	push   %eax
+80106780:	ff 73 10             	push   0x10(%ebx)
+80106783:	68 13 b5 10 80       	push   $0x8010b513
+80106788:	e8 6c a5 ff ff       	call   80100cf9 <cprintf>
+    if(p->state == SLEEPING){
+8010678d:	83 c4 10             	add    $0x10,%esp
+80106790:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80106794:	74 34                	je     801067ca <procdump+0x64>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80106796:	83 ec 0c             	sub    $0xc,%esp
+80106799:	68 ab c0 10 80       	push   $0x8010c0ab
+8010679e:	e8 56 a5 ff ff       	call   80100cf9 <cprintf>
+  for(p = ptable.all; p; p = p->allnext){
+801067a3:	8b 9b a4 00 00 00    	mov    0xa4(%ebx),%ebx
+801067a9:	83 c4 10             	add    $0x10,%esp
+801067ac:	85 db                	test   %ebx,%ebx
+801067ae:	74 5d                	je     8010680d <procdump+0xa7>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801067b0:	8b 43 0c             	mov    0xc(%ebx),%eax
+801067b3:	83 f8 05             	cmp    $0x5,%eax
+801067b6:	77 be                	ja     80106776 <procdump+0x10>
+801067b8:	8b 04 85 78 b6 10 80 	mov    -0x7fef4988(,%eax,4),%eax
+801067bf:	85 c0                	test   %eax,%eax
+801067c1:	75 b8                	jne    8010677b <procdump+0x15>
+      state = "???";
+801067c3:	b8 0f b5 10 80       	mov    $0x8010b50f,%eax
+801067c8:	eb b1                	jmp    8010677b <procdump+0x15>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+801067ca:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801067cd:	8b 40 0c             	mov    0xc(%eax),%eax
+801067d0:	83 c0 08             	add    $0x8,%eax
+801067d3:	83 ec 08             	sub    $0x8,%esp
+801067d6:	8d 55 d0             	lea    -0x30(%ebp),%edx
+801067d9:	52                   	push   %edx
+801067da:	50                   	push   %eax
+801067db:	e8 14 13 00 00       	call   80107af4 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+801067e0:	83 c4 10             	add    $0x10,%esp
+801067e3:	be 00 00 00 00       	mov    $0x0,%esi
+801067e8:	eb 14                	jmp    801067fe <procdump+0x98>
+        cprintf(" %p", pc[i]);
+801067ea:	83 ec 08             	sub    $0x8,%esp
+801067ed:	50                   	push   %eax
+801067ee:	68 a0 ad 10 80       	push   $0x8010ada0
+801067f3:	e8 01 a5 ff ff       	call   80100cf9 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+801067f8:	83 c6 01             	add    $0x1,%esi
+801067fb:	83 c4 10             	add    $0x10,%esp
+801067fe:	83 fe 09             	cmp    $0x9,%esi
+80106801:	7f 93                	jg     80106796 <procdump+0x30>
+80106803:	8b 44 b5 d0          	mov    -0x30(%ebp,%esi,4),%eax
+80106807:	85 c0                	test   %eax,%eax
+80106809:	75 df                	jne    801067ea <procdump+0x84>
+8010680b:	eb 89                	jmp    80106796 <procdump+0x30>
+  }
+}
+8010680d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106810:	5b                   	pop    %ebx
+80106811:	5e                   	pop    %esi
+80106812:	5d                   	pop    %ebp
+80106813:	c3                   	ret
+
+80106814 <linsert>:
+} bq;
+
+// Insert p into a deadline-sorted list, after any equal deadlines.
+static void
+linsert(struct proc **head, struct proc *p)
+{
+80106814:	55                   	push   %ebp
+80106815:	89 e5                	mov    %esp,%ebp
+80106817:	56                   	push   %esi
+80106818:	53                   	push   %ebx
+  struct proc *q, *prev = 0;
+
+  for(q = *head; q && q->vdeadline <= p->vdeadline; q = q->rqnext)
+80106819:	8b 08                	mov    (%eax),%ecx
+  struct proc *q, *prev = 0;
+8010681b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(q = *head; q && q->vdeadline <= p->vdeadline; q = q->rqnext)
+80106820:	eb 08                	jmp    8010682a <linsert+0x16>
+    prev = q;
+80106822:	89 cb                	mov    %ecx,%ebx
+  for(q = *head; q && q->vdeadline <= p->vdeadline; q = q->rqnext)
+80106824:	8b 89 98 00 00 00    	mov    0x98(%ecx),%ecx
+8010682a:	85 c9                	test   %ecx,%ecx
+8010682c:	74 0e                	je     8010683c <linsert+0x28>
+8010682e:	8b b2 80 00 00 00    	mov    0x80(%edx),%esi
+80106834:	39 b1 80 00 00 00    	cmp    %esi,0x80(%ecx)
+8010683a:	7e e6                	jle    80106822 <linsert+0xe>
+  p->rqprev = prev;
+8010683c:	89 9a 9c 00 00 00    	mov    %ebx,0x9c(%edx)
+  p->rqnext = q;
+80106842:	89 8a 98 00 00 00    	mov    %ecx,0x98(%edx)
+  if(q)
+80106848:	85 c9                	test   %ecx,%ecx
+8010684a:	74 06                	je     80106852 <linsert+0x3e>
+    q->rqprev = p;
+8010684c:	89 91 9c 00 00 00    	mov    %edx,0x9c(%ecx)
+  if(prev)
+80106852:	85 db                	test   %ebx,%ebx
+80106854:	74 0a                	je     80106860 <linsert+0x4c>
+    prev->rqnext = p;
+80106856:	89 93 98 00 00 00    	mov    %edx,0x98(%ebx)
+  else
+    *head = p;
+}
+8010685c:	5b                   	pop    %ebx
+8010685d:	5e                   	pop    %esi
+8010685e:	5d                   	pop    %ebp
+8010685f:	c3                   	ret
+    *head = p;
+80106860:	89 10                	mov    %edx,(%eax)
+}
+80106862:	eb f8                	jmp    8010685c <linsert+0x48>
+
+80106864 <lremove>:
+
+static void
+lremove(struct proc **head, struct proc *p)
+{
+  if(p->rqprev)
+80106864:	8b 8a 9c 00 00 00    	mov    0x9c(%edx),%ecx
+8010686a:	85 c9                	test   %ecx,%ecx
+8010686c:	74 37                	je     801068a5 <lremove+0x41>
+    p->rqprev->rqnext = p->rqnext;
+8010686e:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+80106874:	89 81 98 00 00 00    	mov    %eax,0x98(%ecx)
+  else
+    *head = p->rqnext;
+  if(p->rqnext)
+8010687a:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+80106880:	85 c0                	test   %eax,%eax
+80106882:	74 0c                	je     80106890 <lremove+0x2c>
+    p->rqnext->rqprev = p->rqprev;
+80106884:	8b 8a 9c 00 00 00    	mov    0x9c(%edx),%ecx
+8010688a:	89 88 9c 00 00 00    	mov    %ecx,0x9c(%eax)
+  p->rqnext = p->rqprev = 0;
+80106890:	c7 82 9c 00 00 00 00 	movl   $0x0,0x9c(%edx)
+80106897:	00 00 00 
+8010689a:	c7 82 98 00 00 00 00 	movl   $0x0,0x98(%edx)
+801068a1:	00 00 00 
+}
+801068a4:	c3                   	ret
+    *head = p->rqnext;
+801068a5:	8b 8a 98 00 00 00    	mov    0x98(%edx),%ecx
+801068ab:	89 08                	mov    %ecx,(%eax)
+801068ad:	eb cb                	jmp    8010687a <lremove+0x16>
+
+801068af <binsert>:
+
+static void
+binsert(struct proc *p, int k)
+{
+801068af:	55                   	push   %ebp
+801068b0:	89 e5                	mov    %esp,%ebp
+801068b2:	53                   	push   %ebx
+801068b3:	83 ec 04             	sub    $0x4,%esp
+801068b6:	89 c3                	mov    %eax,%ebx
+  p->rqidx = SLOT(k);
+801068b8:	83 e2 1f             	and    $0x1f,%edx
+801068bb:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+  linsert(&bq.bucket[p->rqidx], p);
+801068c1:	8d 04 95 a0 07 15 80 	lea    -0x7feaf860(,%edx,4),%eax
+801068c8:	89 da                	mov    %ebx,%edx
+801068ca:	e8 45 ff ff ff       	call   80106814 <linsert>
+  bq.bitmap |= 1u << p->rqidx;
+801068cf:	8b 8b 94 00 00 00    	mov    0x94(%ebx),%ecx
+801068d5:	b8 01 00 00 00       	mov    $0x1,%eax
+801068da:	d3 e0                	shl    %cl,%eax
+801068dc:	09 05 20 08 15 80    	or     %eax,0x80150820
+  bq.n++;
+801068e2:	a1 28 08 15 80       	mov    0x80150828,%eax
+801068e7:	83 c0 01             	add    $0x1,%eax
+801068ea:	a3 28 08 15 80       	mov    %eax,0x80150828
+}
+801068ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801068f2:	c9                   	leave
+801068f3:	c3                   	ret
+
+801068f4 <bucketinsert>:
+  memset(&bq, 0, sizeof(bq));
+}
+
+static int
+bucketinsert(struct proc *p)
+{
+801068f4:	55                   	push   %ebp
+801068f5:	89 e5                	mov    %esp,%ebp
+801068f7:	83 ec 08             	sub    $0x8,%esp
+801068fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int k = KEY(p->vdeadline);
+801068fd:	8b 91 80 00 00 00    	mov    0x80(%ecx),%edx
+80106903:	c1 fa 07             	sar    $0x7,%edx
+
+  if(bq.n == 0)
+80106906:	83 3d 28 08 15 80 00 	cmpl   $0x0,0x80150828
+8010690d:	75 06                	jne    80106915 <bucketinsert+0x21>
+    bq.basekey = k;
+8010690f:	89 15 24 08 15 80    	mov    %edx,0x80150824
+  if(k < bq.basekey)
+80106915:	a1 24 08 15 80       	mov    0x80150824,%eax
+8010691a:	39 d0                	cmp    %edx,%eax
+8010691c:	7e 02                	jle    80106920 <bucketinsert+0x2c>
+    k = bq.basekey;
+8010691e:	89 c2                	mov    %eax,%edx
+  if(k >= bq.basekey + NBUCKET){
+80106920:	83 c0 1f             	add    $0x1f,%eax
+80106923:	39 d0                	cmp    %edx,%eax
+80106925:	7c 0e                	jl     80106935 <bucketinsert+0x41>
+    p->rqidx = -1;
+    linsert(&bq.overflow, p);
+    return 0;
+  }
+  binsert(p, k);
+80106927:	89 c8                	mov    %ecx,%eax
+80106929:	e8 81 ff ff ff       	call   801068af <binsert>
+  return 0;
+}
+8010692e:	b8 00 00 00 00       	mov    $0x0,%eax
+80106933:	c9                   	leave
+80106934:	c3                   	ret
+    p->rqidx = -1;
+80106935:	c7 81 94 00 00 00 ff 	movl   $0xffffffff,0x94(%ecx)
+8010693c:	ff ff ff 
+    linsert(&bq.overflow, p);
+8010693f:	89 ca                	mov    %ecx,%edx
+80106941:	b8 2c 08 15 80       	mov    $0x8015082c,%eax
+80106946:	e8 c9 fe ff ff       	call   80106814 <linsert>
+    return 0;
+8010694b:	eb e1                	jmp    8010692e <bucketinsert+0x3a>
+
+8010694d <bucketpeekmin>:
+}
+
+static struct proc*
+bucketpeekmin(void)
+{
+  if(bq.n == 0)
+8010694d:	83 3d 28 08 15 80 00 	cmpl   $0x0,0x80150828
+80106954:	74 10                	je     80106966 <bucketpeekmin+0x19>
+    return 0;
+  return bq.bucket[SLOT(bq.basekey)];
+80106956:	a1 24 08 15 80       	mov    0x80150824,%eax
+8010695b:	83 e0 1f             	and    $0x1f,%eax
+8010695e:	8b 04 85 a0 07 15 80 	mov    -0x7feaf860(,%eax,4),%eax
+80106965:	c3                   	ret
+    return 0;
+80106966:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010696b:	c3                   	ret
+
+8010696c <rebase>:
+  if(bq.bitmap == 0){
+8010696c:	a1 20 08 15 80       	mov    0x80150820,%eax
+80106971:	85 c0                	test   %eax,%eax
+80106973:	75 19                	jne    8010698e <rebase+0x22>
+    if(bq.overflow == 0)
+80106975:	a1 2c 08 15 80       	mov    0x8015082c,%eax
+8010697a:	85 c0                	test   %eax,%eax
+8010697c:	74 74                	je     801069f2 <rebase+0x86>
+    bq.basekey = KEY(bq.overflow->vdeadline);
+8010697e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80106984:	c1 f8 07             	sar    $0x7,%eax
+80106987:	a3 24 08 15 80       	mov    %eax,0x80150824
+8010698c:	eb 1b                	jmp    801069a9 <rebase+0x3d>
+    s = SLOT(bq.basekey);
+8010698e:	8b 15 24 08 15 80    	mov    0x80150824,%edx
+    rot = s ? (bq.bitmap >> s) | (bq.bitmap << (NBUCKET - s)) : bq.bitmap;
+80106994:	89 d1                	mov    %edx,%ecx
+80106996:	83 e1 1f             	and    $0x1f,%ecx
+80106999:	74 02                	je     8010699d <rebase+0x31>
+8010699b:	d3 c8                	ror    %cl,%eax
+    bq.basekey += __builtin_ctz(rot);
+8010699d:	f3 0f bc c0          	tzcnt  %eax,%eax
+801069a1:	01 c2                	add    %eax,%edx
+801069a3:	89 15 24 08 15 80    	mov    %edx,0x80150824
+{
+801069a9:	55                   	push   %ebp
+801069aa:	89 e5                	mov    %esp,%ebp
+801069ac:	53                   	push   %ebx
+801069ad:	83 ec 04             	sub    $0x4,%esp
+801069b0:	eb 1c                	jmp    801069ce <rebase+0x62>
+    lremove(&bq.overflow, p);
+801069b2:	89 da                	mov    %ebx,%edx
+801069b4:	b8 2c 08 15 80       	mov    $0x8015082c,%eax
+801069b9:	e8 a6 fe ff ff       	call   80106864 <lremove>
+    binsert(p, KEY(p->vdeadline));
+801069be:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+801069c4:	c1 fa 07             	sar    $0x7,%edx
+801069c7:	89 d8                	mov    %ebx,%eax
+801069c9:	e8 e1 fe ff ff       	call   801068af <binsert>
+  while((p = bq.overflow) != 0 && KEY(p->vdeadline) < bq.basekey + NBUCKET){
+801069ce:	8b 1d 2c 08 15 80    	mov    0x8015082c,%ebx
+801069d4:	85 db                	test   %ebx,%ebx
+801069d6:	74 15                	je     801069ed <rebase+0x81>
+801069d8:	a1 24 08 15 80       	mov    0x80150824,%eax
+801069dd:	8d 50 1f             	lea    0x1f(%eax),%edx
+801069e0:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801069e6:	c1 f8 07             	sar    $0x7,%eax
+801069e9:	39 c2                	cmp    %eax,%edx
+801069eb:	7d c5                	jge    801069b2 <rebase+0x46>
+}
+801069ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801069f0:	c9                   	leave
+801069f1:	c3                   	ret
+801069f2:	c3                   	ret
+
+801069f3 <bucketremove>:
+{
+801069f3:	55                   	push   %ebp
+801069f4:	89 e5                	mov    %esp,%ebp
+801069f6:	53                   	push   %ebx
+801069f7:	83 ec 04             	sub    $0x4,%esp
+801069fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  int s = p->rqidx;
+801069fd:	8b 9a 94 00 00 00    	mov    0x94(%edx),%ebx
+  if(s < 0){
+80106a03:	85 db                	test   %ebx,%ebx
+80106a05:	78 28                	js     80106a2f <bucketremove+0x3c>
+  lremove(&bq.bucket[s], p);
+80106a07:	8d 04 9d a0 07 15 80 	lea    -0x7feaf860(,%ebx,4),%eax
+80106a0e:	e8 51 fe ff ff       	call   80106864 <lremove>
+  bq.n--;
+80106a13:	a1 28 08 15 80       	mov    0x80150828,%eax
+80106a18:	83 e8 01             	sub    $0x1,%eax
+80106a1b:	a3 28 08 15 80       	mov    %eax,0x80150828
+  if(bq.bucket[s] == 0){
+80106a20:	83 3c 9d a0 07 15 80 	cmpl   $0x0,-0x7feaf860(,%ebx,4)
+80106a27:	00 
+80106a28:	74 11                	je     80106a3b <bucketremove+0x48>
+}
+80106a2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106a2d:	c9                   	leave
+80106a2e:	c3                   	ret
+    lremove(&bq.overflow, p);
+80106a2f:	b8 2c 08 15 80       	mov    $0x8015082c,%eax
+80106a34:	e8 2b fe ff ff       	call   80106864 <lremove>
+    return;
+80106a39:	eb ef                	jmp    80106a2a <bucketremove+0x37>
+    bq.bitmap &= ~(1u << s);
+80106a3b:	b8 01 00 00 00       	mov    $0x1,%eax
+80106a40:	89 d9                	mov    %ebx,%ecx
+80106a42:	d3 e0                	shl    %cl,%eax
+80106a44:	f7 d0                	not    %eax
+80106a46:	21 05 20 08 15 80    	and    %eax,0x80150820
+    if(s == SLOT(bq.basekey))
+80106a4c:	a1 24 08 15 80       	mov    0x80150824,%eax
+80106a51:	83 e0 1f             	and    $0x1f,%eax
+80106a54:	39 d8                	cmp    %ebx,%eax
+80106a56:	75 d2                	jne    80106a2a <bucketremove+0x37>
+      rebase();
+80106a58:	e8 0f ff ff ff       	call   8010696c <rebase>
+80106a5d:	eb cb                	jmp    80106a2a <bucketremove+0x37>
+
+80106a5f <bucketupdate>:
+
+static void
+bucketupdate(struct proc *p, int deadline)
+{
+80106a5f:	55                   	push   %ebp
+80106a60:	89 e5                	mov    %esp,%ebp
+80106a62:	53                   	push   %ebx
+80106a63:	83 ec 10             	sub    $0x10,%esp
+80106a66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bucketremove(p);
+80106a69:	53                   	push   %ebx
+80106a6a:	e8 84 ff ff ff       	call   801069f3 <bucketremove>
+  p->vdeadline = deadline;
+80106a6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106a72:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  bucketinsert(p);
+80106a78:	89 1c 24             	mov    %ebx,(%esp)
+80106a7b:	e8 74 fe ff ff       	call   801068f4 <bucketinsert>
+}
+80106a80:	83 c4 10             	add    $0x10,%esp
+80106a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106a86:	c9                   	leave
+80106a87:	c3                   	ret
+
+80106a88 <bucketinit>:
+{
+80106a88:	55                   	push   %ebp
+80106a89:	89 e5                	mov    %esp,%ebp
+80106a8b:	83 ec 0c             	sub    $0xc,%esp
+  memset(&bq, 0, sizeof(bq));
+80106a8e:	68 90 00 00 00       	push   $0x90
+80106a93:	6a 00                	push   $0x0
+80106a95:	68 a0 07 15 80       	push   $0x801507a0
+80106a9a:	e8 58 12 00 00       	call   80107cf7 <memset>
+}
+80106a9f:	83 c4 10             	add    $0x10,%esp
+80106aa2:	c9                   	leave
+80106aa3:	c3                   	ret
+
+80106aa4 <hset>:
+} hq;
+
+static void
+hset(int i, struct proc *p)
+{
+  hq.heap[i] = p;
+80106aa4:	89 14 85 40 08 15 80 	mov    %edx,-0x7feaf7c0(,%eax,4)
+  p->rqidx = i;
+80106aab:	89 82 94 00 00 00    	mov    %eax,0x94(%edx)
+}
+80106ab1:	c3                   	ret
+
+80106ab2 <siftup>:
+
+// Move the entry at i towards the root until its parent is earlier.
+static void
+siftup(int i)
+{
+80106ab2:	55                   	push   %ebp
+80106ab3:	89 e5                	mov    %esp,%ebp
+80106ab5:	56                   	push   %esi
+80106ab6:	53                   	push   %ebx
+  struct proc *p = hq.heap[i];
+80106ab7:	8b 34 85 40 08 15 80 	mov    -0x7feaf7c0(,%eax,4),%esi
+
+  while(i > 0 && hq.heap[(i-1)/2]->vdeadline > p->vdeadline){
+80106abe:	eb 07                	jmp    80106ac7 <siftup+0x15>
+    hset(i, hq.heap[(i-1)/2]);
+80106ac0:	e8 df ff ff ff       	call   80106aa4 <hset>
+    i = (i-1)/2;
+80106ac5:	89 d8                	mov    %ebx,%eax
+  while(i > 0 && hq.heap[(i-1)/2]->vdeadline > p->vdeadline){
+80106ac7:	85 c0                	test   %eax,%eax
+80106ac9:	7e 21                	jle    80106aec <siftup+0x3a>
+80106acb:	8d 50 ff             	lea    -0x1(%eax),%edx
+80106ace:	89 d3                	mov    %edx,%ebx
+80106ad0:	c1 eb 1f             	shr    $0x1f,%ebx
+80106ad3:	01 d3                	add    %edx,%ebx
+80106ad5:	d1 fb                	sar    %ebx
+80106ad7:	8b 14 9d 40 08 15 80 	mov    -0x7feaf7c0(,%ebx,4),%edx
+80106ade:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+80106ae4:	39 8a 80 00 00 00    	cmp    %ecx,0x80(%edx)
+80106aea:	7f d4                	jg     80106ac0 <siftup+0xe>
+  }
+  hset(i, p);
+80106aec:	89 f2                	mov    %esi,%edx
+80106aee:	e8 b1 ff ff ff       	call   80106aa4 <hset>
+}
+80106af3:	5b                   	pop    %ebx
+80106af4:	5e                   	pop    %esi
+80106af5:	5d                   	pop    %ebp
+80106af6:	c3                   	ret
+
+80106af7 <siftdown>:
+
+// Move the entry at i towards the leaves until both children are later.
+static void
+siftdown(int i)
+{
+80106af7:	55                   	push   %ebp
+80106af8:	89 e5                	mov    %esp,%ebp
+80106afa:	57                   	push   %edi
+80106afb:	56                   	push   %esi
+80106afc:	53                   	push   %ebx
+80106afd:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *p = hq.heap[i];
+80106b00:	8b 34 85 40 08 15 80 	mov    -0x7feaf7c0(,%eax,4),%esi
+80106b07:	eb 1c                	jmp    80106b25 <siftdown+0x2e>
+    c = 2*i + 1;
+    if(c >= hq.n)
+      break;
+    if(c+1 < hq.n && hq.heap[c+1]->vdeadline < hq.heap[c]->vdeadline)
+      c++;
+    if(hq.heap[c]->vdeadline >= p->vdeadline)
+80106b09:	8b 14 9d 40 08 15 80 	mov    -0x7feaf7c0(,%ebx,4),%edx
+80106b10:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+80106b16:	39 8a 80 00 00 00    	cmp    %ecx,0x80(%edx)
+80106b1c:	7d 3d                	jge    80106b5b <siftdown+0x64>
+      break;
+    hset(i, hq.heap[c]);
+80106b1e:	e8 81 ff ff ff       	call   80106aa4 <hset>
+    i = c;
+80106b23:	89 d8                	mov    %ebx,%eax
+    c = 2*i + 1;
+80106b25:	8d 5c 00 01          	lea    0x1(%eax,%eax,1),%ebx
+    if(c >= hq.n)
+80106b29:	8b 15 40 48 15 80    	mov    0x80154840,%edx
+80106b2f:	39 da                	cmp    %ebx,%edx
+80106b31:	7e 28                	jle    80106b5b <siftdown+0x64>
+    if(c+1 < hq.n && hq.heap[c+1]->vdeadline < hq.heap[c]->vdeadline)
+80106b33:	8d 4c 00 02          	lea    0x2(%eax,%eax,1),%ecx
+80106b37:	39 ca                	cmp    %ecx,%edx
+80106b39:	7e ce                	jle    80106b09 <siftdown+0x12>
+80106b3b:	8b 14 9d 40 08 15 80 	mov    -0x7feaf7c0(,%ebx,4),%edx
+80106b42:	8b 3c 8d 40 08 15 80 	mov    -0x7feaf7c0(,%ecx,4),%edi
+80106b49:	8b 92 80 00 00 00    	mov    0x80(%edx),%edx
+80106b4f:	39 97 80 00 00 00    	cmp    %edx,0x80(%edi)
+80106b55:	7d b2                	jge    80106b09 <siftdown+0x12>
+      c++;
+80106b57:	89 cb                	mov    %ecx,%ebx
+80106b59:	eb ae                	jmp    80106b09 <siftdown+0x12>
+  }
+  hset(i, p);
+80106b5b:	89 f2                	mov    %esi,%edx
+80106b5d:	e8 42 ff ff ff       	call   80106aa4 <hset>
+}
+80106b62:	83 c4 0c             	add    $0xc,%esp
+80106b65:	5b                   	pop    %ebx
+80106b66:	5e                   	pop    %esi
+80106b67:	5f                   	pop    %edi
+80106b68:	5d                   	pop    %ebp
+80106b69:	c3                   	ret
+
+80106b6a <heapinit>:
+
+static void
+heapinit(void)
+{
+  hq.n = 0;
+80106b6a:	c7 05 40 48 15 80 00 	movl   $0x0,0x80154840
+80106b71:	00 00 00 
+}
+80106b74:	c3                   	ret
+
+80106b75 <heapinsert>:
+
+static int
+heapinsert(struct proc *p)
+{
+80106b75:	55                   	push   %ebp
+80106b76:	89 e5                	mov    %esp,%ebp
+80106b78:	53                   	push   %ebx
+80106b79:	83 ec 04             	sub    $0x4,%esp
+80106b7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(hq.n == NPROC)
+80106b7f:	a1 40 48 15 80       	mov    0x80154840,%eax
+80106b84:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80106b89:	74 25                	je     80106bb0 <heapinsert+0x3b>
+    return -1;
+  hset(hq.n++, p);
+80106b8b:	8d 50 01             	lea    0x1(%eax),%edx
+80106b8e:	89 15 40 48 15 80    	mov    %edx,0x80154840
+80106b94:	89 da                	mov    %ebx,%edx
+80106b96:	e8 09 ff ff ff       	call   80106aa4 <hset>
+  siftup(p->rqidx);
+80106b9b:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80106ba1:	e8 0c ff ff ff       	call   80106ab2 <siftup>
+  return 0;
+80106ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106bab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106bae:	c9                   	leave
+80106baf:	c3                   	ret
+    return -1;
+80106bb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106bb5:	eb f4                	jmp    80106bab <heapinsert+0x36>
+
+80106bb7 <heappeekmin>:
+}
+
+static struct proc*
+heappeekmin(void)
+{
+  return hq.n > 0 ? hq.heap[0] : 0;
+80106bb7:	83 3d 40 48 15 80 00 	cmpl   $0x0,0x80154840
+80106bbe:	7e 06                	jle    80106bc6 <heappeekmin+0xf>
+80106bc0:	a1 40 08 15 80       	mov    0x80150840,%eax
+80106bc5:	c3                   	ret
+80106bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106bcb:	c3                   	ret
+
+80106bcc <heapupdate>:
+
+static void
+heapupdate(struct proc *p, int deadline)
+{
+80106bcc:	55                   	push   %ebp
+80106bcd:	89 e5                	mov    %esp,%ebp
+80106bcf:	53                   	push   %ebx
+80106bd0:	83 ec 04             	sub    $0x4,%esp
+80106bd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  p->vdeadline = deadline;
+80106bd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106bd9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  siftdown(p->rqidx);
+80106bdf:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80106be5:	e8 0d ff ff ff       	call   80106af7 <siftdown>
+  siftup(p->rqidx);
+80106bea:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80106bf0:	e8 bd fe ff ff       	call   80106ab2 <siftup>
+}
+80106bf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106bf8:	c9                   	leave
+80106bf9:	c3                   	ret
+
+80106bfa <heapremove>:
+{
+80106bfa:	55                   	push   %ebp
+80106bfb:	89 e5                	mov    %esp,%ebp
+80106bfd:	53                   	push   %ebx
+80106bfe:	83 ec 04             	sub    $0x4,%esp
+80106c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  int i = p->rqidx;
+80106c04:	8b 98 94 00 00 00    	mov    0x94(%eax),%ebx
+  if(i < 0 || i >= hq.n || hq.heap[i] != p)
+80106c0a:	85 db                	test   %ebx,%ebx
+80106c0c:	78 58                	js     80106c66 <heapremove+0x6c>
+80106c0e:	39 1d 40 48 15 80    	cmp    %ebx,0x80154840
+80106c14:	7e 50                	jle    80106c66 <heapremove+0x6c>
+80106c16:	39 04 9d 40 08 15 80 	cmp    %eax,-0x7feaf7c0(,%ebx,4)
+80106c1d:	75 47                	jne    80106c66 <heapremove+0x6c>
+  p->rqidx = -1;
+80106c1f:	c7 80 94 00 00 00 ff 	movl   $0xffffffff,0x94(%eax)
+80106c26:	ff ff ff 
+  if(i == --hq.n)
+80106c29:	a1 40 48 15 80       	mov    0x80154840,%eax
+80106c2e:	83 e8 01             	sub    $0x1,%eax
+80106c31:	a3 40 48 15 80       	mov    %eax,0x80154840
+80106c36:	39 d8                	cmp    %ebx,%eax
+80106c38:	74 27                	je     80106c61 <heapremove+0x67>
+  hset(i, hq.heap[hq.n]);
+80106c3a:	8b 14 85 40 08 15 80 	mov    -0x7feaf7c0(,%eax,4),%edx
+80106c41:	89 d8                	mov    %ebx,%eax
+80106c43:	e8 5c fe ff ff       	call   80106aa4 <hset>
+  siftdown(i);
+80106c48:	89 d8                	mov    %ebx,%eax
+80106c4a:	e8 a8 fe ff ff       	call   80106af7 <siftdown>
+  siftup(hq.heap[i]->rqidx);
+80106c4f:	8b 04 9d 40 08 15 80 	mov    -0x7feaf7c0(,%ebx,4),%eax
+80106c56:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+80106c5c:	e8 51 fe ff ff       	call   80106ab2 <siftup>
+}
+80106c61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106c64:	c9                   	leave
+80106c65:	c3                   	ret
+    panic("heapremove");
+80106c66:	83 ec 0c             	sub    $0xc,%esp
+80106c69:	68 a3 b6 10 80       	push   $0x8010b6a3
+80106c6e:	e8 8f 9c ff ff       	call   80100902 <panic>
+
+80106c73 <skippeekmin>:
+    panic("skipremove");
+}
+
+static struct proc*
+skippeekmin(void)
+{
+80106c73:	55                   	push   %ebp
+80106c74:	89 e5                	mov    %esp,%ebp
+80106c76:	53                   	push   %ebx
+80106c77:	83 ec 04             	sub    $0x4,%esp
+  struct SkipNode *head = &sl.nodeList[0];
+  struct SkipNode *first;
+  struct proc *p;
+
+  if(head->forward[0] <= 0 || head->forward[0] > NPROC)
+80106c7a:	8b 1d 6c 48 15 80    	mov    0x8015486c,%ebx
+80106c80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+80106c83:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80106c88:	77 49                	ja     80106cd3 <skippeekmin+0x60>
+    return 0;
+  first = &sl.nodeList[head->forward[0]];
+  if(!first->valid)
+80106c8a:	89 d8                	mov    %ebx,%eax
+80106c8c:	c1 e0 06             	shl    $0x6,%eax
+80106c8f:	83 b8 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%eax)
+80106c96:	74 42                	je     80106cda <skippeekmin+0x67>
+    return 0;
+  if((p = findproc(first->pid)) == 0)
+80106c98:	83 ec 0c             	sub    $0xc,%esp
+80106c9b:	89 d8                	mov    %ebx,%eax
+80106c9d:	c1 e0 06             	shl    $0x6,%eax
+80106ca0:	ff b0 68 48 15 80    	push   -0x7feab798(%eax)
+80106ca6:	e8 93 ec ff ff       	call   8010593e <findproc>
+80106cab:	83 c4 10             	add    $0x10,%esp
+80106cae:	85 c0                	test   %eax,%eax
+80106cb0:	74 14                	je     80106cc6 <skippeekmin+0x53>
+    panic("skippeekmin");
+  p->maxlevel = first->maxlevel;
+80106cb2:	c1 e3 06             	shl    $0x6,%ebx
+80106cb5:	8b 93 9c 48 15 80    	mov    -0x7feab764(%ebx),%edx
+80106cbb:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  return p;
+}
+80106cc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106cc4:	c9                   	leave
+80106cc5:	c3                   	ret
+    panic("skippeekmin");
+80106cc6:	83 ec 0c             	sub    $0xc,%esp
+80106cc9:	68 b3 b6 10 80       	push   $0x8010b6b3
+80106cce:	e8 2f 9c ff ff       	call   80100902 <panic>
+    return 0;
+80106cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+80106cd8:	eb e7                	jmp    80106cc1 <skippeekmin+0x4e>
+    return 0;
+80106cda:	b8 00 00 00 00       	mov    $0x0,%eax
+80106cdf:	eb e0                	jmp    80106cc1 <skippeekmin+0x4e>
+
+80106ce1 <skipremove>:
+{
+80106ce1:	55                   	push   %ebp
+80106ce2:	89 e5                	mov    %esp,%ebp
+80106ce4:	83 ec 10             	sub    $0x10,%esp
+80106ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(slDelete(p->vdeadline, p->pid) == 0)
+80106cea:	ff 70 10             	push   0x10(%eax)
+80106ced:	ff b0 80 00 00 00    	push   0x80(%eax)
+80106cf3:	e8 94 05 00 00       	call   8010728c <slDelete>
+80106cf8:	83 c4 10             	add    $0x10,%esp
+80106cfb:	85 c0                	test   %eax,%eax
+80106cfd:	74 02                	je     80106d01 <skipremove+0x20>
+}
+80106cff:	c9                   	leave
+80106d00:	c3                   	ret
+    panic("skipremove");
+80106d01:	83 ec 0c             	sub    $0xc,%esp
+80106d04:	68 bf b6 10 80       	push   $0x8010b6bf
+80106d09:	e8 f4 9b ff ff       	call   80100902 <panic>
+
+80106d0e <skipinsert>:
+{
+80106d0e:	55                   	push   %ebp
+80106d0f:	89 e5                	mov    %esp,%ebp
+80106d11:	83 ec 0c             	sub    $0xc,%esp
+80106d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  return slInsert(p->vdeadline, p->pid, CHANCE);
+80106d17:	68 00 00 80 3e       	push   $0x3e800000
+80106d1c:	ff 70 10             	push   0x10(%eax)
+80106d1f:	ff b0 80 00 00 00    	push   0x80(%eax)
+80106d25:	e8 d8 01 00 00       	call   80106f02 <slInsert>
+}
+80106d2a:	c9                   	leave
+80106d2b:	c3                   	ret
+
+80106d2c <skipupdate>:
+
+static void
+skipupdate(struct proc *p, int deadline)
+{
+80106d2c:	55                   	push   %ebp
+80106d2d:	89 e5                	mov    %esp,%ebp
+80106d2f:	53                   	push   %ebx
+80106d30:	83 ec 10             	sub    $0x10,%esp
+80106d33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  skipremove(p);
+80106d36:	53                   	push   %ebx
+80106d37:	e8 a5 ff ff ff       	call   80106ce1 <skipremove>
+  p->vdeadline = deadline;
+80106d3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106d3f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  if(skipinsert(p) < 0)
+80106d45:	89 1c 24             	mov    %ebx,(%esp)
+80106d48:	e8 c1 ff ff ff       	call   80106d0e <skipinsert>
+80106d4d:	83 c4 10             	add    $0x10,%esp
+80106d50:	85 c0                	test   %eax,%eax
+80106d52:	78 05                	js     80106d59 <skipupdate+0x2d>
+    panic("skipupdate");
+}
+80106d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106d57:	c9                   	leave
+80106d58:	c3                   	ret
+    panic("skipupdate");
+80106d59:	83 ec 0c             	sub    $0xc,%esp
+80106d5c:	68 ca b6 10 80       	push   $0x8010b6ca
+80106d61:	e8 9c 9b ff ff       	call   80100902 <panic>
+
+80106d66 <skipinit>:
+{
+80106d66:	55                   	push   %ebp
+80106d67:	89 e5                	mov    %esp,%ebp
+80106d69:	83 ec 08             	sub    $0x8,%esp
+  initSkipList();
+80106d6c:	e8 02 00 00 00       	call   80106d73 <initSkipList>
+}
+80106d71:	c9                   	leave
+80106d72:	c3                   	ret
+
+80106d73 <initSkipList>:
+// Zero (in BSS, not the kernel image) until initSkipList runs.
+struct SkipList sl;
+
+// Function to initialize a new sorted skip list
+void initSkipList() { // struct SkipList* skipList
+  sl.level = 0;
+80106d73:	c7 05 a4 88 19 80 00 	movl   $0x0,0x801988a4
+80106d7a:	00 00 00 
+  sl.ready = 1;
+80106d7d:	c7 05 a8 88 19 80 01 	movl   $0x1,0x801988a8
+80106d84:	00 00 00 
+
+  struct SkipNode* head = &sl.nodeList[0];
+
+  // Initialize head node kept at index 0
+  head->valid = 1;   // Valid bit for sentinel should always be true
+80106d87:	c7 05 60 48 15 80 01 	movl   $0x1,0x80154860
+80106d8e:	00 00 00 
+  head->value = -1;
+80106d91:	c7 05 64 48 15 80 ff 	movl   $0xffffffff,0x80154864
+80106d98:	ff ff ff 
+  head->pid = -1; // All actual processes have positive PIDs
+80106d9b:	c7 05 68 48 15 80 ff 	movl   $0xffffffff,0x80154868
+80106da2:	ff ff ff 
+  head->maxlevel = MAX_SKIPLIST_LEVEL;
+80106da5:	c7 05 9c 48 15 80 06 	movl   $0x6,0x8015489c
+80106dac:	00 00 00 
+
+  // Sentinel is alone and sad, no forward neighbors
+  for(int i = 0; i < MAX_SKIPLIST_LEVEL; i++) { 
+80106daf:	b8 00 00 00 00       	mov    $0x0,%eax
+80106db4:	eb 19                	jmp    80106dcf <initSkipList+0x5c>
+    head->forward[i] = -1;
+80106db6:	c7 04 85 6c 48 15 80 	movl   $0xffffffff,-0x7feab794(,%eax,4)
+80106dbd:	ff ff ff ff 
+    head->backward[i] = -1;
+80106dc1:	c7 04 85 84 48 15 80 	movl   $0xffffffff,-0x7feab77c(,%eax,4)
+80106dc8:	ff ff ff ff 
+  for(int i = 0; i < MAX_SKIPLIST_LEVEL; i++) { 
+80106dcc:	83 c0 01             	add    $0x1,%eax
+80106dcf:	83 f8 05             	cmp    $0x5,%eax
+80106dd2:	7e e2                	jle    80106db6 <initSkipList+0x43>
+  }
+
+  // Set valid bit for all other nodes to 0 (empty list),
+  // stacked so that index 1 is handed out first
+  sl.nfree = 0;
+80106dd4:	c7 05 a0 88 19 80 00 	movl   $0x0,0x801988a0
+80106ddb:	00 00 00 
+  for (int i = NPROC; i >= 1; i--) {
+80106dde:	b8 00 10 00 00       	mov    $0x1000,%eax
+80106de3:	85 c0                	test   %eax,%eax
+80106de5:	7e 1b                	jle    80106e02 <initSkipList+0x8f>
+    sl.freeNodes[sl.nfree++] = i;
+80106de7:	8b 15 a0 88 19 80    	mov    0x801988a0,%edx
+80106ded:	8d 4a 01             	lea    0x1(%edx),%ecx
+80106df0:	89 0d a0 88 19 80    	mov    %ecx,0x801988a0
+80106df6:	89 04 95 a0 48 19 80 	mov    %eax,-0x7fe6b760(,%edx,4)
+  for (int i = NPROC; i >= 1; i--) {
+80106dfd:	83 e8 01             	sub    $0x1,%eax
+80106e00:	eb e1                	jmp    80106de3 <initSkipList+0x70>
+  }
+  for (int i = 1; i <= NPROC; i++) {
+80106e02:	b9 01 00 00 00       	mov    $0x1,%ecx
+80106e07:	eb 28                	jmp    80106e31 <initSkipList+0xbe>
+    sl.nodeList[i].valid = 0;
+    sl.nodeList[i].value = -1;
+    sl.nodeList[i].pid = -1;
+    for (int j = 0; j < MAX_SKIPLIST_LEVEL; j++){
+      sl.nodeList[i].forward[j] = -1;
+80106e09:	89 c8                	mov    %ecx,%eax
+80106e0b:	c1 e0 04             	shl    $0x4,%eax
+80106e0e:	01 d0                	add    %edx,%eax
+80106e10:	c7 04 85 6c 48 15 80 	movl   $0xffffffff,-0x7feab794(,%eax,4)
+80106e17:	ff ff ff ff 
+      sl.nodeList[i].backward[j] = -1;
+80106e1b:	c7 04 85 84 48 15 80 	movl   $0xffffffff,-0x7feab77c(,%eax,4)
+80106e22:	ff ff ff ff 
+    for (int j = 0; j < MAX_SKIPLIST_LEVEL; j++){
+80106e26:	83 c2 01             	add    $0x1,%edx
+80106e29:	83 fa 05             	cmp    $0x5,%edx
+80106e2c:	7e db                	jle    80106e09 <initSkipList+0x96>
+  for (int i = 1; i <= NPROC; i++) {
+80106e2e:	83 c1 01             	add    $0x1,%ecx
+80106e31:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+80106e37:	7f 2a                	jg     80106e63 <initSkipList+0xf0>
+    sl.nodeList[i].valid = 0;
+80106e39:	89 ca                	mov    %ecx,%edx
+80106e3b:	c1 e2 06             	shl    $0x6,%edx
+80106e3e:	c7 82 60 48 15 80 00 	movl   $0x0,-0x7feab7a0(%edx)
+80106e45:	00 00 00 
+    sl.nodeList[i].value = -1;
+80106e48:	c7 82 64 48 15 80 ff 	movl   $0xffffffff,-0x7feab79c(%edx)
+80106e4f:	ff ff ff 
+    sl.nodeList[i].pid = -1;
+80106e52:	c7 82 68 48 15 80 ff 	movl   $0xffffffff,-0x7feab798(%edx)
+80106e59:	ff ff ff 
+    for (int j = 0; j < MAX_SKIPLIST_LEVEL; j++){
+80106e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+80106e61:	eb c6                	jmp    80106e29 <initSkipList+0xb6>
+    }
+  }
+}
+80106e63:	c3                   	ret
+
+80106e64 <random>:
+
+unsigned int seed = SEED;
+unsigned int random(unsigned int max) {
+80106e64:	55                   	push   %ebp
+80106e65:	89 e5                	mov    %esp,%ebp
+  seed ^= seed << 17;
+80106e67:	a1 60 f5 10 80       	mov    0x8010f560,%eax
+80106e6c:	89 c2                	mov    %eax,%edx
+80106e6e:	c1 e2 11             	shl    $0x11,%edx
+80106e71:	31 d0                	xor    %edx,%eax
+80106e73:	a3 60 f5 10 80       	mov    %eax,0x8010f560
+  seed ^= seed >> 7;
+80106e78:	89 c2                	mov    %eax,%edx
+80106e7a:	c1 ea 07             	shr    $0x7,%edx
+80106e7d:	31 d0                	xor    %edx,%eax
+80106e7f:	a3 60 f5 10 80       	mov    %eax,0x8010f560
+  seed ^= seed << 5;
+80106e84:	89 c2                	mov    %eax,%edx
+80106e86:	c1 e2 05             	shl    $0x5,%edx
+80106e89:	31 d0                	xor    %edx,%eax
+80106e8b:	a3 60 f5 10 80       	mov    %eax,0x8010f560
+  return seed % max;
+80106e90:	ba 00 00 00 00       	mov    $0x0,%edx
+80106e95:	f7 75 08             	divl   0x8(%ebp)
+}
+80106e98:	89 d0                	mov    %edx,%eax
+80106e9a:	5d                   	pop    %ebp
+80106e9b:	c3                   	ret
+
+80106e9c <slUpLevel>:
+
+// Function to up a level by chance for a new element
+int slUpLevel(float p) {
+80106e9c:	55                   	push   %ebp
+80106e9d:	89 e5                	mov    %esp,%ebp
+80106e9f:	53                   	push   %ebx
+80106ea0:	83 ec 14             	sub    $0x14,%esp
+  int level = 0;
+80106ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while ((random(100) / 100.0) < p && level < MAX_SKIPLIST_LEVEL - 1) {
+80106ea8:	eb 03                	jmp    80106ead <slUpLevel+0x11>
+      level++;
+80106eaa:	83 c3 01             	add    $0x1,%ebx
+  while ((random(100) / 100.0) < p && level < MAX_SKIPLIST_LEVEL - 1) {
+80106ead:	83 ec 0c             	sub    $0xc,%esp
+80106eb0:	6a 64                	push   $0x64
+80106eb2:	e8 ad ff ff ff       	call   80106e64 <random>
+80106eb7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+80106eba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+80106ec1:	df 6d f0             	fildll -0x10(%ebp)
+80106ec4:	d8 35 1c bd 10 80    	fdivs  0x8010bd1c
+80106eca:	d9 45 08             	flds   0x8(%ebp)
+80106ecd:	83 c4 10             	add    $0x10,%esp
+80106ed0:	df f1                	fcomip %st(1),%st
+80106ed2:	dd d8                	fstp   %st(0)
+80106ed4:	76 05                	jbe    80106edb <slUpLevel+0x3f>
+80106ed6:	83 fb 04             	cmp    $0x4,%ebx
+80106ed9:	7e cf                	jle    80106eaa <slUpLevel+0xe>
+  }
+  return level;
+}
+80106edb:	89 d8                	mov    %ebx,%eax
+80106edd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ee0:	c9                   	leave
+80106ee1:	c3                   	ret
+
+80106ee2 <slFindFreeNode>:
+
+// Pop an empty node off the free stack, or -1 if the list is full
+int slFindFreeNode() {
+  if (sl.nfree == 0) return -1;
+80106ee2:	a1 a0 88 19 80       	mov    0x801988a0,%eax
+80106ee7:	85 c0                	test   %eax,%eax
+80106ee9:	74 11                	je     80106efc <slFindFreeNode+0x1a>
+  return sl.freeNodes[--sl.nfree];
+80106eeb:	8d 50 ff             	lea    -0x1(%eax),%edx
+80106eee:	89 15 a0 88 19 80    	mov    %edx,0x801988a0
+80106ef4:	8b 04 85 9c 48 19 80 	mov    -0x7fe6b764(,%eax,4),%eax
+80106efb:	c3                   	ret
+  if (sl.nfree == 0) return -1;
+80106efc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106f01:	c3                   	ret
+
+80106f02 <slInsert>:
+
+// Function to insert a value into the sorted skip list
+int slInsert(int value, int pid, float p) {
+80106f02:	55                   	push   %ebp
+80106f03:	89 e5                	mov    %esp,%ebp
+80106f05:	57                   	push   %edi
+80106f06:	56                   	push   %esi
+80106f07:	53                   	push   %ebx
+80106f08:	83 ec 4c             	sub    $0x4c,%esp
+80106f0b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (!sl.ready) return -1;
+80106f0e:	83 3d a8 88 19 80 00 	cmpl   $0x0,0x801988a8
+80106f15:	0f 84 21 02 00 00    	je     8010713c <slInsert+0x23a>
+
+  struct SkipNode* backNodesToUpdate[MAX_SKIPLIST_LEVEL]; // Temp array to store copies of a node
+  int backNodesIdxToUpdate[MAX_SKIPLIST_LEVEL];
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Inserting PID %d with vdeadline %d.\n", pid, value);
+80106f1b:	57                   	push   %edi
+80106f1c:	ff 75 0c             	push   0xc(%ebp)
+80106f1f:	68 d8 b6 10 80       	push   $0x8010b6d8
+80106f24:	6a 00                	push   $0x0
+80106f26:	e8 98 9c ff ff       	call   80100bc3 <dbgprintf>
+  //* 1 - FIND THE NODE TO INSERT NEW NODE AT
+  // ----------------------------------------------------
+  int nodeIdxToInsert = 0;
+  struct SkipNode* nodeToInsert = &sl.nodeList[nodeIdxToInsert];
+
+  for (int i = sl.level; i >= 0; i--) {
+80106f2b:	8b 35 a4 88 19 80    	mov    0x801988a4,%esi
+80106f31:	83 c4 10             	add    $0x10,%esp
+  struct SkipNode* nodeToInsert = &sl.nodeList[nodeIdxToInsert];
+80106f34:	bb 60 48 15 80       	mov    $0x80154860,%ebx
+  int nodeIdxToInsert = 0;
+80106f39:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  for (int i = sl.level; i >= 0; i--) {
+80106f40:	eb 59                	jmp    80106f9b <slInsert+0x99>
+    while (nodeToInsert->forward[i] != -1
+          && sl.nodeList[nodeToInsert->forward[i]].valid != 0
+          && sl.nodeList[nodeToInsert->forward[i]].value < value) {
+      nodeIdxToInsert = nodeToInsert->forward[i];
+      nodeToInsert = &sl.nodeList[nodeIdxToInsert];
+80106f42:	89 c3                	mov    %eax,%ebx
+80106f44:	c1 e3 06             	shl    $0x6,%ebx
+80106f47:	81 c3 60 48 15 80    	add    $0x80154860,%ebx
+      nodeIdxToInsert = nodeToInsert->forward[i];
+80106f4d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    while (nodeToInsert->forward[i] != -1
+80106f50:	8b 44 b3 0c          	mov    0xc(%ebx,%esi,4),%eax
+          && sl.nodeList[nodeToInsert->forward[i]].value < value) {
+80106f54:	83 f8 ff             	cmp    $0xffffffff,%eax
+80106f57:	74 1b                	je     80106f74 <slInsert+0x72>
+          && sl.nodeList[nodeToInsert->forward[i]].valid != 0
+80106f59:	89 c2                	mov    %eax,%edx
+80106f5b:	c1 e2 06             	shl    $0x6,%edx
+80106f5e:	83 ba 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%edx)
+80106f65:	74 0d                	je     80106f74 <slInsert+0x72>
+          && sl.nodeList[nodeToInsert->forward[i]].value < value) {
+80106f67:	89 c2                	mov    %eax,%edx
+80106f69:	c1 e2 06             	shl    $0x6,%edx
+80106f6c:	39 ba 64 48 15 80    	cmp    %edi,-0x7feab79c(%edx)
+80106f72:	7c ce                	jl     80106f42 <slInsert+0x40>
+    }
+    
+    backNodesIdxToUpdate[i] = nodeIdxToInsert;
+80106f74:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+80106f77:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    backNodesToUpdate[i] = nodeToInsert;
+80106f7b:	89 5c b5 d0          	mov    %ebx,-0x30(%ebp,%esi,4)
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Reached the rightmost node at level %d (Current node: PID %d with vdeadline %d)\n", i, nodeToInsert->pid, nodeToInsert->value);
+80106f7f:	83 ec 0c             	sub    $0xc,%esp
+80106f82:	ff 73 04             	push   0x4(%ebx)
+80106f85:	ff 73 08             	push   0x8(%ebx)
+80106f88:	56                   	push   %esi
+80106f89:	68 08 b7 10 80       	push   $0x8010b708
+80106f8e:	6a 00                	push   $0x0
+80106f90:	e8 2e 9c ff ff       	call   80100bc3 <dbgprintf>
+  for (int i = sl.level; i >= 0; i--) {
+80106f95:	83 ee 01             	sub    $0x1,%esi
+80106f98:	83 c4 20             	add    $0x20,%esp
+80106f9b:	85 f6                	test   %esi,%esi
+80106f9d:	79 b1                	jns    80106f50 <slInsert+0x4e>
+  }
+
+  //* 2 - CHANCE FOR NODE TO BE INSERTED TO NEXT LEVEL
+  // ----------------------------------------------------
+
+  int newLevel = slUpLevel(p);
+80106f9f:	83 ec 0c             	sub    $0xc,%esp
+80106fa2:	ff 75 10             	push   0x10(%ebp)
+80106fa5:	e8 f2 fe ff ff       	call   80106e9c <slUpLevel>
+80106faa:	89 c3                	mov    %eax,%ebx
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] slUpLevel = %d\n", newLevel);
+80106fac:	83 c4 0c             	add    $0xc,%esp
+80106faf:	50                   	push   %eax
+80106fb0:	68 67 bc 10 80       	push   $0x8010bc67
+80106fb5:	6a 00                	push   $0x0
+80106fb7:	e8 07 9c ff ff       	call   80100bc3 <dbgprintf>
+
+  if (newLevel > sl.level) { // If new level is greater than the max level of the whole skip list, update max level
+80106fbc:	a1 a4 88 19 80       	mov    0x801988a4,%eax
+80106fc1:	83 c4 10             	add    $0x10,%esp
+80106fc4:	39 d8                	cmp    %ebx,%eax
+80106fc6:	7d 35                	jge    80106ffd <slInsert+0xfb>
+      for (int i = sl.level + 1; i <= newLevel; i++) {
+80106fc8:	83 c0 01             	add    $0x1,%eax
+80106fcb:	eb 13                	jmp    80106fe0 <slInsert+0xde>
+          backNodesIdxToUpdate[i] = 0;
+80106fcd:	c7 44 85 b8 00 00 00 	movl   $0x0,-0x48(%ebp,%eax,4)
+80106fd4:	00 
+          backNodesToUpdate[i] = &sl.nodeList[backNodesIdxToUpdate[i]];
+80106fd5:	c7 44 85 d0 60 48 15 	movl   $0x80154860,-0x30(%ebp,%eax,4)
+80106fdc:	80 
+      for (int i = sl.level + 1; i <= newLevel; i++) {
+80106fdd:	83 c0 01             	add    $0x1,%eax
+80106fe0:	39 d8                	cmp    %ebx,%eax
+80106fe2:	7e e9                	jle    80106fcd <slInsert+0xcb>
+      }
+      sl.level = newLevel;
+80106fe4:	89 1d a4 88 19 80    	mov    %ebx,0x801988a4
+      dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Increased skip list level to %d\n", sl.level);
+80106fea:	83 ec 04             	sub    $0x4,%esp
+80106fed:	53                   	push   %ebx
+80106fee:	68 64 b7 10 80       	push   $0x8010b764
+80106ff3:	6a 00                	push   $0x0
+80106ff5:	e8 c9 9b ff ff       	call   80100bc3 <dbgprintf>
+80106ffa:	83 c4 10             	add    $0x10,%esp
+  }
+
+  //* 3 - LOOK FOR NEAREST ARRAY ELEMENT TO PLACE NODE
+  // ----------------------------------------------------
+  int newNodeIdx = slFindFreeNode();
+80106ffd:	e8 e0 fe ff ff       	call   80106ee2 <slFindFreeNode>
+80107002:	89 c6                	mov    %eax,%esi
+
+  if (newNodeIdx == -1) { 
+80107004:	83 f8 ff             	cmp    $0xffffffff,%eax
+80107007:	74 2e                	je     80107037 <slInsert+0x135>
+  struct SkipNode* newNode = &sl.nodeList[newNodeIdx];
+
+  //* 4 - CREATE NEW NODE
+  // ----------------------------------------------------
+
+  newNode->value = value;
+80107009:	89 c2                	mov    %eax,%edx
+8010700b:	c1 e2 06             	shl    $0x6,%edx
+8010700e:	89 ba 64 48 15 80    	mov    %edi,-0x7feab79c(%edx)
+  newNode->pid = pid;
+80107014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107017:	89 8a 68 48 15 80    	mov    %ecx,-0x7feab798(%edx)
+  newNode->valid = 1;
+8010701d:	c7 82 60 48 15 80 01 	movl   $0x1,-0x7feab7a0(%edx)
+80107024:	00 00 00 
+  newNode->maxlevel = newLevel;
+80107027:	89 9a 9c 48 15 80    	mov    %ebx,-0x7feab764(%edx)
+
+  //* 5 - UPDATE LINKS (OF NEW NODE, NEW BACKWARD, AND NEW FORWARD)
+  // ----------------------------------------------------
+
+  for (int i = 0; i <= newNode->maxlevel; i++) {
+8010702d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107032:	89 7d 08             	mov    %edi,0x8(%ebp)
+80107035:	eb 78                	jmp    801070af <slInsert+0x1ad>
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Insert Failed. Not enough array space.\n");
+80107037:	83 ec 08             	sub    $0x8,%esp
+8010703a:	68 90 b7 10 80       	push   $0x8010b790
+8010703f:	6a 00                	push   $0x0
+80107041:	e8 7d 9b ff ff       	call   80100bc3 <dbgprintf>
+    return -1;
+80107046:	83 c4 10             	add    $0x10,%esp
+80107049:	e9 e4 00 00 00       	jmp    80107132 <slInsert+0x230>
+      newNode->forward[i] = backNodesToUpdate[i]->forward[i];
+
+      // frontNodes' Backwards should point to newNode
+      frontNodeToUpdate->backward[i] = newNodeIdx;
+    } else {
+      newNode->forward[i] = -1;
+8010704e:	89 f0                	mov    %esi,%eax
+80107050:	c1 e0 04             	shl    $0x4,%eax
+80107053:	01 d8                	add    %ebx,%eax
+80107055:	c7 04 85 6c 48 15 80 	movl   $0xffffffff,-0x7feab794(,%eax,4)
+8010705c:	ff ff ff ff 
+    }
+    
+    // newNode's Backward
+    newNode->backward[i] = backNodesIdxToUpdate[i];
+80107060:	89 f0                	mov    %esi,%eax
+80107062:	c1 e0 04             	shl    $0x4,%eax
+80107065:	01 d8                	add    %ebx,%eax
+80107067:	8d 50 08             	lea    0x8(%eax),%edx
+8010706a:	8b 7c 9d b8          	mov    -0x48(%ebp,%ebx,4),%edi
+8010706e:	89 3c 95 64 48 15 80 	mov    %edi,-0x7feab79c(,%edx,4)
+
+    // backNodes' Forwards should point to newNode
+    backNodesToUpdate[i]->forward[i] = newNodeIdx;
+80107075:	89 74 99 0c          	mov    %esi,0xc(%ecx,%ebx,4)
+
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Inserted at level %d (FrontNode vdeadline: %d. BackNode vdeadline: %d)\n", i, sl.nodeList[newNode->forward[i]].value, sl.nodeList[newNode->backward[i]].value);
+80107079:	8b 14 95 64 48 15 80 	mov    -0x7feab79c(,%edx,4),%edx
+80107080:	8b 04 85 6c 48 15 80 	mov    -0x7feab794(,%eax,4),%eax
+80107087:	83 ec 0c             	sub    $0xc,%esp
+8010708a:	c1 e2 06             	shl    $0x6,%edx
+8010708d:	ff b2 64 48 15 80    	push   -0x7feab79c(%edx)
+80107093:	c1 e0 06             	shl    $0x6,%eax
+80107096:	ff b0 64 48 15 80    	push   -0x7feab79c(%eax)
+8010709c:	53                   	push   %ebx
+8010709d:	68 c4 b7 10 80       	push   $0x8010b7c4
+801070a2:	6a 00                	push   $0x0
+801070a4:	e8 1a 9b ff ff       	call   80100bc3 <dbgprintf>
+  for (int i = 0; i <= newNode->maxlevel; i++) {
+801070a9:	83 c3 01             	add    $0x1,%ebx
+801070ac:	83 c4 20             	add    $0x20,%esp
+801070af:	89 f0                	mov    %esi,%eax
+801070b1:	c1 e0 06             	shl    $0x6,%eax
+801070b4:	39 98 9c 48 15 80    	cmp    %ebx,-0x7feab764(%eax)
+801070ba:	7c 40                	jl     801070fc <slInsert+0x1fa>
+    if (backNodesToUpdate[i]->forward[i] != -1 && sl.nodeList[backNodesToUpdate[i]->forward[i]].valid == 1) {
+801070bc:	8b 4c 9d d0          	mov    -0x30(%ebp,%ebx,4),%ecx
+801070c0:	8b 44 99 0c          	mov    0xc(%ecx,%ebx,4),%eax
+801070c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+801070c7:	74 85                	je     8010704e <slInsert+0x14c>
+801070c9:	89 c2                	mov    %eax,%edx
+801070cb:	c1 e2 06             	shl    $0x6,%edx
+801070ce:	83 ba 60 48 15 80 01 	cmpl   $0x1,-0x7feab7a0(%edx)
+801070d5:	0f 85 73 ff ff ff    	jne    8010704e <slInsert+0x14c>
+      newNode->forward[i] = backNodesToUpdate[i]->forward[i];
+801070db:	89 f2                	mov    %esi,%edx
+801070dd:	c1 e2 04             	shl    $0x4,%edx
+801070e0:	01 da                	add    %ebx,%edx
+801070e2:	89 04 95 6c 48 15 80 	mov    %eax,-0x7feab794(,%edx,4)
+      frontNodeToUpdate->backward[i] = newNodeIdx;
+801070e9:	c1 e0 04             	shl    $0x4,%eax
+801070ec:	8d 44 03 08          	lea    0x8(%ebx,%eax,1),%eax
+801070f0:	89 34 85 64 48 15 80 	mov    %esi,-0x7feab79c(,%eax,4)
+801070f7:	e9 64 ff ff ff       	jmp    80107060 <slInsert+0x15e>
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Insert PID %d with vdeadline %d Successful.\n", pid, value);
+801070fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+801070ff:	57                   	push   %edi
+80107100:	ff 75 0c             	push   0xc(%ebp)
+80107103:	68 18 b8 10 80       	push   $0x8010b818
+80107108:	6a 00                	push   $0x0
+8010710a:	e8 b4 9a ff ff       	call   80100bc3 <dbgprintf>
+  
+  // BFSPRINT
+  dbgprintf(BFS_PRINT, "inserted|[%d]%d\n", newNode->pid, newNode->maxlevel);
+8010710f:	c1 e6 06             	shl    $0x6,%esi
+80107112:	ff b6 9c 48 15 80    	push   -0x7feab764(%esi)
+80107118:	ff b6 68 48 15 80    	push   -0x7feab798(%esi)
+8010711e:	68 80 bc 10 80       	push   $0x8010bc80
+80107123:	6a 01                	push   $0x1
+80107125:	e8 99 9a ff ff       	call   80100bc3 <dbgprintf>
+
+  if (SKIPLIST_CHECK) slCheckInvariants();
+  return 0;
+8010712a:	83 c4 20             	add    $0x20,%esp
+8010712d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+80107132:	89 f0                	mov    %esi,%eax
+80107134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107137:	5b                   	pop    %ebx
+80107138:	5e                   	pop    %esi
+80107139:	5f                   	pop    %edi
+8010713a:	5d                   	pop    %ebp
+8010713b:	c3                   	ret
+  if (!sl.ready) return -1;
+8010713c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80107141:	eb ef                	jmp    80107132 <slInsert+0x230>
+
+80107143 <slSearch>:
+
+// Function to search for a value in the sorted skip list
+struct SkipNode* slSearch(int value, int pid) {
+80107143:	55                   	push   %ebp
+80107144:	89 e5                	mov    %esp,%ebp
+80107146:	57                   	push   %edi
+80107147:	56                   	push   %esi
+80107148:	53                   	push   %ebx
+80107149:	83 ec 0c             	sub    $0xc,%esp
+8010714c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (!sl.ready) return 0;
+8010714f:	83 3d a8 88 19 80 00 	cmpl   $0x0,0x801988a8
+80107156:	0f 84 29 01 00 00    	je     80107285 <slSearch+0x142>
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Searching for PID %d with vdeadline %d\n", pid, value);
+8010715c:	57                   	push   %edi
+8010715d:	ff 75 0c             	push   0xc(%ebp)
+80107160:	68 50 b8 10 80       	push   $0x8010b850
+80107165:	6a 00                	push   $0x0
+80107167:	e8 57 9a ff ff       	call   80100bc3 <dbgprintf>
+  struct SkipNode* currentNode = &sl.nodeList[0];
+
+  //* 1 - LOOP THROUGH SKIPLIST UNTIL WE FIND VALUE RIGHT BEFORE TARGET VALUE
+  // ----------------------------------------------------
+
+  for (int i = sl.level; i >= 0; i--) {
+8010716c:	8b 35 a4 88 19 80    	mov    0x801988a4,%esi
+80107172:	83 c4 10             	add    $0x10,%esp
+  struct SkipNode* currentNode = &sl.nodeList[0];
+80107175:	bb 60 48 15 80       	mov    $0x80154860,%ebx
+  for (int i = sl.level; i >= 0; i--) {
+8010717a:	eb 03                	jmp    8010717f <slSearch+0x3c>
+8010717c:	83 ee 01             	sub    $0x1,%esi
+8010717f:	85 f6                	test   %esi,%esi
+80107181:	78 78                	js     801071fb <slSearch+0xb8>
+    dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Checking level %d (Current node: PID %d with vdeadline)\n", i, currentNode->pid, currentNode->value);
+80107183:	83 ec 0c             	sub    $0xc,%esp
+80107186:	ff 73 04             	push   0x4(%ebx)
+80107189:	ff 73 08             	push   0x8(%ebx)
+8010718c:	56                   	push   %esi
+8010718d:	68 84 b8 10 80       	push   $0x8010b884
+80107192:	6a 00                	push   $0x0
+80107194:	e8 2a 9a ff ff       	call   80100bc3 <dbgprintf>
+
+      // Keep Looping WHILE:
+      //    link to next forward exists (!= -1)
+      //    linked forward node is valid (!= 0)
+      //    value for forward is less than the searched value
+    while (currentNode->forward[i] != -1
+80107199:	83 c4 20             	add    $0x20,%esp
+8010719c:	8b 44 b3 0c          	mov    0xc(%ebx,%esi,4),%eax
+          && sl.nodeList[currentNode->forward[i]].valid != 0
+          && sl.nodeList[currentNode->forward[i]].value < value) {
+801071a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+801071a3:	74 d7                	je     8010717c <slSearch+0x39>
+          && sl.nodeList[currentNode->forward[i]].valid != 0
+801071a5:	89 c2                	mov    %eax,%edx
+801071a7:	c1 e2 06             	shl    $0x6,%edx
+801071aa:	83 ba 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%edx)
+801071b1:	74 c9                	je     8010717c <slSearch+0x39>
+          && sl.nodeList[currentNode->forward[i]].value < value) {
+801071b3:	89 c2                	mov    %eax,%edx
+801071b5:	c1 e2 06             	shl    $0x6,%edx
+801071b8:	39 ba 64 48 15 80    	cmp    %edi,-0x7feab79c(%edx)
+801071be:	7d bc                	jge    8010717c <slSearch+0x39>
+      currentNode = &sl.nodeList[currentNode->forward[i]];
+801071c0:	89 c3                	mov    %eax,%ebx
+801071c2:	c1 e3 06             	shl    $0x6,%ebx
+801071c5:	81 c3 60 48 15 80    	add    $0x80154860,%ebx
+      dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Moving right at level %d (Current node: PID %d with vdeadline %d)\n", i, sl.nodeList[currentNode->forward[i]].pid, sl.nodeList[currentNode->forward[i]].value);
+801071cb:	c1 e0 04             	shl    $0x4,%eax
+801071ce:	01 f0                	add    %esi,%eax
+801071d0:	8b 04 85 6c 48 15 80 	mov    -0x7feab794(,%eax,4),%eax
+801071d7:	83 ec 0c             	sub    $0xc,%esp
+801071da:	c1 e0 06             	shl    $0x6,%eax
+801071dd:	ff b0 64 48 15 80    	push   -0x7feab79c(%eax)
+801071e3:	ff b0 68 48 15 80    	push   -0x7feab798(%eax)
+801071e9:	56                   	push   %esi
+801071ea:	68 c8 b8 10 80       	push   $0x8010b8c8
+801071ef:	6a 00                	push   $0x0
+801071f1:	e8 cd 99 ff ff       	call   80100bc3 <dbgprintf>
+801071f6:	83 c4 20             	add    $0x20,%esp
+801071f9:	eb a1                	jmp    8010719c <slSearch+0x59>
+
+  //* 2 - CHECK THROUGH BOTTOMMOST LEVEL FOR ANY DUPLICATES
+  // ----------------------------------------------------
+
+  // Check bottommost level
+  while (currentNode->forward[0] != -1
+801071fb:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+        && sl.nodeList[currentNode->forward[0]].valid != 0
+        && sl.nodeList[currentNode->forward[0]].value == value) {
+801071fe:	83 fb ff             	cmp    $0xffffffff,%ebx
+80107201:	74 60                	je     80107263 <slSearch+0x120>
+        && sl.nodeList[currentNode->forward[0]].valid != 0
+80107203:	89 d8                	mov    %ebx,%eax
+80107205:	c1 e0 06             	shl    $0x6,%eax
+80107208:	83 b8 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%eax)
+8010720f:	74 52                	je     80107263 <slSearch+0x120>
+        && sl.nodeList[currentNode->forward[0]].value == value) {
+80107211:	89 d8                	mov    %ebx,%eax
+80107213:	c1 e0 06             	shl    $0x6,%eax
+80107216:	39 b8 64 48 15 80    	cmp    %edi,-0x7feab79c(%eax)
+8010721c:	75 45                	jne    80107263 <slSearch+0x120>
+    currentNode = &sl.nodeList[currentNode->forward[0]];
+8010721e:	c1 e3 06             	shl    $0x6,%ebx
+80107221:	81 c3 60 48 15 80    	add    $0x80154860,%ebx
+    dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Moving right at bottom level (Current node: PID %d with vdeadline %d)\n", sl.nodeList[currentNode->forward[0]].pid, sl.nodeList[currentNode->forward[0]].value);
+80107227:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010722a:	c1 e0 06             	shl    $0x6,%eax
+8010722d:	ff b0 64 48 15 80    	push   -0x7feab79c(%eax)
+80107233:	ff b0 68 48 15 80    	push   -0x7feab798(%eax)
+80107239:	68 14 b9 10 80       	push   $0x8010b914
+8010723e:	6a 00                	push   $0x0
+80107240:	e8 7e 99 ff ff       	call   80100bc3 <dbgprintf>
+    
+
+    if (currentNode->pid == pid) {
+80107245:	83 c4 10             	add    $0x10,%esp
+80107248:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010724b:	39 43 08             	cmp    %eax,0x8(%ebx)
+8010724e:	75 ab                	jne    801071fb <slSearch+0xb8>
+      dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] PID %d with vdeadline %d found.\n", pid, value);
+80107250:	57                   	push   %edi
+80107251:	50                   	push   %eax
+80107252:	68 64 b9 10 80       	push   $0x8010b964
+80107257:	6a 00                	push   $0x0
+80107259:	e8 65 99 ff ff       	call   80100bc3 <dbgprintf>
+      return currentNode;
+8010725e:	83 c4 10             	add    $0x10,%esp
+80107261:	eb 18                	jmp    8010727b <slSearch+0x138>
+    }
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] PID %d with vdeadline %d not found.\n", pid, value);
+80107263:	57                   	push   %edi
+80107264:	ff 75 0c             	push   0xc(%ebp)
+80107267:	68 90 b9 10 80       	push   $0x8010b990
+8010726c:	6a 00                	push   $0x0
+8010726e:	e8 50 99 ff ff       	call   80100bc3 <dbgprintf>
+  return 0;
+80107273:	83 c4 10             	add    $0x10,%esp
+80107276:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+8010727b:	89 d8                	mov    %ebx,%eax
+8010727d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107280:	5b                   	pop    %ebx
+80107281:	5e                   	pop    %esi
+80107282:	5f                   	pop    %edi
+80107283:	5d                   	pop    %ebp
+80107284:	c3                   	ret
+  if (!sl.ready) return 0;
+80107285:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010728a:	eb ef                	jmp    8010727b <slSearch+0x138>
+
+8010728c <slDelete>:
+
+// Function to delete a node in the skip list
+struct SkipNode* slDelete(int value, int pid) {
+8010728c:	55                   	push   %ebp
+8010728d:	89 e5                	mov    %esp,%ebp
+8010728f:	57                   	push   %edi
+80107290:	56                   	push   %esi
+80107291:	53                   	push   %ebx
+80107292:	83 ec 0c             	sub    $0xc,%esp
+80107295:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107298:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (!sl.ready) return 0;
+8010729b:	83 3d a8 88 19 80 00 	cmpl   $0x0,0x801988a8
+801072a2:	0f 84 e2 00 00 00    	je     8010738a <slDelete+0xfe>
+
+  //* 1 - LOOK FOR TARGET VALUE
+  // ----------------------------------------------------
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] Deleting PID %d with vdeadline %d:\n", pid, value);
+801072a8:	57                   	push   %edi
+801072a9:	56                   	push   %esi
+801072aa:	68 c0 b9 10 80       	push   $0x8010b9c0
+801072af:	6a 00                	push   $0x0
+801072b1:	e8 0d 99 ff ff       	call   80100bc3 <dbgprintf>
+  struct SkipNode* nodeToDelete = slSearch(value, pid);
+801072b6:	83 c4 08             	add    $0x8,%esp
+801072b9:	56                   	push   %esi
+801072ba:	57                   	push   %edi
+801072bb:	e8 83 fe ff ff       	call   80107143 <slSearch>
+801072c0:	89 c3                	mov    %eax,%ebx
+
+  if (nodeToDelete == 0) {
+801072c2:	83 c4 10             	add    $0x10,%esp
+801072c5:	85 c0                	test   %eax,%eax
+801072c7:	74 05                	je     801072ce <slDelete+0x42>
+  } 
+
+  //* 2 - UPDATE LINKS (OF BACKWARD AND FRONT NODES)
+  // ----------------------------------------------------
+
+  for (int i = nodeToDelete->maxlevel; i >= 0; i--) {
+801072c9:	8b 40 3c             	mov    0x3c(%eax),%eax
+801072cc:	eb 39                	jmp    80107307 <slDelete+0x7b>
+    dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] PID %d with vdeadline %d to delete not found\n", pid, value);
+801072ce:	57                   	push   %edi
+801072cf:	56                   	push   %esi
+801072d0:	68 f0 b9 10 80       	push   $0x8010b9f0
+801072d5:	6a 00                	push   $0x0
+801072d7:	e8 e7 98 ff ff       	call   80100bc3 <dbgprintf>
+    return 0;
+801072dc:	83 c4 10             	add    $0x10,%esp
+801072df:	e9 9c 00 00 00       	jmp    80107380 <slDelete+0xf4>
+      backNode->forward[i] = nodeToDelete->forward[i]; // BackNode's Forward should point to Forward
+
+      struct SkipNode* frontNode = &sl.nodeList[nodeToDelete->forward[i]];
+      frontNode->backward[i] = nodeToDelete->backward[i]; // FrontNode's Backward should point to Backward
+    } else {
+      backNode->forward[i] = -1;
+801072e4:	c1 e2 04             	shl    $0x4,%edx
+801072e7:	01 c2                	add    %eax,%edx
+801072e9:	c7 04 95 6c 48 15 80 	movl   $0xffffffff,-0x7feab794(,%edx,4)
+801072f0:	ff ff ff ff 
+    }
+
+    nodeToDelete->forward[i] = -1;
+801072f4:	c7 44 83 0c ff ff ff 	movl   $0xffffffff,0xc(%ebx,%eax,4)
+801072fb:	ff 
+    nodeToDelete->backward[i] = -1;
+801072fc:	c7 44 83 24 ff ff ff 	movl   $0xffffffff,0x24(%ebx,%eax,4)
+80107303:	ff 
+  for (int i = nodeToDelete->maxlevel; i >= 0; i--) {
+80107304:	83 e8 01             	sub    $0x1,%eax
+80107307:	85 c0                	test   %eax,%eax
+80107309:	78 2d                	js     80107338 <slDelete+0xac>
+    struct SkipNode* backNode = &sl.nodeList[nodeToDelete->backward[i]];
+8010730b:	8b 54 83 24          	mov    0x24(%ebx,%eax,4),%edx
+    if (nodeToDelete->forward[i] != -1) {
+8010730f:	8b 4c 83 0c          	mov    0xc(%ebx,%eax,4),%ecx
+80107313:	83 f9 ff             	cmp    $0xffffffff,%ecx
+80107316:	74 cc                	je     801072e4 <slDelete+0x58>
+      backNode->forward[i] = nodeToDelete->forward[i]; // BackNode's Forward should point to Forward
+80107318:	c1 e2 04             	shl    $0x4,%edx
+8010731b:	01 c2                	add    %eax,%edx
+8010731d:	89 0c 95 6c 48 15 80 	mov    %ecx,-0x7feab794(,%edx,4)
+      frontNode->backward[i] = nodeToDelete->backward[i]; // FrontNode's Backward should point to Backward
+80107324:	8b 54 83 24          	mov    0x24(%ebx,%eax,4),%edx
+80107328:	c1 e1 04             	shl    $0x4,%ecx
+8010732b:	8d 4c 08 08          	lea    0x8(%eax,%ecx,1),%ecx
+8010732f:	89 14 8d 64 48 15 80 	mov    %edx,-0x7feab79c(,%ecx,4)
+80107336:	eb bc                	jmp    801072f4 <slDelete+0x68>
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] Deletion of PID %d with vdeadline %d Successful.\n", pid, value);
+80107338:	57                   	push   %edi
+80107339:	56                   	push   %esi
+8010733a:	68 28 ba 10 80       	push   $0x8010ba28
+8010733f:	6a 00                	push   $0x0
+80107341:	e8 7d 98 ff ff       	call   80100bc3 <dbgprintf>
+  nodeToDelete->valid = 0;
+80107346:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  sl.freeNodes[sl.nfree++] = nodeToDelete - sl.nodeList;
+8010734c:	8b 15 a0 88 19 80    	mov    0x801988a0,%edx
+80107352:	8d 42 01             	lea    0x1(%edx),%eax
+80107355:	a3 a0 88 19 80       	mov    %eax,0x801988a0
+8010735a:	89 d8                	mov    %ebx,%eax
+8010735c:	2d 60 48 15 80       	sub    $0x80154860,%eax
+80107361:	c1 f8 06             	sar    $0x6,%eax
+80107364:	89 04 95 a0 48 19 80 	mov    %eax,-0x7fe6b760(,%edx,4)
+
+  // BFSPRINT
+  dbgprintf(BFS_PRINT, "removed|[%d]%d\n", nodeToDelete->pid, nodeToDelete->maxlevel);
+8010736b:	ff 73 3c             	push   0x3c(%ebx)
+8010736e:	ff 73 08             	push   0x8(%ebx)
+80107371:	68 91 bc 10 80       	push   $0x8010bc91
+80107376:	6a 01                	push   $0x1
+80107378:	e8 46 98 ff ff       	call   80100bc3 <dbgprintf>
+
+  if (SKIPLIST_CHECK) slCheckInvariants();
+  return nodeToDelete;
+8010737d:	83 c4 20             	add    $0x20,%esp
+}
+80107380:	89 d8                	mov    %ebx,%eax
+80107382:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107385:	5b                   	pop    %ebx
+80107386:	5e                   	pop    %esi
+80107387:	5f                   	pop    %edi
+80107388:	5d                   	pop    %ebp
+80107389:	c3                   	ret
+  if (!sl.ready) return 0;
+8010738a:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010738f:	eb ef                	jmp    80107380 <slDelete+0xf4>
+
+80107391 <printSkipList>:
+
+// Function to print the entire skip list
+void printSkipList() {
+  if (!sl.ready) return;
+80107391:	83 3d a8 88 19 80 00 	cmpl   $0x0,0x801988a8
+80107398:	75 01                	jne    8010739b <printSkipList+0xa>
+8010739a:	c3                   	ret
+void printSkipList() {
+8010739b:	55                   	push   %ebp
+8010739c:	89 e5                	mov    %esp,%ebp
+8010739e:	57                   	push   %edi
+8010739f:	56                   	push   %esi
+801073a0:	53                   	push   %ebx
+801073a1:	83 ec 18             	sub    $0x18,%esp
+
+  cprintf("Skip List:\n");
+801073a4:	68 a1 bc 10 80       	push   $0x8010bca1
+801073a9:	e8 4b 99 ff ff       	call   80100cf9 <cprintf>
+  for (int i = sl.level; i >= 0; i--) {
+801073ae:	8b 3d a4 88 19 80    	mov    0x801988a4,%edi
+801073b4:	83 c4 10             	add    $0x10,%esp
+801073b7:	eb 40                	jmp    801073f9 <printSkipList+0x68>
+      struct SkipNode* head = &sl.nodeList[0];
+      int currentIdx = head->forward[i];
+      struct SkipNode* current = &sl.nodeList[currentIdx];
+      cprintf("Level %d: ", i);
+      while (current->valid == 1 && current->value != 0) {
+          cprintf("(%d) %d [idx: %d]-> ", current->pid, current->value, currentIdx);
+801073b9:	56                   	push   %esi
+801073ba:	50                   	push   %eax
+801073bb:	ff 73 08             	push   0x8(%ebx)
+801073be:	68 b8 bc 10 80       	push   $0x8010bcb8
+801073c3:	e8 31 99 ff ff       	call   80100cf9 <cprintf>
+          currentIdx = current->forward[i];
+801073c8:	8b 74 bb 0c          	mov    0xc(%ebx,%edi,4),%esi
+          current = &sl.nodeList[currentIdx];
+801073cc:	89 f3                	mov    %esi,%ebx
+801073ce:	c1 e3 06             	shl    $0x6,%ebx
+801073d1:	81 c3 60 48 15 80    	add    $0x80154860,%ebx
+801073d7:	83 c4 10             	add    $0x10,%esp
+      while (current->valid == 1 && current->value != 0) {
+801073da:	83 3b 01             	cmpl   $0x1,(%ebx)
+801073dd:	75 07                	jne    801073e6 <printSkipList+0x55>
+801073df:	8b 43 04             	mov    0x4(%ebx),%eax
+801073e2:	85 c0                	test   %eax,%eax
+801073e4:	75 d3                	jne    801073b9 <printSkipList+0x28>
+      }
+      cprintf("0\n");
+801073e6:	83 ec 0c             	sub    $0xc,%esp
+801073e9:	68 cd bc 10 80       	push   $0x8010bccd
+801073ee:	e8 06 99 ff ff       	call   80100cf9 <cprintf>
+  for (int i = sl.level; i >= 0; i--) {
+801073f3:	83 ef 01             	sub    $0x1,%edi
+801073f6:	83 c4 10             	add    $0x10,%esp
+801073f9:	85 ff                	test   %edi,%edi
+801073fb:	78 25                	js     80107422 <printSkipList+0x91>
+      int currentIdx = head->forward[i];
+801073fd:	8b 34 bd 6c 48 15 80 	mov    -0x7feab794(,%edi,4),%esi
+      struct SkipNode* current = &sl.nodeList[currentIdx];
+80107404:	89 f3                	mov    %esi,%ebx
+80107406:	c1 e3 06             	shl    $0x6,%ebx
+80107409:	81 c3 60 48 15 80    	add    $0x80154860,%ebx
+      cprintf("Level %d: ", i);
+8010740f:	83 ec 08             	sub    $0x8,%esp
+80107412:	57                   	push   %edi
+80107413:	68 ad bc 10 80       	push   $0x8010bcad
+80107418:	e8 dc 98 ff ff       	call   80100cf9 <cprintf>
+      while (current->valid == 1 && current->value != 0) {
+8010741d:	83 c4 10             	add    $0x10,%esp
+80107420:	eb b8                	jmp    801073da <printSkipList+0x49>
+  }
+}
+80107422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107425:	5b                   	pop    %ebx
+80107426:	5e                   	pop    %esi
+80107427:	5f                   	pop    %edi
+80107428:	5d                   	pop    %ebp
+80107429:	c3                   	ret
+
+8010742a <slCheckInvariants>:
+// no node sits above its own maxlevel or the list's level, and that
+// exactly the valid nodes are reachable (each at every level up to
+// its maxlevel), and that the free stack holds only empty nodes and
+// accounts for all of them. Panics on the first violation.
+void slCheckInvariants() {
+  if (!sl.ready) return;
+8010742a:	83 3d a8 88 19 80 00 	cmpl   $0x0,0x801988a8
+80107431:	0f 84 b2 02 00 00    	je     801076e9 <slCheckInvariants+0x2bf>
+void slCheckInvariants() {
+80107437:	55                   	push   %ebp
+80107438:	89 e5                	mov    %esp,%ebp
+8010743a:	57                   	push   %edi
+8010743b:	56                   	push   %esi
+8010743c:	53                   	push   %ebx
+8010743d:	83 ec 2c             	sub    $0x2c,%esp
+
+  struct SkipNode* head = &sl.nodeList[0];
+  int nvalid[MAX_SKIPLIST_LEVEL];
+
+  if (sl.level < 0 || sl.level >= MAX_SKIPLIST_LEVEL)
+80107440:	8b 0d a4 88 19 80    	mov    0x801988a4,%ecx
+80107446:	83 f9 05             	cmp    $0x5,%ecx
+80107449:	77 1b                	ja     80107466 <slCheckInvariants+0x3c>
+    panic("slCheck: list level out of range");
+  if (head->valid != 1 || head->pid != -1)
+8010744b:	8b 1d 60 48 15 80    	mov    0x80154860,%ebx
+80107451:	83 fb 01             	cmp    $0x1,%ebx
+80107454:	75 1d                	jne    80107473 <slCheckInvariants+0x49>
+80107456:	83 3d 68 48 15 80 ff 	cmpl   $0xffffffff,0x80154868
+8010745d:	75 14                	jne    80107473 <slCheckInvariants+0x49>
+    panic("slCheck: corrupt head");
+
+  //* 1 - COUNT VALID NODES PER LEVEL, CHECK UNUSED LINKS ARE CLEARED
+  // ----------------------------------------------------
+
+  for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+8010745f:	b8 00 00 00 00       	mov    $0x0,%eax
+80107464:	eb 2a                	jmp    80107490 <slCheckInvariants+0x66>
+    panic("slCheck: list level out of range");
+80107466:	83 ec 0c             	sub    $0xc,%esp
+80107469:	68 64 ba 10 80       	push   $0x8010ba64
+8010746e:	e8 8f 94 ff ff       	call   80100902 <panic>
+    panic("slCheck: corrupt head");
+80107473:	83 ec 0c             	sub    $0xc,%esp
+80107476:	68 d0 bc 10 80       	push   $0x8010bcd0
+8010747b:	e8 82 94 ff ff       	call   80100902 <panic>
+    nvalid[i] = 0;
+    if (head->backward[i] != -1)
+      panic("slCheck: head has a backward link");
+80107480:	83 ec 0c             	sub    $0xc,%esp
+80107483:	68 88 ba 10 80       	push   $0x8010ba88
+80107488:	e8 75 94 ff ff       	call   80100902 <panic>
+  for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+8010748d:	83 c0 01             	add    $0x1,%eax
+80107490:	83 f8 05             	cmp    $0x5,%eax
+80107493:	0f 8f a5 00 00 00    	jg     8010753e <slCheckInvariants+0x114>
+    nvalid[i] = 0;
+80107499:	c7 44 85 d0 00 00 00 	movl   $0x0,-0x30(%ebp,%eax,4)
+801074a0:	00 
+    if (head->backward[i] != -1)
+801074a1:	83 3c 85 84 48 15 80 	cmpl   $0xffffffff,-0x7feab77c(,%eax,4)
+801074a8:	ff 
+801074a9:	75 d5                	jne    80107480 <slCheckInvariants+0x56>
+    if (i > sl.level && head->forward[i] != -1)
+801074ab:	39 c1                	cmp    %eax,%ecx
+801074ad:	7d de                	jge    8010748d <slCheckInvariants+0x63>
+801074af:	83 3c 85 6c 48 15 80 	cmpl   $0xffffffff,-0x7feab794(,%eax,4)
+801074b6:	ff 
+801074b7:	74 d4                	je     8010748d <slCheckInvariants+0x63>
+      panic("slCheck: head linked above list level");
+801074b9:	83 ec 0c             	sub    $0xc,%esp
+801074bc:	68 ac ba 10 80       	push   $0x8010baac
+801074c1:	e8 3c 94 ff ff       	call   80100902 <panic>
+
+  for (int n = 1; n <= NPROC; n++) {
+    struct SkipNode* node = &sl.nodeList[n];
+
+    if (node->valid != 0 && node->valid != 1)
+      panic("slCheck: bad valid bit");
+801074c6:	83 ec 0c             	sub    $0xc,%esp
+801074c9:	68 e6 bc 10 80       	push   $0x8010bce6
+801074ce:	e8 2f 94 ff ff       	call   80100902 <panic>
+    if (node->valid && (node->maxlevel < 0 || node->maxlevel > sl.level))
+      panic("slCheck: node level out of range");
+801074d3:	83 ec 0c             	sub    $0xc,%esp
+801074d6:	68 d4 ba 10 80       	push   $0x8010bad4
+801074db:	e8 22 94 ff ff       	call   80100902 <panic>
+
+    for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+      if (node->valid && i <= node->maxlevel) {
+        nvalid[i]++;
+      } else if (node->forward[i] != -1 || node->backward[i] != -1) {
+801074e0:	89 da                	mov    %ebx,%edx
+801074e2:	c1 e2 04             	shl    $0x4,%edx
+801074e5:	01 c2                	add    %eax,%edx
+801074e7:	83 3c 95 6c 48 15 80 	cmpl   $0xffffffff,-0x7feab794(,%edx,4)
+801074ee:	ff 
+801074ef:	75 39                	jne    8010752a <slCheckInvariants+0x100>
+801074f1:	89 da                	mov    %ebx,%edx
+801074f3:	c1 e2 04             	shl    $0x4,%edx
+801074f6:	8d 54 10 08          	lea    0x8(%eax,%edx,1),%edx
+801074fa:	83 3c 95 64 48 15 80 	cmpl   $0xffffffff,-0x7feab79c(,%edx,4)
+80107501:	ff 
+80107502:	75 26                	jne    8010752a <slCheckInvariants+0x100>
+    for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+80107504:	83 c0 01             	add    $0x1,%eax
+80107507:	83 f8 05             	cmp    $0x5,%eax
+8010750a:	7f 2f                	jg     8010753b <slCheckInvariants+0x111>
+      if (node->valid && i <= node->maxlevel) {
+8010750c:	85 f6                	test   %esi,%esi
+8010750e:	74 d0                	je     801074e0 <slCheckInvariants+0xb6>
+80107510:	89 da                	mov    %ebx,%edx
+80107512:	c1 e2 06             	shl    $0x6,%edx
+80107515:	39 82 9c 48 15 80    	cmp    %eax,-0x7feab764(%edx)
+8010751b:	7c c3                	jl     801074e0 <slCheckInvariants+0xb6>
+        nvalid[i]++;
+8010751d:	8b 7c 85 d0          	mov    -0x30(%ebp,%eax,4),%edi
+80107521:	8d 57 01             	lea    0x1(%edi),%edx
+80107524:	89 54 85 d0          	mov    %edx,-0x30(%ebp,%eax,4)
+80107528:	eb da                	jmp    80107504 <slCheckInvariants+0xda>
+        panic("slCheck: stale link on unused level");
+8010752a:	83 ec 0c             	sub    $0xc,%esp
+8010752d:	68 f8 ba 10 80       	push   $0x8010baf8
+80107532:	e8 cb 93 ff ff       	call   80100902 <panic>
+80107537:	89 f0                	mov    %esi,%eax
+80107539:	eb cc                	jmp    80107507 <slCheckInvariants+0xdd>
+  for (int n = 1; n <= NPROC; n++) {
+8010753b:	83 c3 01             	add    $0x1,%ebx
+8010753e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+80107544:	7f 3a                	jg     80107580 <slCheckInvariants+0x156>
+    if (node->valid != 0 && node->valid != 1)
+80107546:	89 d8                	mov    %ebx,%eax
+80107548:	c1 e0 06             	shl    $0x6,%eax
+8010754b:	8b b0 60 48 15 80    	mov    -0x7feab7a0(%eax),%esi
+80107551:	83 fe 01             	cmp    $0x1,%esi
+80107554:	0f 87 6c ff ff ff    	ja     801074c6 <slCheckInvariants+0x9c>
+    if (node->valid && (node->maxlevel < 0 || node->maxlevel > sl.level))
+8010755a:	85 f6                	test   %esi,%esi
+8010755c:	74 d9                	je     80107537 <slCheckInvariants+0x10d>
+8010755e:	89 d8                	mov    %ebx,%eax
+80107560:	c1 e0 06             	shl    $0x6,%eax
+80107563:	8b 80 9c 48 15 80    	mov    -0x7feab764(%eax),%eax
+80107569:	85 c0                	test   %eax,%eax
+8010756b:	0f 88 62 ff ff ff    	js     801074d3 <slCheckInvariants+0xa9>
+80107571:	39 c1                	cmp    %eax,%ecx
+80107573:	0f 8c 5a ff ff ff    	jl     801074d3 <slCheckInvariants+0xa9>
+80107579:	b8 00 00 00 00       	mov    $0x0,%eax
+8010757e:	eb 87                	jmp    80107507 <slCheckInvariants+0xdd>
+      }
+    }
+  }
+
+  if (sl.nfree < 0 || sl.nfree + nvalid[0] != NPROC)
+80107580:	8b 35 a0 88 19 80    	mov    0x801988a0,%esi
+80107586:	85 f6                	test   %esi,%esi
+80107588:	78 38                	js     801075c2 <slCheckInvariants+0x198>
+8010758a:	89 f0                	mov    %esi,%eax
+8010758c:	03 45 d0             	add    -0x30(%ebp),%eax
+8010758f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80107594:	75 2c                	jne    801075c2 <slCheckInvariants+0x198>
+    panic("slCheck: free stack count mismatch");
+  for (int n = 0; n < sl.nfree; n++) {
+80107596:	ba 00 00 00 00       	mov    $0x0,%edx
+8010759b:	39 d6                	cmp    %edx,%esi
+8010759d:	7e 4a                	jle    801075e9 <slCheckInvariants+0x1bf>
+    if (sl.freeNodes[n] < 1 || sl.freeNodes[n] > NPROC)
+8010759f:	8b 04 95 a0 48 19 80 	mov    -0x7fe6b760(,%edx,4),%eax
+801075a6:	8d 58 ff             	lea    -0x1(%eax),%ebx
+801075a9:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+801075af:	77 1e                	ja     801075cf <slCheckInvariants+0x1a5>
+      panic("slCheck: free index out of bounds");
+    if (sl.nodeList[sl.freeNodes[n]].valid)
+801075b1:	c1 e0 06             	shl    $0x6,%eax
+801075b4:	83 b8 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%eax)
+801075bb:	75 1f                	jne    801075dc <slCheckInvariants+0x1b2>
+  for (int n = 0; n < sl.nfree; n++) {
+801075bd:	83 c2 01             	add    $0x1,%edx
+801075c0:	eb d9                	jmp    8010759b <slCheckInvariants+0x171>
+    panic("slCheck: free stack count mismatch");
+801075c2:	83 ec 0c             	sub    $0xc,%esp
+801075c5:	68 1c bb 10 80       	push   $0x8010bb1c
+801075ca:	e8 33 93 ff ff       	call   80100902 <panic>
+      panic("slCheck: free index out of bounds");
+801075cf:	83 ec 0c             	sub    $0xc,%esp
+801075d2:	68 40 bb 10 80       	push   $0x8010bb40
+801075d7:	e8 26 93 ff ff       	call   80100902 <panic>
+      panic("slCheck: valid node on free stack");
+801075dc:	83 ec 0c             	sub    $0xc,%esp
+801075df:	68 64 bb 10 80       	push   $0x8010bb64
+801075e4:	e8 19 93 ff ff       	call   80100902 <panic>
+  }
+
+  //* 2 - WALK EACH LEVEL: ORDER, BACK-LINKS, REACHABILITY
+  // ----------------------------------------------------
+
+  for (int i = 0; i <= sl.level; i++) {
+801075e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+801075ee:	e9 c7 00 00 00       	jmp    801076ba <slCheckInvariants+0x290>
+    int idx = head->forward[i];
+    int count = 0;
+
+    while (idx != -1) {
+      if (idx < 1 || idx > NPROC)
+        panic("slCheck: forward index out of bounds");
+801075f3:	83 ec 0c             	sub    $0xc,%esp
+801075f6:	68 88 bb 10 80       	push   $0x8010bb88
+801075fb:	e8 02 93 ff ff       	call   80100902 <panic>
+
+      struct SkipNode* node = &sl.nodeList[idx];
+
+      if (!node->valid)
+        panic("slCheck: invalid node reachable");
+80107600:	83 ec 0c             	sub    $0xc,%esp
+80107603:	68 b0 bb 10 80       	push   $0x8010bbb0
+80107608:	e8 f5 92 ff ff       	call   80100902 <panic>
+      if (node->maxlevel < i)
+        panic("slCheck: node linked above its maxlevel");
+8010760d:	83 ec 0c             	sub    $0xc,%esp
+80107610:	68 d0 bb 10 80       	push   $0x8010bbd0
+80107615:	e8 e8 92 ff ff       	call   80100902 <panic>
+      if (node->backward[i] != prevIdx)
+        panic("slCheck: backward link mismatch");
+8010761a:	83 ec 0c             	sub    $0xc,%esp
+8010761d:	68 f8 bb 10 80       	push   $0x8010bbf8
+80107622:	e8 db 92 ff ff       	call   80100902 <panic>
+      if (prevIdx != 0 && sl.nodeList[prevIdx].value > node->value)
+        panic("slCheck: level out of order");
+      if (++count > nvalid[i])
+80107627:	83 c7 01             	add    $0x1,%edi
+8010762a:	39 7c 9d d0          	cmp    %edi,-0x30(%ebp,%ebx,4)
+8010762e:	7c 74                	jl     801076a4 <slCheckInvariants+0x27a>
+        panic("slCheck: cycle or extra node in level");
+
+      prevIdx = idx;
+      idx = node->forward[i];
+80107630:	89 c6                	mov    %eax,%esi
+80107632:	c1 e6 04             	shl    $0x4,%esi
+80107635:	01 de                	add    %ebx,%esi
+      prevIdx = idx;
+80107637:	89 c2                	mov    %eax,%edx
+      idx = node->forward[i];
+80107639:	8b 04 b5 6c 48 15 80 	mov    -0x7feab794(,%esi,4),%eax
+    while (idx != -1) {
+80107640:	83 f8 ff             	cmp    $0xffffffff,%eax
+80107643:	74 6c                	je     801076b1 <slCheckInvariants+0x287>
+      if (idx < 1 || idx > NPROC)
+80107645:	8d 70 ff             	lea    -0x1(%eax),%esi
+80107648:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010764e:	77 a3                	ja     801075f3 <slCheckInvariants+0x1c9>
+      if (!node->valid)
+80107650:	89 c6                	mov    %eax,%esi
+80107652:	c1 e6 06             	shl    $0x6,%esi
+80107655:	83 be 60 48 15 80 00 	cmpl   $0x0,-0x7feab7a0(%esi)
+8010765c:	74 a2                	je     80107600 <slCheckInvariants+0x1d6>
+      if (node->maxlevel < i)
+8010765e:	89 c6                	mov    %eax,%esi
+80107660:	c1 e6 06             	shl    $0x6,%esi
+80107663:	39 9e 9c 48 15 80    	cmp    %ebx,-0x7feab764(%esi)
+80107669:	7c a2                	jl     8010760d <slCheckInvariants+0x1e3>
+      if (node->backward[i] != prevIdx)
+8010766b:	89 c6                	mov    %eax,%esi
+8010766d:	c1 e6 04             	shl    $0x4,%esi
+80107670:	8d 74 33 08          	lea    0x8(%ebx,%esi,1),%esi
+80107674:	39 14 b5 64 48 15 80 	cmp    %edx,-0x7feab79c(,%esi,4)
+8010767b:	75 9d                	jne    8010761a <slCheckInvariants+0x1f0>
+      if (prevIdx != 0 && sl.nodeList[prevIdx].value > node->value)
+8010767d:	85 d2                	test   %edx,%edx
+8010767f:	74 a6                	je     80107627 <slCheckInvariants+0x1fd>
+80107681:	c1 e2 06             	shl    $0x6,%edx
+80107684:	89 c6                	mov    %eax,%esi
+80107686:	c1 e6 06             	shl    $0x6,%esi
+80107689:	8b b6 64 48 15 80    	mov    -0x7feab79c(%esi),%esi
+8010768f:	39 b2 64 48 15 80    	cmp    %esi,-0x7feab79c(%edx)
+80107695:	7e 90                	jle    80107627 <slCheckInvariants+0x1fd>
+        panic("slCheck: level out of order");
+80107697:	83 ec 0c             	sub    $0xc,%esp
+8010769a:	68 fd bc 10 80       	push   $0x8010bcfd
+8010769f:	e8 5e 92 ff ff       	call   80100902 <panic>
+        panic("slCheck: cycle or extra node in level");
+801076a4:	83 ec 0c             	sub    $0xc,%esp
+801076a7:	68 18 bc 10 80       	push   $0x8010bc18
+801076ac:	e8 51 92 ff ff       	call   80100902 <panic>
+    }
+
+    if (count != nvalid[i])
+801076b1:	39 7c 9d d0          	cmp    %edi,-0x30(%ebp,%ebx,4)
+801076b5:	75 1d                	jne    801076d4 <slCheckInvariants+0x2aa>
+  for (int i = 0; i <= sl.level; i++) {
+801076b7:	83 c3 01             	add    $0x1,%ebx
+801076ba:	39 d9                	cmp    %ebx,%ecx
+801076bc:	7c 23                	jl     801076e1 <slCheckInvariants+0x2b7>
+    int idx = head->forward[i];
+801076be:	8b 04 9d 6c 48 15 80 	mov    -0x7feab794(,%ebx,4),%eax
+    int count = 0;
+801076c5:	bf 00 00 00 00       	mov    $0x0,%edi
+    int prevIdx = 0;
+801076ca:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (idx != -1) {
+801076cf:	e9 6c ff ff ff       	jmp    80107640 <slCheckInvariants+0x216>
+      panic("slCheck: valid node missing from level");
+801076d4:	83 ec 0c             	sub    $0xc,%esp
+801076d7:	68 40 bc 10 80       	push   $0x8010bc40
+801076dc:	e8 21 92 ff ff       	call   80100902 <panic>
+  }
+}
+801076e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801076e4:	5b                   	pop    %ebx
+801076e5:	5e                   	pop    %esi
+801076e6:	5f                   	pop    %edi
+801076e7:	5d                   	pop    %ebp
+801076e8:	c3                   	ret
+801076e9:	c3                   	ret
+
+801076ea <slabunlink>:
+#define SLABOF(o)  ((struct slab*)PGROUNDDOWN((uint)(o)))
+
+static void
+slabunlink(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+801076ea:	8b 4a 08             	mov    0x8(%edx),%ecx
+801076ed:	85 c9                	test   %ecx,%ecx
+801076ef:	74 22                	je     80107713 <slabunlink+0x29>
+    s->prev->next = s->next;
+801076f1:	8b 42 04             	mov    0x4(%edx),%eax
+801076f4:	89 41 04             	mov    %eax,0x4(%ecx)
+  else
+    c->partial = s->next;
+  if(s->next)
+801076f7:	8b 42 04             	mov    0x4(%edx),%eax
+801076fa:	85 c0                	test   %eax,%eax
+801076fc:	74 06                	je     80107704 <slabunlink+0x1a>
+    s->next->prev = s->prev;
+801076fe:	8b 4a 08             	mov    0x8(%edx),%ecx
+80107701:	89 48 08             	mov    %ecx,0x8(%eax)
+  s->next = s->prev = 0;
+80107704:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+8010770b:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+}
+80107712:	c3                   	ret
+    c->partial = s->next;
+80107713:	8b 4a 04             	mov    0x4(%edx),%ecx
+80107716:	89 48 54             	mov    %ecx,0x54(%eax)
+80107719:	eb dc                	jmp    801076f7 <slabunlink+0xd>
+
+8010771b <slablink>:
+
+static void
+slablink(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+8010771b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  s->next = c->partial;
+80107722:	8b 48 54             	mov    0x54(%eax),%ecx
+80107725:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(c->partial)
+80107728:	85 c9                	test   %ecx,%ecx
+8010772a:	74 03                	je     8010772f <slablink+0x14>
+    c->partial->prev = s;
+8010772c:	89 51 08             	mov    %edx,0x8(%ecx)
+  c->partial = s;
+8010772f:	89 50 54             	mov    %edx,0x54(%eax)
+}
+80107732:	c3                   	ret
+
+80107733 <slabget>:
+
+// Take an object from the slabs, adding a slab if they are full.
+// Caller holds c->lock.
+static void*
+slabget(struct slabcache *c)
+{
+80107733:	55                   	push   %ebp
+80107734:	89 e5                	mov    %esp,%ebp
+80107736:	56                   	push   %esi
+80107737:	53                   	push   %ebx
+80107738:	89 c6                	mov    %eax,%esi
+  struct slab *s;
+  char *o;
+  void *obj;
+
+  if(c->partial == 0){
+8010773a:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+8010773e:	74 21                	je     80107761 <slabget+0x2e>
+      *(void**)o = s->free;
+      s->free = o;
+    }
+    slablink(c, s);
+  }
+  s = c->partial;
+80107740:	8b 56 54             	mov    0x54(%esi),%edx
+  obj = s->free;
+80107743:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  s->free = *(void**)obj;
+80107746:	8b 0b                	mov    (%ebx),%ecx
+80107748:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  s->inuse++;
+8010774b:	8b 42 10             	mov    0x10(%edx),%eax
+8010774e:	83 c0 01             	add    $0x1,%eax
+80107751:	89 42 10             	mov    %eax,0x10(%edx)
+  if(s->free == 0)
+80107754:	85 c9                	test   %ecx,%ecx
+80107756:	74 78                	je     801077d0 <slabget+0x9d>
+    slabunlink(c, s);
+  return obj;
+}
+80107758:	89 d8                	mov    %ebx,%eax
+8010775a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010775d:	5b                   	pop    %ebx
+8010775e:	5e                   	pop    %esi
+8010775f:	5d                   	pop    %ebp
+80107760:	c3                   	ret
+    if(c->size < sizeof(void*) || sizeof(struct slab) + c->size > PGSIZE)
+80107761:	8b 50 04             	mov    0x4(%eax),%edx
+80107764:	8d 82 13 f0 ff ff    	lea    -0xfed(%edx),%eax
+8010776a:	3d fe ef ff ff       	cmp    $0xffffeffe,%eax
+8010776f:	0f 96 c0             	setbe  %al
+80107772:	83 fa 03             	cmp    $0x3,%edx
+80107775:	0f 96 c2             	setbe  %dl
+80107778:	08 d0                	or     %dl,%al
+8010777a:	75 27                	jne    801077a3 <slabget+0x70>
+    if((s = (struct slab*)kalloc()) == 0)
+8010777c:	e8 8b bf ff ff       	call   8010370c <kalloc>
+80107781:	89 c3                	mov    %eax,%ebx
+80107783:	85 c0                	test   %eax,%eax
+80107785:	74 d1                	je     80107758 <slabget+0x25>
+    s->cache = c;
+80107787:	89 30                	mov    %esi,(%eax)
+    s->free = 0;
+80107789:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    s->inuse = 0;
+80107790:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+    for(o = (char*)s + PGSIZE - c->size; o >= (char*)(s + 1); o -= c->size){
+80107797:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010779c:	2b 46 04             	sub    0x4(%esi),%eax
+8010779f:	01 d8                	add    %ebx,%eax
+801077a1:	eb 18                	jmp    801077bb <slabget+0x88>
+      panic("slabget: bad size");
+801077a3:	83 ec 0c             	sub    $0xc,%esp
+801077a6:	68 20 bd 10 80       	push   $0x8010bd20
+801077ab:	e8 52 91 ff ff       	call   80100902 <panic>
+      *(void**)o = s->free;
+801077b0:	8b 53 0c             	mov    0xc(%ebx),%edx
+801077b3:	89 10                	mov    %edx,(%eax)
+      s->free = o;
+801077b5:	89 43 0c             	mov    %eax,0xc(%ebx)
+    for(o = (char*)s + PGSIZE - c->size; o >= (char*)(s + 1); o -= c->size){
+801077b8:	2b 46 04             	sub    0x4(%esi),%eax
+801077bb:	8d 53 14             	lea    0x14(%ebx),%edx
+801077be:	39 d0                	cmp    %edx,%eax
+801077c0:	73 ee                	jae    801077b0 <slabget+0x7d>
+    slablink(c, s);
+801077c2:	89 da                	mov    %ebx,%edx
+801077c4:	89 f0                	mov    %esi,%eax
+801077c6:	e8 50 ff ff ff       	call   8010771b <slablink>
+801077cb:	e9 70 ff ff ff       	jmp    80107740 <slabget+0xd>
+    slabunlink(c, s);
+801077d0:	89 f0                	mov    %esi,%eax
+801077d2:	e8 13 ff ff ff       	call   801076ea <slabunlink>
+801077d7:	e9 7c ff ff ff       	jmp    80107758 <slabget+0x25>
+
+801077dc <slabput>:
+// Return an object to its slab, freeing the slab if it is
+// now empty and not the only one with room.
+// Caller holds c->lock.
+static void
+slabput(struct slabcache *c, void *obj)
+{
+801077dc:	55                   	push   %ebp
+801077dd:	89 e5                	mov    %esp,%ebp
+801077df:	57                   	push   %edi
+801077e0:	56                   	push   %esi
+801077e1:	53                   	push   %ebx
+801077e2:	83 ec 0c             	sub    $0xc,%esp
+  struct slab *s = SLABOF(obj);
+801077e5:	89 d3                	mov    %edx,%ebx
+801077e7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  if(s->cache != c)
+801077ed:	39 03                	cmp    %eax,(%ebx)
+801077ef:	75 40                	jne    80107831 <slabput+0x55>
+801077f1:	89 c7                	mov    %eax,%edi
+801077f3:	89 d6                	mov    %edx,%esi
+    panic("slabfree: wrong cache");
+  if(s->free == 0)
+801077f5:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+801077f9:	74 43                	je     8010783e <slabput+0x62>
+    slablink(c, s);
+  *(void**)obj = s->free;
+801077fb:	8b 43 0c             	mov    0xc(%ebx),%eax
+801077fe:	89 06                	mov    %eax,(%esi)
+  s->free = obj;
+80107800:	89 73 0c             	mov    %esi,0xc(%ebx)
+  if(--s->inuse == 0 && (s->next || s->prev)){
+80107803:	8b 43 10             	mov    0x10(%ebx),%eax
+80107806:	83 e8 01             	sub    $0x1,%eax
+80107809:	89 43 10             	mov    %eax,0x10(%ebx)
+8010780c:	75 1b                	jne    80107829 <slabput+0x4d>
+8010780e:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+80107812:	74 33                	je     80107847 <slabput+0x6b>
+    slabunlink(c, s);
+80107814:	89 da                	mov    %ebx,%edx
+80107816:	89 f8                	mov    %edi,%eax
+80107818:	e8 cd fe ff ff       	call   801076ea <slabunlink>
+    kfree((char*)s);
+8010781d:	83 ec 0c             	sub    $0xc,%esp
+80107820:	53                   	push   %ebx
+80107821:	e8 0e bd ff ff       	call   80103534 <kfree>
+80107826:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80107829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010782c:	5b                   	pop    %ebx
+8010782d:	5e                   	pop    %esi
+8010782e:	5f                   	pop    %edi
+8010782f:	5d                   	pop    %ebp
+80107830:	c3                   	ret
+    panic("slabfree: wrong cache");
+80107831:	83 ec 0c             	sub    $0xc,%esp
+80107834:	68 32 bd 10 80       	push   $0x8010bd32
+80107839:	e8 c4 90 ff ff       	call   80100902 <panic>
+    slablink(c, s);
+8010783e:	89 da                	mov    %ebx,%edx
+80107840:	e8 d6 fe ff ff       	call   8010771b <slablink>
+80107845:	eb b4                	jmp    801077fb <slabput+0x1f>
+  if(--s->inuse == 0 && (s->next || s->prev)){
+80107847:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+8010784b:	75 c7                	jne    80107814 <slabput+0x38>
+8010784d:	eb da                	jmp    80107829 <slabput+0x4d>
+
+8010784f <slaballoc>:
+
+// Allocate an object from c, or return 0 if out of memory.
+// The object's contents are undefined.
+void*
+slaballoc(struct slabcache *c)
+{
+8010784f:	55                   	push   %ebp
+80107850:	89 e5                	mov    %esp,%ebp
+80107852:	57                   	push   %edi
+80107853:	56                   	push   %esi
+80107854:	53                   	push   %ebx
+80107855:	83 ec 1c             	sub    $0x1c,%esp
+80107858:	8b 75 08             	mov    0x8(%ebp),%esi
+  void *obj, *o;
+  int n;
+
+  pushcli();
+8010785b:	e8 da 02 00 00       	call   80107b3a <pushcli>
+  n = cpuid();
+80107860:	e8 58 e1 ff ff       	call   801059bd <cpuid>
+80107865:	89 c3                	mov    %eax,%ebx
+  if(c->mag[n].n == 0){
+80107867:	6b c0 44             	imul   $0x44,%eax,%eax
+8010786a:	83 bc 06 98 00 00 00 	cmpl   $0x0,0x98(%esi,%eax,1)
+80107871:	00 
+80107872:	74 3d                	je     801078b1 <slaballoc+0x62>
+    while(c->mag[n].n < SLABMAG/2 && (o = slabget(c)) != 0)
+      c->mag[n].obj[c->mag[n].n++] = o;
+    release(&c->lock);
+  }
+  obj = 0;
+  if(c->mag[n].n > 0)
+80107874:	6b c3 44             	imul   $0x44,%ebx,%eax
+80107877:	8b 84 06 98 00 00 00 	mov    0x98(%esi,%eax,1),%eax
+8010787e:	85 c0                	test   %eax,%eax
+80107880:	0f 8e 8e 00 00 00    	jle    80107914 <slaballoc+0xc5>
+    obj = c->mag[n].obj[--c->mag[n].n];
+80107886:	83 e8 01             	sub    $0x1,%eax
+80107889:	6b d3 44             	imul   $0x44,%ebx,%edx
+8010788c:	89 84 16 98 00 00 00 	mov    %eax,0x98(%esi,%edx,1)
+80107893:	89 da                	mov    %ebx,%edx
+80107895:	c1 e2 04             	shl    $0x4,%edx
+80107898:	01 da                	add    %ebx,%edx
+8010789a:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+8010789e:	8b 5c 86 08          	mov    0x8(%esi,%eax,4),%ebx
+  popcli();
+801078a2:	e8 d7 02 00 00       	call   80107b7e <popcli>
+  return obj;
+}
+801078a7:	89 d8                	mov    %ebx,%eax
+801078a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801078ac:	5b                   	pop    %ebx
+801078ad:	5e                   	pop    %esi
+801078ae:	5f                   	pop    %edi
+801078af:	5d                   	pop    %ebp
+801078b0:	c3                   	ret
+    acquire(&c->lock);
+801078b1:	8d 7e 08             	lea    0x8(%esi),%edi
+801078b4:	83 ec 0c             	sub    $0xc,%esp
+801078b7:	57                   	push   %edi
+801078b8:	e8 60 03 00 00       	call   80107c1d <acquire>
+    while(c->mag[n].n < SLABMAG/2 && (o = slabget(c)) != 0)
+801078bd:	83 c4 10             	add    $0x10,%esp
+801078c0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801078c3:	6b c3 44             	imul   $0x44,%ebx,%eax
+801078c6:	83 bc 06 98 00 00 00 	cmpl   $0x7,0x98(%esi,%eax,1)
+801078cd:	07 
+801078ce:	7f 30                	jg     80107900 <slaballoc+0xb1>
+801078d0:	89 f0                	mov    %esi,%eax
+801078d2:	e8 5c fe ff ff       	call   80107733 <slabget>
+801078d7:	85 c0                	test   %eax,%eax
+801078d9:	74 25                	je     80107900 <slaballoc+0xb1>
+      c->mag[n].obj[c->mag[n].n++] = o;
+801078db:	6b d3 44             	imul   $0x44,%ebx,%edx
+801078de:	01 f2                	add    %esi,%edx
+801078e0:	8b 8a 98 00 00 00    	mov    0x98(%edx),%ecx
+801078e6:	8d 79 01             	lea    0x1(%ecx),%edi
+801078e9:	89 ba 98 00 00 00    	mov    %edi,0x98(%edx)
+801078ef:	89 da                	mov    %ebx,%edx
+801078f1:	c1 e2 04             	shl    $0x4,%edx
+801078f4:	01 da                	add    %ebx,%edx
+801078f6:	8d 54 11 14          	lea    0x14(%ecx,%edx,1),%edx
+801078fa:	89 44 96 08          	mov    %eax,0x8(%esi,%edx,4)
+801078fe:	eb c3                	jmp    801078c3 <slaballoc+0x74>
+    release(&c->lock);
+80107900:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80107903:	83 ec 0c             	sub    $0xc,%esp
+80107906:	57                   	push   %edi
+80107907:	e8 90 03 00 00       	call   80107c9c <release>
+8010790c:	83 c4 10             	add    $0x10,%esp
+8010790f:	e9 60 ff ff ff       	jmp    80107874 <slaballoc+0x25>
+  obj = 0;
+80107914:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107919:	eb 87                	jmp    801078a2 <slaballoc+0x53>
+
+8010791b <slabfree>:
+
+// Free an object allocated from c.
+void
+slabfree(struct slabcache *c, void *obj)
+{
+8010791b:	55                   	push   %ebp
+8010791c:	89 e5                	mov    %esp,%ebp
+8010791e:	57                   	push   %edi
+8010791f:	56                   	push   %esi
+80107920:	53                   	push   %ebx
+80107921:	83 ec 0c             	sub    $0xc,%esp
+80107924:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  pushcli();
+80107927:	e8 0e 02 00 00       	call   80107b3a <pushcli>
+  n = cpuid();
+8010792c:	e8 8c e0 ff ff       	call   801059bd <cpuid>
+80107931:	89 c3                	mov    %eax,%ebx
+  if(c->mag[n].n == SLABMAG){
+80107933:	6b c0 44             	imul   $0x44,%eax,%eax
+80107936:	83 bc 06 98 00 00 00 	cmpl   $0x10,0x98(%esi,%eax,1)
+8010793d:	10 
+8010793e:	74 33                	je     80107973 <slabfree+0x58>
+    acquire(&c->lock);
+    while(c->mag[n].n > SLABMAG/2)
+      slabput(c, c->mag[n].obj[--c->mag[n].n]);
+    release(&c->lock);
+  }
+  c->mag[n].obj[c->mag[n].n++] = obj;
+80107940:	6b c3 44             	imul   $0x44,%ebx,%eax
+80107943:	01 f0                	add    %esi,%eax
+80107945:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+8010794b:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010794e:	89 88 98 00 00 00    	mov    %ecx,0x98(%eax)
+80107954:	89 d8                	mov    %ebx,%eax
+80107956:	c1 e0 04             	shl    $0x4,%eax
+80107959:	01 d8                	add    %ebx,%eax
+8010795b:	8d 44 02 14          	lea    0x14(%edx,%eax,1),%eax
+8010795f:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107962:	89 54 86 08          	mov    %edx,0x8(%esi,%eax,4)
+  popcli();
+80107966:	e8 13 02 00 00       	call   80107b7e <popcli>
+}
+8010796b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010796e:	5b                   	pop    %ebx
+8010796f:	5e                   	pop    %esi
+80107970:	5f                   	pop    %edi
+80107971:	5d                   	pop    %ebp
+80107972:	c3                   	ret
+    acquire(&c->lock);
+80107973:	8d 7e 08             	lea    0x8(%esi),%edi
+80107976:	83 ec 0c             	sub    $0xc,%esp
+80107979:	57                   	push   %edi
+8010797a:	e8 9e 02 00 00       	call   80107c1d <acquire>
+    while(c->mag[n].n > SLABMAG/2)
+8010797f:	83 c4 10             	add    $0x10,%esp
+80107982:	eb 23                	jmp    801079a7 <slabfree+0x8c>
+      slabput(c, c->mag[n].obj[--c->mag[n].n]);
+80107984:	83 e8 01             	sub    $0x1,%eax
+80107987:	6b d3 44             	imul   $0x44,%ebx,%edx
+8010798a:	89 84 16 98 00 00 00 	mov    %eax,0x98(%esi,%edx,1)
+80107991:	89 da                	mov    %ebx,%edx
+80107993:	c1 e2 04             	shl    $0x4,%edx
+80107996:	01 da                	add    %ebx,%edx
+80107998:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+8010799c:	8b 54 86 08          	mov    0x8(%esi,%eax,4),%edx
+801079a0:	89 f0                	mov    %esi,%eax
+801079a2:	e8 35 fe ff ff       	call   801077dc <slabput>
+    while(c->mag[n].n > SLABMAG/2)
+801079a7:	6b c3 44             	imul   $0x44,%ebx,%eax
+801079aa:	8b 84 06 98 00 00 00 	mov    0x98(%esi,%eax,1),%eax
+801079b1:	83 f8 08             	cmp    $0x8,%eax
+801079b4:	7f ce                	jg     80107984 <slabfree+0x69>
+    release(&c->lock);
+801079b6:	83 ec 0c             	sub    $0xc,%esp
+801079b9:	57                   	push   %edi
+801079ba:	e8 dd 02 00 00       	call   80107c9c <release>
+801079bf:	83 c4 10             	add    $0x10,%esp
+801079c2:	e9 79 ff ff ff       	jmp    80107940 <slabfree+0x25>
+
+801079c7 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801079c7:	55                   	push   %ebp
+801079c8:	89 e5                	mov    %esp,%ebp
+801079ca:	53                   	push   %ebx
+801079cb:	83 ec 0c             	sub    $0xc,%esp
+801079ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801079d1:	68 48 bd 10 80       	push   $0x8010bd48
+801079d6:	8d 43 04             	lea    0x4(%ebx),%eax
+801079d9:	50                   	push   %eax
+801079da:	e8 f3 00 00 00       	call   80107ad2 <initlock>
+  lk->name = name;
+801079df:	8b 45 0c             	mov    0xc(%ebp),%eax
+801079e2:	89 43 50             	mov    %eax,0x50(%ebx)
+  lk->locked = 0;
+801079e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801079eb:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+}
+801079f2:	83 c4 10             	add    $0x10,%esp
+801079f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079f8:	c9                   	leave
+801079f9:	c3                   	ret
+
+801079fa <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801079fa:	55                   	push   %ebp
+801079fb:	89 e5                	mov    %esp,%ebp
+801079fd:	56                   	push   %esi
+801079fe:	53                   	push   %ebx
+801079ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107a02:	8d 73 04             	lea    0x4(%ebx),%esi
+80107a05:	83 ec 0c             	sub    $0xc,%esp
+80107a08:	56                   	push   %esi
+80107a09:	e8 0f 02 00 00       	call   80107c1d <acquire>
+  while (lk->locked) {
+80107a0e:	83 c4 10             	add    $0x10,%esp
+80107a11:	eb 0d                	jmp    80107a20 <acquiresleep+0x26>
+    sleep(lk, &lk->lk);
+80107a13:	83 ec 08             	sub    $0x8,%esp
+80107a16:	56                   	push   %esi
+80107a17:	53                   	push   %ebx
+80107a18:	e8 5a eb ff ff       	call   80106577 <sleep>
+80107a1d:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked) {
+80107a20:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107a23:	75 ee                	jne    80107a13 <acquiresleep+0x19>
+  }
+  lk->locked = 1;
+80107a25:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107a2b:	e8 a8 df ff ff       	call   801059d8 <myproc>
+80107a30:	8b 40 10             	mov    0x10(%eax),%eax
+80107a33:	89 43 54             	mov    %eax,0x54(%ebx)
+  release(&lk->lk);
+80107a36:	83 ec 0c             	sub    $0xc,%esp
+80107a39:	56                   	push   %esi
+80107a3a:	e8 5d 02 00 00       	call   80107c9c <release>
+}
+80107a3f:	83 c4 10             	add    $0x10,%esp
+80107a42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a45:	5b                   	pop    %ebx
+80107a46:	5e                   	pop    %esi
+80107a47:	5d                   	pop    %ebp
+80107a48:	c3                   	ret
+
+80107a49 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107a49:	55                   	push   %ebp
+80107a4a:	89 e5                	mov    %esp,%ebp
+80107a4c:	56                   	push   %esi
+80107a4d:	53                   	push   %ebx
+80107a4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107a51:	8d 73 04             	lea    0x4(%ebx),%esi
+80107a54:	83 ec 0c             	sub    $0xc,%esp
+80107a57:	56                   	push   %esi
+80107a58:	e8 c0 01 00 00       	call   80107c1d <acquire>
+  lk->locked = 0;
+80107a5d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80107a63:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+  wakeup(lk);
+80107a6a:	89 1c 24             	mov    %ebx,(%esp)
+80107a6d:	e8 5a ec ff ff       	call   801066cc <wakeup>
+  release(&lk->lk);
+80107a72:	89 34 24             	mov    %esi,(%esp)
+80107a75:	e8 22 02 00 00       	call   80107c9c <release>
+}
+80107a7a:	83 c4 10             	add    $0x10,%esp
+80107a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a80:	5b                   	pop    %ebx
+80107a81:	5e                   	pop    %esi
+80107a82:	5d                   	pop    %ebp
+80107a83:	c3                   	ret
+
+80107a84 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107a84:	55                   	push   %ebp
+80107a85:	89 e5                	mov    %esp,%ebp
+80107a87:	56                   	push   %esi
+80107a88:	53                   	push   %ebx
+80107a89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+80107a8c:	8d 73 04             	lea    0x4(%ebx),%esi
+80107a8f:	83 ec 0c             	sub    $0xc,%esp
+80107a92:	56                   	push   %esi
+80107a93:	e8 85 01 00 00       	call   80107c1d <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107a98:	83 c4 10             	add    $0x10,%esp
+80107a9b:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107a9e:	75 17                	jne    80107ab7 <holdingsleep+0x33>
+80107aa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  release(&lk->lk);
+80107aa5:	83 ec 0c             	sub    $0xc,%esp
+80107aa8:	56                   	push   %esi
+80107aa9:	e8 ee 01 00 00       	call   80107c9c <release>
+  return r;
+}
+80107aae:	89 d8                	mov    %ebx,%eax
+80107ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ab3:	5b                   	pop    %ebx
+80107ab4:	5e                   	pop    %esi
+80107ab5:	5d                   	pop    %ebp
+80107ab6:	c3                   	ret
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107ab7:	8b 5b 54             	mov    0x54(%ebx),%ebx
+80107aba:	e8 19 df ff ff       	call   801059d8 <myproc>
+80107abf:	3b 58 10             	cmp    0x10(%eax),%ebx
+80107ac2:	74 07                	je     80107acb <holdingsleep+0x47>
+80107ac4:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107ac9:	eb da                	jmp    80107aa5 <holdingsleep+0x21>
+80107acb:	bb 01 00 00 00       	mov    $0x1,%ebx
+80107ad0:	eb d3                	jmp    80107aa5 <holdingsleep+0x21>
+
+80107ad2 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107ad2:	55                   	push   %ebp
+80107ad3:	89 e5                	mov    %esp,%ebp
+80107ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107adb:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+80107ade:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+80107ae4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  lk->profile = 0;
+80107aeb:	c7 40 34 00 00 00 00 	movl   $0x0,0x34(%eax)
+}
+80107af2:	5d                   	pop    %ebp
+80107af3:	c3                   	ret
+
+80107af4 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107af4:	55                   	push   %ebp
+80107af5:	89 e5                	mov    %esp,%ebp
+80107af7:	53                   	push   %ebx
+80107af8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107afb:	8b 45 08             	mov    0x8(%ebp),%eax
+80107afe:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+80107b01:	b8 00 00 00 00       	mov    $0x0,%eax
+80107b06:	83 f8 09             	cmp    $0x9,%eax
+80107b09:	7f 25                	jg     80107b30 <getcallerpcs+0x3c>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107b0b:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80107b11:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107b17:	77 17                	ja     80107b30 <getcallerpcs+0x3c>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80107b19:	8b 5a 04             	mov    0x4(%edx),%ebx
+80107b1c:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107b1f:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80107b21:	83 c0 01             	add    $0x1,%eax
+80107b24:	eb e0                	jmp    80107b06 <getcallerpcs+0x12>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+80107b26:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+  for(; i < 10; i++)
+80107b2d:	83 c0 01             	add    $0x1,%eax
+80107b30:	83 f8 09             	cmp    $0x9,%eax
+80107b33:	7e f1                	jle    80107b26 <getcallerpcs+0x32>
+}
+80107b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107b38:	c9                   	leave
+80107b39:	c3                   	ret
+
+80107b3a <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80107b3a:	55                   	push   %ebp
+80107b3b:	89 e5                	mov    %esp,%ebp
+80107b3d:	53                   	push   %ebx
+80107b3e:	83 ec 04             	sub    $0x4,%esp
+80107b41:	9c                   	pushf
+80107b42:	5b                   	pop    %ebx
+  asm volatile("cli");
+80107b43:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80107b44:	e8 18 de ff ff       	call   80105961 <mycpu>
+80107b49:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80107b50:	74 19                	je     80107b6b <pushcli+0x31>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107b52:	e8 0a de ff ff       	call   80105961 <mycpu>
+80107b57:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80107b5d:	8d 51 01             	lea    0x1(%ecx),%edx
+80107b60:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+}
+80107b66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107b69:	c9                   	leave
+80107b6a:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+80107b6b:	e8 f1 dd ff ff       	call   80105961 <mycpu>
+80107b70:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107b76:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107b7c:	eb d4                	jmp    80107b52 <pushcli+0x18>
+
+80107b7e <popcli>:
+
+void
+popcli(void)
+{
+80107b7e:	55                   	push   %ebp
+80107b7f:	89 e5                	mov    %esp,%ebp
+80107b81:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107b84:	9c                   	pushf
+80107b85:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107b86:	f6 c4 02             	test   $0x2,%ah
+80107b89:	75 28                	jne    80107bb3 <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107b8b:	e8 d1 dd ff ff       	call   80105961 <mycpu>
+80107b90:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80107b96:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80107b99:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+80107b9f:	85 d2                	test   %edx,%edx
+80107ba1:	78 1d                	js     80107bc0 <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107ba3:	e8 b9 dd ff ff       	call   80105961 <mycpu>
+80107ba8:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80107baf:	74 1c                	je     80107bcd <popcli+0x4f>
+    sti();
+}
+80107bb1:	c9                   	leave
+80107bb2:	c3                   	ret
+    panic("popcli - interruptible");
+80107bb3:	83 ec 0c             	sub    $0xc,%esp
+80107bb6:	68 53 bd 10 80       	push   $0x8010bd53
+80107bbb:	e8 42 8d ff ff       	call   80100902 <panic>
+    panic("popcli");
+80107bc0:	83 ec 0c             	sub    $0xc,%esp
+80107bc3:	68 6a bd 10 80       	push   $0x8010bd6a
+80107bc8:	e8 35 8d ff ff       	call   80100902 <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107bcd:	e8 8f dd ff ff       	call   80105961 <mycpu>
+80107bd2:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+80107bd9:	74 d6                	je     80107bb1 <popcli+0x33>
+  asm volatile("sti");
+80107bdb:	fb                   	sti
+}
+80107bdc:	eb d3                	jmp    80107bb1 <popcli+0x33>
+
+80107bde <holding>:
+{
+80107bde:	55                   	push   %ebp
+80107bdf:	89 e5                	mov    %esp,%ebp
+80107be1:	53                   	push   %ebx
+80107be2:	83 ec 04             	sub    $0x4,%esp
+80107be5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107be8:	e8 4d ff ff ff       	call   80107b3a <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107bed:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107bf0:	75 11                	jne    80107c03 <holding+0x25>
+80107bf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  popcli();
+80107bf7:	e8 82 ff ff ff       	call   80107b7e <popcli>
+}
+80107bfc:	89 d8                	mov    %ebx,%eax
+80107bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c01:	c9                   	leave
+80107c02:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80107c03:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80107c06:	e8 56 dd ff ff       	call   80105961 <mycpu>
+80107c0b:	39 c3                	cmp    %eax,%ebx
+80107c0d:	74 07                	je     80107c16 <holding+0x38>
+80107c0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107c14:	eb e1                	jmp    80107bf7 <holding+0x19>
+80107c16:	bb 01 00 00 00       	mov    $0x1,%ebx
+80107c1b:	eb da                	jmp    80107bf7 <holding+0x19>
+
+80107c1d <acquire>:
+{
+80107c1d:	55                   	push   %ebp
+80107c1e:	89 e5                	mov    %esp,%ebp
+80107c20:	53                   	push   %ebx
+80107c21:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107c24:	e8 11 ff ff ff       	call   80107b3a <pushcli>
+  if(holding(lk))
+80107c29:	83 ec 0c             	sub    $0xc,%esp
+80107c2c:	ff 75 08             	push   0x8(%ebp)
+80107c2f:	e8 aa ff ff ff       	call   80107bde <holding>
+80107c34:	83 c4 10             	add    $0x10,%esp
+80107c37:	85 c0                	test   %eax,%eax
+80107c39:	75 54                	jne    80107c8f <acquire+0x72>
+  while(xchg(&lk->locked, 1) != 0)
+80107c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+80107c3e:	b8 01 00 00 00       	mov    $0x1,%eax
+80107c43:	f0 87 02             	lock xchg %eax,(%edx)
+80107c46:	85 c0                	test   %eax,%eax
+80107c48:	75 f1                	jne    80107c3b <acquire+0x1e>
+  __sync_synchronize();
+80107c4a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107c4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107c52:	e8 0a dd ff ff       	call   80105961 <mycpu>
+80107c57:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+80107c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+80107c5d:	83 c0 0c             	add    $0xc,%eax
+80107c60:	83 ec 08             	sub    $0x8,%esp
+80107c63:	50                   	push   %eax
+80107c64:	8d 45 08             	lea    0x8(%ebp),%eax
+80107c67:	50                   	push   %eax
+80107c68:	e8 87 fe ff ff       	call   80107af4 <getcallerpcs>
+  if(lk->profile){
+80107c6d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107c70:	83 c4 10             	add    $0x10,%esp
+80107c73:	83 79 34 00          	cmpl   $0x0,0x34(%ecx)
+80107c77:	74 11                	je     80107c8a <acquire+0x6d>
+    lk->nacquire++;
+80107c79:	8b 41 38             	mov    0x38(%ecx),%eax
+80107c7c:	83 c0 01             	add    $0x1,%eax
+80107c7f:	89 41 38             	mov    %eax,0x38(%ecx)
+  asm volatile("rdtsc" : "=A" (val));
+80107c82:	0f 31                	rdtsc
+    lk->tacquire = rdtsc();
+80107c84:	89 41 44             	mov    %eax,0x44(%ecx)
+80107c87:	89 51 48             	mov    %edx,0x48(%ecx)
+}
+80107c8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c8d:	c9                   	leave
+80107c8e:	c3                   	ret
+    panic("acquire");
+80107c8f:	83 ec 0c             	sub    $0xc,%esp
+80107c92:	68 71 bd 10 80       	push   $0x8010bd71
+80107c97:	e8 66 8c ff ff       	call   80100902 <panic>
+
+80107c9c <release>:
+{
+80107c9c:	55                   	push   %ebp
+80107c9d:	89 e5                	mov    %esp,%ebp
+80107c9f:	53                   	push   %ebx
+80107ca0:	83 ec 10             	sub    $0x10,%esp
+80107ca3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80107ca6:	53                   	push   %ebx
+80107ca7:	e8 32 ff ff ff       	call   80107bde <holding>
+80107cac:	83 c4 10             	add    $0x10,%esp
+80107caf:	85 c0                	test   %eax,%eax
+80107cb1:	74 37                	je     80107cea <release+0x4e>
+  if(lk->profile)
+80107cb3:	83 7b 34 00          	cmpl   $0x0,0x34(%ebx)
+80107cb7:	74 0e                	je     80107cc7 <release+0x2b>
+80107cb9:	0f 31                	rdtsc
+    lk->holdcycles += rdtsc() - lk->tacquire;
+80107cbb:	2b 43 44             	sub    0x44(%ebx),%eax
+80107cbe:	1b 53 48             	sbb    0x48(%ebx),%edx
+80107cc1:	01 43 3c             	add    %eax,0x3c(%ebx)
+80107cc4:	11 53 40             	adc    %edx,0x40(%ebx)
+  lk->pcs[0] = 0;
+80107cc7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107cce:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107cd5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107cda:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+80107ce0:	e8 99 fe ff ff       	call   80107b7e <popcli>
+}
+80107ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ce8:	c9                   	leave
+80107ce9:	c3                   	ret
+    panic("release");
+80107cea:	83 ec 0c             	sub    $0xc,%esp
+80107ced:	68 79 bd 10 80       	push   $0x8010bd79
+80107cf2:	e8 0b 8c ff ff       	call   80100902 <panic>
+
+80107cf7 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107cf7:	55                   	push   %ebp
+80107cf8:	89 e5                	mov    %esp,%ebp
+80107cfa:	57                   	push   %edi
+80107cfb:	53                   	push   %ebx
+80107cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+80107cff:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107d02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107d05:	f6 c2 03             	test   $0x3,%dl
+80107d08:	75 25                	jne    80107d2f <memset+0x38>
+80107d0a:	f6 c1 03             	test   $0x3,%cl
+80107d0d:	75 20                	jne    80107d2f <memset+0x38>
+    c &= 0xFF;
+80107d0f:	0f b6 f8             	movzbl %al,%edi
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107d12:	c1 e9 02             	shr    $0x2,%ecx
+80107d15:	c1 e0 18             	shl    $0x18,%eax
+80107d18:	89 fb                	mov    %edi,%ebx
+80107d1a:	c1 e3 10             	shl    $0x10,%ebx
+80107d1d:	09 d8                	or     %ebx,%eax
+80107d1f:	89 fb                	mov    %edi,%ebx
+80107d21:	c1 e3 08             	shl    $0x8,%ebx
+80107d24:	09 d8                	or     %ebx,%eax
+80107d26:	09 f8                	or     %edi,%eax
+  asm volatile("cld; rep stosl" :
+80107d28:	89 d7                	mov    %edx,%edi
+80107d2a:	fc                   	cld
+80107d2b:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+80107d2d:	eb 05                	jmp    80107d34 <memset+0x3d>
+  asm volatile("cld; rep stosb" :
+80107d2f:	89 d7                	mov    %edx,%edi
+80107d31:	fc                   	cld
+80107d32:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107d34:	89 d0                	mov    %edx,%eax
+80107d36:	5b                   	pop    %ebx
+80107d37:	5f                   	pop    %edi
+80107d38:	5d                   	pop    %ebp
+80107d39:	c3                   	ret
+
+80107d3a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107d3a:	55                   	push   %ebp
+80107d3b:	89 e5                	mov    %esp,%ebp
+80107d3d:	56                   	push   %esi
+80107d3e:	53                   	push   %ebx
+80107d3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107d42:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107d45:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107d48:	eb 08                	jmp    80107d52 <memcmp+0x18>
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107d4a:	83 c1 01             	add    $0x1,%ecx
+80107d4d:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107d50:	89 f0                	mov    %esi,%eax
+80107d52:	8d 70 ff             	lea    -0x1(%eax),%esi
+80107d55:	85 c0                	test   %eax,%eax
+80107d57:	74 12                	je     80107d6b <memcmp+0x31>
+    if(*s1 != *s2)
+80107d59:	0f b6 01             	movzbl (%ecx),%eax
+80107d5c:	0f b6 1a             	movzbl (%edx),%ebx
+80107d5f:	38 d8                	cmp    %bl,%al
+80107d61:	74 e7                	je     80107d4a <memcmp+0x10>
+      return *s1 - *s2;
+80107d63:	0f b6 c0             	movzbl %al,%eax
+80107d66:	0f b6 db             	movzbl %bl,%ebx
+80107d69:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107d6b:	5b                   	pop    %ebx
+80107d6c:	5e                   	pop    %esi
+80107d6d:	5d                   	pop    %ebp
+80107d6e:	c3                   	ret
+
+80107d6f <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107d6f:	55                   	push   %ebp
+80107d70:	89 e5                	mov    %esp,%ebp
+80107d72:	56                   	push   %esi
+80107d73:	53                   	push   %ebx
+80107d74:	8b 75 08             	mov    0x8(%ebp),%esi
+80107d77:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107d7a:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80107d7d:	39 f2                	cmp    %esi,%edx
+80107d7f:	73 3c                	jae    80107dbd <memmove+0x4e>
+80107d81:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+80107d84:	39 ce                	cmp    %ecx,%esi
+80107d86:	73 39                	jae    80107dc1 <memmove+0x52>
+    s += n;
+    d += n;
+80107d88:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    while(n-- > 0)
+80107d8b:	eb 0d                	jmp    80107d9a <memmove+0x2b>
+      *--d = *--s;
+80107d8d:	83 e9 01             	sub    $0x1,%ecx
+80107d90:	83 ea 01             	sub    $0x1,%edx
+80107d93:	0f b6 01             	movzbl (%ecx),%eax
+80107d96:	88 02                	mov    %al,(%edx)
+    while(n-- > 0)
+80107d98:	89 d8                	mov    %ebx,%eax
+80107d9a:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107d9d:	85 c0                	test   %eax,%eax
+80107d9f:	75 ec                	jne    80107d8d <memmove+0x1e>
+80107da1:	eb 14                	jmp    80107db7 <memmove+0x48>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+80107da3:	0f b6 02             	movzbl (%edx),%eax
+80107da6:	88 01                	mov    %al,(%ecx)
+80107da8:	8d 49 01             	lea    0x1(%ecx),%ecx
+80107dab:	8d 52 01             	lea    0x1(%edx),%edx
+    while(n-- > 0)
+80107dae:	89 d8                	mov    %ebx,%eax
+80107db0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107db3:	85 c0                	test   %eax,%eax
+80107db5:	75 ec                	jne    80107da3 <memmove+0x34>
+
+  return dst;
+}
+80107db7:	89 f0                	mov    %esi,%eax
+80107db9:	5b                   	pop    %ebx
+80107dba:	5e                   	pop    %esi
+80107dbb:	5d                   	pop    %ebp
+80107dbc:	c3                   	ret
+80107dbd:	89 f1                	mov    %esi,%ecx
+80107dbf:	eb ef                	jmp    80107db0 <memmove+0x41>
+80107dc1:	89 f1                	mov    %esi,%ecx
+80107dc3:	eb eb                	jmp    80107db0 <memmove+0x41>
+
+80107dc5 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+80107dc5:	55                   	push   %ebp
+80107dc6:	89 e5                	mov    %esp,%ebp
+80107dc8:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+80107dcb:	ff 75 10             	push   0x10(%ebp)
+80107dce:	ff 75 0c             	push   0xc(%ebp)
+80107dd1:	ff 75 08             	push   0x8(%ebp)
+80107dd4:	e8 96 ff ff ff       	call   80107d6f <memmove>
+}
+80107dd9:	c9                   	leave
+80107dda:	c3                   	ret
+
+80107ddb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107ddb:	55                   	push   %ebp
+80107ddc:	89 e5                	mov    %esp,%ebp
+80107dde:	53                   	push   %ebx
+80107ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+80107de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107de5:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+80107de8:	eb 09                	jmp    80107df3 <strncmp+0x18>
+    n--, p++, q++;
+80107dea:	83 e8 01             	sub    $0x1,%eax
+80107ded:	83 c2 01             	add    $0x1,%edx
+80107df0:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107df3:	85 c0                	test   %eax,%eax
+80107df5:	74 0b                	je     80107e02 <strncmp+0x27>
+80107df7:	0f b6 1a             	movzbl (%edx),%ebx
+80107dfa:	84 db                	test   %bl,%bl
+80107dfc:	74 04                	je     80107e02 <strncmp+0x27>
+80107dfe:	3a 19                	cmp    (%ecx),%bl
+80107e00:	74 e8                	je     80107dea <strncmp+0xf>
+  if(n == 0)
+80107e02:	85 c0                	test   %eax,%eax
+80107e04:	74 0d                	je     80107e13 <strncmp+0x38>
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80107e06:	0f b6 02             	movzbl (%edx),%eax
+80107e09:	0f b6 11             	movzbl (%ecx),%edx
+80107e0c:	29 d0                	sub    %edx,%eax
+}
+80107e0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107e11:	c9                   	leave
+80107e12:	c3                   	ret
+    return 0;
+80107e13:	b8 00 00 00 00       	mov    $0x0,%eax
+80107e18:	eb f4                	jmp    80107e0e <strncmp+0x33>
+
+80107e1a <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107e1a:	55                   	push   %ebp
+80107e1b:	89 e5                	mov    %esp,%ebp
+80107e1d:	57                   	push   %edi
+80107e1e:	56                   	push   %esi
+80107e1f:	53                   	push   %ebx
+80107e20:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107e26:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80107e29:	89 fa                	mov    %edi,%edx
+80107e2b:	eb 04                	jmp    80107e31 <strncpy+0x17>
+80107e2d:	89 f1                	mov    %esi,%ecx
+80107e2f:	89 da                	mov    %ebx,%edx
+80107e31:	89 c3                	mov    %eax,%ebx
+80107e33:	83 e8 01             	sub    $0x1,%eax
+80107e36:	85 db                	test   %ebx,%ebx
+80107e38:	7e 11                	jle    80107e4b <strncpy+0x31>
+80107e3a:	8d 71 01             	lea    0x1(%ecx),%esi
+80107e3d:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107e40:	0f b6 09             	movzbl (%ecx),%ecx
+80107e43:	88 0a                	mov    %cl,(%edx)
+80107e45:	84 c9                	test   %cl,%cl
+80107e47:	75 e4                	jne    80107e2d <strncpy+0x13>
+80107e49:	89 da                	mov    %ebx,%edx
+    ;
+  while(n-- > 0)
+80107e4b:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80107e4e:	85 c0                	test   %eax,%eax
+80107e50:	7e 0a                	jle    80107e5c <strncpy+0x42>
+    *s++ = 0;
+80107e52:	c6 02 00             	movb   $0x0,(%edx)
+  while(n-- > 0)
+80107e55:	89 c8                	mov    %ecx,%eax
+    *s++ = 0;
+80107e57:	8d 52 01             	lea    0x1(%edx),%edx
+80107e5a:	eb ef                	jmp    80107e4b <strncpy+0x31>
+  return os;
+}
+80107e5c:	89 f8                	mov    %edi,%eax
+80107e5e:	5b                   	pop    %ebx
+80107e5f:	5e                   	pop    %esi
+80107e60:	5f                   	pop    %edi
+80107e61:	5d                   	pop    %ebp
+80107e62:	c3                   	ret
+
+80107e63 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107e63:	55                   	push   %ebp
+80107e64:	89 e5                	mov    %esp,%ebp
+80107e66:	57                   	push   %edi
+80107e67:	56                   	push   %esi
+80107e68:	53                   	push   %ebx
+80107e69:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107e6f:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80107e72:	85 c0                	test   %eax,%eax
+80107e74:	7e 23                	jle    80107e99 <safestrcpy+0x36>
+80107e76:	89 fa                	mov    %edi,%edx
+80107e78:	eb 04                	jmp    80107e7e <safestrcpy+0x1b>
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107e7a:	89 f1                	mov    %esi,%ecx
+80107e7c:	89 da                	mov    %ebx,%edx
+80107e7e:	83 e8 01             	sub    $0x1,%eax
+80107e81:	85 c0                	test   %eax,%eax
+80107e83:	7e 11                	jle    80107e96 <safestrcpy+0x33>
+80107e85:	8d 71 01             	lea    0x1(%ecx),%esi
+80107e88:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107e8b:	0f b6 09             	movzbl (%ecx),%ecx
+80107e8e:	88 0a                	mov    %cl,(%edx)
+80107e90:	84 c9                	test   %cl,%cl
+80107e92:	75 e6                	jne    80107e7a <safestrcpy+0x17>
+80107e94:	89 da                	mov    %ebx,%edx
+    ;
+  *s = 0;
+80107e96:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107e99:	89 f8                	mov    %edi,%eax
+80107e9b:	5b                   	pop    %ebx
+80107e9c:	5e                   	pop    %esi
+80107e9d:	5f                   	pop    %edi
+80107e9e:	5d                   	pop    %ebp
+80107e9f:	c3                   	ret
+
+80107ea0 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107ea0:	55                   	push   %ebp
+80107ea1:	89 e5                	mov    %esp,%ebp
+80107ea3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+80107eab:	eb 03                	jmp    80107eb0 <strlen+0x10>
+80107ead:	83 c0 01             	add    $0x1,%eax
+80107eb0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107eb4:	75 f7                	jne    80107ead <strlen+0xd>
+    ;
+  return n;
+}
+80107eb6:	5d                   	pop    %ebp
+80107eb7:	c3                   	ret
+
+80107eb8 <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107eb8:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80107ebc:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80107ec0:	55                   	push   %ebp
+  pushl %ebx
+80107ec1:	53                   	push   %ebx
+  pushl %esi
+80107ec2:	56                   	push   %esi
+  pushl %edi
+80107ec3:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107ec4:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107ec6:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80107ec8:	5f                   	pop    %edi
+  popl %esi
+80107ec9:	5e                   	pop    %esi
+  popl %ebx
+80107eca:	5b                   	pop    %ebx
+  popl %ebp
+80107ecb:	5d                   	pop    %ebp
+  ret
+80107ecc:	c3                   	ret
+
+80107ecd <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80107ecd:	55                   	push   %ebp
+80107ece:	89 e5                	mov    %esp,%ebp
+80107ed0:	53                   	push   %ebx
+80107ed1:	83 ec 04             	sub    $0x4,%esp
+80107ed4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80107ed7:	e8 fc da ff ff       	call   801059d8 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107edc:	8b 00                	mov    (%eax),%eax
+80107ede:	39 c3                	cmp    %eax,%ebx
+80107ee0:	73 18                	jae    80107efa <fetchint+0x2d>
+80107ee2:	8d 53 04             	lea    0x4(%ebx),%edx
+80107ee5:	39 d0                	cmp    %edx,%eax
+80107ee7:	72 18                	jb     80107f01 <fetchint+0x34>
+    return -1;
+  *ip = *(int*)(addr);
+80107ee9:	8b 13                	mov    (%ebx),%edx
+80107eeb:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107eee:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107ef5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ef8:	c9                   	leave
+80107ef9:	c3                   	ret
+    return -1;
+80107efa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107eff:	eb f4                	jmp    80107ef5 <fetchint+0x28>
+80107f01:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107f06:	eb ed                	jmp    80107ef5 <fetchint+0x28>
+
+80107f08 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107f08:	55                   	push   %ebp
+80107f09:	89 e5                	mov    %esp,%ebp
+80107f0b:	53                   	push   %ebx
+80107f0c:	83 ec 04             	sub    $0x4,%esp
+80107f0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+80107f12:	e8 c1 da ff ff       	call   801059d8 <myproc>
+
+  if(addr >= curproc->sz)
+80107f17:	3b 18                	cmp    (%eax),%ebx
+80107f19:	73 25                	jae    80107f40 <fetchstr+0x38>
+    return -1;
+  *pp = (char*)addr;
+80107f1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107f1e:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+80107f20:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+80107f22:	89 d8                	mov    %ebx,%eax
+80107f24:	eb 03                	jmp    80107f29 <fetchstr+0x21>
+80107f26:	83 c0 01             	add    $0x1,%eax
+80107f29:	39 d0                	cmp    %edx,%eax
+80107f2b:	73 09                	jae    80107f36 <fetchstr+0x2e>
+    if(*s == 0)
+80107f2d:	80 38 00             	cmpb   $0x0,(%eax)
+80107f30:	75 f4                	jne    80107f26 <fetchstr+0x1e>
+      return s - *pp;
+80107f32:	29 d8                	sub    %ebx,%eax
+80107f34:	eb 05                	jmp    80107f3b <fetchstr+0x33>
+  }
+  return -1;
+80107f36:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107f3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f3e:	c9                   	leave
+80107f3f:	c3                   	ret
+    return -1;
+80107f40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107f45:	eb f4                	jmp    80107f3b <fetchstr+0x33>
+
+80107f47 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80107f47:	55                   	push   %ebp
+80107f48:	89 e5                	mov    %esp,%ebp
+80107f4a:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f4d:	e8 86 da ff ff       	call   801059d8 <myproc>
+80107f52:	8b 50 18             	mov    0x18(%eax),%edx
+80107f55:	8b 45 08             	mov    0x8(%ebp),%eax
+80107f58:	c1 e0 02             	shl    $0x2,%eax
+80107f5b:	03 42 44             	add    0x44(%edx),%eax
+80107f5e:	83 ec 08             	sub    $0x8,%esp
+80107f61:	ff 75 0c             	push   0xc(%ebp)
+80107f64:	83 c0 04             	add    $0x4,%eax
+80107f67:	50                   	push   %eax
+80107f68:	e8 60 ff ff ff       	call   80107ecd <fetchint>
+}
+80107f6d:	c9                   	leave
+80107f6e:	c3                   	ret
+
+80107f6f <argbuf>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+static int
+argbuf(int n, char **pp, int size, int write)
+{
+80107f6f:	55                   	push   %ebp
+80107f70:	89 e5                	mov    %esp,%ebp
+80107f72:	57                   	push   %edi
+80107f73:	56                   	push   %esi
+80107f74:	53                   	push   %ebx
+80107f75:	83 ec 2c             	sub    $0x2c,%esp
+80107f78:	89 c7                	mov    %eax,%edi
+80107f7a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107f7d:	89 cb                	mov    %ecx,%ebx
+  int i;
+  struct proc *curproc = myproc();
+80107f7f:	e8 54 da ff ff       	call   801059d8 <myproc>
+80107f84:	89 c6                	mov    %eax,%esi
+ 
+  if(argint(n, &i) < 0)
+80107f86:	83 ec 08             	sub    $0x8,%esp
+80107f89:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107f8c:	50                   	push   %eax
+80107f8d:	57                   	push   %edi
+80107f8e:	e8 b4 ff ff ff       	call   80107f47 <argint>
+80107f93:	83 c4 10             	add    $0x10,%esp
+80107f96:	85 c0                	test   %eax,%eax
+80107f98:	78 3b                	js     80107fd5 <argbuf+0x66>
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107f9a:	85 db                	test   %ebx,%ebx
+80107f9c:	78 3e                	js     80107fdc <argbuf+0x6d>
+80107f9e:	8b 16                	mov    (%esi),%edx
+80107fa0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107fa3:	39 d0                	cmp    %edx,%eax
+80107fa5:	73 3c                	jae    80107fe3 <argbuf+0x74>
+80107fa7:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80107faa:	39 ca                	cmp    %ecx,%edx
+80107fac:	72 3c                	jb     80107fea <argbuf+0x7b>
+    return -1;
+  if(prefault(curproc, i, size, write) < 0)
+80107fae:	ff 75 08             	push   0x8(%ebp)
+80107fb1:	53                   	push   %ebx
+80107fb2:	50                   	push   %eax
+80107fb3:	56                   	push   %esi
+80107fb4:	e8 eb 2b 00 00       	call   8010aba4 <prefault>
+80107fb9:	83 c4 10             	add    $0x10,%esp
+80107fbc:	85 c0                	test   %eax,%eax
+80107fbe:	78 31                	js     80107ff1 <argbuf+0x82>
+    return -1;
+  *pp = (char*)i;
+80107fc0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107fc3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107fc6:	89 07                	mov    %eax,(%edi)
+  return 0;
+80107fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107fd0:	5b                   	pop    %ebx
+80107fd1:	5e                   	pop    %esi
+80107fd2:	5f                   	pop    %edi
+80107fd3:	5d                   	pop    %ebp
+80107fd4:	c3                   	ret
+    return -1;
+80107fd5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fda:	eb f1                	jmp    80107fcd <argbuf+0x5e>
+    return -1;
+80107fdc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fe1:	eb ea                	jmp    80107fcd <argbuf+0x5e>
+80107fe3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fe8:	eb e3                	jmp    80107fcd <argbuf+0x5e>
+80107fea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fef:	eb dc                	jmp    80107fcd <argbuf+0x5e>
+    return -1;
+80107ff1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ff6:	eb d5                	jmp    80107fcd <argbuf+0x5e>
+
+80107ff8 <argptr>:
+
+int
+argptr(int n, char **pp, int size)
+{
+80107ff8:	55                   	push   %ebp
+80107ff9:	89 e5                	mov    %esp,%ebp
+80107ffb:	83 ec 14             	sub    $0x14,%esp
+  return argbuf(n, pp, size, 0);
+80107ffe:	6a 00                	push   $0x0
+80108000:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80108003:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108006:	8b 45 08             	mov    0x8(%ebp),%eax
+80108009:	e8 61 ff ff ff       	call   80107f6f <argbuf>
+}
+8010800e:	c9                   	leave
+8010800f:	c3                   	ret
+
+80108010 <argwptr>:
+
+// Like argptr, for a block of memory the kernel will write:
+// also check that the process may write it.
+int
+argwptr(int n, char **pp, int size)
+{
+80108010:	55                   	push   %ebp
+80108011:	89 e5                	mov    %esp,%ebp
+80108013:	83 ec 14             	sub    $0x14,%esp
+  return argbuf(n, pp, size, 1);
+80108016:	6a 01                	push   $0x1
+80108018:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010801b:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010801e:	8b 45 08             	mov    0x8(%ebp),%eax
+80108021:	e8 49 ff ff ff       	call   80107f6f <argbuf>
+}
+80108026:	c9                   	leave
+80108027:	c3                   	ret
+
+80108028 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80108028:	55                   	push   %ebp
+80108029:	89 e5                	mov    %esp,%ebp
+8010802b:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+8010802e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108031:	50                   	push   %eax
+80108032:	ff 75 08             	push   0x8(%ebp)
+80108035:	e8 0d ff ff ff       	call   80107f47 <argint>
+8010803a:	83 c4 10             	add    $0x10,%esp
+8010803d:	85 c0                	test   %eax,%eax
+8010803f:	78 13                	js     80108054 <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+80108041:	83 ec 08             	sub    $0x8,%esp
+80108044:	ff 75 0c             	push   0xc(%ebp)
+80108047:	ff 75 f4             	push   -0xc(%ebp)
+8010804a:	e8 b9 fe ff ff       	call   80107f08 <fetchstr>
+8010804f:	83 c4 10             	add    $0x10,%esp
+}
+80108052:	c9                   	leave
+80108053:	c3                   	ret
+    return -1;
+80108054:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108059:	eb f7                	jmp    80108052 <argstr+0x2a>
+
+8010805b <syscall>:
+[SYS_bstat]   sys_bstat,
+};
+
+void
+syscall(void)
+{
+8010805b:	55                   	push   %ebp
+8010805c:	89 e5                	mov    %esp,%ebp
+8010805e:	53                   	push   %ebx
+8010805f:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80108062:	e8 71 d9 ff ff       	call   801059d8 <myproc>
+80108067:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80108069:	8b 40 18             	mov    0x18(%eax),%eax
+8010806c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+8010806f:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108072:	83 fa 1b             	cmp    $0x1b,%edx
+80108075:	77 17                	ja     8010808e <syscall+0x33>
+80108077:	8b 14 85 a0 bd 10 80 	mov    -0x7fef4260(,%eax,4),%edx
+8010807e:	85 d2                	test   %edx,%edx
+80108080:	74 0c                	je     8010808e <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80108082:	ff d2                	call   *%edx
+80108084:	89 c2                	mov    %eax,%edx
+80108086:	8b 43 18             	mov    0x18(%ebx),%eax
+80108089:	89 50 1c             	mov    %edx,0x1c(%eax)
+8010808c:	eb 1f                	jmp    801080ad <syscall+0x52>
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+8010808e:	8d 53 6c             	lea    0x6c(%ebx),%edx
+    cprintf("%d %s: unknown sys call %d\n",
+80108091:	50                   	push   %eax
+80108092:	52                   	push   %edx
+80108093:	ff 73 10             	push   0x10(%ebx)
+80108096:	68 81 bd 10 80       	push   $0x8010bd81
+8010809b:	e8 59 8c ff ff       	call   80100cf9 <cprintf>
+    curproc->tf->eax = -1;
+801080a0:	8b 43 18             	mov    0x18(%ebx),%eax
+801080a3:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+801080aa:	83 c4 10             	add    $0x10,%esp
+  }
+}
+801080ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801080b0:	c9                   	leave
+801080b1:	c3                   	ret
+
+801080b2 <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+801080b2:	55                   	push   %ebp
+801080b3:	89 e5                	mov    %esp,%ebp
+801080b5:	56                   	push   %esi
+801080b6:	53                   	push   %ebx
+801080b7:	83 ec 18             	sub    $0x18,%esp
+801080ba:	89 d6                	mov    %edx,%esi
+801080bc:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+801080be:	8d 55 f4             	lea    -0xc(%ebp),%edx
+801080c1:	52                   	push   %edx
+801080c2:	50                   	push   %eax
+801080c3:	e8 7f fe ff ff       	call   80107f47 <argint>
+801080c8:	83 c4 10             	add    $0x10,%esp
+801080cb:	85 c0                	test   %eax,%eax
+801080cd:	78 35                	js     80108104 <argfd+0x52>
+    return -1;
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801080cf:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801080d3:	77 28                	ja     801080fd <argfd+0x4b>
+801080d5:	e8 fe d8 ff ff       	call   801059d8 <myproc>
+801080da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801080dd:	8b 44 90 28          	mov    0x28(%eax,%edx,4),%eax
+801080e1:	85 c0                	test   %eax,%eax
+801080e3:	74 18                	je     801080fd <argfd+0x4b>
+    return -1;
+  if(pfd)
+801080e5:	85 f6                	test   %esi,%esi
+801080e7:	74 02                	je     801080eb <argfd+0x39>
+    *pfd = fd;
+801080e9:	89 16                	mov    %edx,(%esi)
+  if(pf)
+801080eb:	85 db                	test   %ebx,%ebx
+801080ed:	74 1c                	je     8010810b <argfd+0x59>
+    *pf = f;
+801080ef:	89 03                	mov    %eax,(%ebx)
+  return 0;
+801080f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801080f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801080f9:	5b                   	pop    %ebx
+801080fa:	5e                   	pop    %esi
+801080fb:	5d                   	pop    %ebp
+801080fc:	c3                   	ret
+    return -1;
+801080fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108102:	eb f2                	jmp    801080f6 <argfd+0x44>
+    return -1;
+80108104:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108109:	eb eb                	jmp    801080f6 <argfd+0x44>
+  return 0;
+8010810b:	b8 00 00 00 00       	mov    $0x0,%eax
+80108110:	eb e4                	jmp    801080f6 <argfd+0x44>
+
+80108112 <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80108112:	55                   	push   %ebp
+80108113:	89 e5                	mov    %esp,%ebp
+80108115:	53                   	push   %ebx
+80108116:	83 ec 04             	sub    $0x4,%esp
+80108119:	89 c3                	mov    %eax,%ebx
+  int fd;
+  struct proc *curproc = myproc();
+8010811b:	e8 b8 d8 ff ff       	call   801059d8 <myproc>
+80108120:	89 c2                	mov    %eax,%edx
+
+  for(fd = 0; fd < NOFILE; fd++){
+80108122:	b8 00 00 00 00       	mov    $0x0,%eax
+80108127:	83 f8 0f             	cmp    $0xf,%eax
+8010812a:	7f 12                	jg     8010813e <fdalloc+0x2c>
+    if(curproc->ofile[fd] == 0){
+8010812c:	83 7c 82 28 00       	cmpl   $0x0,0x28(%edx,%eax,4)
+80108131:	74 05                	je     80108138 <fdalloc+0x26>
+  for(fd = 0; fd < NOFILE; fd++){
+80108133:	83 c0 01             	add    $0x1,%eax
+80108136:	eb ef                	jmp    80108127 <fdalloc+0x15>
+      curproc->ofile[fd] = f;
+80108138:	89 5c 82 28          	mov    %ebx,0x28(%edx,%eax,4)
+      return fd;
+8010813c:	eb 05                	jmp    80108143 <fdalloc+0x31>
+    }
+  }
+  return -1;
+8010813e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108143:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108146:	c9                   	leave
+80108147:	c3                   	ret
+
+80108148 <isdirempty>:
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+80108148:	55                   	push   %ebp
+80108149:	89 e5                	mov    %esp,%ebp
+8010814b:	56                   	push   %esi
+8010814c:	53                   	push   %ebx
+8010814d:	83 ec 10             	sub    $0x10,%esp
+80108150:	89 c3                	mov    %eax,%ebx
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108152:	b8 20 00 00 00       	mov    $0x20,%eax
+80108157:	89 c6                	mov    %eax,%esi
+80108159:	3b 83 80 00 00 00    	cmp    0x80(%ebx),%eax
+8010815f:	73 2e                	jae    8010818f <isdirempty+0x47>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108161:	6a 10                	push   $0x10
+80108163:	50                   	push   %eax
+80108164:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80108167:	50                   	push   %eax
+80108168:	53                   	push   %ebx
+80108169:	e8 f3 a2 ff ff       	call   80102461 <readi>
+8010816e:	83 c4 10             	add    $0x10,%esp
+80108171:	83 f8 10             	cmp    $0x10,%eax
+80108174:	75 0c                	jne    80108182 <isdirempty+0x3a>
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+80108176:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+8010817b:	75 1e                	jne    8010819b <isdirempty+0x53>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+8010817d:	8d 46 10             	lea    0x10(%esi),%eax
+80108180:	eb d5                	jmp    80108157 <isdirempty+0xf>
+      panic("isdirempty: readi");
+80108182:	83 ec 0c             	sub    $0xc,%esp
+80108185:	68 14 be 10 80       	push   $0x8010be14
+8010818a:	e8 73 87 ff ff       	call   80100902 <panic>
+      return 0;
+  }
+  return 1;
+8010818f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80108194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108197:	5b                   	pop    %ebx
+80108198:	5e                   	pop    %esi
+80108199:	5d                   	pop    %ebp
+8010819a:	c3                   	ret
+      return 0;
+8010819b:	b8 00 00 00 00       	mov    $0x0,%eax
+801081a0:	eb f2                	jmp    80108194 <isdirempty+0x4c>
+
+801081a2 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801081a2:	55                   	push   %ebp
+801081a3:	89 e5                	mov    %esp,%ebp
+801081a5:	57                   	push   %edi
+801081a6:	56                   	push   %esi
+801081a7:	53                   	push   %ebx
+801081a8:	83 ec 34             	sub    $0x34,%esp
+801081ab:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801081ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801081b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801081b4:	8d 55 da             	lea    -0x26(%ebp),%edx
+801081b7:	52                   	push   %edx
+801081b8:	50                   	push   %eax
+801081b9:	e8 5d a7 ff ff       	call   8010291b <nameiparent>
+801081be:	89 c6                	mov    %eax,%esi
+801081c0:	83 c4 10             	add    $0x10,%esp
+801081c3:	85 c0                	test   %eax,%eax
+801081c5:	0f 84 33 01 00 00    	je     801082fe <create+0x15c>
+    return 0;
+  ilock(dp);
+801081cb:	83 ec 0c             	sub    $0xc,%esp
+801081ce:	50                   	push   %eax
+801081cf:	e8 e9 9f ff ff       	call   801021bd <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801081d4:	83 c4 0c             	add    $0xc,%esp
+801081d7:	6a 00                	push   $0x0
+801081d9:	8d 45 da             	lea    -0x26(%ebp),%eax
+801081dc:	50                   	push   %eax
+801081dd:	56                   	push   %esi
+801081de:	e8 ec a4 ff ff       	call   801026cf <dirlookup>
+801081e3:	89 c3                	mov    %eax,%ebx
+801081e5:	83 c4 10             	add    $0x10,%esp
+801081e8:	85 c0                	test   %eax,%eax
+801081ea:	74 3d                	je     80108229 <create+0x87>
+    iunlockput(dp);
+801081ec:	83 ec 0c             	sub    $0xc,%esp
+801081ef:	56                   	push   %esi
+801081f0:	e8 1e a2 ff ff       	call   80102413 <iunlockput>
+    ilock(ip);
+801081f5:	89 1c 24             	mov    %ebx,(%esp)
+801081f8:	e8 c0 9f ff ff       	call   801021bd <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+801081fd:	83 c4 10             	add    $0x10,%esp
+80108200:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+80108205:	75 07                	jne    8010820e <create+0x6c>
+80108207:	66 83 7b 78 02       	cmpw   $0x2,0x78(%ebx)
+8010820c:	74 11                	je     8010821f <create+0x7d>
+      return ip;
+    iunlockput(ip);
+8010820e:	83 ec 0c             	sub    $0xc,%esp
+80108211:	53                   	push   %ebx
+80108212:	e8 fc a1 ff ff       	call   80102413 <iunlockput>
+    return 0;
+80108217:	83 c4 10             	add    $0x10,%esp
+8010821a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+8010821f:	89 d8                	mov    %ebx,%eax
+80108221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108224:	5b                   	pop    %ebx
+80108225:	5e                   	pop    %esi
+80108226:	5f                   	pop    %edi
+80108227:	5d                   	pop    %ebp
+80108228:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108229:	83 ec 08             	sub    $0x8,%esp
+8010822c:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80108230:	50                   	push   %eax
+80108231:	ff 36                	push   (%esi)
+80108233:	e8 6b 9c ff ff       	call   80101ea3 <ialloc>
+80108238:	89 c3                	mov    %eax,%ebx
+8010823a:	83 c4 10             	add    $0x10,%esp
+8010823d:	85 c0                	test   %eax,%eax
+8010823f:	74 52                	je     80108293 <create+0xf1>
+  ilock(ip);
+80108241:	83 ec 0c             	sub    $0xc,%esp
+80108244:	50                   	push   %eax
+80108245:	e8 73 9f ff ff       	call   801021bd <ilock>
+  ip->major = major;
+8010824a:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+8010824e:	66 89 43 7a          	mov    %ax,0x7a(%ebx)
+  ip->minor = minor;
+80108252:	66 89 7b 7c          	mov    %di,0x7c(%ebx)
+  ip->nlink = 1;
+80108256:	66 c7 43 7e 01 00    	movw   $0x1,0x7e(%ebx)
+  iupdate(ip);
+8010825c:	89 1c 24             	mov    %ebx,(%esp)
+8010825f:	e8 e4 9c ff ff       	call   80101f48 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108264:	83 c4 10             	add    $0x10,%esp
+80108267:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+8010826c:	74 32                	je     801082a0 <create+0xfe>
+  if(dirlink(dp, name, ip->inum) < 0)
+8010826e:	83 ec 04             	sub    $0x4,%esp
+80108271:	ff 73 04             	push   0x4(%ebx)
+80108274:	8d 45 da             	lea    -0x26(%ebp),%eax
+80108277:	50                   	push   %eax
+80108278:	56                   	push   %esi
+80108279:	e8 d1 a5 ff ff       	call   8010284f <dirlink>
+8010827e:	83 c4 10             	add    $0x10,%esp
+80108281:	85 c0                	test   %eax,%eax
+80108283:	78 6c                	js     801082f1 <create+0x14f>
+  iunlockput(dp);
+80108285:	83 ec 0c             	sub    $0xc,%esp
+80108288:	56                   	push   %esi
+80108289:	e8 85 a1 ff ff       	call   80102413 <iunlockput>
+  return ip;
+8010828e:	83 c4 10             	add    $0x10,%esp
+80108291:	eb 8c                	jmp    8010821f <create+0x7d>
+    panic("create: ialloc");
+80108293:	83 ec 0c             	sub    $0xc,%esp
+80108296:	68 26 be 10 80       	push   $0x8010be26
+8010829b:	e8 62 86 ff ff       	call   80100902 <panic>
+    dp->nlink++;  // for ".."
+801082a0:	0f b7 46 7e          	movzwl 0x7e(%esi),%eax
+801082a4:	83 c0 01             	add    $0x1,%eax
+801082a7:	66 89 46 7e          	mov    %ax,0x7e(%esi)
+    iupdate(dp);
+801082ab:	83 ec 0c             	sub    $0xc,%esp
+801082ae:	56                   	push   %esi
+801082af:	e8 94 9c ff ff       	call   80101f48 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+801082b4:	83 c4 0c             	add    $0xc,%esp
+801082b7:	ff 73 04             	push   0x4(%ebx)
+801082ba:	68 36 be 10 80       	push   $0x8010be36
+801082bf:	53                   	push   %ebx
+801082c0:	e8 8a a5 ff ff       	call   8010284f <dirlink>
+801082c5:	83 c4 10             	add    $0x10,%esp
+801082c8:	85 c0                	test   %eax,%eax
+801082ca:	78 18                	js     801082e4 <create+0x142>
+801082cc:	83 ec 04             	sub    $0x4,%esp
+801082cf:	ff 76 04             	push   0x4(%esi)
+801082d2:	68 35 be 10 80       	push   $0x8010be35
+801082d7:	53                   	push   %ebx
+801082d8:	e8 72 a5 ff ff       	call   8010284f <dirlink>
+801082dd:	83 c4 10             	add    $0x10,%esp
+801082e0:	85 c0                	test   %eax,%eax
+801082e2:	79 8a                	jns    8010826e <create+0xcc>
+      panic("create dots");
+801082e4:	83 ec 0c             	sub    $0xc,%esp
+801082e7:	68 38 be 10 80       	push   $0x8010be38
+801082ec:	e8 11 86 ff ff       	call   80100902 <panic>
+    panic("create: dirlink");
+801082f1:	83 ec 0c             	sub    $0xc,%esp
+801082f4:	68 44 be 10 80       	push   $0x8010be44
+801082f9:	e8 04 86 ff ff       	call   80100902 <panic>
+    return 0;
+801082fe:	89 c3                	mov    %eax,%ebx
+80108300:	e9 1a ff ff ff       	jmp    8010821f <create+0x7d>
+
+80108305 <argargv>:
+
+// Fetch the nth word-sized system call argument as a
+// user argv array, with the strings left in user memory.
+static int
+argargv(int n, char **argv)
+{
+80108305:	55                   	push   %ebp
+80108306:	89 e5                	mov    %esp,%ebp
+80108308:	56                   	push   %esi
+80108309:	53                   	push   %ebx
+8010830a:	83 ec 18             	sub    $0x18,%esp
+8010830d:	89 d6                	mov    %edx,%esi
+  int i;
+  uint uargv, uarg;
+
+  if(argint(n, (int*)&uargv) < 0)
+8010830f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108312:	52                   	push   %edx
+80108313:	50                   	push   %eax
+80108314:	e8 2e fc ff ff       	call   80107f47 <argint>
+80108319:	83 c4 10             	add    $0x10,%esp
+8010831c:	85 c0                	test   %eax,%eax
+8010831e:	78 60                	js     80108380 <argargv+0x7b>
+    return -1;
+  memset(argv, 0, sizeof(char*)*MAXARG);
+80108320:	83 ec 04             	sub    $0x4,%esp
+80108323:	68 80 00 00 00       	push   $0x80
+80108328:	6a 00                	push   $0x0
+8010832a:	56                   	push   %esi
+8010832b:	e8 c7 f9 ff ff       	call   80107cf7 <memset>
+80108330:	83 c4 10             	add    $0x10,%esp
+  for(i=0;; i++){
+80108333:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(i >= MAXARG)
+80108338:	83 fb 1f             	cmp    $0x1f,%ebx
+8010833b:	7f 4a                	jg     80108387 <argargv+0x82>
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+8010833d:	83 ec 08             	sub    $0x8,%esp
+80108340:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108343:	50                   	push   %eax
+80108344:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108347:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+8010834a:	50                   	push   %eax
+8010834b:	e8 7d fb ff ff       	call   80107ecd <fetchint>
+80108350:	83 c4 10             	add    $0x10,%esp
+80108353:	85 c0                	test   %eax,%eax
+80108355:	78 3c                	js     80108393 <argargv+0x8e>
+      return -1;
+    if(uarg == 0){
+80108357:	8b 45 f0             	mov    -0x10(%ebp),%eax
+8010835a:	85 c0                	test   %eax,%eax
+8010835c:	74 19                	je     80108377 <argargv+0x72>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+8010835e:	83 ec 08             	sub    $0x8,%esp
+80108361:	8d 14 9e             	lea    (%esi,%ebx,4),%edx
+80108364:	52                   	push   %edx
+80108365:	50                   	push   %eax
+80108366:	e8 9d fb ff ff       	call   80107f08 <fetchstr>
+8010836b:	83 c4 10             	add    $0x10,%esp
+8010836e:	85 c0                	test   %eax,%eax
+80108370:	78 28                	js     8010839a <argargv+0x95>
+  for(i=0;; i++){
+80108372:	83 c3 01             	add    $0x1,%ebx
+    if(i >= MAXARG)
+80108375:	eb c1                	jmp    80108338 <argargv+0x33>
+      argv[i] = 0;
+80108377:	c7 04 9e 00 00 00 00 	movl   $0x0,(%esi,%ebx,4)
+      return -1;
+  }
+  return 0;
+8010837e:	eb 0c                	jmp    8010838c <argargv+0x87>
+    return -1;
+80108380:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108385:	eb 05                	jmp    8010838c <argargv+0x87>
+      return -1;
+80108387:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010838c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010838f:	5b                   	pop    %ebx
+80108390:	5e                   	pop    %esi
+80108391:	5d                   	pop    %ebp
+80108392:	c3                   	ret
+      return -1;
+80108393:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108398:	eb f2                	jmp    8010838c <argargv+0x87>
+      return -1;
+8010839a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010839f:	eb eb                	jmp    8010838c <argargv+0x87>
+
+801083a1 <sys_dup>:
+{
+801083a1:	55                   	push   %ebp
+801083a2:	89 e5                	mov    %esp,%ebp
+801083a4:	53                   	push   %ebx
+801083a5:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+801083a8:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801083ab:	ba 00 00 00 00       	mov    $0x0,%edx
+801083b0:	b8 00 00 00 00       	mov    $0x0,%eax
+801083b5:	e8 f8 fc ff ff       	call   801080b2 <argfd>
+801083ba:	85 c0                	test   %eax,%eax
+801083bc:	78 23                	js     801083e1 <sys_dup+0x40>
+  if((fd=fdalloc(f)) < 0)
+801083be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801083c1:	e8 4c fd ff ff       	call   80108112 <fdalloc>
+801083c6:	89 c3                	mov    %eax,%ebx
+801083c8:	85 c0                	test   %eax,%eax
+801083ca:	78 1c                	js     801083e8 <sys_dup+0x47>
+  filedup(f);
+801083cc:	83 ec 0c             	sub    $0xc,%esp
+801083cf:	ff 75 f4             	push   -0xc(%ebp)
+801083d2:	e8 7d 91 ff ff       	call   80101554 <filedup>
+  return fd;
+801083d7:	83 c4 10             	add    $0x10,%esp
+}
+801083da:	89 d8                	mov    %ebx,%eax
+801083dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801083df:	c9                   	leave
+801083e0:	c3                   	ret
+    return -1;
+801083e1:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801083e6:	eb f2                	jmp    801083da <sys_dup+0x39>
+    return -1;
+801083e8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801083ed:	eb eb                	jmp    801083da <sys_dup+0x39>
+
+801083ef <sys_read>:
+{
+801083ef:	55                   	push   %ebp
+801083f0:	89 e5                	mov    %esp,%ebp
+801083f2:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argwptr(1, &p, n) < 0)
+801083f5:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801083f8:	ba 00 00 00 00       	mov    $0x0,%edx
+801083fd:	b8 00 00 00 00       	mov    $0x0,%eax
+80108402:	e8 ab fc ff ff       	call   801080b2 <argfd>
+80108407:	85 c0                	test   %eax,%eax
+80108409:	78 43                	js     8010844e <sys_read+0x5f>
+8010840b:	83 ec 08             	sub    $0x8,%esp
+8010840e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108411:	50                   	push   %eax
+80108412:	6a 02                	push   $0x2
+80108414:	e8 2e fb ff ff       	call   80107f47 <argint>
+80108419:	83 c4 10             	add    $0x10,%esp
+8010841c:	85 c0                	test   %eax,%eax
+8010841e:	78 2e                	js     8010844e <sys_read+0x5f>
+80108420:	83 ec 04             	sub    $0x4,%esp
+80108423:	ff 75 f0             	push   -0x10(%ebp)
+80108426:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108429:	50                   	push   %eax
+8010842a:	6a 01                	push   $0x1
+8010842c:	e8 df fb ff ff       	call   80108010 <argwptr>
+80108431:	83 c4 10             	add    $0x10,%esp
+80108434:	85 c0                	test   %eax,%eax
+80108436:	78 16                	js     8010844e <sys_read+0x5f>
+  return fileread(f, p, n);
+80108438:	83 ec 04             	sub    $0x4,%esp
+8010843b:	ff 75 f0             	push   -0x10(%ebp)
+8010843e:	ff 75 ec             	push   -0x14(%ebp)
+80108441:	ff 75 f4             	push   -0xc(%ebp)
+80108444:	e8 73 92 ff ff       	call   801016bc <fileread>
+80108449:	83 c4 10             	add    $0x10,%esp
+}
+8010844c:	c9                   	leave
+8010844d:	c3                   	ret
+    return -1;
+8010844e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108453:	eb f7                	jmp    8010844c <sys_read+0x5d>
+
+80108455 <sys_write>:
+{
+80108455:	55                   	push   %ebp
+80108456:	89 e5                	mov    %esp,%ebp
+80108458:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+8010845b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+8010845e:	ba 00 00 00 00       	mov    $0x0,%edx
+80108463:	b8 00 00 00 00       	mov    $0x0,%eax
+80108468:	e8 45 fc ff ff       	call   801080b2 <argfd>
+8010846d:	85 c0                	test   %eax,%eax
+8010846f:	78 43                	js     801084b4 <sys_write+0x5f>
+80108471:	83 ec 08             	sub    $0x8,%esp
+80108474:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108477:	50                   	push   %eax
+80108478:	6a 02                	push   $0x2
+8010847a:	e8 c8 fa ff ff       	call   80107f47 <argint>
+8010847f:	83 c4 10             	add    $0x10,%esp
+80108482:	85 c0                	test   %eax,%eax
+80108484:	78 2e                	js     801084b4 <sys_write+0x5f>
+80108486:	83 ec 04             	sub    $0x4,%esp
+80108489:	ff 75 f0             	push   -0x10(%ebp)
+8010848c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010848f:	50                   	push   %eax
+80108490:	6a 01                	push   $0x1
+80108492:	e8 61 fb ff ff       	call   80107ff8 <argptr>
+80108497:	83 c4 10             	add    $0x10,%esp
+8010849a:	85 c0                	test   %eax,%eax
+8010849c:	78 16                	js     801084b4 <sys_write+0x5f>
+  return filewrite(f, p, n);
+8010849e:	83 ec 04             	sub    $0x4,%esp
+801084a1:	ff 75 f0             	push   -0x10(%ebp)
+801084a4:	ff 75 ec             	push   -0x14(%ebp)
+801084a7:	ff 75 f4             	push   -0xc(%ebp)
+801084aa:	e8 92 92 ff ff       	call   80101741 <filewrite>
+801084af:	83 c4 10             	add    $0x10,%esp
+}
+801084b2:	c9                   	leave
+801084b3:	c3                   	ret
+    return -1;
+801084b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084b9:	eb f7                	jmp    801084b2 <sys_write+0x5d>
+
+801084bb <sys_close>:
+{
+801084bb:	55                   	push   %ebp
+801084bc:	89 e5                	mov    %esp,%ebp
+801084be:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+801084c1:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+801084c4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+801084c7:	b8 00 00 00 00       	mov    $0x0,%eax
+801084cc:	e8 e1 fb ff ff       	call   801080b2 <argfd>
+801084d1:	85 c0                	test   %eax,%eax
+801084d3:	78 25                	js     801084fa <sys_close+0x3f>
+  myproc()->ofile[fd] = 0;
+801084d5:	e8 fe d4 ff ff       	call   801059d8 <myproc>
+801084da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801084dd:	c7 44 90 28 00 00 00 	movl   $0x0,0x28(%eax,%edx,4)
+801084e4:	00 
+  fileclose(f);
+801084e5:	83 ec 0c             	sub    $0xc,%esp
+801084e8:	ff 75 f0             	push   -0x10(%ebp)
+801084eb:	e8 a9 90 ff ff       	call   80101599 <fileclose>
+  return 0;
+801084f0:	83 c4 10             	add    $0x10,%esp
+801084f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801084f8:	c9                   	leave
+801084f9:	c3                   	ret
+    return -1;
+801084fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084ff:	eb f7                	jmp    801084f8 <sys_close+0x3d>
+
+80108501 <sys_fstat>:
+{
+80108501:	55                   	push   %ebp
+80108502:	89 e5                	mov    %esp,%ebp
+80108504:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argwptr(1, (void*)&st, sizeof(*st)) < 0)
+80108507:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+8010850a:	ba 00 00 00 00       	mov    $0x0,%edx
+8010850f:	b8 00 00 00 00       	mov    $0x0,%eax
+80108514:	e8 99 fb ff ff       	call   801080b2 <argfd>
+80108519:	85 c0                	test   %eax,%eax
+8010851b:	78 2a                	js     80108547 <sys_fstat+0x46>
+8010851d:	83 ec 04             	sub    $0x4,%esp
+80108520:	6a 14                	push   $0x14
+80108522:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108525:	50                   	push   %eax
+80108526:	6a 01                	push   $0x1
+80108528:	e8 e3 fa ff ff       	call   80108010 <argwptr>
+8010852d:	83 c4 10             	add    $0x10,%esp
+80108530:	85 c0                	test   %eax,%eax
+80108532:	78 13                	js     80108547 <sys_fstat+0x46>
+  return filestat(f, st);
+80108534:	83 ec 08             	sub    $0x8,%esp
+80108537:	ff 75 f0             	push   -0x10(%ebp)
+8010853a:	ff 75 f4             	push   -0xc(%ebp)
+8010853d:	e8 33 91 ff ff       	call   80101675 <filestat>
+80108542:	83 c4 10             	add    $0x10,%esp
+}
+80108545:	c9                   	leave
+80108546:	c3                   	ret
+    return -1;
+80108547:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010854c:	eb f7                	jmp    80108545 <sys_fstat+0x44>
+
+8010854e <sys_link>:
+{
+8010854e:	55                   	push   %ebp
+8010854f:	89 e5                	mov    %esp,%ebp
+80108551:	56                   	push   %esi
+80108552:	53                   	push   %ebx
+80108553:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108556:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108559:	50                   	push   %eax
+8010855a:	6a 00                	push   $0x0
+8010855c:	e8 c7 fa ff ff       	call   80108028 <argstr>
+80108561:	83 c4 10             	add    $0x10,%esp
+80108564:	85 c0                	test   %eax,%eax
+80108566:	0f 88 d3 00 00 00    	js     8010863f <sys_link+0xf1>
+8010856c:	83 ec 08             	sub    $0x8,%esp
+8010856f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108572:	50                   	push   %eax
+80108573:	6a 01                	push   $0x1
+80108575:	e8 ae fa ff ff       	call   80108028 <argstr>
+8010857a:	83 c4 10             	add    $0x10,%esp
+8010857d:	85 c0                	test   %eax,%eax
+8010857f:	0f 88 ba 00 00 00    	js     8010863f <sys_link+0xf1>
+  begin_op();
+80108585:	e8 57 be ff ff       	call   801043e1 <begin_op>
+  if((ip = namei(old)) == 0){
+8010858a:	83 ec 0c             	sub    $0xc,%esp
+8010858d:	ff 75 e0             	push   -0x20(%ebp)
+80108590:	e8 6e a3 ff ff       	call   80102903 <namei>
+80108595:	89 c3                	mov    %eax,%ebx
+80108597:	83 c4 10             	add    $0x10,%esp
+8010859a:	85 c0                	test   %eax,%eax
+8010859c:	0f 84 a4 00 00 00    	je     80108646 <sys_link+0xf8>
+  ilock(ip);
+801085a2:	83 ec 0c             	sub    $0xc,%esp
+801085a5:	50                   	push   %eax
+801085a6:	e8 12 9c ff ff       	call   801021bd <ilock>
+  if(ip->type == T_DIR){
+801085ab:	83 c4 10             	add    $0x10,%esp
+801085ae:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+801085b3:	0f 84 99 00 00 00    	je     80108652 <sys_link+0x104>
+  ip->nlink++;
+801085b9:	0f b7 43 7e          	movzwl 0x7e(%ebx),%eax
+801085bd:	83 c0 01             	add    $0x1,%eax
+801085c0:	66 89 43 7e          	mov    %ax,0x7e(%ebx)
+  iupdate(ip);
+801085c4:	83 ec 0c             	sub    $0xc,%esp
+801085c7:	53                   	push   %ebx
+801085c8:	e8 7b 99 ff ff       	call   80101f48 <iupdate>
+  iunlock(ip);
+801085cd:	89 1c 24             	mov    %ebx,(%esp)
+801085d0:	e8 cb 9c ff ff       	call   801022a0 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+801085d5:	83 c4 08             	add    $0x8,%esp
+801085d8:	8d 45 ea             	lea    -0x16(%ebp),%eax
+801085db:	50                   	push   %eax
+801085dc:	ff 75 e4             	push   -0x1c(%ebp)
+801085df:	e8 37 a3 ff ff       	call   8010291b <nameiparent>
+801085e4:	89 c6                	mov    %eax,%esi
+801085e6:	83 c4 10             	add    $0x10,%esp
+801085e9:	85 c0                	test   %eax,%eax
+801085eb:	0f 84 85 00 00 00    	je     80108676 <sys_link+0x128>
+  ilock(dp);
+801085f1:	83 ec 0c             	sub    $0xc,%esp
+801085f4:	50                   	push   %eax
+801085f5:	e8 c3 9b ff ff       	call   801021bd <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+801085fa:	83 c4 10             	add    $0x10,%esp
+801085fd:	8b 03                	mov    (%ebx),%eax
+801085ff:	39 06                	cmp    %eax,(%esi)
+80108601:	75 67                	jne    8010866a <sys_link+0x11c>
+80108603:	83 ec 04             	sub    $0x4,%esp
+80108606:	ff 73 04             	push   0x4(%ebx)
+80108609:	8d 45 ea             	lea    -0x16(%ebp),%eax
+8010860c:	50                   	push   %eax
+8010860d:	56                   	push   %esi
+8010860e:	e8 3c a2 ff ff       	call   8010284f <dirlink>
+80108613:	83 c4 10             	add    $0x10,%esp
+80108616:	85 c0                	test   %eax,%eax
+80108618:	78 50                	js     8010866a <sys_link+0x11c>
+  iunlockput(dp);
+8010861a:	83 ec 0c             	sub    $0xc,%esp
+8010861d:	56                   	push   %esi
+8010861e:	e8 f0 9d ff ff       	call   80102413 <iunlockput>
+  iput(ip);
+80108623:	89 1c 24             	mov    %ebx,(%esp)
+80108626:	e8 ba 9c ff ff       	call   801022e5 <iput>
+  end_op();
+8010862b:	e8 3b be ff ff       	call   8010446b <end_op>
+  return 0;
+80108630:	83 c4 10             	add    $0x10,%esp
+80108633:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108638:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010863b:	5b                   	pop    %ebx
+8010863c:	5e                   	pop    %esi
+8010863d:	5d                   	pop    %ebp
+8010863e:	c3                   	ret
+    return -1;
+8010863f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108644:	eb f2                	jmp    80108638 <sys_link+0xea>
+    end_op();
+80108646:	e8 20 be ff ff       	call   8010446b <end_op>
+    return -1;
+8010864b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108650:	eb e6                	jmp    80108638 <sys_link+0xea>
+    iunlockput(ip);
+80108652:	83 ec 0c             	sub    $0xc,%esp
+80108655:	53                   	push   %ebx
+80108656:	e8 b8 9d ff ff       	call   80102413 <iunlockput>
+    end_op();
+8010865b:	e8 0b be ff ff       	call   8010446b <end_op>
+    return -1;
+80108660:	83 c4 10             	add    $0x10,%esp
+80108663:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108668:	eb ce                	jmp    80108638 <sys_link+0xea>
+    iunlockput(dp);
+8010866a:	83 ec 0c             	sub    $0xc,%esp
+8010866d:	56                   	push   %esi
+8010866e:	e8 a0 9d ff ff       	call   80102413 <iunlockput>
+    goto bad;
+80108673:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108676:	83 ec 0c             	sub    $0xc,%esp
+80108679:	53                   	push   %ebx
+8010867a:	e8 3e 9b ff ff       	call   801021bd <ilock>
+  ip->nlink--;
+8010867f:	0f b7 43 7e          	movzwl 0x7e(%ebx),%eax
+80108683:	83 e8 01             	sub    $0x1,%eax
+80108686:	66 89 43 7e          	mov    %ax,0x7e(%ebx)
+  iupdate(ip);
+8010868a:	89 1c 24             	mov    %ebx,(%esp)
+8010868d:	e8 b6 98 ff ff       	call   80101f48 <iupdate>
+  iunlockput(ip);
+80108692:	89 1c 24             	mov    %ebx,(%esp)
+80108695:	e8 79 9d ff ff       	call   80102413 <iunlockput>
+  end_op();
+8010869a:	e8 cc bd ff ff       	call   8010446b <end_op>
+  return -1;
+8010869f:	83 c4 10             	add    $0x10,%esp
+801086a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086a7:	eb 8f                	jmp    80108638 <sys_link+0xea>
+
+801086a9 <sys_unlink>:
+{
+801086a9:	55                   	push   %ebp
+801086aa:	89 e5                	mov    %esp,%ebp
+801086ac:	57                   	push   %edi
+801086ad:	56                   	push   %esi
+801086ae:	53                   	push   %ebx
+801086af:	83 ec 44             	sub    $0x44,%esp
+  if(argstr(0, &path) < 0)
+801086b2:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+801086b5:	50                   	push   %eax
+801086b6:	6a 00                	push   $0x0
+801086b8:	e8 6b f9 ff ff       	call   80108028 <argstr>
+801086bd:	83 c4 10             	add    $0x10,%esp
+801086c0:	85 c0                	test   %eax,%eax
+801086c2:	0f 88 83 01 00 00    	js     8010884b <sys_unlink+0x1a2>
+  begin_op();
+801086c8:	e8 14 bd ff ff       	call   801043e1 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+801086cd:	83 ec 08             	sub    $0x8,%esp
+801086d0:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801086d3:	50                   	push   %eax
+801086d4:	ff 75 c4             	push   -0x3c(%ebp)
+801086d7:	e8 3f a2 ff ff       	call   8010291b <nameiparent>
+801086dc:	89 c6                	mov    %eax,%esi
+801086de:	83 c4 10             	add    $0x10,%esp
+801086e1:	85 c0                	test   %eax,%eax
+801086e3:	0f 84 ed 00 00 00    	je     801087d6 <sys_unlink+0x12d>
+  ilock(dp);
+801086e9:	83 ec 0c             	sub    $0xc,%esp
+801086ec:	50                   	push   %eax
+801086ed:	e8 cb 9a ff ff       	call   801021bd <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+801086f2:	83 c4 08             	add    $0x8,%esp
+801086f5:	68 36 be 10 80       	push   $0x8010be36
+801086fa:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801086fd:	50                   	push   %eax
+801086fe:	e8 b7 9f ff ff       	call   801026ba <namecmp>
+80108703:	83 c4 10             	add    $0x10,%esp
+80108706:	85 c0                	test   %eax,%eax
+80108708:	0f 84 fc 00 00 00    	je     8010880a <sys_unlink+0x161>
+8010870e:	83 ec 08             	sub    $0x8,%esp
+80108711:	68 35 be 10 80       	push   $0x8010be35
+80108716:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108719:	50                   	push   %eax
+8010871a:	e8 9b 9f ff ff       	call   801026ba <namecmp>
+8010871f:	83 c4 10             	add    $0x10,%esp
+80108722:	85 c0                	test   %eax,%eax
+80108724:	0f 84 e0 00 00 00    	je     8010880a <sys_unlink+0x161>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+8010872a:	83 ec 04             	sub    $0x4,%esp
+8010872d:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80108730:	50                   	push   %eax
+80108731:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108734:	50                   	push   %eax
+80108735:	56                   	push   %esi
+80108736:	e8 94 9f ff ff       	call   801026cf <dirlookup>
+8010873b:	89 c3                	mov    %eax,%ebx
+8010873d:	83 c4 10             	add    $0x10,%esp
+80108740:	85 c0                	test   %eax,%eax
+80108742:	0f 84 c2 00 00 00    	je     8010880a <sys_unlink+0x161>
+  ilock(ip);
+80108748:	83 ec 0c             	sub    $0xc,%esp
+8010874b:	50                   	push   %eax
+8010874c:	e8 6c 9a ff ff       	call   801021bd <ilock>
+  if(ip->nlink < 1)
+80108751:	83 c4 10             	add    $0x10,%esp
+80108754:	66 83 7b 7e 00       	cmpw   $0x0,0x7e(%ebx)
+80108759:	0f 8e 83 00 00 00    	jle    801087e2 <sys_unlink+0x139>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+8010875f:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80108764:	0f 84 85 00 00 00    	je     801087ef <sys_unlink+0x146>
+  memset(&de, 0, sizeof(de));
+8010876a:	83 ec 04             	sub    $0x4,%esp
+8010876d:	6a 10                	push   $0x10
+8010876f:	6a 00                	push   $0x0
+80108771:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80108774:	57                   	push   %edi
+80108775:	e8 7d f5 ff ff       	call   80107cf7 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010877a:	6a 10                	push   $0x10
+8010877c:	ff 75 c0             	push   -0x40(%ebp)
+8010877f:	57                   	push   %edi
+80108780:	56                   	push   %esi
+80108781:	e8 da 9d ff ff       	call   80102560 <writei>
+80108786:	83 c4 20             	add    $0x20,%esp
+80108789:	83 f8 10             	cmp    $0x10,%eax
+8010878c:	0f 85 90 00 00 00    	jne    80108822 <sys_unlink+0x179>
+  if(ip->type == T_DIR){
+80108792:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80108797:	0f 84 92 00 00 00    	je     8010882f <sys_unlink+0x186>
+  iunlockput(dp);
+8010879d:	83 ec 0c             	sub    $0xc,%esp
+801087a0:	56                   	push   %esi
+801087a1:	e8 6d 9c ff ff       	call   80102413 <iunlockput>
+  ip->nlink--;
+801087a6:	0f b7 43 7e          	movzwl 0x7e(%ebx),%eax
+801087aa:	83 e8 01             	sub    $0x1,%eax
+801087ad:	66 89 43 7e          	mov    %ax,0x7e(%ebx)
+  iupdate(ip);
+801087b1:	89 1c 24             	mov    %ebx,(%esp)
+801087b4:	e8 8f 97 ff ff       	call   80101f48 <iupdate>
+  iunlockput(ip);
+801087b9:	89 1c 24             	mov    %ebx,(%esp)
+801087bc:	e8 52 9c ff ff       	call   80102413 <iunlockput>
+  end_op();
+801087c1:	e8 a5 bc ff ff       	call   8010446b <end_op>
+  return 0;
+801087c6:	83 c4 10             	add    $0x10,%esp
+801087c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801087ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087d1:	5b                   	pop    %ebx
+801087d2:	5e                   	pop    %esi
+801087d3:	5f                   	pop    %edi
+801087d4:	5d                   	pop    %ebp
+801087d5:	c3                   	ret
+    end_op();
+801087d6:	e8 90 bc ff ff       	call   8010446b <end_op>
+    return -1;
+801087db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087e0:	eb ec                	jmp    801087ce <sys_unlink+0x125>
+    panic("unlink: nlink < 1");
+801087e2:	83 ec 0c             	sub    $0xc,%esp
+801087e5:	68 54 be 10 80       	push   $0x8010be54
+801087ea:	e8 13 81 ff ff       	call   80100902 <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801087ef:	89 d8                	mov    %ebx,%eax
+801087f1:	e8 52 f9 ff ff       	call   80108148 <isdirempty>
+801087f6:	85 c0                	test   %eax,%eax
+801087f8:	0f 85 6c ff ff ff    	jne    8010876a <sys_unlink+0xc1>
+    iunlockput(ip);
+801087fe:	83 ec 0c             	sub    $0xc,%esp
+80108801:	53                   	push   %ebx
+80108802:	e8 0c 9c ff ff       	call   80102413 <iunlockput>
+    goto bad;
+80108807:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+8010880a:	83 ec 0c             	sub    $0xc,%esp
+8010880d:	56                   	push   %esi
+8010880e:	e8 00 9c ff ff       	call   80102413 <iunlockput>
+  end_op();
+80108813:	e8 53 bc ff ff       	call   8010446b <end_op>
+  return -1;
+80108818:	83 c4 10             	add    $0x10,%esp
+8010881b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108820:	eb ac                	jmp    801087ce <sys_unlink+0x125>
+    panic("unlink: writei");
+80108822:	83 ec 0c             	sub    $0xc,%esp
+80108825:	68 66 be 10 80       	push   $0x8010be66
+8010882a:	e8 d3 80 ff ff       	call   80100902 <panic>
+    dp->nlink--;
+8010882f:	0f b7 46 7e          	movzwl 0x7e(%esi),%eax
+80108833:	83 e8 01             	sub    $0x1,%eax
+80108836:	66 89 46 7e          	mov    %ax,0x7e(%esi)
+    iupdate(dp);
+8010883a:	83 ec 0c             	sub    $0xc,%esp
+8010883d:	56                   	push   %esi
+8010883e:	e8 05 97 ff ff       	call   80101f48 <iupdate>
+80108843:	83 c4 10             	add    $0x10,%esp
+80108846:	e9 52 ff ff ff       	jmp    8010879d <sys_unlink+0xf4>
+    return -1;
+8010884b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108850:	e9 79 ff ff ff       	jmp    801087ce <sys_unlink+0x125>
+
+80108855 <sys_open>:
+{
+80108855:	55                   	push   %ebp
+80108856:	89 e5                	mov    %esp,%ebp
+80108858:	57                   	push   %edi
+80108859:	56                   	push   %esi
+8010885a:	53                   	push   %ebx
+8010885b:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010885e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108861:	50                   	push   %eax
+80108862:	6a 00                	push   $0x0
+80108864:	e8 bf f7 ff ff       	call   80108028 <argstr>
+80108869:	83 c4 10             	add    $0x10,%esp
+8010886c:	85 c0                	test   %eax,%eax
+8010886e:	0f 88 a0 00 00 00    	js     80108914 <sys_open+0xbf>
+80108874:	83 ec 08             	sub    $0x8,%esp
+80108877:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010887a:	50                   	push   %eax
+8010887b:	6a 01                	push   $0x1
+8010887d:	e8 c5 f6 ff ff       	call   80107f47 <argint>
+80108882:	83 c4 10             	add    $0x10,%esp
+80108885:	85 c0                	test   %eax,%eax
+80108887:	0f 88 87 00 00 00    	js     80108914 <sys_open+0xbf>
+  begin_op();
+8010888d:	e8 4f bb ff ff       	call   801043e1 <begin_op>
+  if(omode & O_CREATE){
+80108892:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+80108896:	0f 84 8b 00 00 00    	je     80108927 <sys_open+0xd2>
+    ip = create(path, T_FILE, 0, 0);
+8010889c:	83 ec 0c             	sub    $0xc,%esp
+8010889f:	6a 00                	push   $0x0
+801088a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+801088a6:	ba 02 00 00 00       	mov    $0x2,%edx
+801088ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801088ae:	e8 ef f8 ff ff       	call   801081a2 <create>
+801088b3:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801088b5:	83 c4 10             	add    $0x10,%esp
+801088b8:	85 c0                	test   %eax,%eax
+801088ba:	74 5f                	je     8010891b <sys_open+0xc6>
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+801088bc:	e8 5b 8c ff ff       	call   8010151c <filealloc>
+801088c1:	89 c3                	mov    %eax,%ebx
+801088c3:	85 c0                	test   %eax,%eax
+801088c5:	0f 84 c1 00 00 00    	je     8010898c <sys_open+0x137>
+801088cb:	e8 42 f8 ff ff       	call   80108112 <fdalloc>
+801088d0:	89 c7                	mov    %eax,%edi
+801088d2:	85 c0                	test   %eax,%eax
+801088d4:	0f 88 a6 00 00 00    	js     80108980 <sys_open+0x12b>
+  iunlock(ip);
+801088da:	83 ec 0c             	sub    $0xc,%esp
+801088dd:	56                   	push   %esi
+801088de:	e8 bd 99 ff ff       	call   801022a0 <iunlock>
+  end_op();
+801088e3:	e8 83 bb ff ff       	call   8010446b <end_op>
+  f->type = FD_INODE;
+801088e8:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+801088ee:	89 73 10             	mov    %esi,0x10(%ebx)
+  f->off = 0;
+801088f1:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  f->readable = !(omode & O_WRONLY);
+801088f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801088fb:	83 c4 10             	add    $0x10,%esp
+801088fe:	a8 01                	test   $0x1,%al
+80108900:	0f 94 43 08          	sete   0x8(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108904:	a8 03                	test   $0x3,%al
+80108906:	0f 95 43 09          	setne  0x9(%ebx)
+}
+8010890a:	89 f8                	mov    %edi,%eax
+8010890c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010890f:	5b                   	pop    %ebx
+80108910:	5e                   	pop    %esi
+80108911:	5f                   	pop    %edi
+80108912:	5d                   	pop    %ebp
+80108913:	c3                   	ret
+    return -1;
+80108914:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108919:	eb ef                	jmp    8010890a <sys_open+0xb5>
+      end_op();
+8010891b:	e8 4b bb ff ff       	call   8010446b <end_op>
+      return -1;
+80108920:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108925:	eb e3                	jmp    8010890a <sys_open+0xb5>
+    if((ip = namei(path)) == 0){
+80108927:	83 ec 0c             	sub    $0xc,%esp
+8010892a:	ff 75 e4             	push   -0x1c(%ebp)
+8010892d:	e8 d1 9f ff ff       	call   80102903 <namei>
+80108932:	89 c6                	mov    %eax,%esi
+80108934:	83 c4 10             	add    $0x10,%esp
+80108937:	85 c0                	test   %eax,%eax
+80108939:	74 39                	je     80108974 <sys_open+0x11f>
+    ilock(ip);
+8010893b:	83 ec 0c             	sub    $0xc,%esp
+8010893e:	50                   	push   %eax
+8010893f:	e8 79 98 ff ff       	call   801021bd <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108944:	83 c4 10             	add    $0x10,%esp
+80108947:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+8010894c:	0f 85 6a ff ff ff    	jne    801088bc <sys_open+0x67>
+80108952:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80108956:	0f 84 60 ff ff ff    	je     801088bc <sys_open+0x67>
+      iunlockput(ip);
+8010895c:	83 ec 0c             	sub    $0xc,%esp
+8010895f:	56                   	push   %esi
+80108960:	e8 ae 9a ff ff       	call   80102413 <iunlockput>
+      end_op();
+80108965:	e8 01 bb ff ff       	call   8010446b <end_op>
+      return -1;
+8010896a:	83 c4 10             	add    $0x10,%esp
+8010896d:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108972:	eb 96                	jmp    8010890a <sys_open+0xb5>
+      end_op();
+80108974:	e8 f2 ba ff ff       	call   8010446b <end_op>
+      return -1;
+80108979:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010897e:	eb 8a                	jmp    8010890a <sys_open+0xb5>
+      fileclose(f);
+80108980:	83 ec 0c             	sub    $0xc,%esp
+80108983:	53                   	push   %ebx
+80108984:	e8 10 8c ff ff       	call   80101599 <fileclose>
+80108989:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010898c:	83 ec 0c             	sub    $0xc,%esp
+8010898f:	56                   	push   %esi
+80108990:	e8 7e 9a ff ff       	call   80102413 <iunlockput>
+    end_op();
+80108995:	e8 d1 ba ff ff       	call   8010446b <end_op>
+    return -1;
+8010899a:	83 c4 10             	add    $0x10,%esp
+8010899d:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801089a2:	e9 63 ff ff ff       	jmp    8010890a <sys_open+0xb5>
+
+801089a7 <sys_mkdir>:
+{
+801089a7:	55                   	push   %ebp
+801089a8:	89 e5                	mov    %esp,%ebp
+801089aa:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+801089ad:	e8 2f ba ff ff       	call   801043e1 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+801089b2:	83 ec 08             	sub    $0x8,%esp
+801089b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801089b8:	50                   	push   %eax
+801089b9:	6a 00                	push   $0x0
+801089bb:	e8 68 f6 ff ff       	call   80108028 <argstr>
+801089c0:	83 c4 10             	add    $0x10,%esp
+801089c3:	85 c0                	test   %eax,%eax
+801089c5:	78 36                	js     801089fd <sys_mkdir+0x56>
+801089c7:	83 ec 0c             	sub    $0xc,%esp
+801089ca:	6a 00                	push   $0x0
+801089cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+801089d1:	ba 01 00 00 00       	mov    $0x1,%edx
+801089d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801089d9:	e8 c4 f7 ff ff       	call   801081a2 <create>
+801089de:	83 c4 10             	add    $0x10,%esp
+801089e1:	85 c0                	test   %eax,%eax
+801089e3:	74 18                	je     801089fd <sys_mkdir+0x56>
+  iunlockput(ip);
+801089e5:	83 ec 0c             	sub    $0xc,%esp
+801089e8:	50                   	push   %eax
+801089e9:	e8 25 9a ff ff       	call   80102413 <iunlockput>
+  end_op();
+801089ee:	e8 78 ba ff ff       	call   8010446b <end_op>
+  return 0;
+801089f3:	83 c4 10             	add    $0x10,%esp
+801089f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801089fb:	c9                   	leave
+801089fc:	c3                   	ret
+    end_op();
+801089fd:	e8 69 ba ff ff       	call   8010446b <end_op>
+    return -1;
+80108a02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a07:	eb f2                	jmp    801089fb <sys_mkdir+0x54>
+
+80108a09 <sys_mknod>:
+{
+80108a09:	55                   	push   %ebp
+80108a0a:	89 e5                	mov    %esp,%ebp
+80108a0c:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+80108a0f:	e8 cd b9 ff ff       	call   801043e1 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+80108a14:	83 ec 08             	sub    $0x8,%esp
+80108a17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a1a:	50                   	push   %eax
+80108a1b:	6a 00                	push   $0x0
+80108a1d:	e8 06 f6 ff ff       	call   80108028 <argstr>
+80108a22:	83 c4 10             	add    $0x10,%esp
+80108a25:	85 c0                	test   %eax,%eax
+80108a27:	78 62                	js     80108a8b <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+80108a29:	83 ec 08             	sub    $0x8,%esp
+80108a2c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108a2f:	50                   	push   %eax
+80108a30:	6a 01                	push   $0x1
+80108a32:	e8 10 f5 ff ff       	call   80107f47 <argint>
+  if((argstr(0, &path)) < 0 ||
+80108a37:	83 c4 10             	add    $0x10,%esp
+80108a3a:	85 c0                	test   %eax,%eax
+80108a3c:	78 4d                	js     80108a8b <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+80108a3e:	83 ec 08             	sub    $0x8,%esp
+80108a41:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108a44:	50                   	push   %eax
+80108a45:	6a 02                	push   $0x2
+80108a47:	e8 fb f4 ff ff       	call   80107f47 <argint>
+     argint(1, &major) < 0 ||
+80108a4c:	83 c4 10             	add    $0x10,%esp
+80108a4f:	85 c0                	test   %eax,%eax
+80108a51:	78 38                	js     80108a8b <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108a53:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108a57:	83 ec 0c             	sub    $0xc,%esp
+80108a5a:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+80108a5e:	50                   	push   %eax
+80108a5f:	ba 03 00 00 00       	mov    $0x3,%edx
+80108a64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108a67:	e8 36 f7 ff ff       	call   801081a2 <create>
+     argint(2, &minor) < 0 ||
+80108a6c:	83 c4 10             	add    $0x10,%esp
+80108a6f:	85 c0                	test   %eax,%eax
+80108a71:	74 18                	je     80108a8b <sys_mknod+0x82>
+  iunlockput(ip);
+80108a73:	83 ec 0c             	sub    $0xc,%esp
+80108a76:	50                   	push   %eax
+80108a77:	e8 97 99 ff ff       	call   80102413 <iunlockput>
+  end_op();
+80108a7c:	e8 ea b9 ff ff       	call   8010446b <end_op>
+  return 0;
+80108a81:	83 c4 10             	add    $0x10,%esp
+80108a84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108a89:	c9                   	leave
+80108a8a:	c3                   	ret
+    end_op();
+80108a8b:	e8 db b9 ff ff       	call   8010446b <end_op>
+    return -1;
+80108a90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a95:	eb f2                	jmp    80108a89 <sys_mknod+0x80>
+
+80108a97 <sys_chdir>:
+{
+80108a97:	55                   	push   %ebp
+80108a98:	89 e5                	mov    %esp,%ebp
+80108a9a:	56                   	push   %esi
+80108a9b:	53                   	push   %ebx
+80108a9c:	83 ec 10             	sub    $0x10,%esp
+  struct proc *curproc = myproc();
+80108a9f:	e8 34 cf ff ff       	call   801059d8 <myproc>
+80108aa4:	89 c6                	mov    %eax,%esi
+  begin_op();
+80108aa6:	e8 36 b9 ff ff       	call   801043e1 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108aab:	83 ec 08             	sub    $0x8,%esp
+80108aae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ab1:	50                   	push   %eax
+80108ab2:	6a 00                	push   $0x0
+80108ab4:	e8 6f f5 ff ff       	call   80108028 <argstr>
+80108ab9:	83 c4 10             	add    $0x10,%esp
+80108abc:	85 c0                	test   %eax,%eax
+80108abe:	78 52                	js     80108b12 <sys_chdir+0x7b>
+80108ac0:	83 ec 0c             	sub    $0xc,%esp
+80108ac3:	ff 75 f4             	push   -0xc(%ebp)
+80108ac6:	e8 38 9e ff ff       	call   80102903 <namei>
+80108acb:	89 c3                	mov    %eax,%ebx
+80108acd:	83 c4 10             	add    $0x10,%esp
+80108ad0:	85 c0                	test   %eax,%eax
+80108ad2:	74 3e                	je     80108b12 <sys_chdir+0x7b>
+  ilock(ip);
+80108ad4:	83 ec 0c             	sub    $0xc,%esp
+80108ad7:	50                   	push   %eax
+80108ad8:	e8 e0 96 ff ff       	call   801021bd <ilock>
+  if(ip->type != T_DIR){
+80108add:	83 c4 10             	add    $0x10,%esp
+80108ae0:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80108ae5:	75 37                	jne    80108b1e <sys_chdir+0x87>
+  iunlock(ip);
+80108ae7:	83 ec 0c             	sub    $0xc,%esp
+80108aea:	53                   	push   %ebx
+80108aeb:	e8 b0 97 ff ff       	call   801022a0 <iunlock>
+  iput(curproc->cwd);
+80108af0:	83 c4 04             	add    $0x4,%esp
+80108af3:	ff 76 68             	push   0x68(%esi)
+80108af6:	e8 ea 97 ff ff       	call   801022e5 <iput>
+  end_op();
+80108afb:	e8 6b b9 ff ff       	call   8010446b <end_op>
+  curproc->cwd = ip;
+80108b00:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+80108b03:	83 c4 10             	add    $0x10,%esp
+80108b06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108b0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108b0e:	5b                   	pop    %ebx
+80108b0f:	5e                   	pop    %esi
+80108b10:	5d                   	pop    %ebp
+80108b11:	c3                   	ret
+    end_op();
+80108b12:	e8 54 b9 ff ff       	call   8010446b <end_op>
+    return -1;
+80108b17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b1c:	eb ed                	jmp    80108b0b <sys_chdir+0x74>
+    iunlockput(ip);
+80108b1e:	83 ec 0c             	sub    $0xc,%esp
+80108b21:	53                   	push   %ebx
+80108b22:	e8 ec 98 ff ff       	call   80102413 <iunlockput>
+    end_op();
+80108b27:	e8 3f b9 ff ff       	call   8010446b <end_op>
+    return -1;
+80108b2c:	83 c4 10             	add    $0x10,%esp
+80108b2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b34:	eb d5                	jmp    80108b0b <sys_chdir+0x74>
+
+80108b36 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108b36:	55                   	push   %ebp
+80108b37:	89 e5                	mov    %esp,%ebp
+80108b39:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0){
+80108b3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b42:	50                   	push   %eax
+80108b43:	6a 00                	push   $0x0
+80108b45:	e8 de f4 ff ff       	call   80108028 <argstr>
+80108b4a:	83 c4 10             	add    $0x10,%esp
+80108b4d:	85 c0                	test   %eax,%eax
+80108b4f:	78 2b                	js     80108b7c <sys_exec+0x46>
+80108b51:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108b57:	b8 01 00 00 00       	mov    $0x1,%eax
+80108b5c:	e8 a4 f7 ff ff       	call   80108305 <argargv>
+80108b61:	85 c0                	test   %eax,%eax
+80108b63:	78 17                	js     80108b7c <sys_exec+0x46>
+    return -1;
+  }
+  return exec(path, argv);
+80108b65:	83 ec 08             	sub    $0x8,%esp
+80108b68:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108b6e:	50                   	push   %eax
+80108b6f:	ff 75 f4             	push   -0xc(%ebp)
+80108b72:	e8 6f 89 ff ff       	call   801014e6 <exec>
+80108b77:	83 c4 10             	add    $0x10,%esp
+}
+80108b7a:	c9                   	leave
+80108b7b:	c3                   	ret
+    return -1;
+80108b7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b81:	eb f7                	jmp    80108b7a <sys_exec+0x44>
+
+80108b83 <sys_spawn>:
+
+int
+sys_spawn(void)
+{
+80108b83:	55                   	push   %ebp
+80108b84:	89 e5                	mov    %esp,%ebp
+80108b86:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+  int nice;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || argint(2, &nice) < 0){
+80108b8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b8f:	50                   	push   %eax
+80108b90:	6a 00                	push   $0x0
+80108b92:	e8 91 f4 ff ff       	call   80108028 <argstr>
+80108b97:	83 c4 10             	add    $0x10,%esp
+80108b9a:	85 c0                	test   %eax,%eax
+80108b9c:	78 49                	js     80108be7 <sys_spawn+0x64>
+80108b9e:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108ba4:	b8 01 00 00 00       	mov    $0x1,%eax
+80108ba9:	e8 57 f7 ff ff       	call   80108305 <argargv>
+80108bae:	85 c0                	test   %eax,%eax
+80108bb0:	78 35                	js     80108be7 <sys_spawn+0x64>
+80108bb2:	83 ec 08             	sub    $0x8,%esp
+80108bb5:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80108bbb:	50                   	push   %eax
+80108bbc:	6a 02                	push   $0x2
+80108bbe:	e8 84 f3 ff ff       	call   80107f47 <argint>
+80108bc3:	83 c4 10             	add    $0x10,%esp
+80108bc6:	85 c0                	test   %eax,%eax
+80108bc8:	78 1d                	js     80108be7 <sys_spawn+0x64>
+    return -1;
+  }
+  return spawn(path, argv, nice);
+80108bca:	83 ec 04             	sub    $0x4,%esp
+80108bcd:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+80108bd3:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108bd9:	50                   	push   %eax
+80108bda:	ff 75 f4             	push   -0xc(%ebp)
+80108bdd:	e8 1a d2 ff ff       	call   80105dfc <spawn>
+80108be2:	83 c4 10             	add    $0x10,%esp
+}
+80108be5:	c9                   	leave
+80108be6:	c3                   	ret
+    return -1;
+80108be7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108bec:	eb f7                	jmp    80108be5 <sys_spawn+0x62>
+
+80108bee <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80108bee:	55                   	push   %ebp
+80108bef:	89 e5                	mov    %esp,%ebp
+80108bf1:	53                   	push   %ebx
+80108bf2:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108bf5:	6a 08                	push   $0x8
+80108bf7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108bfa:	50                   	push   %eax
+80108bfb:	6a 00                	push   $0x0
+80108bfd:	e8 0e f4 ff ff       	call   80108010 <argwptr>
+80108c02:	83 c4 10             	add    $0x10,%esp
+80108c05:	85 c0                	test   %eax,%eax
+80108c07:	78 73                	js     80108c7c <sys_pipe+0x8e>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108c09:	83 ec 08             	sub    $0x8,%esp
+80108c0c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108c0f:	50                   	push   %eax
+80108c10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108c13:	50                   	push   %eax
+80108c14:	e8 19 c3 ff ff       	call   80104f32 <pipealloc>
+80108c19:	83 c4 10             	add    $0x10,%esp
+80108c1c:	85 c0                	test   %eax,%eax
+80108c1e:	78 63                	js     80108c83 <sys_pipe+0x95>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108c20:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108c23:	e8 ea f4 ff ff       	call   80108112 <fdalloc>
+80108c28:	89 c3                	mov    %eax,%ebx
+80108c2a:	85 c0                	test   %eax,%eax
+80108c2c:	78 2e                	js     80108c5c <sys_pipe+0x6e>
+80108c2e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108c31:	e8 dc f4 ff ff       	call   80108112 <fdalloc>
+80108c36:	85 c0                	test   %eax,%eax
+80108c38:	78 15                	js     80108c4f <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+80108c3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108c3d:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+80108c3f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108c42:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+80108c45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108c4d:	c9                   	leave
+80108c4e:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+80108c4f:	e8 84 cd ff ff       	call   801059d8 <myproc>
+80108c54:	c7 44 98 28 00 00 00 	movl   $0x0,0x28(%eax,%ebx,4)
+80108c5b:	00 
+    fileclose(rf);
+80108c5c:	83 ec 0c             	sub    $0xc,%esp
+80108c5f:	ff 75 f0             	push   -0x10(%ebp)
+80108c62:	e8 32 89 ff ff       	call   80101599 <fileclose>
+    fileclose(wf);
+80108c67:	83 c4 04             	add    $0x4,%esp
+80108c6a:	ff 75 ec             	push   -0x14(%ebp)
+80108c6d:	e8 27 89 ff ff       	call   80101599 <fileclose>
+    return -1;
+80108c72:	83 c4 10             	add    $0x10,%esp
+80108c75:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c7a:	eb ce                	jmp    80108c4a <sys_pipe+0x5c>
+    return -1;
+80108c7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c81:	eb c7                	jmp    80108c4a <sys_pipe+0x5c>
+    return -1;
+80108c83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c88:	eb c0                	jmp    80108c4a <sys_pipe+0x5c>
+
+80108c8a <sys_bstat>:
+
+int
+sys_bstat(void)
+{
+80108c8a:	55                   	push   %ebp
+80108c8b:	89 e5                	mov    %esp,%ebp
+80108c8d:	83 ec 1c             	sub    $0x1c,%esp
+  struct bstat *st;
+  int reset;
+
+  if(argwptr(0, (void*)&st, sizeof(*st)) < 0 || argint(1, &reset) < 0)
+80108c90:	6a 2c                	push   $0x2c
+80108c92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c95:	50                   	push   %eax
+80108c96:	6a 00                	push   $0x0
+80108c98:	e8 73 f3 ff ff       	call   80108010 <argwptr>
+80108c9d:	83 c4 10             	add    $0x10,%esp
+80108ca0:	85 c0                	test   %eax,%eax
+80108ca2:	78 28                	js     80108ccc <sys_bstat+0x42>
+80108ca4:	83 ec 08             	sub    $0x8,%esp
+80108ca7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108caa:	50                   	push   %eax
+80108cab:	6a 01                	push   $0x1
+80108cad:	e8 95 f2 ff ff       	call   80107f47 <argint>
+80108cb2:	83 c4 10             	add    $0x10,%esp
+80108cb5:	85 c0                	test   %eax,%eax
+80108cb7:	78 13                	js     80108ccc <sys_bstat+0x42>
+    return -1;
+  return getbstat(st, reset);
+80108cb9:	83 ec 08             	sub    $0x8,%esp
+80108cbc:	ff 75 f0             	push   -0x10(%ebp)
+80108cbf:	ff 75 f4             	push   -0xc(%ebp)
+80108cc2:	e8 8e 7a ff ff       	call   80100755 <getbstat>
+80108cc7:	83 c4 10             	add    $0x10,%esp
+}
+80108cca:	c9                   	leave
+80108ccb:	c3                   	ret
+    return -1;
+80108ccc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108cd1:	eb f7                	jmp    80108cca <sys_bstat+0x40>
+
+80108cd3 <sys_fork>:
+#include "proc.h"
+#include "schedstat.h"
+
+int
+sys_fork(void)
+{
+80108cd3:	55                   	push   %ebp
+80108cd4:	89 e5                	mov    %esp,%ebp
+80108cd6:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+80108cd9:	e8 0f d1 ff ff       	call   80105ded <fork>
+}
+80108cde:	c9                   	leave
+80108cdf:	c3                   	ret
+
+80108ce0 <sys_exit>:
+
+int
+sys_exit(void)
+{
+80108ce0:	55                   	push   %ebp
+80108ce1:	89 e5                	mov    %esp,%ebp
+80108ce3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108ce6:	e8 a7 d6 ff ff       	call   80106392 <exit>
+  return 0;  // not reached
+}
+80108ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+80108cf0:	c9                   	leave
+80108cf1:	c3                   	ret
+
+80108cf2 <sys_wait>:
+
+int
+sys_wait(void)
+{
+80108cf2:	55                   	push   %ebp
+80108cf3:	89 e5                	mov    %esp,%ebp
+80108cf5:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80108cf8:	e8 12 d9 ff ff       	call   8010660f <wait>
+}
+80108cfd:	c9                   	leave
+80108cfe:	c3                   	ret
+
+80108cff <sys_kill>:
+
+int
+sys_kill(void)
+{
+80108cff:	55                   	push   %ebp
+80108d00:	89 e5                	mov    %esp,%ebp
+80108d02:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108d05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d08:	50                   	push   %eax
+80108d09:	6a 00                	push   $0x0
+80108d0b:	e8 37 f2 ff ff       	call   80107f47 <argint>
+80108d10:	83 c4 10             	add    $0x10,%esp
+80108d13:	85 c0                	test   %eax,%eax
+80108d15:	78 10                	js     80108d27 <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+80108d17:	83 ec 0c             	sub    $0xc,%esp
+80108d1a:	ff 75 f4             	push   -0xc(%ebp)
+80108d1d:	e8 d3 d9 ff ff       	call   801066f5 <kill>
+80108d22:	83 c4 10             	add    $0x10,%esp
+}
+80108d25:	c9                   	leave
+80108d26:	c3                   	ret
+    return -1;
+80108d27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d2c:	eb f7                	jmp    80108d25 <sys_kill+0x26>
+
+80108d2e <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108d2e:	55                   	push   %ebp
+80108d2f:	89 e5                	mov    %esp,%ebp
+80108d31:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108d34:	e8 9f cc ff ff       	call   801059d8 <myproc>
+80108d39:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80108d3c:	c9                   	leave
+80108d3d:	c3                   	ret
+
+80108d3e <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108d3e:	55                   	push   %ebp
+80108d3f:	89 e5                	mov    %esp,%ebp
+80108d41:	53                   	push   %ebx
+80108d42:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108d45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d48:	50                   	push   %eax
+80108d49:	6a 00                	push   $0x0
+80108d4b:	e8 f7 f1 ff ff       	call   80107f47 <argint>
+80108d50:	83 c4 10             	add    $0x10,%esp
+80108d53:	85 c0                	test   %eax,%eax
+80108d55:	78 20                	js     80108d77 <sys_sbrk+0x39>
+    return -1;
+  addr = myproc()->sz;
+80108d57:	e8 7c cc ff ff       	call   801059d8 <myproc>
+80108d5c:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108d5e:	83 ec 0c             	sub    $0xc,%esp
+80108d61:	ff 75 f4             	push   -0xc(%ebp)
+80108d64:	e8 59 ce ff ff       	call   80105bc2 <growproc>
+80108d69:	83 c4 10             	add    $0x10,%esp
+80108d6c:	85 c0                	test   %eax,%eax
+80108d6e:	78 0e                	js     80108d7e <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108d70:	89 d8                	mov    %ebx,%eax
+80108d72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108d75:	c9                   	leave
+80108d76:	c3                   	ret
+    return -1;
+80108d77:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108d7c:	eb f2                	jmp    80108d70 <sys_sbrk+0x32>
+    return -1;
+80108d7e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108d83:	eb eb                	jmp    80108d70 <sys_sbrk+0x32>
+
+80108d85 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108d85:	55                   	push   %ebp
+80108d86:	89 e5                	mov    %esp,%ebp
+80108d88:	53                   	push   %ebx
+80108d89:	83 ec 1c             	sub    $0x1c,%esp
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80108d8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d8f:	50                   	push   %eax
+80108d90:	6a 00                	push   $0x0
+80108d92:	e8 b0 f1 ff ff       	call   80107f47 <argint>
+80108d97:	83 c4 10             	add    $0x10,%esp
+80108d9a:	85 c0                	test   %eax,%eax
+80108d9c:	78 75                	js     80108e13 <sys_sleep+0x8e>
+    return -1;
+  acquire(&tickslock);
+80108d9e:	83 ec 0c             	sub    $0xc,%esp
+80108da1:	68 e0 88 19 80       	push   $0x801988e0
+80108da6:	e8 72 ee ff ff       	call   80107c1d <acquire>
+  ticks0 = ticks;
+80108dab:	8b 1d c0 88 19 80    	mov    0x801988c0,%ebx
+  while(ticks - ticks0 < n){
+80108db1:	83 c4 10             	add    $0x10,%esp
+80108db4:	a1 c0 88 19 80       	mov    0x801988c0,%eax
+80108db9:	29 d8                	sub    %ebx,%eax
+80108dbb:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80108dbe:	73 39                	jae    80108df9 <sys_sleep+0x74>
+    if(myproc()->killed){
+80108dc0:	e8 13 cc ff ff       	call   801059d8 <myproc>
+80108dc5:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108dc9:	75 17                	jne    80108de2 <sys_sleep+0x5d>
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80108dcb:	83 ec 08             	sub    $0x8,%esp
+80108dce:	68 e0 88 19 80       	push   $0x801988e0
+80108dd3:	68 c0 88 19 80       	push   $0x801988c0
+80108dd8:	e8 9a d7 ff ff       	call   80106577 <sleep>
+80108ddd:	83 c4 10             	add    $0x10,%esp
+80108de0:	eb d2                	jmp    80108db4 <sys_sleep+0x2f>
+      release(&tickslock);
+80108de2:	83 ec 0c             	sub    $0xc,%esp
+80108de5:	68 e0 88 19 80       	push   $0x801988e0
+80108dea:	e8 ad ee ff ff       	call   80107c9c <release>
+      return -1;
+80108def:	83 c4 10             	add    $0x10,%esp
+80108df2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108df7:	eb 15                	jmp    80108e0e <sys_sleep+0x89>
+  }
+  release(&tickslock);
+80108df9:	83 ec 0c             	sub    $0xc,%esp
+80108dfc:	68 e0 88 19 80       	push   $0x801988e0
+80108e01:	e8 96 ee ff ff       	call   80107c9c <release>
+  return 0;
+80108e06:	83 c4 10             	add    $0x10,%esp
+80108e09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108e0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108e11:	c9                   	leave
+80108e12:	c3                   	ret
+    return -1;
+80108e13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e18:	eb f4                	jmp    80108e0e <sys_sleep+0x89>
+
+80108e1a <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80108e1a:	55                   	push   %ebp
+80108e1b:	89 e5                	mov    %esp,%ebp
+80108e1d:	53                   	push   %ebx
+80108e1e:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108e21:	68 e0 88 19 80       	push   $0x801988e0
+80108e26:	e8 f2 ed ff ff       	call   80107c1d <acquire>
+  xticks = ticks;
+80108e2b:	8b 1d c0 88 19 80    	mov    0x801988c0,%ebx
+  release(&tickslock);
+80108e31:	c7 04 24 e0 88 19 80 	movl   $0x801988e0,(%esp)
+80108e38:	e8 5f ee ff ff       	call   80107c9c <release>
+  return xticks;
+}
+80108e3d:	89 d8                	mov    %ebx,%eax
+80108e3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108e42:	c9                   	leave
+80108e43:	c3                   	ret
+
+80108e44 <sys_yield>:
+
+int
+sys_yield(void)
+{
+80108e44:	55                   	push   %ebp
+80108e45:	89 e5                	mov    %esp,%ebp
+80108e47:	83 ec 08             	sub    $0x8,%esp
+  yield();
+80108e4a:	e8 9c d6 ff ff       	call   801064eb <yield>
+  return 0;
+}
+80108e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+80108e54:	c9                   	leave
+80108e55:	c3                   	ret
+
+80108e56 <sys_shutdown>:
+
+int sys_shutdown(void)
+{
+80108e56:	55                   	push   %ebp
+80108e57:	89 e5                	mov    %esp,%ebp
+80108e59:	83 ec 08             	sub    $0x8,%esp
+  log_sync();
+80108e5c:	e8 7d b6 ff ff       	call   801044de <log_sync>
+  shutdown();
+80108e61:	e8 97 ab ff ff       	call   801039fd <shutdown>
+  return 0;
+}
+80108e66:	b8 00 00 00 00       	mov    $0x0,%eax
+80108e6b:	c9                   	leave
+80108e6c:	c3                   	ret
+
+80108e6d <sys_schedlog>:
+
+int sys_schedlog(void) {
+80108e6d:	55                   	push   %ebp
+80108e6e:	89 e5                	mov    %esp,%ebp
+80108e70:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108e73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e76:	50                   	push   %eax
+80108e77:	6a 00                	push   $0x0
+80108e79:	e8 c9 f0 ff ff       	call   80107f47 <argint>
+80108e7e:	83 c4 10             	add    $0x10,%esp
+80108e81:	85 c0                	test   %eax,%eax
+80108e83:	78 15                	js     80108e9a <sys_schedlog+0x2d>
+    return -1;
+    
+  schedlog(n);
+80108e85:	83 ec 0c             	sub    $0xc,%esp
+80108e88:	ff 75 f4             	push   -0xc(%ebp)
+80108e8b:	e8 b7 d0 ff ff       	call   80105f47 <schedlog>
+  return 0;
+80108e90:	83 c4 10             	add    $0x10,%esp
+80108e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108e98:	c9                   	leave
+80108e99:	c3                   	ret
+    return -1;
+80108e9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e9f:	eb f7                	jmp    80108e98 <sys_schedlog+0x2b>
+
+80108ea1 <sys_nicefork>:
+
+int sys_nicefork(void) {
+80108ea1:	55                   	push   %ebp
+80108ea2:	89 e5                	mov    %esp,%ebp
+80108ea4:	83 ec 20             	sub    $0x20,%esp
+  int nice;
+
+  if(argint(0, &nice) < 0)
+80108ea7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108eaa:	50                   	push   %eax
+80108eab:	6a 00                	push   $0x0
+80108ead:	e8 95 f0 ff ff       	call   80107f47 <argint>
+80108eb2:	83 c4 10             	add    $0x10,%esp
+80108eb5:	85 c0                	test   %eax,%eax
+80108eb7:	78 10                	js     80108ec9 <sys_nicefork+0x28>
+    return -1;
+  return nicefork(nice);
+80108eb9:	83 ec 0c             	sub    $0xc,%esp
+80108ebc:	ff 75 f4             	push   -0xc(%ebp)
+80108ebf:	e8 6e cd ff ff       	call   80105c32 <nicefork>
+80108ec4:	83 c4 10             	add    $0x10,%esp
+}
+80108ec7:	c9                   	leave
+80108ec8:	c3                   	ret
+    return -1;
+80108ec9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ece:	eb f7                	jmp    80108ec7 <sys_nicefork+0x26>
+
+80108ed0 <sys_schedstat>:
+
+int sys_schedstat(void) {
+80108ed0:	55                   	push   %ebp
+80108ed1:	89 e5                	mov    %esp,%ebp
+80108ed3:	83 ec 1c             	sub    $0x1c,%esp
+  struct schedstat *st;
+  int reset;
+
+  if(argwptr(0, (void*)&st, sizeof(*st)) < 0 || argint(1, &reset) < 0)
+80108ed6:	68 84 01 00 00       	push   $0x184
+80108edb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ede:	50                   	push   %eax
+80108edf:	6a 00                	push   $0x0
+80108ee1:	e8 2a f1 ff ff       	call   80108010 <argwptr>
+80108ee6:	83 c4 10             	add    $0x10,%esp
+80108ee9:	85 c0                	test   %eax,%eax
+80108eeb:	78 28                	js     80108f15 <sys_schedstat+0x45>
+80108eed:	83 ec 08             	sub    $0x8,%esp
+80108ef0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108ef3:	50                   	push   %eax
+80108ef4:	6a 01                	push   $0x1
+80108ef6:	e8 4c f0 ff ff       	call   80107f47 <argint>
+80108efb:	83 c4 10             	add    $0x10,%esp
+80108efe:	85 c0                	test   %eax,%eax
+80108f00:	78 13                	js     80108f15 <sys_schedstat+0x45>
+    return -1;
+  return getschedstat(st, reset);
+80108f02:	83 ec 08             	sub    $0x8,%esp
+80108f05:	ff 75 f0             	push   -0x10(%ebp)
+80108f08:	ff 75 f4             	push   -0xc(%ebp)
+80108f0b:	e8 a4 d0 ff ff       	call   80105fb4 <getschedstat>
+80108f10:	83 c4 10             	add    $0x10,%esp
+}
+80108f13:	c9                   	leave
+80108f14:	c3                   	ret
+    return -1;
+80108f15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108f1a:	eb f7                	jmp    80108f13 <sys_schedstat+0x43>
+
+80108f1c <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80108f1c:	1e                   	push   %ds
+  pushl %es
+80108f1d:	06                   	push   %es
+  pushl %fs
+80108f1e:	0f a0                	push   %fs
+  pushl %gs
+80108f20:	0f a8                	push   %gs
+  pushal
+80108f22:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80108f23:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80108f27:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80108f29:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80108f2b:	54                   	push   %esp
+  call trap
+80108f2c:	e8 37 01 00 00       	call   80109068 <trap>
+  addl $4, %esp
+80108f31:	83 c4 04             	add    $0x4,%esp
+
+80108f34 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80108f34:	61                   	popa
+  popl %gs
+80108f35:	0f a9                	pop    %gs
+  popl %fs
+80108f37:	0f a1                	pop    %fs
+  popl %es
+80108f39:	07                   	pop    %es
+  popl %ds
+80108f3a:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80108f3b:	83 c4 08             	add    $0x8,%esp
+  iret
+80108f3e:	cf                   	iret
+
+80108f3f <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+80108f3f:	55                   	push   %ebp
+80108f40:	89 e5                	mov    %esp,%ebp
+80108f42:	53                   	push   %ebx
+80108f43:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80108f46:	b8 00 00 00 00       	mov    $0x0,%eax
+80108f4b:	eb 76                	jmp    80108fc3 <tvinit+0x84>
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80108f4d:	8b 0c 85 64 f5 10 80 	mov    -0x7fef0a9c(,%eax,4),%ecx
+80108f54:	66 89 0c c5 40 89 19 	mov    %cx,-0x7fe676c0(,%eax,8)
+80108f5b:	80 
+80108f5c:	66 c7 04 c5 42 89 19 	movw   $0x8,-0x7fe676be(,%eax,8)
+80108f63:	80 08 00 
+80108f66:	0f b6 14 c5 44 89 19 	movzbl -0x7fe676bc(,%eax,8),%edx
+80108f6d:	80 
+80108f6e:	83 e2 e0             	and    $0xffffffe0,%edx
+80108f71:	88 14 c5 44 89 19 80 	mov    %dl,-0x7fe676bc(,%eax,8)
+80108f78:	c6 04 c5 44 89 19 80 	movb   $0x0,-0x7fe676bc(,%eax,8)
+80108f7f:	00 
+80108f80:	0f b6 14 c5 45 89 19 	movzbl -0x7fe676bb(,%eax,8),%edx
+80108f87:	80 
+80108f88:	83 e2 f0             	and    $0xfffffff0,%edx
+80108f8b:	83 ca 0e             	or     $0xe,%edx
+80108f8e:	88 14 c5 45 89 19 80 	mov    %dl,-0x7fe676bb(,%eax,8)
+80108f95:	89 d3                	mov    %edx,%ebx
+80108f97:	83 e3 ef             	and    $0xffffffef,%ebx
+80108f9a:	88 1c c5 45 89 19 80 	mov    %bl,-0x7fe676bb(,%eax,8)
+80108fa1:	83 e2 8f             	and    $0xffffff8f,%edx
+80108fa4:	88 14 c5 45 89 19 80 	mov    %dl,-0x7fe676bb(,%eax,8)
+80108fab:	83 ca 80             	or     $0xffffff80,%edx
+80108fae:	88 14 c5 45 89 19 80 	mov    %dl,-0x7fe676bb(,%eax,8)
+80108fb5:	c1 e9 10             	shr    $0x10,%ecx
+80108fb8:	66 89 0c c5 46 89 19 	mov    %cx,-0x7fe676ba(,%eax,8)
+80108fbf:	80 
+  for(i = 0; i < 256; i++)
+80108fc0:	83 c0 01             	add    $0x1,%eax
+80108fc3:	3d ff 00 00 00       	cmp    $0xff,%eax
+80108fc8:	7e 83                	jle    80108f4d <tvinit+0xe>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80108fca:	8b 15 64 f6 10 80    	mov    0x8010f664,%edx
+80108fd0:	66 89 15 40 8b 19 80 	mov    %dx,0x80198b40
+80108fd7:	66 c7 05 42 8b 19 80 	movw   $0x8,0x80198b42
+80108fde:	08 00 
+80108fe0:	0f b6 05 44 8b 19 80 	movzbl 0x80198b44,%eax
+80108fe7:	83 e0 e0             	and    $0xffffffe0,%eax
+80108fea:	a2 44 8b 19 80       	mov    %al,0x80198b44
+80108fef:	c6 05 44 8b 19 80 00 	movb   $0x0,0x80198b44
+80108ff6:	0f b6 05 45 8b 19 80 	movzbl 0x80198b45,%eax
+80108ffd:	83 c8 0f             	or     $0xf,%eax
+80109000:	a2 45 8b 19 80       	mov    %al,0x80198b45
+80109005:	83 e0 ef             	and    $0xffffffef,%eax
+80109008:	a2 45 8b 19 80       	mov    %al,0x80198b45
+8010900d:	89 c1                	mov    %eax,%ecx
+8010900f:	83 c9 60             	or     $0x60,%ecx
+80109012:	88 0d 45 8b 19 80    	mov    %cl,0x80198b45
+80109018:	83 c8 e0             	or     $0xffffffe0,%eax
+8010901b:	a2 45 8b 19 80       	mov    %al,0x80198b45
+80109020:	c1 ea 10             	shr    $0x10,%edx
+80109023:	66 89 15 46 8b 19 80 	mov    %dx,0x80198b46
+
+  initlock(&tickslock, "time");
+8010902a:	83 ec 08             	sub    $0x8,%esp
+8010902d:	68 75 be 10 80       	push   $0x8010be75
+80109032:	68 e0 88 19 80       	push   $0x801988e0
+80109037:	e8 96 ea ff ff       	call   80107ad2 <initlock>
+}
+8010903c:	83 c4 10             	add    $0x10,%esp
+8010903f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109042:	c9                   	leave
+80109043:	c3                   	ret
+
+80109044 <idtinit>:
+
+void
+idtinit(void)
+{
+80109044:	55                   	push   %ebp
+80109045:	89 e5                	mov    %esp,%ebp
+80109047:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+8010904a:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+80109050:	b8 40 89 19 80       	mov    $0x80198940,%eax
+80109055:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109059:	c1 e8 10             	shr    $0x10,%eax
+8010905c:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80109060:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109063:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109066:	c9                   	leave
+80109067:	c3                   	ret
+
+80109068 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109068:	55                   	push   %ebp
+80109069:	89 e5                	mov    %esp,%ebp
+8010906b:	57                   	push   %edi
+8010906c:	56                   	push   %esi
+8010906d:	53                   	push   %ebx
+8010906e:	83 ec 1c             	sub    $0x1c,%esp
+80109071:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80109074:	8b 43 30             	mov    0x30(%ebx),%eax
+80109077:	83 f8 40             	cmp    $0x40,%eax
+8010907a:	74 13                	je     8010908f <trap+0x27>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+8010907c:	83 e8 0e             	sub    $0xe,%eax
+8010907f:	83 f8 31             	cmp    $0x31,%eax
+80109082:	0f 87 04 01 00 00    	ja     8010918c <trap+0x124>
+80109088:	ff 24 85 1c bf 10 80 	jmp    *-0x7fef40e4(,%eax,4)
+    if(myproc()->killed)
+8010908f:	e8 44 c9 ff ff       	call   801059d8 <myproc>
+80109094:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80109098:	75 26                	jne    801090c0 <trap+0x58>
+    myproc()->tf = tf;
+8010909a:	e8 39 c9 ff ff       	call   801059d8 <myproc>
+8010909f:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+801090a2:	e8 b4 ef ff ff       	call   8010805b <syscall>
+    if(myproc()->killed)
+801090a7:	e8 2c c9 ff ff       	call   801059d8 <myproc>
+801090ac:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+801090b0:	0f 84 97 01 00 00    	je     8010924d <trap+0x1e5>
+      exit();
+801090b6:	e8 d7 d2 ff ff       	call   80106392 <exit>
+    return;
+801090bb:	e9 8d 01 00 00       	jmp    8010924d <trap+0x1e5>
+      exit();
+801090c0:	e8 cd d2 ff ff       	call   80106392 <exit>
+801090c5:	eb d3                	jmp    8010909a <trap+0x32>
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+801090c7:	e8 f1 c8 ff ff       	call   801059bd <cpuid>
+801090cc:	85 c0                	test   %eax,%eax
+801090ce:	74 0f                	je     801090df <trap+0x77>
+      acquire(&tickslock);
+      ticks++;
+      wakeup(&ticks);
+      release(&tickslock);
+    }
+    schedtick();
+801090d0:	e8 8e ce ff ff       	call   80105f63 <schedtick>
+    lapiceoi();
+801090d5:	e8 d0 aa ff ff       	call   80103baa <lapiceoi>
+    break;
+801090da:	e9 18 01 00 00       	jmp    801091f7 <trap+0x18f>
+      acquire(&tickslock);
+801090df:	83 ec 0c             	sub    $0xc,%esp
+801090e2:	68 e0 88 19 80       	push   $0x801988e0
+801090e7:	e8 31 eb ff ff       	call   80107c1d <acquire>
+      ticks++;
+801090ec:	83 05 c0 88 19 80 01 	addl   $0x1,0x801988c0
+      wakeup(&ticks);
+801090f3:	c7 04 24 c0 88 19 80 	movl   $0x801988c0,(%esp)
+801090fa:	e8 cd d5 ff ff       	call   801066cc <wakeup>
+      release(&tickslock);
+801090ff:	c7 04 24 e0 88 19 80 	movl   $0x801988e0,(%esp)
+80109106:	e8 91 eb ff ff       	call   80107c9c <release>
+8010910b:	83 c4 10             	add    $0x10,%esp
+8010910e:	eb c0                	jmp    801090d0 <trap+0x68>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109110:	e8 df 9e ff ff       	call   80102ff4 <ideintr>
+    lapiceoi();
+80109115:	e8 90 aa ff ff       	call   80103baa <lapiceoi>
+    break;
+8010911a:	e9 d8 00 00 00       	jmp    801091f7 <trap+0x18f>
+  case T_IRQ0 + IRQ_IDE+1:
+    // Bochs generates spurious IDE1 interrupts.
+    break;
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+8010911f:	e8 c4 a8 ff ff       	call   801039e8 <kbdintr>
+    lapiceoi();
+80109124:	e8 81 aa ff ff       	call   80103baa <lapiceoi>
+    break;
+80109129:	e9 c9 00 00 00       	jmp    801091f7 <trap+0x18f>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+8010912e:	e8 90 02 00 00       	call   801093c3 <uartintr>
+    lapiceoi();
+80109133:	e8 72 aa ff ff       	call   80103baa <lapiceoi>
+    break;
+80109138:	e9 ba 00 00 00       	jmp    801091f7 <trap+0x18f>
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+8010913d:	8b 7b 38             	mov    0x38(%ebx),%edi
+            cpuid(), tf->cs, tf->eip);
+80109140:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109144:	e8 74 c8 ff ff       	call   801059bd <cpuid>
+80109149:	57                   	push   %edi
+8010914a:	0f b7 f6             	movzwl %si,%esi
+8010914d:	56                   	push   %esi
+8010914e:	50                   	push   %eax
+8010914f:	68 80 be 10 80       	push   $0x8010be80
+80109154:	e8 a0 7b ff ff       	call   80100cf9 <cprintf>
+    lapiceoi();
+80109159:	e8 4c aa ff ff       	call   80103baa <lapiceoi>
+    break;
+8010915e:	83 c4 10             	add    $0x10,%esp
+80109161:	e9 91 00 00 00       	jmp    801091f7 <trap+0x18f>
+
+  case T_PGFLT:
+    // Copy-on-write and demand-zero pages, touched from user
+    // space or by the kernel on the process's behalf (CR0_WP
+    // is set, so kernel writes to read-only pages fault too).
+    if(myproc() && pgfault(myproc(), rcr2(), tf->err) == 0)
+80109166:	e8 6d c8 ff ff       	call   801059d8 <myproc>
+8010916b:	85 c0                	test   %eax,%eax
+8010916d:	74 1d                	je     8010918c <trap+0x124>
+8010916f:	8b 7b 34             	mov    0x34(%ebx),%edi
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109172:	0f 20 d6             	mov    %cr2,%esi
+80109175:	e8 5e c8 ff ff       	call   801059d8 <myproc>
+8010917a:	83 ec 04             	sub    $0x4,%esp
+8010917d:	57                   	push   %edi
+8010917e:	56                   	push   %esi
+8010917f:	50                   	push   %eax
+80109180:	e8 c1 18 00 00       	call   8010aa46 <pgfault>
+80109185:	83 c4 10             	add    $0x10,%esp
+80109188:	85 c0                	test   %eax,%eax
+8010918a:	74 6b                	je     801091f7 <trap+0x18f>
+      break;
+    // Otherwise a real fault: fall through.
+
+  //PAGEBREAK: 13
+  default:
+    if(myproc() == 0 || (tf->cs&3) == 0){
+8010918c:	e8 47 c8 ff ff       	call   801059d8 <myproc>
+80109191:	85 c0                	test   %eax,%eax
+80109193:	0f 84 bc 00 00 00    	je     80109255 <trap+0x1ed>
+80109199:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+8010919d:	0f 84 b2 00 00 00    	je     80109255 <trap+0x1ed>
+801091a3:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801091a6:	8b 43 38             	mov    0x38(%ebx),%eax
+801091a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801091ac:	e8 0c c8 ff ff       	call   801059bd <cpuid>
+801091b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801091b4:	8b 4b 34             	mov    0x34(%ebx),%ecx
+801091b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801091ba:	8b 73 30             	mov    0x30(%ebx),%esi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+801091bd:	e8 16 c8 ff ff       	call   801059d8 <myproc>
+801091c2:	8d 50 6c             	lea    0x6c(%eax),%edx
+801091c5:	89 55 d8             	mov    %edx,-0x28(%ebp)
+801091c8:	e8 0b c8 ff ff       	call   801059d8 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801091cd:	57                   	push   %edi
+801091ce:	ff 75 e4             	push   -0x1c(%ebp)
+801091d1:	ff 75 e0             	push   -0x20(%ebp)
+801091d4:	ff 75 dc             	push   -0x24(%ebp)
+801091d7:	56                   	push   %esi
+801091d8:	ff 75 d8             	push   -0x28(%ebp)
+801091db:	ff 70 10             	push   0x10(%eax)
+801091de:	68 d8 be 10 80       	push   $0x8010bed8
+801091e3:	e8 11 7b ff ff       	call   80100cf9 <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+801091e8:	83 c4 20             	add    $0x20,%esp
+801091eb:	e8 e8 c7 ff ff       	call   801059d8 <myproc>
+801091f0:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801091f7:	e8 dc c7 ff ff       	call   801059d8 <myproc>
+801091fc:	85 c0                	test   %eax,%eax
+801091fe:	74 18                	je     80109218 <trap+0x1b0>
+80109200:	e8 d3 c7 ff ff       	call   801059d8 <myproc>
+80109205:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80109209:	74 0d                	je     80109218 <trap+0x1b0>
+8010920b:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+8010920f:	83 e0 03             	and    $0x3,%eax
+80109212:	66 83 f8 03          	cmp    $0x3,%ax
+80109216:	74 68                	je     80109280 <trap+0x218>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109218:	e8 bb c7 ff ff       	call   801059d8 <myproc>
+8010921d:	85 c0                	test   %eax,%eax
+8010921f:	74 0b                	je     8010922c <trap+0x1c4>
+80109221:	e8 b2 c7 ff ff       	call   801059d8 <myproc>
+80109226:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+8010922a:	74 5b                	je     80109287 <trap+0x21f>
+     tf->trapno == T_IRQ0+IRQ_TIMER)
+    if (--myproc()->ticks_left == 0) yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010922c:	e8 a7 c7 ff ff       	call   801059d8 <myproc>
+80109231:	85 c0                	test   %eax,%eax
+80109233:	74 18                	je     8010924d <trap+0x1e5>
+80109235:	e8 9e c7 ff ff       	call   801059d8 <myproc>
+8010923a:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+8010923e:	74 0d                	je     8010924d <trap+0x1e5>
+80109240:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109244:	83 e0 03             	and    $0x3,%eax
+80109247:	66 83 f8 03          	cmp    $0x3,%ax
+8010924b:	74 5f                	je     801092ac <trap+0x244>
+    exit();
+}
+8010924d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109250:	5b                   	pop    %ebx
+80109251:	5e                   	pop    %esi
+80109252:	5f                   	pop    %edi
+80109253:	5d                   	pop    %ebp
+80109254:	c3                   	ret
+80109255:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109258:	8b 73 38             	mov    0x38(%ebx),%esi
+8010925b:	e8 5d c7 ff ff       	call   801059bd <cpuid>
+80109260:	83 ec 0c             	sub    $0xc,%esp
+80109263:	57                   	push   %edi
+80109264:	56                   	push   %esi
+80109265:	50                   	push   %eax
+80109266:	ff 73 30             	push   0x30(%ebx)
+80109269:	68 a4 be 10 80       	push   $0x8010bea4
+8010926e:	e8 86 7a ff ff       	call   80100cf9 <cprintf>
+      panic("trap");
+80109273:	83 c4 14             	add    $0x14,%esp
+80109276:	68 7a be 10 80       	push   $0x8010be7a
+8010927b:	e8 82 76 ff ff       	call   80100902 <panic>
+    exit();
+80109280:	e8 0d d1 ff ff       	call   80106392 <exit>
+80109285:	eb 91                	jmp    80109218 <trap+0x1b0>
+  if(myproc() && myproc()->state == RUNNING &&
+80109287:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+8010928b:	75 9f                	jne    8010922c <trap+0x1c4>
+    if (--myproc()->ticks_left == 0) yield();
+8010928d:	e8 46 c7 ff ff       	call   801059d8 <myproc>
+80109292:	8b 88 84 00 00 00    	mov    0x84(%eax),%ecx
+80109298:	8d 51 ff             	lea    -0x1(%ecx),%edx
+8010929b:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+801092a1:	85 d2                	test   %edx,%edx
+801092a3:	75 87                	jne    8010922c <trap+0x1c4>
+801092a5:	e8 41 d2 ff ff       	call   801064eb <yield>
+801092aa:	eb 80                	jmp    8010922c <trap+0x1c4>
+    exit();
+801092ac:	e8 e1 d0 ff ff       	call   80106392 <exit>
+801092b1:	eb 9a                	jmp    8010924d <trap+0x1e5>
+
+801092b3 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+801092b3:	83 3d 40 91 19 80 00 	cmpl   $0x0,0x80199140
+801092ba:	74 14                	je     801092d0 <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801092bc:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801092c1:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+801092c2:	a8 01                	test   $0x1,%al
+801092c4:	74 10                	je     801092d6 <uartgetc+0x23>
+801092c6:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801092cb:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+801092cc:	0f b6 c0             	movzbl %al,%eax
+801092cf:	c3                   	ret
+    return -1;
+801092d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801092d5:	c3                   	ret
+    return -1;
+801092d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801092db:	c3                   	ret
+
+801092dc <uartputc>:
+  if(!uart)
+801092dc:	83 3d 40 91 19 80 00 	cmpl   $0x0,0x80199140
+801092e3:	74 3b                	je     80109320 <uartputc+0x44>
+{
+801092e5:	55                   	push   %ebp
+801092e6:	89 e5                	mov    %esp,%ebp
+801092e8:	53                   	push   %ebx
+801092e9:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801092ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+801092f1:	eb 10                	jmp    80109303 <uartputc+0x27>
+    microdelay(10);
+801092f3:	83 ec 0c             	sub    $0xc,%esp
+801092f6:	6a 0a                	push   $0xa
+801092f8:	e8 ce a8 ff ff       	call   80103bcb <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801092fd:	83 c3 01             	add    $0x1,%ebx
+80109300:	83 c4 10             	add    $0x10,%esp
+80109303:	83 fb 7f             	cmp    $0x7f,%ebx
+80109306:	7f 0a                	jg     80109312 <uartputc+0x36>
+80109308:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010930d:	ec                   	in     (%dx),%al
+8010930e:	a8 20                	test   $0x20,%al
+80109310:	74 e1                	je     801092f3 <uartputc+0x17>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109312:	8b 45 08             	mov    0x8(%ebp),%eax
+80109315:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010931a:	ee                   	out    %al,(%dx)
+}
+8010931b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010931e:	c9                   	leave
+8010931f:	c3                   	ret
+80109320:	c3                   	ret
+
+80109321 <uartinit>:
+{
+80109321:	55                   	push   %ebp
+80109322:	89 e5                	mov    %esp,%ebp
+80109324:	56                   	push   %esi
+80109325:	53                   	push   %ebx
+80109326:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010932b:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109330:	89 c8                	mov    %ecx,%eax
+80109332:	ee                   	out    %al,(%dx)
+80109333:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109338:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010933d:	89 f2                	mov    %esi,%edx
+8010933f:	ee                   	out    %al,(%dx)
+80109340:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109345:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010934a:	ee                   	out    %al,(%dx)
+8010934b:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109350:	89 c8                	mov    %ecx,%eax
+80109352:	89 da                	mov    %ebx,%edx
+80109354:	ee                   	out    %al,(%dx)
+80109355:	b8 03 00 00 00       	mov    $0x3,%eax
+8010935a:	89 f2                	mov    %esi,%edx
+8010935c:	ee                   	out    %al,(%dx)
+8010935d:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109362:	89 c8                	mov    %ecx,%eax
+80109364:	ee                   	out    %al,(%dx)
+80109365:	b8 01 00 00 00       	mov    $0x1,%eax
+8010936a:	89 da                	mov    %ebx,%edx
+8010936c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010936d:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109372:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109373:	3c ff                	cmp    $0xff,%al
+80109375:	74 45                	je     801093bc <uartinit+0x9b>
+  uart = 1;
+80109377:	c7 05 40 91 19 80 01 	movl   $0x1,0x80199140
+8010937e:	00 00 00 
+80109381:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109386:	ec                   	in     (%dx),%al
+80109387:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010938c:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+8010938d:	83 ec 08             	sub    $0x8,%esp
+80109390:	6a 00                	push   $0x0
+80109392:	6a 04                	push   $0x4
+80109394:	e8 99 9f ff ff       	call   80103332 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109399:	83 c4 10             	add    $0x10,%esp
+8010939c:	bb e4 bf 10 80       	mov    $0x8010bfe4,%ebx
+801093a1:	eb 12                	jmp    801093b5 <uartinit+0x94>
+    uartputc(*p);
+801093a3:	83 ec 0c             	sub    $0xc,%esp
+801093a6:	0f be c0             	movsbl %al,%eax
+801093a9:	50                   	push   %eax
+801093aa:	e8 2d ff ff ff       	call   801092dc <uartputc>
+  for(p="xv6...\n"; *p; p++)
+801093af:	83 c3 01             	add    $0x1,%ebx
+801093b2:	83 c4 10             	add    $0x10,%esp
+801093b5:	0f b6 03             	movzbl (%ebx),%eax
+801093b8:	84 c0                	test   %al,%al
+801093ba:	75 e7                	jne    801093a3 <uartinit+0x82>
+}
+801093bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801093bf:	5b                   	pop    %ebx
+801093c0:	5e                   	pop    %esi
+801093c1:	5d                   	pop    %ebp
+801093c2:	c3                   	ret
+
+801093c3 <uartintr>:
+
+void
+uartintr(void)
+{
+801093c3:	55                   	push   %ebp
+801093c4:	89 e5                	mov    %esp,%ebp
+801093c6:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+801093c9:	68 b3 92 10 80       	push   $0x801092b3
+801093ce:	e8 52 7a ff ff       	call   80100e25 <consoleintr>
+}
+801093d3:	83 c4 10             	add    $0x10,%esp
+801093d6:	c9                   	leave
+801093d7:	c3                   	ret
+
+801093d8 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+801093d8:	6a 00                	push   $0x0
+  pushl $0
+801093da:	6a 00                	push   $0x0
+  jmp alltraps
+801093dc:	e9 3b fb ff ff       	jmp    80108f1c <alltraps>
+
+801093e1 <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+801093e1:	6a 00                	push   $0x0
+  pushl $1
+801093e3:	6a 01                	push   $0x1
+  jmp alltraps
+801093e5:	e9 32 fb ff ff       	jmp    80108f1c <alltraps>
+
+801093ea <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+801093ea:	6a 00                	push   $0x0
+  pushl $2
+801093ec:	6a 02                	push   $0x2
+  jmp alltraps
+801093ee:	e9 29 fb ff ff       	jmp    80108f1c <alltraps>
+
+801093f3 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+801093f3:	6a 00                	push   $0x0
+  pushl $3
+801093f5:	6a 03                	push   $0x3
+  jmp alltraps
+801093f7:	e9 20 fb ff ff       	jmp    80108f1c <alltraps>
+
+801093fc <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+801093fc:	6a 00                	push   $0x0
+  pushl $4
+801093fe:	6a 04                	push   $0x4
+  jmp alltraps
+80109400:	e9 17 fb ff ff       	jmp    80108f1c <alltraps>
+
+80109405 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109405:	6a 00                	push   $0x0
+  pushl $5
+80109407:	6a 05                	push   $0x5
+  jmp alltraps
+80109409:	e9 0e fb ff ff       	jmp    80108f1c <alltraps>
+
+8010940e <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010940e:	6a 00                	push   $0x0
+  pushl $6
+80109410:	6a 06                	push   $0x6
+  jmp alltraps
+80109412:	e9 05 fb ff ff       	jmp    80108f1c <alltraps>
+
+80109417 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109417:	6a 00                	push   $0x0
+  pushl $7
+80109419:	6a 07                	push   $0x7
+  jmp alltraps
+8010941b:	e9 fc fa ff ff       	jmp    80108f1c <alltraps>
+
+80109420 <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109420:	6a 08                	push   $0x8
+  jmp alltraps
+80109422:	e9 f5 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109427 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109427:	6a 00                	push   $0x0
+  pushl $9
+80109429:	6a 09                	push   $0x9
+  jmp alltraps
+8010942b:	e9 ec fa ff ff       	jmp    80108f1c <alltraps>
+
+80109430 <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109430:	6a 0a                	push   $0xa
+  jmp alltraps
+80109432:	e9 e5 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109437 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109437:	6a 0b                	push   $0xb
+  jmp alltraps
+80109439:	e9 de fa ff ff       	jmp    80108f1c <alltraps>
+
+8010943e <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010943e:	6a 0c                	push   $0xc
+  jmp alltraps
+80109440:	e9 d7 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109445 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109445:	6a 0d                	push   $0xd
+  jmp alltraps
+80109447:	e9 d0 fa ff ff       	jmp    80108f1c <alltraps>
+
+8010944c <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+8010944c:	6a 0e                	push   $0xe
+  jmp alltraps
+8010944e:	e9 c9 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109453 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109453:	6a 00                	push   $0x0
+  pushl $15
+80109455:	6a 0f                	push   $0xf
+  jmp alltraps
+80109457:	e9 c0 fa ff ff       	jmp    80108f1c <alltraps>
+
+8010945c <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+8010945c:	6a 00                	push   $0x0
+  pushl $16
+8010945e:	6a 10                	push   $0x10
+  jmp alltraps
+80109460:	e9 b7 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109465 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109465:	6a 11                	push   $0x11
+  jmp alltraps
+80109467:	e9 b0 fa ff ff       	jmp    80108f1c <alltraps>
+
+8010946c <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+8010946c:	6a 00                	push   $0x0
+  pushl $18
+8010946e:	6a 12                	push   $0x12
+  jmp alltraps
+80109470:	e9 a7 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109475 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109475:	6a 00                	push   $0x0
+  pushl $19
+80109477:	6a 13                	push   $0x13
+  jmp alltraps
+80109479:	e9 9e fa ff ff       	jmp    80108f1c <alltraps>
+
+8010947e <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010947e:	6a 00                	push   $0x0
+  pushl $20
+80109480:	6a 14                	push   $0x14
+  jmp alltraps
+80109482:	e9 95 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109487 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109487:	6a 00                	push   $0x0
+  pushl $21
+80109489:	6a 15                	push   $0x15
+  jmp alltraps
+8010948b:	e9 8c fa ff ff       	jmp    80108f1c <alltraps>
+
+80109490 <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109490:	6a 00                	push   $0x0
+  pushl $22
+80109492:	6a 16                	push   $0x16
+  jmp alltraps
+80109494:	e9 83 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109499 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109499:	6a 00                	push   $0x0
+  pushl $23
+8010949b:	6a 17                	push   $0x17
+  jmp alltraps
+8010949d:	e9 7a fa ff ff       	jmp    80108f1c <alltraps>
+
+801094a2 <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+801094a2:	6a 00                	push   $0x0
+  pushl $24
+801094a4:	6a 18                	push   $0x18
+  jmp alltraps
+801094a6:	e9 71 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094ab <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+801094ab:	6a 00                	push   $0x0
+  pushl $25
+801094ad:	6a 19                	push   $0x19
+  jmp alltraps
+801094af:	e9 68 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094b4 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+801094b4:	6a 00                	push   $0x0
+  pushl $26
+801094b6:	6a 1a                	push   $0x1a
+  jmp alltraps
+801094b8:	e9 5f fa ff ff       	jmp    80108f1c <alltraps>
+
+801094bd <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+801094bd:	6a 00                	push   $0x0
+  pushl $27
+801094bf:	6a 1b                	push   $0x1b
+  jmp alltraps
+801094c1:	e9 56 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094c6 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+801094c6:	6a 00                	push   $0x0
+  pushl $28
+801094c8:	6a 1c                	push   $0x1c
+  jmp alltraps
+801094ca:	e9 4d fa ff ff       	jmp    80108f1c <alltraps>
+
+801094cf <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+801094cf:	6a 00                	push   $0x0
+  pushl $29
+801094d1:	6a 1d                	push   $0x1d
+  jmp alltraps
+801094d3:	e9 44 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094d8 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+801094d8:	6a 00                	push   $0x0
+  pushl $30
+801094da:	6a 1e                	push   $0x1e
+  jmp alltraps
+801094dc:	e9 3b fa ff ff       	jmp    80108f1c <alltraps>
+
+801094e1 <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+801094e1:	6a 00                	push   $0x0
+  pushl $31
+801094e3:	6a 1f                	push   $0x1f
+  jmp alltraps
+801094e5:	e9 32 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094ea <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+801094ea:	6a 00                	push   $0x0
+  pushl $32
+801094ec:	6a 20                	push   $0x20
+  jmp alltraps
+801094ee:	e9 29 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094f3 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+801094f3:	6a 00                	push   $0x0
+  pushl $33
+801094f5:	6a 21                	push   $0x21
+  jmp alltraps
+801094f7:	e9 20 fa ff ff       	jmp    80108f1c <alltraps>
+
+801094fc <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+801094fc:	6a 00                	push   $0x0
+  pushl $34
+801094fe:	6a 22                	push   $0x22
+  jmp alltraps
+80109500:	e9 17 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109505 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109505:	6a 00                	push   $0x0
+  pushl $35
+80109507:	6a 23                	push   $0x23
+  jmp alltraps
+80109509:	e9 0e fa ff ff       	jmp    80108f1c <alltraps>
+
+8010950e <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010950e:	6a 00                	push   $0x0
+  pushl $36
+80109510:	6a 24                	push   $0x24
+  jmp alltraps
+80109512:	e9 05 fa ff ff       	jmp    80108f1c <alltraps>
+
+80109517 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109517:	6a 00                	push   $0x0
+  pushl $37
+80109519:	6a 25                	push   $0x25
+  jmp alltraps
+8010951b:	e9 fc f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109520 <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109520:	6a 00                	push   $0x0
+  pushl $38
+80109522:	6a 26                	push   $0x26
+  jmp alltraps
+80109524:	e9 f3 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109529 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109529:	6a 00                	push   $0x0
+  pushl $39
+8010952b:	6a 27                	push   $0x27
+  jmp alltraps
+8010952d:	e9 ea f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109532 <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80109532:	6a 00                	push   $0x0
+  pushl $40
+80109534:	6a 28                	push   $0x28
+  jmp alltraps
+80109536:	e9 e1 f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010953b <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010953b:	6a 00                	push   $0x0
+  pushl $41
+8010953d:	6a 29                	push   $0x29
+  jmp alltraps
+8010953f:	e9 d8 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109544 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109544:	6a 00                	push   $0x0
+  pushl $42
+80109546:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109548:	e9 cf f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010954d <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010954d:	6a 00                	push   $0x0
+  pushl $43
+8010954f:	6a 2b                	push   $0x2b
+  jmp alltraps
+80109551:	e9 c6 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109556 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109556:	6a 00                	push   $0x0
+  pushl $44
+80109558:	6a 2c                	push   $0x2c
+  jmp alltraps
+8010955a:	e9 bd f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010955f <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010955f:	6a 00                	push   $0x0
+  pushl $45
+80109561:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109563:	e9 b4 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109568 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109568:	6a 00                	push   $0x0
+  pushl $46
+8010956a:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010956c:	e9 ab f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109571 <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80109571:	6a 00                	push   $0x0
+  pushl $47
+80109573:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109575:	e9 a2 f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010957a <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+8010957a:	6a 00                	push   $0x0
+  pushl $48
+8010957c:	6a 30                	push   $0x30
+  jmp alltraps
+8010957e:	e9 99 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109583 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109583:	6a 00                	push   $0x0
+  pushl $49
+80109585:	6a 31                	push   $0x31
+  jmp alltraps
+80109587:	e9 90 f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010958c <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010958c:	6a 00                	push   $0x0
+  pushl $50
+8010958e:	6a 32                	push   $0x32
+  jmp alltraps
+80109590:	e9 87 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109595 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109595:	6a 00                	push   $0x0
+  pushl $51
+80109597:	6a 33                	push   $0x33
+  jmp alltraps
+80109599:	e9 7e f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010959e <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010959e:	6a 00                	push   $0x0
+  pushl $52
+801095a0:	6a 34                	push   $0x34
+  jmp alltraps
+801095a2:	e9 75 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095a7 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+801095a7:	6a 00                	push   $0x0
+  pushl $53
+801095a9:	6a 35                	push   $0x35
+  jmp alltraps
+801095ab:	e9 6c f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095b0 <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+801095b0:	6a 00                	push   $0x0
+  pushl $54
+801095b2:	6a 36                	push   $0x36
+  jmp alltraps
+801095b4:	e9 63 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095b9 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+801095b9:	6a 00                	push   $0x0
+  pushl $55
+801095bb:	6a 37                	push   $0x37
+  jmp alltraps
+801095bd:	e9 5a f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095c2 <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+801095c2:	6a 00                	push   $0x0
+  pushl $56
+801095c4:	6a 38                	push   $0x38
+  jmp alltraps
+801095c6:	e9 51 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095cb <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+801095cb:	6a 00                	push   $0x0
+  pushl $57
+801095cd:	6a 39                	push   $0x39
+  jmp alltraps
+801095cf:	e9 48 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095d4 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+801095d4:	6a 00                	push   $0x0
+  pushl $58
+801095d6:	6a 3a                	push   $0x3a
+  jmp alltraps
+801095d8:	e9 3f f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095dd <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+801095dd:	6a 00                	push   $0x0
+  pushl $59
+801095df:	6a 3b                	push   $0x3b
+  jmp alltraps
+801095e1:	e9 36 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095e6 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+801095e6:	6a 00                	push   $0x0
+  pushl $60
+801095e8:	6a 3c                	push   $0x3c
+  jmp alltraps
+801095ea:	e9 2d f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095ef <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+801095ef:	6a 00                	push   $0x0
+  pushl $61
+801095f1:	6a 3d                	push   $0x3d
+  jmp alltraps
+801095f3:	e9 24 f9 ff ff       	jmp    80108f1c <alltraps>
+
+801095f8 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+801095f8:	6a 00                	push   $0x0
+  pushl $62
+801095fa:	6a 3e                	push   $0x3e
+  jmp alltraps
+801095fc:	e9 1b f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109601 <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80109601:	6a 00                	push   $0x0
+  pushl $63
+80109603:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109605:	e9 12 f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010960a <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+8010960a:	6a 00                	push   $0x0
+  pushl $64
+8010960c:	6a 40                	push   $0x40
+  jmp alltraps
+8010960e:	e9 09 f9 ff ff       	jmp    80108f1c <alltraps>
+
+80109613 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109613:	6a 00                	push   $0x0
+  pushl $65
+80109615:	6a 41                	push   $0x41
+  jmp alltraps
+80109617:	e9 00 f9 ff ff       	jmp    80108f1c <alltraps>
+
+8010961c <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010961c:	6a 00                	push   $0x0
+  pushl $66
+8010961e:	6a 42                	push   $0x42
+  jmp alltraps
+80109620:	e9 f7 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109625 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109625:	6a 00                	push   $0x0
+  pushl $67
+80109627:	6a 43                	push   $0x43
+  jmp alltraps
+80109629:	e9 ee f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010962e <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010962e:	6a 00                	push   $0x0
+  pushl $68
+80109630:	6a 44                	push   $0x44
+  jmp alltraps
+80109632:	e9 e5 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109637 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109637:	6a 00                	push   $0x0
+  pushl $69
+80109639:	6a 45                	push   $0x45
+  jmp alltraps
+8010963b:	e9 dc f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109640 <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109640:	6a 00                	push   $0x0
+  pushl $70
+80109642:	6a 46                	push   $0x46
+  jmp alltraps
+80109644:	e9 d3 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109649 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109649:	6a 00                	push   $0x0
+  pushl $71
+8010964b:	6a 47                	push   $0x47
+  jmp alltraps
+8010964d:	e9 ca f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109652 <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109652:	6a 00                	push   $0x0
+  pushl $72
+80109654:	6a 48                	push   $0x48
+  jmp alltraps
+80109656:	e9 c1 f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010965b <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010965b:	6a 00                	push   $0x0
+  pushl $73
+8010965d:	6a 49                	push   $0x49
+  jmp alltraps
+8010965f:	e9 b8 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109664 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109664:	6a 00                	push   $0x0
+  pushl $74
+80109666:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109668:	e9 af f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010966d <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010966d:	6a 00                	push   $0x0
+  pushl $75
+8010966f:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109671:	e9 a6 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109676 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109676:	6a 00                	push   $0x0
+  pushl $76
+80109678:	6a 4c                	push   $0x4c
+  jmp alltraps
+8010967a:	e9 9d f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010967f <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010967f:	6a 00                	push   $0x0
+  pushl $77
+80109681:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109683:	e9 94 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109688 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109688:	6a 00                	push   $0x0
+  pushl $78
+8010968a:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010968c:	e9 8b f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109691 <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80109691:	6a 00                	push   $0x0
+  pushl $79
+80109693:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109695:	e9 82 f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010969a <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010969a:	6a 00                	push   $0x0
+  pushl $80
+8010969c:	6a 50                	push   $0x50
+  jmp alltraps
+8010969e:	e9 79 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096a3 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+801096a3:	6a 00                	push   $0x0
+  pushl $81
+801096a5:	6a 51                	push   $0x51
+  jmp alltraps
+801096a7:	e9 70 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096ac <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+801096ac:	6a 00                	push   $0x0
+  pushl $82
+801096ae:	6a 52                	push   $0x52
+  jmp alltraps
+801096b0:	e9 67 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096b5 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+801096b5:	6a 00                	push   $0x0
+  pushl $83
+801096b7:	6a 53                	push   $0x53
+  jmp alltraps
+801096b9:	e9 5e f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096be <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+801096be:	6a 00                	push   $0x0
+  pushl $84
+801096c0:	6a 54                	push   $0x54
+  jmp alltraps
+801096c2:	e9 55 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096c7 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+801096c7:	6a 00                	push   $0x0
+  pushl $85
+801096c9:	6a 55                	push   $0x55
+  jmp alltraps
+801096cb:	e9 4c f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096d0 <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+801096d0:	6a 00                	push   $0x0
+  pushl $86
+801096d2:	6a 56                	push   $0x56
+  jmp alltraps
+801096d4:	e9 43 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096d9 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+801096d9:	6a 00                	push   $0x0
+  pushl $87
+801096db:	6a 57                	push   $0x57
+  jmp alltraps
+801096dd:	e9 3a f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096e2 <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+801096e2:	6a 00                	push   $0x0
+  pushl $88
+801096e4:	6a 58                	push   $0x58
+  jmp alltraps
+801096e6:	e9 31 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096eb <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+801096eb:	6a 00                	push   $0x0
+  pushl $89
+801096ed:	6a 59                	push   $0x59
+  jmp alltraps
+801096ef:	e9 28 f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096f4 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+801096f4:	6a 00                	push   $0x0
+  pushl $90
+801096f6:	6a 5a                	push   $0x5a
+  jmp alltraps
+801096f8:	e9 1f f8 ff ff       	jmp    80108f1c <alltraps>
+
+801096fd <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+801096fd:	6a 00                	push   $0x0
+  pushl $91
+801096ff:	6a 5b                	push   $0x5b
+  jmp alltraps
+80109701:	e9 16 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109706 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109706:	6a 00                	push   $0x0
+  pushl $92
+80109708:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010970a:	e9 0d f8 ff ff       	jmp    80108f1c <alltraps>
+
+8010970f <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010970f:	6a 00                	push   $0x0
+  pushl $93
+80109711:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109713:	e9 04 f8 ff ff       	jmp    80108f1c <alltraps>
+
+80109718 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109718:	6a 00                	push   $0x0
+  pushl $94
+8010971a:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010971c:	e9 fb f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109721 <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80109721:	6a 00                	push   $0x0
+  pushl $95
+80109723:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109725:	e9 f2 f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010972a <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010972a:	6a 00                	push   $0x0
+  pushl $96
+8010972c:	6a 60                	push   $0x60
+  jmp alltraps
+8010972e:	e9 e9 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109733 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109733:	6a 00                	push   $0x0
+  pushl $97
+80109735:	6a 61                	push   $0x61
+  jmp alltraps
+80109737:	e9 e0 f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010973c <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010973c:	6a 00                	push   $0x0
+  pushl $98
+8010973e:	6a 62                	push   $0x62
+  jmp alltraps
+80109740:	e9 d7 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109745 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109745:	6a 00                	push   $0x0
+  pushl $99
+80109747:	6a 63                	push   $0x63
+  jmp alltraps
+80109749:	e9 ce f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010974e <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010974e:	6a 00                	push   $0x0
+  pushl $100
+80109750:	6a 64                	push   $0x64
+  jmp alltraps
+80109752:	e9 c5 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109757 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109757:	6a 00                	push   $0x0
+  pushl $101
+80109759:	6a 65                	push   $0x65
+  jmp alltraps
+8010975b:	e9 bc f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109760 <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+80109760:	6a 00                	push   $0x0
+  pushl $102
+80109762:	6a 66                	push   $0x66
+  jmp alltraps
+80109764:	e9 b3 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109769 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109769:	6a 00                	push   $0x0
+  pushl $103
+8010976b:	6a 67                	push   $0x67
+  jmp alltraps
+8010976d:	e9 aa f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109772 <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+80109772:	6a 00                	push   $0x0
+  pushl $104
+80109774:	6a 68                	push   $0x68
+  jmp alltraps
+80109776:	e9 a1 f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010977b <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010977b:	6a 00                	push   $0x0
+  pushl $105
+8010977d:	6a 69                	push   $0x69
+  jmp alltraps
+8010977f:	e9 98 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109784 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109784:	6a 00                	push   $0x0
+  pushl $106
+80109786:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109788:	e9 8f f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010978d <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010978d:	6a 00                	push   $0x0
+  pushl $107
+8010978f:	6a 6b                	push   $0x6b
+  jmp alltraps
+80109791:	e9 86 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109796 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109796:	6a 00                	push   $0x0
+  pushl $108
+80109798:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010979a:	e9 7d f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010979f <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010979f:	6a 00                	push   $0x0
+  pushl $109
+801097a1:	6a 6d                	push   $0x6d
+  jmp alltraps
+801097a3:	e9 74 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097a8 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+801097a8:	6a 00                	push   $0x0
+  pushl $110
+801097aa:	6a 6e                	push   $0x6e
+  jmp alltraps
+801097ac:	e9 6b f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097b1 <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+801097b1:	6a 00                	push   $0x0
+  pushl $111
+801097b3:	6a 6f                	push   $0x6f
+  jmp alltraps
+801097b5:	e9 62 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097ba <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+801097ba:	6a 00                	push   $0x0
+  pushl $112
+801097bc:	6a 70                	push   $0x70
+  jmp alltraps
+801097be:	e9 59 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097c3 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801097c3:	6a 00                	push   $0x0
+  pushl $113
+801097c5:	6a 71                	push   $0x71
+  jmp alltraps
+801097c7:	e9 50 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097cc <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+801097cc:	6a 00                	push   $0x0
+  pushl $114
+801097ce:	6a 72                	push   $0x72
+  jmp alltraps
+801097d0:	e9 47 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097d5 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+801097d5:	6a 00                	push   $0x0
+  pushl $115
+801097d7:	6a 73                	push   $0x73
+  jmp alltraps
+801097d9:	e9 3e f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097de <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+801097de:	6a 00                	push   $0x0
+  pushl $116
+801097e0:	6a 74                	push   $0x74
+  jmp alltraps
+801097e2:	e9 35 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097e7 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+801097e7:	6a 00                	push   $0x0
+  pushl $117
+801097e9:	6a 75                	push   $0x75
+  jmp alltraps
+801097eb:	e9 2c f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097f0 <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+801097f0:	6a 00                	push   $0x0
+  pushl $118
+801097f2:	6a 76                	push   $0x76
+  jmp alltraps
+801097f4:	e9 23 f7 ff ff       	jmp    80108f1c <alltraps>
+
+801097f9 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+801097f9:	6a 00                	push   $0x0
+  pushl $119
+801097fb:	6a 77                	push   $0x77
+  jmp alltraps
+801097fd:	e9 1a f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109802 <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+80109802:	6a 00                	push   $0x0
+  pushl $120
+80109804:	6a 78                	push   $0x78
+  jmp alltraps
+80109806:	e9 11 f7 ff ff       	jmp    80108f1c <alltraps>
+
+8010980b <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010980b:	6a 00                	push   $0x0
+  pushl $121
+8010980d:	6a 79                	push   $0x79
+  jmp alltraps
+8010980f:	e9 08 f7 ff ff       	jmp    80108f1c <alltraps>
+
+80109814 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109814:	6a 00                	push   $0x0
+  pushl $122
+80109816:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109818:	e9 ff f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010981d <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010981d:	6a 00                	push   $0x0
+  pushl $123
+8010981f:	6a 7b                	push   $0x7b
+  jmp alltraps
+80109821:	e9 f6 f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109826 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109826:	6a 00                	push   $0x0
+  pushl $124
+80109828:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010982a:	e9 ed f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010982f <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010982f:	6a 00                	push   $0x0
+  pushl $125
+80109831:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109833:	e9 e4 f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109838 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109838:	6a 00                	push   $0x0
+  pushl $126
+8010983a:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010983c:	e9 db f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109841 <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80109841:	6a 00                	push   $0x0
+  pushl $127
+80109843:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109845:	e9 d2 f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010984a <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010984a:	6a 00                	push   $0x0
+  pushl $128
+8010984c:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80109851:	e9 c6 f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109856 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109856:	6a 00                	push   $0x0
+  pushl $129
+80109858:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010985d:	e9 ba f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109862 <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80109862:	6a 00                	push   $0x0
+  pushl $130
+80109864:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109869:	e9 ae f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010986e <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010986e:	6a 00                	push   $0x0
+  pushl $131
+80109870:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109875:	e9 a2 f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010987a <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010987a:	6a 00                	push   $0x0
+  pushl $132
+8010987c:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80109881:	e9 96 f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109886 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109886:	6a 00                	push   $0x0
+  pushl $133
+80109888:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010988d:	e9 8a f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109892 <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109892:	6a 00                	push   $0x0
+  pushl $134
+80109894:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109899:	e9 7e f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010989e <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010989e:	6a 00                	push   $0x0
+  pushl $135
+801098a0:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+801098a5:	e9 72 f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098aa <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+801098aa:	6a 00                	push   $0x0
+  pushl $136
+801098ac:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+801098b1:	e9 66 f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098b6 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+801098b6:	6a 00                	push   $0x0
+  pushl $137
+801098b8:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+801098bd:	e9 5a f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098c2 <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+801098c2:	6a 00                	push   $0x0
+  pushl $138
+801098c4:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+801098c9:	e9 4e f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098ce <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+801098ce:	6a 00                	push   $0x0
+  pushl $139
+801098d0:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+801098d5:	e9 42 f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098da <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+801098da:	6a 00                	push   $0x0
+  pushl $140
+801098dc:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+801098e1:	e9 36 f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098e6 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+801098e6:	6a 00                	push   $0x0
+  pushl $141
+801098e8:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+801098ed:	e9 2a f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098f2 <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+801098f2:	6a 00                	push   $0x0
+  pushl $142
+801098f4:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+801098f9:	e9 1e f6 ff ff       	jmp    80108f1c <alltraps>
+
+801098fe <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+801098fe:	6a 00                	push   $0x0
+  pushl $143
+80109900:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109905:	e9 12 f6 ff ff       	jmp    80108f1c <alltraps>
+
+8010990a <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010990a:	6a 00                	push   $0x0
+  pushl $144
+8010990c:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80109911:	e9 06 f6 ff ff       	jmp    80108f1c <alltraps>
+
+80109916 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109916:	6a 00                	push   $0x0
+  pushl $145
+80109918:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010991d:	e9 fa f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109922 <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+80109922:	6a 00                	push   $0x0
+  pushl $146
+80109924:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109929:	e9 ee f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010992e <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010992e:	6a 00                	push   $0x0
+  pushl $147
+80109930:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109935:	e9 e2 f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010993a <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010993a:	6a 00                	push   $0x0
+  pushl $148
+8010993c:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109941:	e9 d6 f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109946 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109946:	6a 00                	push   $0x0
+  pushl $149
+80109948:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010994d:	e9 ca f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109952 <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109952:	6a 00                	push   $0x0
+  pushl $150
+80109954:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109959:	e9 be f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010995e <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010995e:	6a 00                	push   $0x0
+  pushl $151
+80109960:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109965:	e9 b2 f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010996a <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010996a:	6a 00                	push   $0x0
+  pushl $152
+8010996c:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109971:	e9 a6 f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109976 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109976:	6a 00                	push   $0x0
+  pushl $153
+80109978:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010997d:	e9 9a f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109982 <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109982:	6a 00                	push   $0x0
+  pushl $154
+80109984:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109989:	e9 8e f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010998e <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010998e:	6a 00                	push   $0x0
+  pushl $155
+80109990:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109995:	e9 82 f5 ff ff       	jmp    80108f1c <alltraps>
+
+8010999a <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010999a:	6a 00                	push   $0x0
+  pushl $156
+8010999c:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+801099a1:	e9 76 f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099a6 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+801099a6:	6a 00                	push   $0x0
+  pushl $157
+801099a8:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+801099ad:	e9 6a f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099b2 <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+801099b2:	6a 00                	push   $0x0
+  pushl $158
+801099b4:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+801099b9:	e9 5e f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099be <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+801099be:	6a 00                	push   $0x0
+  pushl $159
+801099c0:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+801099c5:	e9 52 f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099ca <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+801099ca:	6a 00                	push   $0x0
+  pushl $160
+801099cc:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+801099d1:	e9 46 f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099d6 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+801099d6:	6a 00                	push   $0x0
+  pushl $161
+801099d8:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+801099dd:	e9 3a f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099e2 <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+801099e2:	6a 00                	push   $0x0
+  pushl $162
+801099e4:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+801099e9:	e9 2e f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099ee <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+801099ee:	6a 00                	push   $0x0
+  pushl $163
+801099f0:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+801099f5:	e9 22 f5 ff ff       	jmp    80108f1c <alltraps>
+
+801099fa <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+801099fa:	6a 00                	push   $0x0
+  pushl $164
+801099fc:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109a01:	e9 16 f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109a06 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109a06:	6a 00                	push   $0x0
+  pushl $165
+80109a08:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109a0d:	e9 0a f5 ff ff       	jmp    80108f1c <alltraps>
+
+80109a12 <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109a12:	6a 00                	push   $0x0
+  pushl $166
+80109a14:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109a19:	e9 fe f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a1e <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109a1e:	6a 00                	push   $0x0
+  pushl $167
+80109a20:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109a25:	e9 f2 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a2a <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109a2a:	6a 00                	push   $0x0
+  pushl $168
+80109a2c:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109a31:	e9 e6 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a36 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109a36:	6a 00                	push   $0x0
+  pushl $169
+80109a38:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109a3d:	e9 da f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a42 <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109a42:	6a 00                	push   $0x0
+  pushl $170
+80109a44:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109a49:	e9 ce f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a4e <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109a4e:	6a 00                	push   $0x0
+  pushl $171
+80109a50:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109a55:	e9 c2 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a5a <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109a5a:	6a 00                	push   $0x0
+  pushl $172
+80109a5c:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109a61:	e9 b6 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a66 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109a66:	6a 00                	push   $0x0
+  pushl $173
+80109a68:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109a6d:	e9 aa f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a72 <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109a72:	6a 00                	push   $0x0
+  pushl $174
+80109a74:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109a79:	e9 9e f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a7e <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109a7e:	6a 00                	push   $0x0
+  pushl $175
+80109a80:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109a85:	e9 92 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a8a <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109a8a:	6a 00                	push   $0x0
+  pushl $176
+80109a8c:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+80109a91:	e9 86 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109a96 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109a96:	6a 00                	push   $0x0
+  pushl $177
+80109a98:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+80109a9d:	e9 7a f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109aa2 <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109aa2:	6a 00                	push   $0x0
+  pushl $178
+80109aa4:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109aa9:	e9 6e f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109aae <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+80109aae:	6a 00                	push   $0x0
+  pushl $179
+80109ab0:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109ab5:	e9 62 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109aba <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109aba:	6a 00                	push   $0x0
+  pushl $180
+80109abc:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+80109ac1:	e9 56 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109ac6 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109ac6:	6a 00                	push   $0x0
+  pushl $181
+80109ac8:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80109acd:	e9 4a f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109ad2 <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109ad2:	6a 00                	push   $0x0
+  pushl $182
+80109ad4:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109ad9:	e9 3e f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109ade <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80109ade:	6a 00                	push   $0x0
+  pushl $183
+80109ae0:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109ae5:	e9 32 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109aea <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109aea:	6a 00                	push   $0x0
+  pushl $184
+80109aec:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+80109af1:	e9 26 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109af6 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109af6:	6a 00                	push   $0x0
+  pushl $185
+80109af8:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109afd:	e9 1a f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109b02 <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109b02:	6a 00                	push   $0x0
+  pushl $186
+80109b04:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109b09:	e9 0e f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109b0e <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109b0e:	6a 00                	push   $0x0
+  pushl $187
+80109b10:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109b15:	e9 02 f4 ff ff       	jmp    80108f1c <alltraps>
+
+80109b1a <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109b1a:	6a 00                	push   $0x0
+  pushl $188
+80109b1c:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+80109b21:	e9 f6 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b26 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80109b26:	6a 00                	push   $0x0
+  pushl $189
+80109b28:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109b2d:	e9 ea f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b32 <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+80109b32:	6a 00                	push   $0x0
+  pushl $190
+80109b34:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109b39:	e9 de f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b3e <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109b3e:	6a 00                	push   $0x0
+  pushl $191
+80109b40:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80109b45:	e9 d2 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b4a <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109b4a:	6a 00                	push   $0x0
+  pushl $192
+80109b4c:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+80109b51:	e9 c6 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b56 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80109b56:	6a 00                	push   $0x0
+  pushl $193
+80109b58:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109b5d:	e9 ba f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b62 <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+80109b62:	6a 00                	push   $0x0
+  pushl $194
+80109b64:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109b69:	e9 ae f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b6e <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109b6e:	6a 00                	push   $0x0
+  pushl $195
+80109b70:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+80109b75:	e9 a2 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b7a <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80109b7a:	6a 00                	push   $0x0
+  pushl $196
+80109b7c:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+80109b81:	e9 96 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b86 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80109b86:	6a 00                	push   $0x0
+  pushl $197
+80109b88:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+80109b8d:	e9 8a f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b92 <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+80109b92:	6a 00                	push   $0x0
+  pushl $198
+80109b94:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80109b99:	e9 7e f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109b9e <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+80109b9e:	6a 00                	push   $0x0
+  pushl $199
+80109ba0:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80109ba5:	e9 72 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109baa <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80109baa:	6a 00                	push   $0x0
+  pushl $200
+80109bac:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+80109bb1:	e9 66 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bb6 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80109bb6:	6a 00                	push   $0x0
+  pushl $201
+80109bb8:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+80109bbd:	e9 5a f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bc2 <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+80109bc2:	6a 00                	push   $0x0
+  pushl $202
+80109bc4:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80109bc9:	e9 4e f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bce <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80109bce:	6a 00                	push   $0x0
+  pushl $203
+80109bd0:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80109bd5:	e9 42 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bda <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80109bda:	6a 00                	push   $0x0
+  pushl $204
+80109bdc:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+80109be1:	e9 36 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109be6 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80109be6:	6a 00                	push   $0x0
+  pushl $205
+80109be8:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109bed:	e9 2a f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bf2 <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109bf2:	6a 00                	push   $0x0
+  pushl $206
+80109bf4:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109bf9:	e9 1e f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109bfe <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109bfe:	6a 00                	push   $0x0
+  pushl $207
+80109c00:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109c05:	e9 12 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109c0a <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109c0a:	6a 00                	push   $0x0
+  pushl $208
+80109c0c:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109c11:	e9 06 f3 ff ff       	jmp    80108f1c <alltraps>
+
+80109c16 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109c16:	6a 00                	push   $0x0
+  pushl $209
+80109c18:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109c1d:	e9 fa f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c22 <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109c22:	6a 00                	push   $0x0
+  pushl $210
+80109c24:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109c29:	e9 ee f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c2e <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109c2e:	6a 00                	push   $0x0
+  pushl $211
+80109c30:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109c35:	e9 e2 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c3a <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109c3a:	6a 00                	push   $0x0
+  pushl $212
+80109c3c:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109c41:	e9 d6 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c46 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109c46:	6a 00                	push   $0x0
+  pushl $213
+80109c48:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109c4d:	e9 ca f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c52 <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109c52:	6a 00                	push   $0x0
+  pushl $214
+80109c54:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109c59:	e9 be f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c5e <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109c5e:	6a 00                	push   $0x0
+  pushl $215
+80109c60:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109c65:	e9 b2 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c6a <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109c6a:	6a 00                	push   $0x0
+  pushl $216
+80109c6c:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109c71:	e9 a6 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c76 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109c76:	6a 00                	push   $0x0
+  pushl $217
+80109c78:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109c7d:	e9 9a f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c82 <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109c82:	6a 00                	push   $0x0
+  pushl $218
+80109c84:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109c89:	e9 8e f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c8e <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109c8e:	6a 00                	push   $0x0
+  pushl $219
+80109c90:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109c95:	e9 82 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109c9a <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109c9a:	6a 00                	push   $0x0
+  pushl $220
+80109c9c:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109ca1:	e9 76 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109ca6 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109ca6:	6a 00                	push   $0x0
+  pushl $221
+80109ca8:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109cad:	e9 6a f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cb2 <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109cb2:	6a 00                	push   $0x0
+  pushl $222
+80109cb4:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109cb9:	e9 5e f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cbe <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109cbe:	6a 00                	push   $0x0
+  pushl $223
+80109cc0:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109cc5:	e9 52 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cca <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109cca:	6a 00                	push   $0x0
+  pushl $224
+80109ccc:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109cd1:	e9 46 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cd6 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109cd6:	6a 00                	push   $0x0
+  pushl $225
+80109cd8:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109cdd:	e9 3a f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109ce2 <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109ce2:	6a 00                	push   $0x0
+  pushl $226
+80109ce4:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109ce9:	e9 2e f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cee <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109cee:	6a 00                	push   $0x0
+  pushl $227
+80109cf0:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109cf5:	e9 22 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109cfa <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109cfa:	6a 00                	push   $0x0
+  pushl $228
+80109cfc:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109d01:	e9 16 f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109d06 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109d06:	6a 00                	push   $0x0
+  pushl $229
+80109d08:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109d0d:	e9 0a f2 ff ff       	jmp    80108f1c <alltraps>
+
+80109d12 <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109d12:	6a 00                	push   $0x0
+  pushl $230
+80109d14:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109d19:	e9 fe f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d1e <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109d1e:	6a 00                	push   $0x0
+  pushl $231
+80109d20:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109d25:	e9 f2 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d2a <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109d2a:	6a 00                	push   $0x0
+  pushl $232
+80109d2c:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109d31:	e9 e6 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d36 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109d36:	6a 00                	push   $0x0
+  pushl $233
+80109d38:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109d3d:	e9 da f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d42 <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109d42:	6a 00                	push   $0x0
+  pushl $234
+80109d44:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109d49:	e9 ce f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d4e <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109d4e:	6a 00                	push   $0x0
+  pushl $235
+80109d50:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109d55:	e9 c2 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d5a <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109d5a:	6a 00                	push   $0x0
+  pushl $236
+80109d5c:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109d61:	e9 b6 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d66 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109d66:	6a 00                	push   $0x0
+  pushl $237
+80109d68:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109d6d:	e9 aa f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d72 <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109d72:	6a 00                	push   $0x0
+  pushl $238
+80109d74:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109d79:	e9 9e f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d7e <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109d7e:	6a 00                	push   $0x0
+  pushl $239
+80109d80:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109d85:	e9 92 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d8a <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109d8a:	6a 00                	push   $0x0
+  pushl $240
+80109d8c:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109d91:	e9 86 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109d96 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109d96:	6a 00                	push   $0x0
+  pushl $241
+80109d98:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109d9d:	e9 7a f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109da2 <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109da2:	6a 00                	push   $0x0
+  pushl $242
+80109da4:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109da9:	e9 6e f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dae <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109dae:	6a 00                	push   $0x0
+  pushl $243
+80109db0:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109db5:	e9 62 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dba <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109dba:	6a 00                	push   $0x0
+  pushl $244
+80109dbc:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109dc1:	e9 56 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dc6 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109dc6:	6a 00                	push   $0x0
+  pushl $245
+80109dc8:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109dcd:	e9 4a f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dd2 <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109dd2:	6a 00                	push   $0x0
+  pushl $246
+80109dd4:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109dd9:	e9 3e f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dde <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109dde:	6a 00                	push   $0x0
+  pushl $247
+80109de0:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109de5:	e9 32 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109dea <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109dea:	6a 00                	push   $0x0
+  pushl $248
+80109dec:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109df1:	e9 26 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109df6 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109df6:	6a 00                	push   $0x0
+  pushl $249
+80109df8:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109dfd:	e9 1a f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109e02 <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109e02:	6a 00                	push   $0x0
+  pushl $250
+80109e04:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80109e09:	e9 0e f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109e0e <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80109e0e:	6a 00                	push   $0x0
+  pushl $251
+80109e10:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80109e15:	e9 02 f1 ff ff       	jmp    80108f1c <alltraps>
+
+80109e1a <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80109e1a:	6a 00                	push   $0x0
+  pushl $252
+80109e1c:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+80109e21:	e9 f6 f0 ff ff       	jmp    80108f1c <alltraps>
+
+80109e26 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80109e26:	6a 00                	push   $0x0
+  pushl $253
+80109e28:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+80109e2d:	e9 ea f0 ff ff       	jmp    80108f1c <alltraps>
+
+80109e32 <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+80109e32:	6a 00                	push   $0x0
+  pushl $254
+80109e34:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80109e39:	e9 de f0 ff ff       	jmp    80108f1c <alltraps>
+
+80109e3e <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+80109e3e:	6a 00                	push   $0x0
+  pushl $255
+80109e40:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80109e45:	e9 d2 f0 ff ff       	jmp    80108f1c <alltraps>
+
+80109e4a <mapbig>:
+
+// Map [va, va+size) to pa with 4MB pages; all three
+// must be 4MB-aligned.
+static void
+mapbig(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+80109e4a:	55                   	push   %ebp
+80109e4b:	89 e5                	mov    %esp,%ebp
+80109e4d:	57                   	push   %edi
+80109e4e:	56                   	push   %esi
+80109e4f:	53                   	push   %ebx
+80109e50:	83 ec 0c             	sub    $0xc,%esp
+80109e53:	89 c3                	mov    %eax,%ebx
+80109e55:	89 d0                	mov    %edx,%eax
+80109e57:	8b 75 08             	mov    0x8(%ebp),%esi
+  char *a, *last;
+
+  if((uint)va % BIGPGSIZE || size % BIGPGSIZE || pa % BIGPGSIZE)
+80109e5a:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+80109e5f:	75 3f                	jne    80109ea0 <mapbig+0x56>
+80109e61:	f7 c1 ff ff 3f 00    	test   $0x3fffff,%ecx
+80109e67:	75 37                	jne    80109ea0 <mapbig+0x56>
+80109e69:	f7 c6 ff ff 3f 00    	test   $0x3fffff,%esi
+80109e6f:	75 2f                	jne    80109ea0 <mapbig+0x56>
+    panic("mapbig");
+  last = va + size - BIGPGSIZE;
+80109e71:	8d bc 0a 00 00 c0 ff 	lea    -0x400000(%edx,%ecx,1),%edi
+  for(a = va;; a += BIGPGSIZE, pa += BIGPGSIZE){
+    if(pgdir[PDX(a)] & PTE_P)
+80109e78:	89 c2                	mov    %eax,%edx
+80109e7a:	c1 ea 16             	shr    $0x16,%edx
+80109e7d:	8d 0c 93             	lea    (%ebx,%edx,4),%ecx
+80109e80:	f6 01 01             	testb  $0x1,(%ecx)
+80109e83:	75 28                	jne    80109ead <mapbig+0x63>
+      panic("remap");
+    pgdir[PDX(a)] = pa | perm | PTE_P;
+80109e85:	89 f2                	mov    %esi,%edx
+80109e87:	0b 55 0c             	or     0xc(%ebp),%edx
+80109e8a:	83 ca 01             	or     $0x1,%edx
+80109e8d:	89 11                	mov    %edx,(%ecx)
+    if(a == last)
+80109e8f:	39 f8                	cmp    %edi,%eax
+80109e91:	74 27                	je     80109eba <mapbig+0x70>
+  for(a = va;; a += BIGPGSIZE, pa += BIGPGSIZE){
+80109e93:	05 00 00 40 00       	add    $0x400000,%eax
+80109e98:	81 c6 00 00 40 00    	add    $0x400000,%esi
+    if(pgdir[PDX(a)] & PTE_P)
+80109e9e:	eb d8                	jmp    80109e78 <mapbig+0x2e>
+    panic("mapbig");
+80109ea0:	83 ec 0c             	sub    $0xc,%esp
+80109ea3:	68 ec bf 10 80       	push   $0x8010bfec
+80109ea8:	e8 55 6a ff ff       	call   80100902 <panic>
+      panic("remap");
+80109ead:	83 ec 0c             	sub    $0xc,%esp
+80109eb0:	68 f3 bf 10 80       	push   $0x8010bff3
+80109eb5:	e8 48 6a ff ff       	call   80100902 <panic>
+      break;
+  }
+}
+80109eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109ebd:	5b                   	pop    %ebx
+80109ebe:	5e                   	pop    %esi
+80109ebf:	5f                   	pop    %edi
+80109ec0:	5d                   	pop    %ebp
+80109ec1:	c3                   	ret
+
+80109ec2 <walkpgdir>:
+{
+80109ec2:	55                   	push   %ebp
+80109ec3:	89 e5                	mov    %esp,%ebp
+80109ec5:	56                   	push   %esi
+80109ec6:	53                   	push   %ebx
+80109ec7:	89 d3                	mov    %edx,%ebx
+  pde = &pgdir[PDX(va)];
+80109ec9:	c1 ea 16             	shr    $0x16,%edx
+80109ecc:	8d 34 90             	lea    (%eax,%edx,4),%esi
+  if(*pde & PTE_P){
+80109ecf:	8b 06                	mov    (%esi),%eax
+80109ed1:	a8 01                	test   $0x1,%al
+80109ed3:	74 31                	je     80109f06 <walkpgdir+0x44>
+
+#ifndef __ASSEMBLER__
+// Address in page table or page directory entry
+//   I changes these from macros into inline functions to make sure we
+//   consistently get an error if a pointer is erroneously passed to them.
+static inline uint PTE_ADDR(uint pte)  { return pte & ~0xFFF; }
+80109ed5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (a > KERNBASE)
+80109eda:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80109edf:	77 18                	ja     80109ef9 <walkpgdir+0x37>
+    return (char*)a + KERNBASE;
+80109ee1:	05 00 00 00 80       	add    $0x80000000,%eax
+  return &pgtab[PTX(va)];
+80109ee6:	c1 eb 0c             	shr    $0xc,%ebx
+80109ee9:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+80109eef:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+}
+80109ef2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109ef5:	5b                   	pop    %ebx
+80109ef6:	5e                   	pop    %esi
+80109ef7:	5d                   	pop    %ebp
+80109ef8:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+80109ef9:	83 ec 0c             	sub    $0xc,%esp
+80109efc:	68 72 b3 10 80       	push   $0x8010b372
+80109f01:	e8 fc 69 ff ff       	call   80100902 <panic>
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+80109f06:	85 c9                	test   %ecx,%ecx
+80109f08:	74 1d                	je     80109f27 <walkpgdir+0x65>
+80109f0a:	e8 62 99 ff ff       	call   80103871 <kalloc_zeroed>
+80109f0f:	85 c0                	test   %eax,%eax
+80109f11:	74 14                	je     80109f27 <walkpgdir+0x65>
+    if (a < (void*) KERNBASE)
+80109f13:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+80109f18:	76 14                	jbe    80109f2e <walkpgdir+0x6c>
+    return (uint)a - KERNBASE;
+80109f1a:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80109f20:	83 ca 07             	or     $0x7,%edx
+80109f23:	89 16                	mov    %edx,(%esi)
+80109f25:	eb bf                	jmp    80109ee6 <walkpgdir+0x24>
+      return 0;
+80109f27:	b8 00 00 00 00       	mov    $0x0,%eax
+80109f2c:	eb c4                	jmp    80109ef2 <walkpgdir+0x30>
+        panic("V2P on address < KERNBASE "
+80109f2e:	83 ec 0c             	sub    $0xc,%esp
+80109f31:	68 30 af 10 80       	push   $0x8010af30
+80109f36:	e8 c7 69 ff ff       	call   80100902 <panic>
+
+80109f3b <mappages>:
+{
+80109f3b:	55                   	push   %ebp
+80109f3c:	89 e5                	mov    %esp,%ebp
+80109f3e:	57                   	push   %edi
+80109f3f:	56                   	push   %esi
+80109f40:	53                   	push   %ebx
+80109f41:	83 ec 1c             	sub    $0x1c,%esp
+80109f44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109f47:	8b 75 08             	mov    0x8(%ebp),%esi
+  a = (char*)PGROUNDDOWN((uint)va);
+80109f4a:	89 d3                	mov    %edx,%ebx
+80109f4c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+80109f52:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+80109f56:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80109f5b:	89 c7                	mov    %eax,%edi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80109f5d:	b9 01 00 00 00       	mov    $0x1,%ecx
+80109f62:	89 da                	mov    %ebx,%edx
+80109f64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109f67:	e8 56 ff ff ff       	call   80109ec2 <walkpgdir>
+80109f6c:	85 c0                	test   %eax,%eax
+80109f6e:	74 2e                	je     80109f9e <mappages+0x63>
+    if(*pte & PTE_P)
+80109f70:	f6 00 01             	testb  $0x1,(%eax)
+80109f73:	75 1c                	jne    80109f91 <mappages+0x56>
+    *pte = pa | perm | PTE_P;
+80109f75:	89 f2                	mov    %esi,%edx
+80109f77:	0b 55 0c             	or     0xc(%ebp),%edx
+80109f7a:	83 ca 01             	or     $0x1,%edx
+80109f7d:	89 10                	mov    %edx,(%eax)
+    if(a == last)
+80109f7f:	39 fb                	cmp    %edi,%ebx
+80109f81:	74 28                	je     80109fab <mappages+0x70>
+    a += PGSIZE;
+80109f83:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pa += PGSIZE;
+80109f89:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80109f8f:	eb cc                	jmp    80109f5d <mappages+0x22>
+      panic("remap");
+80109f91:	83 ec 0c             	sub    $0xc,%esp
+80109f94:	68 f3 bf 10 80       	push   $0x8010bff3
+80109f99:	e8 64 69 ff ff       	call   80100902 <panic>
+      return -1;
+80109f9e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109fa6:	5b                   	pop    %ebx
+80109fa7:	5e                   	pop    %esi
+80109fa8:	5f                   	pop    %edi
+80109fa9:	5d                   	pop    %ebp
+80109faa:	c3                   	ret
+  return 0;
+80109fab:	b8 00 00 00 00       	mov    $0x0,%eax
+80109fb0:	eb f1                	jmp    80109fa3 <mappages+0x68>
+
+80109fb2 <seginit>:
+{
+80109fb2:	55                   	push   %ebp
+80109fb3:	89 e5                	mov    %esp,%ebp
+80109fb5:	57                   	push   %edi
+80109fb6:	56                   	push   %esi
+80109fb7:	53                   	push   %ebx
+80109fb8:	83 ec 1c             	sub    $0x1c,%esp
+  c = &cpus[cpuid()];
+80109fbb:	e8 fd b9 ff ff       	call   801059bd <cpuid>
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80109fc0:	69 f8 b0 00 00 00    	imul   $0xb0,%eax,%edi
+80109fc6:	66 c7 87 18 63 14 80 	movw   $0xffff,-0x7feb9ce8(%edi)
+80109fcd:	ff ff 
+80109fcf:	66 c7 87 1a 63 14 80 	movw   $0x0,-0x7feb9ce6(%edi)
+80109fd6:	00 00 
+80109fd8:	c6 87 1c 63 14 80 00 	movb   $0x0,-0x7feb9ce4(%edi)
+80109fdf:	0f b6 8f 1d 63 14 80 	movzbl -0x7feb9ce3(%edi),%ecx
+80109fe6:	83 e1 f0             	and    $0xfffffff0,%ecx
+80109fe9:	89 ce                	mov    %ecx,%esi
+80109feb:	83 ce 0a             	or     $0xa,%esi
+80109fee:	89 f2                	mov    %esi,%edx
+80109ff0:	88 97 1d 63 14 80    	mov    %dl,-0x7feb9ce3(%edi)
+80109ff6:	83 c9 1a             	or     $0x1a,%ecx
+80109ff9:	88 8f 1d 63 14 80    	mov    %cl,-0x7feb9ce3(%edi)
+80109fff:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010a002:	88 8f 1d 63 14 80    	mov    %cl,-0x7feb9ce3(%edi)
+8010a008:	83 c9 80             	or     $0xffffff80,%ecx
+8010a00b:	88 8f 1d 63 14 80    	mov    %cl,-0x7feb9ce3(%edi)
+8010a011:	0f b6 8f 1e 63 14 80 	movzbl -0x7feb9ce2(%edi),%ecx
+8010a018:	83 c9 0f             	or     $0xf,%ecx
+8010a01b:	88 8f 1e 63 14 80    	mov    %cl,-0x7feb9ce2(%edi)
+8010a021:	89 ce                	mov    %ecx,%esi
+8010a023:	83 e6 ef             	and    $0xffffffef,%esi
+8010a026:	89 f2                	mov    %esi,%edx
+8010a028:	88 97 1e 63 14 80    	mov    %dl,-0x7feb9ce2(%edi)
+8010a02e:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010a031:	88 8f 1e 63 14 80    	mov    %cl,-0x7feb9ce2(%edi)
+8010a037:	89 ce                	mov    %ecx,%esi
+8010a039:	83 ce 40             	or     $0x40,%esi
+8010a03c:	89 f2                	mov    %esi,%edx
+8010a03e:	88 97 1e 63 14 80    	mov    %dl,-0x7feb9ce2(%edi)
+8010a044:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010a047:	88 8f 1e 63 14 80    	mov    %cl,-0x7feb9ce2(%edi)
+8010a04d:	c6 87 1f 63 14 80 00 	movb   $0x0,-0x7feb9ce1(%edi)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a054:	66 c7 87 20 63 14 80 	movw   $0xffff,-0x7feb9ce0(%edi)
+8010a05b:	ff ff 
+8010a05d:	66 c7 87 22 63 14 80 	movw   $0x0,-0x7feb9cde(%edi)
+8010a064:	00 00 
+8010a066:	c6 87 24 63 14 80 00 	movb   $0x0,-0x7feb9cdc(%edi)
+8010a06d:	0f b6 8f 25 63 14 80 	movzbl -0x7feb9cdb(%edi),%ecx
+8010a074:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010a077:	89 ce                	mov    %ecx,%esi
+8010a079:	83 ce 02             	or     $0x2,%esi
+8010a07c:	89 f2                	mov    %esi,%edx
+8010a07e:	88 97 25 63 14 80    	mov    %dl,-0x7feb9cdb(%edi)
+8010a084:	83 c9 12             	or     $0x12,%ecx
+8010a087:	88 8f 25 63 14 80    	mov    %cl,-0x7feb9cdb(%edi)
+8010a08d:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010a090:	88 8f 25 63 14 80    	mov    %cl,-0x7feb9cdb(%edi)
+8010a096:	83 c9 80             	or     $0xffffff80,%ecx
+8010a099:	88 8f 25 63 14 80    	mov    %cl,-0x7feb9cdb(%edi)
+8010a09f:	0f b6 8f 26 63 14 80 	movzbl -0x7feb9cda(%edi),%ecx
+8010a0a6:	83 c9 0f             	or     $0xf,%ecx
+8010a0a9:	88 8f 26 63 14 80    	mov    %cl,-0x7feb9cda(%edi)
+8010a0af:	89 ce                	mov    %ecx,%esi
+8010a0b1:	83 e6 ef             	and    $0xffffffef,%esi
+8010a0b4:	89 f2                	mov    %esi,%edx
+8010a0b6:	88 97 26 63 14 80    	mov    %dl,-0x7feb9cda(%edi)
+8010a0bc:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010a0bf:	88 8f 26 63 14 80    	mov    %cl,-0x7feb9cda(%edi)
+8010a0c5:	89 ce                	mov    %ecx,%esi
+8010a0c7:	83 ce 40             	or     $0x40,%esi
+8010a0ca:	89 f2                	mov    %esi,%edx
+8010a0cc:	88 97 26 63 14 80    	mov    %dl,-0x7feb9cda(%edi)
+8010a0d2:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010a0d5:	88 8f 26 63 14 80    	mov    %cl,-0x7feb9cda(%edi)
+8010a0db:	c6 87 27 63 14 80 00 	movb   $0x0,-0x7feb9cd9(%edi)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a0e2:	66 c7 87 28 63 14 80 	movw   $0xffff,-0x7feb9cd8(%edi)
+8010a0e9:	ff ff 
+8010a0eb:	66 c7 87 2a 63 14 80 	movw   $0x0,-0x7feb9cd6(%edi)
+8010a0f2:	00 00 
+8010a0f4:	c6 87 2c 63 14 80 00 	movb   $0x0,-0x7feb9cd4(%edi)
+8010a0fb:	0f b6 9f 2d 63 14 80 	movzbl -0x7feb9cd3(%edi),%ebx
+8010a102:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010a105:	89 de                	mov    %ebx,%esi
+8010a107:	83 ce 0a             	or     $0xa,%esi
+8010a10a:	89 f2                	mov    %esi,%edx
+8010a10c:	88 97 2d 63 14 80    	mov    %dl,-0x7feb9cd3(%edi)
+8010a112:	89 de                	mov    %ebx,%esi
+8010a114:	83 ce 1a             	or     $0x1a,%esi
+8010a117:	89 f2                	mov    %esi,%edx
+8010a119:	88 97 2d 63 14 80    	mov    %dl,-0x7feb9cd3(%edi)
+8010a11f:	83 cb 7a             	or     $0x7a,%ebx
+8010a122:	88 9f 2d 63 14 80    	mov    %bl,-0x7feb9cd3(%edi)
+8010a128:	c6 87 2d 63 14 80 fa 	movb   $0xfa,-0x7feb9cd3(%edi)
+8010a12f:	0f b6 9f 2e 63 14 80 	movzbl -0x7feb9cd2(%edi),%ebx
+8010a136:	83 cb 0f             	or     $0xf,%ebx
+8010a139:	88 9f 2e 63 14 80    	mov    %bl,-0x7feb9cd2(%edi)
+8010a13f:	89 de                	mov    %ebx,%esi
+8010a141:	83 e6 ef             	and    $0xffffffef,%esi
+8010a144:	89 f2                	mov    %esi,%edx
+8010a146:	88 97 2e 63 14 80    	mov    %dl,-0x7feb9cd2(%edi)
+8010a14c:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010a14f:	88 9f 2e 63 14 80    	mov    %bl,-0x7feb9cd2(%edi)
+8010a155:	89 de                	mov    %ebx,%esi
+8010a157:	83 ce 40             	or     $0x40,%esi
+8010a15a:	89 f2                	mov    %esi,%edx
+8010a15c:	88 97 2e 63 14 80    	mov    %dl,-0x7feb9cd2(%edi)
+8010a162:	83 cb c0             	or     $0xffffffc0,%ebx
+8010a165:	88 9f 2e 63 14 80    	mov    %bl,-0x7feb9cd2(%edi)
+8010a16b:	c6 87 2f 63 14 80 00 	movb   $0x0,-0x7feb9cd1(%edi)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a172:	66 c7 87 30 63 14 80 	movw   $0xffff,-0x7feb9cd0(%edi)
+8010a179:	ff ff 
+8010a17b:	66 c7 87 32 63 14 80 	movw   $0x0,-0x7feb9cce(%edi)
+8010a182:	00 00 
+8010a184:	c6 87 34 63 14 80 00 	movb   $0x0,-0x7feb9ccc(%edi)
+8010a18b:	0f b6 9f 35 63 14 80 	movzbl -0x7feb9ccb(%edi),%ebx
+8010a192:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010a195:	89 de                	mov    %ebx,%esi
+8010a197:	83 ce 02             	or     $0x2,%esi
+8010a19a:	89 f2                	mov    %esi,%edx
+8010a19c:	88 97 35 63 14 80    	mov    %dl,-0x7feb9ccb(%edi)
+8010a1a2:	89 de                	mov    %ebx,%esi
+8010a1a4:	83 ce 12             	or     $0x12,%esi
+8010a1a7:	89 f2                	mov    %esi,%edx
+8010a1a9:	88 97 35 63 14 80    	mov    %dl,-0x7feb9ccb(%edi)
+8010a1af:	83 cb 72             	or     $0x72,%ebx
+8010a1b2:	88 9f 35 63 14 80    	mov    %bl,-0x7feb9ccb(%edi)
+8010a1b8:	c6 87 35 63 14 80 f2 	movb   $0xf2,-0x7feb9ccb(%edi)
+8010a1bf:	0f b6 9f 36 63 14 80 	movzbl -0x7feb9cca(%edi),%ebx
+8010a1c6:	83 cb 0f             	or     $0xf,%ebx
+8010a1c9:	88 9f 36 63 14 80    	mov    %bl,-0x7feb9cca(%edi)
+8010a1cf:	89 de                	mov    %ebx,%esi
+8010a1d1:	83 e6 ef             	and    $0xffffffef,%esi
+8010a1d4:	89 f2                	mov    %esi,%edx
+8010a1d6:	88 97 36 63 14 80    	mov    %dl,-0x7feb9cca(%edi)
+8010a1dc:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010a1df:	88 9f 36 63 14 80    	mov    %bl,-0x7feb9cca(%edi)
+8010a1e5:	89 de                	mov    %ebx,%esi
+8010a1e7:	83 ce 40             	or     $0x40,%esi
+8010a1ea:	89 f2                	mov    %esi,%edx
+8010a1ec:	88 97 36 63 14 80    	mov    %dl,-0x7feb9cca(%edi)
+8010a1f2:	83 cb c0             	or     $0xffffffc0,%ebx
+8010a1f5:	88 9f 36 63 14 80    	mov    %bl,-0x7feb9cca(%edi)
+8010a1fb:	c6 87 37 63 14 80 00 	movb   $0x0,-0x7feb9cc9(%edi)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a202:	8d 97 10 63 14 80    	lea    -0x7feb9cf0(%edi),%edx
+  pd[0] = size-1;
+8010a208:	66 c7 45 e2 2f 00    	movw   $0x2f,-0x1e(%ebp)
+  pd[1] = (uint)p;
+8010a20e:	66 89 55 e4          	mov    %dx,-0x1c(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a212:	c1 ea 10             	shr    $0x10,%edx
+8010a215:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a219:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+8010a21c:	0f 01 10             	lgdtl  (%eax)
+}
+8010a21f:	83 c4 1c             	add    $0x1c,%esp
+8010a222:	5b                   	pop    %ebx
+8010a223:	5e                   	pop    %esi
+8010a224:	5f                   	pop    %edi
+8010a225:	5d                   	pop    %ebp
+8010a226:	c3                   	ret
+
+8010a227 <setupkvm>:
+
+// Set up kernel part of a page table by sharing kpgdir's.
+pde_t*
+setupkvm(void)
+{
+8010a227:	55                   	push   %ebp
+8010a228:	89 e5                	mov    %esp,%ebp
+8010a22a:	53                   	push   %ebx
+8010a22b:	83 ec 04             	sub    $0x4,%esp
+  pde_t *pgdir;
+
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
+8010a22e:	e8 3e 96 ff ff       	call   80103871 <kalloc_zeroed>
+8010a233:	89 c3                	mov    %eax,%ebx
+8010a235:	85 c0                	test   %eax,%eax
+8010a237:	74 22                	je     8010a25b <setupkvm+0x34>
+    return 0;
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+8010a239:	a1 44 91 19 80       	mov    0x80199144,%eax
+8010a23e:	05 00 08 00 00       	add    $0x800,%eax
+8010a243:	8d 93 00 08 00 00    	lea    0x800(%ebx),%edx
+8010a249:	83 ec 04             	sub    $0x4,%esp
+8010a24c:	68 00 08 00 00       	push   $0x800
+8010a251:	50                   	push   %eax
+8010a252:	52                   	push   %edx
+8010a253:	e8 17 db ff ff       	call   80107d6f <memmove>
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+  return pgdir;
+8010a258:	83 c4 10             	add    $0x10,%esp
+}
+8010a25b:	89 d8                	mov    %ebx,%eax
+8010a25d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a260:	c9                   	leave
+8010a261:	c3                   	ret
+
+8010a262 <switchkvm>:
+// Switch h/w page table register to the kernel-only page table,
+// for when no process is running.
+void
+switchkvm(void)
+{
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a262:	a1 44 91 19 80       	mov    0x80199144,%eax
+    if (a < (void*) KERNBASE)
+8010a267:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+8010a26c:	76 09                	jbe    8010a277 <switchkvm+0x15>
+    return (uint)a - KERNBASE;
+8010a26e:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a273:	0f 22 d8             	mov    %eax,%cr3
+8010a276:	c3                   	ret
+{
+8010a277:	55                   	push   %ebp
+8010a278:	89 e5                	mov    %esp,%ebp
+8010a27a:	83 ec 14             	sub    $0x14,%esp
+        panic("V2P on address < KERNBASE "
+8010a27d:	68 30 af 10 80       	push   $0x8010af30
+8010a282:	e8 7b 66 ff ff       	call   80100902 <panic>
+
+8010a287 <kvmalloc>:
+{
+8010a287:	55                   	push   %ebp
+8010a288:	89 e5                	mov    %esp,%ebp
+8010a28a:	56                   	push   %esi
+8010a28b:	53                   	push   %ebx
+  if((kpgdir = (pde_t*)kalloc_zeroed()) == 0)
+8010a28c:	e8 e0 95 ff ff       	call   80103871 <kalloc_zeroed>
+8010a291:	a3 44 91 19 80       	mov    %eax,0x80199144
+8010a296:	85 c0                	test   %eax,%eax
+8010a298:	74 07                	je     8010a2a1 <kvmalloc+0x1a>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+8010a29a:	bb 80 f9 10 80       	mov    $0x8010f980,%ebx
+8010a29f:	eb 30                	jmp    8010a2d1 <kvmalloc+0x4a>
+    panic("kvmalloc");
+8010a2a1:	83 ec 0c             	sub    $0xc,%esp
+8010a2a4:	68 f9 bf 10 80       	push   $0x8010bff9
+8010a2a9:	e8 54 66 ff ff       	call   80100902 <panic>
+                     (uint)k->phys_start, k->perm) < 0)
+8010a2ae:	8b 73 04             	mov    0x4(%ebx),%esi
+    else if(mappages(kpgdir, k->virt, k->phys_end - k->phys_start,
+8010a2b1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010a2b4:	29 f1                	sub    %esi,%ecx
+8010a2b6:	8b 13                	mov    (%ebx),%edx
+8010a2b8:	83 ec 08             	sub    $0x8,%esp
+8010a2bb:	50                   	push   %eax
+8010a2bc:	56                   	push   %esi
+8010a2bd:	a1 44 91 19 80       	mov    0x80199144,%eax
+8010a2c2:	e8 74 fc ff ff       	call   80109f3b <mappages>
+8010a2c7:	83 c4 10             	add    $0x10,%esp
+8010a2ca:	85 c0                	test   %eax,%eax
+8010a2cc:	78 30                	js     8010a2fe <kvmalloc+0x77>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+8010a2ce:	83 c3 10             	add    $0x10,%ebx
+8010a2d1:	81 fb d0 f9 10 80    	cmp    $0x8010f9d0,%ebx
+8010a2d7:	73 32                	jae    8010a30b <kvmalloc+0x84>
+    if(k->perm & PTE_PS)
+8010a2d9:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010a2dc:	a8 80                	test   $0x80,%al
+8010a2de:	74 ce                	je     8010a2ae <kvmalloc+0x27>
+      mapbig(kpgdir, k->virt, k->phys_end - k->phys_start,
+8010a2e0:	8b 73 04             	mov    0x4(%ebx),%esi
+8010a2e3:	8b 13                	mov    (%ebx),%edx
+8010a2e5:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010a2e8:	29 f1                	sub    %esi,%ecx
+8010a2ea:	83 ec 08             	sub    $0x8,%esp
+8010a2ed:	50                   	push   %eax
+8010a2ee:	56                   	push   %esi
+8010a2ef:	a1 44 91 19 80       	mov    0x80199144,%eax
+8010a2f4:	e8 51 fb ff ff       	call   80109e4a <mapbig>
+8010a2f9:	83 c4 10             	add    $0x10,%esp
+8010a2fc:	eb d0                	jmp    8010a2ce <kvmalloc+0x47>
+      panic("kvmalloc");
+8010a2fe:	83 ec 0c             	sub    $0xc,%esp
+8010a301:	68 f9 bf 10 80       	push   $0x8010bff9
+8010a306:	e8 f7 65 ff ff       	call   80100902 <panic>
+  switchkvm();
+8010a30b:	e8 52 ff ff ff       	call   8010a262 <switchkvm>
+}
+8010a310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a313:	5b                   	pop    %ebx
+8010a314:	5e                   	pop    %esi
+8010a315:	5d                   	pop    %ebp
+8010a316:	c3                   	ret
+
+8010a317 <switchtss>:
+
+// Switch TSS to process p's kernel stack, leaving the page
+// table alone (the scheduler loads it only when it changes).
+void
+switchtss(struct proc *p)
+{
+8010a317:	55                   	push   %ebp
+8010a318:	89 e5                	mov    %esp,%ebp
+8010a31a:	57                   	push   %edi
+8010a31b:	56                   	push   %esi
+8010a31c:	53                   	push   %ebx
+8010a31d:	83 ec 1c             	sub    $0x1c,%esp
+8010a320:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a323:	85 f6                	test   %esi,%esi
+8010a325:	0f 84 10 01 00 00    	je     8010a43b <switchtss+0x124>
+    panic("switchtss: no process");
+  if(p->kstack == 0)
+8010a32b:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+8010a32f:	0f 84 13 01 00 00    	je     8010a448 <switchtss+0x131>
+    panic("switchtss: no kstack");
+
+  pushcli();
+8010a335:	e8 00 d8 ff ff       	call   80107b3a <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a33a:	e8 22 b6 ff ff       	call   80105961 <mycpu>
+8010a33f:	89 c3                	mov    %eax,%ebx
+8010a341:	e8 1b b6 ff ff       	call   80105961 <mycpu>
+8010a346:	8d 78 08             	lea    0x8(%eax),%edi
+8010a349:	e8 13 b6 ff ff       	call   80105961 <mycpu>
+8010a34e:	83 c0 08             	add    $0x8,%eax
+8010a351:	c1 e8 10             	shr    $0x10,%eax
+8010a354:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a357:	e8 05 b6 ff ff       	call   80105961 <mycpu>
+8010a35c:	83 c0 08             	add    $0x8,%eax
+8010a35f:	c1 e8 18             	shr    $0x18,%eax
+8010a362:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+8010a369:	67 00 
+8010a36b:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a372:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+8010a376:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010a37c:	0f b6 93 9d 00 00 00 	movzbl 0x9d(%ebx),%edx
+8010a383:	83 e2 f0             	and    $0xfffffff0,%edx
+8010a386:	89 d1                	mov    %edx,%ecx
+8010a388:	83 c9 09             	or     $0x9,%ecx
+8010a38b:	88 8b 9d 00 00 00    	mov    %cl,0x9d(%ebx)
+8010a391:	83 ca 19             	or     $0x19,%edx
+8010a394:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a39a:	83 e2 9f             	and    $0xffffff9f,%edx
+8010a39d:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a3a3:	83 ca 80             	or     $0xffffff80,%edx
+8010a3a6:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a3ac:	0f b6 93 9e 00 00 00 	movzbl 0x9e(%ebx),%edx
+8010a3b3:	89 d1                	mov    %edx,%ecx
+8010a3b5:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010a3b8:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010a3be:	89 d1                	mov    %edx,%ecx
+8010a3c0:	83 e1 e0             	and    $0xffffffe0,%ecx
+8010a3c3:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010a3c9:	83 e2 c0             	and    $0xffffffc0,%edx
+8010a3cc:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a3d2:	83 ca 40             	or     $0x40,%edx
+8010a3d5:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a3db:	83 e2 7f             	and    $0x7f,%edx
+8010a3de:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a3e4:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+                                sizeof(mycpu()->ts)-1, 0);
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a3ea:	e8 72 b5 ff ff       	call   80105961 <mycpu>
+8010a3ef:	0f b6 90 9d 00 00 00 	movzbl 0x9d(%eax),%edx
+8010a3f6:	83 e2 ef             	and    $0xffffffef,%edx
+8010a3f9:	88 90 9d 00 00 00    	mov    %dl,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a3ff:	e8 5d b5 ff ff       	call   80105961 <mycpu>
+8010a404:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a40a:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a40d:	e8 4f b5 ff ff       	call   80105961 <mycpu>
+8010a412:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a418:	89 58 0c             	mov    %ebx,0xc(%eax)
+  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
+  // forbids I/O instructions (e.g., inb and outb) from user space
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a41b:	e8 41 b5 ff ff       	call   80105961 <mycpu>
+8010a420:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010a426:	b8 28 00 00 00       	mov    $0x28,%eax
+8010a42b:	0f 00 d8             	ltr    %ax
+  ltr(SEG_TSS << 3);
+  popcli();
+8010a42e:	e8 4b d7 ff ff       	call   80107b7e <popcli>
+}
+8010a433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a436:	5b                   	pop    %ebx
+8010a437:	5e                   	pop    %esi
+8010a438:	5f                   	pop    %edi
+8010a439:	5d                   	pop    %ebp
+8010a43a:	c3                   	ret
+    panic("switchtss: no process");
+8010a43b:	83 ec 0c             	sub    $0xc,%esp
+8010a43e:	68 02 c0 10 80       	push   $0x8010c002
+8010a443:	e8 ba 64 ff ff       	call   80100902 <panic>
+    panic("switchtss: no kstack");
+8010a448:	83 ec 0c             	sub    $0xc,%esp
+8010a44b:	68 18 c0 10 80       	push   $0x8010c018
+8010a450:	e8 ad 64 ff ff       	call   80100902 <panic>
+
+8010a455 <switchuvm>:
+{
+8010a455:	55                   	push   %ebp
+8010a456:	89 e5                	mov    %esp,%ebp
+8010a458:	53                   	push   %ebx
+8010a459:	83 ec 04             	sub    $0x4,%esp
+8010a45c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+8010a45f:	e8 d6 d6 ff ff       	call   80107b3a <pushcli>
+  switchtss(p);
+8010a464:	83 ec 0c             	sub    $0xc,%esp
+8010a467:	53                   	push   %ebx
+8010a468:	e8 aa fe ff ff       	call   8010a317 <switchtss>
+  if(p->pgdir == 0)
+8010a46d:	8b 43 04             	mov    0x4(%ebx),%eax
+8010a470:	83 c4 10             	add    $0x10,%esp
+8010a473:	85 c0                	test   %eax,%eax
+8010a475:	74 19                	je     8010a490 <switchuvm+0x3b>
+    if (a < (void*) KERNBASE)
+8010a477:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+8010a47c:	76 1f                	jbe    8010a49d <switchuvm+0x48>
+    return (uint)a - KERNBASE;
+8010a47e:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a483:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+8010a486:	e8 f3 d6 ff ff       	call   80107b7e <popcli>
+}
+8010a48b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a48e:	c9                   	leave
+8010a48f:	c3                   	ret
+    panic("switchuvm: no pgdir");
+8010a490:	83 ec 0c             	sub    $0xc,%esp
+8010a493:	68 2d c0 10 80       	push   $0x8010c02d
+8010a498:	e8 65 64 ff ff       	call   80100902 <panic>
+        panic("V2P on address < KERNBASE "
+8010a49d:	83 ec 0c             	sub    $0xc,%esp
+8010a4a0:	68 30 af 10 80       	push   $0x8010af30
+8010a4a5:	e8 58 64 ff ff       	call   80100902 <panic>
+
+8010a4aa <inituvm>:
+
+// Load the initcode into address 0 of pgdir.
+// sz must be less than a page.
+void
+inituvm(pde_t *pgdir, char *init, uint sz)
+{
+8010a4aa:	55                   	push   %ebp
+8010a4ab:	89 e5                	mov    %esp,%ebp
+8010a4ad:	56                   	push   %esi
+8010a4ae:	53                   	push   %ebx
+8010a4af:	8b 75 10             	mov    0x10(%ebp),%esi
+  char *mem;
+
+  if(sz >= PGSIZE)
+8010a4b2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a4b8:	77 43                	ja     8010a4fd <inituvm+0x53>
+    panic("inituvm: more than a page");
+  mem = kalloc_zeroed();
+8010a4ba:	e8 b2 93 ff ff       	call   80103871 <kalloc_zeroed>
+8010a4bf:	89 c3                	mov    %eax,%ebx
+    if (a < (void*) KERNBASE)
+8010a4c1:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+8010a4c6:	76 42                	jbe    8010a50a <inituvm+0x60>
+    return (uint)a - KERNBASE;
+8010a4c8:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010a4ce:	83 ec 08             	sub    $0x8,%esp
+8010a4d1:	6a 06                	push   $0x6
+8010a4d3:	50                   	push   %eax
+8010a4d4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a4d9:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a4de:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a4e1:	e8 55 fa ff ff       	call   80109f3b <mappages>
+  memmove(mem, init, sz);
+8010a4e6:	83 c4 0c             	add    $0xc,%esp
+8010a4e9:	56                   	push   %esi
+8010a4ea:	ff 75 0c             	push   0xc(%ebp)
+8010a4ed:	53                   	push   %ebx
+8010a4ee:	e8 7c d8 ff ff       	call   80107d6f <memmove>
+}
+8010a4f3:	83 c4 10             	add    $0x10,%esp
+8010a4f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a4f9:	5b                   	pop    %ebx
+8010a4fa:	5e                   	pop    %esi
+8010a4fb:	5d                   	pop    %ebp
+8010a4fc:	c3                   	ret
+    panic("inituvm: more than a page");
+8010a4fd:	83 ec 0c             	sub    $0xc,%esp
+8010a500:	68 41 c0 10 80       	push   $0x8010c041
+8010a505:	e8 f8 63 ff ff       	call   80100902 <panic>
+        panic("V2P on address < KERNBASE "
+8010a50a:	83 ec 0c             	sub    $0xc,%esp
+8010a50d:	68 30 af 10 80       	push   $0x8010af30
+8010a512:	e8 eb 63 ff ff       	call   80100902 <panic>
+
+8010a517 <loaduvm>:
+
+// Load a program segment into pgdir.  addr must be page-aligned
+// and the pages from addr to addr+sz must already be mapped.
+int
+loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
+{
+8010a517:	55                   	push   %ebp
+8010a518:	89 e5                	mov    %esp,%ebp
+8010a51a:	57                   	push   %edi
+8010a51b:	56                   	push   %esi
+8010a51c:	53                   	push   %ebx
+8010a51d:	83 ec 0c             	sub    $0xc,%esp
+8010a520:	8b 7d 18             	mov    0x18(%ebp),%edi
+  uint i, pa, n;
+  pte_t *pte;
+
+  if((uint) addr % PGSIZE != 0)
+8010a523:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010a526:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+8010a52c:	74 43                	je     8010a571 <loaduvm+0x5a>
+    panic("loaduvm: addr must be page aligned");
+8010a52e:	83 ec 0c             	sub    $0xc,%esp
+8010a531:	68 c8 c0 10 80       	push   $0x8010c0c8
+8010a536:	e8 c7 63 ff ff       	call   80100902 <panic>
+  for(i = 0; i < sz; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+      panic("loaduvm: address should exist");
+8010a53b:	83 ec 0c             	sub    $0xc,%esp
+8010a53e:	68 5b c0 10 80       	push   $0x8010c05b
+8010a543:	e8 ba 63 ff ff       	call   80100902 <panic>
+    pa = PTE_ADDR(*pte);
+    if(sz - i < PGSIZE)
+      n = sz - i;
+    else
+      n = PGSIZE;
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a548:	89 da                	mov    %ebx,%edx
+8010a54a:	03 55 14             	add    0x14(%ebp),%edx
+    if (a > KERNBASE)
+8010a54d:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+8010a552:	77 51                	ja     8010a5a5 <loaduvm+0x8e>
+    return (char*)a + KERNBASE;
+8010a554:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a559:	56                   	push   %esi
+8010a55a:	52                   	push   %edx
+8010a55b:	50                   	push   %eax
+8010a55c:	ff 75 10             	push   0x10(%ebp)
+8010a55f:	e8 fd 7e ff ff       	call   80102461 <readi>
+8010a564:	83 c4 10             	add    $0x10,%esp
+8010a567:	39 f0                	cmp    %esi,%eax
+8010a569:	75 54                	jne    8010a5bf <loaduvm+0xa8>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a56b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a571:	39 fb                	cmp    %edi,%ebx
+8010a573:	73 3d                	jae    8010a5b2 <loaduvm+0x9b>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010a575:	89 da                	mov    %ebx,%edx
+8010a577:	03 55 0c             	add    0xc(%ebp),%edx
+8010a57a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a57f:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a582:	e8 3b f9 ff ff       	call   80109ec2 <walkpgdir>
+8010a587:	85 c0                	test   %eax,%eax
+8010a589:	74 b0                	je     8010a53b <loaduvm+0x24>
+    pa = PTE_ADDR(*pte);
+8010a58b:	8b 00                	mov    (%eax),%eax
+8010a58d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(sz - i < PGSIZE)
+8010a592:	89 fe                	mov    %edi,%esi
+8010a594:	29 de                	sub    %ebx,%esi
+8010a596:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a59c:	76 aa                	jbe    8010a548 <loaduvm+0x31>
+      n = PGSIZE;
+8010a59e:	be 00 10 00 00       	mov    $0x1000,%esi
+8010a5a3:	eb a3                	jmp    8010a548 <loaduvm+0x31>
+        panic("P2V on address > KERNBASE");
+8010a5a5:	83 ec 0c             	sub    $0xc,%esp
+8010a5a8:	68 72 b3 10 80       	push   $0x8010b372
+8010a5ad:	e8 50 63 ff ff       	call   80100902 <panic>
+      return -1;
+  }
+  return 0;
+8010a5b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a5b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a5ba:	5b                   	pop    %ebx
+8010a5bb:	5e                   	pop    %esi
+8010a5bc:	5f                   	pop    %edi
+8010a5bd:	5d                   	pop    %ebp
+8010a5be:	c3                   	ret
+      return -1;
+8010a5bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a5c4:	eb f1                	jmp    8010a5b7 <loaduvm+0xa0>
+
+8010a5c6 <deallocuvm>:
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+8010a5c6:	55                   	push   %ebp
+8010a5c7:	89 e5                	mov    %esp,%ebp
+8010a5c9:	57                   	push   %edi
+8010a5ca:	56                   	push   %esi
+8010a5cb:	53                   	push   %ebx
+8010a5cc:	83 ec 0c             	sub    $0xc,%esp
+8010a5cf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  uint a, pa;
+
+  if(newsz >= oldsz)
+8010a5d2:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010a5d5:	73 11                	jae    8010a5e8 <deallocuvm+0x22>
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a5d7:	8b 45 10             	mov    0x10(%ebp),%eax
+8010a5da:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+8010a5e0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a5e6:	eb 19                	jmp    8010a601 <deallocuvm+0x3b>
+    return oldsz;
+8010a5e8:	89 f8                	mov    %edi,%eax
+8010a5ea:	eb 78                	jmp    8010a664 <deallocuvm+0x9e>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a5ec:	c1 eb 16             	shr    $0x16,%ebx
+8010a5ef:	83 c3 01             	add    $0x1,%ebx
+8010a5f2:	c1 e3 16             	shl    $0x16,%ebx
+8010a5f5:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a5fb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a601:	39 fb                	cmp    %edi,%ebx
+8010a603:	73 5c                	jae    8010a661 <deallocuvm+0x9b>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+8010a605:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a60a:	89 da                	mov    %ebx,%edx
+8010a60c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a60f:	e8 ae f8 ff ff       	call   80109ec2 <walkpgdir>
+8010a614:	89 c6                	mov    %eax,%esi
+    if(!pte)
+8010a616:	85 c0                	test   %eax,%eax
+8010a618:	74 d2                	je     8010a5ec <deallocuvm+0x26>
+    else if((*pte & PTE_P) != 0){
+8010a61a:	8b 00                	mov    (%eax),%eax
+8010a61c:	a8 01                	test   $0x1,%al
+8010a61e:	74 db                	je     8010a5fb <deallocuvm+0x35>
+      pa = PTE_ADDR(*pte);
+      if(pa == 0)
+8010a620:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a625:	74 20                	je     8010a647 <deallocuvm+0x81>
+    if (a > KERNBASE)
+8010a627:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+8010a62c:	77 26                	ja     8010a654 <deallocuvm+0x8e>
+    return (char*)a + KERNBASE;
+8010a62e:	05 00 00 00 80       	add    $0x80000000,%eax
+        panic("kfree");
+      char *v = P2V(pa);
+      kfree(v);
+8010a633:	83 ec 0c             	sub    $0xc,%esp
+8010a636:	50                   	push   %eax
+8010a637:	e8 f8 8e ff ff       	call   80103534 <kfree>
+      *pte = 0;
+8010a63c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+8010a642:	83 c4 10             	add    $0x10,%esp
+8010a645:	eb b4                	jmp    8010a5fb <deallocuvm+0x35>
+        panic("kfree");
+8010a647:	83 ec 0c             	sub    $0xc,%esp
+8010a64a:	68 7b b0 10 80       	push   $0x8010b07b
+8010a64f:	e8 ae 62 ff ff       	call   80100902 <panic>
+        panic("P2V on address > KERNBASE");
+8010a654:	83 ec 0c             	sub    $0xc,%esp
+8010a657:	68 72 b3 10 80       	push   $0x8010b372
+8010a65c:	e8 a1 62 ff ff       	call   80100902 <panic>
+    }
+  }
+  return newsz;
+8010a661:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+8010a664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a667:	5b                   	pop    %ebx
+8010a668:	5e                   	pop    %esi
+8010a669:	5f                   	pop    %edi
+8010a66a:	5d                   	pop    %ebp
+8010a66b:	c3                   	ret
+
+8010a66c <allocuvm>:
+{
+8010a66c:	55                   	push   %ebp
+8010a66d:	89 e5                	mov    %esp,%ebp
+8010a66f:	57                   	push   %edi
+8010a670:	56                   	push   %esi
+8010a671:	53                   	push   %ebx
+8010a672:	83 ec 1c             	sub    $0x1c,%esp
+8010a675:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(newsz >= KERNBASE)
+8010a678:	85 ff                	test   %edi,%edi
+8010a67a:	0f 88 c6 00 00 00    	js     8010a746 <allocuvm+0xda>
+  if(newsz < oldsz)
+8010a680:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010a683:	72 56                	jb     8010a6db <allocuvm+0x6f>
+  a = PGROUNDUP(oldsz);
+8010a685:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a688:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+8010a68e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  for(; a < newsz; a += PGSIZE){
+8010a694:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010a697:	39 fe                	cmp    %edi,%esi
+8010a699:	0f 83 a2 00 00 00    	jae    8010a741 <allocuvm+0xd5>
+    mem = kalloc_zeroed();
+8010a69f:	e8 cd 91 ff ff       	call   80103871 <kalloc_zeroed>
+8010a6a4:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010a6a6:	85 c0                	test   %eax,%eax
+8010a6a8:	74 36                	je     8010a6e0 <allocuvm+0x74>
+    if (a < (void*) KERNBASE)
+8010a6aa:	3d ff ff ff 7f       	cmp    $0x7fffffff,%eax
+8010a6af:	76 55                	jbe    8010a706 <allocuvm+0x9a>
+    return (uint)a - KERNBASE;
+8010a6b1:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010a6b7:	83 ec 08             	sub    $0x8,%esp
+8010a6ba:	6a 06                	push   $0x6
+8010a6bc:	50                   	push   %eax
+8010a6bd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a6c2:	89 f2                	mov    %esi,%edx
+8010a6c4:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a6c7:	e8 6f f8 ff ff       	call   80109f3b <mappages>
+8010a6cc:	83 c4 10             	add    $0x10,%esp
+8010a6cf:	85 c0                	test   %eax,%eax
+8010a6d1:	78 40                	js     8010a713 <allocuvm+0xa7>
+  for(; a < newsz; a += PGSIZE){
+8010a6d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010a6d9:	eb bc                	jmp    8010a697 <allocuvm+0x2b>
+    return oldsz;
+8010a6db:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a6de:	eb 6b                	jmp    8010a74b <allocuvm+0xdf>
+      cprintf("allocuvm out of memory\n");
+8010a6e0:	83 ec 0c             	sub    $0xc,%esp
+8010a6e3:	68 79 c0 10 80       	push   $0x8010c079
+8010a6e8:	e8 0c 66 ff ff       	call   80100cf9 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010a6ed:	83 c4 0c             	add    $0xc,%esp
+8010a6f0:	ff 75 0c             	push   0xc(%ebp)
+8010a6f3:	57                   	push   %edi
+8010a6f4:	ff 75 08             	push   0x8(%ebp)
+8010a6f7:	e8 ca fe ff ff       	call   8010a5c6 <deallocuvm>
+      return 0;
+8010a6fc:	83 c4 10             	add    $0x10,%esp
+8010a6ff:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a704:	eb 45                	jmp    8010a74b <allocuvm+0xdf>
+        panic("V2P on address < KERNBASE "
+8010a706:	83 ec 0c             	sub    $0xc,%esp
+8010a709:	68 30 af 10 80       	push   $0x8010af30
+8010a70e:	e8 ef 61 ff ff       	call   80100902 <panic>
+      cprintf("allocuvm out of memory (2)\n");
+8010a713:	83 ec 0c             	sub    $0xc,%esp
+8010a716:	68 91 c0 10 80       	push   $0x8010c091
+8010a71b:	e8 d9 65 ff ff       	call   80100cf9 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010a720:	83 c4 0c             	add    $0xc,%esp
+8010a723:	ff 75 0c             	push   0xc(%ebp)
+8010a726:	57                   	push   %edi
+8010a727:	ff 75 08             	push   0x8(%ebp)
+8010a72a:	e8 97 fe ff ff       	call   8010a5c6 <deallocuvm>
+      kfree(mem);
+8010a72f:	89 1c 24             	mov    %ebx,(%esp)
+8010a732:	e8 fd 8d ff ff       	call   80103534 <kfree>
+      return 0;
+8010a737:	83 c4 10             	add    $0x10,%esp
+8010a73a:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a73f:	eb 0a                	jmp    8010a74b <allocuvm+0xdf>
+8010a741:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a744:	eb 05                	jmp    8010a74b <allocuvm+0xdf>
+    return 0;
+8010a746:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010a74b:	89 d0                	mov    %edx,%eax
+8010a74d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a750:	5b                   	pop    %ebx
+8010a751:	5e                   	pop    %esi
+8010a752:	5f                   	pop    %edi
+8010a753:	5d                   	pop    %ebp
+8010a754:	c3                   	ret
+
+8010a755 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part. The kernel part is shared (see setupkvm).
+void
+freevm(pde_t *pgdir)
+{
+8010a755:	55                   	push   %ebp
+8010a756:	89 e5                	mov    %esp,%ebp
+8010a758:	56                   	push   %esi
+8010a759:	53                   	push   %ebx
+8010a75a:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010a75d:	85 f6                	test   %esi,%esi
+8010a75f:	74 1a                	je     8010a77b <freevm+0x26>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+8010a761:	83 ec 04             	sub    $0x4,%esp
+8010a764:	6a 00                	push   $0x0
+8010a766:	68 00 00 00 80       	push   $0x80000000
+8010a76b:	56                   	push   %esi
+8010a76c:	e8 55 fe ff ff       	call   8010a5c6 <deallocuvm>
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010a771:	83 c4 10             	add    $0x10,%esp
+8010a774:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010a779:	eb 21                	jmp    8010a79c <freevm+0x47>
+    panic("freevm: no pgdir");
+8010a77b:	83 ec 0c             	sub    $0xc,%esp
+8010a77e:	68 ad c0 10 80       	push   $0x8010c0ad
+8010a783:	e8 7a 61 ff ff       	call   80100902 <panic>
+    return (char*)a + KERNBASE;
+8010a788:	05 00 00 00 80       	add    $0x80000000,%eax
+    if(pgdir[i] & PTE_P){
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+      kfree(v);
+8010a78d:	83 ec 0c             	sub    $0xc,%esp
+8010a790:	50                   	push   %eax
+8010a791:	e8 9e 8d ff ff       	call   80103534 <kfree>
+8010a796:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010a799:	83 c3 01             	add    $0x1,%ebx
+8010a79c:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+8010a7a2:	77 20                	ja     8010a7c4 <freevm+0x6f>
+    if(pgdir[i] & PTE_P){
+8010a7a4:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010a7a7:	a8 01                	test   $0x1,%al
+8010a7a9:	74 ee                	je     8010a799 <freevm+0x44>
+8010a7ab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (a > KERNBASE)
+8010a7b0:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+8010a7b5:	76 d1                	jbe    8010a788 <freevm+0x33>
+        panic("P2V on address > KERNBASE");
+8010a7b7:	83 ec 0c             	sub    $0xc,%esp
+8010a7ba:	68 72 b3 10 80       	push   $0x8010b372
+8010a7bf:	e8 3e 61 ff ff       	call   80100902 <panic>
+    }
+  }
+  kfree((char*)pgdir);
+8010a7c4:	83 ec 0c             	sub    $0xc,%esp
+8010a7c7:	56                   	push   %esi
+8010a7c8:	e8 67 8d ff ff       	call   80103534 <kfree>
+}
+8010a7cd:	83 c4 10             	add    $0x10,%esp
+8010a7d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a7d3:	5b                   	pop    %ebx
+8010a7d4:	5e                   	pop    %esi
+8010a7d5:	5d                   	pop    %ebp
+8010a7d6:	c3                   	ret
+
+8010a7d7 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010a7d7:	55                   	push   %ebp
+8010a7d8:	89 e5                	mov    %esp,%ebp
+8010a7da:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010a7dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a7e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a7e5:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a7e8:	e8 d5 f6 ff ff       	call   80109ec2 <walkpgdir>
+  if(pte == 0)
+8010a7ed:	85 c0                	test   %eax,%eax
+8010a7ef:	74 09                	je     8010a7fa <clearpteu+0x23>
+    panic("clearpteu");
+  *pte &= ~PTE_U;
+8010a7f1:	8b 10                	mov    (%eax),%edx
+8010a7f3:	83 e2 fb             	and    $0xfffffffb,%edx
+8010a7f6:	89 10                	mov    %edx,(%eax)
+}
+8010a7f8:	c9                   	leave
+8010a7f9:	c3                   	ret
+    panic("clearpteu");
+8010a7fa:	83 ec 0c             	sub    $0xc,%esp
+8010a7fd:	68 be c0 10 80       	push   $0x8010c0be
+8010a802:	e8 fb 60 ff ff       	call   80100902 <panic>
+
+8010a807 <copyuvm>:
+// of it for a child. Pages are shared copy-on-write:
+// writable ones become read-only PTE_COW in both tables,
+// and cowfault() copies them when either side writes.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010a807:	55                   	push   %ebp
+8010a808:	89 e5                	mov    %esp,%ebp
+8010a80a:	57                   	push   %edi
+8010a80b:	56                   	push   %esi
+8010a80c:	53                   	push   %ebx
+8010a80d:	83 ec 1c             	sub    $0x1c,%esp
+8010a810:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+
+  if((d = setupkvm()) == 0)
+8010a813:	e8 0f fa ff ff       	call   8010a227 <setupkvm>
+8010a818:	89 c1                	mov    %eax,%ecx
+8010a81a:	85 c0                	test   %eax,%eax
+8010a81c:	0f 84 f8 00 00 00    	je     8010a91a <copyuvm+0x113>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010a822:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010a827:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010a82a:	89 7d 08             	mov    %edi,0x8(%ebp)
+8010a82d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010a830:	eb 4f                	jmp    8010a881 <copyuvm+0x7a>
+    // Heap pages not touched yet stay unmapped in the child too.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+    pa = PTE_ADDR(*pte);
+8010a832:	8b 00                	mov    (%eax),%eax
+8010a834:	89 c6                	mov    %eax,%esi
+8010a836:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+static inline uint PTE_FLAGS(uint pte) { return pte & 0xFFF; }
+8010a83c:	25 ff 0f 00 00       	and    $0xfff,%eax
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a841:	83 ec 08             	sub    $0x8,%esp
+8010a844:	50                   	push   %eax
+8010a845:	56                   	push   %esi
+8010a846:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a84b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a84e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010a851:	e8 e5 f6 ff ff       	call   80109f3b <mappages>
+8010a856:	83 c4 10             	add    $0x10,%esp
+8010a859:	85 c0                	test   %eax,%eax
+8010a85b:	78 5a                	js     8010a8b7 <copyuvm+0xb0>
+    if (a > KERNBASE)
+8010a85d:	81 fe 00 00 00 80    	cmp    $0x80000000,%esi
+8010a863:	0f 87 89 00 00 00    	ja     8010a8f2 <copyuvm+0xeb>
+    return (char*)a + KERNBASE;
+8010a869:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+      goto bad;
+    kref(P2V(pa));
+8010a86f:	83 ec 0c             	sub    $0xc,%esp
+8010a872:	56                   	push   %esi
+8010a873:	e8 34 8c ff ff       	call   801034ac <kref>
+8010a878:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sz; i += PGSIZE){
+8010a87b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a881:	39 fb                	cmp    %edi,%ebx
+8010a883:	73 7a                	jae    8010a8ff <copyuvm+0xf8>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+8010a885:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010a888:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a88d:	89 da                	mov    %ebx,%edx
+8010a88f:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a892:	e8 2b f6 ff ff       	call   80109ec2 <walkpgdir>
+8010a897:	85 c0                	test   %eax,%eax
+8010a899:	74 e0                	je     8010a87b <copyuvm+0x74>
+8010a89b:	8b 10                	mov    (%eax),%edx
+8010a89d:	f6 c2 01             	test   $0x1,%dl
+8010a8a0:	74 d9                	je     8010a87b <copyuvm+0x74>
+    if(*pte & PTE_W)
+8010a8a2:	f6 c2 02             	test   $0x2,%dl
+8010a8a5:	74 8b                	je     8010a832 <copyuvm+0x2b>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010a8a7:	81 e2 fd fd ff ff    	and    $0xfffffdfd,%edx
+8010a8ad:	80 ce 02             	or     $0x2,%dh
+8010a8b0:	89 10                	mov    %edx,(%eax)
+8010a8b2:	e9 7b ff ff ff       	jmp    8010a832 <copyuvm+0x2b>
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+8010a8b7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a8ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010a8bd:	0f 20 da             	mov    %cr3,%edx
+    if (a < (void*) KERNBASE)
+8010a8c0:	81 ff ff ff ff 7f    	cmp    $0x7fffffff,%edi
+8010a8c6:	76 1d                	jbe    8010a8e5 <copyuvm+0xde>
+    return (uint)a - KERNBASE;
+8010a8c8:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
+  return d;
+
+bad:
+  if(rcr3() == V2P(pgdir))
+8010a8ce:	39 d0                	cmp    %edx,%eax
+8010a8d0:	74 64                	je     8010a936 <copyuvm+0x12f>
+    lcr3(V2P(pgdir));
+  freevm(d);
+8010a8d2:	83 ec 0c             	sub    $0xc,%esp
+8010a8d5:	51                   	push   %ecx
+8010a8d6:	e8 7a fe ff ff       	call   8010a755 <freevm>
+  return 0;
+8010a8db:	83 c4 10             	add    $0x10,%esp
+8010a8de:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a8e3:	eb 35                	jmp    8010a91a <copyuvm+0x113>
+        panic("V2P on address < KERNBASE "
+8010a8e5:	83 ec 0c             	sub    $0xc,%esp
+8010a8e8:	68 30 af 10 80       	push   $0x8010af30
+8010a8ed:	e8 10 60 ff ff       	call   80100902 <panic>
+        panic("P2V on address > KERNBASE");
+8010a8f2:	83 ec 0c             	sub    $0xc,%esp
+8010a8f5:	68 72 b3 10 80       	push   $0x8010b372
+8010a8fa:	e8 03 60 ff ff       	call   80100902 <panic>
+8010a8ff:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a902:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010a905:	0f 20 da             	mov    %cr3,%edx
+    if (a < (void*) KERNBASE)
+8010a908:	81 ff ff ff ff 7f    	cmp    $0x7fffffff,%edi
+8010a90e:	76 14                	jbe    8010a924 <copyuvm+0x11d>
+    return (uint)a - KERNBASE;
+8010a910:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+  if(rcr3() == V2P(pgdir))
+8010a916:	39 d0                	cmp    %edx,%eax
+8010a918:	74 17                	je     8010a931 <copyuvm+0x12a>
+}
+8010a91a:	89 c8                	mov    %ecx,%eax
+8010a91c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a91f:	5b                   	pop    %ebx
+8010a920:	5e                   	pop    %esi
+8010a921:	5f                   	pop    %edi
+8010a922:	5d                   	pop    %ebp
+8010a923:	c3                   	ret
+        panic("V2P on address < KERNBASE "
+8010a924:	83 ec 0c             	sub    $0xc,%esp
+8010a927:	68 30 af 10 80       	push   $0x8010af30
+8010a92c:	e8 d1 5f ff ff       	call   80100902 <panic>
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a931:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a934:	eb e4                	jmp    8010a91a <copyuvm+0x113>
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a936:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a939:	eb 97                	jmp    8010a8d2 <copyuvm+0xcb>
+
+8010a93b <cowfault>:
+// copy the page, or just make it writable again if no
+// one else shares it any more. Returns -1 if va is not
+// a copy-on-write page or memory ran out.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+8010a93b:	55                   	push   %ebp
+8010a93c:	89 e5                	mov    %esp,%ebp
+8010a93e:	57                   	push   %edi
+8010a93f:	56                   	push   %esi
+8010a940:	53                   	push   %ebx
+8010a941:	83 ec 0c             	sub    $0xc,%esp
+  pte_t *pte;
+  char *mem, *old;
+
+  if(va >= KERNBASE)
+8010a944:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010a948:	0f 88 d9 00 00 00    	js     8010aa27 <cowfault+0xec>
+    return -1;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+8010a94e:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a953:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a956:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a959:	e8 64 f5 ff ff       	call   80109ec2 <walkpgdir>
+8010a95e:	89 c6                	mov    %eax,%esi
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010a960:	85 c0                	test   %eax,%eax
+8010a962:	0f 84 c6 00 00 00    	je     8010aa2e <cowfault+0xf3>
+8010a968:	8b 18                	mov    (%eax),%ebx
+8010a96a:	89 d8                	mov    %ebx,%eax
+8010a96c:	25 05 02 00 00       	and    $0x205,%eax
+8010a971:	3d 05 02 00 00       	cmp    $0x205,%eax
+8010a976:	0f 85 b9 00 00 00    	jne    8010aa35 <cowfault+0xfa>
+static inline uint PTE_ADDR(uint pte)  { return pte & ~0xFFF; }
+8010a97c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if (a > KERNBASE)
+8010a982:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010a988:	77 3b                	ja     8010a9c5 <cowfault+0x8a>
+    return (char*)a + KERNBASE;
+8010a98a:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcount(old) == 1){
+8010a990:	83 ec 0c             	sub    $0xc,%esp
+8010a993:	53                   	push   %ebx
+8010a994:	e8 6c 8b ff ff       	call   80103505 <krefcount>
+8010a999:	83 c4 10             	add    $0x10,%esp
+8010a99c:	83 f8 01             	cmp    $0x1,%eax
+8010a99f:	75 31                	jne    8010a9d2 <cowfault+0x97>
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+8010a9a1:	8b 06                	mov    (%esi),%eax
+8010a9a3:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010a9a8:	83 c8 02             	or     $0x2,%eax
+8010a9ab:	89 06                	mov    %eax,(%esi)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(old);
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+8010a9ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a9b0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  asm volatile("invlpg (%0)" : : "r" (va) : "memory");
+8010a9b5:	0f 01 38             	invlpg (%eax)
+  return 0;
+8010a9b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a9bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9c0:	5b                   	pop    %ebx
+8010a9c1:	5e                   	pop    %esi
+8010a9c2:	5f                   	pop    %edi
+8010a9c3:	5d                   	pop    %ebp
+8010a9c4:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+8010a9c5:	83 ec 0c             	sub    $0xc,%esp
+8010a9c8:	68 72 b3 10 80       	push   $0x8010b372
+8010a9cd:	e8 30 5f ff ff       	call   80100902 <panic>
+    if((mem = kalloc()) == 0)
+8010a9d2:	e8 35 8d ff ff       	call   8010370c <kalloc>
+8010a9d7:	89 c7                	mov    %eax,%edi
+8010a9d9:	85 c0                	test   %eax,%eax
+8010a9db:	74 5f                	je     8010aa3c <cowfault+0x101>
+    memmove(mem, old, PGSIZE);
+8010a9dd:	83 ec 04             	sub    $0x4,%esp
+8010a9e0:	68 00 10 00 00       	push   $0x1000
+8010a9e5:	53                   	push   %ebx
+8010a9e6:	50                   	push   %eax
+8010a9e7:	e8 83 d3 ff ff       	call   80107d6f <memmove>
+    if (a < (void*) KERNBASE)
+8010a9ec:	83 c4 10             	add    $0x10,%esp
+8010a9ef:	81 ff ff ff ff 7f    	cmp    $0x7fffffff,%edi
+8010a9f5:	76 23                	jbe    8010aa1a <cowfault+0xdf>
+    return (uint)a - KERNBASE;
+8010a9f7:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a9fd:	8b 3e                	mov    (%esi),%edi
+8010a9ff:	81 e7 ff 0d 00 00    	and    $0xdff,%edi
+8010aa05:	09 c7                	or     %eax,%edi
+8010aa07:	83 cf 02             	or     $0x2,%edi
+8010aa0a:	89 3e                	mov    %edi,(%esi)
+    kfree(old);
+8010aa0c:	83 ec 0c             	sub    $0xc,%esp
+8010aa0f:	53                   	push   %ebx
+8010aa10:	e8 1f 8b ff ff       	call   80103534 <kfree>
+8010aa15:	83 c4 10             	add    $0x10,%esp
+8010aa18:	eb 93                	jmp    8010a9ad <cowfault+0x72>
+        panic("V2P on address < KERNBASE "
+8010aa1a:	83 ec 0c             	sub    $0xc,%esp
+8010aa1d:	68 30 af 10 80       	push   $0x8010af30
+8010aa22:	e8 db 5e ff ff       	call   80100902 <panic>
+    return -1;
+8010aa27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa2c:	eb 8f                	jmp    8010a9bd <cowfault+0x82>
+    return -1;
+8010aa2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa33:	eb 88                	jmp    8010a9bd <cowfault+0x82>
+8010aa35:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa3a:	eb 81                	jmp    8010a9bd <cowfault+0x82>
+      return -1;
+8010aa3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa41:	e9 77 ff ff ff       	jmp    8010a9bd <cowfault+0x82>
+
+8010aa46 <pgfault>:
+// the kernel touching p's memory. Fills in copy-on-write
+// pages on a write, and demand-zero heap pages (see growproc)
+// below p->sz on first touch. Returns -1 if the fault was real.
+int
+pgfault(struct proc *p, uint va, uint err)
+{
+8010aa46:	55                   	push   %ebp
+8010aa47:	89 e5                	mov    %esp,%ebp
+8010aa49:	57                   	push   %edi
+8010aa4a:	56                   	push   %esi
+8010aa4b:	53                   	push   %ebx
+8010aa4c:	83 ec 1c             	sub    $0x1c,%esp
+8010aa4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010aa52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010aa55:	8b 45 10             	mov    0x10(%ebp),%eax
+  struct vmseg *s;
+  char *mem;
+  uint perm, n;
+
+  if(err & FEC_PR)
+8010aa58:	a8 01                	test   $0x1,%al
+8010aa5a:	75 1e                	jne    8010aa7a <pgfault+0x34>
+    return (err & FEC_WR) ? cowfault(p->pgdir, va) : -1;
+  if(va >= p->sz || va >= KERNBASE)
+8010aa5c:	3b 1f                	cmp    (%edi),%ebx
+8010aa5e:	0f 83 2b 01 00 00    	jae    8010ab8f <pgfault+0x149>
+8010aa64:	85 db                	test   %ebx,%ebx
+8010aa66:	0f 88 2a 01 00 00    	js     8010ab96 <pgfault+0x150>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010aa6c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  mem = 0;
+  perm = PTE_W|PTE_U;
+  // Program pages come from the executable page cache, shared
+  // with every other process running the same file.
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+8010aa72:	8d b7 cc 00 00 00    	lea    0xcc(%edi),%esi
+8010aa78:	eb 25                	jmp    8010aa9f <pgfault+0x59>
+    return (err & FEC_WR) ? cowfault(p->pgdir, va) : -1;
+8010aa7a:	a8 02                	test   $0x2,%al
+8010aa7c:	75 0a                	jne    8010aa88 <pgfault+0x42>
+8010aa7e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa83:	e9 b5 00 00 00       	jmp    8010ab3d <pgfault+0xf7>
+8010aa88:	83 ec 08             	sub    $0x8,%esp
+8010aa8b:	53                   	push   %ebx
+8010aa8c:	ff 77 04             	push   0x4(%edi)
+8010aa8f:	e8 a7 fe ff ff       	call   8010a93b <cowfault>
+8010aa94:	83 c4 10             	add    $0x10,%esp
+8010aa97:	e9 a1 00 00 00       	jmp    8010ab3d <pgfault+0xf7>
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+8010aa9c:	83 c6 14             	add    $0x14,%esi
+8010aa9f:	8b 87 1c 01 00 00    	mov    0x11c(%edi),%eax
+8010aaa5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+8010aaa8:	8d 84 87 cc 00 00 00 	lea    0xcc(%edi,%eax,4),%eax
+8010aaaf:	39 c6                	cmp    %eax,%esi
+8010aab1:	0f 83 8e 00 00 00    	jae    8010ab45 <pgfault+0xff>
+    if(va < s->va || va - s->va >= s->filesz)
+8010aab7:	8b 06                	mov    (%esi),%eax
+8010aab9:	39 c3                	cmp    %eax,%ebx
+8010aabb:	72 df                	jb     8010aa9c <pgfault+0x56>
+8010aabd:	89 d9                	mov    %ebx,%ecx
+8010aabf:	29 c1                	sub    %eax,%ecx
+8010aac1:	8b 56 08             	mov    0x8(%esi),%edx
+8010aac4:	39 d1                	cmp    %edx,%ecx
+8010aac6:	73 d4                	jae    8010aa9c <pgfault+0x56>
+      continue;
+    n = s->filesz - (va - s->va);
+8010aac8:	29 d8                	sub    %ebx,%eax
+8010aaca:	01 c2                	add    %eax,%edx
+    if(n > PGSIZE)
+8010aacc:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+8010aad2:	76 05                	jbe    8010aad9 <pgfault+0x93>
+      n = PGSIZE;
+8010aad4:	ba 00 10 00 00       	mov    $0x1000,%edx
+    if((mem = pcget(p->exeip, s->off + (va - s->va), n)) == 0)
+8010aad9:	83 ec 04             	sub    $0x4,%esp
+8010aadc:	52                   	push   %edx
+8010aadd:	03 4e 0c             	add    0xc(%esi),%ecx
+8010aae0:	51                   	push   %ecx
+8010aae1:	ff b7 c8 00 00 00    	push   0xc8(%edi)
+8010aae7:	e8 82 9f ff ff       	call   80104a6e <pcget>
+8010aaec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010aaef:	83 c4 10             	add    $0x10,%esp
+8010aaf2:	85 c0                	test   %eax,%eax
+8010aaf4:	0f 84 a3 00 00 00    	je     8010ab9d <pgfault+0x157>
+      return -1;
+    perm = s->writable ? PTE_U|PTE_COW : PTE_U;
+8010aafa:	83 7e 10 00          	cmpl   $0x0,0x10(%esi)
+8010aafe:	74 53                	je     8010ab53 <pgfault+0x10d>
+8010ab00:	be 04 02 00 00       	mov    $0x204,%esi
+    break;
+  }
+  if(mem == 0 && (mem = kalloc_zeroed()) == 0)
+8010ab05:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+8010ab09:	74 4f                	je     8010ab5a <pgfault+0x114>
+    if (a < (void*) KERNBASE)
+8010ab0b:	81 7d e4 ff ff ff 7f 	cmpl   $0x7fffffff,-0x1c(%ebp)
+8010ab12:	76 59                	jbe    8010ab6d <pgfault+0x127>
+    return (uint)a - KERNBASE;
+8010ab14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ab17:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+    return -1;
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+8010ab1d:	8b 47 04             	mov    0x4(%edi),%eax
+8010ab20:	83 ec 08             	sub    $0x8,%esp
+8010ab23:	56                   	push   %esi
+8010ab24:	52                   	push   %edx
+8010ab25:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ab2a:	89 da                	mov    %ebx,%edx
+8010ab2c:	e8 0a f4 ff ff       	call   80109f3b <mappages>
+8010ab31:	83 c4 10             	add    $0x10,%esp
+8010ab34:	85 c0                	test   %eax,%eax
+8010ab36:	78 42                	js     8010ab7a <pgfault+0x134>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010ab38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010ab3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab40:	5b                   	pop    %ebx
+8010ab41:	5e                   	pop    %esi
+8010ab42:	5f                   	pop    %edi
+8010ab43:	5d                   	pop    %ebp
+8010ab44:	c3                   	ret
+  perm = PTE_W|PTE_U;
+8010ab45:	be 06 00 00 00       	mov    $0x6,%esi
+  mem = 0;
+8010ab4a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+8010ab51:	eb b2                	jmp    8010ab05 <pgfault+0xbf>
+    perm = s->writable ? PTE_U|PTE_COW : PTE_U;
+8010ab53:	be 04 00 00 00       	mov    $0x4,%esi
+8010ab58:	eb ab                	jmp    8010ab05 <pgfault+0xbf>
+  if(mem == 0 && (mem = kalloc_zeroed()) == 0)
+8010ab5a:	e8 12 8d ff ff       	call   80103871 <kalloc_zeroed>
+8010ab5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010ab62:	85 c0                	test   %eax,%eax
+8010ab64:	75 a5                	jne    8010ab0b <pgfault+0xc5>
+    return -1;
+8010ab66:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab6b:	eb d0                	jmp    8010ab3d <pgfault+0xf7>
+        panic("V2P on address < KERNBASE "
+8010ab6d:	83 ec 0c             	sub    $0xc,%esp
+8010ab70:	68 30 af 10 80       	push   $0x8010af30
+8010ab75:	e8 88 5d ff ff       	call   80100902 <panic>
+    kfree(mem);
+8010ab7a:	83 ec 0c             	sub    $0xc,%esp
+8010ab7d:	ff 75 e4             	push   -0x1c(%ebp)
+8010ab80:	e8 af 89 ff ff       	call   80103534 <kfree>
+    return -1;
+8010ab85:	83 c4 10             	add    $0x10,%esp
+8010ab88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab8d:	eb ae                	jmp    8010ab3d <pgfault+0xf7>
+    return -1;
+8010ab8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab94:	eb a7                	jmp    8010ab3d <pgfault+0xf7>
+8010ab96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab9b:	eb a0                	jmp    8010ab3d <pgfault+0xf7>
+      return -1;
+8010ab9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aba2:	eb 99                	jmp    8010ab3d <pgfault+0xf7>
+
+8010aba4 <prefault>:
+// in a program page may have to sleep reading the file.
+// If write is set, also check that the user could write them,
+// since the kernel writing a read-only page is a kernel fault.
+int
+prefault(struct proc *p, uint va, uint n, int write)
+{
+8010aba4:	55                   	push   %ebp
+8010aba5:	89 e5                	mov    %esp,%ebp
+8010aba7:	57                   	push   %edi
+8010aba8:	56                   	push   %esi
+8010aba9:	53                   	push   %ebx
+8010abaa:	83 ec 1c             	sub    $0x1c,%esp
+8010abad:	8b 75 08             	mov    0x8(%ebp),%esi
+8010abb0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+8010abb3:	89 fb                	mov    %edi,%ebx
+8010abb5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010abbb:	eb 1f                	jmp    8010abdc <prefault+0x38>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && pgfault(p, a, 0) < 0)
+8010abbd:	83 ec 04             	sub    $0x4,%esp
+8010abc0:	6a 00                	push   $0x0
+8010abc2:	53                   	push   %ebx
+8010abc3:	56                   	push   %esi
+8010abc4:	e8 7d fe ff ff       	call   8010aa46 <pgfault>
+8010abc9:	83 c4 10             	add    $0x10,%esp
+8010abcc:	85 c0                	test   %eax,%eax
+8010abce:	78 63                	js     8010ac33 <prefault+0x8f>
+      return -1;
+    if(write){
+8010abd0:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010abd4:	75 2c                	jne    8010ac02 <prefault+0x5e>
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+8010abd6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010abdc:	89 f8                	mov    %edi,%eax
+8010abde:	03 45 10             	add    0x10(%ebp),%eax
+8010abe1:	39 c3                	cmp    %eax,%ebx
+8010abe3:	73 41                	jae    8010ac26 <prefault+0x82>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010abe5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010abe8:	8b 46 04             	mov    0x4(%esi),%eax
+8010abeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010abf0:	89 da                	mov    %ebx,%edx
+8010abf2:	e8 cb f2 ff ff       	call   80109ec2 <walkpgdir>
+    if((pte == 0 || !(*pte & PTE_P)) && pgfault(p, a, 0) < 0)
+8010abf7:	85 c0                	test   %eax,%eax
+8010abf9:	74 c2                	je     8010abbd <prefault+0x19>
+8010abfb:	f6 00 01             	testb  $0x1,(%eax)
+8010abfe:	75 d0                	jne    8010abd0 <prefault+0x2c>
+8010ac00:	eb bb                	jmp    8010abbd <prefault+0x19>
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010ac02:	8b 46 04             	mov    0x4(%esi),%eax
+8010ac05:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ac0a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ac0d:	e8 b0 f2 ff ff       	call   80109ec2 <walkpgdir>
+      if(!(*pte & PTE_U) || !(*pte & (PTE_W|PTE_COW)))
+8010ac12:	8b 00                	mov    (%eax),%eax
+8010ac14:	a8 04                	test   $0x4,%al
+8010ac16:	74 22                	je     8010ac3a <prefault+0x96>
+8010ac18:	a9 02 02 00 00       	test   $0x202,%eax
+8010ac1d:	75 b7                	jne    8010abd6 <prefault+0x32>
+        return -1;
+8010ac1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ac24:	eb 05                	jmp    8010ac2b <prefault+0x87>
+    }
+  }
+  return 0;
+8010ac26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010ac2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac2e:	5b                   	pop    %ebx
+8010ac2f:	5e                   	pop    %esi
+8010ac30:	5f                   	pop    %edi
+8010ac31:	5d                   	pop    %ebp
+8010ac32:	c3                   	ret
+      return -1;
+8010ac33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ac38:	eb f1                	jmp    8010ac2b <prefault+0x87>
+        return -1;
+8010ac3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ac3f:	eb ea                	jmp    8010ac2b <prefault+0x87>
+
+8010ac41 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010ac41:	55                   	push   %ebp
+8010ac42:	89 e5                	mov    %esp,%ebp
+8010ac44:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010ac47:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ac4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010ac4f:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac52:	e8 6b f2 ff ff       	call   80109ec2 <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010ac57:	85 c0                	test   %eax,%eax
+8010ac59:	74 1b                	je     8010ac76 <uva2ka+0x35>
+8010ac5b:	8b 00                	mov    (%eax),%eax
+8010ac5d:	a8 01                	test   $0x1,%al
+8010ac5f:	74 24                	je     8010ac85 <uva2ka+0x44>
+    return 0;
+  if((*pte & PTE_U) == 0)
+8010ac61:	a8 04                	test   $0x4,%al
+8010ac63:	74 27                	je     8010ac8c <uva2ka+0x4b>
+8010ac65:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (a > KERNBASE)
+8010ac6a:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+8010ac6f:	77 07                	ja     8010ac78 <uva2ka+0x37>
+    return (char*)a + KERNBASE;
+8010ac71:	05 00 00 00 80       	add    $0x80000000,%eax
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+8010ac76:	c9                   	leave
+8010ac77:	c3                   	ret
+        panic("P2V on address > KERNBASE");
+8010ac78:	83 ec 0c             	sub    $0xc,%esp
+8010ac7b:	68 72 b3 10 80       	push   $0x8010b372
+8010ac80:	e8 7d 5c ff ff       	call   80100902 <panic>
+    return 0;
+8010ac85:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ac8a:	eb ea                	jmp    8010ac76 <uva2ka+0x35>
+    return 0;
+8010ac8c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ac91:	eb e3                	jmp    8010ac76 <uva2ka+0x35>
+
+8010ac93 <copyout>:
+// uva2ka ensures this only works for PTE_U pages.
+// Writes through the kernel mapping don't fault, so
+// copy-on-write pages are broken here first.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010ac93:	55                   	push   %ebp
+8010ac94:	89 e5                	mov    %esp,%ebp
+8010ac96:	57                   	push   %edi
+8010ac97:	56                   	push   %esi
+8010ac98:	53                   	push   %ebx
+8010ac99:	83 ec 0c             	sub    $0xc,%esp
+8010ac9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010ac9f:	eb 3a                	jmp    8010acdb <copyout+0x48>
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010aca1:	83 ec 08             	sub    $0x8,%esp
+8010aca4:	56                   	push   %esi
+8010aca5:	ff 75 08             	push   0x8(%ebp)
+8010aca8:	e8 8e fc ff ff       	call   8010a93b <cowfault>
+8010acad:	83 c4 10             	add    $0x10,%esp
+8010acb0:	85 c0                	test   %eax,%eax
+8010acb2:	79 4f                	jns    8010ad03 <copyout+0x70>
+      return -1;
+8010acb4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010acb9:	eb 74                	jmp    8010ad2f <copyout+0x9c>
+    if(pa0 == 0)
+      return -1;
+    n = PGSIZE - (va - va0);
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010acbb:	29 f7                	sub    %esi,%edi
+8010acbd:	01 f8                	add    %edi,%eax
+8010acbf:	83 ec 04             	sub    $0x4,%esp
+8010acc2:	53                   	push   %ebx
+8010acc3:	ff 75 10             	push   0x10(%ebp)
+8010acc6:	50                   	push   %eax
+8010acc7:	e8 a3 d0 ff ff       	call   80107d6f <memmove>
+    len -= n;
+8010accc:	29 5d 14             	sub    %ebx,0x14(%ebp)
+    buf += n;
+8010accf:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+8010acd2:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010acd8:	83 c4 10             	add    $0x10,%esp
+  while(len > 0){
+8010acdb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010acdf:	74 49                	je     8010ad2a <copyout+0x97>
+    va0 = (uint)PGROUNDDOWN(va);
+8010ace1:	89 fe                	mov    %edi,%esi
+8010ace3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+8010ace9:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010acee:	89 f2                	mov    %esi,%edx
+8010acf0:	8b 45 08             	mov    0x8(%ebp),%eax
+8010acf3:	e8 ca f1 ff ff       	call   80109ec2 <walkpgdir>
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010acf8:	85 c0                	test   %eax,%eax
+8010acfa:	74 07                	je     8010ad03 <copyout+0x70>
+8010acfc:	8b 00                	mov    (%eax),%eax
+8010acfe:	f6 c4 02             	test   $0x2,%ah
+8010ad01:	75 9e                	jne    8010aca1 <copyout+0xe>
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010ad03:	83 ec 08             	sub    $0x8,%esp
+8010ad06:	56                   	push   %esi
+8010ad07:	ff 75 08             	push   0x8(%ebp)
+8010ad0a:	e8 32 ff ff ff       	call   8010ac41 <uva2ka>
+    if(pa0 == 0)
+8010ad0f:	83 c4 10             	add    $0x10,%esp
+8010ad12:	85 c0                	test   %eax,%eax
+8010ad14:	74 21                	je     8010ad37 <copyout+0xa4>
+    n = PGSIZE - (va - va0);
+8010ad16:	89 f3                	mov    %esi,%ebx
+8010ad18:	29 fb                	sub    %edi,%ebx
+8010ad1a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    if(n > len)
+8010ad20:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+8010ad23:	73 96                	jae    8010acbb <copyout+0x28>
+      n = len;
+8010ad25:	8b 5d 14             	mov    0x14(%ebp),%ebx
+8010ad28:	eb 91                	jmp    8010acbb <copyout+0x28>
+  }
+  return 0;
+8010ad2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010ad2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad32:	5b                   	pop    %ebx
+8010ad33:	5e                   	pop    %esi
+8010ad34:	5f                   	pop    %edi
+8010ad35:	5d                   	pop    %ebp
+8010ad36:	c3                   	ret
+      return -1;
+8010ad37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ad3c:	eb f1                	jmp    8010ad2f <copyout+0x9c>
@@ -0,0 +1,512 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  12:	83 39 03             	cmpl   $0x3,(%ecx)
+  15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 74 03 00 00       	push   $0x374
+  1f:	6a 02                	push   $0x2
+  21:	e8 bb 01 00 00       	call   1e1 <printf>
+    exit();
+  26:	e8 39 00 00 00       	call   64 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	ff 73 08             	push   0x8(%ebx)
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 8b 00 00 00       	call   c4 <link>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  40:	e8 1f 00 00 00       	call   64 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  45:	ff 73 08             	push   0x8(%ebx)
+  48:	ff 73 04             	push   0x4(%ebx)
+  4b:	68 87 03 00 00       	push   $0x387
+  50:	6a 02                	push   $0x2
+  52:	e8 8a 01 00 00       	call   1e1 <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  61:	cd 40                	int    $0x40
+  63:	c3                   	ret
+
+00000064 <exit>:
+SYSCALL(exit)
+  64:	b8 02 00 00 00       	mov    $0x2,%eax
+  69:	cd 40                	int    $0x40
+  6b:	c3                   	ret
+
+0000006c <wait>:
+SYSCALL(wait)
+  6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  71:	cd 40                	int    $0x40
+  73:	c3                   	ret
+
+00000074 <pipe>:
+SYSCALL(pipe)
+  74:	b8 04 00 00 00       	mov    $0x4,%eax
+  79:	cd 40                	int    $0x40
+  7b:	c3                   	ret
+
+0000007c <read>:
+SYSCALL(read)
+  7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <write>:
+SYSCALL(write)
+  84:	b8 10 00 00 00       	mov    $0x10,%eax
+  89:	cd 40                	int    $0x40
+  8b:	c3                   	ret
+
+0000008c <close>:
+SYSCALL(close)
+  8c:	b8 15 00 00 00       	mov    $0x15,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <kill>:
+SYSCALL(kill)
+  94:	b8 06 00 00 00       	mov    $0x6,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <exec>:
+SYSCALL(exec)
+  9c:	b8 07 00 00 00       	mov    $0x7,%eax
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <open>:
+SYSCALL(open)
+  a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <mknod>:
+SYSCALL(mknod)
+  ac:	b8 11 00 00 00       	mov    $0x11,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <unlink>:
+SYSCALL(unlink)
+  b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <fstat>:
+SYSCALL(fstat)
+  bc:	b8 08 00 00 00       	mov    $0x8,%eax
+  c1:	cd 40                	int    $0x40
+  c3:	c3                   	ret
+
+000000c4 <link>:
+SYSCALL(link)
+  c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <mkdir>:
+SYSCALL(mkdir)
+  cc:	b8 14 00 00 00       	mov    $0x14,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <chdir>:
+SYSCALL(chdir)
+  d4:	b8 09 00 00 00       	mov    $0x9,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <dup>:
+SYSCALL(dup)
+  dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <getpid>:
+SYSCALL(getpid)
+  e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <sbrk>:
+SYSCALL(sbrk)
+  ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <sleep>:
+SYSCALL(sleep)
+  f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <uptime>:
+SYSCALL(uptime)
+  fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <yield>:
+SYSCALL(yield)
+ 104:	b8 16 00 00 00       	mov    $0x16,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <shutdown>:
+SYSCALL(shutdown)
+ 10c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <nicefork>:
+SYSCALL(nicefork)
+ 114:	b8 18 00 00 00       	mov    $0x18,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <schedlog>:
+SYSCALL(schedlog)
+ 11c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <schedstat>:
+SYSCALL(schedstat)
+ 124:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <spawn>:
+SYSCALL(spawn)
+ 12c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <bstat>:
+SYSCALL(bstat)
+ 134:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	83 ec 1c             	sub    $0x1c,%esp
+ 142:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 145:	6a 01                	push   $0x1
+ 147:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 14a:	52                   	push   %edx
+ 14b:	50                   	push   %eax
+ 14c:	e8 33 ff ff ff       	call   84 <write>
+}
+ 151:	83 c4 10             	add    $0x10,%esp
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+
+00000156 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 156:	55                   	push   %ebp
+ 157:	89 e5                	mov    %esp,%ebp
+ 159:	57                   	push   %edi
+ 15a:	56                   	push   %esi
+ 15b:	53                   	push   %ebx
+ 15c:	83 ec 2c             	sub    $0x2c,%esp
+ 15f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 162:	89 d0                	mov    %edx,%eax
+ 164:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 166:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 16a:	0f 95 c1             	setne  %cl
+ 16d:	c1 ea 1f             	shr    $0x1f,%edx
+ 170:	84 d1                	test   %dl,%cl
+ 172:	74 44                	je     1b8 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 174:	f7 d8                	neg    %eax
+ 176:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 178:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 17f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 184:	89 c8                	mov    %ecx,%eax
+ 186:	ba 00 00 00 00       	mov    $0x0,%edx
+ 18b:	f7 f6                	div    %esi
+ 18d:	89 df                	mov    %ebx,%edi
+ 18f:	83 c3 01             	add    $0x1,%ebx
+ 192:	0f b6 92 fc 03 00 00 	movzbl 0x3fc(%edx),%edx
+ 199:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 19d:	89 ca                	mov    %ecx,%edx
+ 19f:	89 c1                	mov    %eax,%ecx
+ 1a1:	39 f2                	cmp    %esi,%edx
+ 1a3:	73 df                	jae    184 <printint+0x2e>
+  if(neg)
+ 1a5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1a9:	74 31                	je     1dc <printint+0x86>
+    buf[i++] = '-';
+ 1ab:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1b0:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 1b3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1b6:	eb 17                	jmp    1cf <printint+0x79>
+    x = xx;
+ 1b8:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 1ba:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 1c1:	eb bc                	jmp    17f <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1c3:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 1c8:	89 f0                	mov    %esi,%eax
+ 1ca:	e8 6d ff ff ff       	call   13c <putc>
+  while(--i >= 0)
+ 1cf:	83 eb 01             	sub    $0x1,%ebx
+ 1d2:	79 ef                	jns    1c3 <printint+0x6d>
+}
+ 1d4:	83 c4 2c             	add    $0x2c,%esp
+ 1d7:	5b                   	pop    %ebx
+ 1d8:	5e                   	pop    %esi
+ 1d9:	5f                   	pop    %edi
+ 1da:	5d                   	pop    %ebp
+ 1db:	c3                   	ret
+ 1dc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1df:	eb ee                	jmp    1cf <printint+0x79>
+
+000001e1 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	57                   	push   %edi
+ 1e5:	56                   	push   %esi
+ 1e6:	53                   	push   %ebx
+ 1e7:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 1ea:	8d 45 10             	lea    0x10(%ebp),%eax
+ 1ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 1f0:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 1f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1fa:	eb 14                	jmp    210 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 1fc:	89 fa                	mov    %edi,%edx
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	e8 36 ff ff ff       	call   13c <putc>
+ 206:	eb 05                	jmp    20d <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 208:	83 fe 25             	cmp    $0x25,%esi
+ 20b:	74 25                	je     232 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 20d:	83 c3 01             	add    $0x1,%ebx
+ 210:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 213:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 217:	84 c0                	test   %al,%al
+ 219:	0f 84 4a 01 00 00    	je     369 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 21f:	0f be f8             	movsbl %al,%edi
+ 222:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 225:	85 f6                	test   %esi,%esi
+ 227:	75 df                	jne    208 <printf+0x27>
+      if(c == '%'){
+ 229:	83 f8 25             	cmp    $0x25,%eax
+ 22c:	75 ce                	jne    1fc <printf+0x1b>
+        state = '%';
+ 22e:	89 c6                	mov    %eax,%esi
+ 230:	eb db                	jmp    20d <printf+0x2c>
+      if(c == 'd'){
+ 232:	83 f8 25             	cmp    $0x25,%eax
+ 235:	0f 84 f9 00 00 00    	je     334 <printf+0x153>
+ 23b:	0f 8c 07 01 00 00    	jl     348 <printf+0x167>
+ 241:	83 f8 78             	cmp    $0x78,%eax
+ 244:	0f 8f fe 00 00 00    	jg     348 <printf+0x167>
+ 24a:	83 f8 63             	cmp    $0x63,%eax
+ 24d:	0f 8c f5 00 00 00    	jl     348 <printf+0x167>
+ 253:	83 e8 63             	sub    $0x63,%eax
+ 256:	83 f8 15             	cmp    $0x15,%eax
+ 259:	0f 87 e9 00 00 00    	ja     348 <printf+0x167>
+ 25f:	ff 24 85 a4 03 00 00 	jmp    *0x3a4(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 266:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 269:	8b 17                	mov    (%edi),%edx
+ 26b:	83 ec 0c             	sub    $0xc,%esp
+ 26e:	6a 01                	push   $0x1
+ 270:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	e8 d9 fe ff ff       	call   156 <printint>
+        ap++;
+ 27d:	83 c7 04             	add    $0x4,%edi
+ 280:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 283:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 286:	be 00 00 00 00       	mov    $0x0,%esi
+ 28b:	eb 80                	jmp    20d <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 28d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 290:	8b 17                	mov    (%edi),%edx
+ 292:	83 ec 0c             	sub    $0xc,%esp
+ 295:	6a 00                	push   $0x0
+ 297:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 29c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29f:	e8 b2 fe ff ff       	call   156 <printint>
+        ap++;
+ 2a4:	83 c7 04             	add    $0x4,%edi
+ 2a7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2aa:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2ad:	be 00 00 00 00       	mov    $0x0,%esi
+ 2b2:	e9 56 ff ff ff       	jmp    20d <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2ba:	8b 17                	mov    (%edi),%edx
+ 2bc:	83 ec 0c             	sub    $0xc,%esp
+ 2bf:	6a 00                	push   $0x0
+ 2c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c9:	e8 88 fe ff ff       	call   156 <printint>
+        ap++;
+ 2ce:	83 c7 04             	add    $0x4,%edi
+ 2d1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2d4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2d7:	be 00 00 00 00       	mov    $0x0,%esi
+ 2dc:	e9 2c ff ff ff       	jmp    20d <printf+0x2c>
+        s = (char*)*ap;
+ 2e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2e4:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2e6:	83 c0 04             	add    $0x4,%eax
+ 2e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 2ec:	85 f6                	test   %esi,%esi
+ 2ee:	75 15                	jne    305 <printf+0x124>
+          s = "(null)";
+ 2f0:	be 9b 03 00 00       	mov    $0x39b,%esi
+ 2f5:	eb 0e                	jmp    305 <printf+0x124>
+          putc(fd, *s);
+ 2f7:	0f be d2             	movsbl %dl,%edx
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	e8 3a fe ff ff       	call   13c <putc>
+          s++;
+ 302:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 305:	0f b6 16             	movzbl (%esi),%edx
+ 308:	84 d2                	test   %dl,%dl
+ 30a:	75 eb                	jne    2f7 <printf+0x116>
+      state = 0;
+ 30c:	be 00 00 00 00       	mov    $0x0,%esi
+ 311:	e9 f7 fe ff ff       	jmp    20d <printf+0x2c>
+        putc(fd, *ap);
+ 316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 319:	0f be 17             	movsbl (%edi),%edx
+ 31c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31f:	e8 18 fe ff ff       	call   13c <putc>
+        ap++;
+ 324:	83 c7 04             	add    $0x4,%edi
+ 327:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 32a:	be 00 00 00 00       	mov    $0x0,%esi
+ 32f:	e9 d9 fe ff ff       	jmp    20d <printf+0x2c>
+        putc(fd, c);
+ 334:	89 fa                	mov    %edi,%edx
+ 336:	8b 45 08             	mov    0x8(%ebp),%eax
+ 339:	e8 fe fd ff ff       	call   13c <putc>
+      state = 0;
+ 33e:	be 00 00 00 00       	mov    $0x0,%esi
+ 343:	e9 c5 fe ff ff       	jmp    20d <printf+0x2c>
+        putc(fd, '%');
+ 348:	ba 25 00 00 00       	mov    $0x25,%edx
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	e8 e7 fd ff ff       	call   13c <putc>
+        putc(fd, c);
+ 355:	89 fa                	mov    %edi,%edx
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	e8 dd fd ff ff       	call   13c <putc>
+      state = 0;
+ 35f:	be 00 00 00 00       	mov    $0x0,%esi
+ 364:	e9 a4 fe ff ff       	jmp    20d <printf+0x2c>
+    }
+  }
+}
+ 369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36c:	5b                   	pop    %ebx
+ 36d:	5e                   	pop    %esi
+ 36e:	5f                   	pop    %edi
+ 36f:	5d                   	pop    %ebp
+ 370:	c3                   	ret
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -18,62 +19,129 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the commit thread has taken the transaction.
+//
+// Commits are done by a kernel thread (see committer), so
+// end_op() never waits for the disk. Once no FS system call
+// is active, the committer freezes the open transaction:
+// it copies the modified blocks into the log buffers and
+// moves the header to a second, committing, header, which
+// takes only memory copies. New FS system calls then start
+// a fresh transaction while the committer writes the log,
+// the header and the home locations. Transactions that end
+// while a commit is in progress are grouped into the next.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+//   header blocks, containing block #s for block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// mkfs sizes the log. The header takes as many blocks as it
+// needs to describe the rest; the first header block, holding
+// the count, is written last, and is the commit point. The log
+// blocks of a commit are written as one batch.
 
-// Contents of the header block, used for both the on-disk header block
+// Contents of the header blocks, used for both the on-disk header
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  int block[MAXLOGSIZE];
 };
 
+#define HPB     (BSIZE / sizeof(int))  // Header words per block
+#define NLHASH  256                    // Absorption hash buckets
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int freezing;    // committer is copying the transaction, please wait.
+  int committing;  // committer is writing clh to disk.
   int dev;
-  struct logheader lh;
+  int nhead;       // header blocks
+  int cap;         // most blocks one commit can log
+  struct logheader lh;   // The open transaction
+  struct logheader clh;  // The transaction being committed
+  // Hash of lh.block, for absorption: chains of indices into
+  // lh.block through lhnext, -1 terminated.
+  short lhhead[NLHASH];
+  short lhnext[MAXLOGSIZE];
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void committer(void);
+
+// Holds a block being installed from the log when
+// the cached copy has changed since (see install_trans).
+// Page-aligned so its data cannot cross the 64KB physical
+// boundary that bus-master DMA (ide.c) must not cross.
+static struct buf ibuf __attribute__((aligned(PGSIZE)));
+
+// Empty the open transaction. Caller holds log.lock.
+static void
+lhclear(void)
+{
+  log.lh.n = 0;
+  memset(log.lhhead, 0xff, sizeof(log.lhhead));
+}
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
+  int h;
+
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+
+  // Fewest header blocks that can describe the rest of the log.
+  for (h = 1; h * HPB - 1 < log.size - h; h++)
+    ;
+  log.nhead = h;
+  log.cap = log.size - h;
+  if (log.cap > MAXLOGSIZE)
+    log.cap = MAXLOGSIZE;
+  if (log.cap < MAXOPBLOCKS)
+    panic("initlog: log too small");
+  lhclear();
+
   recover_from_log();
+
+  initsleeplock(&ibuf.lock, "logibuf");
+  if(kthread("committer", committer, 0) < 0)
+    panic("initlog: committer");
 }
 
-// Copy committed blocks from log to their home location
+// Index of block b in the open transaction, or -1.
+// Caller holds log.lock.
+static int
+lhfind(uint b)
+{
+  int i;
+
+  for (i = log.lhhead[b % NLHASH]; i >= 0; i = log.lhnext[i])
+    if (log.lh.block[i] == b)
+      return i;
+  return -1;
+}
+
+// Copy committed blocks from log to their home location.
+// Only recovery reads the log back.
 static void
-install_trans(void)
+install_from_log(struct logheader *h)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+  for (tail = 0; tail < h->n; tail++) {
+    struct buf *lbuf = bread(log.dev, log.start+log.nhead+tail); // read log block
+    struct buf *dbuf = bread(log.dev, h->block[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
     bwrite(dbuf);  // write dst to disk
     brelse(lbuf);
@@ -81,44 +149,105 @@ install_trans(void)
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Write the committed blocks to their home locations from the
+// cache, where they are still pinned, rather than from the log.
+// The writes are started together, without holding one cached
+// block while waiting for another, since FS system calls of the
+// open transaction may hold them. lbuf holds the logged copies.
 static void
-read_head(void)
+install_trans(struct buf **lbuf)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  static char started[MAXLOGSIZE];
+  struct buf *b;
+  int tail;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+    b = bread(log.dev, log.clh.block[tail]);  // cached: no disk read
+    acquire(&log.lock);
+    started[tail] = lhfind(b->blockno) < 0;
+    release(&log.lock);
+    if (started[tail]) {
+      // Unchanged since it was logged: write it as it is,
+      // holding a reference so it stays cached until we wait.
+      bpin(b);
+      bawrite(b);
+    } else {
+      // The open transaction has changed the cached block since
+      // it was logged. Write the logged copy behind the cache's
+      // back; the cached one stays pinned until its own commit.
+      brelse(b);
+      acquiresleep(&ibuf.lock);
+      ibuf.dev = log.dev;
+      ibuf.blockno = log.clh.block[tail];
+      ibuf.flags = B_VALID | B_DIRTY;
+      memmove(ibuf.data, lbuf[tail]->data, BSIZE);
+      iderw(&ibuf);
+      releasesleep(&ibuf.lock);
+    }
+  }
+
+  // Wait for the writes: the driver unlocks each block when
+  // its write completes.
+  for (tail = 0; tail < log.clh.n; tail++) {
+    if (!started[tail])
+      continue;
+    b = bread(log.dev, log.clh.block[tail]);
+    bunpin(b);
+    brelse(b);
   }
-  brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Read the log header from disk into h
 static void
-write_head(void)
+read_head(struct logheader *h)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  struct buf *buf = 0;
+  int i, nw;
+
+  nw = 1;
+  for (i = 0; i < nw; i++) {
+    if (i % HPB == 0)
+      buf = bread(log.dev, log.start + i / HPB);
+    ((int*)h)[i] = ((int*)buf->data)[i % HPB];
+    if (i == 0) {
+      if (h->n < 0 || h->n > log.cap)
+        panic("read_head");
+      nw = 1 + h->n;
+    }
+    if (i % HPB == HPB - 1 || i == nw - 1)
+      brelse(buf);
   }
-  bwrite(buf);
-  brelse(buf);
+}
+
+// Write in-memory log header h to disk, the first block last.
+// Writing the first block, which holds the count, is the
+// true point at which the current transaction commits.
+static void
+write_head(struct logheader *h)
+{
+  static struct buf *hbuf[MAXLOGSIZE / HPB + 1];
+  int i, nb;
+
+  nb = (1 + h->n + HPB - 1) / HPB;
+  for (i = 0; i < nb; i++) {
+    hbuf[i] = bread(log.dev, log.start + i);
+    memmove(hbuf[i]->data, (int*)h + i * HPB,
+            i == nb - 1 ? ((1 + h->n) - i * HPB) * sizeof(int) : BSIZE);
+  }
+  if (nb > 1)
+    bwritev(hbuf + 1, nb - 1);
+  bwrite(hbuf[0]);
+  for (i = 0; i < nb; i++)
+    brelse(hbuf[i]);
 }
 
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  read_head(&log.clh);
+  install_from_log(&log.clh); // if committed, copy from log to disk
+  log.clh.n = 0;
+  write_head(&log.clh); // clear the log
 }
 
 // called at the start of each FS system call.
@@ -127,10 +256,11 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.freezing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > log.cap){
       // this op might exhaust log space; wait for commit.
+      wakeup(&log.clh);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
@@ -141,69 +271,103 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// hands the transaction to the committer if this was
+// the last outstanding operation.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
-  }
+  if(log.freezing)
+    panic("log.freezing");
+  if(log.outstanding == 0 && log.lh.n > 0)
+    wakeup(&log.clh);
+  // begin_op() may be waiting for log space,
+  // and decrementing log.outstanding has decreased
+  // the amount of reserved space.
+  wakeup(&log);
   release(&log.lock);
-
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
-  }
 }
 
-// Copy modified blocks from cache to log.
+// Copy modified blocks from cache to the log buffers, returned
+// locked in lbuf. Nothing may change the blocks meanwhile.
 static void
-write_log(void)
+copy_log(struct buf **lbuf)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < log.clh.n; tail++) {
+    struct buf *to = bread(log.dev, log.start+log.nhead+tail); // log block
+    struct buf *from = bread(log.dev, log.clh.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
     brelse(from);
-    brelse(to);
+    lbuf[tail] = to;
   }
 }
 
+// Write the log buffers to disk in one batch.
 static void
-commit()
+write_log(struct buf **lbuf)
+{
+  bwritev(lbuf, log.clh.n);
+}
+
+// The commit thread. Waits for a transaction with no FS system
+// calls active, freezes it and commits it while the next one
+// accumulates.
+static void
+committer(void)
+{
+  static struct buf *lbuf[MAXLOGSIZE];
+  int i;
+
+  acquire(&log.lock);
+  for(;;){
+    while(log.lh.n == 0 || log.outstanding > 0)
+      sleep(&log.clh, &log.lock);
+
+    log.freezing = 1;
+    log.committing = 1;
+    log.clh = log.lh;
+    lhclear();
+    release(&log.lock);
+
+    copy_log(lbuf);
+
+    acquire(&log.lock);
+    log.freezing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    write_log(lbuf);            // Write modified blocks to log
+    write_head(&log.clh);       // Write header to disk -- the real commit
+    install_trans(lbuf);        // Now install writes to home locations
+    for (i = 0; i < log.clh.n; i++)
+      brelse(lbuf[i]);
+    log.clh.n = 0;
+    write_head(&log.clh);       // Erase the transaction from the log
+
+    acquire(&log.lock);
+    log.committing = 0;
+    wakeup(&log);
+  }
+}
+
+// Wait until every transaction that has ended is on disk.
+void
+log_sync(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  acquire(&log.lock);
+  while(log.lh.n > 0 || log.committing){
+    wakeup(&log.clh);
+    sleep(&log, &log.lock);
   }
+  release(&log.lock);
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// The committer will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -215,20 +379,18 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.cap)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
-      break;
+  if (lhfind(b->blockno) < 0) {   // log absorbtion
+    i = log.lh.n++;
+    log.lh.block[i] = b->blockno;
+    log.lhnext[i] = log.lhhead[b->blockno % NLHASH];
+    log.lhhead[b->blockno % NLHASH] = i;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
-
@@ -17,7 +17,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
-  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  kinit1(end, P2V(EARLYMEM)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
@@ -28,11 +28,12 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
+  pcinit();        // executable page cache
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(EARLYMEM), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized from memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
@@ -98,13 +99,20 @@ startothers(void)
 // Page directories (and page tables) must start on page boundaries,
 // hence the __aligned__ attribute.
 // PTE_PS in a page directory entry enables 4Mbyte pages.
+// It maps EARLYMEM (16MB), enough for a kernelmemfs image
+// that carries the whole file system.
+
+#define BIG(i)  (((i)<<22) | PTE_P | PTE_W | PTE_PS)
 
 __attribute__((__aligned__(PGSIZE)))
 pde_t entrypgdir[NPDENTRIES] = {
-  // Map VA's [0, 4MB) to PA's [0, 4MB)
-  [0] = (0) | PTE_P | PTE_W | PTE_PS,
-  // Map VA's [KERNBASE, KERNBASE+4MB) to PA's [0, 4MB)
-  [KERNBASE>>PDXSHIFT] = (0) | PTE_P | PTE_W | PTE_PS,
+  // Map VA's [0, 16MB) to PA's [0, 16MB)
+  [0] = BIG(0), [1] = BIG(1), [2] = BIG(2), [3] = BIG(3),
+  // Map VA's [KERNBASE, KERNBASE+16MB) to PA's [0, 16MB)
+  [(KERNBASE>>PDXSHIFT)+0] = BIG(0),
+  [(KERNBASE>>PDXSHIFT)+1] = BIG(1),
+  [(KERNBASE>>PDXSHIFT)+2] = BIG(2),
+  [(KERNBASE>>PDXSHIFT)+3] = BIG(3),
 };
 
 //PAGEBREAK!
@@ -58,3 +58,20 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+void
+iderwv(struct buf **b, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(b[i]);
+}
+
+// The memory disk completes b at once, then releases it.
+void
+idesubmit(struct buf *b)
+{
+  iderw(b);
+  bdone(b);
+}
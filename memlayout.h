@@ -2,6 +2,7 @@
 
 #define EXTMEM  0x100000            // Start of extended memory
 #define PHYSTOP 0xE000000           // Top physical memory
+#define EARLYMEM 0x1000000          // Memory entrypgdir maps (kernel image + kinit1)
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
 
 // Key addresses for address space layout (see kmap in vm.c for layout)
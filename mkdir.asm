@@ -0,0 +1,532 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i;
+
+  if(argc < 2){
+  1c:	83 ff 01             	cmp    $0x1,%edi
+  1f:	7e 07                	jle    28 <main+0x28>
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  21:	bb 01 00 00 00       	mov    $0x1,%ebx
+  26:	eb 17                	jmp    3f <main+0x3f>
+    printf(2, "Usage: mkdir files...\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 88 03 00 00       	push   $0x388
+  30:	6a 02                	push   $0x2
+  32:	e8 c1 01 00 00       	call   1f8 <printf>
+    exit();
+  37:	e8 3f 00 00 00       	call   7b <exit>
+  for(i = 1; i < argc; i++){
+  3c:	83 c3 01             	add    $0x1,%ebx
+  3f:	39 fb                	cmp    %edi,%ebx
+  41:	7d 2b                	jge    6e <main+0x6e>
+    if(mkdir(argv[i]) < 0){
+  43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  46:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	ff 36                	push   (%esi)
+  4e:	e8 90 00 00 00       	call   e3 <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 e2                	jns    3c <main+0x3c>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	83 ec 04             	sub    $0x4,%esp
+  5d:	ff 36                	push   (%esi)
+  5f:	68 9f 03 00 00       	push   $0x39f
+  64:	6a 02                	push   $0x2
+  66:	e8 8d 01 00 00       	call   1f8 <printf>
+      break;
+  6b:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  6e:	e8 08 00 00 00       	call   7b <exit>
+
+00000073 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  73:	b8 01 00 00 00       	mov    $0x1,%eax
+  78:	cd 40                	int    $0x40
+  7a:	c3                   	ret
+
+0000007b <exit>:
+SYSCALL(exit)
+  7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  80:	cd 40                	int    $0x40
+  82:	c3                   	ret
+
+00000083 <wait>:
+SYSCALL(wait)
+  83:	b8 03 00 00 00       	mov    $0x3,%eax
+  88:	cd 40                	int    $0x40
+  8a:	c3                   	ret
+
+0000008b <pipe>:
+SYSCALL(pipe)
+  8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  90:	cd 40                	int    $0x40
+  92:	c3                   	ret
+
+00000093 <read>:
+SYSCALL(read)
+  93:	b8 05 00 00 00       	mov    $0x5,%eax
+  98:	cd 40                	int    $0x40
+  9a:	c3                   	ret
+
+0000009b <write>:
+SYSCALL(write)
+  9b:	b8 10 00 00 00       	mov    $0x10,%eax
+  a0:	cd 40                	int    $0x40
+  a2:	c3                   	ret
+
+000000a3 <close>:
+SYSCALL(close)
+  a3:	b8 15 00 00 00       	mov    $0x15,%eax
+  a8:	cd 40                	int    $0x40
+  aa:	c3                   	ret
+
+000000ab <kill>:
+SYSCALL(kill)
+  ab:	b8 06 00 00 00       	mov    $0x6,%eax
+  b0:	cd 40                	int    $0x40
+  b2:	c3                   	ret
+
+000000b3 <exec>:
+SYSCALL(exec)
+  b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  b8:	cd 40                	int    $0x40
+  ba:	c3                   	ret
+
+000000bb <open>:
+SYSCALL(open)
+  bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  c0:	cd 40                	int    $0x40
+  c2:	c3                   	ret
+
+000000c3 <mknod>:
+SYSCALL(mknod)
+  c3:	b8 11 00 00 00       	mov    $0x11,%eax
+  c8:	cd 40                	int    $0x40
+  ca:	c3                   	ret
+
+000000cb <unlink>:
+SYSCALL(unlink)
+  cb:	b8 12 00 00 00       	mov    $0x12,%eax
+  d0:	cd 40                	int    $0x40
+  d2:	c3                   	ret
+
+000000d3 <fstat>:
+SYSCALL(fstat)
+  d3:	b8 08 00 00 00       	mov    $0x8,%eax
+  d8:	cd 40                	int    $0x40
+  da:	c3                   	ret
+
+000000db <link>:
+SYSCALL(link)
+  db:	b8 13 00 00 00       	mov    $0x13,%eax
+  e0:	cd 40                	int    $0x40
+  e2:	c3                   	ret
+
+000000e3 <mkdir>:
+SYSCALL(mkdir)
+  e3:	b8 14 00 00 00       	mov    $0x14,%eax
+  e8:	cd 40                	int    $0x40
+  ea:	c3                   	ret
+
+000000eb <chdir>:
+SYSCALL(chdir)
+  eb:	b8 09 00 00 00       	mov    $0x9,%eax
+  f0:	cd 40                	int    $0x40
+  f2:	c3                   	ret
+
+000000f3 <dup>:
+SYSCALL(dup)
+  f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  f8:	cd 40                	int    $0x40
+  fa:	c3                   	ret
+
+000000fb <getpid>:
+SYSCALL(getpid)
+  fb:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 100:	cd 40                	int    $0x40
+ 102:	c3                   	ret
+
+00000103 <sbrk>:
+SYSCALL(sbrk)
+ 103:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 108:	cd 40                	int    $0x40
+ 10a:	c3                   	ret
+
+0000010b <sleep>:
+SYSCALL(sleep)
+ 10b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 110:	cd 40                	int    $0x40
+ 112:	c3                   	ret
+
+00000113 <uptime>:
+SYSCALL(uptime)
+ 113:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 118:	cd 40                	int    $0x40
+ 11a:	c3                   	ret
+
+0000011b <yield>:
+SYSCALL(yield)
+ 11b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 120:	cd 40                	int    $0x40
+ 122:	c3                   	ret
+
+00000123 <shutdown>:
+SYSCALL(shutdown)
+ 123:	b8 17 00 00 00       	mov    $0x17,%eax
+ 128:	cd 40                	int    $0x40
+ 12a:	c3                   	ret
+
+0000012b <nicefork>:
+SYSCALL(nicefork)
+ 12b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 130:	cd 40                	int    $0x40
+ 132:	c3                   	ret
+
+00000133 <schedlog>:
+SYSCALL(schedlog)
+ 133:	b8 19 00 00 00       	mov    $0x19,%eax
+ 138:	cd 40                	int    $0x40
+ 13a:	c3                   	ret
+
+0000013b <schedstat>:
+SYSCALL(schedstat)
+ 13b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 140:	cd 40                	int    $0x40
+ 142:	c3                   	ret
+
+00000143 <spawn>:
+SYSCALL(spawn)
+ 143:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 148:	cd 40                	int    $0x40
+ 14a:	c3                   	ret
+
+0000014b <bstat>:
+SYSCALL(bstat)
+ 14b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 150:	cd 40                	int    $0x40
+ 152:	c3                   	ret
+
+00000153 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 153:	55                   	push   %ebp
+ 154:	89 e5                	mov    %esp,%ebp
+ 156:	83 ec 1c             	sub    $0x1c,%esp
+ 159:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 15c:	6a 01                	push   $0x1
+ 15e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 161:	52                   	push   %edx
+ 162:	50                   	push   %eax
+ 163:	e8 33 ff ff ff       	call   9b <write>
+}
+ 168:	83 c4 10             	add    $0x10,%esp
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+
+0000016d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 16d:	55                   	push   %ebp
+ 16e:	89 e5                	mov    %esp,%ebp
+ 170:	57                   	push   %edi
+ 171:	56                   	push   %esi
+ 172:	53                   	push   %ebx
+ 173:	83 ec 2c             	sub    $0x2c,%esp
+ 176:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 179:	89 d0                	mov    %edx,%eax
+ 17b:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 17d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 181:	0f 95 c1             	setne  %cl
+ 184:	c1 ea 1f             	shr    $0x1f,%edx
+ 187:	84 d1                	test   %dl,%cl
+ 189:	74 44                	je     1cf <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 18b:	f7 d8                	neg    %eax
+ 18d:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 18f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1a2:	f7 f6                	div    %esi
+ 1a4:	89 df                	mov    %ebx,%edi
+ 1a6:	83 c3 01             	add    $0x1,%ebx
+ 1a9:	0f b6 92 1c 04 00 00 	movzbl 0x41c(%edx),%edx
+ 1b0:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 1b4:	89 ca                	mov    %ecx,%edx
+ 1b6:	89 c1                	mov    %eax,%ecx
+ 1b8:	39 f2                	cmp    %esi,%edx
+ 1ba:	73 df                	jae    19b <printint+0x2e>
+  if(neg)
+ 1bc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1c0:	74 31                	je     1f3 <printint+0x86>
+    buf[i++] = '-';
+ 1c2:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 1c7:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 1ca:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1cd:	eb 17                	jmp    1e6 <printint+0x79>
+    x = xx;
+ 1cf:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 1d1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 1d8:	eb bc                	jmp    196 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1da:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 1df:	89 f0                	mov    %esi,%eax
+ 1e1:	e8 6d ff ff ff       	call   153 <putc>
+  while(--i >= 0)
+ 1e6:	83 eb 01             	sub    $0x1,%ebx
+ 1e9:	79 ef                	jns    1da <printint+0x6d>
+}
+ 1eb:	83 c4 2c             	add    $0x2c,%esp
+ 1ee:	5b                   	pop    %ebx
+ 1ef:	5e                   	pop    %esi
+ 1f0:	5f                   	pop    %edi
+ 1f1:	5d                   	pop    %ebp
+ 1f2:	c3                   	ret
+ 1f3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 1f6:	eb ee                	jmp    1e6 <printint+0x79>
+
+000001f8 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+ 1fb:	57                   	push   %edi
+ 1fc:	56                   	push   %esi
+ 1fd:	53                   	push   %ebx
+ 1fe:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 201:	8d 45 10             	lea    0x10(%ebp),%eax
+ 204:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 207:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 20c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 211:	eb 14                	jmp    227 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 213:	89 fa                	mov    %edi,%edx
+ 215:	8b 45 08             	mov    0x8(%ebp),%eax
+ 218:	e8 36 ff ff ff       	call   153 <putc>
+ 21d:	eb 05                	jmp    224 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 21f:	83 fe 25             	cmp    $0x25,%esi
+ 222:	74 25                	je     249 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 224:	83 c3 01             	add    $0x1,%ebx
+ 227:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22a:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 22e:	84 c0                	test   %al,%al
+ 230:	0f 84 4a 01 00 00    	je     380 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 236:	0f be f8             	movsbl %al,%edi
+ 239:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 23c:	85 f6                	test   %esi,%esi
+ 23e:	75 df                	jne    21f <printf+0x27>
+      if(c == '%'){
+ 240:	83 f8 25             	cmp    $0x25,%eax
+ 243:	75 ce                	jne    213 <printf+0x1b>
+        state = '%';
+ 245:	89 c6                	mov    %eax,%esi
+ 247:	eb db                	jmp    224 <printf+0x2c>
+      if(c == 'd'){
+ 249:	83 f8 25             	cmp    $0x25,%eax
+ 24c:	0f 84 f9 00 00 00    	je     34b <printf+0x153>
+ 252:	0f 8c 07 01 00 00    	jl     35f <printf+0x167>
+ 258:	83 f8 78             	cmp    $0x78,%eax
+ 25b:	0f 8f fe 00 00 00    	jg     35f <printf+0x167>
+ 261:	83 f8 63             	cmp    $0x63,%eax
+ 264:	0f 8c f5 00 00 00    	jl     35f <printf+0x167>
+ 26a:	83 e8 63             	sub    $0x63,%eax
+ 26d:	83 f8 15             	cmp    $0x15,%eax
+ 270:	0f 87 e9 00 00 00    	ja     35f <printf+0x167>
+ 276:	ff 24 85 c4 03 00 00 	jmp    *0x3c4(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 27d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 280:	8b 17                	mov    (%edi),%edx
+ 282:	83 ec 0c             	sub    $0xc,%esp
+ 285:	6a 01                	push   $0x1
+ 287:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	e8 d9 fe ff ff       	call   16d <printint>
+        ap++;
+ 294:	83 c7 04             	add    $0x4,%edi
+ 297:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 29a:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 29d:	be 00 00 00 00       	mov    $0x0,%esi
+ 2a2:	eb 80                	jmp    224 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 2a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2a7:	8b 17                	mov    (%edi),%edx
+ 2a9:	83 ec 0c             	sub    $0xc,%esp
+ 2ac:	6a 00                	push   $0x0
+ 2ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	e8 b2 fe ff ff       	call   16d <printint>
+        ap++;
+ 2bb:	83 c7 04             	add    $0x4,%edi
+ 2be:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2c1:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2c4:	be 00 00 00 00       	mov    $0x0,%esi
+ 2c9:	e9 56 ff ff ff       	jmp    224 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 2ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2d1:	8b 17                	mov    (%edi),%edx
+ 2d3:	83 ec 0c             	sub    $0xc,%esp
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e0:	e8 88 fe ff ff       	call   16d <printint>
+        ap++;
+ 2e5:	83 c7 04             	add    $0x4,%edi
+ 2e8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2eb:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2ee:	be 00 00 00 00       	mov    $0x0,%esi
+ 2f3:	e9 2c ff ff ff       	jmp    224 <printf+0x2c>
+        s = (char*)*ap;
+ 2f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2fb:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 2fd:	83 c0 04             	add    $0x4,%eax
+ 300:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 303:	85 f6                	test   %esi,%esi
+ 305:	75 15                	jne    31c <printf+0x124>
+          s = "(null)";
+ 307:	be bb 03 00 00       	mov    $0x3bb,%esi
+ 30c:	eb 0e                	jmp    31c <printf+0x124>
+          putc(fd, *s);
+ 30e:	0f be d2             	movsbl %dl,%edx
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+ 314:	e8 3a fe ff ff       	call   153 <putc>
+          s++;
+ 319:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 31c:	0f b6 16             	movzbl (%esi),%edx
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	75 eb                	jne    30e <printf+0x116>
+      state = 0;
+ 323:	be 00 00 00 00       	mov    $0x0,%esi
+ 328:	e9 f7 fe ff ff       	jmp    224 <printf+0x2c>
+        putc(fd, *ap);
+ 32d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 330:	0f be 17             	movsbl (%edi),%edx
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	e8 18 fe ff ff       	call   153 <putc>
+        ap++;
+ 33b:	83 c7 04             	add    $0x4,%edi
+ 33e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 341:	be 00 00 00 00       	mov    $0x0,%esi
+ 346:	e9 d9 fe ff ff       	jmp    224 <printf+0x2c>
+        putc(fd, c);
+ 34b:	89 fa                	mov    %edi,%edx
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	e8 fe fd ff ff       	call   153 <putc>
+      state = 0;
+ 355:	be 00 00 00 00       	mov    $0x0,%esi
+ 35a:	e9 c5 fe ff ff       	jmp    224 <printf+0x2c>
+        putc(fd, '%');
+ 35f:	ba 25 00 00 00       	mov    $0x25,%edx
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	e8 e7 fd ff ff       	call   153 <putc>
+        putc(fd, c);
+ 36c:	89 fa                	mov    %edi,%edx
+ 36e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 371:	e8 dd fd ff ff       	call   153 <putc>
+      state = 0;
+ 376:	be 00 00 00 00       	mov    $0x0,%esi
+ 37b:	e9 a4 fe ff ff       	jmp    224 <printf+0x2c>
+    }
+  }
+}
+ 380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 383:	5b                   	pop    %ebx
+ 384:	5e                   	pop    %esi
+ 385:	5f                   	pop    %edi
+ 386:	5d                   	pop    %ebp
+ 387:	c3                   	ret
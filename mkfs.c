@@ -76,8 +76,13 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  if(argc > 2 && strcmp(argv[1], "-l") == 0){
+    nlog = atoi(argv[2]);
+    argv += 2;
+    argc -= 2;
+  }
+  if(argc < 2 || nlog <= MAXOPBLOCKS || nlog > MAXLOGSIZE){
+    fprintf(stderr, "Usage: mkfs [-l logblocks] fs.img files...\n");
     exit(1);
   }
 
@@ -260,6 +265,20 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return entry i of indirect block addr, allocating if necessary.
+uint
+indirect(uint addr, uint i)
+{
+  uint a[NINDIRECT];
+
+  rsect(addr, (char*)a);
+  if(a[i] == 0){
+    a[i] = xint(freeblock++);
+    wsect(addr, (char*)a);
+  }
+  return xint(a[i]);
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -267,7 +286,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -281,16 +299,19 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      x = indirect(xint(din.addrs[NDIRECT]), fbn - NDIRECT);
+    } else {
+      fbn -= NDIRECT + NINDIRECT;
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(freeblock++);
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = indirect(xint(din.addrs[NDIRECT+1]), fbn / NINDIRECT);
+      x = indirect(x, fbn % NINDIRECT);
+      fbn += NDIRECT + NINDIRECT;
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
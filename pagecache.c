@@ -0,0 +1,161 @@
+// Executable page cache.
+//
+// Pages of program files that exec maps lazily (see pgfault in
+// vm.c) are read once and kept here, keyed by inode and offset,
+// so that every process running the same binary maps the same
+// physical pages, copy-on-write where the segment is writable.
+//
+// Interface:
+// * pcget returns a referenced page holding n bytes of the file
+//     at off followed by zeros; the caller owns the reference.
+// * pcinval drops the cached pages of a file whose contents
+//     change (writei, itrunc). They only call it if ip->pcached
+//     is set, so writes to other files never touch the cache.
+//
+// The cache is a direct-mapped table: an entry holds one reference
+// to its page and is simply replaced on a collision. pcache.nfile
+// counts the entries of the files hashing to each slot, so that
+// ilock can tell whether an inode read from disk may have pages
+// cached from an earlier in-memory copy.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPCACHE 256  // Entries in the table; power of two
+#define NPCFILE 64   // Counters in pcache.nfile; power of two
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;
+  uint n;      // Bytes read from the file; the rest of the page is zero
+  char *page;  // 0 if the entry is empty
+};
+
+struct {
+  struct spinlock lock;
+  uint gen;    // Bumped by pcinval, so a racing fill is not cached
+  uint nfile[NPCFILE];  // Entries of the files hashing to each counter
+  struct pcentry e[NPCACHE];
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+static struct pcentry*
+pcslot(uint dev, uint inum, uint off)
+{
+  return &pcache.e[(dev * 31 + inum * 131 + off / PGSIZE) & (NPCACHE-1)];
+}
+
+static uint*
+pcfile(uint dev, uint inum)
+{
+  return &pcache.nfile[(dev * 31 + inum) & (NPCFILE-1)];
+}
+
+static int
+pcmatch(struct pcentry *e, uint dev, uint inum, uint off, uint n)
+{
+  return e->page && e->dev == dev && e->inum == inum && e->off == off && e->n == n;
+}
+
+// Return a page holding n bytes of ip at off, with a reference
+// for the caller, or 0 on error. Must not be called with ip locked.
+char*
+pcget(struct inode *ip, uint off, uint n)
+{
+  struct pcentry *e;
+  char *mem;
+  uint gen;
+
+  if(n > PGSIZE)
+    panic("pcget");
+
+  acquire(&pcache.lock);
+  e = pcslot(ip->dev, ip->inum, off);
+  if(pcmatch(e, ip->dev, ip->inum, off, n)){
+    kref(e->page);
+    release(&pcache.lock);
+    return e->page;
+  }
+  gen = pcache.gen;
+  release(&pcache.lock);
+
+  if((mem = kalloc_zeroed()) == 0)
+    return 0;
+  ilock(ip);
+  ip->pcached = 1;
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+  iunlock(ip);
+
+  acquire(&pcache.lock);
+  if(pcmatch(e, ip->dev, ip->inum, off, n)){
+    // Someone else filled it meanwhile.
+    kref(e->page);
+    release(&pcache.lock);
+    kfree(mem);
+    return e->page;
+  }
+  if(gen == pcache.gen){
+    if(e->page){
+      kfree(e->page);
+      (*pcfile(e->dev, e->inum))--;
+    }
+    (*pcfile(ip->dev, ip->inum))++;
+    e->dev = ip->dev;
+    e->inum = ip->inum;
+    e->off = off;
+    e->n = n;
+    e->page = mem;
+    kref(mem);
+  }
+  release(&pcache.lock);
+  return mem;
+}
+
+// Drop every cached page of ip, which must be locked.
+// Processes that have the pages mapped keep their own references.
+void
+pcinval(struct inode *ip)
+{
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  pcache.gen++;
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+      kfree(e->page);
+      e->page = 0;
+      (*pcfile(ip->dev, ip->inum))--;
+    }
+  }
+  release(&pcache.lock);
+  ip->pcached = 0;
+}
+
+// Might ip have pages in the cache? Used by ilock
+// when it reads the inode from disk.
+int
+pcmaybe(struct inode *ip)
+{
+  int r;
+
+  acquire(&pcache.lock);
+  r = *pcfile(ip->dev, ip->inum) != 0;
+  release(&pcache.lock);
+  return r;
+}
@@ -1,15 +1,16 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      4096  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE       50  // unreferenced i-nodes kept cached
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       2000 // size of file system in blocks
+#define LOGSIZE      (MAXOPBLOCKS*20) // default blocks in on-disk log (mkfs -l)
+#define MAXLOGSIZE   1024 // max data blocks in on-disk log
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define MAXNBUF      4096 // maximum size of disk block cache
+#define FSSIZE       20000 // size of file system in blocks
 
 #include "bfs.h"
\ No newline at end of file
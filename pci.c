@@ -0,0 +1,89 @@
+// PCI configuration space, through configuration mechanism #1.
+// Just enough to find a function on bus 0 and set it up for a
+// driver: no bridges, and BARs are used as the firmware set them.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFADDR  0xcf8
+#define PCI_CONFDATA  0xcfc
+
+#define PCI_ID        0x00
+#define PCI_CMD       0x04
+#define PCI_CLASSREG  0x08
+#define PCI_HDRTYPE   0x0c
+#define PCI_BAR0      0x10
+#define PCI_INTR      0x3c
+
+#define PCI_CMD_IO      0x1
+#define PCI_CMD_MEM     0x2
+#define PCI_CMD_MASTER  0x4
+
+static uint
+confread(int bus, int dev, int func, int off)
+{
+  outl(PCI_CONFADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+static void
+confwrite(int bus, int dev, int func, int off, uint v)
+{
+  outl(PCI_CONFADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Find the first function on bus 0 that matches vendor, device,
+// class and subclass, any of which may be PCI_ANY. Returns 0 and
+// fills in *d, or -1 if there is none.
+int
+pcifind(int vendor, int device, int class, int subclass, struct pcidev *d)
+{
+  int dev, func, nfunc;
+  uint id, cl;
+
+  for(dev = 0; dev < 32; dev++){
+    nfunc = confread(0, dev, 0, PCI_HDRTYPE) & 0x800000 ? 8 : 1;
+    for(func = 0; func < nfunc; func++){
+      id = confread(0, dev, func, PCI_ID);
+      if((id & 0xffff) == 0xffff)
+        continue;
+      cl = confread(0, dev, func, PCI_CLASSREG);
+      if((vendor != PCI_ANY && (id & 0xffff) != vendor) ||
+         (device != PCI_ANY && (id >> 16) != device) ||
+         (class != PCI_ANY && (cl >> 24) != class) ||
+         (subclass != PCI_ANY && ((cl >> 16) & 0xff) != subclass))
+        continue;
+      d->bus = 0;
+      d->dev = dev;
+      d->func = func;
+      d->vendor = id & 0xffff;
+      d->device = id >> 16;
+      d->class = cl >> 24;
+      d->subclass = (cl >> 16) & 0xff;
+      d->irq = confread(0, dev, func, PCI_INTR) & 0xff;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// Base address register n of d, with its type bits.
+uint
+pcibar(struct pcidev *d, int n)
+{
+  return confread(d->bus, d->dev, d->func, PCI_BAR0 + 4*n);
+}
+
+// Let d decode its I/O and memory ranges and master the bus.
+void
+pcienable(struct pcidev *d)
+{
+  uint cmd;
+
+  cmd = confread(d->bus, d->dev, d->func, PCI_CMD);
+  cmd |= PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER;
+  confwrite(d->bus, d->dev, d->func, PCI_CMD, cmd & 0xffff);
+}
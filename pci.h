@@ -0,0 +1,15 @@
+// A PCI function, as found by pcifind.
+struct pcidev {
+  uchar bus;
+  uchar dev;
+  uchar func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar irq;      // Interrupt line the firmware routed it to
+};
+
+#define PCI_ANY             -1
+#define PCI_CLASS_STORAGE   0x01
+#define PCI_SUBCLASS_IDE    0x01
@@ -35,7 +35,7 @@ printint(int fd, int xx, int base, int sgn)
     putc(fd, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
 void
 printf(int fd, const char *fmt, ...)
 {
@@ -57,6 +57,9 @@ printf(int fd, const char *fmt, ...)
       if(c == 'd'){
         printint(fd, *ap, 10, 1);
         ap++;
+      } else if(c == 'u'){
+        printint(fd, *ap, 10, 0);
+        ap++;
       } else if(c == 'x' || c == 'p'){
         printint(fd, *ap, 16, 0);
         ap++;
@@ -34,6 +34,17 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+#define NSEG 4  // Program segments exec can map lazily
+
+// A program segment mapped on demand from p->exeip (see pgfault).
+struct vmseg {
+  uint va;        // Page-aligned start
+  uint memsz;     // Bytes of memory
+  uint filesz;    // Leading bytes backed by the file; the rest are zero
+  uint off;       // File offset of va
+  int writable;   // Pages are mapped copy-on-write rather than read-only
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -58,6 +69,24 @@ struct proc {
   // ratio and the default quantum amount.
   int ticks_left;
   int maxlevel;
+  uint readytick; // Tick at which the process last became RUNNABLE
+  int starved;    // Already flagged by the fairness auditor during this wait
+  int rqidx;      // Run queue backend bookkeeping (heap index, bucket slot)
+  struct proc *rqnext;  // Run queue backend links (bucket lists)
+  struct proc *rqprev;
+  int slot;                    // Index in ptable.slot, taken by allocproc, given back by freeproc
+  struct proc *allnext;        // Live process list (ptable.all), from allocproc to freeproc
+  struct proc *allprev;
+  struct proc *pidnext;        // Pid hash chain
+  struct proc *chnext;         // Sleep channel hash chain, while SLEEPING
+  struct proc *chprev;
+  struct proc *children;       // Live children, linked through sibnext/sibprev
+  struct proc *zombies;        // Children that have exited but not been waited for
+  struct proc *sibnext;        // On parent's children or zombies list
+  struct proc *sibprev;
+  struct inode *exeip;         // Program file backing seg[]
+  struct vmseg seg[NSEG];
+  int nseg;
 };
 
 // Process memory is laid out contiguously, low addresses first:
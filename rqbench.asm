@@ -0,0 +1,954 @@
+
+_rqbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "schedstat.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec a8 01 00 00    	sub    $0x1a8,%esp
+  17:	8b 19                	mov    (%ecx),%ebx
+  19:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct schedstat st;
+  int nchild, rounds, i, j, start;
+
+  nchild = argc > 1 ? atoi(argv[1]) : 32;
+  1c:	83 fb 01             	cmp    $0x1,%ebx
+  1f:	7f 72                	jg     93 <main+0x93>
+  21:	bf 20 00 00 00       	mov    $0x20,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : 2000;
+  26:	c7 85 54 fe ff ff d0 	movl   $0x7d0,-0x1ac(%ebp)
+  2d:	07 00 00 
+
+  schedstat(&st, 1);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	6a 01                	push   $0x1
+  35:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+  3b:	50                   	push   %eax
+  3c:	e8 a2 03 00 00       	call   3e3 <schedstat>
+  start = uptime();
+  41:	e8 75 03 00 00       	call   3bb <uptime>
+  46:	89 85 50 fe ff ff    	mov    %eax,-0x1b0(%ebp)
+  for(i = 0; i < nchild; i++){
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  54:	39 fb                	cmp    %edi,%ebx
+  56:	0f 8d 89 00 00 00    	jge    e5 <main+0xe5>
+    int pid = nicefork(BFS_NICE_FIRST_LEVEL + i % BFS_NICE_LEVELS);
+  5c:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  61:	89 d8                	mov    %ebx,%eax
+  63:	f7 ea                	imul   %edx
+  65:	c1 fa 04             	sar    $0x4,%edx
+  68:	89 d8                	mov    %ebx,%eax
+  6a:	c1 f8 1f             	sar    $0x1f,%eax
+  6d:	29 c2                	sub    %eax,%edx
+  6f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  72:	c1 e0 03             	shl    $0x3,%eax
+  75:	89 da                	mov    %ebx,%edx
+  77:	29 c2                	sub    %eax,%edx
+  79:	83 ec 0c             	sub    $0xc,%esp
+  7c:	83 ea 14             	sub    $0x14,%edx
+  7f:	52                   	push   %edx
+  80:	e8 4e 03 00 00       	call   3d3 <nicefork>
+    if(pid < 0){
+  85:	83 c4 10             	add    $0x10,%esp
+  88:	85 c0                	test   %eax,%eax
+  8a:	78 44                	js     d0 <main+0xd0>
+      printf(1, "rqbench: nicefork failed after %d children\n", i);
+      nchild = i;
+      break;
+    }
+    if(pid == 0){
+  8c:	74 5e                	je     ec <main+0xec>
+  for(i = 0; i < nchild; i++){
+  8e:	83 c3 01             	add    $0x1,%ebx
+  91:	eb c1                	jmp    54 <main+0x54>
+  nchild = argc > 1 ? atoi(argv[1]) : 32;
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	ff 76 04             	push   0x4(%esi)
+  99:	e8 21 02 00 00       	call   2bf <atoi>
+  9e:	89 c7                	mov    %eax,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : 2000;
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	83 fb 02             	cmp    $0x2,%ebx
+  a6:	7f 0f                	jg     b7 <main+0xb7>
+  a8:	c7 85 54 fe ff ff d0 	movl   $0x7d0,-0x1ac(%ebp)
+  af:	07 00 00 
+  b2:	e9 79 ff ff ff       	jmp    30 <main+0x30>
+  b7:	83 ec 0c             	sub    $0xc,%esp
+  ba:	ff 76 08             	push   0x8(%esi)
+  bd:	e8 fd 01 00 00       	call   2bf <atoi>
+  c2:	89 85 54 fe ff ff    	mov    %eax,-0x1ac(%ebp)
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	e9 60 ff ff ff       	jmp    30 <main+0x30>
+      printf(1, "rqbench: nicefork failed after %d children\n", i);
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	53                   	push   %ebx
+  d4:	68 30 06 00 00       	push   $0x630
+  d9:	6a 01                	push   $0x1
+  db:	e8 c0 03 00 00       	call   4a0 <printf>
+      break;
+  e0:	83 c4 10             	add    $0x10,%esp
+      nchild = i;
+  e3:	89 df                	mov    %ebx,%edi
+      for(j = 0; j < rounds; j++)
+        yield();
+      exit();
+    }
+  }
+  for(i = 0; i < nchild; i++)
+  e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  ea:	eb 23                	jmp    10f <main+0x10f>
+  ec:	89 c6                	mov    %eax,%esi
+  ee:	8b 9d 54 fe ff ff    	mov    -0x1ac(%ebp),%ebx
+      for(j = 0; j < rounds; j++)
+  f4:	39 de                	cmp    %ebx,%esi
+  f6:	7d 0a                	jge    102 <main+0x102>
+        yield();
+  f8:	e8 c6 02 00 00       	call   3c3 <yield>
+      for(j = 0; j < rounds; j++)
+  fd:	83 c6 01             	add    $0x1,%esi
+ 100:	eb f2                	jmp    f4 <main+0xf4>
+      exit();
+ 102:	e8 1c 02 00 00       	call   323 <exit>
+    wait();
+ 107:	e8 1f 02 00 00       	call   32b <wait>
+  for(i = 0; i < nchild; i++)
+ 10c:	83 c3 01             	add    $0x1,%ebx
+ 10f:	39 df                	cmp    %ebx,%edi
+ 111:	7f f4                	jg     107 <main+0x107>
+  schedstat(&st, 0);
+ 113:	83 ec 08             	sub    $0x8,%esp
+ 116:	6a 00                	push   $0x0
+ 118:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+ 11e:	50                   	push   %eax
+ 11f:	e8 bf 02 00 00       	call   3e3 <schedstat>
+
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+ 124:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 127:	8d 34 00             	lea    (%eax,%eax,1),%esi
+         st.rqname, nchild, rounds, uptime() - start, st.rqops,
+         st.rqops ? st.rqcycles / st.rqops : 0, 2 * st.cr3skips);
+ 12a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+ 12d:	83 c4 10             	add    $0x10,%esp
+ 130:	85 db                	test   %ebx,%ebx
+ 132:	74 48                	je     17c <main+0x17c>
+         st.rqops ? st.rqcycles / st.rqops : 0, 2 * st.cr3skips);
+ 134:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+ 137:	ba 00 00 00 00       	mov    $0x0,%edx
+ 13c:	f7 f3                	div    %ebx
+ 13e:	89 85 4c fe ff ff    	mov    %eax,-0x1b4(%ebp)
+         st.rqname, nchild, rounds, uptime() - start, st.rqops,
+ 144:	e8 72 02 00 00       	call   3bb <uptime>
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+ 149:	83 ec 0c             	sub    $0xc,%esp
+ 14c:	56                   	push   %esi
+ 14d:	ff b5 4c fe ff ff    	push   -0x1b4(%ebp)
+ 153:	53                   	push   %ebx
+ 154:	8b 8d 50 fe ff ff    	mov    -0x1b0(%ebp),%ecx
+ 15a:	29 c8                	sub    %ecx,%eax
+ 15c:	50                   	push   %eax
+ 15d:	ff b5 54 fe ff ff    	push   -0x1ac(%ebp)
+ 163:	57                   	push   %edi
+ 164:	8d 45 c0             	lea    -0x40(%ebp),%eax
+ 167:	50                   	push   %eax
+ 168:	68 5c 06 00 00       	push   $0x65c
+ 16d:	6a 01                	push   $0x1
+ 16f:	e8 2c 03 00 00       	call   4a0 <printf>
+  exit();
+ 174:	83 c4 30             	add    $0x30,%esp
+ 177:	e8 a7 01 00 00       	call   323 <exit>
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+ 17c:	89 9d 4c fe ff ff    	mov    %ebx,-0x1b4(%ebp)
+ 182:	eb c0                	jmp    144 <main+0x144>
+
+00000184 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 184:	55                   	push   %ebp
+ 185:	89 e5                	mov    %esp,%ebp
+ 187:	56                   	push   %esi
+ 188:	53                   	push   %ebx
+ 189:	8b 75 08             	mov    0x8(%ebp),%esi
+ 18c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 18f:	89 f0                	mov    %esi,%eax
+ 191:	89 d1                	mov    %edx,%ecx
+ 193:	83 c2 01             	add    $0x1,%edx
+ 196:	89 c3                	mov    %eax,%ebx
+ 198:	83 c0 01             	add    $0x1,%eax
+ 19b:	0f b6 09             	movzbl (%ecx),%ecx
+ 19e:	88 0b                	mov    %cl,(%ebx)
+ 1a0:	84 c9                	test   %cl,%cl
+ 1a2:	75 ed                	jne    191 <strcpy+0xd>
+    ;
+  return os;
+}
+ 1a4:	89 f0                	mov    %esi,%eax
+ 1a6:	5b                   	pop    %ebx
+ 1a7:	5e                   	pop    %esi
+ 1a8:	5d                   	pop    %ebp
+ 1a9:	c3                   	ret
+
+000001aa <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1aa:	55                   	push   %ebp
+ 1ab:	89 e5                	mov    %esp,%ebp
+ 1ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1b3:	eb 06                	jmp    1bb <strcmp+0x11>
+    p++, q++;
+ 1b5:	83 c1 01             	add    $0x1,%ecx
+ 1b8:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1bb:	0f b6 01             	movzbl (%ecx),%eax
+ 1be:	84 c0                	test   %al,%al
+ 1c0:	74 04                	je     1c6 <strcmp+0x1c>
+ 1c2:	3a 02                	cmp    (%edx),%al
+ 1c4:	74 ef                	je     1b5 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1c6:	0f b6 c0             	movzbl %al,%eax
+ 1c9:	0f b6 12             	movzbl (%edx),%edx
+ 1cc:	29 d0                	sub    %edx,%eax
+}
+ 1ce:	5d                   	pop    %ebp
+ 1cf:	c3                   	ret
+
+000001d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1db:	eb 03                	jmp    1e0 <strlen+0x10>
+ 1dd:	83 c0 01             	add    $0x1,%eax
+ 1e0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e4:	75 f7                	jne    1dd <strlen+0xd>
+    ;
+  return n;
+}
+ 1e6:	5d                   	pop    %ebp
+ 1e7:	c3                   	ret
+
+000001e8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e8:	55                   	push   %ebp
+ 1e9:	89 e5                	mov    %esp,%ebp
+ 1eb:	57                   	push   %edi
+ 1ec:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1ef:	89 d7                	mov    %edx,%edi
+ 1f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f7:	fc                   	cld
+ 1f8:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1fa:	89 d0                	mov    %edx,%eax
+ 1fc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1ff:	c9                   	leave
+ 200:	c3                   	ret
+
+00000201 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	8b 45 08             	mov    0x8(%ebp),%eax
+ 207:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20b:	eb 03                	jmp    210 <strchr+0xf>
+ 20d:	83 c0 01             	add    $0x1,%eax
+ 210:	0f b6 10             	movzbl (%eax),%edx
+ 213:	84 d2                	test   %dl,%dl
+ 215:	74 06                	je     21d <strchr+0x1c>
+    if(*s == c)
+ 217:	38 ca                	cmp    %cl,%dl
+ 219:	75 f2                	jne    20d <strchr+0xc>
+ 21b:	eb 05                	jmp    222 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 21d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+
+00000224 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 224:	55                   	push   %ebp
+ 225:	89 e5                	mov    %esp,%ebp
+ 227:	57                   	push   %edi
+ 228:	56                   	push   %esi
+ 229:	53                   	push   %ebx
+ 22a:	83 ec 1c             	sub    $0x1c,%esp
+ 22d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 230:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 235:	89 de                	mov    %ebx,%esi
+ 237:	83 c3 01             	add    $0x1,%ebx
+ 23a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23d:	7d 2e                	jge    26d <gets+0x49>
+    cc = read(0, &c, 1);
+ 23f:	83 ec 04             	sub    $0x4,%esp
+ 242:	6a 01                	push   $0x1
+ 244:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 247:	50                   	push   %eax
+ 248:	6a 00                	push   $0x0
+ 24a:	e8 ec 00 00 00       	call   33b <read>
+    if(cc < 1)
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	85 c0                	test   %eax,%eax
+ 254:	7e 17                	jle    26d <gets+0x49>
+      break;
+    buf[i++] = c;
+ 256:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 25a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 25d:	3c 0a                	cmp    $0xa,%al
+ 25f:	0f 94 c2             	sete   %dl
+ 262:	3c 0d                	cmp    $0xd,%al
+ 264:	0f 94 c0             	sete   %al
+ 267:	08 c2                	or     %al,%dl
+ 269:	74 ca                	je     235 <gets+0x11>
+    buf[i++] = c;
+ 26b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 26d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 271:	89 f8                	mov    %edi,%eax
+ 273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 276:	5b                   	pop    %ebx
+ 277:	5e                   	pop    %esi
+ 278:	5f                   	pop    %edi
+ 279:	5d                   	pop    %ebp
+ 27a:	c3                   	ret
+
+0000027b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+ 27e:	56                   	push   %esi
+ 27f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 280:	83 ec 08             	sub    $0x8,%esp
+ 283:	6a 00                	push   $0x0
+ 285:	ff 75 08             	push   0x8(%ebp)
+ 288:	e8 d6 00 00 00       	call   363 <open>
+  if(fd < 0)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	78 24                	js     2b8 <stat+0x3d>
+ 294:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 296:	83 ec 08             	sub    $0x8,%esp
+ 299:	ff 75 0c             	push   0xc(%ebp)
+ 29c:	50                   	push   %eax
+ 29d:	e8 d9 00 00 00       	call   37b <fstat>
+ 2a2:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2a4:	89 1c 24             	mov    %ebx,(%esp)
+ 2a7:	e8 9f 00 00 00       	call   34b <close>
+  return r;
+ 2ac:	83 c4 10             	add    $0x10,%esp
+}
+ 2af:	89 f0                	mov    %esi,%eax
+ 2b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b4:	5b                   	pop    %ebx
+ 2b5:	5e                   	pop    %esi
+ 2b6:	5d                   	pop    %ebp
+ 2b7:	c3                   	ret
+    return -1;
+ 2b8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2bd:	eb f0                	jmp    2af <stat+0x34>
+
+000002bf <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2bf:	55                   	push   %ebp
+ 2c0:	89 e5                	mov    %esp,%ebp
+ 2c2:	53                   	push   %ebx
+ 2c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 2c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 2cb:	eb 10                	jmp    2dd <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 2cd:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 2d0:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 2d3:	83 c1 01             	add    $0x1,%ecx
+ 2d6:	0f be c0             	movsbl %al,%eax
+ 2d9:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 2dd:	0f b6 01             	movzbl (%ecx),%eax
+ 2e0:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e3:	80 fb 09             	cmp    $0x9,%bl
+ 2e6:	76 e5                	jbe    2cd <atoi+0xe>
+  return n;
+}
+ 2e8:	89 d0                	mov    %edx,%eax
+ 2ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ed:	c9                   	leave
+ 2ee:	c3                   	ret
+
+000002ef <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2ef:	55                   	push   %ebp
+ 2f0:	89 e5                	mov    %esp,%ebp
+ 2f2:	56                   	push   %esi
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2fd:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2ff:	eb 0d                	jmp    30e <memmove+0x1f>
+    *dst++ = *src++;
+ 301:	0f b6 01             	movzbl (%ecx),%eax
+ 304:	88 02                	mov    %al,(%edx)
+ 306:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 309:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 30c:	89 d8                	mov    %ebx,%eax
+ 30e:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 311:	85 c0                	test   %eax,%eax
+ 313:	7f ec                	jg     301 <memmove+0x12>
+  return vdst;
+}
+ 315:	89 f0                	mov    %esi,%eax
+ 317:	5b                   	pop    %ebx
+ 318:	5e                   	pop    %esi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 31b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <exit>:
+SYSCALL(exit)
+ 323:	b8 02 00 00 00       	mov    $0x2,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <wait>:
+SYSCALL(wait)
+ 32b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <pipe>:
+SYSCALL(pipe)
+ 333:	b8 04 00 00 00       	mov    $0x4,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <read>:
+SYSCALL(read)
+ 33b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <write>:
+SYSCALL(write)
+ 343:	b8 10 00 00 00       	mov    $0x10,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <close>:
+SYSCALL(close)
+ 34b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <kill>:
+SYSCALL(kill)
+ 353:	b8 06 00 00 00       	mov    $0x6,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <exec>:
+SYSCALL(exec)
+ 35b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <open>:
+SYSCALL(open)
+ 363:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mknod>:
+SYSCALL(mknod)
+ 36b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <unlink>:
+SYSCALL(unlink)
+ 373:	b8 12 00 00 00       	mov    $0x12,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <fstat>:
+SYSCALL(fstat)
+ 37b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <link>:
+SYSCALL(link)
+ 383:	b8 13 00 00 00       	mov    $0x13,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mkdir>:
+SYSCALL(mkdir)
+ 38b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <chdir>:
+SYSCALL(chdir)
+ 393:	b8 09 00 00 00       	mov    $0x9,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <dup>:
+SYSCALL(dup)
+ 39b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getpid>:
+SYSCALL(getpid)
+ 3a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sbrk>:
+SYSCALL(sbrk)
+ 3ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <sleep>:
+SYSCALL(sleep)
+ 3b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <uptime>:
+SYSCALL(uptime)
+ 3bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <yield>:
+SYSCALL(yield)
+ 3c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <shutdown>:
+SYSCALL(shutdown)
+ 3cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <nicefork>:
+SYSCALL(nicefork)
+ 3d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <schedlog>:
+SYSCALL(schedlog)
+ 3db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <schedstat>:
+SYSCALL(schedstat)
+ 3e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <spawn>:
+SYSCALL(spawn)
+ 3eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <bstat>:
+SYSCALL(bstat)
+ 3f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3fb:	55                   	push   %ebp
+ 3fc:	89 e5                	mov    %esp,%ebp
+ 3fe:	83 ec 1c             	sub    $0x1c,%esp
+ 401:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 404:	6a 01                	push   $0x1
+ 406:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 409:	52                   	push   %edx
+ 40a:	50                   	push   %eax
+ 40b:	e8 33 ff ff ff       	call   343 <write>
+}
+ 410:	83 c4 10             	add    $0x10,%esp
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+
+00000415 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 415:	55                   	push   %ebp
+ 416:	89 e5                	mov    %esp,%ebp
+ 418:	57                   	push   %edi
+ 419:	56                   	push   %esi
+ 41a:	53                   	push   %ebx
+ 41b:	83 ec 2c             	sub    $0x2c,%esp
+ 41e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 421:	89 d0                	mov    %edx,%eax
+ 423:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 425:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 429:	0f 95 c1             	setne  %cl
+ 42c:	c1 ea 1f             	shr    $0x1f,%edx
+ 42f:	84 d1                	test   %dl,%cl
+ 431:	74 44                	je     477 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 433:	f7 d8                	neg    %eax
+ 435:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 437:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 43e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 443:	89 c8                	mov    %ecx,%eax
+ 445:	ba 00 00 00 00       	mov    $0x0,%edx
+ 44a:	f7 f6                	div    %esi
+ 44c:	89 df                	mov    %ebx,%edi
+ 44e:	83 c3 01             	add    $0x1,%ebx
+ 451:	0f b6 92 20 07 00 00 	movzbl 0x720(%edx),%edx
+ 458:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 45c:	89 ca                	mov    %ecx,%edx
+ 45e:	89 c1                	mov    %eax,%ecx
+ 460:	39 f2                	cmp    %esi,%edx
+ 462:	73 df                	jae    443 <printint+0x2e>
+  if(neg)
+ 464:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 468:	74 31                	je     49b <printint+0x86>
+    buf[i++] = '-';
+ 46a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 46f:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 472:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 475:	eb 17                	jmp    48e <printint+0x79>
+    x = xx;
+ 477:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 479:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 480:	eb bc                	jmp    43e <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 482:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	e8 6d ff ff ff       	call   3fb <putc>
+  while(--i >= 0)
+ 48e:	83 eb 01             	sub    $0x1,%ebx
+ 491:	79 ef                	jns    482 <printint+0x6d>
+}
+ 493:	83 c4 2c             	add    $0x2c,%esp
+ 496:	5b                   	pop    %ebx
+ 497:	5e                   	pop    %esi
+ 498:	5f                   	pop    %edi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+ 49b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 49e:	eb ee                	jmp    48e <printint+0x79>
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 4a9:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 4af:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 4b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4b9:	eb 14                	jmp    4cf <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4bb:	89 fa                	mov    %edi,%edx
+ 4bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c0:	e8 36 ff ff ff       	call   3fb <putc>
+ 4c5:	eb 05                	jmp    4cc <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 4c7:	83 fe 25             	cmp    $0x25,%esi
+ 4ca:	74 25                	je     4f1 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 4cc:	83 c3 01             	add    $0x1,%ebx
+ 4cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d2:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4d6:	84 c0                	test   %al,%al
+ 4d8:	0f 84 4a 01 00 00    	je     628 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 4de:	0f be f8             	movsbl %al,%edi
+ 4e1:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4e4:	85 f6                	test   %esi,%esi
+ 4e6:	75 df                	jne    4c7 <printf+0x27>
+      if(c == '%'){
+ 4e8:	83 f8 25             	cmp    $0x25,%eax
+ 4eb:	75 ce                	jne    4bb <printf+0x1b>
+        state = '%';
+ 4ed:	89 c6                	mov    %eax,%esi
+ 4ef:	eb db                	jmp    4cc <printf+0x2c>
+      if(c == 'd'){
+ 4f1:	83 f8 25             	cmp    $0x25,%eax
+ 4f4:	0f 84 f9 00 00 00    	je     5f3 <printf+0x153>
+ 4fa:	0f 8c 07 01 00 00    	jl     607 <printf+0x167>
+ 500:	83 f8 78             	cmp    $0x78,%eax
+ 503:	0f 8f fe 00 00 00    	jg     607 <printf+0x167>
+ 509:	83 f8 63             	cmp    $0x63,%eax
+ 50c:	0f 8c f5 00 00 00    	jl     607 <printf+0x167>
+ 512:	83 e8 63             	sub    $0x63,%eax
+ 515:	83 f8 15             	cmp    $0x15,%eax
+ 518:	0f 87 e9 00 00 00    	ja     607 <printf+0x167>
+ 51e:	ff 24 85 c8 06 00 00 	jmp    *0x6c8(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 525:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 528:	8b 17                	mov    (%edi),%edx
+ 52a:	83 ec 0c             	sub    $0xc,%esp
+ 52d:	6a 01                	push   $0x1
+ 52f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 534:	8b 45 08             	mov    0x8(%ebp),%eax
+ 537:	e8 d9 fe ff ff       	call   415 <printint>
+        ap++;
+ 53c:	83 c7 04             	add    $0x4,%edi
+ 53f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 542:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 545:	be 00 00 00 00       	mov    $0x0,%esi
+ 54a:	eb 80                	jmp    4cc <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 54c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 54f:	8b 17                	mov    (%edi),%edx
+ 551:	83 ec 0c             	sub    $0xc,%esp
+ 554:	6a 00                	push   $0x0
+ 556:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 55b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55e:	e8 b2 fe ff ff       	call   415 <printint>
+        ap++;
+ 563:	83 c7 04             	add    $0x4,%edi
+ 566:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 569:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56c:	be 00 00 00 00       	mov    $0x0,%esi
+ 571:	e9 56 ff ff ff       	jmp    4cc <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 576:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 579:	8b 17                	mov    (%edi),%edx
+ 57b:	83 ec 0c             	sub    $0xc,%esp
+ 57e:	6a 00                	push   $0x0
+ 580:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 585:	8b 45 08             	mov    0x8(%ebp),%eax
+ 588:	e8 88 fe ff ff       	call   415 <printint>
+        ap++;
+ 58d:	83 c7 04             	add    $0x4,%edi
+ 590:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 593:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 596:	be 00 00 00 00       	mov    $0x0,%esi
+ 59b:	e9 2c ff ff ff       	jmp    4cc <printf+0x2c>
+        s = (char*)*ap;
+ 5a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5a3:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 5ab:	85 f6                	test   %esi,%esi
+ 5ad:	75 15                	jne    5c4 <printf+0x124>
+          s = "(null)";
+ 5af:	be c0 06 00 00       	mov    $0x6c0,%esi
+ 5b4:	eb 0e                	jmp    5c4 <printf+0x124>
+          putc(fd, *s);
+ 5b6:	0f be d2             	movsbl %dl,%edx
+ 5b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bc:	e8 3a fe ff ff       	call   3fb <putc>
+          s++;
+ 5c1:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 5c4:	0f b6 16             	movzbl (%esi),%edx
+ 5c7:	84 d2                	test   %dl,%dl
+ 5c9:	75 eb                	jne    5b6 <printf+0x116>
+      state = 0;
+ 5cb:	be 00 00 00 00       	mov    $0x0,%esi
+ 5d0:	e9 f7 fe ff ff       	jmp    4cc <printf+0x2c>
+        putc(fd, *ap);
+ 5d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5d8:	0f be 17             	movsbl (%edi),%edx
+ 5db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5de:	e8 18 fe ff ff       	call   3fb <putc>
+        ap++;
+ 5e3:	83 c7 04             	add    $0x4,%edi
+ 5e6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5e9:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ee:	e9 d9 fe ff ff       	jmp    4cc <printf+0x2c>
+        putc(fd, c);
+ 5f3:	89 fa                	mov    %edi,%edx
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	e8 fe fd ff ff       	call   3fb <putc>
+      state = 0;
+ 5fd:	be 00 00 00 00       	mov    $0x0,%esi
+ 602:	e9 c5 fe ff ff       	jmp    4cc <printf+0x2c>
+        putc(fd, '%');
+ 607:	ba 25 00 00 00       	mov    $0x25,%edx
+ 60c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60f:	e8 e7 fd ff ff       	call   3fb <putc>
+        putc(fd, c);
+ 614:	89 fa                	mov    %edi,%edx
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+ 619:	e8 dd fd ff ff       	call   3fb <putc>
+      state = 0;
+ 61e:	be 00 00 00 00       	mov    $0x0,%esi
+ 623:	e9 a4 fe ff ff       	jmp    4cc <printf+0x2c>
+    }
+  }
+}
+ 628:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62b:	5b                   	pop    %ebx
+ 62c:	5e                   	pop    %esi
+ 62d:	5f                   	pop    %edi
+ 62e:	5d                   	pop    %ebp
+ 62f:	c3                   	ret
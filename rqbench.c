@@ -0,0 +1,45 @@
+// Run queue benchmark. Starts nchild processes spread over nice
+// levels -20..19 that each yield() rounds times, so every round is
+// an insert, a peek-min and a remove on the scheduler's run queue.
+// Reports elapsed ticks and the TSC cycles the kernel spent in run
+// queue operations; rebuild with make RUNQUEUE=... to compare backends.
+//
+// Usage: rqbench [nchild] [rounds]
+
+#include "types.h"
+#include "user.h"
+#include "schedstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct schedstat st;
+  int nchild, rounds, i, j, start;
+
+  nchild = argc > 1 ? atoi(argv[1]) : 32;
+  rounds = argc > 2 ? atoi(argv[2]) : 2000;
+
+  schedstat(&st, 1);
+  start = uptime();
+  for(i = 0; i < nchild; i++){
+    int pid = nicefork(BFS_NICE_FIRST_LEVEL + i % BFS_NICE_LEVELS);
+    if(pid < 0){
+      printf(1, "rqbench: nicefork failed after %d children\n", i);
+      nchild = i;
+      break;
+    }
+    if(pid == 0){
+      for(j = 0; j < rounds; j++)
+        yield();
+      exit();
+    }
+  }
+  for(i = 0; i < nchild; i++)
+    wait();
+  schedstat(&st, 0);
+
+  printf(1, "rqbench: %s, %d children x %d rounds: %d ticks, %d queue ops, %d cycles/op, %d cr3 reloads avoided\n",
+         st.rqname, nchild, rounds, uptime() - start, st.rqops,
+         st.rqops ? st.rqcycles / st.rqops : 0, 2 * st.cr3skips);
+  exit();
+}
@@ -0,0 +1,17 @@
+// Run queue backends for the BFS scheduler.
+// A backend keeps the RUNNABLE processes ordered by virtual
+// deadline (p->vdeadline). Which one the kernel uses is chosen
+// at build time with make RUNQUEUE=skiplist|heap|bucket.
+// Every operation is called with ptable.lock held.
+struct rqops {
+  char *name;
+  void (*init)(void);
+  int (*insert)(struct proc*);        // Add p keyed by p->vdeadline; -1 if full
+  void (*remove)(struct proc*);       // Take queued p out of the queue
+  struct proc* (*peekmin)(void);      // Earliest deadline, or 0 if empty
+  void (*update)(struct proc*, int);  // Change queued p's deadline
+};
+
+extern struct rqops skiplistrq;  // runqskip.c
+extern struct rqops heaprq;      // runqheap.c
+extern struct rqops bucketrq;    // runqbucket.c
@@ -0,0 +1,159 @@
+// Bucketed deadline run queue backend.
+// Deadlines are grouped into NBUCKET buckets of 1 << BUCKETSHIFT ticks
+// each, covering a window that starts at the earliest queued deadline
+// (basekey). Buckets are kept sorted, and a bitmap of the non-empty
+// ones lets the next earliest bucket be found with a single bit scan,
+// so peekmin is O(1). Deadlines beyond the window wait, sorted, in an
+// overflow list until the window moves up to them; deadlines already
+// behind the window join the front bucket.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "runq.h"
+
+#define NBUCKET     32  // One bit per bucket in bq.bitmap
+#define BUCKETSHIFT  7  // Each bucket covers 128 ticks of deadlines
+
+#define KEY(d)   ((d) >> BUCKETSHIFT)
+#define SLOT(k)  ((k) & (NBUCKET-1))
+
+static struct {
+  struct proc *bucket[NBUCKET];  // Linked through rqnext/rqprev
+  uint bitmap;                   // Bit b is set iff bucket[b] is non-empty
+  int basekey;                   // Key of the front (earliest) bucket
+  int n;                         // Processes in buckets
+  struct proc *overflow;         // Deadlines past the window; empty if n == 0
+} bq;
+
+// Insert p into a deadline-sorted list, after any equal deadlines.
+static void
+linsert(struct proc **head, struct proc *p)
+{
+  struct proc *q, *prev = 0;
+
+  for(q = *head; q && q->vdeadline <= p->vdeadline; q = q->rqnext)
+    prev = q;
+  p->rqprev = prev;
+  p->rqnext = q;
+  if(q)
+    q->rqprev = p;
+  if(prev)
+    prev->rqnext = p;
+  else
+    *head = p;
+}
+
+static void
+lremove(struct proc **head, struct proc *p)
+{
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    *head = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  p->rqnext = p->rqprev = 0;
+}
+
+static void
+binsert(struct proc *p, int k)
+{
+  p->rqidx = SLOT(k);
+  linsert(&bq.bucket[p->rqidx], p);
+  bq.bitmap |= 1u << p->rqidx;
+  bq.n++;
+}
+
+// The front bucket just emptied: move the window up to the
+// next non-empty bucket and pull in overflow that now fits.
+static void
+rebase(void)
+{
+  struct proc *p;
+  uint s, rot;
+
+  if(bq.bitmap == 0){
+    if(bq.overflow == 0)
+      return;
+    bq.basekey = KEY(bq.overflow->vdeadline);
+  } else {
+    s = SLOT(bq.basekey);
+    rot = s ? (bq.bitmap >> s) | (bq.bitmap << (NBUCKET - s)) : bq.bitmap;
+    bq.basekey += __builtin_ctz(rot);
+  }
+
+  while((p = bq.overflow) != 0 && KEY(p->vdeadline) < bq.basekey + NBUCKET){
+    lremove(&bq.overflow, p);
+    binsert(p, KEY(p->vdeadline));
+  }
+}
+
+static void
+bucketinit(void)
+{
+  memset(&bq, 0, sizeof(bq));
+}
+
+static int
+bucketinsert(struct proc *p)
+{
+  int k = KEY(p->vdeadline);
+
+  if(bq.n == 0)
+    bq.basekey = k;
+  if(k < bq.basekey)
+    k = bq.basekey;
+  if(k >= bq.basekey + NBUCKET){
+    p->rqidx = -1;
+    linsert(&bq.overflow, p);
+    return 0;
+  }
+  binsert(p, k);
+  return 0;
+}
+
+static void
+bucketremove(struct proc *p)
+{
+  int s = p->rqidx;
+
+  if(s < 0){
+    lremove(&bq.overflow, p);
+    return;
+  }
+  lremove(&bq.bucket[s], p);
+  bq.n--;
+  if(bq.bucket[s] == 0){
+    bq.bitmap &= ~(1u << s);
+    if(s == SLOT(bq.basekey))
+      rebase();
+  }
+}
+
+static struct proc*
+bucketpeekmin(void)
+{
+  if(bq.n == 0)
+    return 0;
+  return bq.bucket[SLOT(bq.basekey)];
+}
+
+static void
+bucketupdate(struct proc *p, int deadline)
+{
+  bucketremove(p);
+  p->vdeadline = deadline;
+  bucketinsert(p);
+}
+
+struct rqops bucketrq = {
+  .name = "bucket",
+  .init = bucketinit,
+  .insert = bucketinsert,
+  .remove = bucketremove,
+  .peekmin = bucketpeekmin,
+  .update = bucketupdate,
+};
@@ -0,0 +1,111 @@
+// Binary min-heap run queue backend.
+// heap[0] holds the earliest deadline; each process records its
+// own position in p->rqidx so it can be removed or re-keyed in
+// O(log n) without searching.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "runq.h"
+
+static struct {
+  struct proc *heap[NPROC];
+  int n;
+} hq;
+
+static void
+hset(int i, struct proc *p)
+{
+  hq.heap[i] = p;
+  p->rqidx = i;
+}
+
+// Move the entry at i towards the root until its parent is earlier.
+static void
+siftup(int i)
+{
+  struct proc *p = hq.heap[i];
+
+  while(i > 0 && hq.heap[(i-1)/2]->vdeadline > p->vdeadline){
+    hset(i, hq.heap[(i-1)/2]);
+    i = (i-1)/2;
+  }
+  hset(i, p);
+}
+
+// Move the entry at i towards the leaves until both children are later.
+static void
+siftdown(int i)
+{
+  struct proc *p = hq.heap[i];
+  int c;
+
+  for(;;){
+    c = 2*i + 1;
+    if(c >= hq.n)
+      break;
+    if(c+1 < hq.n && hq.heap[c+1]->vdeadline < hq.heap[c]->vdeadline)
+      c++;
+    if(hq.heap[c]->vdeadline >= p->vdeadline)
+      break;
+    hset(i, hq.heap[c]);
+    i = c;
+  }
+  hset(i, p);
+}
+
+static void
+heapinit(void)
+{
+  hq.n = 0;
+}
+
+static int
+heapinsert(struct proc *p)
+{
+  if(hq.n == NPROC)
+    return -1;
+  hset(hq.n++, p);
+  siftup(p->rqidx);
+  return 0;
+}
+
+static void
+heapremove(struct proc *p)
+{
+  int i = p->rqidx;
+
+  if(i < 0 || i >= hq.n || hq.heap[i] != p)
+    panic("heapremove");
+  p->rqidx = -1;
+  if(i == --hq.n)
+    return;
+  hset(i, hq.heap[hq.n]);
+  siftdown(i);
+  siftup(hq.heap[i]->rqidx);
+}
+
+static struct proc*
+heappeekmin(void)
+{
+  return hq.n > 0 ? hq.heap[0] : 0;
+}
+
+static void
+heapupdate(struct proc *p, int deadline)
+{
+  p->vdeadline = deadline;
+  siftdown(p->rqidx);
+  siftup(p->rqidx);
+}
+
+struct rqops heaprq = {
+  .name = "heap",
+  .init = heapinit,
+  .insert = heapinsert,
+  .remove = heapremove,
+  .peekmin = heappeekmin,
+  .update = heapupdate,
+};
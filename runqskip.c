@@ -0,0 +1,64 @@
+// Skip list run queue backend (see skiplist.c).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "skiplist.h"
+#include "runq.h"
+
+static void
+skipinit(void)
+{
+  initSkipList();
+}
+
+static int
+skipinsert(struct proc *p)
+{
+  return slInsert(p->vdeadline, p->pid, CHANCE);
+}
+
+static void
+skipremove(struct proc *p)
+{
+  if(slDelete(p->vdeadline, p->pid) == 0)
+    panic("skipremove");
+}
+
+static struct proc*
+skippeekmin(void)
+{
+  struct SkipNode *head = &sl.nodeList[0];
+  struct SkipNode *first;
+  struct proc *p;
+
+  if(head->forward[0] <= 0 || head->forward[0] > NPROC)
+    return 0;
+  first = &sl.nodeList[head->forward[0]];
+  if(!first->valid)
+    return 0;
+  if((p = findproc(first->pid)) == 0)
+    panic("skippeekmin");
+  p->maxlevel = first->maxlevel;
+  return p;
+}
+
+static void
+skipupdate(struct proc *p, int deadline)
+{
+  skipremove(p);
+  p->vdeadline = deadline;
+  if(skipinsert(p) < 0)
+    panic("skipupdate");
+}
+
+struct rqops skiplistrq = {
+  .name = "skiplist",
+  .init = skipinit,
+  .insert = skipinsert,
+  .remove = skipremove,
+  .peekmin = skippeekmin,
+  .update = skipupdate,
+};
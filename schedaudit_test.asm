@@ -0,0 +1,757 @@
+
+_schedaudit_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define WINDOW 3000  // Ticks to measure over
+#define WSCALE 100000  // Fixed-point scale for 1 / PRIO_RATIO
+
+int niceSetter[NCHILD] = {-20, -5, 0, 9};
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec c8 01 00 00    	sub    $0x1c8,%esp
+  struct schedstat st;
+  int pids[NCHILD];
+  uint w[NCHILD], wsum, total, expect, got, tol;
+  int i, l, fail = 0;
+
+  if (getpid() == 1) {
+  17:	e8 22 03 00 00       	call   33e <getpid>
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	74 46                	je     67 <main+0x67>
+    }
+    dup(0);
+    dup(0);
+  }
+
+  schedstat(&st, 1);
+  21:	83 ec 08             	sub    $0x8,%esp
+  24:	6a 01                	push   $0x1
+  26:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+  2c:	50                   	push   %eax
+  2d:	e8 4c 03 00 00       	call   37e <schedstat>
+  for (i = 0; i < NCHILD; i++) {
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  3a:	83 fb 03             	cmp    $0x3,%ebx
+  3d:	0f 8f 90 00 00 00    	jg     d3 <main+0xd3>
+    if ((pids[i] = nicefork(niceSetter[i])) == 0) {
+  43:	83 ec 0c             	sub    $0xc,%esp
+  46:	ff 34 9d 40 07 00 00 	push   0x740(,%ebx,4)
+  4d:	e8 1c 03 00 00       	call   36e <nicefork>
+  52:	89 84 9d 54 fe ff ff 	mov    %eax,-0x1ac(%ebp,%ebx,4)
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	74 5d                	je     bd <main+0xbd>
+      for (;;)
+        ;
+    }
+    if (pids[i] < 0) {
+  60:	78 5d                	js     bf <main+0xbf>
+  for (i = 0; i < NCHILD; i++) {
+  62:	83 c3 01             	add    $0x1,%ebx
+  65:	eb d3                	jmp    3a <main+0x3a>
+    if (open("console", O_RDWR) < 0) {
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	6a 02                	push   $0x2
+  6c:	68 d6 05 00 00       	push   $0x5d6
+  71:	e8 88 02 00 00       	call   2fe <open>
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	85 c0                	test   %eax,%eax
+  7b:	78 1b                	js     98 <main+0x98>
+    dup(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 af 02 00 00       	call   336 <dup>
+    dup(0);
+  87:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8e:	e8 a3 02 00 00       	call   336 <dup>
+  93:	83 c4 10             	add    $0x10,%esp
+  96:	eb 89                	jmp    21 <main+0x21>
+      mknod("console", 1, 1);
+  98:	83 ec 04             	sub    $0x4,%esp
+  9b:	6a 01                	push   $0x1
+  9d:	6a 01                	push   $0x1
+  9f:	68 d6 05 00 00       	push   $0x5d6
+  a4:	e8 5d 02 00 00       	call   306 <mknod>
+      open("console", O_RDWR);
+  a9:	83 c4 08             	add    $0x8,%esp
+  ac:	6a 02                	push   $0x2
+  ae:	68 d6 05 00 00       	push   $0x5d6
+  b3:	e8 46 02 00 00       	call   2fe <open>
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	eb c0                	jmp    7d <main+0x7d>
+      for (;;)
+  bd:	eb fe                	jmp    bd <main+0xbd>
+      printf(1, "schedaudit_test: nicefork failed\n");
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	68 f4 05 00 00       	push   $0x5f4
+  c7:	6a 01                	push   $0x1
+  c9:	e8 6d 03 00 00       	call   43b <printf>
+      exit();
+  ce:	e8 eb 01 00 00       	call   2be <exit>
+    }
+  }
+
+  sleep(WINDOW);
+  d3:	83 ec 0c             	sub    $0xc,%esp
+  d6:	68 b8 0b 00 00       	push   $0xbb8
+  db:	e8 6e 02 00 00       	call   34e <sleep>
+  schedstat(&st, 0);
+  e0:	83 c4 08             	add    $0x8,%esp
+  e3:	6a 00                	push   $0x0
+  e5:	8d 85 64 fe ff ff    	lea    -0x19c(%ebp),%eax
+  eb:	50                   	push   %eax
+  ec:	e8 8d 02 00 00       	call   37e <schedstat>
+
+  for (i = 0; i < NCHILD; i++)
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  f9:	eb 15                	jmp    110 <main+0x110>
+    kill(pids[i]);
+  fb:	83 ec 0c             	sub    $0xc,%esp
+  fe:	ff b4 9d 54 fe ff ff 	push   -0x1ac(%ebp,%ebx,4)
+ 105:	e8 e4 01 00 00       	call   2ee <kill>
+  for (i = 0; i < NCHILD; i++)
+ 10a:	83 c3 01             	add    $0x1,%ebx
+ 10d:	83 c4 10             	add    $0x10,%esp
+ 110:	83 fb 03             	cmp    $0x3,%ebx
+ 113:	7e e6                	jle    fb <main+0xfb>
+  for (i = 0; i < NCHILD; i++)
+ 115:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 11a:	eb 08                	jmp    124 <main+0x124>
+    wait();
+ 11c:	e8 a5 01 00 00       	call   2c6 <wait>
+  for (i = 0; i < NCHILD; i++)
+ 121:	83 c3 01             	add    $0x1,%ebx
+ 124:	83 fb 03             	cmp    $0x3,%ebx
+ 127:	7e f3                	jle    11c <main+0x11c>
+
+  if (st.ncpu != 1) {
+ 129:	8b 85 64 fe ff ff    	mov    -0x19c(%ebp),%eax
+ 12f:	83 f8 01             	cmp    $0x1,%eax
+ 132:	75 46                	jne    17a <main+0x17a>
+    goto done;
+  }
+
+  wsum = 0;
+  total = 0;
+  for (i = 0; i < NCHILD; i++) {
+ 134:	b9 00 00 00 00       	mov    $0x0,%ecx
+  total = 0;
+ 139:	be 00 00 00 00       	mov    $0x0,%esi
+  wsum = 0;
+ 13e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for (i = 0; i < NCHILD; i++) {
+ 143:	83 f9 03             	cmp    $0x3,%ecx
+ 146:	7f 4a                	jg     192 <main+0x192>
+    w[i] = WSCALE / PRIO_RATIO(niceSetter[i]);
+ 148:	8b 04 8d 40 07 00 00 	mov    0x740(,%ecx,4),%eax
+ 14f:	8d 78 15             	lea    0x15(%eax),%edi
+ 152:	b8 a0 86 01 00       	mov    $0x186a0,%eax
+ 157:	ba 00 00 00 00       	mov    $0x0,%edx
+ 15c:	f7 ff                	idiv   %edi
+ 15e:	89 84 8d 44 fe ff ff 	mov    %eax,-0x1bc(%ebp,%ecx,4)
+    wsum += w[i];
+ 165:	01 c3                	add    %eax,%ebx
+    total += st.runticks[niceSetter[i] - BFS_NICE_FIRST_LEVEL];
+ 167:	8b 04 8d 40 07 00 00 	mov    0x740(,%ecx,4),%eax
+ 16e:	03 b4 85 c0 fe ff ff 	add    -0x140(%ebp,%eax,4),%esi
+  for (i = 0; i < NCHILD; i++) {
+ 175:	83 c1 01             	add    $0x1,%ecx
+ 178:	eb c9                	jmp    143 <main+0x143>
+    printf(1, "schedaudit_test: skipped, expected shares assume CPUS=1 (ncpu %d)\n", st.ncpu);
+ 17a:	83 ec 04             	sub    $0x4,%esp
+ 17d:	50                   	push   %eax
+ 17e:	68 18 06 00 00       	push   $0x618
+ 183:	6a 01                	push   $0x1
+ 185:	e8 b1 02 00 00       	call   43b <printf>
+    goto done;
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	e9 e4 00 00 00       	jmp    276 <main+0x276>
+  int i, l, fail = 0;
+ 192:	89 9d 2c fe ff ff    	mov    %ebx,-0x1d4(%ebp)
+ 198:	89 b5 28 fe ff ff    	mov    %esi,-0x1d8(%ebp)
+ 19e:	c7 85 30 fe ff ff 00 	movl   $0x0,-0x1d0(%ebp)
+ 1a5:	00 00 00 
+  }
+
+  for (i = 0; i < NCHILD; i++) {
+ 1a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ad:	eb 0d                	jmp    1bc <main+0x1bc>
+    expect = total * w[i] / wsum;
+    tol = expect / 4 + 2 * BFS_DEFAULT_QUANTUM;
+    printf(1, "nice %d: %d ticks, expected %d (+-%d), max wait %d\n",
+           niceSetter[i], got, expect, tol, st.maxwait[l]);
+    if (got == 0 || got + tol < expect || got > expect + tol)
+      fail = 1;
+ 1af:	c7 85 30 fe ff ff 01 	movl   $0x1,-0x1d0(%ebp)
+ 1b6:	00 00 00 
+  for (i = 0; i < NCHILD; i++) {
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	83 fb 03             	cmp    $0x3,%ebx
+ 1bf:	0f 8f 89 00 00 00    	jg     24e <main+0x24e>
+    l = niceSetter[i] - BFS_NICE_FIRST_LEVEL;
+ 1c5:	8b 0c 9d 40 07 00 00 	mov    0x740(,%ebx,4),%ecx
+    got = st.runticks[l];
+ 1cc:	8b bc 8d c0 fe ff ff 	mov    -0x140(%ebp,%ecx,4),%edi
+    expect = total * w[i] / wsum;
+ 1d3:	8b 85 28 fe ff ff    	mov    -0x1d8(%ebp),%eax
+ 1d9:	0f af 84 9d 44 fe ff 	imul   -0x1bc(%ebp,%ebx,4),%eax
+ 1e0:	ff 
+ 1e1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1e6:	f7 b5 2c fe ff ff    	divl   -0x1d4(%ebp)
+    tol = expect / 4 + 2 * BFS_DEFAULT_QUANTUM;
+ 1ec:	89 c6                	mov    %eax,%esi
+ 1ee:	c1 ee 02             	shr    $0x2,%esi
+ 1f1:	83 c6 64             	add    $0x64,%esi
+    printf(1, "nice %d: %d ticks, expected %d (+-%d), max wait %d\n",
+ 1f4:	83 ec 04             	sub    $0x4,%esp
+ 1f7:	ff b4 8d 60 ff ff ff 	push   -0xa0(%ebp,%ecx,4)
+ 1fe:	56                   	push   %esi
+ 1ff:	89 85 34 fe ff ff    	mov    %eax,-0x1cc(%ebp)
+ 205:	50                   	push   %eax
+ 206:	57                   	push   %edi
+ 207:	51                   	push   %ecx
+ 208:	68 5c 06 00 00       	push   $0x65c
+ 20d:	6a 01                	push   $0x1
+ 20f:	e8 27 02 00 00       	call   43b <printf>
+    if (got == 0 || got + tol < expect || got > expect + tol)
+ 214:	83 c4 20             	add    $0x20,%esp
+ 217:	85 ff                	test   %edi,%edi
+ 219:	74 94                	je     1af <main+0x1af>
+ 21b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+ 21e:	8b 95 34 fe ff ff    	mov    -0x1cc(%ebp),%edx
+ 224:	39 d0                	cmp    %edx,%eax
+ 226:	72 17                	jb     23f <main+0x23f>
+ 228:	89 d0                	mov    %edx,%eax
+ 22a:	01 f0                	add    %esi,%eax
+ 22c:	39 f8                	cmp    %edi,%eax
+ 22e:	73 89                	jae    1b9 <main+0x1b9>
+      fail = 1;
+ 230:	c7 85 30 fe ff ff 01 	movl   $0x1,-0x1d0(%ebp)
+ 237:	00 00 00 
+ 23a:	e9 7a ff ff ff       	jmp    1b9 <main+0x1b9>
+ 23f:	c7 85 30 fe ff ff 01 	movl   $0x1,-0x1d0(%ebp)
+ 246:	00 00 00 
+ 249:	e9 6b ff ff ff       	jmp    1b9 <main+0x1b9>
+  }
+
+  if (st.starved) {
+ 24e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 251:	85 c0                	test   %eax,%eax
+ 253:	75 30                	jne    285 <main+0x285>
+    printf(1, "%d starved waits, last pid %d waited %d ticks (bound %d)\n",
+           st.starved, st.starvepid, st.starvewait, st.starvebound);
+    fail = 1;
+  }
+
+  printf(1, "schedaudit_test: %s\n", fail ? "FAIL" : "PASS");
+ 255:	83 bd 30 fe ff ff 00 	cmpl   $0x0,-0x1d0(%ebp)
+ 25c:	74 4a                	je     2a8 <main+0x2a8>
+ 25e:	b8 cc 05 00 00       	mov    $0x5cc,%eax
+ 263:	83 ec 04             	sub    $0x4,%esp
+ 266:	50                   	push   %eax
+ 267:	68 de 05 00 00       	push   $0x5de
+ 26c:	6a 01                	push   $0x1
+ 26e:	e8 c8 01 00 00       	call   43b <printf>
+ 273:	83 c4 10             	add    $0x10,%esp
+
+done:
+  if (getpid() == 1)
+ 276:	e8 c3 00 00 00       	call   33e <getpid>
+ 27b:	83 f8 01             	cmp    $0x1,%eax
+ 27e:	74 2f                	je     2af <main+0x2af>
+    shutdown();
+  exit();
+ 280:	e8 39 00 00 00       	call   2be <exit>
+    printf(1, "%d starved waits, last pid %d waited %d ticks (bound %d)\n",
+ 285:	83 ec 08             	sub    $0x8,%esp
+ 288:	ff 75 bc             	push   -0x44(%ebp)
+ 28b:	ff 75 b8             	push   -0x48(%ebp)
+ 28e:	ff 75 b4             	push   -0x4c(%ebp)
+ 291:	50                   	push   %eax
+ 292:	68 90 06 00 00       	push   $0x690
+ 297:	6a 01                	push   $0x1
+ 299:	e8 9d 01 00 00       	call   43b <printf>
+ 29e:	83 c4 20             	add    $0x20,%esp
+  printf(1, "schedaudit_test: %s\n", fail ? "FAIL" : "PASS");
+ 2a1:	b8 cc 05 00 00       	mov    $0x5cc,%eax
+ 2a6:	eb bb                	jmp    263 <main+0x263>
+ 2a8:	b8 d1 05 00 00       	mov    $0x5d1,%eax
+ 2ad:	eb b4                	jmp    263 <main+0x263>
+    shutdown();
+ 2af:	e8 b2 00 00 00       	call   366 <shutdown>
+ 2b4:	eb ca                	jmp    280 <main+0x280>
+
+000002b6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+000002be <exit>:
+SYSCALL(exit)
+ 2be:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+000002c6 <wait>:
+SYSCALL(wait)
+ 2c6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <pipe>:
+SYSCALL(pipe)
+ 2ce:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <read>:
+SYSCALL(read)
+ 2d6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <write>:
+SYSCALL(write)
+ 2de:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <close>:
+SYSCALL(close)
+ 2e6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <kill>:
+SYSCALL(kill)
+ 2ee:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <exec>:
+SYSCALL(exec)
+ 2f6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <open>:
+SYSCALL(open)
+ 2fe:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <mknod>:
+SYSCALL(mknod)
+ 306:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <unlink>:
+SYSCALL(unlink)
+ 30e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <fstat>:
+SYSCALL(fstat)
+ 316:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <link>:
+SYSCALL(link)
+ 31e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <mkdir>:
+SYSCALL(mkdir)
+ 326:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <chdir>:
+SYSCALL(chdir)
+ 32e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <dup>:
+SYSCALL(dup)
+ 336:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <getpid>:
+SYSCALL(getpid)
+ 33e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <sbrk>:
+SYSCALL(sbrk)
+ 346:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <sleep>:
+SYSCALL(sleep)
+ 34e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <uptime>:
+SYSCALL(uptime)
+ 356:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <yield>:
+SYSCALL(yield)
+ 35e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <shutdown>:
+SYSCALL(shutdown)
+ 366:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <nicefork>:
+SYSCALL(nicefork)
+ 36e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <schedlog>:
+SYSCALL(schedlog)
+ 376:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <schedstat>:
+SYSCALL(schedstat)
+ 37e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <spawn>:
+SYSCALL(spawn)
+ 386:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <bstat>:
+SYSCALL(bstat)
+ 38e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 396:	55                   	push   %ebp
+ 397:	89 e5                	mov    %esp,%ebp
+ 399:	83 ec 1c             	sub    $0x1c,%esp
+ 39c:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 39f:	6a 01                	push   $0x1
+ 3a1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3a4:	52                   	push   %edx
+ 3a5:	50                   	push   %eax
+ 3a6:	e8 33 ff ff ff       	call   2de <write>
+}
+ 3ab:	83 c4 10             	add    $0x10,%esp
+ 3ae:	c9                   	leave
+ 3af:	c3                   	ret
+
+000003b0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	83 ec 2c             	sub    $0x2c,%esp
+ 3b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3bc:	89 d0                	mov    %edx,%eax
+ 3be:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3c0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3c4:	0f 95 c1             	setne  %cl
+ 3c7:	c1 ea 1f             	shr    $0x1f,%edx
+ 3ca:	84 d1                	test   %dl,%cl
+ 3cc:	74 44                	je     412 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3ce:	f7 d8                	neg    %eax
+ 3d0:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3d2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3de:	89 c8                	mov    %ecx,%eax
+ 3e0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e5:	f7 f6                	div    %esi
+ 3e7:	89 df                	mov    %ebx,%edi
+ 3e9:	83 c3 01             	add    $0x1,%ebx
+ 3ec:	0f b6 92 2c 07 00 00 	movzbl 0x72c(%edx),%edx
+ 3f3:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 3f7:	89 ca                	mov    %ecx,%edx
+ 3f9:	89 c1                	mov    %eax,%ecx
+ 3fb:	39 f2                	cmp    %esi,%edx
+ 3fd:	73 df                	jae    3de <printint+0x2e>
+  if(neg)
+ 3ff:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 403:	74 31                	je     436 <printint+0x86>
+    buf[i++] = '-';
+ 405:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 40a:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 40d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 410:	eb 17                	jmp    429 <printint+0x79>
+    x = xx;
+ 412:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 414:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 41b:	eb bc                	jmp    3d9 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 41d:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 422:	89 f0                	mov    %esi,%eax
+ 424:	e8 6d ff ff ff       	call   396 <putc>
+  while(--i >= 0)
+ 429:	83 eb 01             	sub    $0x1,%ebx
+ 42c:	79 ef                	jns    41d <printint+0x6d>
+}
+ 42e:	83 c4 2c             	add    $0x2c,%esp
+ 431:	5b                   	pop    %ebx
+ 432:	5e                   	pop    %esi
+ 433:	5f                   	pop    %edi
+ 434:	5d                   	pop    %ebp
+ 435:	c3                   	ret
+ 436:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 439:	eb ee                	jmp    429 <printint+0x79>
+
+0000043b <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 43b:	55                   	push   %ebp
+ 43c:	89 e5                	mov    %esp,%ebp
+ 43e:	57                   	push   %edi
+ 43f:	56                   	push   %esi
+ 440:	53                   	push   %ebx
+ 441:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 444:	8d 45 10             	lea    0x10(%ebp),%eax
+ 447:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 44a:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 44f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 454:	eb 14                	jmp    46a <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 456:	89 fa                	mov    %edi,%edx
+ 458:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45b:	e8 36 ff ff ff       	call   396 <putc>
+ 460:	eb 05                	jmp    467 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 462:	83 fe 25             	cmp    $0x25,%esi
+ 465:	74 25                	je     48c <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 467:	83 c3 01             	add    $0x1,%ebx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 471:	84 c0                	test   %al,%al
+ 473:	0f 84 4a 01 00 00    	je     5c3 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 479:	0f be f8             	movsbl %al,%edi
+ 47c:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 47f:	85 f6                	test   %esi,%esi
+ 481:	75 df                	jne    462 <printf+0x27>
+      if(c == '%'){
+ 483:	83 f8 25             	cmp    $0x25,%eax
+ 486:	75 ce                	jne    456 <printf+0x1b>
+        state = '%';
+ 488:	89 c6                	mov    %eax,%esi
+ 48a:	eb db                	jmp    467 <printf+0x2c>
+      if(c == 'd'){
+ 48c:	83 f8 25             	cmp    $0x25,%eax
+ 48f:	0f 84 f9 00 00 00    	je     58e <printf+0x153>
+ 495:	0f 8c 07 01 00 00    	jl     5a2 <printf+0x167>
+ 49b:	83 f8 78             	cmp    $0x78,%eax
+ 49e:	0f 8f fe 00 00 00    	jg     5a2 <printf+0x167>
+ 4a4:	83 f8 63             	cmp    $0x63,%eax
+ 4a7:	0f 8c f5 00 00 00    	jl     5a2 <printf+0x167>
+ 4ad:	83 e8 63             	sub    $0x63,%eax
+ 4b0:	83 f8 15             	cmp    $0x15,%eax
+ 4b3:	0f 87 e9 00 00 00    	ja     5a2 <printf+0x167>
+ 4b9:	ff 24 85 d4 06 00 00 	jmp    *0x6d4(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4c3:	8b 17                	mov    (%edi),%edx
+ 4c5:	83 ec 0c             	sub    $0xc,%esp
+ 4c8:	6a 01                	push   $0x1
+ 4ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d2:	e8 d9 fe ff ff       	call   3b0 <printint>
+        ap++;
+ 4d7:	83 c7 04             	add    $0x4,%edi
+ 4da:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4e0:	be 00 00 00 00       	mov    $0x0,%esi
+ 4e5:	eb 80                	jmp    467 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 4e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4ea:	8b 17                	mov    (%edi),%edx
+ 4ec:	83 ec 0c             	sub    $0xc,%esp
+ 4ef:	6a 00                	push   $0x0
+ 4f1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f9:	e8 b2 fe ff ff       	call   3b0 <printint>
+        ap++;
+ 4fe:	83 c7 04             	add    $0x4,%edi
+ 501:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 504:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 507:	be 00 00 00 00       	mov    $0x0,%esi
+ 50c:	e9 56 ff ff ff       	jmp    467 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 511:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 514:	8b 17                	mov    (%edi),%edx
+ 516:	83 ec 0c             	sub    $0xc,%esp
+ 519:	6a 00                	push   $0x0
+ 51b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 520:	8b 45 08             	mov    0x8(%ebp),%eax
+ 523:	e8 88 fe ff ff       	call   3b0 <printint>
+        ap++;
+ 528:	83 c7 04             	add    $0x4,%edi
+ 52b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 52e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 531:	be 00 00 00 00       	mov    $0x0,%esi
+ 536:	e9 2c ff ff ff       	jmp    467 <printf+0x2c>
+        s = (char*)*ap;
+ 53b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 53e:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 540:	83 c0 04             	add    $0x4,%eax
+ 543:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 546:	85 f6                	test   %esi,%esi
+ 548:	75 15                	jne    55f <printf+0x124>
+          s = "(null)";
+ 54a:	be ca 06 00 00       	mov    $0x6ca,%esi
+ 54f:	eb 0e                	jmp    55f <printf+0x124>
+          putc(fd, *s);
+ 551:	0f be d2             	movsbl %dl,%edx
+ 554:	8b 45 08             	mov    0x8(%ebp),%eax
+ 557:	e8 3a fe ff ff       	call   396 <putc>
+          s++;
+ 55c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 55f:	0f b6 16             	movzbl (%esi),%edx
+ 562:	84 d2                	test   %dl,%dl
+ 564:	75 eb                	jne    551 <printf+0x116>
+      state = 0;
+ 566:	be 00 00 00 00       	mov    $0x0,%esi
+ 56b:	e9 f7 fe ff ff       	jmp    467 <printf+0x2c>
+        putc(fd, *ap);
+ 570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 573:	0f be 17             	movsbl (%edi),%edx
+ 576:	8b 45 08             	mov    0x8(%ebp),%eax
+ 579:	e8 18 fe ff ff       	call   396 <putc>
+        ap++;
+ 57e:	83 c7 04             	add    $0x4,%edi
+ 581:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 584:	be 00 00 00 00       	mov    $0x0,%esi
+ 589:	e9 d9 fe ff ff       	jmp    467 <printf+0x2c>
+        putc(fd, c);
+ 58e:	89 fa                	mov    %edi,%edx
+ 590:	8b 45 08             	mov    0x8(%ebp),%eax
+ 593:	e8 fe fd ff ff       	call   396 <putc>
+      state = 0;
+ 598:	be 00 00 00 00       	mov    $0x0,%esi
+ 59d:	e9 c5 fe ff ff       	jmp    467 <printf+0x2c>
+        putc(fd, '%');
+ 5a2:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	e8 e7 fd ff ff       	call   396 <putc>
+        putc(fd, c);
+ 5af:	89 fa                	mov    %edi,%edx
+ 5b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b4:	e8 dd fd ff ff       	call   396 <putc>
+      state = 0;
+ 5b9:	be 00 00 00 00       	mov    $0x0,%esi
+ 5be:	e9 a4 fe ff ff       	jmp    467 <printf+0x2c>
+    }
+  }
+}
+ 5c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c6:	5b                   	pop    %ebx
+ 5c7:	5e                   	pop    %esi
+ 5c8:	5f                   	pop    %edi
+ 5c9:	5d                   	pop    %ebp
+ 5ca:	c3                   	ret
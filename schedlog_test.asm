@@ -0,0 +1,543 @@
+
+_schedlog_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 38             	sub    $0x38,%esp
+    int niceSetter[] = {-20, -5, 0, 9};
+  13:	c7 45 d8 ec ff ff ff 	movl   $0xffffffec,-0x28(%ebp)
+  1a:	c7 45 dc fb ff ff ff 	movl   $0xfffffffb,-0x24(%ebp)
+  21:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  28:	c7 45 e4 09 00 00 00 	movl   $0x9,-0x1c(%ebp)
+    int n;
+    schedlog(10000);
+  2f:	68 10 27 00 00       	push   $0x2710
+  34:	e8 36 01 00 00       	call   16f <schedlog>
+
+    for (n = 0; n < 4; n++) {
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	be 00 00 00 00       	mov    $0x0,%esi
+  41:	eb 03                	jmp    46 <main+0x46>
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 fe 03             	cmp    $0x3,%esi
+  49:	7f 3c                	jg     87 <main+0x87>
+        char *argv[] = {"loop", 0};
+  4b:	c7 45 d0 c4 03 00 00 	movl   $0x3c4,-0x30(%ebp)
+  52:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+        if (spawn("loop", argv, niceSetter[n]) < 0) {
+  59:	83 ec 04             	sub    $0x4,%esp
+  5c:	ff 74 b5 d8          	push   -0x28(%ebp,%esi,4)
+  60:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  63:	50                   	push   %eax
+  64:	68 c4 03 00 00       	push   $0x3c4
+  69:	e8 11 01 00 00       	call   17f <spawn>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	85 c0                	test   %eax,%eax
+  73:	79 ce                	jns    43 <main+0x43>
+            printf(1, "schedlog_test: spawn failed\n");
+  75:	83 ec 08             	sub    $0x8,%esp
+  78:	68 c9 03 00 00       	push   $0x3c9
+  7d:	6a 01                	push   $0x1
+  7f:	e8 b0 01 00 00       	call   234 <printf>
+            break;
+  84:	83 c4 10             	add    $0x10,%esp
+    for (n = 0; n < 4; n++) {
+  87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8c:	eb 08                	jmp    96 <main+0x96>
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        wait();
+  8e:	e8 2c 00 00 00       	call   bf <wait>
+    for (int i = 0; i < n; i++) {
+  93:	83 c3 01             	add    $0x1,%ebx
+  96:	39 de                	cmp    %ebx,%esi
+  98:	7f f4                	jg     8e <main+0x8e>
+    }
+    
+    shutdown();
+  9a:	e8 c0 00 00 00       	call   15f <shutdown>
+  9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  a7:	59                   	pop    %ecx
+  a8:	5b                   	pop    %ebx
+  a9:	5e                   	pop    %esi
+  aa:	5d                   	pop    %ebp
+  ab:	8d 61 fc             	lea    -0x4(%ecx),%esp
+  ae:	c3                   	ret
+
+000000af <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  af:	b8 01 00 00 00       	mov    $0x1,%eax
+  b4:	cd 40                	int    $0x40
+  b6:	c3                   	ret
+
+000000b7 <exit>:
+SYSCALL(exit)
+  b7:	b8 02 00 00 00       	mov    $0x2,%eax
+  bc:	cd 40                	int    $0x40
+  be:	c3                   	ret
+
+000000bf <wait>:
+SYSCALL(wait)
+  bf:	b8 03 00 00 00       	mov    $0x3,%eax
+  c4:	cd 40                	int    $0x40
+  c6:	c3                   	ret
+
+000000c7 <pipe>:
+SYSCALL(pipe)
+  c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  cc:	cd 40                	int    $0x40
+  ce:	c3                   	ret
+
+000000cf <read>:
+SYSCALL(read)
+  cf:	b8 05 00 00 00       	mov    $0x5,%eax
+  d4:	cd 40                	int    $0x40
+  d6:	c3                   	ret
+
+000000d7 <write>:
+SYSCALL(write)
+  d7:	b8 10 00 00 00       	mov    $0x10,%eax
+  dc:	cd 40                	int    $0x40
+  de:	c3                   	ret
+
+000000df <close>:
+SYSCALL(close)
+  df:	b8 15 00 00 00       	mov    $0x15,%eax
+  e4:	cd 40                	int    $0x40
+  e6:	c3                   	ret
+
+000000e7 <kill>:
+SYSCALL(kill)
+  e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  ec:	cd 40                	int    $0x40
+  ee:	c3                   	ret
+
+000000ef <exec>:
+SYSCALL(exec)
+  ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  f4:	cd 40                	int    $0x40
+  f6:	c3                   	ret
+
+000000f7 <open>:
+SYSCALL(open)
+  f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  fc:	cd 40                	int    $0x40
+  fe:	c3                   	ret
+
+000000ff <mknod>:
+SYSCALL(mknod)
+  ff:	b8 11 00 00 00       	mov    $0x11,%eax
+ 104:	cd 40                	int    $0x40
+ 106:	c3                   	ret
+
+00000107 <unlink>:
+SYSCALL(unlink)
+ 107:	b8 12 00 00 00       	mov    $0x12,%eax
+ 10c:	cd 40                	int    $0x40
+ 10e:	c3                   	ret
+
+0000010f <fstat>:
+SYSCALL(fstat)
+ 10f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 114:	cd 40                	int    $0x40
+ 116:	c3                   	ret
+
+00000117 <link>:
+SYSCALL(link)
+ 117:	b8 13 00 00 00       	mov    $0x13,%eax
+ 11c:	cd 40                	int    $0x40
+ 11e:	c3                   	ret
+
+0000011f <mkdir>:
+SYSCALL(mkdir)
+ 11f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 124:	cd 40                	int    $0x40
+ 126:	c3                   	ret
+
+00000127 <chdir>:
+SYSCALL(chdir)
+ 127:	b8 09 00 00 00       	mov    $0x9,%eax
+ 12c:	cd 40                	int    $0x40
+ 12e:	c3                   	ret
+
+0000012f <dup>:
+SYSCALL(dup)
+ 12f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 134:	cd 40                	int    $0x40
+ 136:	c3                   	ret
+
+00000137 <getpid>:
+SYSCALL(getpid)
+ 137:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 13c:	cd 40                	int    $0x40
+ 13e:	c3                   	ret
+
+0000013f <sbrk>:
+SYSCALL(sbrk)
+ 13f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 144:	cd 40                	int    $0x40
+ 146:	c3                   	ret
+
+00000147 <sleep>:
+SYSCALL(sleep)
+ 147:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 14c:	cd 40                	int    $0x40
+ 14e:	c3                   	ret
+
+0000014f <uptime>:
+SYSCALL(uptime)
+ 14f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 154:	cd 40                	int    $0x40
+ 156:	c3                   	ret
+
+00000157 <yield>:
+SYSCALL(yield)
+ 157:	b8 16 00 00 00       	mov    $0x16,%eax
+ 15c:	cd 40                	int    $0x40
+ 15e:	c3                   	ret
+
+0000015f <shutdown>:
+SYSCALL(shutdown)
+ 15f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 164:	cd 40                	int    $0x40
+ 166:	c3                   	ret
+
+00000167 <nicefork>:
+SYSCALL(nicefork)
+ 167:	b8 18 00 00 00       	mov    $0x18,%eax
+ 16c:	cd 40                	int    $0x40
+ 16e:	c3                   	ret
+
+0000016f <schedlog>:
+SYSCALL(schedlog)
+ 16f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 174:	cd 40                	int    $0x40
+ 176:	c3                   	ret
+
+00000177 <schedstat>:
+SYSCALL(schedstat)
+ 177:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 17c:	cd 40                	int    $0x40
+ 17e:	c3                   	ret
+
+0000017f <spawn>:
+SYSCALL(spawn)
+ 17f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 184:	cd 40                	int    $0x40
+ 186:	c3                   	ret
+
+00000187 <bstat>:
+SYSCALL(bstat)
+ 187:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 18c:	cd 40                	int    $0x40
+ 18e:	c3                   	ret
+
+0000018f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 18f:	55                   	push   %ebp
+ 190:	89 e5                	mov    %esp,%ebp
+ 192:	83 ec 1c             	sub    $0x1c,%esp
+ 195:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 198:	6a 01                	push   $0x1
+ 19a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 19d:	52                   	push   %edx
+ 19e:	50                   	push   %eax
+ 19f:	e8 33 ff ff ff       	call   d7 <write>
+}
+ 1a4:	83 c4 10             	add    $0x10,%esp
+ 1a7:	c9                   	leave
+ 1a8:	c3                   	ret
+
+000001a9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1a9:	55                   	push   %ebp
+ 1aa:	89 e5                	mov    %esp,%ebp
+ 1ac:	57                   	push   %edi
+ 1ad:	56                   	push   %esi
+ 1ae:	53                   	push   %ebx
+ 1af:	83 ec 2c             	sub    $0x2c,%esp
+ 1b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 1b9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 1bd:	0f 95 c1             	setne  %cl
+ 1c0:	c1 ea 1f             	shr    $0x1f,%edx
+ 1c3:	84 d1                	test   %dl,%cl
+ 1c5:	74 44                	je     20b <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 1c7:	f7 d8                	neg    %eax
+ 1c9:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 1cb:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 1d7:	89 c8                	mov    %ecx,%eax
+ 1d9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1de:	f7 f6                	div    %esi
+ 1e0:	89 df                	mov    %ebx,%edi
+ 1e2:	83 c3 01             	add    $0x1,%ebx
+ 1e5:	0f b6 92 48 04 00 00 	movzbl 0x448(%edx),%edx
+ 1ec:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 1f0:	89 ca                	mov    %ecx,%edx
+ 1f2:	89 c1                	mov    %eax,%ecx
+ 1f4:	39 f2                	cmp    %esi,%edx
+ 1f6:	73 df                	jae    1d7 <printint+0x2e>
+  if(neg)
+ 1f8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1fc:	74 31                	je     22f <printint+0x86>
+    buf[i++] = '-';
+ 1fe:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 203:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 206:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 209:	eb 17                	jmp    222 <printint+0x79>
+    x = xx;
+ 20b:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 20d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 214:	eb bc                	jmp    1d2 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 216:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 21b:	89 f0                	mov    %esi,%eax
+ 21d:	e8 6d ff ff ff       	call   18f <putc>
+  while(--i >= 0)
+ 222:	83 eb 01             	sub    $0x1,%ebx
+ 225:	79 ef                	jns    216 <printint+0x6d>
+}
+ 227:	83 c4 2c             	add    $0x2c,%esp
+ 22a:	5b                   	pop    %ebx
+ 22b:	5e                   	pop    %esi
+ 22c:	5f                   	pop    %edi
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 232:	eb ee                	jmp    222 <printint+0x79>
+
+00000234 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+ 237:	57                   	push   %edi
+ 238:	56                   	push   %esi
+ 239:	53                   	push   %ebx
+ 23a:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 23d:	8d 45 10             	lea    0x10(%ebp),%eax
+ 240:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 243:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 248:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 24d:	eb 14                	jmp    263 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 24f:	89 fa                	mov    %edi,%edx
+ 251:	8b 45 08             	mov    0x8(%ebp),%eax
+ 254:	e8 36 ff ff ff       	call   18f <putc>
+ 259:	eb 05                	jmp    260 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 25b:	83 fe 25             	cmp    $0x25,%esi
+ 25e:	74 25                	je     285 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 260:	83 c3 01             	add    $0x1,%ebx
+ 263:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 266:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 26a:	84 c0                	test   %al,%al
+ 26c:	0f 84 4a 01 00 00    	je     3bc <printf+0x188>
+    c = fmt[i] & 0xff;
+ 272:	0f be f8             	movsbl %al,%edi
+ 275:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 278:	85 f6                	test   %esi,%esi
+ 27a:	75 df                	jne    25b <printf+0x27>
+      if(c == '%'){
+ 27c:	83 f8 25             	cmp    $0x25,%eax
+ 27f:	75 ce                	jne    24f <printf+0x1b>
+        state = '%';
+ 281:	89 c6                	mov    %eax,%esi
+ 283:	eb db                	jmp    260 <printf+0x2c>
+      if(c == 'd'){
+ 285:	83 f8 25             	cmp    $0x25,%eax
+ 288:	0f 84 f9 00 00 00    	je     387 <printf+0x153>
+ 28e:	0f 8c 07 01 00 00    	jl     39b <printf+0x167>
+ 294:	83 f8 78             	cmp    $0x78,%eax
+ 297:	0f 8f fe 00 00 00    	jg     39b <printf+0x167>
+ 29d:	83 f8 63             	cmp    $0x63,%eax
+ 2a0:	0f 8c f5 00 00 00    	jl     39b <printf+0x167>
+ 2a6:	83 e8 63             	sub    $0x63,%eax
+ 2a9:	83 f8 15             	cmp    $0x15,%eax
+ 2ac:	0f 87 e9 00 00 00    	ja     39b <printf+0x167>
+ 2b2:	ff 24 85 f0 03 00 00 	jmp    *0x3f0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 2b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2bc:	8b 17                	mov    (%edi),%edx
+ 2be:	83 ec 0c             	sub    $0xc,%esp
+ 2c1:	6a 01                	push   $0x1
+ 2c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cb:	e8 d9 fe ff ff       	call   1a9 <printint>
+        ap++;
+ 2d0:	83 c7 04             	add    $0x4,%edi
+ 2d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2d6:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 2d9:	be 00 00 00 00       	mov    $0x0,%esi
+ 2de:	eb 80                	jmp    260 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 2e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2e3:	8b 17                	mov    (%edi),%edx
+ 2e5:	83 ec 0c             	sub    $0xc,%esp
+ 2e8:	6a 00                	push   $0x0
+ 2ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 2ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f2:	e8 b2 fe ff ff       	call   1a9 <printint>
+        ap++;
+ 2f7:	83 c7 04             	add    $0x4,%edi
+ 2fa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 300:	be 00 00 00 00       	mov    $0x0,%esi
+ 305:	e9 56 ff ff ff       	jmp    260 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 30a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 30d:	8b 17                	mov    (%edi),%edx
+ 30f:	83 ec 0c             	sub    $0xc,%esp
+ 312:	6a 00                	push   $0x0
+ 314:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	e8 88 fe ff ff       	call   1a9 <printint>
+        ap++;
+ 321:	83 c7 04             	add    $0x4,%edi
+ 324:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 327:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 32a:	be 00 00 00 00       	mov    $0x0,%esi
+ 32f:	e9 2c ff ff ff       	jmp    260 <printf+0x2c>
+        s = (char*)*ap;
+ 334:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 337:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 339:	83 c0 04             	add    $0x4,%eax
+ 33c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 33f:	85 f6                	test   %esi,%esi
+ 341:	75 15                	jne    358 <printf+0x124>
+          s = "(null)";
+ 343:	be e6 03 00 00       	mov    $0x3e6,%esi
+ 348:	eb 0e                	jmp    358 <printf+0x124>
+          putc(fd, *s);
+ 34a:	0f be d2             	movsbl %dl,%edx
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	e8 3a fe ff ff       	call   18f <putc>
+          s++;
+ 355:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 358:	0f b6 16             	movzbl (%esi),%edx
+ 35b:	84 d2                	test   %dl,%dl
+ 35d:	75 eb                	jne    34a <printf+0x116>
+      state = 0;
+ 35f:	be 00 00 00 00       	mov    $0x0,%esi
+ 364:	e9 f7 fe ff ff       	jmp    260 <printf+0x2c>
+        putc(fd, *ap);
+ 369:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 36c:	0f be 17             	movsbl (%edi),%edx
+ 36f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 372:	e8 18 fe ff ff       	call   18f <putc>
+        ap++;
+ 377:	83 c7 04             	add    $0x4,%edi
+ 37a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 37d:	be 00 00 00 00       	mov    $0x0,%esi
+ 382:	e9 d9 fe ff ff       	jmp    260 <printf+0x2c>
+        putc(fd, c);
+ 387:	89 fa                	mov    %edi,%edx
+ 389:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38c:	e8 fe fd ff ff       	call   18f <putc>
+      state = 0;
+ 391:	be 00 00 00 00       	mov    $0x0,%esi
+ 396:	e9 c5 fe ff ff       	jmp    260 <printf+0x2c>
+        putc(fd, '%');
+ 39b:	ba 25 00 00 00       	mov    $0x25,%edx
+ 3a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a3:	e8 e7 fd ff ff       	call   18f <putc>
+        putc(fd, c);
+ 3a8:	89 fa                	mov    %edi,%edx
+ 3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ad:	e8 dd fd ff ff       	call   18f <putc>
+      state = 0;
+ 3b2:	be 00 00 00 00       	mov    $0x0,%esi
+ 3b7:	e9 a4 fe ff ff       	jmp    260 <printf+0x2c>
+    }
+  }
+}
+ 3bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bf:	5b                   	pop    %ebx
+ 3c0:	5e                   	pop    %esi
+ 3c1:	5f                   	pop    %edi
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
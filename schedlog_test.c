@@ -3,16 +3,18 @@
 
 int main() {
     int niceSetter[] = {-20, -5, 0, 9};
+    int n;
     schedlog(10000);
 
-    for (int i = 0; i < 4; i++) {
-        if (nicefork(niceSetter[i]) == 0) {
-            char *argv[] = {"loop", 0};
-            exec("loop", argv);
+    for (n = 0; n < 4; n++) {
+        char *argv[] = {"loop", 0};
+        if (spawn("loop", argv, niceSetter[n]) < 0) {
+            printf(1, "schedlog_test: spawn failed\n");
+            break;
         }
     }
 
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < n; i++) {
         wait();
     }
     
@@ -0,0 +1,19 @@
+// Scheduler statistics, copied out by the schedstat system call.
+// Per-nice arrays are indexed by nice - BFS_NICE_FIRST_LEVEL.
+struct schedstat {
+  uint ncpu;                       // Number of CPUs sharing the run queue
+  uint ticks;                      // Ticks since the window was last reset
+  uint audits;                     // Fairness audit passes in this window
+  uint runticks[BFS_NICE_LEVELS];  // Timer ticks spent RUNNING, per nice level
+  uint maxwait[BFS_NICE_LEVELS];   // Longest RUNNABLE wait seen, per nice level
+  uint starved;                    // RUNNABLE waits that exceeded their bound
+  int starvepid;                   // Last process flagged as starved (0 if none)
+  int starvewait;                  // Ticks it had been waiting when flagged
+  int starvebound;                 // The bound it exceeded
+  char rqname[16];                 // Run queue backend (make RUNQUEUE=...)
+  uint rqops;                      // Run queue operations in this window
+  uint rqcycles;                   // TSC cycles spent in them (wraps)
+  uint ptacquire;                  // ptable.lock acquisitions in this window
+  uint64 ptholdcycles;             // TSC cycles ptable.lock was held
+  uint cr3skips;                   // Picks that kept the loaded page table (2 cr3 loads saved)
+};
@@ -0,0 +1,378 @@
+// Sorted skip list used by the BFS scheduler as its run queue.
+// Nodes live in a fixed array and link to each other by index,
+// with -1 meaning "no neighbour"; index 0 is the head sentinel.
+// Kept free of other kernel state so that sltest.c can build
+// it on the host.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "skiplist.h"
+
+// SETTING ANY OF THESE LINES TO 1 WILL SHOW DEBUG PRINT STATEMENTS
+#define SKIPLIST_DBG_LINES 0
+#define BFS_PRINT 1
+
+// Build with `make DEBUG=1` to validate the list after every mutation.
+#ifdef DEBUG
+#define SKIPLIST_CHECK 1
+#else
+#define SKIPLIST_CHECK 0
+#endif
+
+// Zero (in BSS, not the kernel image) until initSkipList runs.
+struct SkipList sl;
+
+// Function to initialize a new sorted skip list
+void initSkipList() { // struct SkipList* skipList
+  sl.level = 0;
+  sl.ready = 1;
+
+  struct SkipNode* head = &sl.nodeList[0];
+
+  // Initialize head node kept at index 0
+  head->valid = 1;   // Valid bit for sentinel should always be true
+  head->value = -1;
+  head->pid = -1; // All actual processes have positive PIDs
+  head->maxlevel = MAX_SKIPLIST_LEVEL;
+
+  // Sentinel is alone and sad, no forward neighbors
+  for(int i = 0; i < MAX_SKIPLIST_LEVEL; i++) { 
+    head->forward[i] = -1;
+    head->backward[i] = -1;
+  }
+
+  // Set valid bit for all other nodes to 0 (empty list),
+  // stacked so that index 1 is handed out first
+  sl.nfree = 0;
+  for (int i = NPROC; i >= 1; i--) {
+    sl.freeNodes[sl.nfree++] = i;
+  }
+  for (int i = 1; i <= NPROC; i++) {
+    sl.nodeList[i].valid = 0;
+    sl.nodeList[i].value = -1;
+    sl.nodeList[i].pid = -1;
+    for (int j = 0; j < MAX_SKIPLIST_LEVEL; j++){
+      sl.nodeList[i].forward[j] = -1;
+      sl.nodeList[i].backward[j] = -1;
+    }
+  }
+}
+
+unsigned int seed = SEED;
+unsigned int random(unsigned int max) {
+  seed ^= seed << 17;
+  seed ^= seed >> 7;
+  seed ^= seed << 5;
+  return seed % max;
+}
+
+// Function to up a level by chance for a new element
+int slUpLevel(float p) {
+  int level = 0;
+  while ((random(100) / 100.0) < p && level < MAX_SKIPLIST_LEVEL - 1) {
+      level++;
+  }
+  return level;
+}
+
+// Pop an empty node off the free stack, or -1 if the list is full
+int slFindFreeNode() {
+  if (sl.nfree == 0) return -1;
+  return sl.freeNodes[--sl.nfree];
+}
+
+// Function to insert a value into the sorted skip list
+int slInsert(int value, int pid, float p) {
+  if (!sl.ready) return -1;
+
+  struct SkipNode* backNodesToUpdate[MAX_SKIPLIST_LEVEL]; // Temp array to store copies of a node
+  int backNodesIdxToUpdate[MAX_SKIPLIST_LEVEL];
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Inserting PID %d with vdeadline %d.\n", pid, value);
+
+  //* 1 - FIND THE NODE TO INSERT NEW NODE AT
+  // ----------------------------------------------------
+  int nodeIdxToInsert = 0;
+  struct SkipNode* nodeToInsert = &sl.nodeList[nodeIdxToInsert];
+
+  for (int i = sl.level; i >= 0; i--) {
+    while (nodeToInsert->forward[i] != -1
+          && sl.nodeList[nodeToInsert->forward[i]].valid != 0
+          && sl.nodeList[nodeToInsert->forward[i]].value < value) {
+      nodeIdxToInsert = nodeToInsert->forward[i];
+      nodeToInsert = &sl.nodeList[nodeIdxToInsert];
+    }
+    
+    backNodesIdxToUpdate[i] = nodeIdxToInsert;
+    backNodesToUpdate[i] = nodeToInsert;
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Reached the rightmost node at level %d (Current node: PID %d with vdeadline %d)\n", i, nodeToInsert->pid, nodeToInsert->value);
+  }
+
+  //* 2 - CHANCE FOR NODE TO BE INSERTED TO NEXT LEVEL
+  // ----------------------------------------------------
+
+  int newLevel = slUpLevel(p);
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] slUpLevel = %d\n", newLevel);
+
+  if (newLevel > sl.level) { // If new level is greater than the max level of the whole skip list, update max level
+      for (int i = sl.level + 1; i <= newLevel; i++) {
+          backNodesIdxToUpdate[i] = 0;
+          backNodesToUpdate[i] = &sl.nodeList[backNodesIdxToUpdate[i]];
+      }
+      sl.level = newLevel;
+      dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Increased skip list level to %d\n", sl.level);
+  }
+
+  //* 3 - LOOK FOR NEAREST ARRAY ELEMENT TO PLACE NODE
+  // ----------------------------------------------------
+  int newNodeIdx = slFindFreeNode();
+
+  if (newNodeIdx == -1) { 
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Insert Failed. Not enough array space.\n");
+    return -1;
+  }
+
+  struct SkipNode* newNode = &sl.nodeList[newNodeIdx];
+
+  //* 4 - CREATE NEW NODE
+  // ----------------------------------------------------
+
+  newNode->value = value;
+  newNode->pid = pid;
+  newNode->valid = 1;
+  newNode->maxlevel = newLevel;
+
+  //* 5 - UPDATE LINKS (OF NEW NODE, NEW BACKWARD, AND NEW FORWARD)
+  // ----------------------------------------------------
+
+  for (int i = 0; i <= newNode->maxlevel; i++) {
+    struct SkipNode* frontNodeToUpdate;
+
+    if (backNodesToUpdate[i]->forward[i] != -1 && sl.nodeList[backNodesToUpdate[i]->forward[i]].valid == 1) {
+      frontNodeToUpdate = &sl.nodeList[backNodesToUpdate[i]->forward[i]];
+
+      // newNode's Forward
+      newNode->forward[i] = backNodesToUpdate[i]->forward[i];
+
+      // frontNodes' Backwards should point to newNode
+      frontNodeToUpdate->backward[i] = newNodeIdx;
+    } else {
+      newNode->forward[i] = -1;
+    }
+    
+    // newNode's Backward
+    newNode->backward[i] = backNodesIdxToUpdate[i];
+
+    // backNodes' Forwards should point to newNode
+    backNodesToUpdate[i]->forward[i] = newNodeIdx;
+
+    dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Inserted at level %d (FrontNode vdeadline: %d. BackNode vdeadline: %d)\n", i, sl.nodeList[newNode->forward[i]].value, sl.nodeList[newNode->backward[i]].value);
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[INSERT] Insert PID %d with vdeadline %d Successful.\n", pid, value);
+  
+  // BFSPRINT
+  dbgprintf(BFS_PRINT, "inserted|[%d]%d\n", newNode->pid, newNode->maxlevel);
+
+  if (SKIPLIST_CHECK) slCheckInvariants();
+  return 0;
+}
+
+// Function to search for a value in the sorted skip list
+struct SkipNode* slSearch(int value, int pid) {
+  if (!sl.ready) return 0;
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Searching for PID %d with vdeadline %d\n", pid, value);
+  struct SkipNode* currentNode = &sl.nodeList[0];
+
+  //* 1 - LOOP THROUGH SKIPLIST UNTIL WE FIND VALUE RIGHT BEFORE TARGET VALUE
+  // ----------------------------------------------------
+
+  for (int i = sl.level; i >= 0; i--) {
+    dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Checking level %d (Current node: PID %d with vdeadline)\n", i, currentNode->pid, currentNode->value);
+
+      // Keep Looping WHILE:
+      //    link to next forward exists (!= -1)
+      //    linked forward node is valid (!= 0)
+      //    value for forward is less than the searched value
+    while (currentNode->forward[i] != -1
+          && sl.nodeList[currentNode->forward[i]].valid != 0
+          && sl.nodeList[currentNode->forward[i]].value < value) {
+      currentNode = &sl.nodeList[currentNode->forward[i]];
+      dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Moving right at level %d (Current node: PID %d with vdeadline %d)\n", i, sl.nodeList[currentNode->forward[i]].pid, sl.nodeList[currentNode->forward[i]].value);
+    }
+  }
+
+  //* 2 - CHECK THROUGH BOTTOMMOST LEVEL FOR ANY DUPLICATES
+  // ----------------------------------------------------
+
+  // Check bottommost level
+  while (currentNode->forward[0] != -1
+        && sl.nodeList[currentNode->forward[0]].valid != 0
+        && sl.nodeList[currentNode->forward[0]].value == value) {
+    currentNode = &sl.nodeList[currentNode->forward[0]];
+    dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] Moving right at bottom level (Current node: PID %d with vdeadline %d)\n", sl.nodeList[currentNode->forward[0]].pid, sl.nodeList[currentNode->forward[0]].value);
+    
+
+    if (currentNode->pid == pid) {
+      dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] PID %d with vdeadline %d found.\n", pid, value);
+      return currentNode;
+    }
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[SEARCH] PID %d with vdeadline %d not found.\n", pid, value);
+  return 0;
+}
+
+// Function to delete a node in the skip list
+struct SkipNode* slDelete(int value, int pid) {
+  if (!sl.ready) return 0;
+
+  //* 1 - LOOK FOR TARGET VALUE
+  // ----------------------------------------------------
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] Deleting PID %d with vdeadline %d:\n", pid, value);
+  struct SkipNode* nodeToDelete = slSearch(value, pid);
+
+  if (nodeToDelete == 0) {
+    dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] PID %d with vdeadline %d to delete not found\n", pid, value);
+    return 0;
+  } 
+
+  //* 2 - UPDATE LINKS (OF BACKWARD AND FRONT NODES)
+  // ----------------------------------------------------
+
+  for (int i = nodeToDelete->maxlevel; i >= 0; i--) {
+    struct SkipNode* backNode = &sl.nodeList[nodeToDelete->backward[i]];
+
+    if (nodeToDelete->forward[i] != -1) {
+      backNode->forward[i] = nodeToDelete->forward[i]; // BackNode's Forward should point to Forward
+
+      struct SkipNode* frontNode = &sl.nodeList[nodeToDelete->forward[i]];
+      frontNode->backward[i] = nodeToDelete->backward[i]; // FrontNode's Backward should point to Backward
+    } else {
+      backNode->forward[i] = -1;
+    }
+
+    nodeToDelete->forward[i] = -1;
+    nodeToDelete->backward[i] = -1;
+  }
+
+  dbgprintf(SKIPLIST_DBG_LINES, "[DELETE] Deletion of PID %d with vdeadline %d Successful.\n", pid, value);
+  nodeToDelete->valid = 0;
+  sl.freeNodes[sl.nfree++] = nodeToDelete - sl.nodeList;
+
+  // BFSPRINT
+  dbgprintf(BFS_PRINT, "removed|[%d]%d\n", nodeToDelete->pid, nodeToDelete->maxlevel);
+
+  if (SKIPLIST_CHECK) slCheckInvariants();
+  return nodeToDelete;
+}
+
+// Function to print the entire skip list
+void printSkipList() {
+  if (!sl.ready) return;
+
+  cprintf("Skip List:\n");
+  for (int i = sl.level; i >= 0; i--) {
+      struct SkipNode* head = &sl.nodeList[0];
+      int currentIdx = head->forward[i];
+      struct SkipNode* current = &sl.nodeList[currentIdx];
+      cprintf("Level %d: ", i);
+      while (current->valid == 1 && current->value != 0) {
+          cprintf("(%d) %d [idx: %d]-> ", current->pid, current->value, currentIdx);
+          currentIdx = current->forward[i];
+          current = &sl.nodeList[currentIdx];
+      }
+      cprintf("0\n");
+  }
+}
+
+// Function to validate the structure of the skip list. Checks that
+// every level is sorted, that forward and backward links agree, that
+// no node sits above its own maxlevel or the list's level, and that
+// exactly the valid nodes are reachable (each at every level up to
+// its maxlevel), and that the free stack holds only empty nodes and
+// accounts for all of them. Panics on the first violation.
+void slCheckInvariants() {
+  if (!sl.ready) return;
+
+  struct SkipNode* head = &sl.nodeList[0];
+  int nvalid[MAX_SKIPLIST_LEVEL];
+
+  if (sl.level < 0 || sl.level >= MAX_SKIPLIST_LEVEL)
+    panic("slCheck: list level out of range");
+  if (head->valid != 1 || head->pid != -1)
+    panic("slCheck: corrupt head");
+
+  //* 1 - COUNT VALID NODES PER LEVEL, CHECK UNUSED LINKS ARE CLEARED
+  // ----------------------------------------------------
+
+  for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+    nvalid[i] = 0;
+    if (head->backward[i] != -1)
+      panic("slCheck: head has a backward link");
+    if (i > sl.level && head->forward[i] != -1)
+      panic("slCheck: head linked above list level");
+  }
+
+  for (int n = 1; n <= NPROC; n++) {
+    struct SkipNode* node = &sl.nodeList[n];
+
+    if (node->valid != 0 && node->valid != 1)
+      panic("slCheck: bad valid bit");
+    if (node->valid && (node->maxlevel < 0 || node->maxlevel > sl.level))
+      panic("slCheck: node level out of range");
+
+    for (int i = 0; i < MAX_SKIPLIST_LEVEL; i++) {
+      if (node->valid && i <= node->maxlevel) {
+        nvalid[i]++;
+      } else if (node->forward[i] != -1 || node->backward[i] != -1) {
+        panic("slCheck: stale link on unused level");
+      }
+    }
+  }
+
+  if (sl.nfree < 0 || sl.nfree + nvalid[0] != NPROC)
+    panic("slCheck: free stack count mismatch");
+  for (int n = 0; n < sl.nfree; n++) {
+    if (sl.freeNodes[n] < 1 || sl.freeNodes[n] > NPROC)
+      panic("slCheck: free index out of bounds");
+    if (sl.nodeList[sl.freeNodes[n]].valid)
+      panic("slCheck: valid node on free stack");
+  }
+
+  //* 2 - WALK EACH LEVEL: ORDER, BACK-LINKS, REACHABILITY
+  // ----------------------------------------------------
+
+  for (int i = 0; i <= sl.level; i++) {
+    int prevIdx = 0;
+    int idx = head->forward[i];
+    int count = 0;
+
+    while (idx != -1) {
+      if (idx < 1 || idx > NPROC)
+        panic("slCheck: forward index out of bounds");
+
+      struct SkipNode* node = &sl.nodeList[idx];
+
+      if (!node->valid)
+        panic("slCheck: invalid node reachable");
+      if (node->maxlevel < i)
+        panic("slCheck: node linked above its maxlevel");
+      if (node->backward[i] != prevIdx)
+        panic("slCheck: backward link mismatch");
+      if (prevIdx != 0 && sl.nodeList[prevIdx].value > node->value)
+        panic("slCheck: level out of order");
+      if (++count > nvalid[i])
+        panic("slCheck: cycle or extra node in level");
+
+      prevIdx = idx;
+      idx = node->forward[i];
+    }
+
+    if (count != nvalid[i])
+      panic("slCheck: valid node missing from level");
+  }
+}
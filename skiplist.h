@@ -0,0 +1,29 @@
+// node structure for the skip list
+struct SkipNode {
+    int valid;  // 0 = Node is empty (i.e. values can be ignored)
+    int value;
+    int pid;
+    // Instead of keeping an array of pointers, we just store their array indices
+    int forward[MAX_SKIPLIST_LEVEL];
+    int backward[MAX_SKIPLIST_LEVEL];
+    int maxlevel;
+};
+
+// skip list structure
+struct SkipList {
+    struct SkipNode nodeList[NPROC + 1]; // Sentinel + Max # of processes
+    int freeNodes[NPROC]; // Stack of indices of the empty nodes
+    int nfree;
+    int level;  // Current level of the skip list
+    int ready;  // Set by initSkipList
+};
+
+extern struct SkipList sl;
+
+void initSkipList();    // Function to initialize a new sorted skip list
+int slUpLevel(float p);               // Function to up a level by chance for a new element
+int slInsert(int value, int pid, float p);     // Function to insert a value into the sorted skip list
+struct SkipNode* slSearch(int value, int pid);  // Function to search for a value in the sorted skip list
+struct SkipNode* slDelete(int value, int pid);            // Function to delete a node in the skip list
+void printSkipList();                  // Function to print the entire skip list
+void slCheckInvariants();              // Panics if the skip list is structurally inconsistent
@@ -0,0 +1,139 @@
+// Slab allocator (see slab.h).
+//
+// Each slab is one page: a struct slab header followed by
+// as many objects as fit. Free objects are linked through
+// their first word.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+struct slab {
+  struct slabcache *cache;
+  struct slab *next;       // On cache->partial
+  struct slab *prev;
+  void *free;              // Free objects in this slab
+  int inuse;
+};
+
+#define SLABOF(o)  ((struct slab*)PGROUNDDOWN((uint)(o)))
+
+static void
+slabunlink(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->next = s->prev = 0;
+}
+
+static void
+slablink(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Take an object from the slabs, adding a slab if they are full.
+// Caller holds c->lock.
+static void*
+slabget(struct slabcache *c)
+{
+  struct slab *s;
+  char *o;
+  void *obj;
+
+  if(c->partial == 0){
+    if(c->size < sizeof(void*) || sizeof(struct slab) + c->size > PGSIZE)
+      panic("slabget: bad size");
+    if((s = (struct slab*)kalloc()) == 0)
+      return 0;
+    s->cache = c;
+    s->free = 0;
+    s->inuse = 0;
+    for(o = (char*)s + PGSIZE - c->size; o >= (char*)(s + 1); o -= c->size){
+      *(void**)o = s->free;
+      s->free = o;
+    }
+    slablink(c, s);
+  }
+  s = c->partial;
+  obj = s->free;
+  s->free = *(void**)obj;
+  s->inuse++;
+  if(s->free == 0)
+    slabunlink(c, s);
+  return obj;
+}
+
+// Return an object to its slab, freeing the slab if it is
+// now empty and not the only one with room.
+// Caller holds c->lock.
+static void
+slabput(struct slabcache *c, void *obj)
+{
+  struct slab *s = SLABOF(obj);
+
+  if(s->cache != c)
+    panic("slabfree: wrong cache");
+  if(s->free == 0)
+    slablink(c, s);
+  *(void**)obj = s->free;
+  s->free = obj;
+  if(--s->inuse == 0 && (s->next || s->prev)){
+    slabunlink(c, s);
+    kfree((char*)s);
+  }
+}
+
+// Allocate an object from c, or return 0 if out of memory.
+// The object's contents are undefined.
+void*
+slaballoc(struct slabcache *c)
+{
+  void *obj, *o;
+  int n;
+
+  pushcli();
+  n = cpuid();
+  if(c->mag[n].n == 0){
+    // Refill half a magazine.
+    acquire(&c->lock);
+    while(c->mag[n].n < SLABMAG/2 && (o = slabget(c)) != 0)
+      c->mag[n].obj[c->mag[n].n++] = o;
+    release(&c->lock);
+  }
+  obj = 0;
+  if(c->mag[n].n > 0)
+    obj = c->mag[n].obj[--c->mag[n].n];
+  popcli();
+  return obj;
+}
+
+// Free an object allocated from c.
+void
+slabfree(struct slabcache *c, void *obj)
+{
+  int n;
+
+  pushcli();
+  n = cpuid();
+  if(c->mag[n].n == SLABMAG){
+    // Spill half a magazine.
+    acquire(&c->lock);
+    while(c->mag[n].n > SLABMAG/2)
+      slabput(c, c->mag[n].obj[--c->mag[n].n]);
+    release(&c->lock);
+  }
+  c->mag[n].obj[c->mag[n].n++] = obj;
+  popcli();
+}
@@ -0,0 +1,23 @@
+// Object caches for kernel structures smaller than a page.
+// A cache carves kalloc'd pages (slabs) into objects of one size
+// and keeps a small magazine of free objects per CPU, so that most
+// allocations and frees touch no lock at all. Empty slabs go back
+// to kalloc, so tables built on this grow and shrink with demand.
+//
+// Declare a cache with SLABCACHE; it needs no other initialization.
+
+#define SLABMAG 16  // Free objects each CPU may keep per cache
+
+struct slabcache {
+  char *name;
+  uint size;               // Object size, rounded up to a multiple of 4
+  struct spinlock lock;    // Protects partial and the slabs themselves
+  struct slab *partial;    // Slabs with free objects
+  struct {
+    void *obj[SLABMAG];
+    int n;
+  } mag[NCPU];             // Only touched by their own CPU, with cli
+};
+
+#define SLABCACHE(nm, sz) { .name = (nm), .size = ((sz) + 3) & ~3, \
+                            .lock = { .name = (nm) } }
@@ -0,0 +1,149 @@
+// Host-side fuzz test for the scheduler's skip list.
+// Builds skiplist.c against a few stand-ins for kernel functions,
+// drives it with random inserts, deletes, searches and head pops
+// (the way scheduler() uses it), and after every step checks
+// slCheckInvariants() plus agreement with a simple shadow model.
+//
+// Usage: sltest [iterations] [seed]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "types.h"
+#include "param.h"
+#include "skiplist.h"
+
+extern unsigned int seed;  // skiplist.c's level generator
+
+static int iter;
+static int *valueOf;       // Shadow model: valueOf[pid] = deadline, or -1
+static int *live;          // Pids currently in the list
+static int nlive;
+
+void
+cprintf(char *fmt, ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+}
+
+void
+dbgprintf(int cond, char *fmt, ...)
+{
+  // The kernel's BFS_PRINT trace is far too chatty for a fuzzer.
+}
+
+void
+panic(char *s)
+{
+  printf("sltest: %s at iteration %d\n", s, iter);
+  printSkipList();
+  exit(1);
+}
+
+static void
+fail(char *s)
+{
+  panic(s);
+}
+
+// Level 0 must hold exactly the live pids, each with its deadline.
+static void
+checkmodel(void)
+{
+  int idx, count = 0;
+  struct SkipNode *n;
+
+  for(idx = sl.nodeList[0].forward[0]; idx != -1; idx = n->forward[0]){
+    n = &sl.nodeList[idx];
+    if(n->pid < 0 || valueOf[n->pid] != n->value)
+      fail("list holds a node the model does not");
+    count++;
+  }
+  if(count != nlive)
+    fail("list and model sizes differ");
+}
+
+static void
+forget(int i)
+{
+  valueOf[live[i]] = -1;
+  live[i] = live[--nlive];
+}
+
+int
+main(int argc, char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+  unsigned int s = argc > 2 ? atoi(argv[2]) : 1;
+  int nextpid = 1, vrange, op, i, pid, value;
+  struct SkipNode *n;
+
+  srand(s);
+  seed = s * 2654435761u + 1;
+  valueOf = malloc(sizeof(int) * (iterations + 2));
+  live = malloc(sizeof(int) * (NPROC + 1));
+  for(i = 0; i < iterations + 2; i++)
+    valueOf[i] = -1;
+
+  initSkipList();
+  for(iter = 0; iter < iterations; iter++){
+    // Alternate between few distinct deadlines (many ties)
+    // and a wide spread.
+    vrange = (iter / 1000) % 2 ? 1000000 : 16;
+    op = rand() % 10;
+
+    if(op < 5){
+      value = rand() % vrange;
+      pid = nextpid++;
+      if(slInsert(value, pid, CHANCE) == 0){
+        if(nlive == NPROC)
+          fail("insert into a full list succeeded");
+        valueOf[pid] = value;
+        live[nlive++] = pid;
+      } else if(nlive != NPROC){
+        fail("insert failed with free nodes left");
+      }
+    } else if(op < 7 && nlive > 0){
+      i = rand() % nlive;
+      n = slDelete(valueOf[live[i]], live[i]);
+      if(n == 0 || n->pid != live[i] || n->valid)
+        fail("delete of a live pid failed");
+      forget(i);
+    } else if(op < 9 && nlive > 0){
+      // What scheduler() does: take the earliest deadline.
+      n = &sl.nodeList[sl.nodeList[0].forward[0]];
+      for(i = 0; i < nlive; i++)
+        if(valueOf[live[i]] < n->value)
+          fail("head is not the minimum");
+      for(i = 0; live[i] != n->pid; i++)
+        if(i == nlive - 1)
+          fail("head pid is not live");
+      if(slDelete(n->value, n->pid) != n)
+        fail("delete of the head failed");
+      forget(i);
+    } else {
+      if(nlive > 0){
+        i = rand() % nlive;
+        n = slSearch(valueOf[live[i]], live[i]);
+        if(n == 0 || n->pid != live[i])
+          fail("search missed a live pid");
+      }
+      if(slSearch(rand() % vrange, nextpid) != 0)
+        fail("search found a pid never inserted");
+      if(slDelete(rand() % vrange, nextpid) != 0)
+        fail("delete removed a pid never inserted");
+    }
+
+    slCheckInvariants();
+    checkmodel();
+  }
+
+  printf("sltest: %d iterations OK (seed %u, level %d, %d live)\n",
+         iterations, s, sl.level, nlive);
+  return 0;
+}
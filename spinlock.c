@@ -15,6 +15,7 @@ initlock(struct spinlock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->cpu = 0;
+  lk->profile = 0;
 }
 
 // Acquire the lock.
@@ -40,6 +41,10 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+  if(lk->profile){
+    lk->nacquire++;
+    lk->tacquire = rdtsc();
+  }
 }
 
 // Release the lock.
@@ -49,6 +54,8 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
+  if(lk->profile)
+    lk->holdcycles += rdtsc() - lk->tacquire;
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -7,5 +7,11 @@ struct spinlock {
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For profiling (see schedstat), only if profile is set:
+  int profile;       // Count acquisitions and hold time?
+  uint nacquire;     // Times the lock has been acquired
+  uint64 holdcycles; // TSC cycles it has been held in total
+  uint64 tacquire;   // TSC when it was last acquired
 };
 
@@ -54,6 +54,7 @@ trap(struct trapframe *tf)
       wakeup(&ticks);
       release(&tickslock);
     }
+    schedtick();
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -78,6 +79,14 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Copy-on-write and demand-zero pages, touched from user
+    // space or by the kernel on the process's behalf (CR0_WP
+    // is set, so kernel writes to read-only pages fault too).
+    if(myproc() && pgfault(myproc(), rcr2(), tf->err) == 0)
+      break;
+    // Otherwise a real fault: fall through.
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -0,0 +1,7132 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 08 3c 00 00       	push   $0x3c08
+       b:	ff 35 80 53 00 00    	push   0x5380
+      11:	e8 87 38 00 00       	call   389d <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 9b 3b 00 00 	movl   $0x3b9b,(%esp)
+      1d:	e8 66 37 00 00       	call   3788 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 9b 3b 00 00       	push   $0x3b9b
+      31:	e8 5a 37 00 00       	call   3790 <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 98 3b 00 00       	push   $0x3b98
+      45:	e8 26 37 00 00       	call   3770 <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 bd 3b 00 00       	push   $0x3bbd
+      59:	e8 32 37 00 00       	call   3790 <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 40 3c 00 00       	push   $0x3c40
+      6d:	ff 35 80 53 00 00    	push   0x5380
+      73:	e8 25 38 00 00       	call   389d <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 74 3b 00 00       	push   $0x3b74
+      85:	ff 35 80 53 00 00    	push   0x5380
+      8b:	e8 0d 38 00 00       	call   389d <printf>
+    exit();
+      90:	e8 8b 36 00 00       	call   3720 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 82 3b 00 00       	push   $0x3b82
+      9d:	ff 35 80 53 00 00    	push   0x5380
+      a3:	e8 f5 37 00 00       	call   389d <printf>
+    exit();
+      a8:	e8 73 36 00 00       	call   3720 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 a3 3b 00 00       	push   $0x3ba3
+      b5:	ff 35 80 53 00 00    	push   0x5380
+      bb:	e8 dd 37 00 00       	call   389d <printf>
+    exit();
+      c0:	e8 5b 36 00 00       	call   3720 <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 bf 3b 00 00       	push   $0x3bbf
+      cd:	ff 35 80 53 00 00    	push   0x5380
+      d3:	e8 c5 37 00 00       	call   389d <printf>
+    exit();
+      d8:	e8 43 36 00 00       	call   3720 <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 cf 3b 00 00       	push   $0x3bcf
+      e8:	ff 35 80 53 00 00    	push   0x5380
+      ee:	e8 aa 37 00 00       	call   389d <printf>
+
+  pid = fork();
+      f3:	e8 20 36 00 00       	call   3718 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 9b 3b 00 00       	push   $0x3b9b
+     10d:	e8 76 36 00 00       	call   3788 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 9b 3b 00 00       	push   $0x3b9b
+     121:	e8 6a 36 00 00       	call   3790 <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 98 3b 00 00       	push   $0x3b98
+     135:	e8 36 36 00 00       	call   3770 <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 da 35 00 00       	call   3720 <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 b5 4a 00 00       	push   $0x4ab5
+     14e:	ff 35 80 53 00 00    	push   0x5380
+     154:	e8 44 37 00 00       	call   389d <printf>
+    exit();
+     159:	e8 c2 35 00 00       	call   3720 <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 74 3b 00 00       	push   $0x3b74
+     166:	ff 35 80 53 00 00    	push   0x5380
+     16c:	e8 2c 37 00 00       	call   389d <printf>
+      exit();
+     171:	e8 aa 35 00 00       	call   3720 <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 de 3b 00 00       	push   $0x3bde
+     17e:	ff 35 80 53 00 00    	push   0x5380
+     184:	e8 14 37 00 00       	call   389d <printf>
+      exit();
+     189:	e8 92 35 00 00       	call   3720 <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 a3 3b 00 00       	push   $0x3ba3
+     196:	ff 35 80 53 00 00    	push   0x5380
+     19c:	e8 fc 36 00 00       	call   389d <printf>
+      exit();
+     1a1:	e8 7a 35 00 00       	call   3720 <exit>
+  }
+  wait();
+     1a6:	e8 7d 35 00 00       	call   3728 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 f2 3b 00 00       	push   $0x3bf2
+     1b3:	ff 35 80 53 00 00    	push   0x5380
+     1b9:	e8 df 36 00 00       	call   389d <printf>
+}
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	c9                   	leave
+     1c2:	c3                   	ret
+
+000001c3 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c3:	55                   	push   %ebp
+     1c4:	89 e5                	mov    %esp,%ebp
+     1c6:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1c9:	68 04 3c 00 00       	push   $0x3c04
+     1ce:	ff 35 80 53 00 00    	push   0x5380
+     1d4:	e8 c4 36 00 00       	call   389d <printf>
+  if(mkdir("oidir") < 0){
+     1d9:	c7 04 24 13 3c 00 00 	movl   $0x3c13,(%esp)
+     1e0:	e8 a3 35 00 00       	call   3788 <mkdir>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	85 c0                	test   %eax,%eax
+     1ea:	78 39                	js     225 <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1ec:	e8 27 35 00 00       	call   3718 <fork>
+  if(pid < 0){
+     1f1:	85 c0                	test   %eax,%eax
+     1f3:	78 48                	js     23d <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1f5:	75 63                	jne    25a <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1f7:	83 ec 08             	sub    $0x8,%esp
+     1fa:	6a 02                	push   $0x2
+     1fc:	68 13 3c 00 00       	push   $0x3c13
+     201:	e8 5a 35 00 00       	call   3760 <open>
+    if(fd >= 0){
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	78 48                	js     255 <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     20d:	83 ec 08             	sub    $0x8,%esp
+     210:	68 98 4b 00 00       	push   $0x4b98
+     215:	ff 35 80 53 00 00    	push   0x5380
+     21b:	e8 7d 36 00 00       	call   389d <printf>
+      exit();
+     220:	e8 fb 34 00 00       	call   3720 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 19 3c 00 00       	push   $0x3c19
+     22d:	ff 35 80 53 00 00    	push   0x5380
+     233:	e8 65 36 00 00       	call   389d <printf>
+    exit();
+     238:	e8 e3 34 00 00       	call   3720 <exit>
+    printf(stdout, "fork failed\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 b5 4a 00 00       	push   $0x4ab5
+     245:	ff 35 80 53 00 00    	push   0x5380
+     24b:	e8 4d 36 00 00       	call   389d <printf>
+    exit();
+     250:	e8 cb 34 00 00       	call   3720 <exit>
+    }
+    exit();
+     255:	e8 c6 34 00 00       	call   3720 <exit>
+  }
+  sleep(1);
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	6a 01                	push   $0x1
+     25f:	e8 4c 35 00 00       	call   37b0 <sleep>
+  if(unlink("oidir") != 0){
+     264:	c7 04 24 13 3c 00 00 	movl   $0x3c13,(%esp)
+     26b:	e8 00 35 00 00       	call   3770 <unlink>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	75 1d                	jne    294 <openiputtest+0xd1>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait();
+     277:	e8 ac 34 00 00       	call   3728 <wait>
+  printf(stdout, "openiput test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 3c 3c 00 00       	push   $0x3c3c
+     284:	ff 35 80 53 00 00    	push   0x5380
+     28a:	e8 0e 36 00 00       	call   389d <printf>
+}
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 2d 3c 00 00       	push   $0x3c2d
+     29c:	ff 35 80 53 00 00    	push   0x5380
+     2a2:	e8 f6 35 00 00       	call   389d <printf>
+    exit();
+     2a7:	e8 74 34 00 00       	call   3720 <exit>
+
+000002ac <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ac:	55                   	push   %ebp
+     2ad:	89 e5                	mov    %esp,%ebp
+     2af:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2b2:	68 4e 3c 00 00       	push   $0x3c4e
+     2b7:	ff 35 80 53 00 00    	push   0x5380
+     2bd:	e8 db 35 00 00       	call   389d <printf>
+  fd = open("echo", 0);
+     2c2:	83 c4 08             	add    $0x8,%esp
+     2c5:	6a 00                	push   $0x0
+     2c7:	68 59 3c 00 00       	push   $0x3c59
+     2cc:	e8 8f 34 00 00       	call   3760 <open>
+  if(fd < 0){
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	78 37                	js     30f <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2d8:	83 ec 0c             	sub    $0xc,%esp
+     2db:	50                   	push   %eax
+     2dc:	e8 67 34 00 00       	call   3748 <close>
+  fd = open("doesnotexist", 0);
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	6a 00                	push   $0x0
+     2e6:	68 71 3c 00 00       	push   $0x3c71
+     2eb:	e8 70 34 00 00       	call   3760 <open>
+  if(fd >= 0){
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	79 30                	jns    327 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     2f7:	83 ec 08             	sub    $0x8,%esp
+     2fa:	68 9c 3c 00 00       	push   $0x3c9c
+     2ff:	ff 35 80 53 00 00    	push   0x5380
+     305:	e8 93 35 00 00       	call   389d <printf>
+}
+     30a:	83 c4 10             	add    $0x10,%esp
+     30d:	c9                   	leave
+     30e:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     30f:	83 ec 08             	sub    $0x8,%esp
+     312:	68 5e 3c 00 00       	push   $0x3c5e
+     317:	ff 35 80 53 00 00    	push   0x5380
+     31d:	e8 7b 35 00 00       	call   389d <printf>
+    exit();
+     322:	e8 f9 33 00 00       	call   3720 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     327:	83 ec 08             	sub    $0x8,%esp
+     32a:	68 7e 3c 00 00       	push   $0x3c7e
+     32f:	ff 35 80 53 00 00    	push   0x5380
+     335:	e8 63 35 00 00       	call   389d <printf>
+    exit();
+     33a:	e8 e1 33 00 00       	call   3720 <exit>
+
+0000033f <writetest>:
+
+void
+writetest(void)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 aa 3c 00 00       	push   $0x3caa
+     34c:	ff 35 80 53 00 00    	push   0x5380
+     352:	e8 46 35 00 00       	call   389d <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     357:	83 c4 08             	add    $0x8,%esp
+     35a:	68 02 02 00 00       	push   $0x202
+     35f:	68 bb 3c 00 00       	push   $0x3cbb
+     364:	e8 f7 33 00 00       	call   3760 <open>
+  if(fd >= 0){
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	85 c0                	test   %eax,%eax
+     36e:	78 57                	js     3c7 <writetest+0x88>
+     370:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     372:	83 ec 08             	sub    $0x8,%esp
+     375:	68 c1 3c 00 00       	push   $0x3cc1
+     37a:	ff 35 80 53 00 00    	push   0x5380
+     380:	e8 18 35 00 00       	call   389d <printf>
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     385:	83 c4 10             	add    $0x10,%esp
+     388:	bb 00 00 00 00       	mov    $0x0,%ebx
+     38d:	83 fb 63             	cmp    $0x63,%ebx
+     390:	7f 7f                	jg     411 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     392:	83 ec 04             	sub    $0x4,%esp
+     395:	6a 0a                	push   $0xa
+     397:	68 f8 3c 00 00       	push   $0x3cf8
+     39c:	56                   	push   %esi
+     39d:	e8 9e 33 00 00       	call   3740 <write>
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	83 f8 0a             	cmp    $0xa,%eax
+     3a8:	75 35                	jne    3df <writetest+0xa0>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3aa:	83 ec 04             	sub    $0x4,%esp
+     3ad:	6a 0a                	push   $0xa
+     3af:	68 03 3d 00 00       	push   $0x3d03
+     3b4:	56                   	push   %esi
+     3b5:	e8 86 33 00 00       	call   3740 <write>
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	83 f8 0a             	cmp    $0xa,%eax
+     3c0:	75 36                	jne    3f8 <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     3c2:	83 c3 01             	add    $0x1,%ebx
+     3c5:	eb c6                	jmp    38d <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     3c7:	83 ec 08             	sub    $0x8,%esp
+     3ca:	68 dc 3c 00 00       	push   $0x3cdc
+     3cf:	ff 35 80 53 00 00    	push   0x5380
+     3d5:	e8 c3 34 00 00       	call   389d <printf>
+    exit();
+     3da:	e8 41 33 00 00       	call   3720 <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     3df:	83 ec 04             	sub    $0x4,%esp
+     3e2:	53                   	push   %ebx
+     3e3:	68 bc 4b 00 00       	push   $0x4bbc
+     3e8:	ff 35 80 53 00 00    	push   0x5380
+     3ee:	e8 aa 34 00 00       	call   389d <printf>
+      exit();
+     3f3:	e8 28 33 00 00       	call   3720 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+     3fb:	53                   	push   %ebx
+     3fc:	68 e0 4b 00 00       	push   $0x4be0
+     401:	ff 35 80 53 00 00    	push   0x5380
+     407:	e8 91 34 00 00       	call   389d <printf>
+      exit();
+     40c:	e8 0f 33 00 00       	call   3720 <exit>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	68 0e 3d 00 00       	push   $0x3d0e
+     419:	ff 35 80 53 00 00    	push   0x5380
+     41f:	e8 79 34 00 00       	call   389d <printf>
+  close(fd);
+     424:	89 34 24             	mov    %esi,(%esp)
+     427:	e8 1c 33 00 00       	call   3748 <close>
+  fd = open("small", O_RDONLY);
+     42c:	83 c4 08             	add    $0x8,%esp
+     42f:	6a 00                	push   $0x0
+     431:	68 bb 3c 00 00       	push   $0x3cbb
+     436:	e8 25 33 00 00       	call   3760 <open>
+     43b:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     43d:	83 c4 10             	add    $0x10,%esp
+     440:	85 c0                	test   %eax,%eax
+     442:	78 7b                	js     4bf <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     444:	83 ec 08             	sub    $0x8,%esp
+     447:	68 19 3d 00 00       	push   $0x3d19
+     44c:	ff 35 80 53 00 00    	push   0x5380
+     452:	e8 46 34 00 00       	call   389d <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     457:	83 c4 0c             	add    $0xc,%esp
+     45a:	68 d0 07 00 00       	push   $0x7d0
+     45f:	68 c0 7a 00 00       	push   $0x7ac0
+     464:	53                   	push   %ebx
+     465:	e8 ce 32 00 00       	call   3738 <read>
+  if(i == 2000){
+     46a:	83 c4 10             	add    $0x10,%esp
+     46d:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     472:	75 63                	jne    4d7 <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     474:	83 ec 08             	sub    $0x8,%esp
+     477:	68 4d 3d 00 00       	push   $0x3d4d
+     47c:	ff 35 80 53 00 00    	push   0x5380
+     482:	e8 16 34 00 00       	call   389d <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     487:	89 1c 24             	mov    %ebx,(%esp)
+     48a:	e8 b9 32 00 00       	call   3748 <close>
+
+  if(unlink("small") < 0){
+     48f:	c7 04 24 bb 3c 00 00 	movl   $0x3cbb,(%esp)
+     496:	e8 d5 32 00 00       	call   3770 <unlink>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	78 4d                	js     4ef <writetest+0x1b0>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     4a2:	83 ec 08             	sub    $0x8,%esp
+     4a5:	68 75 3d 00 00       	push   $0x3d75
+     4aa:	ff 35 80 53 00 00    	push   0x5380
+     4b0:	e8 e8 33 00 00       	call   389d <printf>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4bb:	5b                   	pop    %ebx
+     4bc:	5e                   	pop    %esi
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     4bf:	83 ec 08             	sub    $0x8,%esp
+     4c2:	68 32 3d 00 00       	push   $0x3d32
+     4c7:	ff 35 80 53 00 00    	push   0x5380
+     4cd:	e8 cb 33 00 00       	call   389d <printf>
+    exit();
+     4d2:	e8 49 32 00 00       	call   3720 <exit>
+    printf(stdout, "read failed\n");
+     4d7:	83 ec 08             	sub    $0x8,%esp
+     4da:	68 79 40 00 00       	push   $0x4079
+     4df:	ff 35 80 53 00 00    	push   0x5380
+     4e5:	e8 b3 33 00 00       	call   389d <printf>
+    exit();
+     4ea:	e8 31 32 00 00       	call   3720 <exit>
+    printf(stdout, "unlink small failed\n");
+     4ef:	83 ec 08             	sub    $0x8,%esp
+     4f2:	68 60 3d 00 00       	push   $0x3d60
+     4f7:	ff 35 80 53 00 00    	push   0x5380
+     4fd:	e8 9b 33 00 00       	call   389d <printf>
+    exit();
+     502:	e8 19 32 00 00       	call   3720 <exit>
+
+00000507 <writetest1>:
+
+void
+writetest1(void)
+{
+     507:	55                   	push   %ebp
+     508:	89 e5                	mov    %esp,%ebp
+     50a:	56                   	push   %esi
+     50b:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     50c:	83 ec 08             	sub    $0x8,%esp
+     50f:	68 89 3d 00 00       	push   $0x3d89
+     514:	ff 35 80 53 00 00    	push   0x5380
+     51a:	e8 7e 33 00 00       	call   389d <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     51f:	83 c4 08             	add    $0x8,%esp
+     522:	68 02 02 00 00       	push   $0x202
+     527:	68 03 3e 00 00       	push   $0x3e03
+     52c:	e8 2f 32 00 00       	call   3760 <open>
+  if(fd < 0){
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	78 37                	js     56f <writetest1+0x68>
+     538:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     53a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     53f:	81 fb 8a 40 00 00    	cmp    $0x408a,%ebx
+     545:	77 59                	ja     5a0 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     547:	89 1d c0 7a 00 00    	mov    %ebx,0x7ac0
+    if(write(fd, buf, 512) != 512){
+     54d:	83 ec 04             	sub    $0x4,%esp
+     550:	68 00 02 00 00       	push   $0x200
+     555:	68 c0 7a 00 00       	push   $0x7ac0
+     55a:	56                   	push   %esi
+     55b:	e8 e0 31 00 00       	call   3740 <write>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	3d 00 02 00 00       	cmp    $0x200,%eax
+     568:	75 1d                	jne    587 <writetest1+0x80>
+  for(i = 0; i < MAXFILE; i++){
+     56a:	83 c3 01             	add    $0x1,%ebx
+     56d:	eb d0                	jmp    53f <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     56f:	83 ec 08             	sub    $0x8,%esp
+     572:	68 99 3d 00 00       	push   $0x3d99
+     577:	ff 35 80 53 00 00    	push   0x5380
+     57d:	e8 1b 33 00 00       	call   389d <printf>
+    exit();
+     582:	e8 99 31 00 00       	call   3720 <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     587:	83 ec 04             	sub    $0x4,%esp
+     58a:	53                   	push   %ebx
+     58b:	68 b3 3d 00 00       	push   $0x3db3
+     590:	ff 35 80 53 00 00    	push   0x5380
+     596:	e8 02 33 00 00       	call   389d <printf>
+      exit();
+     59b:	e8 80 31 00 00       	call   3720 <exit>
+    }
+  }
+
+  close(fd);
+     5a0:	83 ec 0c             	sub    $0xc,%esp
+     5a3:	56                   	push   %esi
+     5a4:	e8 9f 31 00 00       	call   3748 <close>
+
+  fd = open("big", O_RDONLY);
+     5a9:	83 c4 08             	add    $0x8,%esp
+     5ac:	6a 00                	push   $0x0
+     5ae:	68 03 3e 00 00       	push   $0x3e03
+     5b3:	e8 a8 31 00 00       	call   3760 <open>
+     5b8:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	78 3c                	js     5fd <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5c6:	83 ec 04             	sub    $0x4,%esp
+     5c9:	68 00 02 00 00       	push   $0x200
+     5ce:	68 c0 7a 00 00       	push   $0x7ac0
+     5d3:	56                   	push   %esi
+     5d4:	e8 5f 31 00 00       	call   3738 <read>
+    if(i == 0){
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	74 35                	je     615 <writetest1+0x10e>
+      if(n == MAXFILE - 1){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5e5:	0f 85 84 00 00 00    	jne    66f <writetest1+0x168>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5eb:	a1 c0 7a 00 00       	mov    0x7ac0,%eax
+     5f0:	39 d8                	cmp    %ebx,%eax
+     5f2:	0f 85 90 00 00 00    	jne    688 <writetest1+0x181>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5f8:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5fb:	eb c9                	jmp    5c6 <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 d1 3d 00 00       	push   $0x3dd1
+     605:	ff 35 80 53 00 00    	push   0x5380
+     60b:	e8 8d 32 00 00       	call   389d <printf>
+    exit();
+     610:	e8 0b 31 00 00       	call   3720 <exit>
+      if(n == MAXFILE - 1){
+     615:	81 fb 8a 40 00 00    	cmp    $0x408a,%ebx
+     61b:	74 39                	je     656 <writetest1+0x14f>
+  }
+  close(fd);
+     61d:	83 ec 0c             	sub    $0xc,%esp
+     620:	56                   	push   %esi
+     621:	e8 22 31 00 00       	call   3748 <close>
+  if(unlink("big") < 0){
+     626:	c7 04 24 03 3e 00 00 	movl   $0x3e03,(%esp)
+     62d:	e8 3e 31 00 00       	call   3770 <unlink>
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 66                	js     69f <writetest1+0x198>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	68 2a 3e 00 00       	push   $0x3e2a
+     641:	ff 35 80 53 00 00    	push   0x5380
+     647:	e8 51 32 00 00       	call   389d <printf>
+}
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     652:	5b                   	pop    %ebx
+     653:	5e                   	pop    %esi
+     654:	5d                   	pop    %ebp
+     655:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     656:	83 ec 04             	sub    $0x4,%esp
+     659:	53                   	push   %ebx
+     65a:	68 ea 3d 00 00       	push   $0x3dea
+     65f:	ff 35 80 53 00 00    	push   0x5380
+     665:	e8 33 32 00 00       	call   389d <printf>
+        exit();
+     66a:	e8 b1 30 00 00       	call   3720 <exit>
+      printf(stdout, "read failed %d\n", i);
+     66f:	83 ec 04             	sub    $0x4,%esp
+     672:	50                   	push   %eax
+     673:	68 07 3e 00 00       	push   $0x3e07
+     678:	ff 35 80 53 00 00    	push   0x5380
+     67e:	e8 1a 32 00 00       	call   389d <printf>
+      exit();
+     683:	e8 98 30 00 00       	call   3720 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     688:	50                   	push   %eax
+     689:	53                   	push   %ebx
+     68a:	68 04 4c 00 00       	push   $0x4c04
+     68f:	ff 35 80 53 00 00    	push   0x5380
+     695:	e8 03 32 00 00       	call   389d <printf>
+      exit();
+     69a:	e8 81 30 00 00       	call   3720 <exit>
+    printf(stdout, "unlink big failed\n");
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 17 3e 00 00       	push   $0x3e17
+     6a7:	ff 35 80 53 00 00    	push   0x5380
+     6ad:	e8 eb 31 00 00       	call   389d <printf>
+    exit();
+     6b2:	e8 69 30 00 00       	call   3720 <exit>
+
+000006b7 <createtest>:
+
+void
+createtest(void)
+{
+     6b7:	55                   	push   %ebp
+     6b8:	89 e5                	mov    %esp,%ebp
+     6ba:	53                   	push   %ebx
+     6bb:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     6be:	68 24 4c 00 00       	push   $0x4c24
+     6c3:	ff 35 80 53 00 00    	push   0x5380
+     6c9:	e8 cf 31 00 00       	call   389d <printf>
+
+  name[0] = 'a';
+     6ce:	c6 05 b0 7a 00 00 61 	movb   $0x61,0x7ab0
+  name[2] = '\0';
+     6d5:	c6 05 b2 7a 00 00 00 	movb   $0x0,0x7ab2
+  for(i = 0; i < 52; i++){
+     6dc:	83 c4 10             	add    $0x10,%esp
+     6df:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6e4:	eb 28                	jmp    70e <createtest+0x57>
+    name[1] = '0' + i;
+     6e6:	8d 43 30             	lea    0x30(%ebx),%eax
+     6e9:	a2 b1 7a 00 00       	mov    %al,0x7ab1
+    fd = open(name, O_CREATE|O_RDWR);
+     6ee:	83 ec 08             	sub    $0x8,%esp
+     6f1:	68 02 02 00 00       	push   $0x202
+     6f6:	68 b0 7a 00 00       	push   $0x7ab0
+     6fb:	e8 60 30 00 00       	call   3760 <open>
+    close(fd);
+     700:	89 04 24             	mov    %eax,(%esp)
+     703:	e8 40 30 00 00       	call   3748 <close>
+  for(i = 0; i < 52; i++){
+     708:	83 c3 01             	add    $0x1,%ebx
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	83 fb 33             	cmp    $0x33,%ebx
+     711:	7e d3                	jle    6e6 <createtest+0x2f>
+  }
+  name[0] = 'a';
+     713:	c6 05 b0 7a 00 00 61 	movb   $0x61,0x7ab0
+  name[2] = '\0';
+     71a:	c6 05 b2 7a 00 00 00 	movb   $0x0,0x7ab2
+  for(i = 0; i < 52; i++){
+     721:	bb 00 00 00 00       	mov    $0x0,%ebx
+     726:	eb 1b                	jmp    743 <createtest+0x8c>
+    name[1] = '0' + i;
+     728:	8d 43 30             	lea    0x30(%ebx),%eax
+     72b:	a2 b1 7a 00 00       	mov    %al,0x7ab1
+    unlink(name);
+     730:	83 ec 0c             	sub    $0xc,%esp
+     733:	68 b0 7a 00 00       	push   $0x7ab0
+     738:	e8 33 30 00 00       	call   3770 <unlink>
+  for(i = 0; i < 52; i++){
+     73d:	83 c3 01             	add    $0x1,%ebx
+     740:	83 c4 10             	add    $0x10,%esp
+     743:	83 fb 33             	cmp    $0x33,%ebx
+     746:	7e e0                	jle    728 <createtest+0x71>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     748:	83 ec 08             	sub    $0x8,%esp
+     74b:	68 4c 4c 00 00       	push   $0x4c4c
+     750:	ff 35 80 53 00 00    	push   0x5380
+     756:	e8 42 31 00 00       	call   389d <printf>
+}
+     75b:	83 c4 10             	add    $0x10,%esp
+     75e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     761:	c9                   	leave
+     762:	c3                   	ret
+
+00000763 <dirtest>:
+
+void dirtest(void)
+{
+     763:	55                   	push   %ebp
+     764:	89 e5                	mov    %esp,%ebp
+     766:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     769:	68 38 3e 00 00       	push   $0x3e38
+     76e:	ff 35 80 53 00 00    	push   0x5380
+     774:	e8 24 31 00 00       	call   389d <printf>
+
+  if(mkdir("dir0") < 0){
+     779:	c7 04 24 44 3e 00 00 	movl   $0x3e44,(%esp)
+     780:	e8 03 30 00 00       	call   3788 <mkdir>
+     785:	83 c4 10             	add    $0x10,%esp
+     788:	85 c0                	test   %eax,%eax
+     78a:	78 54                	js     7e0 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     78c:	83 ec 0c             	sub    $0xc,%esp
+     78f:	68 44 3e 00 00       	push   $0x3e44
+     794:	e8 f7 2f 00 00       	call   3790 <chdir>
+     799:	83 c4 10             	add    $0x10,%esp
+     79c:	85 c0                	test   %eax,%eax
+     79e:	78 58                	js     7f8 <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     7a0:	83 ec 0c             	sub    $0xc,%esp
+     7a3:	68 e9 43 00 00       	push   $0x43e9
+     7a8:	e8 e3 2f 00 00       	call   3790 <chdir>
+     7ad:	83 c4 10             	add    $0x10,%esp
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	78 5c                	js     810 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     7b4:	83 ec 0c             	sub    $0xc,%esp
+     7b7:	68 44 3e 00 00       	push   $0x3e44
+     7bc:	e8 af 2f 00 00       	call   3770 <unlink>
+     7c1:	83 c4 10             	add    $0x10,%esp
+     7c4:	85 c0                	test   %eax,%eax
+     7c6:	78 60                	js     828 <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	68 81 3e 00 00       	push   $0x3e81
+     7d0:	ff 35 80 53 00 00    	push   0x5380
+     7d6:	e8 c2 30 00 00       	call   389d <printf>
+}
+     7db:	83 c4 10             	add    $0x10,%esp
+     7de:	c9                   	leave
+     7df:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     7e0:	83 ec 08             	sub    $0x8,%esp
+     7e3:	68 74 3b 00 00       	push   $0x3b74
+     7e8:	ff 35 80 53 00 00    	push   0x5380
+     7ee:	e8 aa 30 00 00       	call   389d <printf>
+    exit();
+     7f3:	e8 28 2f 00 00       	call   3720 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 49 3e 00 00       	push   $0x3e49
+     800:	ff 35 80 53 00 00    	push   0x5380
+     806:	e8 92 30 00 00       	call   389d <printf>
+    exit();
+     80b:	e8 10 2f 00 00       	call   3720 <exit>
+    printf(stdout, "chdir .. failed\n");
+     810:	83 ec 08             	sub    $0x8,%esp
+     813:	68 5c 3e 00 00       	push   $0x3e5c
+     818:	ff 35 80 53 00 00    	push   0x5380
+     81e:	e8 7a 30 00 00       	call   389d <printf>
+    exit();
+     823:	e8 f8 2e 00 00       	call   3720 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	68 6d 3e 00 00       	push   $0x3e6d
+     830:	ff 35 80 53 00 00    	push   0x5380
+     836:	e8 62 30 00 00       	call   389d <printf>
+    exit();
+     83b:	e8 e0 2e 00 00       	call   3720 <exit>
+
+00000840 <exectest>:
+
+void
+exectest(void)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     846:	68 90 3e 00 00       	push   $0x3e90
+     84b:	ff 35 80 53 00 00    	push   0x5380
+     851:	e8 47 30 00 00       	call   389d <printf>
+  if(exec("echo", echoargv) < 0){
+     856:	83 c4 08             	add    $0x8,%esp
+     859:	68 84 53 00 00       	push   $0x5384
+     85e:	68 59 3c 00 00       	push   $0x3c59
+     863:	e8 f0 2e 00 00       	call   3758 <exec>
+     868:	83 c4 10             	add    $0x10,%esp
+     86b:	85 c0                	test   %eax,%eax
+     86d:	78 02                	js     871 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     86f:	c9                   	leave
+     870:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     871:	83 ec 08             	sub    $0x8,%esp
+     874:	68 9b 3e 00 00       	push   $0x3e9b
+     879:	ff 35 80 53 00 00    	push   0x5380
+     87f:	e8 19 30 00 00       	call   389d <printf>
+    exit();
+     884:	e8 97 2e 00 00       	call   3720 <exit>
+
+00000889 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     889:	55                   	push   %ebp
+     88a:	89 e5                	mov    %esp,%ebp
+     88c:	57                   	push   %edi
+     88d:	56                   	push   %esi
+     88e:	53                   	push   %ebx
+     88f:	83 ec 38             	sub    $0x38,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     892:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     895:	50                   	push   %eax
+     896:	e8 95 2e 00 00       	call   3730 <pipe>
+     89b:	83 c4 10             	add    $0x10,%esp
+     89e:	85 c0                	test   %eax,%eax
+     8a0:	75 74                	jne    916 <pipe1+0x8d>
+     8a2:	89 c6                	mov    %eax,%esi
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     8a4:	e8 6f 2e 00 00       	call   3718 <fork>
+     8a9:	89 c7                	mov    %eax,%edi
+  seq = 0;
+  if(pid == 0){
+     8ab:	85 c0                	test   %eax,%eax
+     8ad:	74 7b                	je     92a <pipe1+0xa1>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     8af:	0f 8e 60 01 00 00    	jle    a15 <pipe1+0x18c>
+    close(fds[1]);
+     8b5:	83 ec 0c             	sub    $0xc,%esp
+     8b8:	ff 75 e4             	push   -0x1c(%ebp)
+     8bb:	e8 88 2e 00 00       	call   3748 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     8c0:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     8c3:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+     8c6:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+     8c8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     8cf:	83 ec 04             	sub    $0x4,%esp
+     8d2:	ff 75 d4             	push   -0x2c(%ebp)
+     8d5:	68 c0 7a 00 00       	push   $0x7ac0
+     8da:	ff 75 e0             	push   -0x20(%ebp)
+     8dd:	e8 56 2e 00 00       	call   3738 <read>
+     8e2:	89 c7                	mov    %eax,%edi
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	85 c0                	test   %eax,%eax
+     8e9:	0f 8e e2 00 00 00    	jle    9d1 <pipe1+0x148>
+      for(i = 0; i < n; i++){
+     8ef:	89 f0                	mov    %esi,%eax
+     8f1:	89 d9                	mov    %ebx,%ecx
+     8f3:	39 f8                	cmp    %edi,%eax
+     8f5:	0f 8d b4 00 00 00    	jge    9af <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     8fb:	0f be 98 c0 7a 00 00 	movsbl 0x7ac0(%eax),%ebx
+     902:	8d 51 01             	lea    0x1(%ecx),%edx
+     905:	31 cb                	xor    %ecx,%ebx
+     907:	84 db                	test   %bl,%bl
+     909:	0f 85 86 00 00 00    	jne    995 <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+     90f:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     912:	89 d1                	mov    %edx,%ecx
+     914:	eb dd                	jmp    8f3 <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+     916:	83 ec 08             	sub    $0x8,%esp
+     919:	68 ad 3e 00 00       	push   $0x3ead
+     91e:	6a 01                	push   $0x1
+     920:	e8 78 2f 00 00       	call   389d <printf>
+    exit();
+     925:	e8 f6 2d 00 00       	call   3720 <exit>
+    close(fds[0]);
+     92a:	83 ec 0c             	sub    $0xc,%esp
+     92d:	ff 75 e0             	push   -0x20(%ebp)
+     930:	e8 13 2e 00 00       	call   3748 <close>
+    for(n = 0; n < 5; n++){
+     935:	83 c4 10             	add    $0x10,%esp
+     938:	89 fe                	mov    %edi,%esi
+  seq = 0;
+     93a:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+     93c:	eb 35                	jmp    973 <pipe1+0xea>
+        buf[i] = seq++;
+     93e:	88 98 c0 7a 00 00    	mov    %bl,0x7ac0(%eax)
+      for(i = 0; i < 1033; i++)
+     944:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     947:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+     94a:	3d 08 04 00 00       	cmp    $0x408,%eax
+     94f:	7e ed                	jle    93e <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+     951:	83 ec 04             	sub    $0x4,%esp
+     954:	68 09 04 00 00       	push   $0x409
+     959:	68 c0 7a 00 00       	push   $0x7ac0
+     95e:	ff 75 e4             	push   -0x1c(%ebp)
+     961:	e8 da 2d 00 00       	call   3740 <write>
+     966:	83 c4 10             	add    $0x10,%esp
+     969:	3d 09 04 00 00       	cmp    $0x409,%eax
+     96e:	75 0c                	jne    97c <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+     970:	83 c6 01             	add    $0x1,%esi
+     973:	83 fe 04             	cmp    $0x4,%esi
+     976:	7f 18                	jg     990 <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+     978:	89 f8                	mov    %edi,%eax
+     97a:	eb ce                	jmp    94a <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+     97c:	83 ec 08             	sub    $0x8,%esp
+     97f:	68 bc 3e 00 00       	push   $0x3ebc
+     984:	6a 01                	push   $0x1
+     986:	e8 12 2f 00 00       	call   389d <printf>
+        exit();
+     98b:	e8 90 2d 00 00       	call   3720 <exit>
+    exit();
+     990:	e8 8b 2d 00 00       	call   3720 <exit>
+          printf(1, "pipe1 oops 2\n");
+     995:	83 ec 08             	sub    $0x8,%esp
+     998:	68 ca 3e 00 00       	push   $0x3eca
+     99d:	6a 01                	push   $0x1
+     99f:	e8 f9 2e 00 00       	call   389d <printf>
+          return;
+     9a4:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     9a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9aa:	5b                   	pop    %ebx
+     9ab:	5e                   	pop    %esi
+     9ac:	5f                   	pop    %edi
+     9ad:	5d                   	pop    %ebp
+     9ae:	c3                   	ret
+      total += n;
+     9af:	89 cb                	mov    %ecx,%ebx
+     9b1:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+     9b4:	d1 65 d4             	shll   -0x2c(%ebp)
+     9b7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+     9ba:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     9bf:	0f 86 0a ff ff ff    	jbe    8cf <pipe1+0x46>
+        cc = sizeof(buf);
+     9c5:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+     9cc:	e9 fe fe ff ff       	jmp    8cf <pipe1+0x46>
+    if(total != 5 * 1033){
+     9d1:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+     9d8:	75 24                	jne    9fe <pipe1+0x175>
+    close(fds[0]);
+     9da:	83 ec 0c             	sub    $0xc,%esp
+     9dd:	ff 75 e0             	push   -0x20(%ebp)
+     9e0:	e8 63 2d 00 00       	call   3748 <close>
+    wait();
+     9e5:	e8 3e 2d 00 00       	call   3728 <wait>
+  printf(1, "pipe1 ok\n");
+     9ea:	83 c4 08             	add    $0x8,%esp
+     9ed:	68 ef 3e 00 00       	push   $0x3eef
+     9f2:	6a 01                	push   $0x1
+     9f4:	e8 a4 2e 00 00       	call   389d <printf>
+     9f9:	83 c4 10             	add    $0x10,%esp
+     9fc:	eb a9                	jmp    9a7 <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     9fe:	83 ec 04             	sub    $0x4,%esp
+     a01:	ff 75 d0             	push   -0x30(%ebp)
+     a04:	68 d8 3e 00 00       	push   $0x3ed8
+     a09:	6a 01                	push   $0x1
+     a0b:	e8 8d 2e 00 00       	call   389d <printf>
+      exit();
+     a10:	e8 0b 2d 00 00       	call   3720 <exit>
+    printf(1, "fork() failed\n");
+     a15:	83 ec 08             	sub    $0x8,%esp
+     a18:	68 f9 3e 00 00       	push   $0x3ef9
+     a1d:	6a 01                	push   $0x1
+     a1f:	e8 79 2e 00 00       	call   389d <printf>
+    exit();
+     a24:	e8 f7 2c 00 00       	call   3720 <exit>
+
+00000a29 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     a29:	55                   	push   %ebp
+     a2a:	89 e5                	mov    %esp,%ebp
+     a2c:	57                   	push   %edi
+     a2d:	56                   	push   %esi
+     a2e:	53                   	push   %ebx
+     a2f:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     a32:	68 08 3f 00 00       	push   $0x3f08
+     a37:	6a 01                	push   $0x1
+     a39:	e8 5f 2e 00 00       	call   389d <printf>
+  pid1 = fork();
+     a3e:	e8 d5 2c 00 00       	call   3718 <fork>
+  if(pid1 == 0)
+     a43:	83 c4 10             	add    $0x10,%esp
+     a46:	85 c0                	test   %eax,%eax
+     a48:	75 02                	jne    a4c <preempt+0x23>
+    for(;;)
+     a4a:	eb fe                	jmp    a4a <preempt+0x21>
+     a4c:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     a4e:	e8 c5 2c 00 00       	call   3718 <fork>
+     a53:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     a55:	85 c0                	test   %eax,%eax
+     a57:	75 02                	jne    a5b <preempt+0x32>
+    for(;;)
+     a59:	eb fe                	jmp    a59 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     a5b:	83 ec 0c             	sub    $0xc,%esp
+     a5e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a61:	50                   	push   %eax
+     a62:	e8 c9 2c 00 00       	call   3730 <pipe>
+  pid3 = fork();
+     a67:	e8 ac 2c 00 00       	call   3718 <fork>
+     a6c:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     a6e:	83 c4 10             	add    $0x10,%esp
+     a71:	85 c0                	test   %eax,%eax
+     a73:	75 49                	jne    abe <preempt+0x95>
+    close(pfds[0]);
+     a75:	83 ec 0c             	sub    $0xc,%esp
+     a78:	ff 75 e0             	push   -0x20(%ebp)
+     a7b:	e8 c8 2c 00 00       	call   3748 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     a80:	83 c4 0c             	add    $0xc,%esp
+     a83:	6a 01                	push   $0x1
+     a85:	68 cd 44 00 00       	push   $0x44cd
+     a8a:	ff 75 e4             	push   -0x1c(%ebp)
+     a8d:	e8 ae 2c 00 00       	call   3740 <write>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	83 f8 01             	cmp    $0x1,%eax
+     a98:	75 10                	jne    aaa <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     a9a:	83 ec 0c             	sub    $0xc,%esp
+     a9d:	ff 75 e4             	push   -0x1c(%ebp)
+     aa0:	e8 a3 2c 00 00       	call   3748 <close>
+     aa5:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     aa8:	eb fe                	jmp    aa8 <preempt+0x7f>
+      printf(1, "preempt write error");
+     aaa:	83 ec 08             	sub    $0x8,%esp
+     aad:	68 12 3f 00 00       	push   $0x3f12
+     ab2:	6a 01                	push   $0x1
+     ab4:	e8 e4 2d 00 00       	call   389d <printf>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	eb dc                	jmp    a9a <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     abe:	83 ec 0c             	sub    $0xc,%esp
+     ac1:	ff 75 e4             	push   -0x1c(%ebp)
+     ac4:	e8 7f 2c 00 00       	call   3748 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ac9:	83 c4 0c             	add    $0xc,%esp
+     acc:	68 00 20 00 00       	push   $0x2000
+     ad1:	68 c0 7a 00 00       	push   $0x7ac0
+     ad6:	ff 75 e0             	push   -0x20(%ebp)
+     ad9:	e8 5a 2c 00 00       	call   3738 <read>
+     ade:	83 c4 10             	add    $0x10,%esp
+     ae1:	83 f8 01             	cmp    $0x1,%eax
+     ae4:	74 1a                	je     b00 <preempt+0xd7>
+    printf(1, "preempt read error");
+     ae6:	83 ec 08             	sub    $0x8,%esp
+     ae9:	68 26 3f 00 00       	push   $0x3f26
+     aee:	6a 01                	push   $0x1
+     af0:	e8 a8 2d 00 00       	call   389d <printf>
+    return;
+     af5:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+     af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     afb:	5b                   	pop    %ebx
+     afc:	5e                   	pop    %esi
+     afd:	5f                   	pop    %edi
+     afe:	5d                   	pop    %ebp
+     aff:	c3                   	ret
+  close(pfds[0]);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 75 e0             	push   -0x20(%ebp)
+     b06:	e8 3d 2c 00 00       	call   3748 <close>
+  printf(1, "kill... ");
+     b0b:	83 c4 08             	add    $0x8,%esp
+     b0e:	68 39 3f 00 00       	push   $0x3f39
+     b13:	6a 01                	push   $0x1
+     b15:	e8 83 2d 00 00       	call   389d <printf>
+  kill(pid1);
+     b1a:	89 1c 24             	mov    %ebx,(%esp)
+     b1d:	e8 2e 2c 00 00       	call   3750 <kill>
+  kill(pid2);
+     b22:	89 34 24             	mov    %esi,(%esp)
+     b25:	e8 26 2c 00 00       	call   3750 <kill>
+  kill(pid3);
+     b2a:	89 3c 24             	mov    %edi,(%esp)
+     b2d:	e8 1e 2c 00 00       	call   3750 <kill>
+  printf(1, "wait... ");
+     b32:	83 c4 08             	add    $0x8,%esp
+     b35:	68 42 3f 00 00       	push   $0x3f42
+     b3a:	6a 01                	push   $0x1
+     b3c:	e8 5c 2d 00 00       	call   389d <printf>
+  wait();
+     b41:	e8 e2 2b 00 00       	call   3728 <wait>
+  wait();
+     b46:	e8 dd 2b 00 00       	call   3728 <wait>
+  wait();
+     b4b:	e8 d8 2b 00 00       	call   3728 <wait>
+  printf(1, "preempt ok\n");
+     b50:	83 c4 08             	add    $0x8,%esp
+     b53:	68 4b 3f 00 00       	push   $0x3f4b
+     b58:	6a 01                	push   $0x1
+     b5a:	e8 3e 2d 00 00       	call   389d <printf>
+     b5f:	83 c4 10             	add    $0x10,%esp
+     b62:	eb 94                	jmp    af8 <preempt+0xcf>
+
+00000b64 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     b64:	55                   	push   %ebp
+     b65:	89 e5                	mov    %esp,%ebp
+     b67:	56                   	push   %esi
+     b68:	53                   	push   %ebx
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     b69:	be 00 00 00 00       	mov    $0x0,%esi
+     b6e:	83 fe 63             	cmp    $0x63,%esi
+     b71:	7f 4d                	jg     bc0 <exitwait+0x5c>
+    pid = fork();
+     b73:	e8 a0 2b 00 00       	call   3718 <fork>
+     b78:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     b7a:	85 c0                	test   %eax,%eax
+     b7c:	78 10                	js     b8e <exitwait+0x2a>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     b7e:	74 3b                	je     bbb <exitwait+0x57>
+      if(wait() != pid){
+     b80:	e8 a3 2b 00 00       	call   3728 <wait>
+     b85:	39 d8                	cmp    %ebx,%eax
+     b87:	75 1e                	jne    ba7 <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+     b89:	83 c6 01             	add    $0x1,%esi
+     b8c:	eb e0                	jmp    b6e <exitwait+0xa>
+      printf(1, "fork failed\n");
+     b8e:	83 ec 08             	sub    $0x8,%esp
+     b91:	68 b5 4a 00 00       	push   $0x4ab5
+     b96:	6a 01                	push   $0x1
+     b98:	e8 00 2d 00 00       	call   389d <printf>
+      return;
+     b9d:	83 c4 10             	add    $0x10,%esp
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+}
+     ba0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ba3:	5b                   	pop    %ebx
+     ba4:	5e                   	pop    %esi
+     ba5:	5d                   	pop    %ebp
+     ba6:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     ba7:	83 ec 08             	sub    $0x8,%esp
+     baa:	68 57 3f 00 00       	push   $0x3f57
+     baf:	6a 01                	push   $0x1
+     bb1:	e8 e7 2c 00 00       	call   389d <printf>
+        return;
+     bb6:	83 c4 10             	add    $0x10,%esp
+     bb9:	eb e5                	jmp    ba0 <exitwait+0x3c>
+      exit();
+     bbb:	e8 60 2b 00 00       	call   3720 <exit>
+  printf(1, "exitwait ok\n");
+     bc0:	83 ec 08             	sub    $0x8,%esp
+     bc3:	68 67 3f 00 00       	push   $0x3f67
+     bc8:	6a 01                	push   $0x1
+     bca:	e8 ce 2c 00 00       	call   389d <printf>
+     bcf:	83 c4 10             	add    $0x10,%esp
+     bd2:	eb cc                	jmp    ba0 <exitwait+0x3c>
+
+00000bd4 <mem>:
+
+void
+mem(void)
+{
+     bd4:	55                   	push   %ebp
+     bd5:	89 e5                	mov    %esp,%ebp
+     bd7:	57                   	push   %edi
+     bd8:	56                   	push   %esi
+     bd9:	53                   	push   %ebx
+     bda:	83 ec 14             	sub    $0x14,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     bdd:	68 74 3f 00 00       	push   $0x3f74
+     be2:	6a 01                	push   $0x1
+     be4:	e8 b4 2c 00 00       	call   389d <printf>
+  ppid = getpid();
+     be9:	e8 b2 2b 00 00       	call   37a0 <getpid>
+     bee:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     bf0:	e8 23 2b 00 00       	call   3718 <fork>
+     bf5:	83 c4 10             	add    $0x10,%esp
+     bf8:	85 c0                	test   %eax,%eax
+     bfa:	0f 85 82 00 00 00    	jne    c82 <mem+0xae>
+    m1 = 0;
+     c00:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c05:	eb 04                	jmp    c0b <mem+0x37>
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+     c07:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+     c09:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+     c0b:	83 ec 0c             	sub    $0xc,%esp
+     c0e:	68 11 27 00 00       	push   $0x2711
+     c13:	e8 d5 2e 00 00       	call   3aed <malloc>
+     c18:	83 c4 10             	add    $0x10,%esp
+     c1b:	85 c0                	test   %eax,%eax
+     c1d:	75 e8                	jne    c07 <mem+0x33>
+     c1f:	eb 10                	jmp    c31 <mem+0x5d>
+    }
+    while(m1){
+      m2 = *(char**)m1;
+     c21:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	53                   	push   %ebx
+     c27:	e8 01 2e 00 00       	call   3a2d <free>
+     c2c:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+     c2f:	89 fb                	mov    %edi,%ebx
+    while(m1){
+     c31:	85 db                	test   %ebx,%ebx
+     c33:	75 ec                	jne    c21 <mem+0x4d>
+    }
+    m1 = malloc(1024*20);
+     c35:	83 ec 0c             	sub    $0xc,%esp
+     c38:	68 00 50 00 00       	push   $0x5000
+     c3d:	e8 ab 2e 00 00       	call   3aed <malloc>
+    if(m1 == 0){
+     c42:	83 c4 10             	add    $0x10,%esp
+     c45:	85 c0                	test   %eax,%eax
+     c47:	74 1d                	je     c66 <mem+0x92>
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+     c49:	83 ec 0c             	sub    $0xc,%esp
+     c4c:	50                   	push   %eax
+     c4d:	e8 db 2d 00 00       	call   3a2d <free>
+    printf(1, "mem ok\n");
+     c52:	83 c4 08             	add    $0x8,%esp
+     c55:	68 98 3f 00 00       	push   $0x3f98
+     c5a:	6a 01                	push   $0x1
+     c5c:	e8 3c 2c 00 00       	call   389d <printf>
+    exit();
+     c61:	e8 ba 2a 00 00       	call   3720 <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+     c66:	83 ec 08             	sub    $0x8,%esp
+     c69:	68 7e 3f 00 00       	push   $0x3f7e
+     c6e:	6a 01                	push   $0x1
+     c70:	e8 28 2c 00 00       	call   389d <printf>
+      kill(ppid);
+     c75:	89 34 24             	mov    %esi,(%esp)
+     c78:	e8 d3 2a 00 00       	call   3750 <kill>
+      exit();
+     c7d:	e8 9e 2a 00 00       	call   3720 <exit>
+  } else {
+    wait();
+     c82:	e8 a1 2a 00 00       	call   3728 <wait>
+  }
+}
+     c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c8a:	5b                   	pop    %ebx
+     c8b:	5e                   	pop    %esi
+     c8c:	5f                   	pop    %edi
+     c8d:	5d                   	pop    %ebp
+     c8e:	c3                   	ret
+
+00000c8f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	57                   	push   %edi
+     c93:	56                   	push   %esi
+     c94:	53                   	push   %ebx
+     c95:	83 ec 24             	sub    $0x24,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     c98:	68 a0 3f 00 00       	push   $0x3fa0
+     c9d:	6a 01                	push   $0x1
+     c9f:	e8 f9 2b 00 00       	call   389d <printf>
+
+  unlink("sharedfd");
+     ca4:	c7 04 24 af 3f 00 00 	movl   $0x3faf,(%esp)
+     cab:	e8 c0 2a 00 00       	call   3770 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     cb0:	83 c4 08             	add    $0x8,%esp
+     cb3:	68 02 02 00 00       	push   $0x202
+     cb8:	68 af 3f 00 00       	push   $0x3faf
+     cbd:	e8 9e 2a 00 00       	call   3760 <open>
+  if(fd < 0){
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	78 4d                	js     d16 <sharedfd+0x87>
+     cc9:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+     ccb:	e8 48 2a 00 00       	call   3718 <fork>
+     cd0:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     cd2:	85 c0                	test   %eax,%eax
+     cd4:	75 57                	jne    d2d <sharedfd+0x9e>
+     cd6:	b8 63 00 00 00       	mov    $0x63,%eax
+     cdb:	83 ec 04             	sub    $0x4,%esp
+     cde:	6a 0a                	push   $0xa
+     ce0:	50                   	push   %eax
+     ce1:	8d 45 de             	lea    -0x22(%ebp),%eax
+     ce4:	50                   	push   %eax
+     ce5:	e8 fb 28 00 00       	call   35e5 <memset>
+  for(i = 0; i < 1000; i++){
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cf2:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+     cf8:	7f 4c                	jg     d46 <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     cfa:	83 ec 04             	sub    $0x4,%esp
+     cfd:	6a 0a                	push   $0xa
+     cff:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d02:	50                   	push   %eax
+     d03:	56                   	push   %esi
+     d04:	e8 37 2a 00 00       	call   3740 <write>
+     d09:	83 c4 10             	add    $0x10,%esp
+     d0c:	83 f8 0a             	cmp    $0xa,%eax
+     d0f:	75 23                	jne    d34 <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+     d11:	83 c3 01             	add    $0x1,%ebx
+     d14:	eb dc                	jmp    cf2 <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     d16:	83 ec 08             	sub    $0x8,%esp
+     d19:	68 74 4c 00 00       	push   $0x4c74
+     d1e:	6a 01                	push   $0x1
+     d20:	e8 78 2b 00 00       	call   389d <printf>
+    return;
+     d25:	83 c4 10             	add    $0x10,%esp
+     d28:	e9 e4 00 00 00       	jmp    e11 <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     d2d:	b8 70 00 00 00       	mov    $0x70,%eax
+     d32:	eb a7                	jmp    cdb <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+     d34:	83 ec 08             	sub    $0x8,%esp
+     d37:	68 a0 4c 00 00       	push   $0x4ca0
+     d3c:	6a 01                	push   $0x1
+     d3e:	e8 5a 2b 00 00       	call   389d <printf>
+      break;
+     d43:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+     d46:	85 ff                	test   %edi,%edi
+     d48:	74 4d                	je     d97 <sharedfd+0x108>
+    exit();
+  else
+    wait();
+     d4a:	e8 d9 29 00 00       	call   3728 <wait>
+  close(fd);
+     d4f:	83 ec 0c             	sub    $0xc,%esp
+     d52:	56                   	push   %esi
+     d53:	e8 f0 29 00 00       	call   3748 <close>
+  fd = open("sharedfd", 0);
+     d58:	83 c4 08             	add    $0x8,%esp
+     d5b:	6a 00                	push   $0x0
+     d5d:	68 af 3f 00 00       	push   $0x3faf
+     d62:	e8 f9 29 00 00       	call   3760 <open>
+     d67:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	85 c0                	test   %eax,%eax
+     d6e:	78 2c                	js     d9c <sharedfd+0x10d>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+     d70:	be 00 00 00 00       	mov    $0x0,%esi
+     d75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     d7a:	83 ec 04             	sub    $0x4,%esp
+     d7d:	6a 0a                	push   $0xa
+     d7f:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d82:	50                   	push   %eax
+     d83:	57                   	push   %edi
+     d84:	e8 af 29 00 00       	call   3738 <read>
+     d89:	83 c4 10             	add    $0x10,%esp
+     d8c:	85 c0                	test   %eax,%eax
+     d8e:	7e 41                	jle    dd1 <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+     d90:	b8 00 00 00 00       	mov    $0x0,%eax
+     d95:	eb 21                	jmp    db8 <sharedfd+0x129>
+    exit();
+     d97:	e8 84 29 00 00       	call   3720 <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     d9c:	83 ec 08             	sub    $0x8,%esp
+     d9f:	68 c0 4c 00 00       	push   $0x4cc0
+     da4:	6a 01                	push   $0x1
+     da6:	e8 f2 2a 00 00       	call   389d <printf>
+    return;
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	eb 61                	jmp    e11 <sharedfd+0x182>
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+     db0:	80 fa 70             	cmp    $0x70,%dl
+     db3:	74 17                	je     dcc <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+     db5:	83 c0 01             	add    $0x1,%eax
+     db8:	83 f8 09             	cmp    $0x9,%eax
+     dbb:	77 bd                	ja     d7a <sharedfd+0xeb>
+      if(buf[i] == 'c')
+     dbd:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+     dc2:	80 fa 63             	cmp    $0x63,%dl
+     dc5:	75 e9                	jne    db0 <sharedfd+0x121>
+        nc++;
+     dc7:	83 c3 01             	add    $0x1,%ebx
+     dca:	eb e4                	jmp    db0 <sharedfd+0x121>
+        np++;
+     dcc:	83 c6 01             	add    $0x1,%esi
+     dcf:	eb e4                	jmp    db5 <sharedfd+0x126>
+    }
+  }
+  close(fd);
+     dd1:	83 ec 0c             	sub    $0xc,%esp
+     dd4:	57                   	push   %edi
+     dd5:	e8 6e 29 00 00       	call   3748 <close>
+  unlink("sharedfd");
+     dda:	c7 04 24 af 3f 00 00 	movl   $0x3faf,(%esp)
+     de1:	e8 8a 29 00 00       	call   3770 <unlink>
+  if(nc == 10000 && np == 10000){
+     de6:	83 c4 10             	add    $0x10,%esp
+     de9:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     def:	0f 94 c2             	sete   %dl
+     df2:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+     df8:	0f 94 c0             	sete   %al
+     dfb:	84 c2                	test   %al,%dl
+     dfd:	74 1a                	je     e19 <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+     dff:	83 ec 08             	sub    $0x8,%esp
+     e02:	68 b8 3f 00 00       	push   $0x3fb8
+     e07:	6a 01                	push   $0x1
+     e09:	e8 8f 2a 00 00       	call   389d <printf>
+     e0e:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+     e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e14:	5b                   	pop    %ebx
+     e15:	5e                   	pop    %esi
+     e16:	5f                   	pop    %edi
+     e17:	5d                   	pop    %ebp
+     e18:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     e19:	56                   	push   %esi
+     e1a:	53                   	push   %ebx
+     e1b:	68 c5 3f 00 00       	push   $0x3fc5
+     e20:	6a 01                	push   $0x1
+     e22:	e8 76 2a 00 00       	call   389d <printf>
+    exit();
+     e27:	e8 f4 28 00 00       	call   3720 <exit>
+
+00000e2c <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     e2c:	55                   	push   %ebp
+     e2d:	89 e5                	mov    %esp,%ebp
+     e2f:	57                   	push   %edi
+     e30:	56                   	push   %esi
+     e31:	53                   	push   %ebx
+     e32:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     e35:	c7 45 d8 da 3f 00 00 	movl   $0x3fda,-0x28(%ebp)
+     e3c:	c7 45 dc 23 41 00 00 	movl   $0x4123,-0x24(%ebp)
+     e43:	c7 45 e0 27 41 00 00 	movl   $0x4127,-0x20(%ebp)
+     e4a:	c7 45 e4 dd 3f 00 00 	movl   $0x3fdd,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     e51:	68 e0 3f 00 00       	push   $0x3fe0
+     e56:	6a 01                	push   $0x1
+     e58:	e8 40 2a 00 00       	call   389d <printf>
+
+  for(pi = 0; pi < 4; pi++){
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	be 00 00 00 00       	mov    $0x0,%esi
+     e65:	eb 45                	jmp    eac <fourfiles+0x80>
+    fname = names[pi];
+    unlink(fname);
+
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+     e67:	83 ec 08             	sub    $0x8,%esp
+     e6a:	68 b5 4a 00 00       	push   $0x4ab5
+     e6f:	6a 01                	push   $0x1
+     e71:	e8 27 2a 00 00       	call   389d <printf>
+      exit();
+     e76:	e8 a5 28 00 00       	call   3720 <exit>
+    }
+
+    if(pid == 0){
+      fd = open(fname, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(1, "create failed\n");
+     e7b:	83 ec 08             	sub    $0x8,%esp
+     e7e:	68 7b 42 00 00       	push   $0x427b
+     e83:	6a 01                	push   $0x1
+     e85:	e8 13 2a 00 00       	call   389d <printf>
+        exit();
+     e8a:	e8 91 28 00 00       	call   3720 <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+      for(i = 0; i < 12; i++){
+        if((n = write(fd, buf, 500)) != 500){
+          printf(1, "write failed %d\n", n);
+     e8f:	83 ec 04             	sub    $0x4,%esp
+     e92:	50                   	push   %eax
+     e93:	68 f0 3f 00 00       	push   $0x3ff0
+     e98:	6a 01                	push   $0x1
+     e9a:	e8 fe 29 00 00       	call   389d <printf>
+          exit();
+     e9f:	e8 7c 28 00 00       	call   3720 <exit>
+        }
+      }
+      exit();
+     ea4:	e8 77 28 00 00       	call   3720 <exit>
+  for(pi = 0; pi < 4; pi++){
+     ea9:	83 c6 01             	add    $0x1,%esi
+     eac:	83 fe 03             	cmp    $0x3,%esi
+     eaf:	7f 78                	jg     f29 <fourfiles+0xfd>
+    fname = names[pi];
+     eb1:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+     eb5:	83 ec 0c             	sub    $0xc,%esp
+     eb8:	57                   	push   %edi
+     eb9:	e8 b2 28 00 00       	call   3770 <unlink>
+    pid = fork();
+     ebe:	e8 55 28 00 00       	call   3718 <fork>
+    if(pid < 0){
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	85 c0                	test   %eax,%eax
+     ec8:	78 9d                	js     e67 <fourfiles+0x3b>
+    if(pid == 0){
+     eca:	75 dd                	jne    ea9 <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+     ecc:	89 c3                	mov    %eax,%ebx
+     ece:	83 ec 08             	sub    $0x8,%esp
+     ed1:	68 02 02 00 00       	push   $0x202
+     ed6:	57                   	push   %edi
+     ed7:	e8 84 28 00 00       	call   3760 <open>
+     edc:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+     ede:	83 c4 10             	add    $0x10,%esp
+     ee1:	85 c0                	test   %eax,%eax
+     ee3:	78 96                	js     e7b <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	68 00 02 00 00       	push   $0x200
+     eed:	83 c6 30             	add    $0x30,%esi
+     ef0:	56                   	push   %esi
+     ef1:	68 c0 7a 00 00       	push   $0x7ac0
+     ef6:	e8 ea 26 00 00       	call   35e5 <memset>
+      for(i = 0; i < 12; i++){
+     efb:	83 c4 10             	add    $0x10,%esp
+     efe:	83 fb 0b             	cmp    $0xb,%ebx
+     f01:	7f a1                	jg     ea4 <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+     f03:	83 ec 04             	sub    $0x4,%esp
+     f06:	68 f4 01 00 00       	push   $0x1f4
+     f0b:	68 c0 7a 00 00       	push   $0x7ac0
+     f10:	57                   	push   %edi
+     f11:	e8 2a 28 00 00       	call   3740 <write>
+     f16:	83 c4 10             	add    $0x10,%esp
+     f19:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     f1e:	0f 85 6b ff ff ff    	jne    e8f <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+     f24:	83 c3 01             	add    $0x1,%ebx
+     f27:	eb d5                	jmp    efe <fourfiles+0xd2>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+     f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f2e:	eb 08                	jmp    f38 <fourfiles+0x10c>
+    wait();
+     f30:	e8 f3 27 00 00       	call   3728 <wait>
+  for(pi = 0; pi < 4; pi++){
+     f35:	83 c3 01             	add    $0x1,%ebx
+     f38:	83 fb 03             	cmp    $0x3,%ebx
+     f3b:	7e f3                	jle    f30 <fourfiles+0x104>
+  }
+
+  for(i = 0; i < 2; i++){
+     f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f42:	eb 78                	jmp    fbc <fourfiles+0x190>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+     f44:	83 ec 08             	sub    $0x8,%esp
+     f47:	68 01 40 00 00       	push   $0x4001
+     f4c:	6a 01                	push   $0x1
+     f4e:	e8 4a 29 00 00       	call   389d <printf>
+          exit();
+     f53:	e8 c8 27 00 00       	call   3720 <exit>
+        }
+      }
+      total += n;
+     f58:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     f5a:	83 ec 04             	sub    $0x4,%esp
+     f5d:	68 00 20 00 00       	push   $0x2000
+     f62:	68 c0 7a 00 00       	push   $0x7ac0
+     f67:	ff 75 d4             	push   -0x2c(%ebp)
+     f6a:	e8 c9 27 00 00       	call   3738 <read>
+     f6f:	89 c7                	mov    %eax,%edi
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	7e 1c                	jle    f94 <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+     f78:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7d:	39 f8                	cmp    %edi,%eax
+     f7f:	7d d7                	jge    f58 <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+     f81:	0f be 88 c0 7a 00 00 	movsbl 0x7ac0(%eax),%ecx
+     f88:	8d 53 30             	lea    0x30(%ebx),%edx
+     f8b:	39 d1                	cmp    %edx,%ecx
+     f8d:	75 b5                	jne    f44 <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+     f8f:	83 c0 01             	add    $0x1,%eax
+     f92:	eb e9                	jmp    f7d <fourfiles+0x151>
+    }
+    close(fd);
+     f94:	8b 7d d0             	mov    -0x30(%ebp),%edi
+     f97:	83 ec 0c             	sub    $0xc,%esp
+     f9a:	ff 75 d4             	push   -0x2c(%ebp)
+     f9d:	e8 a6 27 00 00       	call   3748 <close>
+    if(total != 12*500){
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+     fab:	75 36                	jne    fe3 <fourfiles+0x1b7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+     fad:	83 ec 0c             	sub    $0xc,%esp
+     fb0:	57                   	push   %edi
+     fb1:	e8 ba 27 00 00       	call   3770 <unlink>
+  for(i = 0; i < 2; i++){
+     fb6:	83 c3 01             	add    $0x1,%ebx
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	83 fb 01             	cmp    $0x1,%ebx
+     fbf:	7f 37                	jg     ff8 <fourfiles+0x1cc>
+    fname = names[i];
+     fc1:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+     fc5:	83 ec 08             	sub    $0x8,%esp
+     fc8:	6a 00                	push   $0x0
+     fca:	57                   	push   %edi
+     fcb:	e8 90 27 00 00       	call   3760 <open>
+     fd0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fd3:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     fd6:	be 00 00 00 00       	mov    $0x0,%esi
+     fdb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fde:	e9 77 ff ff ff       	jmp    f5a <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+     fe3:	83 ec 04             	sub    $0x4,%esp
+     fe6:	56                   	push   %esi
+     fe7:	68 0d 40 00 00       	push   $0x400d
+     fec:	6a 01                	push   $0x1
+     fee:	e8 aa 28 00 00       	call   389d <printf>
+      exit();
+     ff3:	e8 28 27 00 00       	call   3720 <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+     ff8:	83 ec 08             	sub    $0x8,%esp
+     ffb:	68 1e 40 00 00       	push   $0x401e
+    1000:	6a 01                	push   $0x1
+    1002:	e8 96 28 00 00       	call   389d <printf>
+}
+    1007:	83 c4 10             	add    $0x10,%esp
+    100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    100d:	5b                   	pop    %ebx
+    100e:	5e                   	pop    %esi
+    100f:	5f                   	pop    %edi
+    1010:	5d                   	pop    %ebp
+    1011:	c3                   	ret
+
+00001012 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1012:	55                   	push   %ebp
+    1013:	89 e5                	mov    %esp,%ebp
+    1015:	56                   	push   %esi
+    1016:	53                   	push   %ebx
+    1017:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    101a:	68 2c 40 00 00       	push   $0x402c
+    101f:	6a 01                	push   $0x1
+    1021:	e8 77 28 00 00       	call   389d <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    1026:	83 c4 10             	add    $0x10,%esp
+    1029:	be 00 00 00 00       	mov    $0x0,%esi
+    102e:	83 fe 03             	cmp    $0x3,%esi
+    1031:	0f 8f bc 00 00 00    	jg     10f3 <createdelete+0xe1>
+    pid = fork();
+    1037:	e8 dc 26 00 00       	call   3718 <fork>
+    103c:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    103e:	85 c0                	test   %eax,%eax
+    1040:	78 07                	js     1049 <createdelete+0x37>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    1042:	74 19                	je     105d <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+    1044:	83 c6 01             	add    $0x1,%esi
+    1047:	eb e5                	jmp    102e <createdelete+0x1c>
+      printf(1, "fork failed\n");
+    1049:	83 ec 08             	sub    $0x8,%esp
+    104c:	68 b5 4a 00 00       	push   $0x4ab5
+    1051:	6a 01                	push   $0x1
+    1053:	e8 45 28 00 00       	call   389d <printf>
+      exit();
+    1058:	e8 c3 26 00 00       	call   3720 <exit>
+      name[0] = 'p' + pi;
+    105d:	8d 46 70             	lea    0x70(%esi),%eax
+    1060:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+    1063:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+    1067:	eb 17                	jmp    1080 <createdelete+0x6e>
+        name[1] = '0' + i;
+        fd = open(name, O_CREATE | O_RDWR);
+        if(fd < 0){
+          printf(1, "create failed\n");
+    1069:	83 ec 08             	sub    $0x8,%esp
+    106c:	68 7b 42 00 00       	push   $0x427b
+    1071:	6a 01                	push   $0x1
+    1073:	e8 25 28 00 00       	call   389d <printf>
+          exit();
+    1078:	e8 a3 26 00 00       	call   3720 <exit>
+      for(i = 0; i < N; i++){
+    107d:	83 c3 01             	add    $0x1,%ebx
+    1080:	83 fb 13             	cmp    $0x13,%ebx
+    1083:	7f 69                	jg     10ee <createdelete+0xdc>
+        name[1] = '0' + i;
+    1085:	8d 43 30             	lea    0x30(%ebx),%eax
+    1088:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    108b:	83 ec 08             	sub    $0x8,%esp
+    108e:	68 02 02 00 00       	push   $0x202
+    1093:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1096:	50                   	push   %eax
+    1097:	e8 c4 26 00 00       	call   3760 <open>
+        if(fd < 0){
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	85 c0                	test   %eax,%eax
+    10a1:	78 c6                	js     1069 <createdelete+0x57>
+        }
+        close(fd);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	50                   	push   %eax
+    10a7:	e8 9c 26 00 00       	call   3748 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    10ac:	83 c4 10             	add    $0x10,%esp
+    10af:	85 db                	test   %ebx,%ebx
+    10b1:	7e ca                	jle    107d <createdelete+0x6b>
+    10b3:	f6 c3 01             	test   $0x1,%bl
+    10b6:	75 c5                	jne    107d <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+    10b8:	89 d8                	mov    %ebx,%eax
+    10ba:	c1 e8 1f             	shr    $0x1f,%eax
+    10bd:	01 d8                	add    %ebx,%eax
+    10bf:	d1 f8                	sar    %eax
+    10c1:	83 c0 30             	add    $0x30,%eax
+    10c4:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+    10c7:	83 ec 0c             	sub    $0xc,%esp
+    10ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    10cd:	50                   	push   %eax
+    10ce:	e8 9d 26 00 00       	call   3770 <unlink>
+    10d3:	83 c4 10             	add    $0x10,%esp
+    10d6:	85 c0                	test   %eax,%eax
+    10d8:	79 a3                	jns    107d <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+    10da:	83 ec 08             	sub    $0x8,%esp
+    10dd:	68 2d 3c 00 00       	push   $0x3c2d
+    10e2:	6a 01                	push   $0x1
+    10e4:	e8 b4 27 00 00       	call   389d <printf>
+            exit();
+    10e9:	e8 32 26 00 00       	call   3720 <exit>
+          }
+        }
+      }
+      exit();
+    10ee:	e8 2d 26 00 00       	call   3720 <exit>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    10f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10f8:	eb 08                	jmp    1102 <createdelete+0xf0>
+    wait();
+    10fa:	e8 29 26 00 00       	call   3728 <wait>
+  for(pi = 0; pi < 4; pi++){
+    10ff:	83 c3 01             	add    $0x1,%ebx
+    1102:	83 fb 03             	cmp    $0x3,%ebx
+    1105:	7e f3                	jle    10fa <createdelete+0xe8>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    1107:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+    110b:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+    110f:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+    1113:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1118:	e9 89 00 00 00       	jmp    11a6 <createdelete+0x194>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    111d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1120:	83 fa 08             	cmp    $0x8,%edx
+    1123:	76 54                	jbe    1179 <createdelete+0x167>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1125:	85 c0                	test   %eax,%eax
+    1127:	79 6c                	jns    1195 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+    1129:	83 c6 01             	add    $0x1,%esi
+    112c:	83 fe 03             	cmp    $0x3,%esi
+    112f:	7f 72                	jg     11a3 <createdelete+0x191>
+      name[0] = 'p' + pi;
+    1131:	8d 46 70             	lea    0x70(%esi),%eax
+    1134:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    1137:	8d 43 30             	lea    0x30(%ebx),%eax
+    113a:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+    113d:	83 ec 08             	sub    $0x8,%esp
+    1140:	6a 00                	push   $0x0
+    1142:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1145:	50                   	push   %eax
+    1146:	e8 15 26 00 00       	call   3760 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	85 db                	test   %ebx,%ebx
+    1150:	0f 94 c2             	sete   %dl
+    1153:	83 fb 09             	cmp    $0x9,%ebx
+    1156:	0f 9f c1             	setg   %cl
+    1159:	08 ca                	or     %cl,%dl
+    115b:	74 c0                	je     111d <createdelete+0x10b>
+    115d:	85 c0                	test   %eax,%eax
+    115f:	79 bc                	jns    111d <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1161:	83 ec 04             	sub    $0x4,%esp
+    1164:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1167:	50                   	push   %eax
+    1168:	68 ec 4c 00 00       	push   $0x4cec
+    116d:	6a 01                	push   $0x1
+    116f:	e8 29 27 00 00       	call   389d <printf>
+        exit();
+    1174:	e8 a7 25 00 00       	call   3720 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1179:	85 c0                	test   %eax,%eax
+    117b:	78 ac                	js     1129 <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+    117d:	83 ec 04             	sub    $0x4,%esp
+    1180:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1183:	50                   	push   %eax
+    1184:	68 10 4d 00 00       	push   $0x4d10
+    1189:	6a 01                	push   $0x1
+    118b:	e8 0d 27 00 00       	call   389d <printf>
+        exit();
+    1190:	e8 8b 25 00 00       	call   3720 <exit>
+        close(fd);
+    1195:	83 ec 0c             	sub    $0xc,%esp
+    1198:	50                   	push   %eax
+    1199:	e8 aa 25 00 00       	call   3748 <close>
+    119e:	83 c4 10             	add    $0x10,%esp
+    11a1:	eb 86                	jmp    1129 <createdelete+0x117>
+  for(i = 0; i < N; i++){
+    11a3:	83 c3 01             	add    $0x1,%ebx
+    11a6:	83 fb 13             	cmp    $0x13,%ebx
+    11a9:	7f 0a                	jg     11b5 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+    11ab:	be 00 00 00 00       	mov    $0x0,%esi
+    11b0:	e9 77 ff ff ff       	jmp    112c <createdelete+0x11a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    11b5:	be 00 00 00 00       	mov    $0x0,%esi
+    11ba:	eb 26                	jmp    11e2 <createdelete+0x1d0>
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    11bc:	8d 46 70             	lea    0x70(%esi),%eax
+    11bf:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    11c2:	8d 46 30             	lea    0x30(%esi),%eax
+    11c5:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+    11c8:	83 ec 0c             	sub    $0xc,%esp
+    11cb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    11ce:	50                   	push   %eax
+    11cf:	e8 9c 25 00 00       	call   3770 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    11d4:	83 c3 01             	add    $0x1,%ebx
+    11d7:	83 c4 10             	add    $0x10,%esp
+    11da:	83 fb 03             	cmp    $0x3,%ebx
+    11dd:	7e dd                	jle    11bc <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+    11df:	83 c6 01             	add    $0x1,%esi
+    11e2:	83 fe 13             	cmp    $0x13,%esi
+    11e5:	7f 07                	jg     11ee <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+    11e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11ec:	eb ec                	jmp    11da <createdelete+0x1c8>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    11ee:	83 ec 08             	sub    $0x8,%esp
+    11f1:	68 3f 40 00 00       	push   $0x403f
+    11f6:	6a 01                	push   $0x1
+    11f8:	e8 a0 26 00 00       	call   389d <printf>
+}
+    11fd:	83 c4 10             	add    $0x10,%esp
+    1200:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1203:	5b                   	pop    %ebx
+    1204:	5e                   	pop    %esi
+    1205:	5d                   	pop    %ebp
+    1206:	c3                   	ret
+
+00001207 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1207:	55                   	push   %ebp
+    1208:	89 e5                	mov    %esp,%ebp
+    120a:	56                   	push   %esi
+    120b:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    120c:	83 ec 08             	sub    $0x8,%esp
+    120f:	68 50 40 00 00       	push   $0x4050
+    1214:	6a 01                	push   $0x1
+    1216:	e8 82 26 00 00       	call   389d <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    121b:	83 c4 08             	add    $0x8,%esp
+    121e:	68 02 02 00 00       	push   $0x202
+    1223:	68 61 40 00 00       	push   $0x4061
+    1228:	e8 33 25 00 00       	call   3760 <open>
+  if(fd < 0){
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	0f 88 f0 00 00 00    	js     1328 <unlinkread+0x121>
+    1238:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    123a:	83 ec 04             	sub    $0x4,%esp
+    123d:	6a 05                	push   $0x5
+    123f:	68 86 40 00 00       	push   $0x4086
+    1244:	50                   	push   %eax
+    1245:	e8 f6 24 00 00       	call   3740 <write>
+  close(fd);
+    124a:	89 1c 24             	mov    %ebx,(%esp)
+    124d:	e8 f6 24 00 00       	call   3748 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    1252:	83 c4 08             	add    $0x8,%esp
+    1255:	6a 02                	push   $0x2
+    1257:	68 61 40 00 00       	push   $0x4061
+    125c:	e8 ff 24 00 00       	call   3760 <open>
+    1261:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1263:	83 c4 10             	add    $0x10,%esp
+    1266:	85 c0                	test   %eax,%eax
+    1268:	0f 88 ce 00 00 00    	js     133c <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    126e:	83 ec 0c             	sub    $0xc,%esp
+    1271:	68 61 40 00 00       	push   $0x4061
+    1276:	e8 f5 24 00 00       	call   3770 <unlink>
+    127b:	83 c4 10             	add    $0x10,%esp
+    127e:	85 c0                	test   %eax,%eax
+    1280:	0f 85 ca 00 00 00    	jne    1350 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1286:	83 ec 08             	sub    $0x8,%esp
+    1289:	68 02 02 00 00       	push   $0x202
+    128e:	68 61 40 00 00       	push   $0x4061
+    1293:	e8 c8 24 00 00       	call   3760 <open>
+    1298:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    129a:	83 c4 0c             	add    $0xc,%esp
+    129d:	6a 03                	push   $0x3
+    129f:	68 be 40 00 00       	push   $0x40be
+    12a4:	50                   	push   %eax
+    12a5:	e8 96 24 00 00       	call   3740 <write>
+  close(fd1);
+    12aa:	89 34 24             	mov    %esi,(%esp)
+    12ad:	e8 96 24 00 00       	call   3748 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    12b2:	83 c4 0c             	add    $0xc,%esp
+    12b5:	68 00 20 00 00       	push   $0x2000
+    12ba:	68 c0 7a 00 00       	push   $0x7ac0
+    12bf:	53                   	push   %ebx
+    12c0:	e8 73 24 00 00       	call   3738 <read>
+    12c5:	83 c4 10             	add    $0x10,%esp
+    12c8:	83 f8 05             	cmp    $0x5,%eax
+    12cb:	0f 85 93 00 00 00    	jne    1364 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    12d1:	80 3d c0 7a 00 00 68 	cmpb   $0x68,0x7ac0
+    12d8:	0f 85 9a 00 00 00    	jne    1378 <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    12de:	83 ec 04             	sub    $0x4,%esp
+    12e1:	6a 0a                	push   $0xa
+    12e3:	68 c0 7a 00 00       	push   $0x7ac0
+    12e8:	53                   	push   %ebx
+    12e9:	e8 52 24 00 00       	call   3740 <write>
+    12ee:	83 c4 10             	add    $0x10,%esp
+    12f1:	83 f8 0a             	cmp    $0xa,%eax
+    12f4:	0f 85 92 00 00 00    	jne    138c <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    12fa:	83 ec 0c             	sub    $0xc,%esp
+    12fd:	53                   	push   %ebx
+    12fe:	e8 45 24 00 00       	call   3748 <close>
+  unlink("unlinkread");
+    1303:	c7 04 24 61 40 00 00 	movl   $0x4061,(%esp)
+    130a:	e8 61 24 00 00       	call   3770 <unlink>
+  printf(1, "unlinkread ok\n");
+    130f:	83 c4 08             	add    $0x8,%esp
+    1312:	68 09 41 00 00       	push   $0x4109
+    1317:	6a 01                	push   $0x1
+    1319:	e8 7f 25 00 00       	call   389d <printf>
+}
+    131e:	83 c4 10             	add    $0x10,%esp
+    1321:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1324:	5b                   	pop    %ebx
+    1325:	5e                   	pop    %esi
+    1326:	5d                   	pop    %ebp
+    1327:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1328:	83 ec 08             	sub    $0x8,%esp
+    132b:	68 6c 40 00 00       	push   $0x406c
+    1330:	6a 01                	push   $0x1
+    1332:	e8 66 25 00 00       	call   389d <printf>
+    exit();
+    1337:	e8 e4 23 00 00       	call   3720 <exit>
+    printf(1, "open unlinkread failed\n");
+    133c:	83 ec 08             	sub    $0x8,%esp
+    133f:	68 8c 40 00 00       	push   $0x408c
+    1344:	6a 01                	push   $0x1
+    1346:	e8 52 25 00 00       	call   389d <printf>
+    exit();
+    134b:	e8 d0 23 00 00       	call   3720 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1350:	83 ec 08             	sub    $0x8,%esp
+    1353:	68 a4 40 00 00       	push   $0x40a4
+    1358:	6a 01                	push   $0x1
+    135a:	e8 3e 25 00 00       	call   389d <printf>
+    exit();
+    135f:	e8 bc 23 00 00       	call   3720 <exit>
+    printf(1, "unlinkread read failed");
+    1364:	83 ec 08             	sub    $0x8,%esp
+    1367:	68 c2 40 00 00       	push   $0x40c2
+    136c:	6a 01                	push   $0x1
+    136e:	e8 2a 25 00 00       	call   389d <printf>
+    exit();
+    1373:	e8 a8 23 00 00       	call   3720 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1378:	83 ec 08             	sub    $0x8,%esp
+    137b:	68 d9 40 00 00       	push   $0x40d9
+    1380:	6a 01                	push   $0x1
+    1382:	e8 16 25 00 00       	call   389d <printf>
+    exit();
+    1387:	e8 94 23 00 00       	call   3720 <exit>
+    printf(1, "unlinkread write failed\n");
+    138c:	83 ec 08             	sub    $0x8,%esp
+    138f:	68 f0 40 00 00       	push   $0x40f0
+    1394:	6a 01                	push   $0x1
+    1396:	e8 02 25 00 00       	call   389d <printf>
+    exit();
+    139b:	e8 80 23 00 00       	call   3720 <exit>
+
+000013a0 <linktest>:
+
+void
+linktest(void)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	53                   	push   %ebx
+    13a4:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    13a7:	68 18 41 00 00       	push   $0x4118
+    13ac:	6a 01                	push   $0x1
+    13ae:	e8 ea 24 00 00       	call   389d <printf>
+
+  unlink("lf1");
+    13b3:	c7 04 24 22 41 00 00 	movl   $0x4122,(%esp)
+    13ba:	e8 b1 23 00 00       	call   3770 <unlink>
+  unlink("lf2");
+    13bf:	c7 04 24 26 41 00 00 	movl   $0x4126,(%esp)
+    13c6:	e8 a5 23 00 00       	call   3770 <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    13cb:	83 c4 08             	add    $0x8,%esp
+    13ce:	68 02 02 00 00       	push   $0x202
+    13d3:	68 22 41 00 00       	push   $0x4122
+    13d8:	e8 83 23 00 00       	call   3760 <open>
+  if(fd < 0){
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	85 c0                	test   %eax,%eax
+    13e2:	0f 88 2a 01 00 00    	js     1512 <linktest+0x172>
+    13e8:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    13ea:	83 ec 04             	sub    $0x4,%esp
+    13ed:	6a 05                	push   $0x5
+    13ef:	68 86 40 00 00       	push   $0x4086
+    13f4:	50                   	push   %eax
+    13f5:	e8 46 23 00 00       	call   3740 <write>
+    13fa:	83 c4 10             	add    $0x10,%esp
+    13fd:	83 f8 05             	cmp    $0x5,%eax
+    1400:	0f 85 20 01 00 00    	jne    1526 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1406:	83 ec 0c             	sub    $0xc,%esp
+    1409:	53                   	push   %ebx
+    140a:	e8 39 23 00 00       	call   3748 <close>
+
+  if(link("lf1", "lf2") < 0){
+    140f:	83 c4 08             	add    $0x8,%esp
+    1412:	68 26 41 00 00       	push   $0x4126
+    1417:	68 22 41 00 00       	push   $0x4122
+    141c:	e8 5f 23 00 00       	call   3780 <link>
+    1421:	83 c4 10             	add    $0x10,%esp
+    1424:	85 c0                	test   %eax,%eax
+    1426:	0f 88 0e 01 00 00    	js     153a <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    142c:	83 ec 0c             	sub    $0xc,%esp
+    142f:	68 22 41 00 00       	push   $0x4122
+    1434:	e8 37 23 00 00       	call   3770 <unlink>
+
+  if(open("lf1", 0) >= 0){
+    1439:	83 c4 08             	add    $0x8,%esp
+    143c:	6a 00                	push   $0x0
+    143e:	68 22 41 00 00       	push   $0x4122
+    1443:	e8 18 23 00 00       	call   3760 <open>
+    1448:	83 c4 10             	add    $0x10,%esp
+    144b:	85 c0                	test   %eax,%eax
+    144d:	0f 89 fb 00 00 00    	jns    154e <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    1453:	83 ec 08             	sub    $0x8,%esp
+    1456:	6a 00                	push   $0x0
+    1458:	68 26 41 00 00       	push   $0x4126
+    145d:	e8 fe 22 00 00       	call   3760 <open>
+    1462:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1464:	83 c4 10             	add    $0x10,%esp
+    1467:	85 c0                	test   %eax,%eax
+    1469:	0f 88 f3 00 00 00    	js     1562 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    146f:	83 ec 04             	sub    $0x4,%esp
+    1472:	68 00 20 00 00       	push   $0x2000
+    1477:	68 c0 7a 00 00       	push   $0x7ac0
+    147c:	50                   	push   %eax
+    147d:	e8 b6 22 00 00       	call   3738 <read>
+    1482:	83 c4 10             	add    $0x10,%esp
+    1485:	83 f8 05             	cmp    $0x5,%eax
+    1488:	0f 85 e8 00 00 00    	jne    1576 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    148e:	83 ec 0c             	sub    $0xc,%esp
+    1491:	53                   	push   %ebx
+    1492:	e8 b1 22 00 00       	call   3748 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    1497:	83 c4 08             	add    $0x8,%esp
+    149a:	68 26 41 00 00       	push   $0x4126
+    149f:	68 26 41 00 00       	push   $0x4126
+    14a4:	e8 d7 22 00 00       	call   3780 <link>
+    14a9:	83 c4 10             	add    $0x10,%esp
+    14ac:	85 c0                	test   %eax,%eax
+    14ae:	0f 89 d6 00 00 00    	jns    158a <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    14b4:	83 ec 0c             	sub    $0xc,%esp
+    14b7:	68 26 41 00 00       	push   $0x4126
+    14bc:	e8 af 22 00 00       	call   3770 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    14c1:	83 c4 08             	add    $0x8,%esp
+    14c4:	68 22 41 00 00       	push   $0x4122
+    14c9:	68 26 41 00 00       	push   $0x4126
+    14ce:	e8 ad 22 00 00       	call   3780 <link>
+    14d3:	83 c4 10             	add    $0x10,%esp
+    14d6:	85 c0                	test   %eax,%eax
+    14d8:	0f 89 c0 00 00 00    	jns    159e <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    14de:	83 ec 08             	sub    $0x8,%esp
+    14e1:	68 22 41 00 00       	push   $0x4122
+    14e6:	68 ea 43 00 00       	push   $0x43ea
+    14eb:	e8 90 22 00 00       	call   3780 <link>
+    14f0:	83 c4 10             	add    $0x10,%esp
+    14f3:	85 c0                	test   %eax,%eax
+    14f5:	0f 89 b7 00 00 00    	jns    15b2 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    14fb:	83 ec 08             	sub    $0x8,%esp
+    14fe:	68 c0 41 00 00       	push   $0x41c0
+    1503:	6a 01                	push   $0x1
+    1505:	e8 93 23 00 00       	call   389d <printf>
+}
+    150a:	83 c4 10             	add    $0x10,%esp
+    150d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1510:	c9                   	leave
+    1511:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1512:	83 ec 08             	sub    $0x8,%esp
+    1515:	68 2a 41 00 00       	push   $0x412a
+    151a:	6a 01                	push   $0x1
+    151c:	e8 7c 23 00 00       	call   389d <printf>
+    exit();
+    1521:	e8 fa 21 00 00       	call   3720 <exit>
+    printf(1, "write lf1 failed\n");
+    1526:	83 ec 08             	sub    $0x8,%esp
+    1529:	68 3d 41 00 00       	push   $0x413d
+    152e:	6a 01                	push   $0x1
+    1530:	e8 68 23 00 00       	call   389d <printf>
+    exit();
+    1535:	e8 e6 21 00 00       	call   3720 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    153a:	83 ec 08             	sub    $0x8,%esp
+    153d:	68 4f 41 00 00       	push   $0x414f
+    1542:	6a 01                	push   $0x1
+    1544:	e8 54 23 00 00       	call   389d <printf>
+    exit();
+    1549:	e8 d2 21 00 00       	call   3720 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    154e:	83 ec 08             	sub    $0x8,%esp
+    1551:	68 30 4d 00 00       	push   $0x4d30
+    1556:	6a 01                	push   $0x1
+    1558:	e8 40 23 00 00       	call   389d <printf>
+    exit();
+    155d:	e8 be 21 00 00       	call   3720 <exit>
+    printf(1, "open lf2 failed\n");
+    1562:	83 ec 08             	sub    $0x8,%esp
+    1565:	68 64 41 00 00       	push   $0x4164
+    156a:	6a 01                	push   $0x1
+    156c:	e8 2c 23 00 00       	call   389d <printf>
+    exit();
+    1571:	e8 aa 21 00 00       	call   3720 <exit>
+    printf(1, "read lf2 failed\n");
+    1576:	83 ec 08             	sub    $0x8,%esp
+    1579:	68 75 41 00 00       	push   $0x4175
+    157e:	6a 01                	push   $0x1
+    1580:	e8 18 23 00 00       	call   389d <printf>
+    exit();
+    1585:	e8 96 21 00 00       	call   3720 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    158a:	83 ec 08             	sub    $0x8,%esp
+    158d:	68 86 41 00 00       	push   $0x4186
+    1592:	6a 01                	push   $0x1
+    1594:	e8 04 23 00 00       	call   389d <printf>
+    exit();
+    1599:	e8 82 21 00 00       	call   3720 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    159e:	83 ec 08             	sub    $0x8,%esp
+    15a1:	68 58 4d 00 00       	push   $0x4d58
+    15a6:	6a 01                	push   $0x1
+    15a8:	e8 f0 22 00 00       	call   389d <printf>
+    exit();
+    15ad:	e8 6e 21 00 00       	call   3720 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    15b2:	83 ec 08             	sub    $0x8,%esp
+    15b5:	68 a4 41 00 00       	push   $0x41a4
+    15ba:	6a 01                	push   $0x1
+    15bc:	e8 dc 22 00 00       	call   389d <printf>
+    exit();
+    15c1:	e8 5a 21 00 00       	call   3720 <exit>
+
+000015c6 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    15c6:	55                   	push   %ebp
+    15c7:	89 e5                	mov    %esp,%ebp
+    15c9:	57                   	push   %edi
+    15ca:	56                   	push   %esi
+    15cb:	53                   	push   %ebx
+    15cc:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    15cf:	68 cd 41 00 00       	push   $0x41cd
+    15d4:	6a 01                	push   $0x1
+    15d6:	e8 c2 22 00 00       	call   389d <printf>
+  file[0] = 'C';
+    15db:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    15df:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    15e3:	83 c4 10             	add    $0x10,%esp
+    15e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    15eb:	eb 5a                	jmp    1647 <concreate+0x81>
+    file[1] = '0' + i;
+    unlink(file);
+    pid = fork();
+    if(pid && (i % 3) == 1){
+      link("C0", file);
+    } else if(pid == 0 && (i % 5) == 1){
+    15ed:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    15f2:	89 d8                	mov    %ebx,%eax
+    15f4:	f7 ea                	imul   %edx
+    15f6:	d1 fa                	sar    %edx
+    15f8:	89 d8                	mov    %ebx,%eax
+    15fa:	c1 f8 1f             	sar    $0x1f,%eax
+    15fd:	29 c2                	sub    %eax,%edx
+    15ff:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1602:	89 da                	mov    %ebx,%edx
+    1604:	29 c2                	sub    %eax,%edx
+    1606:	83 fa 01             	cmp    $0x1,%edx
+    1609:	0f 84 9b 00 00 00    	je     16aa <concreate+0xe4>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    160f:	83 ec 08             	sub    $0x8,%esp
+    1612:	68 02 02 00 00       	push   $0x202
+    1617:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    161a:	50                   	push   %eax
+    161b:	e8 40 21 00 00       	call   3760 <open>
+      if(fd < 0){
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	85 c0                	test   %eax,%eax
+    1625:	0f 88 98 00 00 00    	js     16c3 <concreate+0xfd>
+        printf(1, "concreate create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    162b:	83 ec 0c             	sub    $0xc,%esp
+    162e:	50                   	push   %eax
+    162f:	e8 14 21 00 00       	call   3748 <close>
+    1634:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1637:	85 f6                	test   %esi,%esi
+    1639:	0f 84 9c 00 00 00    	je     16db <concreate+0x115>
+      exit();
+    else
+      wait();
+    163f:	e8 e4 20 00 00       	call   3728 <wait>
+  for(i = 0; i < 40; i++){
+    1644:	83 c3 01             	add    $0x1,%ebx
+    1647:	83 fb 27             	cmp    $0x27,%ebx
+    164a:	0f 8f 90 00 00 00    	jg     16e0 <concreate+0x11a>
+    file[1] = '0' + i;
+    1650:	8d 43 30             	lea    0x30(%ebx),%eax
+    1653:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1656:	83 ec 0c             	sub    $0xc,%esp
+    1659:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    165c:	50                   	push   %eax
+    165d:	e8 0e 21 00 00       	call   3770 <unlink>
+    pid = fork();
+    1662:	e8 b1 20 00 00       	call   3718 <fork>
+    1667:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    1669:	83 c4 10             	add    $0x10,%esp
+    166c:	85 c0                	test   %eax,%eax
+    166e:	0f 84 79 ff ff ff    	je     15ed <concreate+0x27>
+    1674:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1679:	89 d8                	mov    %ebx,%eax
+    167b:	f7 ea                	imul   %edx
+    167d:	89 d8                	mov    %ebx,%eax
+    167f:	c1 f8 1f             	sar    $0x1f,%eax
+    1682:	29 c2                	sub    %eax,%edx
+    1684:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1687:	89 da                	mov    %ebx,%edx
+    1689:	29 c2                	sub    %eax,%edx
+    168b:	83 fa 01             	cmp    $0x1,%edx
+    168e:	0f 85 7b ff ff ff    	jne    160f <concreate+0x49>
+      link("C0", file);
+    1694:	83 ec 08             	sub    $0x8,%esp
+    1697:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    169a:	50                   	push   %eax
+    169b:	68 dd 41 00 00       	push   $0x41dd
+    16a0:	e8 db 20 00 00       	call   3780 <link>
+    16a5:	83 c4 10             	add    $0x10,%esp
+    16a8:	eb 8d                	jmp    1637 <concreate+0x71>
+      link("C0", file);
+    16aa:	83 ec 08             	sub    $0x8,%esp
+    16ad:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16b0:	50                   	push   %eax
+    16b1:	68 dd 41 00 00       	push   $0x41dd
+    16b6:	e8 c5 20 00 00       	call   3780 <link>
+    16bb:	83 c4 10             	add    $0x10,%esp
+    16be:	e9 74 ff ff ff       	jmp    1637 <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    16c3:	83 ec 04             	sub    $0x4,%esp
+    16c6:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16c9:	50                   	push   %eax
+    16ca:	68 e0 41 00 00       	push   $0x41e0
+    16cf:	6a 01                	push   $0x1
+    16d1:	e8 c7 21 00 00       	call   389d <printf>
+        exit();
+    16d6:	e8 45 20 00 00       	call   3720 <exit>
+      exit();
+    16db:	e8 40 20 00 00       	call   3720 <exit>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    16e0:	83 ec 04             	sub    $0x4,%esp
+    16e3:	6a 28                	push   $0x28
+    16e5:	6a 00                	push   $0x0
+    16e7:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    16ea:	50                   	push   %eax
+    16eb:	e8 f5 1e 00 00       	call   35e5 <memset>
+  fd = open(".", 0);
+    16f0:	83 c4 08             	add    $0x8,%esp
+    16f3:	6a 00                	push   $0x0
+    16f5:	68 ea 43 00 00       	push   $0x43ea
+    16fa:	e8 61 20 00 00       	call   3760 <open>
+    16ff:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    1701:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1704:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1709:	83 ec 04             	sub    $0x4,%esp
+    170c:	6a 10                	push   $0x10
+    170e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1711:	50                   	push   %eax
+    1712:	53                   	push   %ebx
+    1713:	e8 20 20 00 00       	call   3738 <read>
+    1718:	83 c4 10             	add    $0x10,%esp
+    171b:	85 c0                	test   %eax,%eax
+    171d:	7e 60                	jle    177f <concreate+0x1b9>
+    if(de.inum == 0)
+    171f:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1724:	74 e3                	je     1709 <concreate+0x143>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1726:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    172a:	75 dd                	jne    1709 <concreate+0x143>
+    172c:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1730:	75 d7                	jne    1709 <concreate+0x143>
+      i = de.name[1] - '0';
+    1732:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    1736:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1739:	83 f8 27             	cmp    $0x27,%eax
+    173c:	77 11                	ja     174f <concreate+0x189>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    173e:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1743:	75 22                	jne    1767 <concreate+0x1a1>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    1745:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    174a:	83 c6 01             	add    $0x1,%esi
+    174d:	eb ba                	jmp    1709 <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    174f:	83 ec 04             	sub    $0x4,%esp
+    1752:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1755:	50                   	push   %eax
+    1756:	68 fc 41 00 00       	push   $0x41fc
+    175b:	6a 01                	push   $0x1
+    175d:	e8 3b 21 00 00       	call   389d <printf>
+        exit();
+    1762:	e8 b9 1f 00 00       	call   3720 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1767:	83 ec 04             	sub    $0x4,%esp
+    176a:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    176d:	50                   	push   %eax
+    176e:	68 15 42 00 00       	push   $0x4215
+    1773:	6a 01                	push   $0x1
+    1775:	e8 23 21 00 00       	call   389d <printf>
+        exit();
+    177a:	e8 a1 1f 00 00       	call   3720 <exit>
+    }
+  }
+  close(fd);
+    177f:	83 ec 0c             	sub    $0xc,%esp
+    1782:	53                   	push   %ebx
+    1783:	e8 c0 1f 00 00       	call   3748 <close>
+
+  if(n != 40){
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	83 fe 28             	cmp    $0x28,%esi
+    178e:	75 0a                	jne    179a <concreate+0x1d4>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1790:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1795:	e9 86 00 00 00       	jmp    1820 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    179a:	83 ec 08             	sub    $0x8,%esp
+    179d:	68 7c 4d 00 00       	push   $0x4d7c
+    17a2:	6a 01                	push   $0x1
+    17a4:	e8 f4 20 00 00       	call   389d <printf>
+    exit();
+    17a9:	e8 72 1f 00 00       	call   3720 <exit>
+    file[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    17ae:	83 ec 08             	sub    $0x8,%esp
+    17b1:	68 b5 4a 00 00       	push   $0x4ab5
+    17b6:	6a 01                	push   $0x1
+    17b8:	e8 e0 20 00 00       	call   389d <printf>
+      exit();
+    17bd:	e8 5e 1f 00 00       	call   3720 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    17c2:	83 ec 08             	sub    $0x8,%esp
+    17c5:	6a 00                	push   $0x0
+    17c7:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    17ca:	57                   	push   %edi
+    17cb:	e8 90 1f 00 00       	call   3760 <open>
+    17d0:	89 04 24             	mov    %eax,(%esp)
+    17d3:	e8 70 1f 00 00       	call   3748 <close>
+      close(open(file, 0));
+    17d8:	83 c4 08             	add    $0x8,%esp
+    17db:	6a 00                	push   $0x0
+    17dd:	57                   	push   %edi
+    17de:	e8 7d 1f 00 00       	call   3760 <open>
+    17e3:	89 04 24             	mov    %eax,(%esp)
+    17e6:	e8 5d 1f 00 00       	call   3748 <close>
+      close(open(file, 0));
+    17eb:	83 c4 08             	add    $0x8,%esp
+    17ee:	6a 00                	push   $0x0
+    17f0:	57                   	push   %edi
+    17f1:	e8 6a 1f 00 00       	call   3760 <open>
+    17f6:	89 04 24             	mov    %eax,(%esp)
+    17f9:	e8 4a 1f 00 00       	call   3748 <close>
+      close(open(file, 0));
+    17fe:	83 c4 08             	add    $0x8,%esp
+    1801:	6a 00                	push   $0x0
+    1803:	57                   	push   %edi
+    1804:	e8 57 1f 00 00       	call   3760 <open>
+    1809:	89 04 24             	mov    %eax,(%esp)
+    180c:	e8 37 1f 00 00       	call   3748 <close>
+    1811:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1814:	85 f6                	test   %esi,%esi
+    1816:	74 79                	je     1891 <concreate+0x2cb>
+      exit();
+    else
+      wait();
+    1818:	e8 0b 1f 00 00       	call   3728 <wait>
+  for(i = 0; i < 40; i++){
+    181d:	83 c3 01             	add    $0x1,%ebx
+    1820:	83 fb 27             	cmp    $0x27,%ebx
+    1823:	7f 71                	jg     1896 <concreate+0x2d0>
+    file[1] = '0' + i;
+    1825:	8d 43 30             	lea    0x30(%ebx),%eax
+    1828:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    182b:	e8 e8 1e 00 00       	call   3718 <fork>
+    1830:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    1832:	85 c0                	test   %eax,%eax
+    1834:	0f 88 74 ff ff ff    	js     17ae <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    183a:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    183f:	89 d8                	mov    %ebx,%eax
+    1841:	f7 ea                	imul   %edx
+    1843:	89 d8                	mov    %ebx,%eax
+    1845:	c1 f8 1f             	sar    $0x1f,%eax
+    1848:	29 c2                	sub    %eax,%edx
+    184a:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    184d:	89 da                	mov    %ebx,%edx
+    184f:	29 c2                	sub    %eax,%edx
+    1851:	89 d0                	mov    %edx,%eax
+    1853:	09 f0                	or     %esi,%eax
+    1855:	0f 84 67 ff ff ff    	je     17c2 <concreate+0x1fc>
+    185b:	83 fa 01             	cmp    $0x1,%edx
+    185e:	75 08                	jne    1868 <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    1860:	85 f6                	test   %esi,%esi
+    1862:	0f 85 5a ff ff ff    	jne    17c2 <concreate+0x1fc>
+      unlink(file);
+    1868:	83 ec 0c             	sub    $0xc,%esp
+    186b:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    186e:	57                   	push   %edi
+    186f:	e8 fc 1e 00 00       	call   3770 <unlink>
+      unlink(file);
+    1874:	89 3c 24             	mov    %edi,(%esp)
+    1877:	e8 f4 1e 00 00       	call   3770 <unlink>
+      unlink(file);
+    187c:	89 3c 24             	mov    %edi,(%esp)
+    187f:	e8 ec 1e 00 00       	call   3770 <unlink>
+      unlink(file);
+    1884:	89 3c 24             	mov    %edi,(%esp)
+    1887:	e8 e4 1e 00 00       	call   3770 <unlink>
+    188c:	83 c4 10             	add    $0x10,%esp
+    188f:	eb 83                	jmp    1814 <concreate+0x24e>
+      exit();
+    1891:	e8 8a 1e 00 00       	call   3720 <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    1896:	83 ec 08             	sub    $0x8,%esp
+    1899:	68 32 42 00 00       	push   $0x4232
+    189e:	6a 01                	push   $0x1
+    18a0:	e8 f8 1f 00 00       	call   389d <printf>
+}
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ab:	5b                   	pop    %ebx
+    18ac:	5e                   	pop    %esi
+    18ad:	5f                   	pop    %edi
+    18ae:	5d                   	pop    %ebp
+    18af:	c3                   	ret
+
+000018b0 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 14             	sub    $0x14,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    18b9:	68 40 42 00 00       	push   $0x4240
+    18be:	6a 01                	push   $0x1
+    18c0:	e8 d8 1f 00 00       	call   389d <printf>
+
+  unlink("x");
+    18c5:	c7 04 24 cd 44 00 00 	movl   $0x44cd,(%esp)
+    18cc:	e8 9f 1e 00 00       	call   3770 <unlink>
+  pid = fork();
+    18d1:	e8 42 1e 00 00       	call   3718 <fork>
+  if(pid < 0){
+    18d6:	83 c4 10             	add    $0x10,%esp
+    18d9:	85 c0                	test   %eax,%eax
+    18db:	78 10                	js     18ed <linkunlink+0x3d>
+    18dd:	89 c7                	mov    %eax,%edi
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    18df:	74 20                	je     1901 <linkunlink+0x51>
+    18e1:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18e6:	be 00 00 00 00       	mov    $0x0,%esi
+    18eb:	eb 3b                	jmp    1928 <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    18ed:	83 ec 08             	sub    $0x8,%esp
+    18f0:	68 b5 4a 00 00       	push   $0x4ab5
+    18f5:	6a 01                	push   $0x1
+    18f7:	e8 a1 1f 00 00       	call   389d <printf>
+    exit();
+    18fc:	e8 1f 1e 00 00       	call   3720 <exit>
+  unsigned int x = (pid ? 1 : 97);
+    1901:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1906:	eb de                	jmp    18e6 <linkunlink+0x36>
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+      close(open("x", O_RDWR | O_CREATE));
+    1908:	83 ec 08             	sub    $0x8,%esp
+    190b:	68 02 02 00 00       	push   $0x202
+    1910:	68 cd 44 00 00       	push   $0x44cd
+    1915:	e8 46 1e 00 00       	call   3760 <open>
+    191a:	89 04 24             	mov    %eax,(%esp)
+    191d:	e8 26 1e 00 00       	call   3748 <close>
+    1922:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1925:	83 c6 01             	add    $0x1,%esi
+    1928:	83 fe 63             	cmp    $0x63,%esi
+    192b:	7f 52                	jg     197f <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    192d:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    1933:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1939:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    193e:	89 d8                	mov    %ebx,%eax
+    1940:	f7 e2                	mul    %edx
+    1942:	89 d0                	mov    %edx,%eax
+    1944:	d1 e8                	shr    %eax
+    1946:	83 e2 fe             	and    $0xfffffffe,%edx
+    1949:	01 c2                	add    %eax,%edx
+    194b:	89 d8                	mov    %ebx,%eax
+    194d:	29 d0                	sub    %edx,%eax
+    194f:	74 b7                	je     1908 <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    1951:	83 f8 01             	cmp    $0x1,%eax
+    1954:	74 12                	je     1968 <linkunlink+0xb8>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    1956:	83 ec 0c             	sub    $0xc,%esp
+    1959:	68 cd 44 00 00       	push   $0x44cd
+    195e:	e8 0d 1e 00 00       	call   3770 <unlink>
+    1963:	83 c4 10             	add    $0x10,%esp
+    1966:	eb bd                	jmp    1925 <linkunlink+0x75>
+      link("cat", "x");
+    1968:	83 ec 08             	sub    $0x8,%esp
+    196b:	68 cd 44 00 00       	push   $0x44cd
+    1970:	68 51 42 00 00       	push   $0x4251
+    1975:	e8 06 1e 00 00       	call   3780 <link>
+    197a:	83 c4 10             	add    $0x10,%esp
+    197d:	eb a6                	jmp    1925 <linkunlink+0x75>
+    }
+  }
+
+  if(pid)
+    197f:	85 ff                	test   %edi,%edi
+    1981:	74 1c                	je     199f <linkunlink+0xef>
+    wait();
+    1983:	e8 a0 1d 00 00       	call   3728 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1988:	83 ec 08             	sub    $0x8,%esp
+    198b:	68 55 42 00 00       	push   $0x4255
+    1990:	6a 01                	push   $0x1
+    1992:	e8 06 1f 00 00       	call   389d <printf>
+}
+    1997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    199a:	5b                   	pop    %ebx
+    199b:	5e                   	pop    %esi
+    199c:	5f                   	pop    %edi
+    199d:	5d                   	pop    %ebp
+    199e:	c3                   	ret
+    exit();
+    199f:	e8 7c 1d 00 00       	call   3720 <exit>
+
+000019a4 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    19a4:	55                   	push   %ebp
+    19a5:	89 e5                	mov    %esp,%ebp
+    19a7:	53                   	push   %ebx
+    19a8:	83 ec 1c             	sub    $0x1c,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    19ab:	68 64 42 00 00       	push   $0x4264
+    19b0:	6a 01                	push   $0x1
+    19b2:	e8 e6 1e 00 00       	call   389d <printf>
+  unlink("bd");
+    19b7:	c7 04 24 71 42 00 00 	movl   $0x4271,(%esp)
+    19be:	e8 ad 1d 00 00       	call   3770 <unlink>
+
+  fd = open("bd", O_CREATE);
+    19c3:	83 c4 08             	add    $0x8,%esp
+    19c6:	68 00 02 00 00       	push   $0x200
+    19cb:	68 71 42 00 00       	push   $0x4271
+    19d0:	e8 8b 1d 00 00       	call   3760 <open>
+  if(fd < 0){
+    19d5:	83 c4 10             	add    $0x10,%esp
+    19d8:	85 c0                	test   %eax,%eax
+    19da:	78 65                	js     1a41 <bigdir+0x9d>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    19dc:	83 ec 0c             	sub    $0xc,%esp
+    19df:	50                   	push   %eax
+    19e0:	e8 63 1d 00 00       	call   3748 <close>
+
+  for(i = 0; i < 500; i++){
+    19e5:	83 c4 10             	add    $0x10,%esp
+    19e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    19ed:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    19f3:	7f 74                	jg     1a69 <bigdir+0xc5>
+    name[0] = 'x';
+    19f5:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    19f9:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    19fc:	85 db                	test   %ebx,%ebx
+    19fe:	0f 49 c3             	cmovns %ebx,%eax
+    1a01:	c1 f8 06             	sar    $0x6,%eax
+    1a04:	83 c0 30             	add    $0x30,%eax
+    1a07:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1a0a:	89 da                	mov    %ebx,%edx
+    1a0c:	c1 fa 1f             	sar    $0x1f,%edx
+    1a0f:	c1 ea 1a             	shr    $0x1a,%edx
+    1a12:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1a15:	83 e0 3f             	and    $0x3f,%eax
+    1a18:	29 d0                	sub    %edx,%eax
+    1a1a:	83 c0 30             	add    $0x30,%eax
+    1a1d:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1a20:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    1a24:	83 ec 08             	sub    $0x8,%esp
+    1a27:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1a2a:	50                   	push   %eax
+    1a2b:	68 71 42 00 00       	push   $0x4271
+    1a30:	e8 4b 1d 00 00       	call   3780 <link>
+    1a35:	83 c4 10             	add    $0x10,%esp
+    1a38:	85 c0                	test   %eax,%eax
+    1a3a:	75 19                	jne    1a55 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    1a3c:	83 c3 01             	add    $0x1,%ebx
+    1a3f:	eb ac                	jmp    19ed <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    1a41:	83 ec 08             	sub    $0x8,%esp
+    1a44:	68 74 42 00 00       	push   $0x4274
+    1a49:	6a 01                	push   $0x1
+    1a4b:	e8 4d 1e 00 00       	call   389d <printf>
+    exit();
+    1a50:	e8 cb 1c 00 00       	call   3720 <exit>
+      printf(1, "bigdir link failed\n");
+    1a55:	83 ec 08             	sub    $0x8,%esp
+    1a58:	68 8a 42 00 00       	push   $0x428a
+    1a5d:	6a 01                	push   $0x1
+    1a5f:	e8 39 1e 00 00       	call   389d <printf>
+      exit();
+    1a64:	e8 b7 1c 00 00       	call   3720 <exit>
+    }
+  }
+
+  unlink("bd");
+    1a69:	83 ec 0c             	sub    $0xc,%esp
+    1a6c:	68 71 42 00 00       	push   $0x4271
+    1a71:	e8 fa 1c 00 00       	call   3770 <unlink>
+  for(i = 0; i < 500; i++){
+    1a76:	83 c4 10             	add    $0x10,%esp
+    1a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1a7e:	eb 03                	jmp    1a83 <bigdir+0xdf>
+    1a80:	83 c3 01             	add    $0x1,%ebx
+    1a83:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1a89:	7f 56                	jg     1ae1 <bigdir+0x13d>
+    name[0] = 'x';
+    1a8b:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1a8f:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1a92:	85 db                	test   %ebx,%ebx
+    1a94:	0f 49 c3             	cmovns %ebx,%eax
+    1a97:	c1 f8 06             	sar    $0x6,%eax
+    1a9a:	83 c0 30             	add    $0x30,%eax
+    1a9d:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1aa0:	89 da                	mov    %ebx,%edx
+    1aa2:	c1 fa 1f             	sar    $0x1f,%edx
+    1aa5:	c1 ea 1a             	shr    $0x1a,%edx
+    1aa8:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1aab:	83 e0 3f             	and    $0x3f,%eax
+    1aae:	29 d0                	sub    %edx,%eax
+    1ab0:	83 c0 30             	add    $0x30,%eax
+    1ab3:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1ab6:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    1aba:	83 ec 0c             	sub    $0xc,%esp
+    1abd:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1ac0:	50                   	push   %eax
+    1ac1:	e8 aa 1c 00 00       	call   3770 <unlink>
+    1ac6:	83 c4 10             	add    $0x10,%esp
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	74 b3                	je     1a80 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    1acd:	83 ec 08             	sub    $0x8,%esp
+    1ad0:	68 9e 42 00 00       	push   $0x429e
+    1ad5:	6a 01                	push   $0x1
+    1ad7:	e8 c1 1d 00 00       	call   389d <printf>
+      exit();
+    1adc:	e8 3f 1c 00 00       	call   3720 <exit>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1ae1:	83 ec 08             	sub    $0x8,%esp
+    1ae4:	68 b3 42 00 00       	push   $0x42b3
+    1ae9:	6a 01                	push   $0x1
+    1aeb:	e8 ad 1d 00 00       	call   389d <printf>
+}
+    1af0:	83 c4 10             	add    $0x10,%esp
+    1af3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1af6:	c9                   	leave
+    1af7:	c3                   	ret
+
+00001af8 <subdir>:
+
+void
+subdir(void)
+{
+    1af8:	55                   	push   %ebp
+    1af9:	89 e5                	mov    %esp,%ebp
+    1afb:	53                   	push   %ebx
+    1afc:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1aff:	68 be 42 00 00       	push   $0x42be
+    1b04:	6a 01                	push   $0x1
+    1b06:	e8 92 1d 00 00       	call   389d <printf>
+
+  unlink("ff");
+    1b0b:	c7 04 24 47 43 00 00 	movl   $0x4347,(%esp)
+    1b12:	e8 59 1c 00 00       	call   3770 <unlink>
+  if(mkdir("dd") != 0){
+    1b17:	c7 04 24 e4 43 00 00 	movl   $0x43e4,(%esp)
+    1b1e:	e8 65 1c 00 00       	call   3788 <mkdir>
+    1b23:	83 c4 10             	add    $0x10,%esp
+    1b26:	85 c0                	test   %eax,%eax
+    1b28:	0f 85 14 04 00 00    	jne    1f42 <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1b2e:	83 ec 08             	sub    $0x8,%esp
+    1b31:	68 02 02 00 00       	push   $0x202
+    1b36:	68 1d 43 00 00       	push   $0x431d
+    1b3b:	e8 20 1c 00 00       	call   3760 <open>
+    1b40:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1b42:	83 c4 10             	add    $0x10,%esp
+    1b45:	85 c0                	test   %eax,%eax
+    1b47:	0f 88 09 04 00 00    	js     1f56 <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1b4d:	83 ec 04             	sub    $0x4,%esp
+    1b50:	6a 02                	push   $0x2
+    1b52:	68 47 43 00 00       	push   $0x4347
+    1b57:	50                   	push   %eax
+    1b58:	e8 e3 1b 00 00       	call   3740 <write>
+  close(fd);
+    1b5d:	89 1c 24             	mov    %ebx,(%esp)
+    1b60:	e8 e3 1b 00 00       	call   3748 <close>
+
+  if(unlink("dd") >= 0){
+    1b65:	c7 04 24 e4 43 00 00 	movl   $0x43e4,(%esp)
+    1b6c:	e8 ff 1b 00 00       	call   3770 <unlink>
+    1b71:	83 c4 10             	add    $0x10,%esp
+    1b74:	85 c0                	test   %eax,%eax
+    1b76:	0f 89 ee 03 00 00    	jns    1f6a <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1b7c:	83 ec 0c             	sub    $0xc,%esp
+    1b7f:	68 f8 42 00 00       	push   $0x42f8
+    1b84:	e8 ff 1b 00 00       	call   3788 <mkdir>
+    1b89:	83 c4 10             	add    $0x10,%esp
+    1b8c:	85 c0                	test   %eax,%eax
+    1b8e:	0f 85 ea 03 00 00    	jne    1f7e <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1b94:	83 ec 08             	sub    $0x8,%esp
+    1b97:	68 02 02 00 00       	push   $0x202
+    1b9c:	68 1a 43 00 00       	push   $0x431a
+    1ba1:	e8 ba 1b 00 00       	call   3760 <open>
+    1ba6:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ba8:	83 c4 10             	add    $0x10,%esp
+    1bab:	85 c0                	test   %eax,%eax
+    1bad:	0f 88 df 03 00 00    	js     1f92 <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1bb3:	83 ec 04             	sub    $0x4,%esp
+    1bb6:	6a 02                	push   $0x2
+    1bb8:	68 3b 43 00 00       	push   $0x433b
+    1bbd:	50                   	push   %eax
+    1bbe:	e8 7d 1b 00 00       	call   3740 <write>
+  close(fd);
+    1bc3:	89 1c 24             	mov    %ebx,(%esp)
+    1bc6:	e8 7d 1b 00 00       	call   3748 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    1bcb:	83 c4 08             	add    $0x8,%esp
+    1bce:	6a 00                	push   $0x0
+    1bd0:	68 3e 43 00 00       	push   $0x433e
+    1bd5:	e8 86 1b 00 00       	call   3760 <open>
+    1bda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bdc:	83 c4 10             	add    $0x10,%esp
+    1bdf:	85 c0                	test   %eax,%eax
+    1be1:	0f 88 bf 03 00 00    	js     1fa6 <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    1be7:	83 ec 04             	sub    $0x4,%esp
+    1bea:	68 00 20 00 00       	push   $0x2000
+    1bef:	68 c0 7a 00 00       	push   $0x7ac0
+    1bf4:	50                   	push   %eax
+    1bf5:	e8 3e 1b 00 00       	call   3738 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1bfa:	83 c4 10             	add    $0x10,%esp
+    1bfd:	83 f8 02             	cmp    $0x2,%eax
+    1c00:	0f 85 b4 03 00 00    	jne    1fba <subdir+0x4c2>
+    1c06:	80 3d c0 7a 00 00 66 	cmpb   $0x66,0x7ac0
+    1c0d:	0f 85 a7 03 00 00    	jne    1fba <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    1c13:	83 ec 0c             	sub    $0xc,%esp
+    1c16:	53                   	push   %ebx
+    1c17:	e8 2c 1b 00 00       	call   3748 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1c1c:	83 c4 08             	add    $0x8,%esp
+    1c1f:	68 7e 43 00 00       	push   $0x437e
+    1c24:	68 1a 43 00 00       	push   $0x431a
+    1c29:	e8 52 1b 00 00       	call   3780 <link>
+    1c2e:	83 c4 10             	add    $0x10,%esp
+    1c31:	85 c0                	test   %eax,%eax
+    1c33:	0f 85 95 03 00 00    	jne    1fce <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    1c39:	83 ec 0c             	sub    $0xc,%esp
+    1c3c:	68 1a 43 00 00       	push   $0x431a
+    1c41:	e8 2a 1b 00 00       	call   3770 <unlink>
+    1c46:	83 c4 10             	add    $0x10,%esp
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	0f 85 91 03 00 00    	jne    1fe2 <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1c51:	83 ec 08             	sub    $0x8,%esp
+    1c54:	6a 00                	push   $0x0
+    1c56:	68 1a 43 00 00       	push   $0x431a
+    1c5b:	e8 00 1b 00 00       	call   3760 <open>
+    1c60:	83 c4 10             	add    $0x10,%esp
+    1c63:	85 c0                	test   %eax,%eax
+    1c65:	0f 89 8b 03 00 00    	jns    1ff6 <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    1c6b:	83 ec 0c             	sub    $0xc,%esp
+    1c6e:	68 e4 43 00 00       	push   $0x43e4
+    1c73:	e8 18 1b 00 00       	call   3790 <chdir>
+    1c78:	83 c4 10             	add    $0x10,%esp
+    1c7b:	85 c0                	test   %eax,%eax
+    1c7d:	0f 85 87 03 00 00    	jne    200a <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    1c83:	83 ec 0c             	sub    $0xc,%esp
+    1c86:	68 b2 43 00 00       	push   $0x43b2
+    1c8b:	e8 00 1b 00 00       	call   3790 <chdir>
+    1c90:	83 c4 10             	add    $0x10,%esp
+    1c93:	85 c0                	test   %eax,%eax
+    1c95:	0f 85 83 03 00 00    	jne    201e <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    1c9b:	83 ec 0c             	sub    $0xc,%esp
+    1c9e:	68 d8 43 00 00       	push   $0x43d8
+    1ca3:	e8 e8 1a 00 00       	call   3790 <chdir>
+    1ca8:	83 c4 10             	add    $0x10,%esp
+    1cab:	85 c0                	test   %eax,%eax
+    1cad:	0f 85 7f 03 00 00    	jne    2032 <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    1cb3:	83 ec 0c             	sub    $0xc,%esp
+    1cb6:	68 e7 43 00 00       	push   $0x43e7
+    1cbb:	e8 d0 1a 00 00       	call   3790 <chdir>
+    1cc0:	83 c4 10             	add    $0x10,%esp
+    1cc3:	85 c0                	test   %eax,%eax
+    1cc5:	0f 85 7b 03 00 00    	jne    2046 <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    1ccb:	83 ec 08             	sub    $0x8,%esp
+    1cce:	6a 00                	push   $0x0
+    1cd0:	68 7e 43 00 00       	push   $0x437e
+    1cd5:	e8 86 1a 00 00       	call   3760 <open>
+    1cda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1cdc:	83 c4 10             	add    $0x10,%esp
+    1cdf:	85 c0                	test   %eax,%eax
+    1ce1:	0f 88 73 03 00 00    	js     205a <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1ce7:	83 ec 04             	sub    $0x4,%esp
+    1cea:	68 00 20 00 00       	push   $0x2000
+    1cef:	68 c0 7a 00 00       	push   $0x7ac0
+    1cf4:	50                   	push   %eax
+    1cf5:	e8 3e 1a 00 00       	call   3738 <read>
+    1cfa:	83 c4 10             	add    $0x10,%esp
+    1cfd:	83 f8 02             	cmp    $0x2,%eax
+    1d00:	0f 85 68 03 00 00    	jne    206e <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    1d06:	83 ec 0c             	sub    $0xc,%esp
+    1d09:	53                   	push   %ebx
+    1d0a:	e8 39 1a 00 00       	call   3748 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d0f:	83 c4 08             	add    $0x8,%esp
+    1d12:	6a 00                	push   $0x0
+    1d14:	68 1a 43 00 00       	push   $0x431a
+    1d19:	e8 42 1a 00 00       	call   3760 <open>
+    1d1e:	83 c4 10             	add    $0x10,%esp
+    1d21:	85 c0                	test   %eax,%eax
+    1d23:	0f 89 59 03 00 00    	jns    2082 <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1d29:	83 ec 08             	sub    $0x8,%esp
+    1d2c:	68 02 02 00 00       	push   $0x202
+    1d31:	68 32 44 00 00       	push   $0x4432
+    1d36:	e8 25 1a 00 00       	call   3760 <open>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	85 c0                	test   %eax,%eax
+    1d40:	0f 89 50 03 00 00    	jns    2096 <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1d46:	83 ec 08             	sub    $0x8,%esp
+    1d49:	68 02 02 00 00       	push   $0x202
+    1d4e:	68 57 44 00 00       	push   $0x4457
+    1d53:	e8 08 1a 00 00       	call   3760 <open>
+    1d58:	83 c4 10             	add    $0x10,%esp
+    1d5b:	85 c0                	test   %eax,%eax
+    1d5d:	0f 89 47 03 00 00    	jns    20aa <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    1d63:	83 ec 08             	sub    $0x8,%esp
+    1d66:	68 00 02 00 00       	push   $0x200
+    1d6b:	68 e4 43 00 00       	push   $0x43e4
+    1d70:	e8 eb 19 00 00       	call   3760 <open>
+    1d75:	83 c4 10             	add    $0x10,%esp
+    1d78:	85 c0                	test   %eax,%eax
+    1d7a:	0f 89 3e 03 00 00    	jns    20be <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    1d80:	83 ec 08             	sub    $0x8,%esp
+    1d83:	6a 02                	push   $0x2
+    1d85:	68 e4 43 00 00       	push   $0x43e4
+    1d8a:	e8 d1 19 00 00       	call   3760 <open>
+    1d8f:	83 c4 10             	add    $0x10,%esp
+    1d92:	85 c0                	test   %eax,%eax
+    1d94:	0f 89 38 03 00 00    	jns    20d2 <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    1d9a:	83 ec 08             	sub    $0x8,%esp
+    1d9d:	6a 01                	push   $0x1
+    1d9f:	68 e4 43 00 00       	push   $0x43e4
+    1da4:	e8 b7 19 00 00       	call   3760 <open>
+    1da9:	83 c4 10             	add    $0x10,%esp
+    1dac:	85 c0                	test   %eax,%eax
+    1dae:	0f 89 32 03 00 00    	jns    20e6 <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1db4:	83 ec 08             	sub    $0x8,%esp
+    1db7:	68 c6 44 00 00       	push   $0x44c6
+    1dbc:	68 32 44 00 00       	push   $0x4432
+    1dc1:	e8 ba 19 00 00       	call   3780 <link>
+    1dc6:	83 c4 10             	add    $0x10,%esp
+    1dc9:	85 c0                	test   %eax,%eax
+    1dcb:	0f 84 29 03 00 00    	je     20fa <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1dd1:	83 ec 08             	sub    $0x8,%esp
+    1dd4:	68 c6 44 00 00       	push   $0x44c6
+    1dd9:	68 57 44 00 00       	push   $0x4457
+    1dde:	e8 9d 19 00 00       	call   3780 <link>
+    1de3:	83 c4 10             	add    $0x10,%esp
+    1de6:	85 c0                	test   %eax,%eax
+    1de8:	0f 84 20 03 00 00    	je     210e <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1dee:	83 ec 08             	sub    $0x8,%esp
+    1df1:	68 7e 43 00 00       	push   $0x437e
+    1df6:	68 1d 43 00 00       	push   $0x431d
+    1dfb:	e8 80 19 00 00       	call   3780 <link>
+    1e00:	83 c4 10             	add    $0x10,%esp
+    1e03:	85 c0                	test   %eax,%eax
+    1e05:	0f 84 17 03 00 00    	je     2122 <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    1e0b:	83 ec 0c             	sub    $0xc,%esp
+    1e0e:	68 32 44 00 00       	push   $0x4432
+    1e13:	e8 70 19 00 00       	call   3788 <mkdir>
+    1e18:	83 c4 10             	add    $0x10,%esp
+    1e1b:	85 c0                	test   %eax,%eax
+    1e1d:	0f 84 13 03 00 00    	je     2136 <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    1e23:	83 ec 0c             	sub    $0xc,%esp
+    1e26:	68 57 44 00 00       	push   $0x4457
+    1e2b:	e8 58 19 00 00       	call   3788 <mkdir>
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	85 c0                	test   %eax,%eax
+    1e35:	0f 84 0f 03 00 00    	je     214a <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    1e3b:	83 ec 0c             	sub    $0xc,%esp
+    1e3e:	68 7e 43 00 00       	push   $0x437e
+    1e43:	e8 40 19 00 00       	call   3788 <mkdir>
+    1e48:	83 c4 10             	add    $0x10,%esp
+    1e4b:	85 c0                	test   %eax,%eax
+    1e4d:	0f 84 0b 03 00 00    	je     215e <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    1e53:	83 ec 0c             	sub    $0xc,%esp
+    1e56:	68 57 44 00 00       	push   $0x4457
+    1e5b:	e8 10 19 00 00       	call   3770 <unlink>
+    1e60:	83 c4 10             	add    $0x10,%esp
+    1e63:	85 c0                	test   %eax,%eax
+    1e65:	0f 84 07 03 00 00    	je     2172 <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    1e6b:	83 ec 0c             	sub    $0xc,%esp
+    1e6e:	68 32 44 00 00       	push   $0x4432
+    1e73:	e8 f8 18 00 00       	call   3770 <unlink>
+    1e78:	83 c4 10             	add    $0x10,%esp
+    1e7b:	85 c0                	test   %eax,%eax
+    1e7d:	0f 84 03 03 00 00    	je     2186 <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    1e83:	83 ec 0c             	sub    $0xc,%esp
+    1e86:	68 1d 43 00 00       	push   $0x431d
+    1e8b:	e8 00 19 00 00       	call   3790 <chdir>
+    1e90:	83 c4 10             	add    $0x10,%esp
+    1e93:	85 c0                	test   %eax,%eax
+    1e95:	0f 84 ff 02 00 00    	je     219a <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    1e9b:	83 ec 0c             	sub    $0xc,%esp
+    1e9e:	68 c9 44 00 00       	push   $0x44c9
+    1ea3:	e8 e8 18 00 00       	call   3790 <chdir>
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	85 c0                	test   %eax,%eax
+    1ead:	0f 84 fb 02 00 00    	je     21ae <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    1eb3:	83 ec 0c             	sub    $0xc,%esp
+    1eb6:	68 7e 43 00 00       	push   $0x437e
+    1ebb:	e8 b0 18 00 00       	call   3770 <unlink>
+    1ec0:	83 c4 10             	add    $0x10,%esp
+    1ec3:	85 c0                	test   %eax,%eax
+    1ec5:	0f 85 f7 02 00 00    	jne    21c2 <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    1ecb:	83 ec 0c             	sub    $0xc,%esp
+    1ece:	68 1d 43 00 00       	push   $0x431d
+    1ed3:	e8 98 18 00 00       	call   3770 <unlink>
+    1ed8:	83 c4 10             	add    $0x10,%esp
+    1edb:	85 c0                	test   %eax,%eax
+    1edd:	0f 85 f3 02 00 00    	jne    21d6 <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	68 e4 43 00 00       	push   $0x43e4
+    1eeb:	e8 80 18 00 00       	call   3770 <unlink>
+    1ef0:	83 c4 10             	add    $0x10,%esp
+    1ef3:	85 c0                	test   %eax,%eax
+    1ef5:	0f 84 ef 02 00 00    	je     21ea <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    1efb:	83 ec 0c             	sub    $0xc,%esp
+    1efe:	68 f9 42 00 00       	push   $0x42f9
+    1f03:	e8 68 18 00 00       	call   3770 <unlink>
+    1f08:	83 c4 10             	add    $0x10,%esp
+    1f0b:	85 c0                	test   %eax,%eax
+    1f0d:	0f 88 eb 02 00 00    	js     21fe <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    1f13:	83 ec 0c             	sub    $0xc,%esp
+    1f16:	68 e4 43 00 00       	push   $0x43e4
+    1f1b:	e8 50 18 00 00       	call   3770 <unlink>
+    1f20:	83 c4 10             	add    $0x10,%esp
+    1f23:	85 c0                	test   %eax,%eax
+    1f25:	0f 88 e7 02 00 00    	js     2212 <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    1f2b:	83 ec 08             	sub    $0x8,%esp
+    1f2e:	68 c6 45 00 00       	push   $0x45c6
+    1f33:	6a 01                	push   $0x1
+    1f35:	e8 63 19 00 00       	call   389d <printf>
+}
+    1f3a:	83 c4 10             	add    $0x10,%esp
+    1f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f40:	c9                   	leave
+    1f41:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    1f42:	83 ec 08             	sub    $0x8,%esp
+    1f45:	68 cb 42 00 00       	push   $0x42cb
+    1f4a:	6a 01                	push   $0x1
+    1f4c:	e8 4c 19 00 00       	call   389d <printf>
+    exit();
+    1f51:	e8 ca 17 00 00       	call   3720 <exit>
+    printf(1, "create dd/ff failed\n");
+    1f56:	83 ec 08             	sub    $0x8,%esp
+    1f59:	68 e3 42 00 00       	push   $0x42e3
+    1f5e:	6a 01                	push   $0x1
+    1f60:	e8 38 19 00 00       	call   389d <printf>
+    exit();
+    1f65:	e8 b6 17 00 00       	call   3720 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1f6a:	83 ec 08             	sub    $0x8,%esp
+    1f6d:	68 b0 4d 00 00       	push   $0x4db0
+    1f72:	6a 01                	push   $0x1
+    1f74:	e8 24 19 00 00       	call   389d <printf>
+    exit();
+    1f79:	e8 a2 17 00 00       	call   3720 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    1f7e:	83 ec 08             	sub    $0x8,%esp
+    1f81:	68 ff 42 00 00       	push   $0x42ff
+    1f86:	6a 01                	push   $0x1
+    1f88:	e8 10 19 00 00       	call   389d <printf>
+    exit();
+    1f8d:	e8 8e 17 00 00       	call   3720 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    1f92:	83 ec 08             	sub    $0x8,%esp
+    1f95:	68 23 43 00 00       	push   $0x4323
+    1f9a:	6a 01                	push   $0x1
+    1f9c:	e8 fc 18 00 00       	call   389d <printf>
+    exit();
+    1fa1:	e8 7a 17 00 00       	call   3720 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    1fa6:	83 ec 08             	sub    $0x8,%esp
+    1fa9:	68 4a 43 00 00       	push   $0x434a
+    1fae:	6a 01                	push   $0x1
+    1fb0:	e8 e8 18 00 00       	call   389d <printf>
+    exit();
+    1fb5:	e8 66 17 00 00       	call   3720 <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    1fba:	83 ec 08             	sub    $0x8,%esp
+    1fbd:	68 63 43 00 00       	push   $0x4363
+    1fc2:	6a 01                	push   $0x1
+    1fc4:	e8 d4 18 00 00       	call   389d <printf>
+    exit();
+    1fc9:	e8 52 17 00 00       	call   3720 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    1fce:	83 ec 08             	sub    $0x8,%esp
+    1fd1:	68 d8 4d 00 00       	push   $0x4dd8
+    1fd6:	6a 01                	push   $0x1
+    1fd8:	e8 c0 18 00 00       	call   389d <printf>
+    exit();
+    1fdd:	e8 3e 17 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    1fe2:	83 ec 08             	sub    $0x8,%esp
+    1fe5:	68 89 43 00 00       	push   $0x4389
+    1fea:	6a 01                	push   $0x1
+    1fec:	e8 ac 18 00 00       	call   389d <printf>
+    exit();
+    1ff1:	e8 2a 17 00 00       	call   3720 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    1ff6:	83 ec 08             	sub    $0x8,%esp
+    1ff9:	68 fc 4d 00 00       	push   $0x4dfc
+    1ffe:	6a 01                	push   $0x1
+    2000:	e8 98 18 00 00       	call   389d <printf>
+    exit();
+    2005:	e8 16 17 00 00       	call   3720 <exit>
+    printf(1, "chdir dd failed\n");
+    200a:	83 ec 08             	sub    $0x8,%esp
+    200d:	68 a1 43 00 00       	push   $0x43a1
+    2012:	6a 01                	push   $0x1
+    2014:	e8 84 18 00 00       	call   389d <printf>
+    exit();
+    2019:	e8 02 17 00 00       	call   3720 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    201e:	83 ec 08             	sub    $0x8,%esp
+    2021:	68 be 43 00 00       	push   $0x43be
+    2026:	6a 01                	push   $0x1
+    2028:	e8 70 18 00 00       	call   389d <printf>
+    exit();
+    202d:	e8 ee 16 00 00       	call   3720 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2032:	83 ec 08             	sub    $0x8,%esp
+    2035:	68 be 43 00 00       	push   $0x43be
+    203a:	6a 01                	push   $0x1
+    203c:	e8 5c 18 00 00       	call   389d <printf>
+    exit();
+    2041:	e8 da 16 00 00       	call   3720 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2046:	83 ec 08             	sub    $0x8,%esp
+    2049:	68 ec 43 00 00       	push   $0x43ec
+    204e:	6a 01                	push   $0x1
+    2050:	e8 48 18 00 00       	call   389d <printf>
+    exit();
+    2055:	e8 c6 16 00 00       	call   3720 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    205a:	83 ec 08             	sub    $0x8,%esp
+    205d:	68 ff 43 00 00       	push   $0x43ff
+    2062:	6a 01                	push   $0x1
+    2064:	e8 34 18 00 00       	call   389d <printf>
+    exit();
+    2069:	e8 b2 16 00 00       	call   3720 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    206e:	83 ec 08             	sub    $0x8,%esp
+    2071:	68 17 44 00 00       	push   $0x4417
+    2076:	6a 01                	push   $0x1
+    2078:	e8 20 18 00 00       	call   389d <printf>
+    exit();
+    207d:	e8 9e 16 00 00       	call   3720 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2082:	83 ec 08             	sub    $0x8,%esp
+    2085:	68 20 4e 00 00       	push   $0x4e20
+    208a:	6a 01                	push   $0x1
+    208c:	e8 0c 18 00 00       	call   389d <printf>
+    exit();
+    2091:	e8 8a 16 00 00       	call   3720 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2096:	83 ec 08             	sub    $0x8,%esp
+    2099:	68 3b 44 00 00       	push   $0x443b
+    209e:	6a 01                	push   $0x1
+    20a0:	e8 f8 17 00 00       	call   389d <printf>
+    exit();
+    20a5:	e8 76 16 00 00       	call   3720 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    20aa:	83 ec 08             	sub    $0x8,%esp
+    20ad:	68 60 44 00 00       	push   $0x4460
+    20b2:	6a 01                	push   $0x1
+    20b4:	e8 e4 17 00 00       	call   389d <printf>
+    exit();
+    20b9:	e8 62 16 00 00       	call   3720 <exit>
+    printf(1, "create dd succeeded!\n");
+    20be:	83 ec 08             	sub    $0x8,%esp
+    20c1:	68 7c 44 00 00       	push   $0x447c
+    20c6:	6a 01                	push   $0x1
+    20c8:	e8 d0 17 00 00       	call   389d <printf>
+    exit();
+    20cd:	e8 4e 16 00 00       	call   3720 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    20d2:	83 ec 08             	sub    $0x8,%esp
+    20d5:	68 92 44 00 00       	push   $0x4492
+    20da:	6a 01                	push   $0x1
+    20dc:	e8 bc 17 00 00       	call   389d <printf>
+    exit();
+    20e1:	e8 3a 16 00 00       	call   3720 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    20e6:	83 ec 08             	sub    $0x8,%esp
+    20e9:	68 ab 44 00 00       	push   $0x44ab
+    20ee:	6a 01                	push   $0x1
+    20f0:	e8 a8 17 00 00       	call   389d <printf>
+    exit();
+    20f5:	e8 26 16 00 00       	call   3720 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    20fa:	83 ec 08             	sub    $0x8,%esp
+    20fd:	68 48 4e 00 00       	push   $0x4e48
+    2102:	6a 01                	push   $0x1
+    2104:	e8 94 17 00 00       	call   389d <printf>
+    exit();
+    2109:	e8 12 16 00 00       	call   3720 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    210e:	83 ec 08             	sub    $0x8,%esp
+    2111:	68 6c 4e 00 00       	push   $0x4e6c
+    2116:	6a 01                	push   $0x1
+    2118:	e8 80 17 00 00       	call   389d <printf>
+    exit();
+    211d:	e8 fe 15 00 00       	call   3720 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2122:	83 ec 08             	sub    $0x8,%esp
+    2125:	68 90 4e 00 00       	push   $0x4e90
+    212a:	6a 01                	push   $0x1
+    212c:	e8 6c 17 00 00       	call   389d <printf>
+    exit();
+    2131:	e8 ea 15 00 00       	call   3720 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2136:	83 ec 08             	sub    $0x8,%esp
+    2139:	68 cf 44 00 00       	push   $0x44cf
+    213e:	6a 01                	push   $0x1
+    2140:	e8 58 17 00 00       	call   389d <printf>
+    exit();
+    2145:	e8 d6 15 00 00       	call   3720 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    214a:	83 ec 08             	sub    $0x8,%esp
+    214d:	68 ea 44 00 00       	push   $0x44ea
+    2152:	6a 01                	push   $0x1
+    2154:	e8 44 17 00 00       	call   389d <printf>
+    exit();
+    2159:	e8 c2 15 00 00       	call   3720 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    215e:	83 ec 08             	sub    $0x8,%esp
+    2161:	68 05 45 00 00       	push   $0x4505
+    2166:	6a 01                	push   $0x1
+    2168:	e8 30 17 00 00       	call   389d <printf>
+    exit();
+    216d:	e8 ae 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2172:	83 ec 08             	sub    $0x8,%esp
+    2175:	68 22 45 00 00       	push   $0x4522
+    217a:	6a 01                	push   $0x1
+    217c:	e8 1c 17 00 00       	call   389d <printf>
+    exit();
+    2181:	e8 9a 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2186:	83 ec 08             	sub    $0x8,%esp
+    2189:	68 3e 45 00 00       	push   $0x453e
+    218e:	6a 01                	push   $0x1
+    2190:	e8 08 17 00 00       	call   389d <printf>
+    exit();
+    2195:	e8 86 15 00 00       	call   3720 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    219a:	83 ec 08             	sub    $0x8,%esp
+    219d:	68 5a 45 00 00       	push   $0x455a
+    21a2:	6a 01                	push   $0x1
+    21a4:	e8 f4 16 00 00       	call   389d <printf>
+    exit();
+    21a9:	e8 72 15 00 00       	call   3720 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    21ae:	83 ec 08             	sub    $0x8,%esp
+    21b1:	68 72 45 00 00       	push   $0x4572
+    21b6:	6a 01                	push   $0x1
+    21b8:	e8 e0 16 00 00       	call   389d <printf>
+    exit();
+    21bd:	e8 5e 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    21c5:	68 89 43 00 00       	push   $0x4389
+    21ca:	6a 01                	push   $0x1
+    21cc:	e8 cc 16 00 00       	call   389d <printf>
+    exit();
+    21d1:	e8 4a 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    21d6:	83 ec 08             	sub    $0x8,%esp
+    21d9:	68 8a 45 00 00       	push   $0x458a
+    21de:	6a 01                	push   $0x1
+    21e0:	e8 b8 16 00 00       	call   389d <printf>
+    exit();
+    21e5:	e8 36 15 00 00       	call   3720 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    21ea:	83 ec 08             	sub    $0x8,%esp
+    21ed:	68 b4 4e 00 00       	push   $0x4eb4
+    21f2:	6a 01                	push   $0x1
+    21f4:	e8 a4 16 00 00       	call   389d <printf>
+    exit();
+    21f9:	e8 22 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    21fe:	83 ec 08             	sub    $0x8,%esp
+    2201:	68 9f 45 00 00       	push   $0x459f
+    2206:	6a 01                	push   $0x1
+    2208:	e8 90 16 00 00       	call   389d <printf>
+    exit();
+    220d:	e8 0e 15 00 00       	call   3720 <exit>
+    printf(1, "unlink dd failed\n");
+    2212:	83 ec 08             	sub    $0x8,%esp
+    2215:	68 b4 45 00 00       	push   $0x45b4
+    221a:	6a 01                	push   $0x1
+    221c:	e8 7c 16 00 00       	call   389d <printf>
+    exit();
+    2221:	e8 fa 14 00 00       	call   3720 <exit>
+
+00002226 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2226:	55                   	push   %ebp
+    2227:	89 e5                	mov    %esp,%ebp
+    2229:	57                   	push   %edi
+    222a:	56                   	push   %esi
+    222b:	53                   	push   %ebx
+    222c:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    222f:	68 d1 45 00 00       	push   $0x45d1
+    2234:	6a 01                	push   $0x1
+    2236:	e8 62 16 00 00       	call   389d <printf>
+
+  unlink("bigwrite");
+    223b:	c7 04 24 e0 45 00 00 	movl   $0x45e0,(%esp)
+    2242:	e8 29 15 00 00       	call   3770 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2247:	83 c4 10             	add    $0x10,%esp
+    224a:	be f3 01 00 00       	mov    $0x1f3,%esi
+    224f:	eb 45                	jmp    2296 <bigwrite+0x70>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "cannot create bigwrite\n");
+    2251:	83 ec 08             	sub    $0x8,%esp
+    2254:	68 e9 45 00 00       	push   $0x45e9
+    2259:	6a 01                	push   $0x1
+    225b:	e8 3d 16 00 00       	call   389d <printf>
+      exit();
+    2260:	e8 bb 14 00 00       	call   3720 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+      if(cc != sz){
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2265:	50                   	push   %eax
+    2266:	56                   	push   %esi
+    2267:	68 01 46 00 00       	push   $0x4601
+    226c:	6a 01                	push   $0x1
+    226e:	e8 2a 16 00 00       	call   389d <printf>
+        exit();
+    2273:	e8 a8 14 00 00       	call   3720 <exit>
+      }
+    }
+    close(fd);
+    2278:	83 ec 0c             	sub    $0xc,%esp
+    227b:	57                   	push   %edi
+    227c:	e8 c7 14 00 00       	call   3748 <close>
+    unlink("bigwrite");
+    2281:	c7 04 24 e0 45 00 00 	movl   $0x45e0,(%esp)
+    2288:	e8 e3 14 00 00       	call   3770 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    228d:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+    2293:	83 c4 10             	add    $0x10,%esp
+    2296:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+    229c:	7f 40                	jg     22de <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    229e:	83 ec 08             	sub    $0x8,%esp
+    22a1:	68 02 02 00 00       	push   $0x202
+    22a6:	68 e0 45 00 00       	push   $0x45e0
+    22ab:	e8 b0 14 00 00       	call   3760 <open>
+    22b0:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    22b2:	83 c4 10             	add    $0x10,%esp
+    22b5:	85 c0                	test   %eax,%eax
+    22b7:	78 98                	js     2251 <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+    22b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    22be:	83 fb 01             	cmp    $0x1,%ebx
+    22c1:	7f b5                	jg     2278 <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+    22c3:	83 ec 04             	sub    $0x4,%esp
+    22c6:	56                   	push   %esi
+    22c7:	68 c0 7a 00 00       	push   $0x7ac0
+    22cc:	57                   	push   %edi
+    22cd:	e8 6e 14 00 00       	call   3740 <write>
+      if(cc != sz){
+    22d2:	83 c4 10             	add    $0x10,%esp
+    22d5:	39 c6                	cmp    %eax,%esi
+    22d7:	75 8c                	jne    2265 <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+    22d9:	83 c3 01             	add    $0x1,%ebx
+    22dc:	eb e0                	jmp    22be <bigwrite+0x98>
+  }
+
+  printf(1, "bigwrite ok\n");
+    22de:	83 ec 08             	sub    $0x8,%esp
+    22e1:	68 13 46 00 00       	push   $0x4613
+    22e6:	6a 01                	push   $0x1
+    22e8:	e8 b0 15 00 00       	call   389d <printf>
+}
+    22ed:	83 c4 10             	add    $0x10,%esp
+    22f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22f3:	5b                   	pop    %ebx
+    22f4:	5e                   	pop    %esi
+    22f5:	5f                   	pop    %edi
+    22f6:	5d                   	pop    %ebp
+    22f7:	c3                   	ret
+
+000022f8 <bigfile>:
+
+void
+bigfile(void)
+{
+    22f8:	55                   	push   %ebp
+    22f9:	89 e5                	mov    %esp,%ebp
+    22fb:	57                   	push   %edi
+    22fc:	56                   	push   %esi
+    22fd:	53                   	push   %ebx
+    22fe:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2301:	68 20 46 00 00       	push   $0x4620
+    2306:	6a 01                	push   $0x1
+    2308:	e8 90 15 00 00       	call   389d <printf>
+
+  unlink("bigfile");
+    230d:	c7 04 24 3c 46 00 00 	movl   $0x463c,(%esp)
+    2314:	e8 57 14 00 00       	call   3770 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2319:	83 c4 08             	add    $0x8,%esp
+    231c:	68 02 02 00 00       	push   $0x202
+    2321:	68 3c 46 00 00       	push   $0x463c
+    2326:	e8 35 14 00 00       	call   3760 <open>
+  if(fd < 0){
+    232b:	83 c4 10             	add    $0x10,%esp
+    232e:	85 c0                	test   %eax,%eax
+    2330:	78 41                	js     2373 <bigfile+0x7b>
+    2332:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    2334:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2339:	83 fb 13             	cmp    $0x13,%ebx
+    233c:	7f 5d                	jg     239b <bigfile+0xa3>
+    memset(buf, i, 600);
+    233e:	83 ec 04             	sub    $0x4,%esp
+    2341:	68 58 02 00 00       	push   $0x258
+    2346:	53                   	push   %ebx
+    2347:	68 c0 7a 00 00       	push   $0x7ac0
+    234c:	e8 94 12 00 00       	call   35e5 <memset>
+    if(write(fd, buf, 600) != 600){
+    2351:	83 c4 0c             	add    $0xc,%esp
+    2354:	68 58 02 00 00       	push   $0x258
+    2359:	68 c0 7a 00 00       	push   $0x7ac0
+    235e:	56                   	push   %esi
+    235f:	e8 dc 13 00 00       	call   3740 <write>
+    2364:	83 c4 10             	add    $0x10,%esp
+    2367:	3d 58 02 00 00       	cmp    $0x258,%eax
+    236c:	75 19                	jne    2387 <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    236e:	83 c3 01             	add    $0x1,%ebx
+    2371:	eb c6                	jmp    2339 <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    2373:	83 ec 08             	sub    $0x8,%esp
+    2376:	68 2e 46 00 00       	push   $0x462e
+    237b:	6a 01                	push   $0x1
+    237d:	e8 1b 15 00 00       	call   389d <printf>
+    exit();
+    2382:	e8 99 13 00 00       	call   3720 <exit>
+      printf(1, "write bigfile failed\n");
+    2387:	83 ec 08             	sub    $0x8,%esp
+    238a:	68 44 46 00 00       	push   $0x4644
+    238f:	6a 01                	push   $0x1
+    2391:	e8 07 15 00 00       	call   389d <printf>
+      exit();
+    2396:	e8 85 13 00 00       	call   3720 <exit>
+    }
+  }
+  close(fd);
+    239b:	83 ec 0c             	sub    $0xc,%esp
+    239e:	56                   	push   %esi
+    239f:	e8 a4 13 00 00       	call   3748 <close>
+
+  fd = open("bigfile", 0);
+    23a4:	83 c4 08             	add    $0x8,%esp
+    23a7:	6a 00                	push   $0x0
+    23a9:	68 3c 46 00 00       	push   $0x463c
+    23ae:	e8 ad 13 00 00       	call   3760 <open>
+    23b3:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	78 53                	js     240f <bigfile+0x117>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    23bc:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    23c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    23c6:	83 ec 04             	sub    $0x4,%esp
+    23c9:	68 2c 01 00 00       	push   $0x12c
+    23ce:	68 c0 7a 00 00       	push   $0x7ac0
+    23d3:	57                   	push   %edi
+    23d4:	e8 5f 13 00 00       	call   3738 <read>
+    if(cc < 0){
+    23d9:	83 c4 10             	add    $0x10,%esp
+    23dc:	85 c0                	test   %eax,%eax
+    23de:	78 43                	js     2423 <bigfile+0x12b>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    23e0:	74 7d                	je     245f <bigfile+0x167>
+      break;
+    if(cc != 300){
+    23e2:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    23e7:	75 4e                	jne    2437 <bigfile+0x13f>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    23e9:	0f be 0d c0 7a 00 00 	movsbl 0x7ac0,%ecx
+    23f0:	89 da                	mov    %ebx,%edx
+    23f2:	c1 ea 1f             	shr    $0x1f,%edx
+    23f5:	01 da                	add    %ebx,%edx
+    23f7:	d1 fa                	sar    %edx
+    23f9:	39 d1                	cmp    %edx,%ecx
+    23fb:	75 4e                	jne    244b <bigfile+0x153>
+    23fd:	0f be 0d eb 7b 00 00 	movsbl 0x7beb,%ecx
+    2404:	39 ca                	cmp    %ecx,%edx
+    2406:	75 43                	jne    244b <bigfile+0x153>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    2408:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    240a:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    240d:	eb b7                	jmp    23c6 <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    240f:	83 ec 08             	sub    $0x8,%esp
+    2412:	68 5a 46 00 00       	push   $0x465a
+    2417:	6a 01                	push   $0x1
+    2419:	e8 7f 14 00 00       	call   389d <printf>
+    exit();
+    241e:	e8 fd 12 00 00       	call   3720 <exit>
+      printf(1, "read bigfile failed\n");
+    2423:	83 ec 08             	sub    $0x8,%esp
+    2426:	68 6f 46 00 00       	push   $0x466f
+    242b:	6a 01                	push   $0x1
+    242d:	e8 6b 14 00 00       	call   389d <printf>
+      exit();
+    2432:	e8 e9 12 00 00       	call   3720 <exit>
+      printf(1, "short read bigfile\n");
+    2437:	83 ec 08             	sub    $0x8,%esp
+    243a:	68 84 46 00 00       	push   $0x4684
+    243f:	6a 01                	push   $0x1
+    2441:	e8 57 14 00 00       	call   389d <printf>
+      exit();
+    2446:	e8 d5 12 00 00       	call   3720 <exit>
+      printf(1, "read bigfile wrong data\n");
+    244b:	83 ec 08             	sub    $0x8,%esp
+    244e:	68 98 46 00 00       	push   $0x4698
+    2453:	6a 01                	push   $0x1
+    2455:	e8 43 14 00 00       	call   389d <printf>
+      exit();
+    245a:	e8 c1 12 00 00       	call   3720 <exit>
+  }
+  close(fd);
+    245f:	83 ec 0c             	sub    $0xc,%esp
+    2462:	57                   	push   %edi
+    2463:	e8 e0 12 00 00       	call   3748 <close>
+  if(total != 20*600){
+    2468:	83 c4 10             	add    $0x10,%esp
+    246b:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2471:	75 27                	jne    249a <bigfile+0x1a2>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    2473:	83 ec 0c             	sub    $0xc,%esp
+    2476:	68 3c 46 00 00       	push   $0x463c
+    247b:	e8 f0 12 00 00       	call   3770 <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2480:	83 c4 08             	add    $0x8,%esp
+    2483:	68 cb 46 00 00       	push   $0x46cb
+    2488:	6a 01                	push   $0x1
+    248a:	e8 0e 14 00 00       	call   389d <printf>
+}
+    248f:	83 c4 10             	add    $0x10,%esp
+    2492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2495:	5b                   	pop    %ebx
+    2496:	5e                   	pop    %esi
+    2497:	5f                   	pop    %edi
+    2498:	5d                   	pop    %ebp
+    2499:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    249a:	83 ec 08             	sub    $0x8,%esp
+    249d:	68 b1 46 00 00       	push   $0x46b1
+    24a2:	6a 01                	push   $0x1
+    24a4:	e8 f4 13 00 00       	call   389d <printf>
+    exit();
+    24a9:	e8 72 12 00 00       	call   3720 <exit>
+
+000024ae <fourteen>:
+
+void
+fourteen(void)
+{
+    24ae:	55                   	push   %ebp
+    24af:	89 e5                	mov    %esp,%ebp
+    24b1:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    24b4:	68 dc 46 00 00       	push   $0x46dc
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 dd 13 00 00       	call   389d <printf>
+
+  if(mkdir("12345678901234") != 0){
+    24c0:	c7 04 24 17 47 00 00 	movl   $0x4717,(%esp)
+    24c7:	e8 bc 12 00 00       	call   3788 <mkdir>
+    24cc:	83 c4 10             	add    $0x10,%esp
+    24cf:	85 c0                	test   %eax,%eax
+    24d1:	0f 85 9c 00 00 00    	jne    2573 <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    24d7:	83 ec 0c             	sub    $0xc,%esp
+    24da:	68 d4 4e 00 00       	push   $0x4ed4
+    24df:	e8 a4 12 00 00       	call   3788 <mkdir>
+    24e4:	83 c4 10             	add    $0x10,%esp
+    24e7:	85 c0                	test   %eax,%eax
+    24e9:	0f 85 98 00 00 00    	jne    2587 <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    24ef:	83 ec 08             	sub    $0x8,%esp
+    24f2:	68 00 02 00 00       	push   $0x200
+    24f7:	68 24 4f 00 00       	push   $0x4f24
+    24fc:	e8 5f 12 00 00       	call   3760 <open>
+  if(fd < 0){
+    2501:	83 c4 10             	add    $0x10,%esp
+    2504:	85 c0                	test   %eax,%eax
+    2506:	0f 88 8f 00 00 00    	js     259b <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    250c:	83 ec 0c             	sub    $0xc,%esp
+    250f:	50                   	push   %eax
+    2510:	e8 33 12 00 00       	call   3748 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2515:	83 c4 08             	add    $0x8,%esp
+    2518:	6a 00                	push   $0x0
+    251a:	68 94 4f 00 00       	push   $0x4f94
+    251f:	e8 3c 12 00 00       	call   3760 <open>
+  if(fd < 0){
+    2524:	83 c4 10             	add    $0x10,%esp
+    2527:	85 c0                	test   %eax,%eax
+    2529:	0f 88 80 00 00 00    	js     25af <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    252f:	83 ec 0c             	sub    $0xc,%esp
+    2532:	50                   	push   %eax
+    2533:	e8 10 12 00 00       	call   3748 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2538:	c7 04 24 08 47 00 00 	movl   $0x4708,(%esp)
+    253f:	e8 44 12 00 00       	call   3788 <mkdir>
+    2544:	83 c4 10             	add    $0x10,%esp
+    2547:	85 c0                	test   %eax,%eax
+    2549:	74 78                	je     25c3 <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    254b:	83 ec 0c             	sub    $0xc,%esp
+    254e:	68 30 50 00 00       	push   $0x5030
+    2553:	e8 30 12 00 00       	call   3788 <mkdir>
+    2558:	83 c4 10             	add    $0x10,%esp
+    255b:	85 c0                	test   %eax,%eax
+    255d:	74 78                	je     25d7 <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    255f:	83 ec 08             	sub    $0x8,%esp
+    2562:	68 26 47 00 00       	push   $0x4726
+    2567:	6a 01                	push   $0x1
+    2569:	e8 2f 13 00 00       	call   389d <printf>
+}
+    256e:	83 c4 10             	add    $0x10,%esp
+    2571:	c9                   	leave
+    2572:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2573:	83 ec 08             	sub    $0x8,%esp
+    2576:	68 eb 46 00 00       	push   $0x46eb
+    257b:	6a 01                	push   $0x1
+    257d:	e8 1b 13 00 00       	call   389d <printf>
+    exit();
+    2582:	e8 99 11 00 00       	call   3720 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2587:	83 ec 08             	sub    $0x8,%esp
+    258a:	68 f4 4e 00 00       	push   $0x4ef4
+    258f:	6a 01                	push   $0x1
+    2591:	e8 07 13 00 00       	call   389d <printf>
+    exit();
+    2596:	e8 85 11 00 00       	call   3720 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    259b:	83 ec 08             	sub    $0x8,%esp
+    259e:	68 54 4f 00 00       	push   $0x4f54
+    25a3:	6a 01                	push   $0x1
+    25a5:	e8 f3 12 00 00       	call   389d <printf>
+    exit();
+    25aa:	e8 71 11 00 00       	call   3720 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    25af:	83 ec 08             	sub    $0x8,%esp
+    25b2:	68 c4 4f 00 00       	push   $0x4fc4
+    25b7:	6a 01                	push   $0x1
+    25b9:	e8 df 12 00 00       	call   389d <printf>
+    exit();
+    25be:	e8 5d 11 00 00       	call   3720 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    25c3:	83 ec 08             	sub    $0x8,%esp
+    25c6:	68 00 50 00 00       	push   $0x5000
+    25cb:	6a 01                	push   $0x1
+    25cd:	e8 cb 12 00 00       	call   389d <printf>
+    exit();
+    25d2:	e8 49 11 00 00       	call   3720 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    25d7:	83 ec 08             	sub    $0x8,%esp
+    25da:	68 50 50 00 00       	push   $0x5050
+    25df:	6a 01                	push   $0x1
+    25e1:	e8 b7 12 00 00       	call   389d <printf>
+    exit();
+    25e6:	e8 35 11 00 00       	call   3720 <exit>
+
+000025eb <rmdot>:
+
+void
+rmdot(void)
+{
+    25eb:	55                   	push   %ebp
+    25ec:	89 e5                	mov    %esp,%ebp
+    25ee:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    25f1:	68 33 47 00 00       	push   $0x4733
+    25f6:	6a 01                	push   $0x1
+    25f8:	e8 a0 12 00 00       	call   389d <printf>
+  if(mkdir("dots") != 0){
+    25fd:	c7 04 24 3f 47 00 00 	movl   $0x473f,(%esp)
+    2604:	e8 7f 11 00 00       	call   3788 <mkdir>
+    2609:	83 c4 10             	add    $0x10,%esp
+    260c:	85 c0                	test   %eax,%eax
+    260e:	0f 85 bc 00 00 00    	jne    26d0 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    2614:	83 ec 0c             	sub    $0xc,%esp
+    2617:	68 3f 47 00 00       	push   $0x473f
+    261c:	e8 6f 11 00 00       	call   3790 <chdir>
+    2621:	83 c4 10             	add    $0x10,%esp
+    2624:	85 c0                	test   %eax,%eax
+    2626:	0f 85 b8 00 00 00    	jne    26e4 <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    262c:	83 ec 0c             	sub    $0xc,%esp
+    262f:	68 ea 43 00 00       	push   $0x43ea
+    2634:	e8 37 11 00 00       	call   3770 <unlink>
+    2639:	83 c4 10             	add    $0x10,%esp
+    263c:	85 c0                	test   %eax,%eax
+    263e:	0f 84 b4 00 00 00    	je     26f8 <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    2644:	83 ec 0c             	sub    $0xc,%esp
+    2647:	68 e9 43 00 00       	push   $0x43e9
+    264c:	e8 1f 11 00 00       	call   3770 <unlink>
+    2651:	83 c4 10             	add    $0x10,%esp
+    2654:	85 c0                	test   %eax,%eax
+    2656:	0f 84 b0 00 00 00    	je     270c <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    265c:	83 ec 0c             	sub    $0xc,%esp
+    265f:	68 bd 3b 00 00       	push   $0x3bbd
+    2664:	e8 27 11 00 00       	call   3790 <chdir>
+    2669:	83 c4 10             	add    $0x10,%esp
+    266c:	85 c0                	test   %eax,%eax
+    266e:	0f 85 ac 00 00 00    	jne    2720 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    2674:	83 ec 0c             	sub    $0xc,%esp
+    2677:	68 87 47 00 00       	push   $0x4787
+    267c:	e8 ef 10 00 00       	call   3770 <unlink>
+    2681:	83 c4 10             	add    $0x10,%esp
+    2684:	85 c0                	test   %eax,%eax
+    2686:	0f 84 a8 00 00 00    	je     2734 <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    268c:	83 ec 0c             	sub    $0xc,%esp
+    268f:	68 a5 47 00 00       	push   $0x47a5
+    2694:	e8 d7 10 00 00       	call   3770 <unlink>
+    2699:	83 c4 10             	add    $0x10,%esp
+    269c:	85 c0                	test   %eax,%eax
+    269e:	0f 84 a4 00 00 00    	je     2748 <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    26a4:	83 ec 0c             	sub    $0xc,%esp
+    26a7:	68 3f 47 00 00       	push   $0x473f
+    26ac:	e8 bf 10 00 00       	call   3770 <unlink>
+    26b1:	83 c4 10             	add    $0x10,%esp
+    26b4:	85 c0                	test   %eax,%eax
+    26b6:	0f 85 a0 00 00 00    	jne    275c <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    26bc:	83 ec 08             	sub    $0x8,%esp
+    26bf:	68 da 47 00 00       	push   $0x47da
+    26c4:	6a 01                	push   $0x1
+    26c6:	e8 d2 11 00 00       	call   389d <printf>
+}
+    26cb:	83 c4 10             	add    $0x10,%esp
+    26ce:	c9                   	leave
+    26cf:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 44 47 00 00       	push   $0x4744
+    26d8:	6a 01                	push   $0x1
+    26da:	e8 be 11 00 00       	call   389d <printf>
+    exit();
+    26df:	e8 3c 10 00 00       	call   3720 <exit>
+    printf(1, "chdir dots failed\n");
+    26e4:	83 ec 08             	sub    $0x8,%esp
+    26e7:	68 57 47 00 00       	push   $0x4757
+    26ec:	6a 01                	push   $0x1
+    26ee:	e8 aa 11 00 00       	call   389d <printf>
+    exit();
+    26f3:	e8 28 10 00 00       	call   3720 <exit>
+    printf(1, "rm . worked!\n");
+    26f8:	83 ec 08             	sub    $0x8,%esp
+    26fb:	68 6a 47 00 00       	push   $0x476a
+    2700:	6a 01                	push   $0x1
+    2702:	e8 96 11 00 00       	call   389d <printf>
+    exit();
+    2707:	e8 14 10 00 00       	call   3720 <exit>
+    printf(1, "rm .. worked!\n");
+    270c:	83 ec 08             	sub    $0x8,%esp
+    270f:	68 78 47 00 00       	push   $0x4778
+    2714:	6a 01                	push   $0x1
+    2716:	e8 82 11 00 00       	call   389d <printf>
+    exit();
+    271b:	e8 00 10 00 00       	call   3720 <exit>
+    printf(1, "chdir / failed\n");
+    2720:	83 ec 08             	sub    $0x8,%esp
+    2723:	68 bf 3b 00 00       	push   $0x3bbf
+    2728:	6a 01                	push   $0x1
+    272a:	e8 6e 11 00 00       	call   389d <printf>
+    exit();
+    272f:	e8 ec 0f 00 00       	call   3720 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2734:	83 ec 08             	sub    $0x8,%esp
+    2737:	68 8e 47 00 00       	push   $0x478e
+    273c:	6a 01                	push   $0x1
+    273e:	e8 5a 11 00 00       	call   389d <printf>
+    exit();
+    2743:	e8 d8 0f 00 00       	call   3720 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2748:	83 ec 08             	sub    $0x8,%esp
+    274b:	68 ad 47 00 00       	push   $0x47ad
+    2750:	6a 01                	push   $0x1
+    2752:	e8 46 11 00 00       	call   389d <printf>
+    exit();
+    2757:	e8 c4 0f 00 00       	call   3720 <exit>
+    printf(1, "unlink dots failed!\n");
+    275c:	83 ec 08             	sub    $0x8,%esp
+    275f:	68 c5 47 00 00       	push   $0x47c5
+    2764:	6a 01                	push   $0x1
+    2766:	e8 32 11 00 00       	call   389d <printf>
+    exit();
+    276b:	e8 b0 0f 00 00       	call   3720 <exit>
+
+00002770 <dirfile>:
+
+void
+dirfile(void)
+{
+    2770:	55                   	push   %ebp
+    2771:	89 e5                	mov    %esp,%ebp
+    2773:	53                   	push   %ebx
+    2774:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2777:	68 e4 47 00 00       	push   $0x47e4
+    277c:	6a 01                	push   $0x1
+    277e:	e8 1a 11 00 00       	call   389d <printf>
+
+  fd = open("dirfile", O_CREATE);
+    2783:	83 c4 08             	add    $0x8,%esp
+    2786:	68 00 02 00 00       	push   $0x200
+    278b:	68 f1 47 00 00       	push   $0x47f1
+    2790:	e8 cb 0f 00 00       	call   3760 <open>
+  if(fd < 0){
+    2795:	83 c4 10             	add    $0x10,%esp
+    2798:	85 c0                	test   %eax,%eax
+    279a:	0f 88 22 01 00 00    	js     28c2 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    27a0:	83 ec 0c             	sub    $0xc,%esp
+    27a3:	50                   	push   %eax
+    27a4:	e8 9f 0f 00 00       	call   3748 <close>
+  if(chdir("dirfile") == 0){
+    27a9:	c7 04 24 f1 47 00 00 	movl   $0x47f1,(%esp)
+    27b0:	e8 db 0f 00 00       	call   3790 <chdir>
+    27b5:	83 c4 10             	add    $0x10,%esp
+    27b8:	85 c0                	test   %eax,%eax
+    27ba:	0f 84 16 01 00 00    	je     28d6 <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    27c0:	83 ec 08             	sub    $0x8,%esp
+    27c3:	6a 00                	push   $0x0
+    27c5:	68 2a 48 00 00       	push   $0x482a
+    27ca:	e8 91 0f 00 00       	call   3760 <open>
+  if(fd >= 0){
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	85 c0                	test   %eax,%eax
+    27d4:	0f 89 10 01 00 00    	jns    28ea <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    27da:	83 ec 08             	sub    $0x8,%esp
+    27dd:	68 00 02 00 00       	push   $0x200
+    27e2:	68 2a 48 00 00       	push   $0x482a
+    27e7:	e8 74 0f 00 00       	call   3760 <open>
+  if(fd >= 0){
+    27ec:	83 c4 10             	add    $0x10,%esp
+    27ef:	85 c0                	test   %eax,%eax
+    27f1:	0f 89 07 01 00 00    	jns    28fe <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    27f7:	83 ec 0c             	sub    $0xc,%esp
+    27fa:	68 2a 48 00 00       	push   $0x482a
+    27ff:	e8 84 0f 00 00       	call   3788 <mkdir>
+    2804:	83 c4 10             	add    $0x10,%esp
+    2807:	85 c0                	test   %eax,%eax
+    2809:	0f 84 03 01 00 00    	je     2912 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    280f:	83 ec 0c             	sub    $0xc,%esp
+    2812:	68 2a 48 00 00       	push   $0x482a
+    2817:	e8 54 0f 00 00       	call   3770 <unlink>
+    281c:	83 c4 10             	add    $0x10,%esp
+    281f:	85 c0                	test   %eax,%eax
+    2821:	0f 84 ff 00 00 00    	je     2926 <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    2827:	83 ec 08             	sub    $0x8,%esp
+    282a:	68 2a 48 00 00       	push   $0x482a
+    282f:	68 8e 48 00 00       	push   $0x488e
+    2834:	e8 47 0f 00 00       	call   3780 <link>
+    2839:	83 c4 10             	add    $0x10,%esp
+    283c:	85 c0                	test   %eax,%eax
+    283e:	0f 84 f6 00 00 00    	je     293a <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    2844:	83 ec 0c             	sub    $0xc,%esp
+    2847:	68 f1 47 00 00       	push   $0x47f1
+    284c:	e8 1f 0f 00 00       	call   3770 <unlink>
+    2851:	83 c4 10             	add    $0x10,%esp
+    2854:	85 c0                	test   %eax,%eax
+    2856:	0f 85 f2 00 00 00    	jne    294e <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    285c:	83 ec 08             	sub    $0x8,%esp
+    285f:	6a 02                	push   $0x2
+    2861:	68 ea 43 00 00       	push   $0x43ea
+    2866:	e8 f5 0e 00 00       	call   3760 <open>
+  if(fd >= 0){
+    286b:	83 c4 10             	add    $0x10,%esp
+    286e:	85 c0                	test   %eax,%eax
+    2870:	0f 89 ec 00 00 00    	jns    2962 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    2876:	83 ec 08             	sub    $0x8,%esp
+    2879:	6a 00                	push   $0x0
+    287b:	68 ea 43 00 00       	push   $0x43ea
+    2880:	e8 db 0e 00 00       	call   3760 <open>
+    2885:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2887:	83 c4 0c             	add    $0xc,%esp
+    288a:	6a 01                	push   $0x1
+    288c:	68 cd 44 00 00       	push   $0x44cd
+    2891:	50                   	push   %eax
+    2892:	e8 a9 0e 00 00       	call   3740 <write>
+    2897:	83 c4 10             	add    $0x10,%esp
+    289a:	85 c0                	test   %eax,%eax
+    289c:	0f 8f d4 00 00 00    	jg     2976 <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    28a2:	83 ec 0c             	sub    $0xc,%esp
+    28a5:	53                   	push   %ebx
+    28a6:	e8 9d 0e 00 00       	call   3748 <close>
+
+  printf(1, "dir vs file OK\n");
+    28ab:	83 c4 08             	add    $0x8,%esp
+    28ae:	68 c1 48 00 00       	push   $0x48c1
+    28b3:	6a 01                	push   $0x1
+    28b5:	e8 e3 0f 00 00       	call   389d <printf>
+}
+    28ba:	83 c4 10             	add    $0x10,%esp
+    28bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    28c0:	c9                   	leave
+    28c1:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    28c2:	83 ec 08             	sub    $0x8,%esp
+    28c5:	68 f9 47 00 00       	push   $0x47f9
+    28ca:	6a 01                	push   $0x1
+    28cc:	e8 cc 0f 00 00       	call   389d <printf>
+    exit();
+    28d1:	e8 4a 0e 00 00       	call   3720 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    28d6:	83 ec 08             	sub    $0x8,%esp
+    28d9:	68 10 48 00 00       	push   $0x4810
+    28de:	6a 01                	push   $0x1
+    28e0:	e8 b8 0f 00 00       	call   389d <printf>
+    exit();
+    28e5:	e8 36 0e 00 00       	call   3720 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28ea:	83 ec 08             	sub    $0x8,%esp
+    28ed:	68 35 48 00 00       	push   $0x4835
+    28f2:	6a 01                	push   $0x1
+    28f4:	e8 a4 0f 00 00       	call   389d <printf>
+    exit();
+    28f9:	e8 22 0e 00 00       	call   3720 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28fe:	83 ec 08             	sub    $0x8,%esp
+    2901:	68 35 48 00 00       	push   $0x4835
+    2906:	6a 01                	push   $0x1
+    2908:	e8 90 0f 00 00       	call   389d <printf>
+    exit();
+    290d:	e8 0e 0e 00 00       	call   3720 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2912:	83 ec 08             	sub    $0x8,%esp
+    2915:	68 53 48 00 00       	push   $0x4853
+    291a:	6a 01                	push   $0x1
+    291c:	e8 7c 0f 00 00       	call   389d <printf>
+    exit();
+    2921:	e8 fa 0d 00 00       	call   3720 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2926:	83 ec 08             	sub    $0x8,%esp
+    2929:	68 70 48 00 00       	push   $0x4870
+    292e:	6a 01                	push   $0x1
+    2930:	e8 68 0f 00 00       	call   389d <printf>
+    exit();
+    2935:	e8 e6 0d 00 00       	call   3720 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    293a:	83 ec 08             	sub    $0x8,%esp
+    293d:	68 84 50 00 00       	push   $0x5084
+    2942:	6a 01                	push   $0x1
+    2944:	e8 54 0f 00 00       	call   389d <printf>
+    exit();
+    2949:	e8 d2 0d 00 00       	call   3720 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    294e:	83 ec 08             	sub    $0x8,%esp
+    2951:	68 95 48 00 00       	push   $0x4895
+    2956:	6a 01                	push   $0x1
+    2958:	e8 40 0f 00 00       	call   389d <printf>
+    exit();
+    295d:	e8 be 0d 00 00       	call   3720 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2962:	83 ec 08             	sub    $0x8,%esp
+    2965:	68 a4 50 00 00       	push   $0x50a4
+    296a:	6a 01                	push   $0x1
+    296c:	e8 2c 0f 00 00       	call   389d <printf>
+    exit();
+    2971:	e8 aa 0d 00 00       	call   3720 <exit>
+    printf(1, "write . succeeded!\n");
+    2976:	83 ec 08             	sub    $0x8,%esp
+    2979:	68 ad 48 00 00       	push   $0x48ad
+    297e:	6a 01                	push   $0x1
+    2980:	e8 18 0f 00 00       	call   389d <printf>
+    exit();
+    2985:	e8 96 0d 00 00       	call   3720 <exit>
+
+0000298a <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    298a:	55                   	push   %ebp
+    298b:	89 e5                	mov    %esp,%ebp
+    298d:	53                   	push   %ebx
+    298e:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2991:	68 d1 48 00 00       	push   $0x48d1
+    2996:	6a 01                	push   $0x1
+    2998:	e8 00 0f 00 00       	call   389d <printf>
+
+  // more than NINODE, so cached inodes get recycled too
+  for(i = 0; i < 50 + 1; i++){
+    299d:	83 c4 10             	add    $0x10,%esp
+    29a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    29a5:	eb 4c                	jmp    29f3 <iref+0x69>
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    29a7:	83 ec 08             	sub    $0x8,%esp
+    29aa:	68 e8 48 00 00       	push   $0x48e8
+    29af:	6a 01                	push   $0x1
+    29b1:	e8 e7 0e 00 00       	call   389d <printf>
+      exit();
+    29b6:	e8 65 0d 00 00       	call   3720 <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    29bb:	83 ec 08             	sub    $0x8,%esp
+    29be:	68 fc 48 00 00       	push   $0x48fc
+    29c3:	6a 01                	push   $0x1
+    29c5:	e8 d3 0e 00 00       	call   389d <printf>
+      exit();
+    29ca:	e8 51 0d 00 00       	call   3720 <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    29cf:	83 ec 0c             	sub    $0xc,%esp
+    29d2:	50                   	push   %eax
+    29d3:	e8 70 0d 00 00       	call   3748 <close>
+    29d8:	83 c4 10             	add    $0x10,%esp
+    29db:	e9 80 00 00 00       	jmp    2a60 <iref+0xd6>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    29e0:	83 ec 0c             	sub    $0xc,%esp
+    29e3:	68 cc 44 00 00       	push   $0x44cc
+    29e8:	e8 83 0d 00 00       	call   3770 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    29ed:	83 c3 01             	add    $0x1,%ebx
+    29f0:	83 c4 10             	add    $0x10,%esp
+    29f3:	83 fb 32             	cmp    $0x32,%ebx
+    29f6:	0f 8f 92 00 00 00    	jg     2a8e <iref+0x104>
+    if(mkdir("irefd") != 0){
+    29fc:	83 ec 0c             	sub    $0xc,%esp
+    29ff:	68 e2 48 00 00       	push   $0x48e2
+    2a04:	e8 7f 0d 00 00       	call   3788 <mkdir>
+    2a09:	83 c4 10             	add    $0x10,%esp
+    2a0c:	85 c0                	test   %eax,%eax
+    2a0e:	75 97                	jne    29a7 <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2a10:	83 ec 0c             	sub    $0xc,%esp
+    2a13:	68 e2 48 00 00       	push   $0x48e2
+    2a18:	e8 73 0d 00 00       	call   3790 <chdir>
+    2a1d:	83 c4 10             	add    $0x10,%esp
+    2a20:	85 c0                	test   %eax,%eax
+    2a22:	75 97                	jne    29bb <iref+0x31>
+    mkdir("");
+    2a24:	83 ec 0c             	sub    $0xc,%esp
+    2a27:	68 97 3f 00 00       	push   $0x3f97
+    2a2c:	e8 57 0d 00 00       	call   3788 <mkdir>
+    link("README", "");
+    2a31:	83 c4 08             	add    $0x8,%esp
+    2a34:	68 97 3f 00 00       	push   $0x3f97
+    2a39:	68 8e 48 00 00       	push   $0x488e
+    2a3e:	e8 3d 0d 00 00       	call   3780 <link>
+    fd = open("", O_CREATE);
+    2a43:	83 c4 08             	add    $0x8,%esp
+    2a46:	68 00 02 00 00       	push   $0x200
+    2a4b:	68 97 3f 00 00       	push   $0x3f97
+    2a50:	e8 0b 0d 00 00       	call   3760 <open>
+    if(fd >= 0)
+    2a55:	83 c4 10             	add    $0x10,%esp
+    2a58:	85 c0                	test   %eax,%eax
+    2a5a:	0f 89 6f ff ff ff    	jns    29cf <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2a60:	83 ec 08             	sub    $0x8,%esp
+    2a63:	68 00 02 00 00       	push   $0x200
+    2a68:	68 cc 44 00 00       	push   $0x44cc
+    2a6d:	e8 ee 0c 00 00       	call   3760 <open>
+    if(fd >= 0)
+    2a72:	83 c4 10             	add    $0x10,%esp
+    2a75:	85 c0                	test   %eax,%eax
+    2a77:	0f 88 63 ff ff ff    	js     29e0 <iref+0x56>
+      close(fd);
+    2a7d:	83 ec 0c             	sub    $0xc,%esp
+    2a80:	50                   	push   %eax
+    2a81:	e8 c2 0c 00 00       	call   3748 <close>
+    2a86:	83 c4 10             	add    $0x10,%esp
+    2a89:	e9 52 ff ff ff       	jmp    29e0 <iref+0x56>
+  }
+
+  chdir("/");
+    2a8e:	83 ec 0c             	sub    $0xc,%esp
+    2a91:	68 bd 3b 00 00       	push   $0x3bbd
+    2a96:	e8 f5 0c 00 00       	call   3790 <chdir>
+  printf(1, "empty file name OK\n");
+    2a9b:	83 c4 08             	add    $0x8,%esp
+    2a9e:	68 10 49 00 00       	push   $0x4910
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 f3 0d 00 00       	call   389d <printf>
+}
+    2aaa:	83 c4 10             	add    $0x10,%esp
+    2aad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ab0:	c9                   	leave
+    2ab1:	c3                   	ret
+
+00002ab2 <forktest>:
+// first; asking for more than NPROC makes sure one of them does.
+#define NFORK (NPROC + 100)
+
+void
+forktest(void)
+{
+    2ab2:	55                   	push   %ebp
+    2ab3:	89 e5                	mov    %esp,%ebp
+    2ab5:	53                   	push   %ebx
+    2ab6:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2ab9:	68 24 49 00 00       	push   $0x4924
+    2abe:	6a 01                	push   $0x1
+    2ac0:	e8 d8 0d 00 00       	call   389d <printf>
+
+  for(n=0; n<NFORK; n++){
+    2ac5:	83 c4 10             	add    $0x10,%esp
+    2ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2acd:	81 fb 63 10 00 00    	cmp    $0x1063,%ebx
+    2ad3:	7f 15                	jg     2aea <forktest+0x38>
+    pid = fork();
+    2ad5:	e8 3e 0c 00 00       	call   3718 <fork>
+    if(pid < 0)
+    2ada:	85 c0                	test   %eax,%eax
+    2adc:	78 0c                	js     2aea <forktest+0x38>
+      break;
+    if(pid == 0)
+    2ade:	74 05                	je     2ae5 <forktest+0x33>
+  for(n=0; n<NFORK; n++){
+    2ae0:	83 c3 01             	add    $0x1,%ebx
+    2ae3:	eb e8                	jmp    2acd <forktest+0x1b>
+      exit();
+    2ae5:	e8 36 0c 00 00       	call   3720 <exit>
+  }
+
+  if(n == NFORK){
+    2aea:	81 fb 64 10 00 00    	cmp    $0x1064,%ebx
+    2af0:	74 12                	je     2b04 <forktest+0x52>
+    printf(1, "fork claimed to work %d times!\n", NFORK);
+    exit();
+  }
+
+  for(; n > 0; n--){
+    2af2:	85 db                	test   %ebx,%ebx
+    2af4:	7e 3b                	jle    2b31 <forktest+0x7f>
+    if(wait() < 0){
+    2af6:	e8 2d 0c 00 00       	call   3728 <wait>
+    2afb:	85 c0                	test   %eax,%eax
+    2afd:	78 1e                	js     2b1d <forktest+0x6b>
+  for(; n > 0; n--){
+    2aff:	83 eb 01             	sub    $0x1,%ebx
+    2b02:	eb ee                	jmp    2af2 <forktest+0x40>
+    printf(1, "fork claimed to work %d times!\n", NFORK);
+    2b04:	83 ec 04             	sub    $0x4,%esp
+    2b07:	68 64 10 00 00       	push   $0x1064
+    2b0c:	68 c4 50 00 00       	push   $0x50c4
+    2b11:	6a 01                	push   $0x1
+    2b13:	e8 85 0d 00 00       	call   389d <printf>
+    exit();
+    2b18:	e8 03 0c 00 00       	call   3720 <exit>
+      printf(1, "wait stopped early\n");
+    2b1d:	83 ec 08             	sub    $0x8,%esp
+    2b20:	68 2f 49 00 00       	push   $0x492f
+    2b25:	6a 01                	push   $0x1
+    2b27:	e8 71 0d 00 00       	call   389d <printf>
+      exit();
+    2b2c:	e8 ef 0b 00 00       	call   3720 <exit>
+    }
+  }
+
+  if(wait() != -1){
+    2b31:	e8 f2 0b 00 00       	call   3728 <wait>
+    2b36:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b39:	75 17                	jne    2b52 <forktest+0xa0>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2b3b:	83 ec 08             	sub    $0x8,%esp
+    2b3e:	68 56 49 00 00       	push   $0x4956
+    2b43:	6a 01                	push   $0x1
+    2b45:	e8 53 0d 00 00       	call   389d <printf>
+}
+    2b4a:	83 c4 10             	add    $0x10,%esp
+    2b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b50:	c9                   	leave
+    2b51:	c3                   	ret
+    printf(1, "wait got too many\n");
+    2b52:	83 ec 08             	sub    $0x8,%esp
+    2b55:	68 43 49 00 00       	push   $0x4943
+    2b5a:	6a 01                	push   $0x1
+    2b5c:	e8 3c 0d 00 00       	call   389d <printf>
+    exit();
+    2b61:	e8 ba 0b 00 00       	call   3720 <exit>
+
+00002b66 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    2b66:	55                   	push   %ebp
+    2b67:	89 e5                	mov    %esp,%ebp
+    2b69:	57                   	push   %edi
+    2b6a:	56                   	push   %esi
+    2b6b:	53                   	push   %ebx
+    2b6c:	83 ec 54             	sub    $0x54,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    2b6f:	68 64 49 00 00       	push   $0x4964
+    2b74:	ff 35 80 53 00 00    	push   0x5380
+    2b7a:	e8 1e 0d 00 00       	call   389d <printf>
+  oldbrk = sbrk(0);
+    2b7f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b86:	e8 1d 0c 00 00       	call   37a8 <sbrk>
+    2b8b:	89 c7                	mov    %eax,%edi
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    2b8d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b94:	e8 0f 0c 00 00       	call   37a8 <sbrk>
+    2b99:	89 c6                	mov    %eax,%esi
+  int i;
+  for(i = 0; i < 5000; i++){
+    2b9b:	83 c4 10             	add    $0x10,%esp
+    2b9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2ba3:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    2ba9:	7f 3a                	jg     2be5 <sbrktest+0x7f>
+    b = sbrk(1);
+    2bab:	83 ec 0c             	sub    $0xc,%esp
+    2bae:	6a 01                	push   $0x1
+    2bb0:	e8 f3 0b 00 00       	call   37a8 <sbrk>
+    if(b != a){
+    2bb5:	83 c4 10             	add    $0x10,%esp
+    2bb8:	39 c6                	cmp    %eax,%esi
+    2bba:	75 0b                	jne    2bc7 <sbrktest+0x61>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    2bbc:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    2bbf:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    2bc2:	83 c3 01             	add    $0x1,%ebx
+    2bc5:	eb dc                	jmp    2ba3 <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    2bc7:	83 ec 0c             	sub    $0xc,%esp
+    2bca:	50                   	push   %eax
+    2bcb:	56                   	push   %esi
+    2bcc:	53                   	push   %ebx
+    2bcd:	68 6f 49 00 00       	push   $0x496f
+    2bd2:	ff 35 80 53 00 00    	push   0x5380
+    2bd8:	e8 c0 0c 00 00       	call   389d <printf>
+      exit();
+    2bdd:	83 c4 20             	add    $0x20,%esp
+    2be0:	e8 3b 0b 00 00       	call   3720 <exit>
+  }
+  pid = fork();
+    2be5:	e8 2e 0b 00 00       	call   3718 <fork>
+    2bea:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    2bec:	85 c0                	test   %eax,%eax
+    2bee:	0f 88 53 01 00 00    	js     2d47 <sbrktest+0x1e1>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    2bf4:	83 ec 0c             	sub    $0xc,%esp
+    2bf7:	6a 01                	push   $0x1
+    2bf9:	e8 aa 0b 00 00       	call   37a8 <sbrk>
+  c = sbrk(1);
+    2bfe:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2c05:	e8 9e 0b 00 00       	call   37a8 <sbrk>
+  if(c != a + 1){
+    2c0a:	83 c6 01             	add    $0x1,%esi
+    2c0d:	83 c4 10             	add    $0x10,%esp
+    2c10:	39 c6                	cmp    %eax,%esi
+    2c12:	0f 85 47 01 00 00    	jne    2d5f <sbrktest+0x1f9>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    2c18:	85 db                	test   %ebx,%ebx
+    2c1a:	0f 84 57 01 00 00    	je     2d77 <sbrktest+0x211>
+    exit();
+  wait();
+    2c20:	e8 03 0b 00 00       	call   3728 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    2c25:	83 ec 0c             	sub    $0xc,%esp
+    2c28:	6a 00                	push   $0x0
+    2c2a:	e8 79 0b 00 00       	call   37a8 <sbrk>
+    2c2f:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2c31:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2c36:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2c38:	89 04 24             	mov    %eax,(%esp)
+    2c3b:	e8 68 0b 00 00       	call   37a8 <sbrk>
+  if (p != a) {
+    2c40:	83 c4 10             	add    $0x10,%esp
+    2c43:	39 c3                	cmp    %eax,%ebx
+    2c45:	0f 85 31 01 00 00    	jne    2d7c <sbrktest+0x216>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    2c4b:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    2c52:	83 ec 0c             	sub    $0xc,%esp
+    2c55:	6a 00                	push   $0x0
+    2c57:	e8 4c 0b 00 00       	call   37a8 <sbrk>
+    2c5c:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2c5e:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    2c65:	e8 3e 0b 00 00       	call   37a8 <sbrk>
+  if(c == (char*)0xffffffff){
+    2c6a:	83 c4 10             	add    $0x10,%esp
+    2c6d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2c70:	0f 84 1e 01 00 00    	je     2d94 <sbrktest+0x22e>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    2c76:	83 ec 0c             	sub    $0xc,%esp
+    2c79:	6a 00                	push   $0x0
+    2c7b:	e8 28 0b 00 00       	call   37a8 <sbrk>
+  if(c != a - 4096){
+    2c80:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2c86:	83 c4 10             	add    $0x10,%esp
+    2c89:	39 c2                	cmp    %eax,%edx
+    2c8b:	0f 85 1b 01 00 00    	jne    2dac <sbrktest+0x246>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    2c91:	83 ec 0c             	sub    $0xc,%esp
+    2c94:	6a 00                	push   $0x0
+    2c96:	e8 0d 0b 00 00       	call   37a8 <sbrk>
+    2c9b:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2c9d:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    2ca4:	e8 ff 0a 00 00       	call   37a8 <sbrk>
+    2ca9:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2cab:	83 c4 10             	add    $0x10,%esp
+    2cae:	39 c3                	cmp    %eax,%ebx
+    2cb0:	0f 85 0d 01 00 00    	jne    2dc3 <sbrktest+0x25d>
+    2cb6:	83 ec 0c             	sub    $0xc,%esp
+    2cb9:	6a 00                	push   $0x0
+    2cbb:	e8 e8 0a 00 00       	call   37a8 <sbrk>
+    2cc0:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2cc6:	83 c4 10             	add    $0x10,%esp
+    2cc9:	39 c2                	cmp    %eax,%edx
+    2ccb:	0f 85 f2 00 00 00    	jne    2dc3 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    2cd1:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2cd8:	0f 84 fc 00 00 00    	je     2dda <sbrktest+0x274>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    2cde:	83 ec 0c             	sub    $0xc,%esp
+    2ce1:	6a 00                	push   $0x0
+    2ce3:	e8 c0 0a 00 00       	call   37a8 <sbrk>
+    2ce8:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2cea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2cf1:	e8 b2 0a 00 00       	call   37a8 <sbrk>
+    2cf6:	89 c2                	mov    %eax,%edx
+    2cf8:	89 f8                	mov    %edi,%eax
+    2cfa:	29 d0                	sub    %edx,%eax
+    2cfc:	89 04 24             	mov    %eax,(%esp)
+    2cff:	e8 a4 0a 00 00       	call   37a8 <sbrk>
+  if(c != a){
+    2d04:	83 c4 10             	add    $0x10,%esp
+    2d07:	39 c3                	cmp    %eax,%ebx
+    2d09:	0f 85 e3 00 00 00    	jne    2df2 <sbrktest+0x28c>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d0f:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2d14:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    2d1a:	0f 87 23 01 00 00    	ja     2e43 <sbrktest+0x2dd>
+    ppid = getpid();
+    2d20:	e8 7b 0a 00 00       	call   37a0 <getpid>
+    2d25:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2d27:	e8 ec 09 00 00       	call   3718 <fork>
+    if(pid < 0){
+    2d2c:	85 c0                	test   %eax,%eax
+    2d2e:	0f 88 d5 00 00 00    	js     2e09 <sbrktest+0x2a3>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    2d34:	0f 84 e7 00 00 00    	je     2e21 <sbrktest+0x2bb>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    2d3a:	e8 e9 09 00 00       	call   3728 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d3f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2d45:	eb cd                	jmp    2d14 <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    2d47:	83 ec 08             	sub    $0x8,%esp
+    2d4a:	68 8a 49 00 00       	push   $0x498a
+    2d4f:	ff 35 80 53 00 00    	push   0x5380
+    2d55:	e8 43 0b 00 00       	call   389d <printf>
+    exit();
+    2d5a:	e8 c1 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    2d5f:	83 ec 08             	sub    $0x8,%esp
+    2d62:	68 a1 49 00 00       	push   $0x49a1
+    2d67:	ff 35 80 53 00 00    	push   0x5380
+    2d6d:	e8 2b 0b 00 00       	call   389d <printf>
+    exit();
+    2d72:	e8 a9 09 00 00       	call   3720 <exit>
+    exit();
+    2d77:	e8 a4 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    2d7c:	83 ec 08             	sub    $0x8,%esp
+    2d7f:	68 e4 50 00 00       	push   $0x50e4
+    2d84:	ff 35 80 53 00 00    	push   0x5380
+    2d8a:	e8 0e 0b 00 00       	call   389d <printf>
+    exit();
+    2d8f:	e8 8c 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    2d94:	83 ec 08             	sub    $0x8,%esp
+    2d97:	68 bd 49 00 00       	push   $0x49bd
+    2d9c:	ff 35 80 53 00 00    	push   0x5380
+    2da2:	e8 f6 0a 00 00       	call   389d <printf>
+    exit();
+    2da7:	e8 74 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    2dac:	50                   	push   %eax
+    2dad:	53                   	push   %ebx
+    2dae:	68 24 51 00 00       	push   $0x5124
+    2db3:	ff 35 80 53 00 00    	push   0x5380
+    2db9:	e8 df 0a 00 00       	call   389d <printf>
+    exit();
+    2dbe:	e8 5d 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    2dc3:	56                   	push   %esi
+    2dc4:	53                   	push   %ebx
+    2dc5:	68 5c 51 00 00       	push   $0x515c
+    2dca:	ff 35 80 53 00 00    	push   0x5380
+    2dd0:	e8 c8 0a 00 00       	call   389d <printf>
+    exit();
+    2dd5:	e8 46 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    2dda:	83 ec 08             	sub    $0x8,%esp
+    2ddd:	68 84 51 00 00       	push   $0x5184
+    2de2:	ff 35 80 53 00 00    	push   0x5380
+    2de8:	e8 b0 0a 00 00       	call   389d <printf>
+    exit();
+    2ded:	e8 2e 09 00 00       	call   3720 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    2df2:	50                   	push   %eax
+    2df3:	53                   	push   %ebx
+    2df4:	68 b4 51 00 00       	push   $0x51b4
+    2df9:	ff 35 80 53 00 00    	push   0x5380
+    2dff:	e8 99 0a 00 00       	call   389d <printf>
+    exit();
+    2e04:	e8 17 09 00 00       	call   3720 <exit>
+      printf(stdout, "fork failed\n");
+    2e09:	83 ec 08             	sub    $0x8,%esp
+    2e0c:	68 b5 4a 00 00       	push   $0x4ab5
+    2e11:	ff 35 80 53 00 00    	push   0x5380
+    2e17:	e8 81 0a 00 00       	call   389d <printf>
+      exit();
+    2e1c:	e8 ff 08 00 00       	call   3720 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    2e21:	0f be 03             	movsbl (%ebx),%eax
+    2e24:	50                   	push   %eax
+    2e25:	53                   	push   %ebx
+    2e26:	68 d8 49 00 00       	push   $0x49d8
+    2e2b:	ff 35 80 53 00 00    	push   0x5380
+    2e31:	e8 67 0a 00 00       	call   389d <printf>
+      kill(ppid);
+    2e36:	89 34 24             	mov    %esi,(%esp)
+    2e39:	e8 12 09 00 00       	call   3750 <kill>
+      exit();
+    2e3e:	e8 dd 08 00 00       	call   3720 <exit>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    2e43:	83 ec 0c             	sub    $0xc,%esp
+    2e46:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2e49:	50                   	push   %eax
+    2e4a:	e8 e1 08 00 00       	call   3730 <pipe>
+    2e4f:	89 c3                	mov    %eax,%ebx
+    2e51:	83 c4 10             	add    $0x10,%esp
+    2e54:	85 c0                	test   %eax,%eax
+    2e56:	75 04                	jne    2e5c <sbrktest+0x2f6>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2e58:	89 c6                	mov    %eax,%esi
+    2e5a:	eb 59                	jmp    2eb5 <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    2e5c:	83 ec 08             	sub    $0x8,%esp
+    2e5f:	68 ad 3e 00 00       	push   $0x3ead
+    2e64:	6a 01                	push   $0x1
+    2e66:	e8 32 0a 00 00       	call   389d <printf>
+    exit();
+    2e6b:	e8 b0 08 00 00       	call   3720 <exit>
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    2e70:	83 ec 0c             	sub    $0xc,%esp
+    2e73:	6a 00                	push   $0x0
+    2e75:	e8 2e 09 00 00       	call   37a8 <sbrk>
+    2e7a:	89 c2                	mov    %eax,%edx
+    2e7c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2e81:	29 d0                	sub    %edx,%eax
+    2e83:	89 04 24             	mov    %eax,(%esp)
+    2e86:	e8 1d 09 00 00       	call   37a8 <sbrk>
+      write(fds[1], "x", 1);
+    2e8b:	83 c4 0c             	add    $0xc,%esp
+    2e8e:	6a 01                	push   $0x1
+    2e90:	68 cd 44 00 00       	push   $0x44cd
+    2e95:	ff 75 e4             	push   -0x1c(%ebp)
+    2e98:	e8 a3 08 00 00       	call   3740 <write>
+    2e9d:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    2ea0:	83 ec 0c             	sub    $0xc,%esp
+    2ea3:	68 e8 03 00 00       	push   $0x3e8
+    2ea8:	e8 03 09 00 00       	call   37b0 <sleep>
+    2ead:	83 c4 10             	add    $0x10,%esp
+    2eb0:	eb ee                	jmp    2ea0 <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2eb2:	83 c6 01             	add    $0x1,%esi
+    2eb5:	83 fe 09             	cmp    $0x9,%esi
+    2eb8:	77 28                	ja     2ee2 <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    2eba:	e8 59 08 00 00       	call   3718 <fork>
+    2ebf:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    2ec3:	85 c0                	test   %eax,%eax
+    2ec5:	74 a9                	je     2e70 <sbrktest+0x30a>
+    }
+    if(pids[i] != -1)
+    2ec7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2eca:	74 e6                	je     2eb2 <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    2ecc:	83 ec 04             	sub    $0x4,%esp
+    2ecf:	6a 01                	push   $0x1
+    2ed1:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2ed4:	50                   	push   %eax
+    2ed5:	ff 75 e0             	push   -0x20(%ebp)
+    2ed8:	e8 5b 08 00 00       	call   3738 <read>
+    2edd:	83 c4 10             	add    $0x10,%esp
+    2ee0:	eb d0                	jmp    2eb2 <sbrktest+0x34c>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    2ee2:	83 ec 0c             	sub    $0xc,%esp
+    2ee5:	68 00 10 00 00       	push   $0x1000
+    2eea:	e8 b9 08 00 00       	call   37a8 <sbrk>
+    2eef:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2ef1:	83 c4 10             	add    $0x10,%esp
+    2ef4:	eb 03                	jmp    2ef9 <sbrktest+0x393>
+    2ef6:	83 c3 01             	add    $0x1,%ebx
+    2ef9:	83 fb 09             	cmp    $0x9,%ebx
+    2efc:	77 1c                	ja     2f1a <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    2efe:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    2f02:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f05:	74 ef                	je     2ef6 <sbrktest+0x390>
+      continue;
+    kill(pids[i]);
+    2f07:	83 ec 0c             	sub    $0xc,%esp
+    2f0a:	50                   	push   %eax
+    2f0b:	e8 40 08 00 00       	call   3750 <kill>
+    wait();
+    2f10:	e8 13 08 00 00       	call   3728 <wait>
+    2f15:	83 c4 10             	add    $0x10,%esp
+    2f18:	eb dc                	jmp    2ef6 <sbrktest+0x390>
+  }
+  if(c == (char*)0xffffffff){
+    2f1a:	83 fe ff             	cmp    $0xffffffff,%esi
+    2f1d:	74 2f                	je     2f4e <sbrktest+0x3e8>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    2f1f:	83 ec 0c             	sub    $0xc,%esp
+    2f22:	6a 00                	push   $0x0
+    2f24:	e8 7f 08 00 00       	call   37a8 <sbrk>
+    2f29:	83 c4 10             	add    $0x10,%esp
+    2f2c:	39 c7                	cmp    %eax,%edi
+    2f2e:	72 36                	jb     2f66 <sbrktest+0x400>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    2f30:	83 ec 08             	sub    $0x8,%esp
+    2f33:	68 0c 4a 00 00       	push   $0x4a0c
+    2f38:	ff 35 80 53 00 00    	push   0x5380
+    2f3e:	e8 5a 09 00 00       	call   389d <printf>
+}
+    2f43:	83 c4 10             	add    $0x10,%esp
+    2f46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2f49:	5b                   	pop    %ebx
+    2f4a:	5e                   	pop    %esi
+    2f4b:	5f                   	pop    %edi
+    2f4c:	5d                   	pop    %ebp
+    2f4d:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    2f4e:	83 ec 08             	sub    $0x8,%esp
+    2f51:	68 f1 49 00 00       	push   $0x49f1
+    2f56:	ff 35 80 53 00 00    	push   0x5380
+    2f5c:	e8 3c 09 00 00       	call   389d <printf>
+    exit();
+    2f61:	e8 ba 07 00 00       	call   3720 <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    2f66:	83 ec 0c             	sub    $0xc,%esp
+    2f69:	6a 00                	push   $0x0
+    2f6b:	e8 38 08 00 00       	call   37a8 <sbrk>
+    2f70:	29 c7                	sub    %eax,%edi
+    2f72:	89 3c 24             	mov    %edi,(%esp)
+    2f75:	e8 2e 08 00 00       	call   37a8 <sbrk>
+    2f7a:	83 c4 10             	add    $0x10,%esp
+    2f7d:	eb b1                	jmp    2f30 <sbrktest+0x3ca>
+
+00002f7f <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    2f7f:	c3                   	ret
+
+00002f80 <validatetest>:
+
+void
+validatetest(void)
+{
+    2f80:	55                   	push   %ebp
+    2f81:	89 e5                	mov    %esp,%ebp
+    2f83:	56                   	push   %esi
+    2f84:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    2f85:	83 ec 08             	sub    $0x8,%esp
+    2f88:	68 1a 4a 00 00       	push   $0x4a1a
+    2f8d:	ff 35 80 53 00 00    	push   0x5380
+    2f93:	e8 05 09 00 00       	call   389d <printf>
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2f98:	83 c4 10             	add    $0x10,%esp
+    2f9b:	be 00 00 00 00       	mov    $0x0,%esi
+    2fa0:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    2fa6:	77 69                	ja     3011 <validatetest+0x91>
+    if((pid = fork()) == 0){
+    2fa8:	e8 6b 07 00 00       	call   3718 <fork>
+    2fad:	89 c3                	mov    %eax,%ebx
+    2faf:	85 c0                	test   %eax,%eax
+    2fb1:	74 41                	je     2ff4 <validatetest+0x74>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    2fb3:	83 ec 0c             	sub    $0xc,%esp
+    2fb6:	6a 00                	push   $0x0
+    2fb8:	e8 f3 07 00 00       	call   37b0 <sleep>
+    sleep(0);
+    2fbd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fc4:	e8 e7 07 00 00       	call   37b0 <sleep>
+    kill(pid);
+    2fc9:	89 1c 24             	mov    %ebx,(%esp)
+    2fcc:	e8 7f 07 00 00       	call   3750 <kill>
+    wait();
+    2fd1:	e8 52 07 00 00       	call   3728 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    2fd6:	83 c4 08             	add    $0x8,%esp
+    2fd9:	56                   	push   %esi
+    2fda:	68 29 4a 00 00       	push   $0x4a29
+    2fdf:	e8 9c 07 00 00       	call   3780 <link>
+    2fe4:	83 c4 10             	add    $0x10,%esp
+    2fe7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fea:	75 0d                	jne    2ff9 <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2fec:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    2ff2:	eb ac                	jmp    2fa0 <validatetest+0x20>
+      exit();
+    2ff4:	e8 27 07 00 00       	call   3720 <exit>
+      printf(stdout, "link should not succeed\n");
+    2ff9:	83 ec 08             	sub    $0x8,%esp
+    2ffc:	68 34 4a 00 00       	push   $0x4a34
+    3001:	ff 35 80 53 00 00    	push   0x5380
+    3007:	e8 91 08 00 00       	call   389d <printf>
+      exit();
+    300c:	e8 0f 07 00 00       	call   3720 <exit>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3011:	83 ec 08             	sub    $0x8,%esp
+    3014:	68 4d 4a 00 00       	push   $0x4a4d
+    3019:	ff 35 80 53 00 00    	push   0x5380
+    301f:	e8 79 08 00 00       	call   389d <printf>
+}
+    3024:	83 c4 10             	add    $0x10,%esp
+    3027:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    302a:	5b                   	pop    %ebx
+    302b:	5e                   	pop    %esi
+    302c:	5d                   	pop    %ebp
+    302d:	c3                   	ret
+
+0000302e <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    302e:	55                   	push   %ebp
+    302f:	89 e5                	mov    %esp,%ebp
+    3031:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3034:	68 5a 4a 00 00       	push   $0x4a5a
+    3039:	ff 35 80 53 00 00    	push   0x5380
+    303f:	e8 59 08 00 00       	call   389d <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+    3044:	83 c4 10             	add    $0x10,%esp
+    3047:	b8 00 00 00 00       	mov    $0x0,%eax
+    304c:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3051:	77 26                	ja     3079 <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+    3053:	80 b8 a0 53 00 00 00 	cmpb   $0x0,0x53a0(%eax)
+    305a:	75 05                	jne    3061 <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+    305c:	83 c0 01             	add    $0x1,%eax
+    305f:	eb eb                	jmp    304c <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+    3061:	83 ec 08             	sub    $0x8,%esp
+    3064:	68 64 4a 00 00       	push   $0x4a64
+    3069:	ff 35 80 53 00 00    	push   0x5380
+    306f:	e8 29 08 00 00       	call   389d <printf>
+      exit();
+    3074:	e8 a7 06 00 00       	call   3720 <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3079:	83 ec 08             	sub    $0x8,%esp
+    307c:	68 75 4a 00 00       	push   $0x4a75
+    3081:	ff 35 80 53 00 00    	push   0x5380
+    3087:	e8 11 08 00 00       	call   389d <printf>
+}
+    308c:	83 c4 10             	add    $0x10,%esp
+    308f:	c9                   	leave
+    3090:	c3                   	ret
+
+00003091 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3091:	55                   	push   %ebp
+    3092:	89 e5                	mov    %esp,%ebp
+    3094:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3097:	68 82 4a 00 00       	push   $0x4a82
+    309c:	e8 cf 06 00 00       	call   3770 <unlink>
+  pid = fork();
+    30a1:	e8 72 06 00 00       	call   3718 <fork>
+  if(pid == 0){
+    30a6:	83 c4 10             	add    $0x10,%esp
+    30a9:	85 c0                	test   %eax,%eax
+    30ab:	74 4d                	je     30fa <bigargtest+0x69>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    30ad:	0f 88 ad 00 00 00    	js     3160 <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    30b3:	e8 70 06 00 00       	call   3728 <wait>
+  fd = open("bigarg-ok", 0);
+    30b8:	83 ec 08             	sub    $0x8,%esp
+    30bb:	6a 00                	push   $0x0
+    30bd:	68 82 4a 00 00       	push   $0x4a82
+    30c2:	e8 99 06 00 00       	call   3760 <open>
+  if(fd < 0){
+    30c7:	83 c4 10             	add    $0x10,%esp
+    30ca:	85 c0                	test   %eax,%eax
+    30cc:	0f 88 a6 00 00 00    	js     3178 <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    30d2:	83 ec 0c             	sub    $0xc,%esp
+    30d5:	50                   	push   %eax
+    30d6:	e8 6d 06 00 00       	call   3748 <close>
+  unlink("bigarg-ok");
+    30db:	c7 04 24 82 4a 00 00 	movl   $0x4a82,(%esp)
+    30e2:	e8 89 06 00 00       	call   3770 <unlink>
+}
+    30e7:	83 c4 10             	add    $0x10,%esp
+    30ea:	c9                   	leave
+    30eb:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    30ec:	c7 04 85 c0 9a 00 00 	movl   $0x51d8,0x9ac0(,%eax,4)
+    30f3:	d8 51 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    30f7:	83 c0 01             	add    $0x1,%eax
+    30fa:	83 f8 1e             	cmp    $0x1e,%eax
+    30fd:	7e ed                	jle    30ec <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    30ff:	c7 05 3c 9b 00 00 00 	movl   $0x0,0x9b3c
+    3106:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3109:	83 ec 08             	sub    $0x8,%esp
+    310c:	68 8c 4a 00 00       	push   $0x4a8c
+    3111:	ff 35 80 53 00 00    	push   0x5380
+    3117:	e8 81 07 00 00       	call   389d <printf>
+    exec("echo", args);
+    311c:	83 c4 08             	add    $0x8,%esp
+    311f:	68 c0 9a 00 00       	push   $0x9ac0
+    3124:	68 59 3c 00 00       	push   $0x3c59
+    3129:	e8 2a 06 00 00       	call   3758 <exec>
+    printf(stdout, "bigarg test ok\n");
+    312e:	83 c4 08             	add    $0x8,%esp
+    3131:	68 99 4a 00 00       	push   $0x4a99
+    3136:	ff 35 80 53 00 00    	push   0x5380
+    313c:	e8 5c 07 00 00       	call   389d <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3141:	83 c4 08             	add    $0x8,%esp
+    3144:	68 00 02 00 00       	push   $0x200
+    3149:	68 82 4a 00 00       	push   $0x4a82
+    314e:	e8 0d 06 00 00       	call   3760 <open>
+    close(fd);
+    3153:	89 04 24             	mov    %eax,(%esp)
+    3156:	e8 ed 05 00 00       	call   3748 <close>
+    exit();
+    315b:	e8 c0 05 00 00       	call   3720 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3160:	83 ec 08             	sub    $0x8,%esp
+    3163:	68 a9 4a 00 00       	push   $0x4aa9
+    3168:	ff 35 80 53 00 00    	push   0x5380
+    316e:	e8 2a 07 00 00       	call   389d <printf>
+    exit();
+    3173:	e8 a8 05 00 00       	call   3720 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3178:	83 ec 08             	sub    $0x8,%esp
+    317b:	68 c2 4a 00 00       	push   $0x4ac2
+    3180:	ff 35 80 53 00 00    	push   0x5380
+    3186:	e8 12 07 00 00       	call   389d <printf>
+    exit();
+    318b:	e8 90 05 00 00       	call   3720 <exit>
+
+00003190 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    3190:	55                   	push   %ebp
+    3191:	89 e5                	mov    %esp,%ebp
+    3193:	57                   	push   %edi
+    3194:	56                   	push   %esi
+    3195:	53                   	push   %ebx
+    3196:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    3199:	68 d7 4a 00 00       	push   $0x4ad7
+    319e:	6a 01                	push   $0x1
+    31a0:	e8 f8 06 00 00       	call   389d <printf>
+    31a5:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    31a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    31ad:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    31b1:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    31b6:	89 d8                	mov    %ebx,%eax
+    31b8:	f7 ea                	imul   %edx
+    31ba:	c1 fa 06             	sar    $0x6,%edx
+    31bd:	89 de                	mov    %ebx,%esi
+    31bf:	c1 fe 1f             	sar    $0x1f,%esi
+    31c2:	29 f2                	sub    %esi,%edx
+    31c4:	8d 42 30             	lea    0x30(%edx),%eax
+    31c7:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    31ca:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    31d0:	89 d9                	mov    %ebx,%ecx
+    31d2:	29 d1                	sub    %edx,%ecx
+    31d4:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    31d9:	89 c8                	mov    %ecx,%eax
+    31db:	f7 ef                	imul   %edi
+    31dd:	c1 fa 05             	sar    $0x5,%edx
+    31e0:	c1 f9 1f             	sar    $0x1f,%ecx
+    31e3:	29 ca                	sub    %ecx,%edx
+    31e5:	83 c2 30             	add    $0x30,%edx
+    31e8:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    31eb:	89 d8                	mov    %ebx,%eax
+    31ed:	f7 ef                	imul   %edi
+    31ef:	89 d7                	mov    %edx,%edi
+    31f1:	c1 ff 05             	sar    $0x5,%edi
+    31f4:	29 f7                	sub    %esi,%edi
+    31f6:	6b c7 64             	imul   $0x64,%edi,%eax
+    31f9:	89 df                	mov    %ebx,%edi
+    31fb:	29 c7                	sub    %eax,%edi
+    31fd:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3202:	89 f8                	mov    %edi,%eax
+    3204:	f7 e9                	imul   %ecx
+    3206:	c1 fa 02             	sar    $0x2,%edx
+    3209:	c1 ff 1f             	sar    $0x1f,%edi
+    320c:	29 fa                	sub    %edi,%edx
+    320e:	83 c2 30             	add    $0x30,%edx
+    3211:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3214:	89 d8                	mov    %ebx,%eax
+    3216:	f7 e9                	imul   %ecx
+    3218:	c1 fa 02             	sar    $0x2,%edx
+    321b:	29 f2                	sub    %esi,%edx
+    321d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3220:	01 c0                	add    %eax,%eax
+    3222:	89 da                	mov    %ebx,%edx
+    3224:	29 c2                	sub    %eax,%edx
+    3226:	83 c2 30             	add    $0x30,%edx
+    3229:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    322c:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    3230:	83 ec 04             	sub    $0x4,%esp
+    3233:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3236:	56                   	push   %esi
+    3237:	68 e4 4a 00 00       	push   $0x4ae4
+    323c:	6a 01                	push   $0x1
+    323e:	e8 5a 06 00 00       	call   389d <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3243:	83 c4 08             	add    $0x8,%esp
+    3246:	68 02 02 00 00       	push   $0x202
+    324b:	56                   	push   %esi
+    324c:	e8 0f 05 00 00       	call   3760 <open>
+    3251:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3253:	83 c4 10             	add    $0x10,%esp
+    3256:	85 c0                	test   %eax,%eax
+    3258:	79 1b                	jns    3275 <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    325a:	83 ec 04             	sub    $0x4,%esp
+    325d:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3260:	50                   	push   %eax
+    3261:	68 f0 4a 00 00       	push   $0x4af0
+    3266:	6a 01                	push   $0x1
+    3268:	e8 30 06 00 00       	call   389d <printf>
+      break;
+    326d:	83 c4 10             	add    $0x10,%esp
+    3270:	e9 e6 00 00 00       	jmp    335b <fsfull+0x1cb>
+    }
+    int total = 0;
+    3275:	bf 00 00 00 00       	mov    $0x0,%edi
+    while(1){
+      int cc = write(fd, buf, 512);
+    327a:	83 ec 04             	sub    $0x4,%esp
+    327d:	68 00 02 00 00       	push   $0x200
+    3282:	68 c0 7a 00 00       	push   $0x7ac0
+    3287:	56                   	push   %esi
+    3288:	e8 b3 04 00 00       	call   3740 <write>
+      if(cc < 512)
+    328d:	83 c4 10             	add    $0x10,%esp
+    3290:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3295:	7e 04                	jle    329b <fsfull+0x10b>
+        break;
+      total += cc;
+    3297:	01 c7                	add    %eax,%edi
+    while(1){
+    3299:	eb df                	jmp    327a <fsfull+0xea>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    329b:	83 ec 04             	sub    $0x4,%esp
+    329e:	57                   	push   %edi
+    329f:	68 00 4b 00 00       	push   $0x4b00
+    32a4:	6a 01                	push   $0x1
+    32a6:	e8 f2 05 00 00       	call   389d <printf>
+    close(fd);
+    32ab:	89 34 24             	mov    %esi,(%esp)
+    32ae:	e8 95 04 00 00       	call   3748 <close>
+    if(total == 0)
+    32b3:	83 c4 10             	add    $0x10,%esp
+    32b6:	85 ff                	test   %edi,%edi
+    32b8:	0f 84 9d 00 00 00    	je     335b <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    32be:	83 c3 01             	add    $0x1,%ebx
+    32c1:	e9 e7 fe ff ff       	jmp    31ad <fsfull+0x1d>
+      break;
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    32c6:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    32ca:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    32cf:	89 d8                	mov    %ebx,%eax
+    32d1:	f7 ea                	imul   %edx
+    32d3:	c1 fa 06             	sar    $0x6,%edx
+    32d6:	89 de                	mov    %ebx,%esi
+    32d8:	c1 fe 1f             	sar    $0x1f,%esi
+    32db:	29 f2                	sub    %esi,%edx
+    32dd:	8d 42 30             	lea    0x30(%edx),%eax
+    32e0:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    32e3:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    32e9:	89 d9                	mov    %ebx,%ecx
+    32eb:	29 d1                	sub    %edx,%ecx
+    32ed:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    32f2:	89 c8                	mov    %ecx,%eax
+    32f4:	f7 ef                	imul   %edi
+    32f6:	c1 fa 05             	sar    $0x5,%edx
+    32f9:	c1 f9 1f             	sar    $0x1f,%ecx
+    32fc:	29 ca                	sub    %ecx,%edx
+    32fe:	83 c2 30             	add    $0x30,%edx
+    3301:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3304:	89 d8                	mov    %ebx,%eax
+    3306:	f7 ef                	imul   %edi
+    3308:	89 d7                	mov    %edx,%edi
+    330a:	c1 ff 05             	sar    $0x5,%edi
+    330d:	29 f7                	sub    %esi,%edi
+    330f:	6b c7 64             	imul   $0x64,%edi,%eax
+    3312:	89 df                	mov    %ebx,%edi
+    3314:	29 c7                	sub    %eax,%edi
+    3316:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    331b:	89 f8                	mov    %edi,%eax
+    331d:	f7 e9                	imul   %ecx
+    331f:	c1 fa 02             	sar    $0x2,%edx
+    3322:	c1 ff 1f             	sar    $0x1f,%edi
+    3325:	29 fa                	sub    %edi,%edx
+    3327:	83 c2 30             	add    $0x30,%edx
+    332a:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    332d:	89 d8                	mov    %ebx,%eax
+    332f:	f7 e9                	imul   %ecx
+    3331:	c1 fa 02             	sar    $0x2,%edx
+    3334:	29 f2                	sub    %esi,%edx
+    3336:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3339:	01 c0                	add    %eax,%eax
+    333b:	89 da                	mov    %ebx,%edx
+    333d:	29 c2                	sub    %eax,%edx
+    333f:	83 c2 30             	add    $0x30,%edx
+    3342:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3345:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    3349:	83 ec 0c             	sub    $0xc,%esp
+    334c:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    334f:	50                   	push   %eax
+    3350:	e8 1b 04 00 00       	call   3770 <unlink>
+    nfiles--;
+    3355:	83 eb 01             	sub    $0x1,%ebx
+    3358:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    335b:	85 db                	test   %ebx,%ebx
+    335d:	0f 89 63 ff ff ff    	jns    32c6 <fsfull+0x136>
+  }
+
+  printf(1, "fsfull test finished\n");
+    3363:	83 ec 08             	sub    $0x8,%esp
+    3366:	68 10 4b 00 00       	push   $0x4b10
+    336b:	6a 01                	push   $0x1
+    336d:	e8 2b 05 00 00       	call   389d <printf>
+}
+    3372:	83 c4 10             	add    $0x10,%esp
+    3375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3378:	5b                   	pop    %ebx
+    3379:	5e                   	pop    %esi
+    337a:	5f                   	pop    %edi
+    337b:	5d                   	pop    %ebp
+    337c:	c3                   	ret
+
+0000337d <uio>:
+
+void
+uio()
+{
+    337d:	55                   	push   %ebp
+    337e:	89 e5                	mov    %esp,%ebp
+    3380:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    3383:	68 26 4b 00 00       	push   $0x4b26
+    3388:	6a 01                	push   $0x1
+    338a:	e8 0e 05 00 00       	call   389d <printf>
+  pid = fork();
+    338f:	e8 84 03 00 00       	call   3718 <fork>
+  if(pid == 0){
+    3394:	83 c4 10             	add    $0x10,%esp
+    3397:	85 c0                	test   %eax,%eax
+    3399:	74 1b                	je     33b6 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    339b:	78 3e                	js     33db <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    339d:	e8 86 03 00 00       	call   3728 <wait>
+  printf(1, "uio test done\n");
+    33a2:	83 ec 08             	sub    $0x8,%esp
+    33a5:	68 30 4b 00 00       	push   $0x4b30
+    33aa:	6a 01                	push   $0x1
+    33ac:	e8 ec 04 00 00       	call   389d <printf>
+}
+    33b1:	83 c4 10             	add    $0x10,%esp
+    33b4:	c9                   	leave
+    33b5:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    33b6:	b8 09 00 00 00       	mov    $0x9,%eax
+    33bb:	ba 70 00 00 00       	mov    $0x70,%edx
+    33c0:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    33c1:	ba 71 00 00 00       	mov    $0x71,%edx
+    33c6:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    33c7:	83 ec 08             	sub    $0x8,%esp
+    33ca:	68 b8 52 00 00       	push   $0x52b8
+    33cf:	6a 01                	push   $0x1
+    33d1:	e8 c7 04 00 00       	call   389d <printf>
+    exit();
+    33d6:	e8 45 03 00 00       	call   3720 <exit>
+    printf (1, "fork failed\n");
+    33db:	83 ec 08             	sub    $0x8,%esp
+    33de:	68 b5 4a 00 00       	push   $0x4ab5
+    33e3:	6a 01                	push   $0x1
+    33e5:	e8 b3 04 00 00       	call   389d <printf>
+    exit();
+    33ea:	e8 31 03 00 00       	call   3720 <exit>
+
+000033ef <argptest>:
+
+void argptest()
+{
+    33ef:	55                   	push   %ebp
+    33f0:	89 e5                	mov    %esp,%ebp
+    33f2:	53                   	push   %ebx
+    33f3:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    33f6:	6a 00                	push   $0x0
+    33f8:	68 3f 4b 00 00       	push   $0x4b3f
+    33fd:	e8 5e 03 00 00       	call   3760 <open>
+  if (fd < 0) {
+    3402:	83 c4 10             	add    $0x10,%esp
+    3405:	85 c0                	test   %eax,%eax
+    3407:	78 3a                	js     3443 <argptest+0x54>
+    3409:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    340b:	83 ec 0c             	sub    $0xc,%esp
+    340e:	6a 00                	push   $0x0
+    3410:	e8 93 03 00 00       	call   37a8 <sbrk>
+    3415:	83 e8 01             	sub    $0x1,%eax
+    3418:	83 c4 0c             	add    $0xc,%esp
+    341b:	6a ff                	push   $0xffffffff
+    341d:	50                   	push   %eax
+    341e:	53                   	push   %ebx
+    341f:	e8 14 03 00 00       	call   3738 <read>
+  close(fd);
+    3424:	89 1c 24             	mov    %ebx,(%esp)
+    3427:	e8 1c 03 00 00       	call   3748 <close>
+  printf(1, "arg test passed\n");
+    342c:	83 c4 08             	add    $0x8,%esp
+    342f:	68 51 4b 00 00       	push   $0x4b51
+    3434:	6a 01                	push   $0x1
+    3436:	e8 62 04 00 00       	call   389d <printf>
+}
+    343b:	83 c4 10             	add    $0x10,%esp
+    343e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3441:	c9                   	leave
+    3442:	c3                   	ret
+    printf(2, "open failed\n");
+    3443:	83 ec 08             	sub    $0x8,%esp
+    3446:	68 44 4b 00 00       	push   $0x4b44
+    344b:	6a 02                	push   $0x2
+    344d:	e8 4b 04 00 00       	call   389d <printf>
+    exit();
+    3452:	e8 c9 02 00 00       	call   3720 <exit>
+
+00003457 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    3457:	69 05 7c 53 00 00 0d 	imul   $0x19660d,0x537c,%eax
+    345e:	66 19 00 
+    3461:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3466:	a3 7c 53 00 00       	mov    %eax,0x537c
+  return randstate;
+}
+    346b:	c3                   	ret
+
+0000346c <main>:
+
+int
+main(int argc, char *argv[])
+{
+    346c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    3470:	83 e4 f0             	and    $0xfffffff0,%esp
+    3473:	ff 71 fc             	push   -0x4(%ecx)
+    3476:	55                   	push   %ebp
+    3477:	89 e5                	mov    %esp,%ebp
+    3479:	51                   	push   %ecx
+    347a:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    347d:	68 62 4b 00 00       	push   $0x4b62
+    3482:	6a 01                	push   $0x1
+    3484:	e8 14 04 00 00       	call   389d <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    3489:	83 c4 08             	add    $0x8,%esp
+    348c:	6a 00                	push   $0x0
+    348e:	68 76 4b 00 00       	push   $0x4b76
+    3493:	e8 c8 02 00 00       	call   3760 <open>
+    3498:	83 c4 10             	add    $0x10,%esp
+    349b:	85 c0                	test   %eax,%eax
+    349d:	78 14                	js     34b3 <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    349f:	83 ec 08             	sub    $0x8,%esp
+    34a2:	68 dc 52 00 00       	push   $0x52dc
+    34a7:	6a 01                	push   $0x1
+    34a9:	e8 ef 03 00 00       	call   389d <printf>
+    exit();
+    34ae:	e8 6d 02 00 00       	call   3720 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    34b3:	83 ec 08             	sub    $0x8,%esp
+    34b6:	68 00 02 00 00       	push   $0x200
+    34bb:	68 76 4b 00 00       	push   $0x4b76
+    34c0:	e8 9b 02 00 00       	call   3760 <open>
+    34c5:	89 04 24             	mov    %eax,(%esp)
+    34c8:	e8 7b 02 00 00       	call   3748 <close>
+
+  argptest();
+    34cd:	e8 1d ff ff ff       	call   33ef <argptest>
+  createdelete();
+    34d2:	e8 3b db ff ff       	call   1012 <createdelete>
+  linkunlink();
+    34d7:	e8 d4 e3 ff ff       	call   18b0 <linkunlink>
+  concreate();
+    34dc:	e8 e5 e0 ff ff       	call   15c6 <concreate>
+  fourfiles();
+    34e1:	e8 46 d9 ff ff       	call   e2c <fourfiles>
+  sharedfd();
+    34e6:	e8 a4 d7 ff ff       	call   c8f <sharedfd>
+
+  bigargtest();
+    34eb:	e8 a1 fb ff ff       	call   3091 <bigargtest>
+  bigwrite();
+    34f0:	e8 31 ed ff ff       	call   2226 <bigwrite>
+  bigargtest();
+    34f5:	e8 97 fb ff ff       	call   3091 <bigargtest>
+  bsstest();
+    34fa:	e8 2f fb ff ff       	call   302e <bsstest>
+  sbrktest();
+    34ff:	e8 62 f6 ff ff       	call   2b66 <sbrktest>
+  validatetest();
+    3504:	e8 77 fa ff ff       	call   2f80 <validatetest>
+
+  opentest();
+    3509:	e8 9e cd ff ff       	call   2ac <opentest>
+  writetest();
+    350e:	e8 2c ce ff ff       	call   33f <writetest>
+  writetest1();
+    3513:	e8 ef cf ff ff       	call   507 <writetest1>
+  createtest();
+    3518:	e8 9a d1 ff ff       	call   6b7 <createtest>
+
+  openiputtest();
+    351d:	e8 a1 cc ff ff       	call   1c3 <openiputtest>
+  exitiputtest();
+    3522:	e8 b6 cb ff ff       	call   dd <exitiputtest>
+  iputtest();
+    3527:	e8 d4 ca ff ff       	call   0 <iputtest>
+
+  mem();
+    352c:	e8 a3 d6 ff ff       	call   bd4 <mem>
+  pipe1();
+    3531:	e8 53 d3 ff ff       	call   889 <pipe1>
+  preempt();
+    3536:	e8 ee d4 ff ff       	call   a29 <preempt>
+  exitwait();
+    353b:	e8 24 d6 ff ff       	call   b64 <exitwait>
+
+  rmdot();
+    3540:	e8 a6 f0 ff ff       	call   25eb <rmdot>
+  fourteen();
+    3545:	e8 64 ef ff ff       	call   24ae <fourteen>
+  bigfile();
+    354a:	e8 a9 ed ff ff       	call   22f8 <bigfile>
+  subdir();
+    354f:	e8 a4 e5 ff ff       	call   1af8 <subdir>
+  linktest();
+    3554:	e8 47 de ff ff       	call   13a0 <linktest>
+  unlinkread();
+    3559:	e8 a9 dc ff ff       	call   1207 <unlinkread>
+  dirfile();
+    355e:	e8 0d f2 ff ff       	call   2770 <dirfile>
+  iref();
+    3563:	e8 22 f4 ff ff       	call   298a <iref>
+  forktest();
+    3568:	e8 45 f5 ff ff       	call   2ab2 <forktest>
+  bigdir(); // slow
+    356d:	e8 32 e4 ff ff       	call   19a4 <bigdir>
+
+  uio();
+    3572:	e8 06 fe ff ff       	call   337d <uio>
+
+  exectest();
+    3577:	e8 c4 d2 ff ff       	call   840 <exectest>
+
+  exit();
+    357c:	e8 9f 01 00 00       	call   3720 <exit>
+
+00003581 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    3581:	55                   	push   %ebp
+    3582:	89 e5                	mov    %esp,%ebp
+    3584:	56                   	push   %esi
+    3585:	53                   	push   %ebx
+    3586:	8b 75 08             	mov    0x8(%ebp),%esi
+    3589:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    358c:	89 f0                	mov    %esi,%eax
+    358e:	89 d1                	mov    %edx,%ecx
+    3590:	83 c2 01             	add    $0x1,%edx
+    3593:	89 c3                	mov    %eax,%ebx
+    3595:	83 c0 01             	add    $0x1,%eax
+    3598:	0f b6 09             	movzbl (%ecx),%ecx
+    359b:	88 0b                	mov    %cl,(%ebx)
+    359d:	84 c9                	test   %cl,%cl
+    359f:	75 ed                	jne    358e <strcpy+0xd>
+    ;
+  return os;
+}
+    35a1:	89 f0                	mov    %esi,%eax
+    35a3:	5b                   	pop    %ebx
+    35a4:	5e                   	pop    %esi
+    35a5:	5d                   	pop    %ebp
+    35a6:	c3                   	ret
+
+000035a7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    35a7:	55                   	push   %ebp
+    35a8:	89 e5                	mov    %esp,%ebp
+    35aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    35ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    35b0:	eb 06                	jmp    35b8 <strcmp+0x11>
+    p++, q++;
+    35b2:	83 c1 01             	add    $0x1,%ecx
+    35b5:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    35b8:	0f b6 01             	movzbl (%ecx),%eax
+    35bb:	84 c0                	test   %al,%al
+    35bd:	74 04                	je     35c3 <strcmp+0x1c>
+    35bf:	3a 02                	cmp    (%edx),%al
+    35c1:	74 ef                	je     35b2 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    35c3:	0f b6 c0             	movzbl %al,%eax
+    35c6:	0f b6 12             	movzbl (%edx),%edx
+    35c9:	29 d0                	sub    %edx,%eax
+}
+    35cb:	5d                   	pop    %ebp
+    35cc:	c3                   	ret
+
+000035cd <strlen>:
+
+uint
+strlen(const char *s)
+{
+    35cd:	55                   	push   %ebp
+    35ce:	89 e5                	mov    %esp,%ebp
+    35d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    35d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    35d8:	eb 03                	jmp    35dd <strlen+0x10>
+    35da:	83 c0 01             	add    $0x1,%eax
+    35dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    35e1:	75 f7                	jne    35da <strlen+0xd>
+    ;
+  return n;
+}
+    35e3:	5d                   	pop    %ebp
+    35e4:	c3                   	ret
+
+000035e5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    35e5:	55                   	push   %ebp
+    35e6:	89 e5                	mov    %esp,%ebp
+    35e8:	57                   	push   %edi
+    35e9:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    35ec:	89 d7                	mov    %edx,%edi
+    35ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    35f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+    35f4:	fc                   	cld
+    35f5:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    35f7:	89 d0                	mov    %edx,%eax
+    35f9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    35fc:	c9                   	leave
+    35fd:	c3                   	ret
+
+000035fe <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    35fe:	55                   	push   %ebp
+    35ff:	89 e5                	mov    %esp,%ebp
+    3601:	8b 45 08             	mov    0x8(%ebp),%eax
+    3604:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3608:	eb 03                	jmp    360d <strchr+0xf>
+    360a:	83 c0 01             	add    $0x1,%eax
+    360d:	0f b6 10             	movzbl (%eax),%edx
+    3610:	84 d2                	test   %dl,%dl
+    3612:	74 06                	je     361a <strchr+0x1c>
+    if(*s == c)
+    3614:	38 ca                	cmp    %cl,%dl
+    3616:	75 f2                	jne    360a <strchr+0xc>
+    3618:	eb 05                	jmp    361f <strchr+0x21>
+      return (char*)s;
+  return 0;
+    361a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    361f:	5d                   	pop    %ebp
+    3620:	c3                   	ret
+
+00003621 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3621:	55                   	push   %ebp
+    3622:	89 e5                	mov    %esp,%ebp
+    3624:	57                   	push   %edi
+    3625:	56                   	push   %esi
+    3626:	53                   	push   %ebx
+    3627:	83 ec 1c             	sub    $0x1c,%esp
+    362a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    362d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3632:	89 de                	mov    %ebx,%esi
+    3634:	83 c3 01             	add    $0x1,%ebx
+    3637:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    363a:	7d 2e                	jge    366a <gets+0x49>
+    cc = read(0, &c, 1);
+    363c:	83 ec 04             	sub    $0x4,%esp
+    363f:	6a 01                	push   $0x1
+    3641:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3644:	50                   	push   %eax
+    3645:	6a 00                	push   $0x0
+    3647:	e8 ec 00 00 00       	call   3738 <read>
+    if(cc < 1)
+    364c:	83 c4 10             	add    $0x10,%esp
+    364f:	85 c0                	test   %eax,%eax
+    3651:	7e 17                	jle    366a <gets+0x49>
+      break;
+    buf[i++] = c;
+    3653:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3657:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    365a:	3c 0a                	cmp    $0xa,%al
+    365c:	0f 94 c2             	sete   %dl
+    365f:	3c 0d                	cmp    $0xd,%al
+    3661:	0f 94 c0             	sete   %al
+    3664:	08 c2                	or     %al,%dl
+    3666:	74 ca                	je     3632 <gets+0x11>
+    buf[i++] = c;
+    3668:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    366a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    366e:	89 f8                	mov    %edi,%eax
+    3670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3673:	5b                   	pop    %ebx
+    3674:	5e                   	pop    %esi
+    3675:	5f                   	pop    %edi
+    3676:	5d                   	pop    %ebp
+    3677:	c3                   	ret
+
+00003678 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3678:	55                   	push   %ebp
+    3679:	89 e5                	mov    %esp,%ebp
+    367b:	56                   	push   %esi
+    367c:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    367d:	83 ec 08             	sub    $0x8,%esp
+    3680:	6a 00                	push   $0x0
+    3682:	ff 75 08             	push   0x8(%ebp)
+    3685:	e8 d6 00 00 00       	call   3760 <open>
+  if(fd < 0)
+    368a:	83 c4 10             	add    $0x10,%esp
+    368d:	85 c0                	test   %eax,%eax
+    368f:	78 24                	js     36b5 <stat+0x3d>
+    3691:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    3693:	83 ec 08             	sub    $0x8,%esp
+    3696:	ff 75 0c             	push   0xc(%ebp)
+    3699:	50                   	push   %eax
+    369a:	e8 d9 00 00 00       	call   3778 <fstat>
+    369f:	89 c6                	mov    %eax,%esi
+  close(fd);
+    36a1:	89 1c 24             	mov    %ebx,(%esp)
+    36a4:	e8 9f 00 00 00       	call   3748 <close>
+  return r;
+    36a9:	83 c4 10             	add    $0x10,%esp
+}
+    36ac:	89 f0                	mov    %esi,%eax
+    36ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    36b1:	5b                   	pop    %ebx
+    36b2:	5e                   	pop    %esi
+    36b3:	5d                   	pop    %ebp
+    36b4:	c3                   	ret
+    return -1;
+    36b5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    36ba:	eb f0                	jmp    36ac <stat+0x34>
+
+000036bc <atoi>:
+
+int
+atoi(const char *s)
+{
+    36bc:	55                   	push   %ebp
+    36bd:	89 e5                	mov    %esp,%ebp
+    36bf:	53                   	push   %ebx
+    36c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+    36c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+    36c8:	eb 10                	jmp    36da <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+    36ca:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+    36cd:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+    36d0:	83 c1 01             	add    $0x1,%ecx
+    36d3:	0f be c0             	movsbl %al,%eax
+    36d6:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+    36da:	0f b6 01             	movzbl (%ecx),%eax
+    36dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    36e0:	80 fb 09             	cmp    $0x9,%bl
+    36e3:	76 e5                	jbe    36ca <atoi+0xe>
+  return n;
+}
+    36e5:	89 d0                	mov    %edx,%eax
+    36e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    36ea:	c9                   	leave
+    36eb:	c3                   	ret
+
+000036ec <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    36ec:	55                   	push   %ebp
+    36ed:	89 e5                	mov    %esp,%ebp
+    36ef:	56                   	push   %esi
+    36f0:	53                   	push   %ebx
+    36f1:	8b 75 08             	mov    0x8(%ebp),%esi
+    36f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    36f7:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+    36fa:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+    36fc:	eb 0d                	jmp    370b <memmove+0x1f>
+    *dst++ = *src++;
+    36fe:	0f b6 01             	movzbl (%ecx),%eax
+    3701:	88 02                	mov    %al,(%edx)
+    3703:	8d 49 01             	lea    0x1(%ecx),%ecx
+    3706:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+    3709:	89 d8                	mov    %ebx,%eax
+    370b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    370e:	85 c0                	test   %eax,%eax
+    3710:	7f ec                	jg     36fe <memmove+0x12>
+  return vdst;
+}
+    3712:	89 f0                	mov    %esi,%eax
+    3714:	5b                   	pop    %ebx
+    3715:	5e                   	pop    %esi
+    3716:	5d                   	pop    %ebp
+    3717:	c3                   	ret
+
+00003718 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3718:	b8 01 00 00 00       	mov    $0x1,%eax
+    371d:	cd 40                	int    $0x40
+    371f:	c3                   	ret
+
+00003720 <exit>:
+SYSCALL(exit)
+    3720:	b8 02 00 00 00       	mov    $0x2,%eax
+    3725:	cd 40                	int    $0x40
+    3727:	c3                   	ret
+
+00003728 <wait>:
+SYSCALL(wait)
+    3728:	b8 03 00 00 00       	mov    $0x3,%eax
+    372d:	cd 40                	int    $0x40
+    372f:	c3                   	ret
+
+00003730 <pipe>:
+SYSCALL(pipe)
+    3730:	b8 04 00 00 00       	mov    $0x4,%eax
+    3735:	cd 40                	int    $0x40
+    3737:	c3                   	ret
+
+00003738 <read>:
+SYSCALL(read)
+    3738:	b8 05 00 00 00       	mov    $0x5,%eax
+    373d:	cd 40                	int    $0x40
+    373f:	c3                   	ret
+
+00003740 <write>:
+SYSCALL(write)
+    3740:	b8 10 00 00 00       	mov    $0x10,%eax
+    3745:	cd 40                	int    $0x40
+    3747:	c3                   	ret
+
+00003748 <close>:
+SYSCALL(close)
+    3748:	b8 15 00 00 00       	mov    $0x15,%eax
+    374d:	cd 40                	int    $0x40
+    374f:	c3                   	ret
+
+00003750 <kill>:
+SYSCALL(kill)
+    3750:	b8 06 00 00 00       	mov    $0x6,%eax
+    3755:	cd 40                	int    $0x40
+    3757:	c3                   	ret
+
+00003758 <exec>:
+SYSCALL(exec)
+    3758:	b8 07 00 00 00       	mov    $0x7,%eax
+    375d:	cd 40                	int    $0x40
+    375f:	c3                   	ret
+
+00003760 <open>:
+SYSCALL(open)
+    3760:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3765:	cd 40                	int    $0x40
+    3767:	c3                   	ret
+
+00003768 <mknod>:
+SYSCALL(mknod)
+    3768:	b8 11 00 00 00       	mov    $0x11,%eax
+    376d:	cd 40                	int    $0x40
+    376f:	c3                   	ret
+
+00003770 <unlink>:
+SYSCALL(unlink)
+    3770:	b8 12 00 00 00       	mov    $0x12,%eax
+    3775:	cd 40                	int    $0x40
+    3777:	c3                   	ret
+
+00003778 <fstat>:
+SYSCALL(fstat)
+    3778:	b8 08 00 00 00       	mov    $0x8,%eax
+    377d:	cd 40                	int    $0x40
+    377f:	c3                   	ret
+
+00003780 <link>:
+SYSCALL(link)
+    3780:	b8 13 00 00 00       	mov    $0x13,%eax
+    3785:	cd 40                	int    $0x40
+    3787:	c3                   	ret
+
+00003788 <mkdir>:
+SYSCALL(mkdir)
+    3788:	b8 14 00 00 00       	mov    $0x14,%eax
+    378d:	cd 40                	int    $0x40
+    378f:	c3                   	ret
+
+00003790 <chdir>:
+SYSCALL(chdir)
+    3790:	b8 09 00 00 00       	mov    $0x9,%eax
+    3795:	cd 40                	int    $0x40
+    3797:	c3                   	ret
+
+00003798 <dup>:
+SYSCALL(dup)
+    3798:	b8 0a 00 00 00       	mov    $0xa,%eax
+    379d:	cd 40                	int    $0x40
+    379f:	c3                   	ret
+
+000037a0 <getpid>:
+SYSCALL(getpid)
+    37a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+    37a5:	cd 40                	int    $0x40
+    37a7:	c3                   	ret
+
+000037a8 <sbrk>:
+SYSCALL(sbrk)
+    37a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+    37ad:	cd 40                	int    $0x40
+    37af:	c3                   	ret
+
+000037b0 <sleep>:
+SYSCALL(sleep)
+    37b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+    37b5:	cd 40                	int    $0x40
+    37b7:	c3                   	ret
+
+000037b8 <uptime>:
+SYSCALL(uptime)
+    37b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+    37bd:	cd 40                	int    $0x40
+    37bf:	c3                   	ret
+
+000037c0 <yield>:
+SYSCALL(yield)
+    37c0:	b8 16 00 00 00       	mov    $0x16,%eax
+    37c5:	cd 40                	int    $0x40
+    37c7:	c3                   	ret
+
+000037c8 <shutdown>:
+SYSCALL(shutdown)
+    37c8:	b8 17 00 00 00       	mov    $0x17,%eax
+    37cd:	cd 40                	int    $0x40
+    37cf:	c3                   	ret
+
+000037d0 <nicefork>:
+SYSCALL(nicefork)
+    37d0:	b8 18 00 00 00       	mov    $0x18,%eax
+    37d5:	cd 40                	int    $0x40
+    37d7:	c3                   	ret
+
+000037d8 <schedlog>:
+SYSCALL(schedlog)
+    37d8:	b8 19 00 00 00       	mov    $0x19,%eax
+    37dd:	cd 40                	int    $0x40
+    37df:	c3                   	ret
+
+000037e0 <schedstat>:
+SYSCALL(schedstat)
+    37e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    37e5:	cd 40                	int    $0x40
+    37e7:	c3                   	ret
+
+000037e8 <spawn>:
+SYSCALL(spawn)
+    37e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    37ed:	cd 40                	int    $0x40
+    37ef:	c3                   	ret
+
+000037f0 <bstat>:
+SYSCALL(bstat)
+    37f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    37f5:	cd 40                	int    $0x40
+    37f7:	c3                   	ret
+
+000037f8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    37f8:	55                   	push   %ebp
+    37f9:	89 e5                	mov    %esp,%ebp
+    37fb:	83 ec 1c             	sub    $0x1c,%esp
+    37fe:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+    3801:	6a 01                	push   $0x1
+    3803:	8d 55 f4             	lea    -0xc(%ebp),%edx
+    3806:	52                   	push   %edx
+    3807:	50                   	push   %eax
+    3808:	e8 33 ff ff ff       	call   3740 <write>
+}
+    380d:	83 c4 10             	add    $0x10,%esp
+    3810:	c9                   	leave
+    3811:	c3                   	ret
+
+00003812 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3812:	55                   	push   %ebp
+    3813:	89 e5                	mov    %esp,%ebp
+    3815:	57                   	push   %edi
+    3816:	56                   	push   %esi
+    3817:	53                   	push   %ebx
+    3818:	83 ec 2c             	sub    $0x2c,%esp
+    381b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    381e:	89 d0                	mov    %edx,%eax
+    3820:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    3822:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    3826:	0f 95 c1             	setne  %cl
+    3829:	c1 ea 1f             	shr    $0x1f,%edx
+    382c:	84 d1                	test   %dl,%cl
+    382e:	74 44                	je     3874 <printint+0x62>
+    neg = 1;
+    x = -xx;
+    3830:	f7 d8                	neg    %eax
+    3832:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    3834:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    383b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    3840:	89 c8                	mov    %ecx,%eax
+    3842:	ba 00 00 00 00       	mov    $0x0,%edx
+    3847:	f7 f6                	div    %esi
+    3849:	89 df                	mov    %ebx,%edi
+    384b:	83 c3 01             	add    $0x1,%ebx
+    384e:	0f b6 92 68 53 00 00 	movzbl 0x5368(%edx),%edx
+    3855:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    3859:	89 ca                	mov    %ecx,%edx
+    385b:	89 c1                	mov    %eax,%ecx
+    385d:	39 f2                	cmp    %esi,%edx
+    385f:	73 df                	jae    3840 <printint+0x2e>
+  if(neg)
+    3861:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    3865:	74 31                	je     3898 <printint+0x86>
+    buf[i++] = '-';
+    3867:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    386c:	8d 5f 02             	lea    0x2(%edi),%ebx
+    386f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    3872:	eb 17                	jmp    388b <printint+0x79>
+    x = xx;
+    3874:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    3876:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    387d:	eb bc                	jmp    383b <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    387f:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    3884:	89 f0                	mov    %esi,%eax
+    3886:	e8 6d ff ff ff       	call   37f8 <putc>
+  while(--i >= 0)
+    388b:	83 eb 01             	sub    $0x1,%ebx
+    388e:	79 ef                	jns    387f <printint+0x6d>
+}
+    3890:	83 c4 2c             	add    $0x2c,%esp
+    3893:	5b                   	pop    %ebx
+    3894:	5e                   	pop    %esi
+    3895:	5f                   	pop    %edi
+    3896:	5d                   	pop    %ebp
+    3897:	c3                   	ret
+    3898:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    389b:	eb ee                	jmp    388b <printint+0x79>
+
+0000389d <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    389d:	55                   	push   %ebp
+    389e:	89 e5                	mov    %esp,%ebp
+    38a0:	57                   	push   %edi
+    38a1:	56                   	push   %esi
+    38a2:	53                   	push   %ebx
+    38a3:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    38a6:	8d 45 10             	lea    0x10(%ebp),%eax
+    38a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    38ac:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    38b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    38b6:	eb 14                	jmp    38cc <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    38b8:	89 fa                	mov    %edi,%edx
+    38ba:	8b 45 08             	mov    0x8(%ebp),%eax
+    38bd:	e8 36 ff ff ff       	call   37f8 <putc>
+    38c2:	eb 05                	jmp    38c9 <printf+0x2c>
+      }
+    } else if(state == '%'){
+    38c4:	83 fe 25             	cmp    $0x25,%esi
+    38c7:	74 25                	je     38ee <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    38c9:	83 c3 01             	add    $0x1,%ebx
+    38cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    38cf:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    38d3:	84 c0                	test   %al,%al
+    38d5:	0f 84 4a 01 00 00    	je     3a25 <printf+0x188>
+    c = fmt[i] & 0xff;
+    38db:	0f be f8             	movsbl %al,%edi
+    38de:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    38e1:	85 f6                	test   %esi,%esi
+    38e3:	75 df                	jne    38c4 <printf+0x27>
+      if(c == '%'){
+    38e5:	83 f8 25             	cmp    $0x25,%eax
+    38e8:	75 ce                	jne    38b8 <printf+0x1b>
+        state = '%';
+    38ea:	89 c6                	mov    %eax,%esi
+    38ec:	eb db                	jmp    38c9 <printf+0x2c>
+      if(c == 'd'){
+    38ee:	83 f8 25             	cmp    $0x25,%eax
+    38f1:	0f 84 f9 00 00 00    	je     39f0 <printf+0x153>
+    38f7:	0f 8c 07 01 00 00    	jl     3a04 <printf+0x167>
+    38fd:	83 f8 78             	cmp    $0x78,%eax
+    3900:	0f 8f fe 00 00 00    	jg     3a04 <printf+0x167>
+    3906:	83 f8 63             	cmp    $0x63,%eax
+    3909:	0f 8c f5 00 00 00    	jl     3a04 <printf+0x167>
+    390f:	83 e8 63             	sub    $0x63,%eax
+    3912:	83 f8 15             	cmp    $0x15,%eax
+    3915:	0f 87 e9 00 00 00    	ja     3a04 <printf+0x167>
+    391b:	ff 24 85 10 53 00 00 	jmp    *0x5310(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    3922:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3925:	8b 17                	mov    (%edi),%edx
+    3927:	83 ec 0c             	sub    $0xc,%esp
+    392a:	6a 01                	push   $0x1
+    392c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3931:	8b 45 08             	mov    0x8(%ebp),%eax
+    3934:	e8 d9 fe ff ff       	call   3812 <printint>
+        ap++;
+    3939:	83 c7 04             	add    $0x4,%edi
+    393c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    393f:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    3942:	be 00 00 00 00       	mov    $0x0,%esi
+    3947:	eb 80                	jmp    38c9 <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+    3949:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    394c:	8b 17                	mov    (%edi),%edx
+    394e:	83 ec 0c             	sub    $0xc,%esp
+    3951:	6a 00                	push   $0x0
+    3953:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3958:	8b 45 08             	mov    0x8(%ebp),%eax
+    395b:	e8 b2 fe ff ff       	call   3812 <printint>
+        ap++;
+    3960:	83 c7 04             	add    $0x4,%edi
+    3963:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3966:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3969:	be 00 00 00 00       	mov    $0x0,%esi
+    396e:	e9 56 ff ff ff       	jmp    38c9 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    3973:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3976:	8b 17                	mov    (%edi),%edx
+    3978:	83 ec 0c             	sub    $0xc,%esp
+    397b:	6a 00                	push   $0x0
+    397d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3982:	8b 45 08             	mov    0x8(%ebp),%eax
+    3985:	e8 88 fe ff ff       	call   3812 <printint>
+        ap++;
+    398a:	83 c7 04             	add    $0x4,%edi
+    398d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3990:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3993:	be 00 00 00 00       	mov    $0x0,%esi
+    3998:	e9 2c ff ff ff       	jmp    38c9 <printf+0x2c>
+        s = (char*)*ap;
+    399d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    39a0:	8b 30                	mov    (%eax),%esi
+        ap++;
+    39a2:	83 c0 04             	add    $0x4,%eax
+    39a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    39a8:	85 f6                	test   %esi,%esi
+    39aa:	75 15                	jne    39c1 <printf+0x124>
+          s = "(null)";
+    39ac:	be 06 53 00 00       	mov    $0x5306,%esi
+    39b1:	eb 0e                	jmp    39c1 <printf+0x124>
+          putc(fd, *s);
+    39b3:	0f be d2             	movsbl %dl,%edx
+    39b6:	8b 45 08             	mov    0x8(%ebp),%eax
+    39b9:	e8 3a fe ff ff       	call   37f8 <putc>
+          s++;
+    39be:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    39c1:	0f b6 16             	movzbl (%esi),%edx
+    39c4:	84 d2                	test   %dl,%dl
+    39c6:	75 eb                	jne    39b3 <printf+0x116>
+      state = 0;
+    39c8:	be 00 00 00 00       	mov    $0x0,%esi
+    39cd:	e9 f7 fe ff ff       	jmp    38c9 <printf+0x2c>
+        putc(fd, *ap);
+    39d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    39d5:	0f be 17             	movsbl (%edi),%edx
+    39d8:	8b 45 08             	mov    0x8(%ebp),%eax
+    39db:	e8 18 fe ff ff       	call   37f8 <putc>
+        ap++;
+    39e0:	83 c7 04             	add    $0x4,%edi
+    39e3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    39e6:	be 00 00 00 00       	mov    $0x0,%esi
+    39eb:	e9 d9 fe ff ff       	jmp    38c9 <printf+0x2c>
+        putc(fd, c);
+    39f0:	89 fa                	mov    %edi,%edx
+    39f2:	8b 45 08             	mov    0x8(%ebp),%eax
+    39f5:	e8 fe fd ff ff       	call   37f8 <putc>
+      state = 0;
+    39fa:	be 00 00 00 00       	mov    $0x0,%esi
+    39ff:	e9 c5 fe ff ff       	jmp    38c9 <printf+0x2c>
+        putc(fd, '%');
+    3a04:	ba 25 00 00 00       	mov    $0x25,%edx
+    3a09:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a0c:	e8 e7 fd ff ff       	call   37f8 <putc>
+        putc(fd, c);
+    3a11:	89 fa                	mov    %edi,%edx
+    3a13:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a16:	e8 dd fd ff ff       	call   37f8 <putc>
+      state = 0;
+    3a1b:	be 00 00 00 00       	mov    $0x0,%esi
+    3a20:	e9 a4 fe ff ff       	jmp    38c9 <printf+0x2c>
+    }
+  }
+}
+    3a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a28:	5b                   	pop    %ebx
+    3a29:	5e                   	pop    %esi
+    3a2a:	5f                   	pop    %edi
+    3a2b:	5d                   	pop    %ebp
+    3a2c:	c3                   	ret
+
+00003a2d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3a2d:	55                   	push   %ebp
+    3a2e:	89 e5                	mov    %esp,%ebp
+    3a30:	57                   	push   %edi
+    3a31:	56                   	push   %esi
+    3a32:	53                   	push   %ebx
+    3a33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3a36:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3a39:	a1 40 9b 00 00       	mov    0x9b40,%eax
+    3a3e:	eb 02                	jmp    3a42 <free+0x15>
+    3a40:	89 d0                	mov    %edx,%eax
+    3a42:	39 c8                	cmp    %ecx,%eax
+    3a44:	73 04                	jae    3a4a <free+0x1d>
+    3a46:	3b 08                	cmp    (%eax),%ecx
+    3a48:	72 12                	jb     3a5c <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3a4a:	8b 10                	mov    (%eax),%edx
+    3a4c:	39 d0                	cmp    %edx,%eax
+    3a4e:	72 f0                	jb     3a40 <free+0x13>
+    3a50:	39 c8                	cmp    %ecx,%eax
+    3a52:	72 08                	jb     3a5c <free+0x2f>
+    3a54:	39 d1                	cmp    %edx,%ecx
+    3a56:	72 04                	jb     3a5c <free+0x2f>
+    3a58:	89 d0                	mov    %edx,%eax
+    3a5a:	eb e6                	jmp    3a42 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3a5c:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3a5f:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3a62:	8b 10                	mov    (%eax),%edx
+    3a64:	39 d7                	cmp    %edx,%edi
+    3a66:	74 19                	je     3a81 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    3a68:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    3a6b:	8b 50 04             	mov    0x4(%eax),%edx
+    3a6e:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    3a71:	39 ce                	cmp    %ecx,%esi
+    3a73:	74 1b                	je     3a90 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    3a75:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    3a77:	a3 40 9b 00 00       	mov    %eax,0x9b40
+}
+    3a7c:	5b                   	pop    %ebx
+    3a7d:	5e                   	pop    %esi
+    3a7e:	5f                   	pop    %edi
+    3a7f:	5d                   	pop    %ebp
+    3a80:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    3a81:	03 72 04             	add    0x4(%edx),%esi
+    3a84:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3a87:	8b 10                	mov    (%eax),%edx
+    3a89:	8b 12                	mov    (%edx),%edx
+    3a8b:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    3a8e:	eb db                	jmp    3a6b <free+0x3e>
+    p->s.size += bp->s.size;
+    3a90:	03 53 fc             	add    -0x4(%ebx),%edx
+    3a93:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    3a96:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    3a99:	89 10                	mov    %edx,(%eax)
+    3a9b:	eb da                	jmp    3a77 <free+0x4a>
+
+00003a9d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    3a9d:	55                   	push   %ebp
+    3a9e:	89 e5                	mov    %esp,%ebp
+    3aa0:	53                   	push   %ebx
+    3aa1:	83 ec 04             	sub    $0x4,%esp
+    3aa4:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    3aa6:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    3aab:	77 05                	ja     3ab2 <morecore+0x15>
+    nu = 4096;
+    3aad:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3ab2:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    3ab9:	83 ec 0c             	sub    $0xc,%esp
+    3abc:	50                   	push   %eax
+    3abd:	e8 e6 fc ff ff       	call   37a8 <sbrk>
+  if(p == (char*)-1)
+    3ac2:	83 c4 10             	add    $0x10,%esp
+    3ac5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ac8:	74 1c                	je     3ae6 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    3aca:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    3acd:	83 c0 08             	add    $0x8,%eax
+    3ad0:	83 ec 0c             	sub    $0xc,%esp
+    3ad3:	50                   	push   %eax
+    3ad4:	e8 54 ff ff ff       	call   3a2d <free>
+  return freep;
+    3ad9:	a1 40 9b 00 00       	mov    0x9b40,%eax
+    3ade:	83 c4 10             	add    $0x10,%esp
+}
+    3ae1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ae4:	c9                   	leave
+    3ae5:	c3                   	ret
+    return 0;
+    3ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+    3aeb:	eb f4                	jmp    3ae1 <morecore+0x44>
+
+00003aed <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    3aed:	55                   	push   %ebp
+    3aee:	89 e5                	mov    %esp,%ebp
+    3af0:	53                   	push   %ebx
+    3af1:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3af4:	8b 45 08             	mov    0x8(%ebp),%eax
+    3af7:	8d 58 07             	lea    0x7(%eax),%ebx
+    3afa:	c1 eb 03             	shr    $0x3,%ebx
+    3afd:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    3b00:	8b 0d 40 9b 00 00    	mov    0x9b40,%ecx
+    3b06:	85 c9                	test   %ecx,%ecx
+    3b08:	74 04                	je     3b0e <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3b0a:	8b 01                	mov    (%ecx),%eax
+    3b0c:	eb 4a                	jmp    3b58 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    3b0e:	c7 05 40 9b 00 00 44 	movl   $0x9b44,0x9b40
+    3b15:	9b 00 00 
+    3b18:	c7 05 44 9b 00 00 44 	movl   $0x9b44,0x9b44
+    3b1f:	9b 00 00 
+    base.s.size = 0;
+    3b22:	c7 05 48 9b 00 00 00 	movl   $0x0,0x9b48
+    3b29:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    3b2c:	b9 44 9b 00 00       	mov    $0x9b44,%ecx
+    3b31:	eb d7                	jmp    3b0a <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    3b33:	74 19                	je     3b4e <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    3b35:	29 da                	sub    %ebx,%edx
+    3b37:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    3b3a:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    3b3d:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    3b40:	89 0d 40 9b 00 00    	mov    %ecx,0x9b40
+      return (void*)(p + 1);
+    3b46:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    3b49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b4c:	c9                   	leave
+    3b4d:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    3b4e:	8b 10                	mov    (%eax),%edx
+    3b50:	89 11                	mov    %edx,(%ecx)
+    3b52:	eb ec                	jmp    3b40 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3b54:	89 c1                	mov    %eax,%ecx
+    3b56:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    3b58:	8b 50 04             	mov    0x4(%eax),%edx
+    3b5b:	39 da                	cmp    %ebx,%edx
+    3b5d:	73 d4                	jae    3b33 <malloc+0x46>
+    if(p == freep)
+    3b5f:	39 05 40 9b 00 00    	cmp    %eax,0x9b40
+    3b65:	75 ed                	jne    3b54 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    3b67:	89 d8                	mov    %ebx,%eax
+    3b69:	e8 2f ff ff ff       	call   3a9d <morecore>
+    3b6e:	85 c0                	test   %eax,%eax
+    3b70:	75 e2                	jne    3b54 <malloc+0x67>
+    3b72:	eb d5                	jmp    3b49 <malloc+0x5c>
@@ -1347,7 +1347,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // more than NINODE, so cached inodes get recycled too
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1374,8 +1374,11 @@ iref(void)
 }
 
 // test that fork fails gracefully
-// the forktest binary also does this, but it runs out of proc entries first.
-// inside the bigger usertests binary, we run out of memory first.
+// the forktest binary also does this. Forked children share their
+// pages copy-on-write, so either proc entries or memory may run out
+// first; asking for more than NPROC makes sure one of them does.
+#define NFORK (NPROC + 100)
+
 void
 forktest(void)
 {
@@ -1383,7 +1386,7 @@ forktest(void)
 
   printf(1, "fork test\n");
 
-  for(n=0; n<1000; n++){
+  for(n=0; n<NFORK; n++){
     pid = fork();
     if(pid < 0)
       break;
@@ -1391,8 +1394,8 @@ forktest(void)
       exit();
   }
 
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
+  if(n == NFORK){
+    printf(1, "fork claimed to work %d times!\n", NFORK);
     exit();
   }
 
@@ -0,0 +1,297 @@
+// Legacy virtio-blk driver, for QEMU's virtio-blk-pci device.
+// Build with make DISK=virtio instead of ide.c; like memide.c it
+// serves only the file system disk (ROOTDEV), behind the same
+// interface. Many requests can be in flight at once, one per
+// three descriptors of the virtqueue, and the device completes
+// them in any order.
+//
+// Interrupts are coalesced with the EVENT_IDX feature: while a
+// process sleeps on a request the device interrupts at the next
+// completion, but requests that nobody waits for (read-ahead)
+// only interrupt once the last of them completes.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define SECTOR_SIZE  512
+#define MAXQSIZE     256            // Largest virtqueue we have memory for
+#define MAXREQ       (MAXQSIZE/3)   // Three descriptors per request
+
+// Virtqueue memory: descriptors and available ring,
+// then the used ring from the next page boundary.
+static char vqmem[3*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+// Request slot i uses descriptors 3i, 3i+1 and 3i+2.
+static struct vreq {
+  struct virtio_blk_req hdr;
+  uchar status;
+  struct buf *b;  // 0 if the slot is free
+} vreq[MAXREQ];
+
+static struct {
+  struct spinlock lock;
+  int base;         // I/O base
+  int qsize;
+  int nreq;
+  uint capacity;    // In sectors
+  int eventidx;     // Device honours *usedevent
+  volatile struct vring_desc *desc;
+  volatile struct vring_avail *avail;
+  volatile struct vring_used *used;
+  volatile ushort *usedevent;
+  ushort usedidx;   // Next used entry to process
+  int ninflight;
+  int nwait;        // In-flight requests a process sleeps on
+  struct buf *pending;  // Waiting for a free slot, through qnext
+} vd;
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint features;
+  int n;
+
+  initlock(&vd.lock, "virtio");
+  if(pcifind(VIRTIO_VENDOR, VIRTIO_DEV_BLK, PCI_ANY, PCI_ANY, &d) < 0)
+    panic("virtio: no disk");
+  pcienable(&d);
+  vd.base = pcibar(&d, 0) & ~3;
+
+  outb(vd.base + VIRTIO_STATUS, 0);  // reset
+  outb(vd.base + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER);
+  features = inl(vd.base + VIRTIO_FEATURES) & (1 << VIRTIO_F_EVENT_IDX);
+  outl(vd.base + VIRTIO_GFEATURES, features);
+  vd.eventidx = features != 0;
+
+  outw(vd.base + VIRTIO_QSEL, 0);
+  vd.qsize = inw(vd.base + VIRTIO_QSIZE);
+  if(vd.qsize < 3 || vd.qsize > MAXQSIZE)
+    panic("virtio: queue size");
+  vd.nreq = vd.qsize / 3;
+
+  n = sizeof(struct vring_desc) * vd.qsize + sizeof(ushort) * (3 + vd.qsize);
+  vd.desc = (struct vring_desc*)vqmem;
+  vd.avail = (struct vring_avail*)(vqmem + sizeof(struct vring_desc) * vd.qsize);
+  vd.usedevent = &vd.avail->ring[vd.qsize];
+  vd.used = (struct vring_used*)(vqmem + PGROUNDUP(n));
+  outl(vd.base + VIRTIO_QADDR, V2P(vqmem) / VRING_ALIGN);
+
+  vd.capacity = inl(vd.base + VIRTIO_CONFIG);
+  outb(vd.base + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER | VIRTIO_ST_DRIVER_OK);
+
+  // Deliver the device's interrupt as IRQ_IDE, whatever
+  // line it is on, so that trap.c calls ideintr.
+  ioapicenablepci(d.irq, IRQ_IDE, ncpu - 1);
+}
+
+// Hand b to the device in free request slot i.
+static void
+vstart(int i, struct buf *b)
+{
+  struct vreq *r = &vreq[i];
+  volatile struct vring_desc *d = &vd.desc[3*i];
+  int write = (b->flags & B_DIRTY) != 0;
+
+  r->b = b;
+  r->hdr.type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  r->hdr.reserved = 0;
+  r->hdr.sector = b->blockno * (BSIZE/SECTOR_SIZE);
+  r->status = 0xff;
+
+  d[0].addr = V2P(&r->hdr);
+  d[0].len = sizeof(r->hdr);
+  d[0].flags = VRING_DESC_F_NEXT;
+  d[0].next = 3*i + 1;
+  d[1].addr = V2P(b->data);
+  d[1].len = BSIZE;
+  d[1].flags = VRING_DESC_F_NEXT | (write ? 0 : VRING_DESC_F_WRITE);
+  d[1].next = 3*i + 2;
+  d[2].addr = V2P(&r->status);
+  d[2].len = 1;
+  d[2].flags = VRING_DESC_F_WRITE;
+  d[2].next = 0;
+
+  vd.avail->ring[vd.avail->idx % vd.qsize] = 3*i;
+  __sync_synchronize();
+  vd.avail->idx++;
+  __sync_synchronize();
+  outw(vd.base + VIRTIO_QNOTIFY, 0);
+
+  vd.ninflight++;
+  if((b->flags & B_ASYNC) == 0)
+    vd.nwait++;
+}
+
+// Start b, or queue it if every request slot is busy.
+// Caller must hold vd.lock.
+static void
+vqueue(struct buf *b)
+{
+  struct buf **pp;
+  int i;
+
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->dev != ROOTDEV)
+    panic("iderw: request not for virtio disk");
+  if((b->blockno + 1) * (BSIZE/SECTOR_SIZE) > vd.capacity)
+    panic("iderw: block out of range");
+
+  for(i = 0; i < vd.nreq; i++){
+    if(vreq[i].b == 0){
+      vstart(i, b);
+      return;
+    }
+  }
+  b->qnext = 0;
+  for(pp = &vd.pending; *pp; pp = &(*pp)->qnext)
+    ;
+  *pp = b;
+}
+
+// Complete every request the device has finished and start
+// pending ones in the freed slots, then tell the device when
+// to interrupt next. Returns the completed bufs that nobody
+// waits for, linked through qnext, for the caller to release
+// with bdone once it has dropped vd.lock.
+static struct buf*
+vdrain(void)
+{
+  struct buf *b, *done;
+  struct vreq *r;
+  int i;
+
+  done = 0;
+  for(;;){
+    while(vd.usedidx != vd.used->idx){
+      __sync_synchronize();
+      i = vd.used->ring[vd.usedidx % vd.qsize].id / 3;
+      vd.usedidx++;
+      r = &vreq[i];
+      b = r->b;
+      if(r->status != VIRTIO_BLK_S_OK)
+        panic("virtio: I/O error");
+      r->b = 0;
+      vd.ninflight--;
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+      if(b->flags & B_ASYNC){
+        b->flags &= ~B_ASYNC;
+        b->qnext = done;
+        done = b;
+      } else {
+        vd.nwait--;
+        wakeup(b);
+      }
+      if(vd.pending){
+        b = vd.pending;
+        vd.pending = b->qnext;
+        vstart(i, b);
+      }
+    }
+    if(vd.eventidx){
+      // Interrupt after this many more completions, less one.
+      *vd.usedevent = vd.usedidx +
+        (vd.nwait || vd.ninflight == 0 ? 0 : vd.ninflight - 1);
+      __sync_synchronize();
+    }
+    // Catch completions that raced with setting usedevent.
+    if(vd.used->idx == vd.usedidx)
+      return done;
+  }
+}
+
+static void
+vrelease(struct buf *done)
+{
+  struct buf *next;
+
+  for(; done; done = next){
+    next = done->qnext;
+    bdone(done);
+  }
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *done;
+
+  acquire(&vd.lock);
+  inb(vd.base + VIRTIO_ISR);
+  done = vdrain();
+  release(&vd.lock);
+  vrelease(done);
+}
+
+//PAGEBREAK!
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  struct buf *done;
+
+  acquire(&vd.lock);
+  vqueue(b);
+  // Make sure the device interrupts for b.
+  done = vdrain();
+  release(&vd.lock);
+  vrelease(done);
+
+  // Wait for request to finish.
+  acquire(&vd.lock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vd.lock);
+  release(&vd.lock);
+}
+
+// Like iderw for n bufs at once.
+void
+iderwv(struct buf **b, int n)
+{
+  struct buf *done;
+  int i;
+
+  acquire(&vd.lock);
+  for(i = 0; i < n; i++)
+    vqueue(b[i]);
+  done = vdrain();
+  release(&vd.lock);
+  vrelease(done);
+
+  acquire(&vd.lock);
+  for(i = 0; i < n; i++)
+    while((b[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(b[i], &vd.lock);
+  release(&vd.lock);
+}
+
+// Like iderw, but return as soon as b is queued. The driver
+// releases b with bdone when the request completes, so the
+// caller must not touch b after submitting it.
+void
+idesubmit(struct buf *b)
+{
+  acquire(&vd.lock);
+  b->flags |= B_ASYNC;
+  vqueue(b);
+  release(&vd.lock);
+}
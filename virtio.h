@@ -0,0 +1,66 @@
+// Legacy virtio PCI devices, as far as the block driver needs.
+// http://docs.oasis-open.org/virtio/virtio/v1.0/virtio-v1.0.html
+// (section 4.1.4.8, "Legacy Interfaces")
+
+#define VIRTIO_VENDOR       0x1af4
+#define VIRTIO_DEV_BLK      0x1001  // Transitional block device
+
+// I/O registers, at an offset from BAR 0.
+#define VIRTIO_FEATURES     0x00  // Device features (32 bits)
+#define VIRTIO_GFEATURES    0x04  // Features the driver accepts
+#define VIRTIO_QADDR        0x08  // Page number of the selected queue
+#define VIRTIO_QSIZE        0x0c  // Entries in the selected queue (16 bits)
+#define VIRTIO_QSEL         0x0e  // Queue selector (16 bits)
+#define VIRTIO_QNOTIFY      0x10  // Queue notify (16 bits)
+#define VIRTIO_STATUS       0x12  // Device status (8 bits)
+#define VIRTIO_ISR          0x13  // Interrupt status; reading acknowledges
+#define VIRTIO_CONFIG       0x14  // Device-specific configuration
+
+// Device status bits.
+#define VIRTIO_ST_ACK       1
+#define VIRTIO_ST_DRIVER    2
+#define VIRTIO_ST_DRIVER_OK 4
+#define VIRTIO_ST_FAILED    128
+
+// Feature bits.
+#define VIRTIO_F_EVENT_IDX  29  // used_event and avail_event
+
+// Split virtqueue. The legacy layout puts the used ring at the
+// first page boundary after the available ring.
+#define VRING_ALIGN         4096
+
+struct vring_desc {
+  uint64 addr;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VRING_DESC_F_NEXT   1
+#define VRING_DESC_F_WRITE  2  // Device writes (vs reads) the buffer
+
+struct vring_avail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];  // Followed by used_event
+};
+
+struct vring_used_elem {
+  uint id;        // Head descriptor of the completed chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;
+  struct vring_used_elem ring[];  // Followed by avail_event
+};
+
+// Block request header, device-readable.
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint64 sector;
+};
+#define VIRTIO_BLK_T_IN     0
+#define VIRTIO_BLK_T_OUT    1
+#define VIRTIO_BLK_S_OK     0
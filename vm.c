@@ -42,10 +42,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -85,6 +84,14 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // page protection bits prevent user code from using the kernel's
 // mappings.
 //
+// The kernel half of every page table is shared: kvmalloc() builds
+// it once in kpgdir, and setupkvm() copies its page directory
+// entries, so all address spaces point at the same kernel page
+// tables. Physical memory above the first 4MB is direct-mapped
+// with 4MB (PTE_PS) pages, which need no page tables at all.
+// Kernel mappings are global (PTE_G), so switching address
+// spaces only flushes user translations from the TLB.
+//
 // setupkvm() and exec() set up every page table like this:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
@@ -102,45 +109,73 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
+#define BIGPGSIZE (PGSIZE*NPTENTRIES)  // bytes mapped by a PTE_PS entry
+
 static struct kmap {
   void *virt;
   uint phys_start;
   uint phys_end;
   int perm;
 } kmap[] = {
- { (void*)KERNBASE, 0,               EXTMEM,      PTE_W}, // I/O space
- { (void*)KERNLINK, V2P_C(KERNLINK), V2P_C(data), 0},     // kern text+rodata
- { (void*)data,     V2P_C(data),     PHYSTOP,     PTE_W}, // kern data+memory
- { (void*)DEVSPACE, DEVSPACE,        0,           PTE_W}, // more devices
+ { (void*)KERNBASE, 0,               EXTMEM,      PTE_W|PTE_G}, // I/O space
+ { (void*)KERNLINK, V2P_C(KERNLINK), V2P_C(data), PTE_G},       // kern text+rodata
+ { (void*)data,     V2P_C(data),     BIGPGSIZE,   PTE_W|PTE_G}, // kern data+memory
+ { P2V_C(BIGPGSIZE), BIGPGSIZE,      PHYSTOP,     PTE_W|PTE_G|PTE_PS}, // memory
+ { (void*)DEVSPACE, DEVSPACE,        0,           PTE_W|PTE_G|PTE_PS}, // more devices
 };
 
-// Set up kernel part of a page table.
+// Map [va, va+size) to pa with 4MB pages; all three
+// must be 4MB-aligned.
+static void
+mapbig(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+  char *a, *last;
+
+  if((uint)va % BIGPGSIZE || size % BIGPGSIZE || pa % BIGPGSIZE)
+    panic("mapbig");
+  last = va + size - BIGPGSIZE;
+  for(a = va;; a += BIGPGSIZE, pa += BIGPGSIZE){
+    if(pgdir[PDX(a)] & PTE_P)
+      panic("remap");
+    pgdir[PDX(a)] = pa | perm | PTE_P;
+    if(a == last)
+      break;
+  }
+}
+
+// Set up kernel part of a page table by sharing kpgdir's.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, holding the kernel page tables
+// every other page table shares.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  if((kpgdir = (pde_t*)kalloc_zeroed()) == 0)
+    panic("kvmalloc");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+    if(k->perm & PTE_PS)
+      mapbig(kpgdir, k->virt, k->phys_end - k->phys_start,
+             k->phys_start, k->perm);
+    else if(mappages(kpgdir, k->virt, k->phys_end - k->phys_start,
+                     (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc");
+  }
   switchkvm();
 }
 
@@ -156,12 +191,23 @@ switchkvm(void)
 void
 switchuvm(struct proc *p)
 {
-  if(p == 0)
-    panic("switchuvm: no process");
-  if(p->kstack == 0)
-    panic("switchuvm: no kstack");
+  pushcli();
+  switchtss(p);
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+  popcli();
+}
+
+// Switch TSS to process p's kernel stack, leaving the page
+// table alone (the scheduler loads it only when it changes).
+void
+switchtss(struct proc *p)
+{
+  if(p == 0)
+    panic("switchtss: no process");
+  if(p->kstack == 0)
+    panic("switchtss: no kstack");
 
   pushcli();
   mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
@@ -173,7 +219,6 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
 
@@ -186,8 +231,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -231,13 +275,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -279,7 +322,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part. The kernel part is shared (see setupkvm).
 void
 freevm(pde_t *pgdir)
 {
@@ -288,7 +331,7 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -311,39 +354,135 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. Pages are shared copy-on-write:
+// writable ones become read-only PTE_COW in both tables,
+// and cowfault() copies them when either side writes.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+    // Heap pages not touched yet stay unmapped in the child too.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
+    kref(P2V(pa));
   }
+  // The parent lost write access to its pages.
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
   return d;
 
 bad:
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Resolve a write fault at va on a copy-on-write page:
+// copy the page, or just make it writable again if no
+// one else shares it any more. Returns -1 if va is not
+// a copy-on-write page or memory ran out.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem, *old;
+
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcount(old) == 1){
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(old);
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// Handle a page fault at va in p, from user space or from
+// the kernel touching p's memory. Fills in copy-on-write
+// pages on a write, and demand-zero heap pages (see growproc)
+// below p->sz on first touch. Returns -1 if the fault was real.
+int
+pgfault(struct proc *p, uint va, uint err)
+{
+  struct vmseg *s;
+  char *mem;
+  uint perm, n;
+
+  if(err & FEC_PR)
+    return (err & FEC_WR) ? cowfault(p->pgdir, va) : -1;
+  if(va >= p->sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  mem = 0;
+  perm = PTE_W|PTE_U;
+  // Program pages come from the executable page cache, shared
+  // with every other process running the same file.
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+    if(va < s->va || va - s->va >= s->filesz)
+      continue;
+    n = s->filesz - (va - s->va);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    if((mem = pcget(p->exeip, s->off + (va - s->va), n)) == 0)
+      return -1;
+    perm = s->writable ? PTE_U|PTE_COW : PTE_U;
+    break;
+  }
+  if(mem == 0 && (mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Make sure the n bytes of p's memory at va are mapped, so
+// that the kernel can use them while holding locks: faulting
+// in a program page may have to sleep reading the file.
+// If write is set, also check that the user could write them,
+// since the kernel writing a read-only page is a kernel fault.
+int
+prefault(struct proc *p, uint va, uint n, int write)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && pgfault(p, a, 0) < 0)
+      return -1;
+    if(write){
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+      if(!(*pte & PTE_U) || !(*pte & (PTE_W|PTE_COW)))
+        return -1;
+    }
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +491,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -362,15 +501,21 @@ uva2ka(pde_t *pgdir, char *uva)
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// Writes through the kernel mapping don't fault, so
+// copy-on-write pages are broken here first.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
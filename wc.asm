@@ -0,0 +1,963 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+   9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  10:	be 00 00 00 00       	mov    $0x0,%esi
+  15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  1c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  23:	83 ec 04             	sub    $0x4,%esp
+  26:	68 00 02 00 00       	push   $0x200
+  2b:	68 c0 06 00 00       	push   $0x6c0
+  30:	ff 75 08             	push   0x8(%ebp)
+  33:	e8 e3 02 00 00       	call   31b <read>
+  38:	89 c7                	mov    %eax,%edi
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	85 c0                	test   %eax,%eax
+  3f:	7e 54                	jle    95 <wc+0x95>
+    for(i=0; i<n; i++){
+  41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  46:	eb 22                	jmp    6a <wc+0x6a>
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	0f be c0             	movsbl %al,%eax
+  4e:	50                   	push   %eax
+  4f:	68 10 06 00 00       	push   $0x610
+  54:	e8 88 01 00 00       	call   1e1 <strchr>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	74 22                	je     82 <wc+0x82>
+        inword = 0;
+  60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	39 fb                	cmp    %edi,%ebx
+  6c:	7d b5                	jge    23 <wc+0x23>
+      c++;
+  6e:	83 c6 01             	add    $0x1,%esi
+      if(buf[i] == '\n')
+  71:	0f b6 83 c0 06 00 00 	movzbl 0x6c0(%ebx),%eax
+  78:	3c 0a                	cmp    $0xa,%al
+  7a:	75 cc                	jne    48 <wc+0x48>
+        l++;
+  7c:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  80:	eb c6                	jmp    48 <wc+0x48>
+      else if(!inword){
+  82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  86:	75 df                	jne    67 <wc+0x67>
+        w++;
+  88:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        inword = 1;
+  8c:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  93:	eb d2                	jmp    67 <wc+0x67>
+      }
+    }
+  }
+  if(n < 0){
+  95:	78 24                	js     bb <wc+0xbb>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  97:	83 ec 08             	sub    $0x8,%esp
+  9a:	ff 75 0c             	push   0xc(%ebp)
+  9d:	56                   	push   %esi
+  9e:	ff 75 dc             	push   -0x24(%ebp)
+  a1:	ff 75 e0             	push   -0x20(%ebp)
+  a4:	68 26 06 00 00       	push   $0x626
+  a9:	6a 01                	push   $0x1
+  ab:	e8 d0 03 00 00       	call   480 <printf>
+}
+  b0:	83 c4 20             	add    $0x20,%esp
+  b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b6:	5b                   	pop    %ebx
+  b7:	5e                   	pop    %esi
+  b8:	5f                   	pop    %edi
+  b9:	5d                   	pop    %ebp
+  ba:	c3                   	ret
+    printf(1, "wc: read error\n");
+  bb:	83 ec 08             	sub    $0x8,%esp
+  be:	68 16 06 00 00       	push   $0x616
+  c3:	6a 01                	push   $0x1
+  c5:	e8 b6 03 00 00       	call   480 <printf>
+    exit();
+  ca:	e8 34 02 00 00       	call   303 <exit>
+
+000000cf <main>:
+
+int
+main(int argc, char *argv[])
+{
+  cf:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d3:	83 e4 f0             	and    $0xfffffff0,%esp
+  d6:	ff 71 fc             	push   -0x4(%ecx)
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	57                   	push   %edi
+  dd:	56                   	push   %esi
+  de:	53                   	push   %ebx
+  df:	51                   	push   %ecx
+  e0:	83 ec 18             	sub    $0x18,%esp
+  e3:	8b 01                	mov    (%ecx),%eax
+  e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  e8:	8b 51 04             	mov    0x4(%ecx),%edx
+  eb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  ee:	83 f8 01             	cmp    $0x1,%eax
+  f1:	7e 07                	jle    fa <main+0x2b>
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  f3:	be 01 00 00 00       	mov    $0x1,%esi
+  f8:	eb 2d                	jmp    127 <main+0x58>
+    wc(0, "");
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	68 25 06 00 00       	push   $0x625
+ 102:	6a 00                	push   $0x0
+ 104:	e8 f7 fe ff ff       	call   0 <wc>
+    exit();
+ 109:	e8 f5 01 00 00       	call   303 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+ 10e:	83 ec 08             	sub    $0x8,%esp
+ 111:	ff 37                	push   (%edi)
+ 113:	50                   	push   %eax
+ 114:	e8 e7 fe ff ff       	call   0 <wc>
+    close(fd);
+ 119:	89 1c 24             	mov    %ebx,(%esp)
+ 11c:	e8 0a 02 00 00       	call   32b <close>
+  for(i = 1; i < argc; i++){
+ 121:	83 c6 01             	add    $0x1,%esi
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 12a:	39 c6                	cmp    %eax,%esi
+ 12c:	7d 31                	jge    15f <main+0x90>
+    if((fd = open(argv[i], 0)) < 0){
+ 12e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 131:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 134:	83 ec 08             	sub    $0x8,%esp
+ 137:	6a 00                	push   $0x0
+ 139:	ff 37                	push   (%edi)
+ 13b:	e8 03 02 00 00       	call   343 <open>
+ 140:	89 c3                	mov    %eax,%ebx
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	85 c0                	test   %eax,%eax
+ 147:	79 c5                	jns    10e <main+0x3f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 149:	83 ec 04             	sub    $0x4,%esp
+ 14c:	ff 37                	push   (%edi)
+ 14e:	68 33 06 00 00       	push   $0x633
+ 153:	6a 01                	push   $0x1
+ 155:	e8 26 03 00 00       	call   480 <printf>
+      exit();
+ 15a:	e8 a4 01 00 00       	call   303 <exit>
+  }
+  exit();
+ 15f:	e8 9f 01 00 00       	call   303 <exit>
+
+00000164 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 164:	55                   	push   %ebp
+ 165:	89 e5                	mov    %esp,%ebp
+ 167:	56                   	push   %esi
+ 168:	53                   	push   %ebx
+ 169:	8b 75 08             	mov    0x8(%ebp),%esi
+ 16c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 16f:	89 f0                	mov    %esi,%eax
+ 171:	89 d1                	mov    %edx,%ecx
+ 173:	83 c2 01             	add    $0x1,%edx
+ 176:	89 c3                	mov    %eax,%ebx
+ 178:	83 c0 01             	add    $0x1,%eax
+ 17b:	0f b6 09             	movzbl (%ecx),%ecx
+ 17e:	88 0b                	mov    %cl,(%ebx)
+ 180:	84 c9                	test   %cl,%cl
+ 182:	75 ed                	jne    171 <strcpy+0xd>
+    ;
+  return os;
+}
+ 184:	89 f0                	mov    %esi,%eax
+ 186:	5b                   	pop    %ebx
+ 187:	5e                   	pop    %esi
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+
+0000018a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 193:	eb 06                	jmp    19b <strcmp+0x11>
+    p++, q++;
+ 195:	83 c1 01             	add    $0x1,%ecx
+ 198:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 19b:	0f b6 01             	movzbl (%ecx),%eax
+ 19e:	84 c0                	test   %al,%al
+ 1a0:	74 04                	je     1a6 <strcmp+0x1c>
+ 1a2:	3a 02                	cmp    (%edx),%al
+ 1a4:	74 ef                	je     195 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1a6:	0f b6 c0             	movzbl %al,%eax
+ 1a9:	0f b6 12             	movzbl (%edx),%edx
+ 1ac:	29 d0                	sub    %edx,%eax
+}
+ 1ae:	5d                   	pop    %ebp
+ 1af:	c3                   	ret
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1bb:	eb 03                	jmp    1c0 <strlen+0x10>
+ 1bd:	83 c0 01             	add    $0x1,%eax
+ 1c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c4:	75 f7                	jne    1bd <strlen+0xd>
+    ;
+  return n;
+}
+ 1c6:	5d                   	pop    %ebp
+ 1c7:	c3                   	ret
+
+000001c8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c8:	55                   	push   %ebp
+ 1c9:	89 e5                	mov    %esp,%ebp
+ 1cb:	57                   	push   %edi
+ 1cc:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1cf:	89 d7                	mov    %edx,%edi
+ 1d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d7:	fc                   	cld
+ 1d8:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1da:	89 d0                	mov    %edx,%eax
+ 1dc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1df:	c9                   	leave
+ 1e0:	c3                   	ret
+
+000001e1 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1eb:	eb 03                	jmp    1f0 <strchr+0xf>
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	0f b6 10             	movzbl (%eax),%edx
+ 1f3:	84 d2                	test   %dl,%dl
+ 1f5:	74 06                	je     1fd <strchr+0x1c>
+    if(*s == c)
+ 1f7:	38 ca                	cmp    %cl,%dl
+ 1f9:	75 f2                	jne    1ed <strchr+0xc>
+ 1fb:	eb 05                	jmp    202 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+
+00000204 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+ 207:	57                   	push   %edi
+ 208:	56                   	push   %esi
+ 209:	53                   	push   %ebx
+ 20a:	83 ec 1c             	sub    $0x1c,%esp
+ 20d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 215:	89 de                	mov    %ebx,%esi
+ 217:	83 c3 01             	add    $0x1,%ebx
+ 21a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21d:	7d 2e                	jge    24d <gets+0x49>
+    cc = read(0, &c, 1);
+ 21f:	83 ec 04             	sub    $0x4,%esp
+ 222:	6a 01                	push   $0x1
+ 224:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 227:	50                   	push   %eax
+ 228:	6a 00                	push   $0x0
+ 22a:	e8 ec 00 00 00       	call   31b <read>
+    if(cc < 1)
+ 22f:	83 c4 10             	add    $0x10,%esp
+ 232:	85 c0                	test   %eax,%eax
+ 234:	7e 17                	jle    24d <gets+0x49>
+      break;
+    buf[i++] = c;
+ 236:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 23a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 23d:	3c 0a                	cmp    $0xa,%al
+ 23f:	0f 94 c2             	sete   %dl
+ 242:	3c 0d                	cmp    $0xd,%al
+ 244:	0f 94 c0             	sete   %al
+ 247:	08 c2                	or     %al,%dl
+ 249:	74 ca                	je     215 <gets+0x11>
+    buf[i++] = c;
+ 24b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 24d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 251:	89 f8                	mov    %edi,%eax
+ 253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5f                   	pop    %edi
+ 259:	5d                   	pop    %ebp
+ 25a:	c3                   	ret
+
+0000025b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 00                	push   $0x0
+ 265:	ff 75 08             	push   0x8(%ebp)
+ 268:	e8 d6 00 00 00       	call   343 <open>
+  if(fd < 0)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	78 24                	js     298 <stat+0x3d>
+ 274:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	ff 75 0c             	push   0xc(%ebp)
+ 27c:	50                   	push   %eax
+ 27d:	e8 d9 00 00 00       	call   35b <fstat>
+ 282:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 284:	89 1c 24             	mov    %ebx,(%esp)
+ 287:	e8 9f 00 00 00       	call   32b <close>
+  return r;
+ 28c:	83 c4 10             	add    $0x10,%esp
+}
+ 28f:	89 f0                	mov    %esi,%eax
+ 291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 294:	5b                   	pop    %ebx
+ 295:	5e                   	pop    %esi
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+    return -1;
+ 298:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 29d:	eb f0                	jmp    28f <stat+0x34>
+
+0000029f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 29f:	55                   	push   %ebp
+ 2a0:	89 e5                	mov    %esp,%ebp
+ 2a2:	53                   	push   %ebx
+ 2a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 2a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 2ab:	eb 10                	jmp    2bd <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 2ad:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 2b0:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 2b3:	83 c1 01             	add    $0x1,%ecx
+ 2b6:	0f be c0             	movsbl %al,%eax
+ 2b9:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 2bd:	0f b6 01             	movzbl (%ecx),%eax
+ 2c0:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c3:	80 fb 09             	cmp    $0x9,%bl
+ 2c6:	76 e5                	jbe    2ad <atoi+0xe>
+  return n;
+}
+ 2c8:	89 d0                	mov    %edx,%eax
+ 2ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cd:	c9                   	leave
+ 2ce:	c3                   	ret
+
+000002cf <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2cf:	55                   	push   %ebp
+ 2d0:	89 e5                	mov    %esp,%ebp
+ 2d2:	56                   	push   %esi
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2da:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2dd:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2df:	eb 0d                	jmp    2ee <memmove+0x1f>
+    *dst++ = *src++;
+ 2e1:	0f b6 01             	movzbl (%ecx),%eax
+ 2e4:	88 02                	mov    %al,(%edx)
+ 2e6:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2e9:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2ec:	89 d8                	mov    %ebx,%eax
+ 2ee:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2f1:	85 c0                	test   %eax,%eax
+ 2f3:	7f ec                	jg     2e1 <memmove+0x12>
+  return vdst;
+}
+ 2f5:	89 f0                	mov    %esi,%eax
+ 2f7:	5b                   	pop    %ebx
+ 2f8:	5e                   	pop    %esi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+
+000002fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <exit>:
+SYSCALL(exit)
+ 303:	b8 02 00 00 00       	mov    $0x2,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <wait>:
+SYSCALL(wait)
+ 30b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <pipe>:
+SYSCALL(pipe)
+ 313:	b8 04 00 00 00       	mov    $0x4,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <read>:
+SYSCALL(read)
+ 31b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <write>:
+SYSCALL(write)
+ 323:	b8 10 00 00 00       	mov    $0x10,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <close>:
+SYSCALL(close)
+ 32b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <exec>:
+SYSCALL(exec)
+ 33b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <open>:
+SYSCALL(open)
+ 343:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <unlink>:
+SYSCALL(unlink)
+ 353:	b8 12 00 00 00       	mov    $0x12,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fstat>:
+SYSCALL(fstat)
+ 35b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <link>:
+SYSCALL(link)
+ 363:	b8 13 00 00 00       	mov    $0x13,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mkdir>:
+SYSCALL(mkdir)
+ 36b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <chdir>:
+SYSCALL(chdir)
+ 373:	b8 09 00 00 00       	mov    $0x9,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <dup>:
+SYSCALL(dup)
+ 37b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getpid>:
+SYSCALL(getpid)
+ 383:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sbrk>:
+SYSCALL(sbrk)
+ 38b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sleep>:
+SYSCALL(sleep)
+ 393:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <uptime>:
+SYSCALL(uptime)
+ 39b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <yield>:
+SYSCALL(yield)
+ 3a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <shutdown>:
+SYSCALL(shutdown)
+ 3ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <nicefork>:
+SYSCALL(nicefork)
+ 3b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <schedlog>:
+SYSCALL(schedlog)
+ 3bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <schedstat>:
+SYSCALL(schedstat)
+ 3c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <spawn>:
+SYSCALL(spawn)
+ 3cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <bstat>:
+SYSCALL(bstat)
+ 3d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3db:	55                   	push   %ebp
+ 3dc:	89 e5                	mov    %esp,%ebp
+ 3de:	83 ec 1c             	sub    $0x1c,%esp
+ 3e1:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3e4:	6a 01                	push   $0x1
+ 3e6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3e9:	52                   	push   %edx
+ 3ea:	50                   	push   %eax
+ 3eb:	e8 33 ff ff ff       	call   323 <write>
+}
+ 3f0:	83 c4 10             	add    $0x10,%esp
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+
+000003f5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f5:	55                   	push   %ebp
+ 3f6:	89 e5                	mov    %esp,%ebp
+ 3f8:	57                   	push   %edi
+ 3f9:	56                   	push   %esi
+ 3fa:	53                   	push   %ebx
+ 3fb:	83 ec 2c             	sub    $0x2c,%esp
+ 3fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 401:	89 d0                	mov    %edx,%eax
+ 403:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 405:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 409:	0f 95 c1             	setne  %cl
+ 40c:	c1 ea 1f             	shr    $0x1f,%edx
+ 40f:	84 d1                	test   %dl,%cl
+ 411:	74 44                	je     457 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 413:	f7 d8                	neg    %eax
+ 415:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 417:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 41e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	ba 00 00 00 00       	mov    $0x0,%edx
+ 42a:	f7 f6                	div    %esi
+ 42c:	89 df                	mov    %ebx,%edi
+ 42e:	83 c3 01             	add    $0x1,%ebx
+ 431:	0f b6 92 a8 06 00 00 	movzbl 0x6a8(%edx),%edx
+ 438:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 43c:	89 ca                	mov    %ecx,%edx
+ 43e:	89 c1                	mov    %eax,%ecx
+ 440:	39 f2                	cmp    %esi,%edx
+ 442:	73 df                	jae    423 <printint+0x2e>
+  if(neg)
+ 444:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 448:	74 31                	je     47b <printint+0x86>
+    buf[i++] = '-';
+ 44a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 44f:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 452:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 455:	eb 17                	jmp    46e <printint+0x79>
+    x = xx;
+ 457:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 459:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 460:	eb bc                	jmp    41e <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 462:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 467:	89 f0                	mov    %esi,%eax
+ 469:	e8 6d ff ff ff       	call   3db <putc>
+  while(--i >= 0)
+ 46e:	83 eb 01             	sub    $0x1,%ebx
+ 471:	79 ef                	jns    462 <printint+0x6d>
+}
+ 473:	83 c4 2c             	add    $0x2c,%esp
+ 476:	5b                   	pop    %ebx
+ 477:	5e                   	pop    %esi
+ 478:	5f                   	pop    %edi
+ 479:	5d                   	pop    %ebp
+ 47a:	c3                   	ret
+ 47b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 47e:	eb ee                	jmp    46e <printint+0x79>
+
+00000480 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 489:	8d 45 10             	lea    0x10(%ebp),%eax
+ 48c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 48f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 494:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 499:	eb 14                	jmp    4af <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 49b:	89 fa                	mov    %edi,%edx
+ 49d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a0:	e8 36 ff ff ff       	call   3db <putc>
+ 4a5:	eb 05                	jmp    4ac <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 4a7:	83 fe 25             	cmp    $0x25,%esi
+ 4aa:	74 25                	je     4d1 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 4ac:	83 c3 01             	add    $0x1,%ebx
+ 4af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b2:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4b6:	84 c0                	test   %al,%al
+ 4b8:	0f 84 4a 01 00 00    	je     608 <printf+0x188>
+    c = fmt[i] & 0xff;
+ 4be:	0f be f8             	movsbl %al,%edi
+ 4c1:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4c4:	85 f6                	test   %esi,%esi
+ 4c6:	75 df                	jne    4a7 <printf+0x27>
+      if(c == '%'){
+ 4c8:	83 f8 25             	cmp    $0x25,%eax
+ 4cb:	75 ce                	jne    49b <printf+0x1b>
+        state = '%';
+ 4cd:	89 c6                	mov    %eax,%esi
+ 4cf:	eb db                	jmp    4ac <printf+0x2c>
+      if(c == 'd'){
+ 4d1:	83 f8 25             	cmp    $0x25,%eax
+ 4d4:	0f 84 f9 00 00 00    	je     5d3 <printf+0x153>
+ 4da:	0f 8c 07 01 00 00    	jl     5e7 <printf+0x167>
+ 4e0:	83 f8 78             	cmp    $0x78,%eax
+ 4e3:	0f 8f fe 00 00 00    	jg     5e7 <printf+0x167>
+ 4e9:	83 f8 63             	cmp    $0x63,%eax
+ 4ec:	0f 8c f5 00 00 00    	jl     5e7 <printf+0x167>
+ 4f2:	83 e8 63             	sub    $0x63,%eax
+ 4f5:	83 f8 15             	cmp    $0x15,%eax
+ 4f8:	0f 87 e9 00 00 00    	ja     5e7 <printf+0x167>
+ 4fe:	ff 24 85 50 06 00 00 	jmp    *0x650(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 505:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 508:	8b 17                	mov    (%edi),%edx
+ 50a:	83 ec 0c             	sub    $0xc,%esp
+ 50d:	6a 01                	push   $0x1
+ 50f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 514:	8b 45 08             	mov    0x8(%ebp),%eax
+ 517:	e8 d9 fe ff ff       	call   3f5 <printint>
+        ap++;
+ 51c:	83 c7 04             	add    $0x4,%edi
+ 51f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 522:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 525:	be 00 00 00 00       	mov    $0x0,%esi
+ 52a:	eb 80                	jmp    4ac <printf+0x2c>
+        printint(fd, *ap, 10, 0);
+ 52c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 52f:	8b 17                	mov    (%edi),%edx
+ 531:	83 ec 0c             	sub    $0xc,%esp
+ 534:	6a 00                	push   $0x0
+ 536:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 53b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53e:	e8 b2 fe ff ff       	call   3f5 <printint>
+        ap++;
+ 543:	83 c7 04             	add    $0x4,%edi
+ 546:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 549:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54c:	be 00 00 00 00       	mov    $0x0,%esi
+ 551:	e9 56 ff ff ff       	jmp    4ac <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 559:	8b 17                	mov    (%edi),%edx
+ 55b:	83 ec 0c             	sub    $0xc,%esp
+ 55e:	6a 00                	push   $0x0
+ 560:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 565:	8b 45 08             	mov    0x8(%ebp),%eax
+ 568:	e8 88 fe ff ff       	call   3f5 <printint>
+        ap++;
+ 56d:	83 c7 04             	add    $0x4,%edi
+ 570:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 573:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 576:	be 00 00 00 00       	mov    $0x0,%esi
+ 57b:	e9 2c ff ff ff       	jmp    4ac <printf+0x2c>
+        s = (char*)*ap;
+ 580:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 583:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 585:	83 c0 04             	add    $0x4,%eax
+ 588:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 58b:	85 f6                	test   %esi,%esi
+ 58d:	75 15                	jne    5a4 <printf+0x124>
+          s = "(null)";
+ 58f:	be 47 06 00 00       	mov    $0x647,%esi
+ 594:	eb 0e                	jmp    5a4 <printf+0x124>
+          putc(fd, *s);
+ 596:	0f be d2             	movsbl %dl,%edx
+ 599:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59c:	e8 3a fe ff ff       	call   3db <putc>
+          s++;
+ 5a1:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 5a4:	0f b6 16             	movzbl (%esi),%edx
+ 5a7:	84 d2                	test   %dl,%dl
+ 5a9:	75 eb                	jne    596 <printf+0x116>
+      state = 0;
+ 5ab:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b0:	e9 f7 fe ff ff       	jmp    4ac <printf+0x2c>
+        putc(fd, *ap);
+ 5b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5b8:	0f be 17             	movsbl (%edi),%edx
+ 5bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5be:	e8 18 fe ff ff       	call   3db <putc>
+        ap++;
+ 5c3:	83 c7 04             	add    $0x4,%edi
+ 5c6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5c9:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ce:	e9 d9 fe ff ff       	jmp    4ac <printf+0x2c>
+        putc(fd, c);
+ 5d3:	89 fa                	mov    %edi,%edx
+ 5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d8:	e8 fe fd ff ff       	call   3db <putc>
+      state = 0;
+ 5dd:	be 00 00 00 00       	mov    $0x0,%esi
+ 5e2:	e9 c5 fe ff ff       	jmp    4ac <printf+0x2c>
+        putc(fd, '%');
+ 5e7:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ef:	e8 e7 fd ff ff       	call   3db <putc>
+        putc(fd, c);
+ 5f4:	89 fa                	mov    %edi,%edx
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f9:	e8 dd fd ff ff       	call   3db <putc>
+      state = 0;
+ 5fe:	be 00 00 00 00       	mov    $0x0,%esi
+ 603:	e9 a4 fe ff ff       	jmp    4ac <printf+0x2c>
+    }
+  }
+}
+ 608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60b:	5b                   	pop    %ebx
+ 60c:	5e                   	pop    %esi
+ 60d:	5f                   	pop    %edi
+ 60e:	5d                   	pop    %ebp
+ 60f:	c3                   	ret